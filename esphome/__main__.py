@@ -17,6 +17,7 @@ from esphome.const import (
     CONF_PORT,
     CONF_ESPHOME,
     CONF_PLATFORMIO_OPTIONS,
+    CONF_STATIC_ALLOCATION,
 )
 from esphome.core import CORE, EsphomeError, coroutine
 from esphome.helpers import indent
@@ -168,7 +169,10 @@ def compile_program(args, config):
     from esphome import platformio_api
 
     _LOGGER.info("Compiling app...")
-    return platformio_api.run_compile(config, CORE.verbose)
+    rc = platformio_api.run_compile(config, CORE.verbose)
+    if rc == 0 and config[CONF_ESPHOME][CONF_STATIC_ALLOCATION]:
+        platformio_api.report_static_storage(config)
+    return rc
 
 
 def upload_using_esptool(config, port):
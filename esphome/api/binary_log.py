@@ -0,0 +1,225 @@
+"""Decoding of the binary log messages of the native API.
+
+Nodes send SubscribeLogsBinaryResponse messages to clients that ask for them. A message
+carries the addresses of its tag and format string in the firmware and the arguments of
+the format string encoded by logger::encode_log_args(). The strings are read from the
+ELF file of the build, which is the table of all of them, and the message is formatted
+here instead of on the node.
+"""
+import re
+import struct
+
+# SubscribeLogsBinaryResponse, see api.proto
+BINARY_LOG_MESSAGE_TYPE = 57
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+LOG_LEVEL_COLORS = [
+    "",  # NONE
+    "\033[1;31m",  # ERROR
+    "\033[0;33m",  # WARNING
+    "\033[0;32m",  # INFO
+    "\033[0;35m",  # CONFIG
+    "\033[0;36m",  # DEBUG
+    "\033[0;37m",  # VERBOSE
+    "\033[0;38m",  # VERY_VERBOSE
+]
+LOG_LEVEL_LETTERS = ["", "E", "W", "I", "C", "D", "V", "VV"]
+LOG_RESET_COLOR = "\033[0m"
+
+# Like logger::encode_log_args(): flags, width, precision, length and the conversion
+CONVERSION_RE = re.compile(
+    r"%([-+ #0]*)(\*|\d*)(?:\.(\*|\d*))?([hljztL]*)(.?)", re.DOTALL
+)
+
+
+class FirmwareStrings:
+    """The strings of a firmware, looked up by their address on the node."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self._data = f.read()
+        self._sections = []
+        self._cache = {}
+        self._parse()
+
+    def _parse(self):
+        data = self._data
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("Not a little endian 32 bit ELF file")
+        (shoff,) = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        for i in range(shnum):
+            (_, sh_type, flags, addr, offset, size) = struct.unpack_from(
+                "<IIIIII", data, shoff + i * shentsize
+            )
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and size != 0:
+                self._sections.append((addr, offset, size))
+
+    def contains(self, value):
+        """Whether the bytes are somewhere in the firmware."""
+        return value in self._data
+
+    def get_string(self, address):
+        """The string at the address, or None if it's not in the firmware."""
+        if address in self._cache:
+            return self._cache[address]
+        result = None
+        for addr, offset, size in self._sections:
+            if addr <= address < addr + size:
+                start = offset + address - addr
+                end = self._data.find(b"\0", start, offset + size)
+                if end != -1:
+                    result = self._data[start:end].decode("utf-8", "backslashreplace")
+                break
+        self._cache[address] = result
+        return result
+
+
+class _Args:
+    def __init__(self, data):
+        self._data = data
+        self._at = 0
+
+    def read(self, fmt):
+        size = struct.calcsize(fmt)
+        if self._at + size > len(self._data):
+            raise IndexError
+        (value,) = struct.unpack_from(fmt, self._data, self._at)
+        self._at += size
+        return value
+
+    def read_string(self):
+        end = self._data.find(b"\0", self._at)
+        truncated = end == -1
+        if truncated:
+            end = len(self._data)
+        value = self._data[self._at : end].decode("utf-8", "backslashreplace")
+        self._at = end + 1
+        return value, truncated
+
+
+def _convert(match, args):
+    """Format one conversion, returns the text and whether the arguments ended."""
+    flags, width, precision, length, conv = match.groups()
+    if not conv:
+        return None, True
+    if conv == "%":
+        return "%", False
+    if width == "*":
+        width = str(args.read("<i"))
+    if precision == "*":
+        precision = str(args.read("<i"))
+    spec = "%" + flags + width + ("" if precision is None else "." + precision)
+    wide = "ll" in length or "j" in length
+
+    if conv in "di":
+        value = args.read("<q" if wide else "<i")
+        if length == "h":
+            value = struct.unpack("<h", struct.pack("<H", value & 0xFFFF))[0]
+        elif length == "hh":
+            value = struct.unpack("<b", struct.pack("<B", value & 0xFF))[0]
+        return (spec + "d") % value, False
+    if conv in "uxXo":
+        value = args.read("<Q" if wide else "<I")
+        if length == "h":
+            value &= 0xFFFF
+        elif length == "hh":
+            value &= 0xFF
+        return (spec + ("d" if conv == "u" else conv)) % value, False
+    if conv == "c":
+        return (spec + "s") % chr(args.read("<I") & 0xFF), False
+    if conv == "p":
+        return (spec + "s") % hex(args.read("<I")), False
+    if conv in "fFeEgGaA":
+        if "L" in length:
+            return None, True
+        value = args.read("<d")
+        if conv in "aA":
+            text = value.hex()
+            return (spec + "s") % (text.upper() if conv == "A" else text), False
+        return (spec + conv) % value, False
+    if conv == "s":
+        value, truncated = args.read_string()
+        return (spec + "s") % value, truncated
+    if conv == "n":
+        return "", False
+    return None, True
+
+
+def format_message(fmt, data):
+    """Format the format string with arguments from logger::encode_log_args()."""
+    args = _Args(data)
+    out = []
+    pos = 0
+    for match in CONVERSION_RE.finditer(fmt):
+        out.append(fmt[pos : match.start()])
+        pos = match.start()
+        try:
+            text, ended = _convert(match, args)
+        except IndexError:
+            text, ended = None, True
+        if text is not None:
+            out.append(text)
+            pos = match.end()
+        if ended:
+            # The node stopped encoding here, the rest can't be formatted
+            break
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def format_log_line(strings, level, tag, fmt, line, data):
+    """The line of a binary log message, formatted like the logger on the node does."""
+    tag_str = strings.get_string(tag)
+    fmt_str = strings.get_string(fmt)
+    if tag_str is None:
+        tag_str = f"0x{tag:08X}"
+    if fmt_str is None:
+        message = f"<format 0x{fmt:08X} not in firmware.elf, arguments {data.hex()}>"
+    else:
+        message = format_message(fmt_str, data)
+    if message.endswith("\n"):
+        message = message[:-1]
+    level = min(max(level, 0), 7)
+    letter = LOG_LEVEL_LETTERS[level]
+    header = f"{LOG_LEVEL_COLORS[level]}[{letter}][{tag_str}:{line:03}]: "
+    return header + message + LOG_RESET_COLOR
+
+
+def parse_binary_log_message(raw):
+    """The level, tag, format, line and args of a SubscribeLogsBinaryResponse."""
+    fields = {1: 0, 2: 0, 3: 0, 4: 0, 5: b""}
+    i = 0
+    while i < len(raw):
+        key, i = _read_varint(raw, i)
+        field, wire_type = key >> 3, key & 0x7
+        if wire_type == 0:
+            value, i = _read_varint(raw, i)
+        elif wire_type == 5:
+            (value,) = struct.unpack_from("<I", raw, i)
+            i += 4
+        elif wire_type == 2:
+            size, i = _read_varint(raw, i)
+            value = raw[i : i + size]
+            i += size
+        elif wire_type == 1:
+            (value,) = struct.unpack_from("<Q", raw, i)
+            i += 8
+        else:
+            raise ValueError(f"Unknown wire type {wire_type}")
+        fields[field] = value
+    return fields[1], fields[2], fields[3], fields[4], bytes(fields[5])
+
+
+def _read_varint(raw, i):
+    result = 0
+    shift = 0
+    while True:
+        byte = raw[i]
+        i += 1
+        result |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return result, i
@@ -1,6 +1,7 @@
 from datetime import datetime
 import functools
 import logging
+import os
 import socket
 import threading
 import time
@@ -11,8 +12,15 @@ from google.protobuf import message  # noqa
 
 from esphome import const
 import esphome.api.api_pb2 as pb
-from esphome.const import CONF_PASSWORD, CONF_PORT
-from esphome.core import EsphomeError
+from esphome.api import frame_cipher
+from esphome.api.binary_log import (
+    BINARY_LOG_MESSAGE_TYPE,
+    FirmwareStrings,
+    format_log_line,
+    parse_binary_log_message,
+)
+from esphome.const import CONF_KEY, CONF_PASSWORD, CONF_PORT
+from esphome.core import CORE, EsphomeError
 from esphome.helpers import resolve_ip_address, indent
 from esphome.log import color, Fore
 from esphome.util import safe_print
@@ -94,17 +102,21 @@ def _bytes_to_varuint(value):
 
 # pylint: disable=too-many-instance-attributes,not-callable
 class APIClient(threading.Thread):
-    def __init__(self, address, port, password):
+    def __init__(self, address, port, password, encryption_key=None):
         threading.Thread.__init__(self)
         self._address = address  # type: str
         self._port = port  # type: int
         self._password = password  # type: Optional[str]
+        # The base64 pre-shared key of api: encryption:
+        self._encryption_key = encryption_key  # type: Optional[str]
+        self._cipher = None  # type: Optional[frame_cipher.FrameCipher]
         self._socket = None  # type: Optional[socket.socket]
         self._socket_open_event = threading.Event()
         self._socket_write_lock = threading.Lock()
         self._connected = False
         self._authenticated = False
         self._message_handlers = []
+        self._log_strings = None  # type: Optional[FirmwareStrings]
         self._keepalive = 5
         self._ping_timer = None
 
@@ -149,6 +161,7 @@ class APIClient(threading.Thread):
             self._socket.close()
             self._socket = None
         self._socket_open_event.clear()
+        self._cipher = None
         self._connected = False
         self._authenticated = False
         self._message_handlers = []
@@ -194,10 +207,15 @@ class APIClient(threading.Thread):
         self._socket.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
         try:
             self._socket.connect((ip, self._port))
+            if self._encryption_key is not None:
+                self._cipher = self._handshake()
         except OSError as err:
             err = APIConnectionError(f"Error connecting to {ip}: {err}")
             self._fatal_error(err)
             raise err
+        except APIConnectionError as err:
+            self._fatal_error(err)
+            raise err
         self._socket.settimeout(0.1)
 
         self._socket_open_event.set()
@@ -221,6 +239,34 @@ class APIClient(threading.Thread):
         if self.on_connect is not None:
             self.on_connect()
 
+    def _handshake(self):
+        """Exchange the nonces with the node, before the reader thread starts."""
+        try:
+            psk = frame_cipher.decode_key(self._encryption_key)
+        except ValueError as err:
+            raise APIConnectionError(f"Invalid encryption key: {err}") from err
+        header = frame_cipher.frame_header(frame_cipher.NONCE_SIZE)
+        client_nonce = os.urandom(frame_cipher.NONCE_SIZE)
+        self._socket.sendall(header + client_nonce)
+        reply = b""
+        while len(reply) < len(header) + frame_cipher.NONCE_SIZE:
+            data = self._socket.recv(len(header) + frame_cipher.NONCE_SIZE - len(reply))
+            if not data:
+                raise APIConnectionError(
+                    "Connection closed during the handshake, is encryption enabled "
+                    "on the node?"
+                )
+            reply += data
+        if reply[: len(header)] != header:
+            raise APIConnectionError("Invalid handshake, is encryption enabled?")
+        try:
+            return frame_cipher.FrameCipher(psk, client_nonce, reply[len(header) :])
+        except ImportError as err:
+            raise APIConnectionError(
+                "Encryption needs the cryptography package: "
+                "pip3 install cryptography"
+            ) from err
+
     def _check_connected(self):
         if not self._connected:
             err = APIConnectionError("Must be connected!")
@@ -251,29 +297,37 @@ class APIClient(threading.Thread):
         if was_connected and self.on_disconnect is not None:
             self.on_disconnect(err)
 
-    def _write(self, data):  # type: (bytes) -> None
+    def _write(self, data, message_type=None):
+        # type: (bytes, Optional[int]) -> None
         if self._socket is None:
             raise APIConnectionError("Socket closed")
 
         # _LOGGER.debug("Write: %s", format_bytes(data))
         with self._socket_write_lock:
             try:
+                if self._cipher is not None:
+                    # Under the lock, the frame counters have to match the order
+                    data = self._cipher.encrypt(message_type, data)
                 self._socket.sendall(data)
             except OSError as err:
                 err = APIConnectionError(f"Error while writing data: {err}")
                 self._fatal_error(err)
                 raise err
 
-    def _send_message(self, msg):
-        # type: (message.Message) -> None
+    def _send_message(self, msg, extra=b""):
+        # type: (message.Message, bytes) -> None
         for message_type, klass in MESSAGE_TYPE_TO_PROTO.items():
             if isinstance(msg, klass):
                 break
         else:
             raise ValueError
 
-        encoded = msg.SerializeToString()
+        # Encoded fields appended to the message merge into it
+        encoded = msg.SerializeToString() + extra
         _LOGGER.debug("Sending %s:\n%s", type(msg), indent(str(msg)))
+        if self._cipher is not None:
+            self._write(encoded, message_type)
+            return
         req = bytes([0])
         req += _varuint_to_bytes(len(encoded))
         req += _varuint_to_bytes(message_type)
@@ -339,7 +393,13 @@ class APIClient(threading.Thread):
         if not self._authenticated:
             raise APIConnectionError("Must login first!")
 
-    def subscribe_logs(self, on_log, log_level=7, dump_config=False):
+    def subscribe_logs(self, on_log, log_level=7, dump_config=False, strings=None):
+        """Subscribe to the logs of the node.
+
+        With the strings of the firmware of the node (a FirmwareStrings), the messages
+        are sent unformatted and formatted here. on_log gets SubscribeLogsResponse
+        messages either way.
+        """
         self._check_authenticated()
 
         def on_msg(msg):
@@ -347,9 +407,41 @@ class APIClient(threading.Thread):
                 on_log(msg)
 
         self._message_handlers.append(on_msg)
+        self._log_strings = strings
         req = pb.SubscribeLogsRequest(dump_config=dump_config)
         req.level = log_level
-        self._send_message(req)
+        # bool binary = 3, which api_pb2 doesn't know yet
+        self._send_message(req, b"\x18\x01" if strings is not None else b"")
+
+    def list_entities(self):
+        self._check_authenticated()
+
+        def do_append(msg):
+            return type(msg).__name__.startswith("ListEntities") and not isinstance(
+                msg, pb.ListEntitiesDoneResponse
+            )
+
+        def do_stop(msg):
+            return isinstance(msg, pb.ListEntitiesDoneResponse)
+
+        return self._send_message_await_response_complex(
+            pb.ListEntitiesRequest(), do_append, do_stop, timeout=10
+        )
+
+    def subscribe_states(self, on_state):
+        self._check_authenticated()
+
+        def on_msg(msg):
+            # SubscribeHomeAssistantStateResponse has no key, it's not an entity state
+            if type(msg).__name__.endswith("StateResponse") and hasattr(msg, "key"):
+                on_state(msg)
+
+        self._message_handlers.append(on_msg)
+        self._send_message(pb.SubscribeStatesRequest())
+
+    def send_command(self, msg):
+        self._check_authenticated()
+        self._send_message(msg)
 
     def _recv(self, amount):
         ret = bytes()
@@ -382,20 +474,38 @@ class APIClient(threading.Thread):
         if not self._socket_open_event.wait(0.1):
             return
 
-        # Preamble
-        if self._recv(1)[0] != 0x00:
-            raise APIConnectionError("Invalid preamble")
-
-        length = self._recv_varint()
-        msg_type = self._recv_varint()
-
-        raw_msg = self._recv(length)
-        if msg_type not in MESSAGE_TYPE_TO_PROTO:
+        cipher = self._cipher
+        if cipher is not None:
+            header = self._recv(frame_cipher.FRAME_HEADER_SIZE)
+            if header[0] != frame_cipher.FRAME_PREAMBLE:
+                raise APIConnectionError("Invalid preamble")
+            body = self._recv((header[1] << 8) | header[2])
+            try:
+                msg_type, raw_msg = cipher.decrypt(header, body)
+            except ValueError as err:
+                raise APIConnectionError(str(err)) from err
+        else:
+            # Preamble
+            if self._recv(1)[0] != 0x00:
+                raise APIConnectionError("Invalid preamble")
+
+            length = self._recv_varint()
+            msg_type = self._recv_varint()
+
+            raw_msg = self._recv(length)
+        if msg_type == BINARY_LOG_MESSAGE_TYPE and self._log_strings is not None:
+            level, tag, fmt, line, args = parse_binary_log_message(raw_msg)
+            msg = pb.SubscribeLogsResponse()
+            msg.level = level
+            msg.message = format_log_line(
+                self._log_strings, level, tag, fmt, line, args
+            )
+        elif msg_type not in MESSAGE_TYPE_TO_PROTO:
             _LOGGER.debug("Skipping message type %s", msg_type)
             return
-
-        msg = MESSAGE_TYPE_TO_PROTO[msg_type]()
-        msg.ParseFromString(raw_msg)
+        else:
+            msg = MESSAGE_TYPE_TO_PROTO[msg_type]()
+            msg.ParseFromString(raw_msg)
         _LOGGER.debug("Got message: %s:\n%s", type(msg), indent(str(msg)))
         for msg_handler in self._message_handlers[:]:
             msg_handler(msg)
@@ -435,9 +545,16 @@ def run_logs(config, address):
     conf = config["api"]
     port = conf[CONF_PORT]
     password = conf[CONF_PASSWORD]
+    encryption_key = conf.get("encryption", {}).get(CONF_KEY)
     _LOGGER.info("Starting log output from %s using esphome API", address)
 
-    cli = APIClient(address, port, password)
+    cli = APIClient(address, port, password, encryption_key)
+    strings = None
+    if os.path.isfile(CORE.firmware_elf):
+        try:
+            strings = FirmwareStrings(CORE.firmware_elf)
+        except (OSError, ValueError) as err:
+            _LOGGER.warning("Can't read %s: %s", CORE.firmware_elf, err)
     stopping = False
     retry_timer = []
 
@@ -497,7 +614,19 @@ def run_logs(config, address):
 
     def on_login():
         try:
-            cli.subscribe_logs(on_log, dump_config=not has_connects)
+            log_strings = strings
+            if log_strings is not None:
+                # Only the same build has the strings at the same addresses
+                compilation_time = cli.device_info().compilation_time
+                if not log_strings.contains(compilation_time.encode()):
+                    _LOGGER.info(
+                        "The node runs another build than %s, using formatted logs",
+                        CORE.firmware_elf,
+                    )
+                    log_strings = None
+            cli.subscribe_logs(
+                on_log, dump_config=not has_connects, strings=log_strings
+            )
             has_connects.append(True)
         except APIConnectionError:
             cli.disconnect()
@@ -0,0 +1,80 @@
+"""Client side of the encrypted native API frames, see api_frame_cipher.h.
+
+A connection with encryption starts with a nonce exchange in [0x01][16 bit length]
+frames. Both sides then derive one AES-256-GCM key per direction from the pre-shared
+key and the nonces. All later frames carry the message type and the message, encrypted
+and authenticated together with the frame header. The frame counter of the direction
+is the IV.
+"""
+import base64
+import hashlib
+import hmac
+import struct
+
+FRAME_PREAMBLE = 0x01
+FRAME_HEADER_SIZE = 3
+KEY_SIZE = 32
+NONCE_SIZE = 16
+TAG_SIZE = 16
+
+
+def frame_header(size):
+    """The header of a frame with size bytes after it."""
+    return bytes([FRAME_PREAMBLE, size >> 8, size & 0xFF])
+
+
+def decode_key(value):
+    """The pre-shared key from its base64 form in the api: encryption: config."""
+    key = base64.b64decode(value, validate=True)
+    if len(key) != KEY_SIZE:
+        raise ValueError(f"Encryption key must be {KEY_SIZE} bytes long")
+    return key
+
+
+def _derive_key(psk, label, client_nonce, server_nonce):
+    return hmac.new(psk, label + client_nonce + server_nonce, hashlib.sha256).digest()
+
+
+def _iv(counter):
+    return struct.pack("<Q", counter) + bytes(4)
+
+
+class FrameCipher:
+    """The AES-256-GCM keys and frame counters of one encrypted connection."""
+
+    def __init__(self, psk, client_nonce, server_nonce):
+        # Imported here, the cryptography package is only needed for encryption
+        # pylint: disable=import-outside-toplevel
+        from cryptography.hazmat.primitives.ciphers.aead import AESGCM
+
+        self._tx = AESGCM(_derive_key(psk, b"esphome c2s", client_nonce, server_nonce))
+        self._rx = AESGCM(_derive_key(psk, b"esphome s2c", client_nonce, server_nonce))
+        self._tx_counter = 0
+        self._rx_counter = 0
+
+    def encrypt(self, message_type, data):
+        """The frame for a message, frames must be sent in the order they're made."""
+        header = frame_header(2 + len(data) + TAG_SIZE)
+        plain = struct.pack(">H", message_type) + data
+        encrypted = self._tx.encrypt(_iv(self._tx_counter), plain, header)
+        self._tx_counter += 1
+        return header + encrypted
+
+    def decrypt(self, header, body):
+        """The message type and message of a received frame.
+
+        Raises ValueError if the frame was modified, is out of order or was encrypted
+        with another key.
+        """
+        # pylint: disable=import-outside-toplevel
+        from cryptography.exceptions import InvalidTag
+
+        if len(body) < 2 + TAG_SIZE:
+            raise ValueError("Frame too short")
+        try:
+            plain = self._rx.decrypt(_iv(self._rx_counter), body, header)
+        except InvalidTag as err:
+            raise ValueError("Could not decrypt frame, wrong encryption key?") from err
+        self._rx_counter += 1
+        (message_type,) = struct.unpack_from(">H", plain)
+        return message_type, plain[2:]
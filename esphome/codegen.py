@@ -45,6 +45,8 @@ from esphome.cpp_helpers import (  # noqa
     build_registry_list,
     extract_registry_entry_config,
     register_parented,
+    object_id_from_name,
+    setup_entity_name,
 )
 from esphome.cpp_types import (  # noqa
     global_ns,
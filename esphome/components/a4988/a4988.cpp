@@ -17,6 +17,13 @@ void A4988::setup() {
   this->step_pin_->digital_write(false);
   this->dir_pin_->setup();
   this->dir_pin_->digital_write(false);
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_step_timer_) {
+    this->isr_step_pin_ = this->step_pin_->to_isr();
+    this->isr_dir_pin_ = this->dir_pin_->to_isr();
+    this->use_step_timer_ = this->step_timer_.setup();
+  }
+#endif
 }
 void A4988::dump_config() {
   ESP_LOGCONFIG(TAG, "A4988:");
@@ -24,6 +31,10 @@ void A4988::dump_config() {
   LOG_PIN("  Dir Pin: ", this->dir_pin_);
   LOG_PIN("  Sleep Pin: ", this->sleep_pin_);
   LOG_STEPPER(this);
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_step_timer_)
+    ESP_LOGCONFIG(TAG, "  Step Timer: %u", this->step_timer_.get_timer_num());
+#endif
 }
 void A4988::loop() {
   bool at_target = this->has_reached_target();
@@ -35,6 +46,14 @@ void A4988::loop() {
       delayMicroseconds(1000);
     }
   }
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_step_timer_) {
+    this->step_timer_.update_profile();
+    if (!at_target)
+      this->step_timer_.start();
+    return;
+  }
+#endif
   if (at_target) {
     this->high_freq_.stop();
   } else {
@@ -51,5 +70,16 @@ void A4988::loop() {
   this->step_pin_->digital_write(false);
 }
 
+#ifdef ARDUINO_ARCH_ESP32
+void ICACHE_RAM_ATTR HOT A4988::s_step(void *arg, int32_t dir) {
+  auto *a4988 = static_cast<A4988 *>(arg);
+  a4988->isr_dir_pin_->digital_write(dir == 1);
+  a4988->isr_step_pin_->digital_write(true);
+  // The A4988 needs a pulse of at least 1 µs
+  delayMicroseconds(2);
+  a4988->isr_step_pin_->digital_write(false);
+}
+#endif
+
 }  // namespace a4988
 }  // namespace esphome
@@ -12,6 +12,10 @@ class A4988 : public stepper::Stepper, public Component {
   void set_step_pin(GPIOPin *step_pin) { step_pin_ = step_pin; }
   void set_dir_pin(GPIOPin *dir_pin) { dir_pin_ = dir_pin; }
   void set_sleep_pin(GPIOPin *sleep_pin) { this->sleep_pin_ = sleep_pin; }
+#ifdef ARDUINO_ARCH_ESP32
+  /// Generate the steps in a hardware timer interrupt, see stepper::StepTimer. The step and dir pins must be internal.
+  void set_step_timer(bool step_timer) { this->use_step_timer_ = step_timer; }
+#endif
   void setup() override;
   void dump_config() override;
   void loop() override;
@@ -23,6 +27,14 @@ class A4988 : public stepper::Stepper, public Component {
   GPIOPin *sleep_pin_{nullptr};
   bool sleep_pin_state_;
   HighFrequencyLoopRequester high_freq_;
+#ifdef ARDUINO_ARCH_ESP32
+  static void s_step(void *arg, int32_t dir);
+
+  bool use_step_timer_{false};
+  stepper::StepTimer step_timer_{this, &A4988::s_step, this};
+  ISRInternalGPIOPin *isr_step_pin_;
+  ISRInternalGPIOPin *isr_dir_pin_;
+#endif
 };
 
 }  // namespace a4988
@@ -8,14 +8,17 @@ from esphome.const import CONF_DIR_PIN, CONF_ID, CONF_SLEEP_PIN, CONF_STEP_PIN
 a4988_ns = cg.esphome_ns.namespace("a4988")
 A4988 = a4988_ns.class_("A4988", stepper.Stepper, cg.Component)
 
-CONFIG_SCHEMA = stepper.STEPPER_SCHEMA.extend(
-    {
-        cv.Required(CONF_ID): cv.declare_id(A4988),
-        cv.Required(CONF_STEP_PIN): pins.gpio_output_pin_schema,
-        cv.Required(CONF_DIR_PIN): pins.gpio_output_pin_schema,
-        cv.Optional(CONF_SLEEP_PIN): pins.gpio_output_pin_schema,
-    }
-).extend(cv.COMPONENT_SCHEMA)
+CONFIG_SCHEMA = cv.All(
+    stepper.STEPPER_SCHEMA.extend(
+        {
+            cv.Required(CONF_ID): cv.declare_id(A4988),
+            cv.Required(CONF_STEP_PIN): pins.gpio_output_pin_schema,
+            cv.Required(CONF_DIR_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_SLEEP_PIN): pins.gpio_output_pin_schema,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    stepper.validate_step_timer(CONF_STEP_PIN, CONF_DIR_PIN),
+)
 
 
 async def to_code(config):
@@ -5,6 +5,9 @@
 #ifdef ARDUINO_ARCH_ESP8266
 #include <core_esp8266_waveform.h>
 #endif
+#ifdef ARDUINO_ARCH_ESP32
+#include <soc/timer_group_struct.h>
+#endif
 
 namespace esphome {
 namespace ac_dimmer {
@@ -76,6 +79,27 @@ uint32_t ICACHE_RAM_ATTR HOT timer_interrupt() {
   return min_dt_us;
 }
 
+#ifdef ARDUINO_ARCH_ESP32
+// ESP32 implementation, uses basically the same code but needs to wrap
+// timer_interrupt() function to auto-reschedule
+static hw_timer_t *dimmer_timer = nullptr;
+
+/// Fire the one-shot timer interrupt once in dt_us µs.
+/// The timerX functions are not callable from ISR (placed in flash storage), so this sets the alarm of the
+/// timer (timer 0 of group 0, counting µs) through its registers.
+static void ICACHE_RAM_ATTR HOT schedule_timer_interrupt(uint32_t dt_us) {
+  if (dimmer_timer == nullptr)
+    return;
+  auto &timer = TIMERG0.hw_timer[0];
+  timer.update = 1;
+  const uint64_t alarm = ((uint64_t(timer.cnt_high) << 32) | timer.cnt_low) + dt_us;
+  timer.alarm_high = uint32_t(alarm >> 32);
+  timer.alarm_low = uint32_t(alarm);
+  timer.config.alarm_en = 1;
+}
+void ICACHE_RAM_ATTR HOT AcDimmerDataStore::s_timer_intr() { schedule_timer_interrupt(timer_interrupt()); }
+#endif
+
 /// GPIO interrupt routine, called when ZC pin triggers
 void ICACHE_RAM_ATTR HOT AcDimmerDataStore::gpio_intr() {
   uint32_t prev_crossed = this->crossed_zero_at;
@@ -136,14 +160,11 @@ void ICACHE_RAM_ATTR HOT AcDimmerDataStore::s_gpio_intr(AcDimmerDataStore *store
       dimmer->gpio_intr();
     }
   }
-}
-
 #ifdef ARDUINO_ARCH_ESP32
-// ESP32 implementation, uses basically the same code but needs to wrap
-// timer_interrupt() function to auto-reschedule
-static hw_timer_t *dimmer_timer = nullptr;
-void ICACHE_RAM_ATTR HOT AcDimmerDataStore::s_timer_intr() { timer_interrupt(); }
+  // The gate times changed, move the timer interrupt to the first of them
+  schedule_timer_interrupt(timer_interrupt());
 #endif
+}
 
 void AcDimmer::setup() {
   // extend all_dimmers array with our dimmer
@@ -183,10 +204,8 @@ void AcDimmer::setup() {
   // 80 Divider -> 1 count=1µs
   dimmer_timer = timerBegin(0, 80, true);
   timerAttachInterrupt(dimmer_timer, &AcDimmerDataStore::s_timer_intr, true);
-  // For ESP32, we can't use dynamic interval calculation because the timerX functions
-  // are not callable from ISR (placed in flash storage).
-  // Here we just use an interrupt firing every 50 µs.
-  timerAlarmWrite(dimmer_timer, 50, true);
+  // One-shot alarm, the interrupts set the next alarm to the next gate event of any dimmer
+  timerAlarmWrite(dimmer_timer, 1000, false);
   timerAlarmEnable(dimmer_timer);
 #endif
 }
@@ -20,31 +20,18 @@ void AdalightLightEffect::start() {
 }
 
 void AdalightLightEffect::stop() {
-  frame_.resize(0);
+  reset_frame_();
 
   AddressableLightEffect::stop();
 }
 
-int AdalightLightEffect::get_frame_size_(int led_count) const {
-  // 3 bytes: Ada
-  // 2 bytes: LED count
-  // 1 byte: checksum
-  // 3 bytes per LED
-  return 3 + 2 + 1 + led_count * 3;
+void AdalightLightEffect::reset_frame_() {
+  header_size_ = 0;
+  led_count_ = 0;
+  leds_read_ = 0;
 }
 
-void AdalightLightEffect::reset_frame_(light::AddressableLight &it) {
-  int buffer_capacity = get_frame_size_(it.size());
-
-  frame_.clear();
-  frame_.reserve(buffer_capacity);
-}
-
-void AdalightLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(COLOR_BLACK);
-  }
-}
+void AdalightLightEffect::blank_all_leds_(light::AddressableLight &it) { it.all() = COLOR_BLACK; }
 
 void AdalightLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
   const uint32_t now = millis();
@@ -57,83 +44,86 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const Color &curren
 
   if (!this->last_reset_) {
     ESP_LOGW(TAG, "Frame: Reset.");
-    reset_frame_(it);
+    reset_frame_();
     blank_all_leds_(it);
     this->last_reset_ = now;
   }
 
-  if (!this->frame_.empty() && now - this->last_byte_ >= ADALIGHT_RECEIVE_TIMEOUT) {
-    ESP_LOGW(TAG, "Frame: Receive timeout (size=%zu).", this->frame_.size());
-    reset_frame_(it);
+  if (this->header_size_ != 0 && now - this->last_byte_ >= ADALIGHT_RECEIVE_TIMEOUT) {
+    ESP_LOGW(TAG, "Frame: Receive timeout (leds=%u/%u).", this->leds_read_, this->led_count_);
+    reset_frame_();
     blank_all_leds_(it);
   }
 
-  if (this->available() > 0) {
-    ESP_LOGV(TAG, "Frame: Available (size=%d).", this->available());
-  }
-
   while (this->available() != 0) {
-    uint8_t data;
-    if (!this->read_byte(&data))
-      break;
-    this->frame_.push_back(data);
     this->last_byte_ = now;
 
-    switch (this->parse_frame_(it)) {
+    Frame frame = this->led_count_ == 0 ? this->parse_header_() : this->read_leds_(it);
+    switch (frame) {
       case INVALID:
-        ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=%d).", this->frame_.size(), this->frame_[0]);
-        reset_frame_(it);
+        ESP_LOGD(TAG, "Frame: Invalid (size=%u, first=%d).", this->header_size_, this->header_[0]);
+        reset_frame_();
         break;
 
       case PARTIAL:
+        // read_leds_() stops when less than an LED is buffered, wait for the rest
+        if (this->led_count_ != 0 && this->available() < 3)
+          return;
         break;
 
       case CONSUMED:
-        ESP_LOGV(TAG, "Frame: Consumed (size=%zu).", this->frame_.size());
-        reset_frame_(it);
+        ESP_LOGV(TAG, "Frame: Consumed (leds=%u).", this->led_count_);
+        reset_frame_();
+        // Only complete frames are shown
+        it.schedule_show();
         break;
     }
   }
 }
 
-AdalightLightEffect::Frame AdalightLightEffect::parse_frame_(light::AddressableLight &it) {
-  if (frame_.empty())
-    return INVALID;
+AdalightLightEffect::Frame AdalightLightEffect::parse_header_() {
+  if (!this->read_byte(&this->header_[this->header_size_]))
+    return PARTIAL;
+  this->header_size_++;
 
   // Check header: `Ada`
-  if (frame_[0] != 'A')
+  if (header_[0] != 'A')
     return INVALID;
-  if (frame_.size() > 1 && frame_[1] != 'd')
+  if (header_size_ > 1 && header_[1] != 'd')
     return INVALID;
-  if (frame_.size() > 2 && frame_[2] != 'a')
+  if (header_size_ > 2 && header_[2] != 'a')
     return INVALID;
 
   // 3 bytes: Count Hi, Count Lo, Checksum
-  if (frame_.size() < 6)
+  if (header_size_ < 6)
     return PARTIAL;
 
   // Check checksum
-  uint16_t checksum = frame_[3] ^ frame_[4] ^ 0x55;
-  if (checksum != frame_[5])
+  uint16_t checksum = header_[3] ^ header_[4] ^ 0x55;
+  if (checksum != header_[5])
     return INVALID;
 
-  // Check if we received the full frame
-  uint16_t led_count = (frame_[3] << 8) + frame_[4] + 1;
-  auto buffer_size = get_frame_size_(led_count);
-  if (frame_.size() < buffer_size)
-    return PARTIAL;
-
-  // Apply lights
-  auto accepted_led_count = std::min<int>(led_count, it.size());
-  uint8_t *led_data = &frame_[6];
+  this->led_count_ = (header_[3] << 8) + header_[4] + 1;
+  this->leds_read_ = 0;
+  return PARTIAL;
+}
 
-  for (int led = 0; led < accepted_led_count; led++, led_data += 3) {
-    auto white = std::min(std::min(led_data[0], led_data[1]), led_data[2]);
+AdalightLightEffect::Frame AdalightLightEffect::read_leds_(light::AddressableLight &it) {
+  uint8_t rgb[ADALIGHT_CHUNK_LEDS * 3];
+  uint8_t count = std::min<int>(std::min<int>(this->available() / 3, ADALIGHT_CHUNK_LEDS),
+                                this->led_count_ - this->leds_read_);
+  if (count == 0)
+    return PARTIAL;
+  if (!this->read_array(rgb, count * 3))
+    return INVALID;
 
-    it[led].set(Color(led_data[0], led_data[1], led_data[2], white));
-  }
+  // LEDs the light doesn't have are read and dropped
+  int accepted = std::min<int>(count, it.size() - this->leds_read_);
+  if (accepted > 0)
+    it.set_range_from_bytes(this->leds_read_, rgb, accepted, 3, light::WHITE_FROM_RGB_MIN);
+  this->leds_read_ += count;
 
-  return CONSUMED;
+  return this->leds_read_ == this->led_count_ ? CONSUMED : PARTIAL;
 }
 
 }  // namespace adalight
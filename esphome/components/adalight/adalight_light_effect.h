@@ -4,11 +4,12 @@
 #include "esphome/components/light/addressable_light_effect.h"
 #include "esphome/components/uart/uart.h"
 
-#include <vector>
-
 namespace esphome {
 namespace adalight {
 
+/// LEDs read from the UART at once, the bytes go straight from there into the light.
+static const uint16_t ADALIGHT_CHUNK_LEDS = 64;
+
 class AdalightLightEffect : public light::AddressableLightEffect, public uart::UARTDevice {
  public:
   AdalightLightEffect(const std::string &name);
@@ -25,16 +26,21 @@ class AdalightLightEffect : public light::AddressableLightEffect, public uart::U
     CONSUMED,
   };
 
-  int get_frame_size_(int led_count) const;
-  void reset_frame_(light::AddressableLight &it);
+  void reset_frame_();
   void blank_all_leds_(light::AddressableLight &it);
-  Frame parse_frame_(light::AddressableLight &it);
+  Frame parse_header_();
+  Frame read_leds_(light::AddressableLight &it);
 
  protected:
   uint32_t last_ack_{0};
   uint32_t last_byte_{0};
   uint32_t last_reset_{0};
-  std::vector<uint8_t> frame_;
+  /// `Ada`, LED count (high, low) and checksum.
+  uint8_t header_[6];
+  uint8_t header_size_{0};
+  /// LEDs announced in the header, and how many of them were read so far.
+  uint16_t led_count_{0};
+  uint16_t leds_read_{0};
 };
 
 }  // namespace adalight
@@ -1,5 +1,6 @@
 #include "adc_sensor.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 #ifdef USE_ADC_SENSOR_VCC
 ADC_MODE(ADC_VCC)
@@ -60,6 +61,8 @@ void ADCSensor::dump_config() {
 #endif
 #ifdef ARDUINO_ARCH_ESP32
   ESP_LOGCONFIG(TAG, "  Pin: %u", this->pin_);
+  if (this->sample_rate_ != 0)
+    ESP_LOGCONFIG(TAG, "  Continuous Sample Rate: %u Hz", this->sample_rate_);
   switch (this->attenuation_) {
     case ADC_ATTEN_DB_0:
       ESP_LOGCONFIG(TAG, " Attenuation: 0db (max 1.1V)");
@@ -85,9 +88,8 @@ void ADCSensor::update() {
   ESP_LOGD(TAG, "'%s': Got voltage=%.2fV", this->get_name().c_str(), value_v);
   this->publish_state(value_v);
 }
-float ADCSensor::sample() {
 #ifdef ARDUINO_ARCH_ESP32
-  int raw = adc1_get_raw(gpio_to_adc1(pin_));
+float ADCSensor::raw_to_voltage_(int raw) const {
   float value_v = raw / 4095.0f;
   switch (this->attenuation_) {
     case ADC_ATTEN_DB_0:
@@ -106,6 +108,92 @@ float ADCSensor::sample() {
       break;
   }
   return value_v;
+}
+void ADCSensor::start_continuous() {
+  if (this->sample_rate_ == 0 || this->continuous_)
+    return;
+  i2s_config_t config{};
+  config.mode = static_cast<i2s_mode_t>(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN);
+  config.sample_rate = this->sample_rate_;
+  config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  config.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+  config.communication_format = I2S_COMM_FORMAT_I2S_MSB;
+  // 1024 samples of buffer, 256 ms at 4 kHz
+  config.dma_buf_count = 4;
+  config.dma_buf_len = 256;
+  esp_err_t err = i2s_driver_install(I2S_NUM_0, &config, 0, nullptr);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "'%s': Installing the I2S driver failed: %d", this->get_name().c_str(), err);
+    return;
+  }
+  i2s_set_adc_mode(ADC_UNIT_1, gpio_to_adc1(this->pin_));
+  i2s_adc_enable(I2S_NUM_0);
+  this->continuous_ = true;
+}
+void ADCSensor::stop_continuous() {
+  if (!this->continuous_)
+    return;
+  i2s_adc_disable(I2S_NUM_0);
+  i2s_driver_uninstall(I2S_NUM_0);
+  this->continuous_ = false;
+}
+size_t ADCSensor::read_samples(float *data, size_t max_count) {
+  if (!this->continuous_)
+    return 0;
+  uint16_t buffer[64];
+  size_t count = 0;
+  while (count < max_count) {
+    size_t bytes_read = 0;
+    const size_t chunk = std::min(max_count - count, sizeof(buffer) / sizeof(buffer[0]));
+    i2s_read(I2S_NUM_0, buffer, chunk * sizeof(uint16_t), &bytes_read, 0);
+    const size_t read = bytes_read / sizeof(uint16_t);
+    // The upper 4 bits hold the channel number
+    for (size_t i = 0; i < read; i++)
+      data[count++] = this->raw_to_voltage_(buffer[i] & 0x0FFF);
+    if (read < chunk)
+      break;
+  }
+  if (count != 0)
+    this->last_continuous_ = data[count - 1];
+  return count;
+}
+size_t ADCSensor::sample_many(float *out, size_t n, uint32_t rate) {
+  if (this->continuous_)
+    // The samples in the DMA buffer belong to whoever started continuous sampling
+    return VoltageSampler::sample_many(out, n, rate);
+
+  if (this->sample_rate_ != 0 && (rate == 0 || rate == this->sample_rate_)) {
+    // Let the DMA take the burst at the exact rate
+    this->start_continuous();
+    if (this->continuous_) {
+      size_t count = 0;
+      const uint32_t start = millis();
+      const uint32_t timeout = uint64_t(n) * 2000 / this->sample_rate_ + 100;
+      while (count < n && millis() - start < timeout) {
+        count += this->read_samples(out + count, n - count);
+        yield();
+      }
+      this->stop_continuous();
+      return count;
+    }
+  }
+
+  // Without the virtual call and channel lookup per reading
+  const adc1_channel_t channel = gpio_to_adc1(this->pin_);
+  voltage_sampler::SamplePacer pacer(rate);
+  for (size_t i = 0; i < n; i++) {
+    pacer.wait();
+    out[i] = this->raw_to_voltage_(adc1_get_raw(channel));
+  }
+  return n;
+}
+#endif
+
+float ADCSensor::sample() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->continuous_)
+    return this->last_continuous_;
+  return this->raw_to_voltage_(adc1_get_raw(gpio_to_adc1(pin_)));
 #endif
 
 #ifdef ARDUINO_ARCH_ESP8266
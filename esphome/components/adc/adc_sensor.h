@@ -8,6 +8,7 @@
 
 #ifdef ARDUINO_ARCH_ESP32
 #include "driver/adc.h"
+#include "driver/i2s.h"
 #endif
 
 namespace esphome {
@@ -18,6 +19,11 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
 #ifdef ARDUINO_ARCH_ESP32
   /// Set the attenuation for this pin. Only available on the ESP32.
   void set_attenuation(adc_atten_t attenuation);
+  /** Enable continuous sampling for voltage_sampler consumers at this rate, in Hz. Only available on the ESP32.
+   *
+   * Continuous sampling runs the ADC through I2S0 with DMA, so only one ADC sensor can use it.
+   */
+  void set_continuous_sample_rate(uint32_t sample_rate) { this->sample_rate_ = sample_rate; }
 #endif
 
   /// Update adc values.
@@ -29,6 +35,13 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   float get_setup_priority() const override;
   void set_pin(uint8_t pin) { this->pin_ = pin; }
   float sample() override;
+#ifdef ARDUINO_ARCH_ESP32
+  size_t sample_many(float *out, size_t n, uint32_t rate) override;
+  uint32_t get_sample_rate() override { return this->sample_rate_; }
+  void start_continuous() override;
+  void stop_continuous() override;
+  size_t read_samples(float *data, size_t max_count) override;
+#endif
 
 #ifdef ARDUINO_ARCH_ESP8266
   std::string unique_id() override;
@@ -38,7 +51,13 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   uint8_t pin_;
 
 #ifdef ARDUINO_ARCH_ESP32
+  float raw_to_voltage_(int raw) const;
+
   adc_atten_t attenuation_{ADC_ATTEN_DB_0};
+  uint32_t sample_rate_{0};
+  bool continuous_{false};
+  /// Last continuous sample, returned by sample() while the ADC belongs to the I2S driver.
+  float last_continuous_{NAN};
 #endif
 };
 
@@ -15,6 +15,8 @@ from esphome.const import (
 
 AUTO_LOAD = ["voltage_sampler"]
 
+CONF_CONTINUOUS_SAMPLE_RATE = "continuous_sample_rate"
+
 ATTENUATION_MODES = {
     "0db": cg.global_ns.ADC_ATTEN_DB_0,
     "2.5db": cg.global_ns.ADC_ATTEN_DB_2_5,
@@ -46,6 +48,11 @@ CONFIG_SCHEMA = (
             cv.SplitDefault(CONF_ATTENUATION, esp32="0db"): cv.All(
                 cv.only_on_esp32, cv.enum(ATTENUATION_MODES, lower=True)
             ),
+            cv.Optional(CONF_CONTINUOUS_SAMPLE_RATE): cv.All(
+                cv.only_on_esp32,
+                cv.frequency,
+                cv.Range(min=1000, max=50000),
+            ),
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -64,3 +71,8 @@ async def to_code(config):
 
     if CONF_ATTENUATION in config:
         cg.add(var.set_attenuation(config[CONF_ATTENUATION]))
+
+    if CONF_CONTINUOUS_SAMPLE_RATE in config:
+        cg.add(
+            var.set_continuous_sample_rate(int(config[CONF_CONTINUOUS_SAMPLE_RATE]))
+        )
@@ -13,6 +13,7 @@ from esphome.const import (
     UNIT_VOLT,
     UNIT_AMPERE,
     UNIT_WATT,
+    CONF_IRQ_PIN,
 )
 
 DEPENDENCIES = ["i2c"]
@@ -20,7 +21,6 @@ DEPENDENCIES = ["i2c"]
 ade7953_ns = cg.esphome_ns.namespace("ade7953")
 ADE7953 = ade7953_ns.class_("ADE7953", cg.PollingComponent, i2c.I2CDevice)
 
-CONF_IRQ_PIN = "irq_pin"
 CONF_CURRENT_A = "current_a"
 CONF_CURRENT_B = "current_b"
 CONF_ACTIVE_POWER_A = "active_power_a"
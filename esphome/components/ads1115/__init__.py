@@ -1,5 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
+from esphome import pins
 from esphome.components import i2c
 from esphome.const import CONF_ID
 
@@ -11,11 +12,13 @@ ads1115_ns = cg.esphome_ns.namespace("ads1115")
 ADS1115Component = ads1115_ns.class_("ADS1115Component", cg.Component, i2c.I2CDevice)
 
 CONF_CONTINUOUS_MODE = "continuous_mode"
+CONF_ALERT_RDY_PIN = "alert_rdy_pin"
 CONFIG_SCHEMA = (
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(ADS1115Component),
             cv.Optional(CONF_CONTINUOUS_MODE, default=False): cv.boolean,
+            cv.Optional(CONF_ALERT_RDY_PIN): pins.internal_gpio_input_pin_schema,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -29,3 +32,7 @@ async def to_code(config):
     await i2c.register_i2c_device(var, config)
 
     cg.add(var.set_continuous_mode(config[CONF_CONTINUOUS_MODE]))
+
+    if CONF_ALERT_RDY_PIN in config:
+        pin = await cg.gpio_pin_expression(config[CONF_ALERT_RDY_PIN])
+        cg.add(var.set_ready_pin(pin))
@@ -7,8 +7,14 @@ namespace ads1115 {
 static const char *const TAG = "ads1115";
 static const uint8_t ADS1115_REGISTER_CONVERSION = 0x00;
 static const uint8_t ADS1115_REGISTER_CONFIG = 0x01;
+static const uint8_t ADS1115_REGISTER_LO_THRESH = 0x02;
+static const uint8_t ADS1115_REGISTER_HI_THRESH = 0x03;
 
 static const uint8_t ADS1115_DATA_RATE_860_SPS = 0b111;
+/// Samples per second for each data rate setting.
+static const uint16_t ADS1115_DATA_RATES[] = {8, 16, 32, 64, 128, 250, 475, 860};
+
+static float raw_to_volts(int16_t signed_conversion, uint8_t gain);
 
 void ADS1115Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up ADS1115...");
@@ -55,19 +61,42 @@ void ADS1115Component::setup() {
   //        0bxxxxxxxxxxxxx0xx
   config |= 0b0000000000000000;
 
-  // Set comparator que mode - disabled
-  //        0bxxxxxxxxxxxxxx11
-  config |= 0b0000000000000011;
+  if (this->ready_pin_ != nullptr) {
+    // Set comparator que mode - assert after one conversion, which with the thresholds below
+    // pulses ALERT/RDY at the end of every conversion
+    //        0bxxxxxxxxxxxxxx00
+    config |= 0b0000000000000000;
+  } else {
+    // Set comparator que mode - disabled
+    //        0bxxxxxxxxxxxxxx11
+    config |= 0b0000000000000011;
+  }
 
   if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
     this->mark_failed();
     return;
   }
   this->prev_config_ = config;
+
+  if (this->ready_pin_ != nullptr) {
+    // Conversion ready mode: MSB of the high threshold set, MSB of the low threshold cleared
+    if (!this->write_byte_16(ADS1115_REGISTER_LO_THRESH, 0x0000) ||
+        !this->write_byte_16(ADS1115_REGISTER_HI_THRESH, 0x8000)) {
+      this->mark_failed();
+      return;
+    }
+    this->ready_pin_->setup();
+    this->ready_pin_->attach_interrupt(ADS1115ReadyStore::gpio_intr, &this->ready_store_, FALLING);
+  }
+}
+void ICACHE_RAM_ATTR ADS1115ReadyStore::gpio_intr(ADS1115ReadyStore *arg) {
+  arg->time = micros();
+  arg->ready = true;
 }
 void ADS1115Component::dump_config() {
   ESP_LOGCONFIG(TAG, "Setting up ADS1115...");
   LOG_I2C_DEVICE(this);
+  LOG_PIN("  ALERT/RDY Pin: ", this->ready_pin_);
   if (this->is_failed()) {
     ESP_LOGE(TAG, "Communication with ADS1115 failed!");
   }
@@ -78,7 +107,7 @@ void ADS1115Component::dump_config() {
     ESP_LOGCONFIG(TAG, "    Gain: %u", sensor->get_gain());
   }
 }
-float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
+uint16_t ADS1115Component::sensor_config_(ADS1115Sensor *sensor) const {
   uint16_t config = this->prev_config_;
   // Multiplexer
   //        0bxBBBxxxxxxxxxxxx
@@ -89,6 +118,89 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
   //        0bxxxxBBBxxxxxxxxx
   config &= 0b1111000111111111;
   config |= (sensor->get_gain() & 0b111) << 9;
+  return config;
+}
+void ADS1115Component::request_measurement_async(ADS1115Sensor *sensor) {
+  for (auto *queued : this->queue_) {
+    if (queued == sensor)
+      return;
+  }
+  this->queue_.push_back(sensor);
+  this->enable_loop();
+}
+void ADS1115Component::start_async_() {
+  ADS1115Sensor *sensor = this->queue_.front();
+  uint16_t config = this->sensor_config_(sensor);
+  // Continuous mode keeps converting with the same settings, so there is nothing to write
+  bool write = true;
+  this->min_ready_delay_us_ = 0;
+  if (this->continuous_mode_) {
+    write = config != this->prev_config_;
+    if (write) {
+      // The conversion running during the write still finishes with the old settings
+      this->min_ready_delay_us_ = 1000000UL / ADS1115_DATA_RATES[ADS1115_DATA_RATE_860_SPS];
+    }
+  } else {
+    // Start conversion
+    config |= 0b1000000000000000;
+  }
+  this->ready_store_.ready = false;
+  this->started_us_ = micros();
+  if (write) {
+    if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
+      this->status_set_warning();
+      this->queue_.erase(this->queue_.begin());
+      return;
+    }
+    this->prev_config_ = config;
+  }
+  this->in_flight_ = true;
+}
+void ADS1115Component::abort_async_() {
+  if (!this->in_flight_)
+    return;
+  // The blocking measurement changes the config, the sensor starts over afterwards
+  this->in_flight_ = false;
+}
+void ADS1115Component::loop() {
+  if (!this->in_flight_) {
+    if (this->queue_.empty()) {
+      // Until the next request_measurement_async()
+      this->disable_loop();
+      return;
+    }
+    this->start_async_();
+    return;
+  }
+
+  ADS1115Sensor *sensor = this->queue_.front();
+  if (!this->ready_store_.ready) {
+    if (micros() - this->started_us_ > 100000) {
+      ESP_LOGW(TAG, "Reading ADS1115 timed out");
+      this->status_set_warning();
+      this->in_flight_ = false;
+      this->queue_.erase(this->queue_.begin());
+    }
+    return;
+  }
+  this->ready_store_.ready = false;
+  if (int32_t(this->ready_store_.time - this->started_us_) < int32_t(this->min_ready_delay_us_))
+    // Pulse of a conversion with the previous settings
+    return;
+
+  this->in_flight_ = false;
+  this->queue_.erase(this->queue_.begin());
+  uint16_t raw_conversion;
+  if (!this->read_byte_16(ADS1115_REGISTER_CONVERSION, &raw_conversion)) {
+    this->status_set_warning();
+    return;
+  }
+  this->status_clear_warning();
+  sensor->publish_measurement(raw_to_volts(static_cast<int16_t>(raw_conversion), sensor->get_gain()));
+}
+float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
+  this->abort_async_();
+  uint16_t config = this->sensor_config_(sensor);
 
   if (!this->continuous_mode_) {
     // Start conversion
@@ -126,10 +238,62 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
     this->status_set_warning();
     return NAN;
   }
-  auto signed_conversion = static_cast<int16_t>(raw_conversion);
+  this->status_clear_warning();
+  return raw_to_volts(static_cast<int16_t>(raw_conversion), sensor->get_gain());
+}
+size_t ADS1115Component::request_measurements(ADS1115Sensor *sensor, float *out, size_t n, uint32_t rate) {
+  if (n == 0)
+    return 0;
+  this->abort_async_();
+  // The slowest data rate that keeps up has the least noise, and without a rate each conversion is read once
+  uint8_t data_rate = ADS1115_DATA_RATE_860_SPS;
+  for (uint8_t i = 0; rate != 0 && i < ADS1115_DATA_RATE_860_SPS; i++) {
+    if (ADS1115_DATA_RATES[i] >= rate) {
+      data_rate = i;
+      break;
+    }
+  }
+  if (rate == 0 || rate > ADS1115_DATA_RATES[data_rate])
+    rate = ADS1115_DATA_RATES[data_rate];
 
+  // Configure once and let the chip convert continuously for the whole burst
+  uint16_t config = this->sensor_config_(sensor);
+  config &= 0b0111111000011111;
+  config |= data_rate << 5;
+  if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
+    this->status_set_warning();
+    return 0;
+  }
+  this->prev_config_ = config;
+  // Wait for the first conversion with the new settings
+  delay(1000 / ADS1115_DATA_RATES[data_rate] + 2);
+
+  voltage_sampler::SamplePacer pacer(rate);
+  size_t count = 0;
+  for (; count < n; count++) {
+    pacer.wait();
+    uint16_t raw_conversion;
+    if (!this->read_byte_16(ADS1115_REGISTER_CONVERSION, &raw_conversion)) {
+      this->status_set_warning();
+      break;
+    }
+    out[count] = raw_to_volts(static_cast<int16_t>(raw_conversion), sensor->get_gain());
+  }
+
+  // Back to the configured mode at 860 samples per second
+  uint16_t restore = (config & 0b1111111000011111) | (ADS1115_DATA_RATE_860_SPS << 5);
+  if (!this->continuous_mode_)
+    restore |= 0b0000000100000000;
+  if (restore != config && this->write_byte_16(ADS1115_REGISTER_CONFIG, restore))
+    this->prev_config_ = restore;
+  if (count == n)
+    this->status_clear_warning();
+  return count;
+}
+
+static float raw_to_volts(int16_t signed_conversion, uint8_t gain) {
   float millivolts;
-  switch (sensor->get_gain()) {
+  switch (gain) {
     case ADS1115_GAIN_6P144:
       millivolts = signed_conversion * 0.187500f;
       break;
@@ -151,14 +315,21 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
     default:
       millivolts = NAN;
   }
-
-  this->status_clear_warning();
   return millivolts / 1e3f;
 }
 
 float ADS1115Sensor::sample() { return this->parent_->request_measurement(this); }
+size_t ADS1115Sensor::sample_many(float *out, size_t n, uint32_t rate) {
+  return this->parent_->request_measurements(this, out, n, rate);
+}
 void ADS1115Sensor::update() {
-  float v = this->parent_->request_measurement(this);
+  if (this->parent_->is_non_blocking()) {
+    this->parent_->request_measurement_async(this);
+    return;
+  }
+  this->publish_measurement(this->parent_->request_measurement(this));
+}
+void ADS1115Sensor::publish_measurement(float v) {
   if (!isnan(v)) {
     ESP_LOGD(TAG, "'%s': Got Voltage=%fV", this->get_name().c_str(), v);
     this->publish_state(v);
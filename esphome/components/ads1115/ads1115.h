@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/esphal.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/i2c/i2c.h"
 #include "esphome/components/voltage_sampler/voltage_sampler.h"
@@ -30,6 +31,15 @@ enum ADS1115Gain {
 
 class ADS1115Sensor;
 
+/// Store data in a class that doesn't use multiple-inheritance (vtables in flash)
+struct ADS1115ReadyStore {
+  volatile bool ready{false};
+  /// micros() of the last conversion ready pulse.
+  volatile uint32_t time{0};
+
+  static void gpio_intr(ADS1115ReadyStore *arg);
+};
+
 class ADS1115Component : public Component, public i2c::I2CDevice {
  public:
   void register_sensor(ADS1115Sensor *obj) { this->sensors_.push_back(obj); }
@@ -38,15 +48,42 @@ class ADS1115Component : public Component, public i2c::I2CDevice {
   void dump_config() override;
   /// HARDWARE_LATE setup priority
   float get_setup_priority() const override { return setup_priority::DATA; }
+  void loop() override;
   void set_continuous_mode(bool continuous_mode) { continuous_mode_ = continuous_mode; }
+  /** Use the ALERT/RDY pin as a conversion ready interrupt and measure without blocking.
+   *
+   * Sensor updates are then queued and run one after another from loop(), each one ending with the
+   * conversion ready pulse instead of a delay() and polling the config register.
+   */
+  void set_ready_pin(GPIOPin *ready_pin) { ready_pin_ = ready_pin; }
+  bool is_non_blocking() const { return this->ready_pin_ != nullptr; }
+  /// Queue a measurement for a sensor, it publishes the result once the conversion is done.
+  void request_measurement_async(ADS1115Sensor *sensor);
 
   /// Helper method to request a measurement from a sensor.
   float request_measurement(ADS1115Sensor *sensor);
+  /// Take `n` measurements from a sensor in continuous mode, see VoltageSampler::sample_many().
+  size_t request_measurements(ADS1115Sensor *sensor, float *out, size_t n, uint32_t rate);
 
  protected:
+  /// The config register with the multiplexer and gain of `sensor`.
+  uint16_t sensor_config_(ADS1115Sensor *sensor) const;
+  /// Start the conversion for the sensor at the front of the queue.
+  void start_async_();
+  /// Put a measurement in flight back in the queue before a blocking measurement changes the config.
+  void abort_async_();
+
   std::vector<ADS1115Sensor *> sensors_;
   uint16_t prev_config_{0};
   bool continuous_mode_;
+  GPIOPin *ready_pin_{nullptr};
+  ADS1115ReadyStore ready_store_;
+  /// Sensors waiting for a non-blocking measurement, the front one is in flight if `in_flight_` is set.
+  std::vector<ADS1115Sensor *> queue_;
+  bool in_flight_{false};
+  uint32_t started_us_{0};
+  /// Ready pulses less than this long after the start belong to a conversion with the previous config.
+  uint32_t min_ready_delay_us_{0};
 };
 
 /// Internal holder class that is in instance of Sensor so that the hub can create individual sensors.
@@ -58,8 +95,11 @@ class ADS1115Sensor : public sensor::Sensor, public PollingComponent, public vol
   void set_gain(ADS1115Gain gain) { gain_ = gain; }
 
   float sample() override;
+  size_t sample_many(float *out, size_t n, uint32_t rate) override;
   uint8_t get_multiplexer() const { return multiplexer_; }
   uint8_t get_gain() const { return gain_; }
+  /// Publish a measurement, NAN ones are dropped.
+  void publish_measurement(float v);
 
  protected:
   ADS1115Component *parent_;
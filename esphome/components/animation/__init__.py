@@ -13,7 +13,7 @@ _LOGGER = logging.getLogger(__name__)
 DEPENDENCIES = ["display"]
 MULTI_CONF = True
 
-Animation_ = display.display_ns.class_("Animation")
+Animation_ = display.display_ns.class_("Animation", display.Image)
 
 CONF_RAW_DATA_ID = "raw_data_id"
 
@@ -81,6 +81,13 @@ async def to_code(config):
                 data[pos] = pix[2]
                 pos += 1
 
+    elif config[CONF_TYPE] == "RLE":
+        rgb_frames = []
+        for frameIndex in range(frames):
+            image.seek(frameIndex)
+            rgb_frames.append(image.convert("RGB"))
+        data = espImage.encode_rle(rgb_frames)
+
     elif config[CONF_TYPE] == "BINARY":
         width8 = ((width + 7) // 8) * 8
         data = [0 for _ in range((height * width8 // 8) * frames)]
@@ -1,3 +1,5 @@
+import base64
+
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import automation
@@ -6,6 +8,7 @@ from esphome.const import (
     CONF_DATA,
     CONF_DATA_TEMPLATE,
     CONF_ID,
+    CONF_KEY,
     CONF_PASSWORD,
     CONF_PORT,
     CONF_REBOOT_TIMEOUT,
@@ -16,12 +19,18 @@ from esphome.const import (
     CONF_EVENT,
     CONF_TAG,
 )
-from esphome.core import coroutine_with_priority
+from esphome.core import CORE, coroutine_with_priority
 
 DEPENDENCIES = ["network"]
 AUTO_LOAD = ["async_tcp"]
 CODEOWNERS = ["@OttoWinter"]
 
+CONF_LOG_BATCH_DELAY = "log_batch_delay"
+CONF_LIST_ENTITIES_CACHE = "list_entities_cache"
+CONF_TRANSPORT = "transport"
+CONF_SEND_BUFFER_SIZE = "send_buffer_size"
+CONF_ENCRYPTION = "encryption"
+
 api_ns = cg.esphome_ns.namespace("api")
 APIServer = api_ns.class_("APIServer", cg.Component, cg.Controller)
 HomeAssistantServiceCallAction = api_ns.class_(
@@ -42,6 +51,25 @@ SERVICE_ARG_NATIVE_TYPES = {
     "string[]": cg.std_vector.template(cg.std_string),
 }
 
+
+def validate_encryption_key(value):
+    value = cv.string_strict(value)
+    try:
+        decoded = base64.b64decode(value, validate=True)
+    except ValueError as err:
+        raise cv.Invalid("Invalid key format, please check it's using base64") from err
+    if len(decoded) != 32:
+        raise cv.Invalid("Encryption key must be base64 and 32 bytes long")
+    return value
+
+
+def validate_transport(value):
+    value = cv.one_of("async_tcp", "socket", lower=True)(value)
+    if value == "socket" and not CORE.is_esp32:
+        raise cv.Invalid("The socket transport is only available on ESP32")
+    return value
+
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(APIServer),
@@ -50,6 +78,20 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(
             CONF_REBOOT_TIMEOUT, default="15min"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_LOG_BATCH_DELAY, default="0ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.SplitDefault(
+            CONF_LIST_ENTITIES_CACHE, esp8266=False, esp32=True
+        ): cv.boolean,
+        cv.Optional(CONF_TRANSPORT, default="async_tcp"): validate_transport,
+        cv.Optional(CONF_SEND_BUFFER_SIZE, default="4kB"): cv.All(
+            cv.validate_bytes, cv.int_range(min=512, max=65536)
+        ),
+        cv.Optional(CONF_ENCRYPTION): cv.All(
+            cv.only_on_esp32,
+            cv.Schema({cv.Required(CONF_KEY): validate_encryption_key}),
+        ),
         cv.Optional(CONF_SERVICES): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UserServiceTrigger),
@@ -75,6 +117,15 @@ async def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    cg.add(var.set_log_batch_delay(config[CONF_LOG_BATCH_DELAY]))
+    cg.add(var.set_list_entities_cache(config[CONF_LIST_ENTITIES_CACHE]))
+    if CONF_ENCRYPTION in config:
+        key = base64.b64decode(config[CONF_ENCRYPTION][CONF_KEY])
+        cg.add(var.set_encryption_key(list(key)))
+        cg.add_define("USE_API_ENCRYPTION")
+    if config[CONF_TRANSPORT] == "socket":
+        cg.add_define("USE_API_SOCKET")
+        cg.add(var.set_send_buffer_size(config[CONF_SEND_BUFFER_SIZE]))
 
     for conf in config.get(CONF_SERVICES, []):
         template_args = []
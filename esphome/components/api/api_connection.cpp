@@ -2,6 +2,9 @@
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
 #include "esphome/core/version.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #ifdef USE_DEEP_SLEEP
 #include "esphome/components/deep_sleep/deep_sleep_component.h"
@@ -12,14 +15,25 @@
 #ifdef USE_FAN
 #include "esphome/components/fan/fan_helpers.h"
 #endif
+#ifdef USE_SENSOR_HISTORY
+#include "esphome/components/sensor_history/sensor_history.h"
+#endif
 
 namespace esphome {
 namespace api {
 
 static const char *const TAG = "api.connection";
 
-APIConnection::APIConnection(AsyncClient *client, APIServer *parent)
+// Outgoing messages are collected up to one TCP segment before they're handed to the TCP stack
+#ifdef TCP_MSS
+static const size_t TX_BATCH_MAX_SIZE = TCP_MSS;
+#else
+static const size_t TX_BATCH_MAX_SIZE = 536;
+#endif
+
+APIConnection::APIConnection(APIClient *client, APIServer *parent)
     : client_(client), parent_(parent), initial_state_iterator_(parent, this), list_entities_iterator_(parent, this) {
+#ifndef USE_API_SOCKET
   this->client_->onError([](void *s, AsyncClient *c, int8_t error) { ((APIConnection *) s)->on_error_(error); }, this);
   this->client_->onDisconnect([](void *s, AsyncClient *c) { ((APIConnection *) s)->on_disconnect_(); }, this);
   this->client_->onTimeout([](void *s, AsyncClient *c, uint32_t time) { ((APIConnection *) s)->on_timeout_(time); },
@@ -27,6 +41,7 @@ APIConnection::APIConnection(AsyncClient *client, APIServer *parent)
   this->client_->onData([](void *s, AsyncClient *c, void *buf,
                            size_t len) { ((APIConnection *) s)->on_data_(reinterpret_cast<uint8_t *>(buf), len); },
                         this);
+#endif
 
   this->send_buffer_.reserve(64);
   this->recv_buffer_.reserve(32);
@@ -45,46 +60,143 @@ void APIConnection::on_data_(uint8_t *buf, size_t len) {
 void APIConnection::parse_recv_buffer_() {
   if (this->recv_buffer_.empty() || this->remove_)
     return;
+#ifdef USE_API_ENCRYPTION
+  this->parse_encrypted_recv_buffer_();
+  return;
+#endif
 
-  while (!this->recv_buffer_.empty()) {
-    if (this->recv_buffer_[0] != 0x00) {
+  // Parse all complete frames in place and drop them from the buffer with a single erase at the end,
+  // instead of moving the remaining data after every frame
+  const uint32_t size = this->recv_buffer_.size();
+  uint32_t offset = 0;
+  while (offset < size) {
+    if (this->recv_buffer_[offset] != 0x00) {
       ESP_LOGW(TAG, "Invalid preamble from %s", this->client_info_.c_str());
       this->on_fatal_error();
       return;
     }
-    uint32_t i = 1;
-    const uint32_t size = this->recv_buffer_.size();
+    uint32_t i = offset + 1;
     uint32_t consumed;
     auto msg_size_varint = ProtoVarInt::parse(&this->recv_buffer_[i], size - i, &consumed);
     if (!msg_size_varint.has_value())
       // not enough data there yet
-      return;
+      break;
     i += consumed;
     uint32_t msg_size = msg_size_varint->as_uint32();
 
     auto msg_type_varint = ProtoVarInt::parse(&this->recv_buffer_[i], size - i, &consumed);
     if (!msg_type_varint.has_value())
       // not enough data there yet
-      return;
+      break;
     i += consumed;
     uint32_t msg_type = msg_type_varint->as_uint32();
 
     if (size - i < msg_size)
       // message body not fully received
-      return;
+      break;
 
     uint8_t *msg = &this->recv_buffer_[i];
     this->read_message(msg_size, msg_type, msg);
     if (this->remove_)
       return;
-    // pop front
-    uint32_t total = i + msg_size;
-    this->recv_buffer_.erase(this->recv_buffer_.begin(), this->recv_buffer_.begin() + total);
+    offset = i + msg_size;
+    this->last_traffic_ = millis();
+    network_notify_activity();
+  }
+  // pop front, the capacity is kept for the next frames
+  this->recv_buffer_.erase(this->recv_buffer_.begin(), this->recv_buffer_.begin() + offset);
+}
+
+#ifdef USE_API_ENCRYPTION
+void APIConnection::parse_encrypted_recv_buffer_() {
+  const uint32_t size = this->recv_buffer_.size();
+  uint32_t offset = 0;
+  while (size - offset >= 3) {
+    uint8_t *header = &this->recv_buffer_[offset];
+    if (header[0] != 0x01) {
+      ESP_LOGW(TAG, "Unencrypted frame from %s", this->client_info_.c_str());
+      this->on_fatal_error();
+      return;
+    }
+    const uint32_t frame_size = (uint32_t(header[1]) << 8) | header[2];
+    if (size - offset - 3 < frame_size)
+      // frame not fully received
+      break;
+    uint8_t *data = header + 3;
+
+    if (!this->cipher_) {
+      if (frame_size != APIFrameCipher::NONCE_SIZE) {
+        ESP_LOGW(TAG, "Invalid handshake from %s", this->client_info_.c_str());
+        this->on_fatal_error();
+        return;
+      }
+      uint8_t reply[3 + APIFrameCipher::NONCE_SIZE] = {0x01, 0x00, APIFrameCipher::NONCE_SIZE};
+      uint8_t *server_nonce = reply + 3;
+      for (size_t i = 0; i < APIFrameCipher::NONCE_SIZE; i += 4) {
+        uint32_t r = random_uint32();
+        memcpy(server_nonce + i, &r, 4);
+      }
+      this->client_->add(reinterpret_cast<char *>(reply), sizeof(reply), ASYNC_WRITE_FLAG_COPY);
+      this->client_->send();
+      this->cipher_.reset(new APIFrameCipher(this->parent_->get_encryption_key(), data, server_nonce));
+    } else {
+      if (frame_size < 2 + APIFrameCipher::TAG_SIZE) {
+        ESP_LOGW(TAG, "Invalid frame from %s", this->client_info_.c_str());
+        this->on_fatal_error();
+        return;
+      }
+      const uint32_t data_size = frame_size - APIFrameCipher::TAG_SIZE;
+      if (!this->cipher_->decrypt(header, 3, data, data_size, data + data_size)) {
+        ESP_LOGW(TAG, "Could not decrypt frame from %s, wrong encryption key?", this->client_info_.c_str());
+        this->on_fatal_error();
+        return;
+      }
+      const uint32_t msg_type = (uint32_t(data[0]) << 8) | data[1];
+      this->read_message(data_size - 2, msg_type, data + 2);
+      if (this->remove_)
+        return;
+    }
+    offset += 3 + frame_size;
     this->last_traffic_ = millis();
+    network_notify_activity();
   }
+  this->recv_buffer_.erase(this->recv_buffer_.begin(), this->recv_buffer_.begin() + offset);
 }
+bool APIConnection::send_encrypted_buffer_(ProtoWriteBuffer buffer, uint32_t message_type) {
+  if (!this->cipher_)
+    return false;
+  const size_t msg_size = buffer.get_buffer()->size();
+  const size_t frame_size = 2 + msg_size + APIFrameCipher::TAG_SIZE;
+  if (frame_size > 0xFFFF)
+    return false;
+  const size_t needed_space = 3 + frame_size;
+
+  if (this->tx_batch_.size() + needed_space > this->client_->space())
+    this->flush_tx_batch_();
+  if (needed_space > this->client_->space())
+    return false;
+
+  // The frame is built in tx_batch_ and encrypted there, message buffers may be shared with other connections
+  const size_t begin = this->tx_batch_.size();
+  this->tx_batch_.resize(begin + needed_space);
+  uint8_t *header = &this->tx_batch_[begin];
+  header[0] = 0x01;
+  header[1] = frame_size >> 8;
+  header[2] = frame_size & 0xFF;
+  uint8_t *data = header + 3;
+  data[0] = message_type >> 8;
+  data[1] = message_type & 0xFF;
+  memcpy(data + 2, buffer.get_buffer()->data(), msg_size);
+  this->cipher_->encrypt(header, 3, data, 2 + msg_size, data + 2 + msg_size);
+
+  if (this->tx_batch_.size() >= TX_BATCH_MAX_SIZE)
+    return this->flush_tx_batch_();
+  return true;
+}
+#endif
 
 void APIConnection::disconnect_client() {
+  this->flush_tx_batch_();
   this->client_->close();
   this->remove_ = true;
 }
@@ -104,6 +216,12 @@ void APIConnection::loop() {
     this->on_fatal_error();
     return;
   }
+#ifdef USE_API_SOCKET
+  // Nothing runs in the background, write what the TCP stack couldn't take earlier and read straight into
+  // the receive buffer
+  this->client_->flush();
+  this->client_->read(this->recv_buffer_);
+#endif
   if (this->client_->disconnected()) {
     // failsafe for disconnect logic
     this->on_disconnect_();
@@ -111,6 +229,11 @@ void APIConnection::loop() {
   }
   this->parse_recv_buffer_();
 
+  if (!this->log_batch_.empty() && millis() - this->log_batch_start_ >= this->parent_->get_log_batch_delay())
+    this->flush_log_batch_();
+  if (!this->pending_states_.empty())
+    this->send_pending_states_();
+
   this->list_entities_iterator_.advance();
   this->initial_state_iterator_.advance();
 
@@ -129,6 +252,11 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available()) {
     uint32_t space = this->client_->space();
+#ifdef USE_API_ENCRYPTION
+    // encrypted frames have a 16 bit length and also carry the message type and the tag
+    space = std::min(space, uint32_t(0xFFFF));
+    space = space > 2 + APIFrameCipher::TAG_SIZE ? space - 2 - APIFrameCipher::TAG_SIZE : 0;
+#endif
     // reserve 15 bytes for metadata, and at least 64 bytes of data
     if (space >= 15 + 64) {
       uint32_t to_send = std::min(space - 15, this->image_reader_.available());
@@ -151,6 +279,65 @@ void APIConnection::loop() {
     }
   }
 #endif
+
+  this->send_batched_states_();
+  this->flush_tx_batch_();
+}
+
+/// Set the record of `key` in the states of a Batched*StateResponse to `value`, or append one.
+static void set_batched_state(std::string &records, uint32_t key, const uint8_t *value, size_t value_size) {
+  const char encoded_key[4] = {char(key & 0xFF), char((key >> 8) & 0xFF), char((key >> 16) & 0xFF), char(key >> 24)};
+  const size_t record_size = 4 + value_size;
+  for (size_t i = 0; i + record_size <= records.size(); i += record_size) {
+    if (memcmp(&records[i], encoded_key, 4) == 0) {
+      records.replace(i + 4, value_size, reinterpret_cast<const char *>(value), value_size);
+      return;
+    }
+  }
+  records.append(encoded_key, 4);
+  records.append(reinterpret_cast<const char *>(value), value_size);
+}
+/// Upper bound of the bytes a Batched*StateResponse frame adds to its records: the frame header, the message
+/// type, the field header of the records and the authentication tag of an encrypted frame.
+static const size_t BATCH_FRAME_OVERHEAD = 32;
+
+template<typename T>
+void APIConnection::send_batch_(T &batch, size_t record_size, bool (APIServerConnectionBase::*send)(const T &)) {
+  std::string &records = batch.states;
+  if (records.empty())
+    return;
+  size_t limit = std::min(TX_BATCH_MAX_SIZE, this->client_->space());
+  if (records.size() + BATCH_FRAME_OVERHEAD <= limit) {
+    if ((this->*send)(batch))
+      records.clear();
+    return;
+  }
+
+  // Too large for one segment (like the first states after subscribing), split it at record boundaries
+  T chunk;
+  size_t sent = 0;
+  while (sent < records.size() && limit >= BATCH_FRAME_OVERHEAD + record_size) {
+    const size_t count = std::min((limit - BATCH_FRAME_OVERHEAD) / record_size * record_size, records.size() - sent);
+    chunk.states.assign(records, sent, count);
+    if (!(this->*send)(chunk))
+      break;
+    sent += count;
+    limit = std::min(TX_BATCH_MAX_SIZE, this->client_->space());
+  }
+  // The rest is sent in the next loop(), newer states still replace its records
+  records.erase(0, sent);
+}
+void APIConnection::send_batched_states_() {
+  // A batch with a single state is as large as the state message it replaces, so batches are always used
+#ifdef USE_BINARY_SENSOR
+  this->send_batch_(this->binary_sensor_batch_, 5, &APIServerConnectionBase::send_batched_binary_sensor_state_response);
+#endif
+#ifdef USE_SENSOR
+  this->send_batch_(this->sensor_batch_, 8, &APIServerConnectionBase::send_batched_sensor_state_response);
+#endif
+#ifdef USE_SWITCH
+  this->send_batch_(this->switch_batch_, 5, &APIServerConnectionBase::send_batched_switch_state_response);
+#endif
 }
 
 std::string get_default_unique_id(const std::string &component_type, Nameable *nameable) {
@@ -162,6 +349,12 @@ bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary
   if (!this->state_subscription_)
     return false;
 
+  if (this->batched_states_) {
+    const uint8_t flags = (state ? 0x01 : 0x00) | (binary_sensor->has_state() ? 0x00 : 0x02);
+    set_batched_state(this->binary_sensor_batch_.states, binary_sensor->get_object_id_hash(), &flags, 1);
+    return true;
+  }
+
   BinarySensorStateResponse resp;
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
@@ -379,6 +572,18 @@ bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   if (!this->state_subscription_)
     return false;
 
+  if (this->batched_states_) {
+    union {
+      float value;
+      uint32_t raw;
+    } val{};
+    val.value = sensor->has_state() ? state : NAN;
+    const uint8_t encoded[4] = {uint8_t(val.raw & 0xFF), uint8_t((val.raw >> 8) & 0xFF),
+                                uint8_t((val.raw >> 16) & 0xFF), uint8_t(val.raw >> 24)};
+    set_batched_state(this->sensor_batch_.states, sensor->get_object_id_hash(), encoded, 4);
+    return true;
+  }
+
   SensorStateResponse resp{};
   resp.key = sensor->get_object_id_hash();
   resp.state = state;
@@ -410,6 +615,12 @@ bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
   if (!this->state_subscription_)
     return false;
 
+  if (this->batched_states_) {
+    const uint8_t encoded = state ? 0x01 : 0x00;
+    set_batched_state(this->switch_batch_.states, a_switch->get_object_id_hash(), &encoded, 1);
+    return true;
+  }
+
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
   resp.state = state;
@@ -438,13 +649,13 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 #endif
 
 #ifdef USE_TEXT_SENSOR
-bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
+bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, const std::string &state) {
   if (!this->state_subscription_)
     return false;
 
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = state;
   resp.missing_state = !text_sensor->has_state();
   return this->send_text_sensor_state_response(resp);
 }
@@ -590,9 +801,46 @@ void APIConnection::number_command(const NumberCommandRequest &msg) {
 }
 #endif
 
+#ifdef USE_SENSOR_HISTORY
+void APIConnection::sensor_history(const SensorHistoryRequest &msg) {
+  SensorHistoryResponse resp;
+  resp.key = msg.key;
+  resp.tier = msg.tier;
+  resp.offset = msg.offset;
+
+  for (auto *history : sensor_history::global_sensor_histories) {
+    if (history->get_sensor()->get_object_id_hash() != msg.key)
+      continue;
+    const auto &tiers = history->get_tiers();
+    resp.tier_count = tiers.size();
+    if (msg.tier >= tiers.size())
+      break;
+
+    const auto &tier = tiers[msg.tier];
+    resp.interval = tier.get_interval();
+    resp.age = tier.get_age();
+    resp.total = tier.size();
+    size_t available = msg.offset < tier.size() ? tier.size() - msg.offset : 0;
+    // The newest samples that fit into the TCP send buffer, clients page through the rest with offset
+    size_t space = this->client_->space();
+    size_t count = std::min(available, space > 64 ? (space - 64) / 2 : 0);
+    if (msg.max_samples != 0 && msg.max_samples < count)
+      count = msg.max_samples;
+    resp.samples.reserve(count * 2);
+    for (size_t i = available - count; i < available; i++) {
+      uint16_t sample = tier.get_raw(i);
+      resp.samples.push_back(char(sample & 0xFF));
+      resp.samples.push_back(char(sample >> 8));
+    }
+    break;
+  }
+  this->send_sensor_history_response(resp);
+}
+#endif
+
 #ifdef USE_ESP32_CAMERA
 void APIConnection::send_camera_state(std::shared_ptr<esp32_camera::CameraImage> image) {
-  if (!this->state_subscription_)
+  if (!this->is_state_subscribed(STATE_DOMAIN_CAMERA, esp32_camera::global_esp32_camera->get_object_id_hash()))
     return;
   if (this->image_reader_.available())
     return;
@@ -625,7 +873,7 @@ void APIConnection::on_get_time_response(const GetTimeResponse &value) {
 #endif
 
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
-  if (this->log_subscription_ < level)
+  if (this->log_subscription_ < level || this->log_binary_)
     return false;
 
   // Send raw so that we don't copy too much
@@ -637,10 +885,51 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
   // string message = 3;
   buffer.encode_string(3, line, strlen(line));
   // SubscribeLogsResponse - 29
-  bool success = this->send_buffer(buffer, 29);
+  return this->send_log_buffer_(buffer, 29);
+}
+bool APIConnection::send_binary_log_message(int level, const char *tag, int line, const char *format,
+                                            const uint8_t *args, size_t args_len) {
+  if (this->log_subscription_ < level || !this->log_binary_)
+    return false;
+
+  auto buffer = this->create_buffer();
+  // LogLevel level = 1;
+  buffer.encode_uint32(1, static_cast<uint32_t>(level));
+  // fixed32 tag = 2;
+  buffer.encode_fixed32(2, reinterpret_cast<uintptr_t>(tag));
+  // fixed32 format = 3;
+  buffer.encode_fixed32(3, reinterpret_cast<uintptr_t>(format));
+  // uint32 line = 4;
+  buffer.encode_uint32(4, line);
+  // bytes args = 5;
+  buffer.encode_string(5, reinterpret_cast<const char *>(args), args_len);
+  // SubscribeLogsBinaryResponse - 57
+  return this->send_log_buffer_(buffer, 57);
+}
+bool APIConnection::send_log_buffer_(ProtoWriteBuffer buffer, uint32_t message_type) {
+#ifdef USE_API_ENCRYPTION
+  // Encrypted frames are always collected in tx_batch_
+  const bool batch_logs = false;
+#else
+  const bool batch_logs = this->parent_->get_log_batch_delay() != 0;
+#endif
+  if (batch_logs) {
+    if (this->log_batch_.empty())
+      this->log_batch_start_ = millis();
+    const uint32_t size = buffer.get_buffer()->size();
+    this->log_batch_.push_back(0x00);
+    ProtoVarInt(size).encode(this->log_batch_);
+    ProtoVarInt(message_type).encode(this->log_batch_);
+    this->log_batch_.insert(this->log_batch_.end(), buffer.get_buffer()->begin(), buffer.get_buffer()->end());
+    if (this->log_batch_.size() >= TX_BATCH_MAX_SIZE)
+      return this->flush_log_batch_();
+    return true;
+  }
+
+  bool success = this->send_buffer(buffer, message_type);
   if (!success) {
     buffer = this->create_buffer();
-    // bool send_failed = 4;
+    // SubscribeLogsResponse with bool send_failed = 4;
     buffer.encode_bool(4, true);
     return this->send_buffer(buffer, 29);
   } else {
@@ -698,10 +987,7 @@ DeviceInfoResponse APIConnection::device_info(const DeviceInfoRequest &msg) {
   return resp;
 }
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
-  for (auto &it : this->parent_->get_state_subs())
-    if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
-      it.callback(msg.state);
-    }
+  this->parent_->on_home_assistant_state(msg.entity_id, msg.attribute, msg.state);
 }
 void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
   bool found = false;
@@ -714,6 +1000,25 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
     ESP_LOGV(TAG, "Could not find matching service!");
   }
 }
+void APIConnection::subscribe_states(const SubscribeStatesRequest &msg) {
+  this->state_subscription_ = true;
+  this->batched_states_ = msg.batched_states;
+  this->state_filtered_ = !msg.keys.empty() || !msg.domains.empty();
+  this->state_keys_ = msg.keys;
+  std::sort(this->state_keys_.begin(), this->state_keys_.end());
+  this->state_domains_ = 0;
+  for (auto &name : msg.domains) {
+    const uint32_t domain = state_domain_from_name(name);
+    if (domain == 0)
+      ESP_LOGW(TAG, "%s: Unknown domain '%s' in state subscription", this->client_info_.c_str(), name.c_str());
+    this->state_domains_ |= domain;
+  }
+  if (this->state_filtered_) {
+    ESP_LOGD(TAG, "%s: Subscribed to the states of %u entities and %u domains", this->client_info_.c_str(),
+             unsigned(this->state_keys_.size()), unsigned(msg.domains.size()));
+  }
+  this->initial_state_iterator_.begin();
+}
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   for (auto &it : this->parent_->get_state_subs()) {
     SubscribeHomeAssistantStateResponse resp;
@@ -725,9 +1030,66 @@ void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistant
     }
   }
 }
+bool APIConnection::flush_log_batch_() {
+  if (this->log_batch_.empty() || this->remove_) {
+    this->log_batch_.clear();
+    return false;
+  }
+
+  this->flush_tx_batch_();
+  bool success = this->log_batch_.size() <= this->client_->space();
+  if (success) {
+    this->client_->add(reinterpret_cast<char *>(this->log_batch_.data()), this->log_batch_.size(),
+                       ASYNC_WRITE_FLAG_COPY);
+    success = this->client_->send();
+  }
+  this->log_batch_.clear();
+  if (!success) {
+    auto buffer = this->create_buffer();
+    // bool send_failed = 4;
+    buffer.encode_bool(4, true);
+    // SubscribeLogsResponse - 29
+    this->send_buffer(buffer, 29);
+  }
+  return success;
+}
+void APIConnection::update_pending_state_(uint32_t message_type, uint32_t key, bool sent,
+                                          const std::vector<uint8_t> &encoded) {
+  for (auto it = this->pending_states_.begin(); it != this->pending_states_.end(); ++it) {
+    if (it->message_type != message_type || it->key != key)
+      continue;
+    if (sent) {
+      this->pending_states_.erase(it);
+    } else {
+      it->encoded = encoded;
+    }
+    return;
+  }
+  if (!sent)
+    this->pending_states_.push_back(PendingState{message_type, key, encoded});
+}
+void APIConnection::send_pending_states_() {
+  size_t sent = 0;
+  for (auto &pending : this->pending_states_) {
+    if (!this->send_buffer(ProtoWriteBuffer{&pending.encoded}, pending.message_type))
+      break;
+    sent++;
+  }
+  this->pending_states_.erase(this->pending_states_.begin(), this->pending_states_.begin() + sent);
+}
+bool APIConnection::flush_tx_batch_() {
+  if (this->tx_batch_.empty())
+    return true;
+  this->client_->add(reinterpret_cast<char *>(this->tx_batch_.data()), this->tx_batch_.size(), ASYNC_WRITE_FLAG_COPY);
+  this->tx_batch_.clear();
+  return this->client_->send();
+}
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
   if (this->remove_)
     return false;
+#ifdef USE_API_ENCRYPTION
+  return this->send_encrypted_buffer_(buffer, message_type);
+#endif
 
   std::vector<uint8_t> header;
   header.push_back(0x00);
@@ -736,11 +1098,13 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
 
   size_t needed_space = buffer.get_buffer()->size() + header.size();
 
+  if (this->tx_batch_.size() + needed_space > this->client_->space())
+    this->flush_tx_batch_();
   if (needed_space > this->client_->space()) {
     delay(0);
     if (needed_space > this->client_->space()) {
-      // SubscribeLogsResponse
-      if (message_type != 29) {
+      // SubscribeLogsResponse, SubscribeLogsBinaryResponse
+      if (message_type != 29 && message_type != 57) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
       }
       delay(0);
@@ -748,12 +1112,22 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  this->client_->add(reinterpret_cast<char *>(header.data()), header.size(),
-                     ASYNC_WRITE_FLAG_COPY | ASYNC_WRITE_FLAG_MORE);
-  this->client_->add(reinterpret_cast<char *>(buffer.get_buffer()->data()), buffer.get_buffer()->size(),
-                     ASYNC_WRITE_FLAG_COPY);
-  bool ret = this->client_->send();
-  return ret;
+  if (needed_space >= TX_BATCH_MAX_SIZE) {
+    // Large messages (like camera images) fill a segment on their own
+    this->flush_tx_batch_();
+    this->client_->add(reinterpret_cast<char *>(header.data()), header.size(),
+                       ASYNC_WRITE_FLAG_COPY | ASYNC_WRITE_FLAG_MORE);
+    this->client_->add(reinterpret_cast<char *>(buffer.get_buffer()->data()), buffer.get_buffer()->size(),
+                       ASYNC_WRITE_FLAG_COPY);
+    return this->client_->send();
+  }
+
+  // Collect small messages, they're sent at the end of loop() or once a segment is full
+  this->tx_batch_.insert(this->tx_batch_.end(), header.begin(), header.end());
+  this->tx_batch_.insert(this->tx_batch_.end(), buffer.get_buffer()->begin(), buffer.get_buffer()->end());
+  if (this->tx_batch_.size() >= TX_BATCH_MAX_SIZE)
+    return this->flush_tx_batch_();
+  return true;
 }
 void APIConnection::on_unauthenticated_access() {
   ESP_LOGD(TAG, "'%s' tried to access without authentication.", this->client_info_.c_str());
@@ -6,12 +6,14 @@
 #include "api_pb2_service.h"
 #include "api_server.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace api {
 
 class APIConnection : public APIServerConnection {
  public:
-  APIConnection(AsyncClient *client, APIServer *parent);
+  APIConnection(APIClient *client, APIServer *parent);
   virtual ~APIConnection();
 
   void disconnect_client();
@@ -50,7 +52,7 @@ class APIConnection : public APIServerConnection {
   void switch_command(const SwitchCommandRequest &msg) override;
 #endif
 #ifdef USE_TEXT_SENSOR
-  bool send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state);
+  bool send_text_sensor_state(text_sensor::TextSensor *text_sensor, const std::string &state);
   bool send_text_sensor_info(text_sensor::TextSensor *text_sensor);
 #endif
 #ifdef USE_ESP32_CAMERA
@@ -67,13 +69,28 @@ class APIConnection : public APIServerConnection {
   bool send_number_state(number::Number *number, float state);
   bool send_number_info(number::Number *number);
   void number_command(const NumberCommandRequest &msg) override;
+#endif
+#ifdef USE_SENSOR_HISTORY
+  void sensor_history(const SensorHistoryRequest &msg) override;
 #endif
   bool send_log_message(int level, const char *tag, const char *line);
+  /// Send a log message unformatted to a client that subscribed with binary set.
+  bool send_binary_log_message(int level, const char *tag, int line, const char *format, const uint8_t *args,
+                               size_t args_len);
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->service_call_subscription_)
       return;
     this->send_homeassistant_service_response(call);
   }
+  /// Send a HomeassistantServiceResponse that was already encoded.
+  void send_homeassistant_service_call(const std::vector<uint8_t> &encoded) {
+    if (!this->service_call_subscription_)
+      return;
+    auto buffer = this->create_buffer();
+    buffer.get_buffer()->insert(buffer.get_buffer()->end(), encoded.begin(), encoded.end());
+    // HomeassistantServiceResponse - 35
+    this->send_buffer(buffer, 35);
+  }
 #ifdef USE_HOMEASSISTANT_TIME
   void send_time_request() {
     GetTimeRequest req;
@@ -104,12 +121,18 @@ class APIConnection : public APIServerConnection {
   PingResponse ping(const PingRequest &msg) override { return {}; }
   DeviceInfoResponse device_info(const DeviceInfoRequest &msg) override;
   void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
-  void subscribe_states(const SubscribeStatesRequest &msg) override {
-    this->state_subscription_ = true;
-    this->initial_state_iterator_.begin();
+  void subscribe_states(const SubscribeStatesRequest &msg) override;
+  /// Whether the client subscribed to the states of this entity, `domain` is one of StateDomain.
+  bool is_state_subscribed(uint32_t domain, uint32_t key) const {
+    if (!this->state_subscription_)
+      return false;
+    if (!this->state_filtered_ || (this->state_domains_ & domain) != 0)
+      return true;
+    return std::binary_search(this->state_keys_.begin(), this->state_keys_.end(), key);
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->log_subscription_ = msg.level;
+    this->log_binary_ = msg.binary;
     if (msg.dump_config)
       App.schedule_dump_config();
   }
@@ -137,12 +160,45 @@ class APIConnection : public APIServerConnection {
 
  protected:
   friend APIServer;
+  friend ListEntitiesIterator;
 
   void on_error_(int8_t error);
   void on_disconnect_();
   void on_timeout_(uint32_t time);
   void on_data_(uint8_t *buf, size_t len);
   void parse_recv_buffer_();
+#ifdef USE_API_ENCRYPTION
+  /** Parse encrypted frames: [0x01][length, 16 bit big endian][data].
+   *
+   * The first frame holds the 16 byte client nonce, the server answers with its own nonce and all further frames
+   * carry [message type, 16 bit big endian][message] encrypted, followed by the 16 byte GCM tag.
+   */
+  void parse_encrypted_recv_buffer_();
+  bool send_encrypted_buffer_(ProtoWriteBuffer buffer, uint32_t message_type);
+#endif
+  /// Send an encoded SubscribeLogsResponse or SubscribeLogsBinaryResponse, or collect it in log_batch_.
+  bool send_log_buffer_(ProtoWriteBuffer buffer, uint32_t message_type);
+  /// Send all log messages collected in log_batch_ in one write.
+  bool flush_log_batch_();
+  /// Hand the messages collected in tx_batch_ to the TCP stack.
+  bool flush_tx_batch_();
+  /** Keep the latest state of an entity that could not be sent because the TCP buffer was full.
+   *
+   * A successfully sent newer state discards the pending one, a failed one replaces it.
+   */
+  void update_pending_state_(uint32_t message_type, uint32_t key, bool sent, const std::vector<uint8_t> &encoded);
+  /// Retry pending states, oldest first, until the TCP buffer is full again.
+  void send_pending_states_();
+  /// Whether states of this message type are collected for the next Batched*StateResponse instead of sent.
+  bool batches_state_(uint32_t message_type) const {
+    // BinarySensorStateResponse, SensorStateResponse, SwitchStateResponse
+    return this->batched_states_ && (message_type == 21 || message_type == 25 || message_type == 26);
+  }
+  /// Send the states collected since the last loop() in as few messages per domain as fit a TCP segment.
+  void send_batched_states_();
+  /// Send the records of `batch` in messages of at most one TCP segment, and keep those that could not be sent.
+  template<typename T>
+  void send_batch_(T &batch, size_t record_size, bool (APIServerConnectionBase::*send)(const T &));
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -154,6 +210,32 @@ class APIConnection : public APIServerConnection {
 
   std::vector<uint8_t> send_buffer_;
   std::vector<uint8_t> recv_buffer_;
+#ifdef USE_API_ENCRYPTION
+  /// Created once the nonces are exchanged, no messages are sent or accepted before.
+  std::unique_ptr<APIFrameCipher> cipher_;
+#endif
+  /// Complete SubscribeLogsResponse frames waiting to be sent, see APIServer::set_log_batch_delay().
+  std::vector<uint8_t> log_batch_;
+  /// Complete frames of small messages waiting to be sent, flushed at the end of loop().
+  std::vector<uint8_t> tx_batch_;
+  struct PendingState {
+    uint32_t message_type;
+    uint32_t key;
+    std::vector<uint8_t> encoded;
+  };
+  /// At most one entry per entity, see update_pending_state_().
+  std::vector<PendingState> pending_states_;
+  /// States waiting for send_batched_states_(), one record per entity.
+#ifdef USE_BINARY_SENSOR
+  BatchedBinarySensorStateResponse binary_sensor_batch_;
+#endif
+#ifdef USE_SENSOR
+  BatchedSensorStateResponse sensor_batch_;
+#endif
+#ifdef USE_SWITCH
+  BatchedSwitchStateResponse switch_batch_;
+#endif
+  uint32_t log_batch_start_{0};
 
   std::string client_info_;
 #ifdef USE_ESP32_CAMERA
@@ -161,13 +243,20 @@ class APIConnection : public APIServerConnection {
 #endif
 
   bool state_subscription_{false};
+  bool batched_states_{false};
+  /// The client only subscribed to the entities in state_domains_ and state_keys_ (sorted).
+  bool state_filtered_{false};
+  uint32_t state_domains_{0};
+  std::vector<uint32_t> state_keys_;
   int log_subscription_{ESPHOME_LOG_LEVEL_NONE};
+  /// The client decodes SubscribeLogsBinaryResponse, it gets no formatted log messages.
+  bool log_binary_{false};
   uint32_t last_traffic_;
   bool sent_ping_{false};
   bool service_call_subscription_{false};
   bool current_nodelay_{false};
   bool next_close_{false};
-  AsyncClient *client_;
+  APIClient *client_;
   APIServer *parent_;
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
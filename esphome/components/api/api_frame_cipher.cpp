@@ -0,0 +1,64 @@
+#include "api_frame_cipher.h"
+
+#ifdef USE_API_ENCRYPTION
+
+#include <mbedtls/md.h>
+#include <cstring>
+
+namespace esphome {
+namespace api {
+
+static const size_t IV_SIZE = 12;
+
+/// HMAC-SHA256(psk, label || client nonce || server nonce)
+static void derive_key(const std::array<uint8_t, APIFrameCipher::KEY_SIZE> &psk, const char *label,
+                       const uint8_t *client_nonce, const uint8_t *server_nonce, uint8_t *out) {
+  const mbedtls_md_info_t *md = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+  mbedtls_md_context_t ctx;
+  mbedtls_md_init(&ctx);
+  mbedtls_md_setup(&ctx, md, 1);
+  mbedtls_md_hmac_starts(&ctx, psk.data(), psk.size());
+  mbedtls_md_hmac_update(&ctx, reinterpret_cast<const uint8_t *>(label), strlen(label));
+  mbedtls_md_hmac_update(&ctx, client_nonce, APIFrameCipher::NONCE_SIZE);
+  mbedtls_md_hmac_update(&ctx, server_nonce, APIFrameCipher::NONCE_SIZE);
+  mbedtls_md_hmac_finish(&ctx, out);
+  mbedtls_md_free(&ctx);
+}
+
+APIFrameCipher::APIFrameCipher(const std::array<uint8_t, KEY_SIZE> &psk, const uint8_t *client_nonce,
+                               const uint8_t *server_nonce) {
+  uint8_t key[KEY_SIZE];
+  mbedtls_gcm_init(&this->tx_);
+  mbedtls_gcm_init(&this->rx_);
+  // The server sends with the server-to-client key and receives with the client-to-server key
+  derive_key(psk, "esphome s2c", client_nonce, server_nonce, key);
+  mbedtls_gcm_setkey(&this->tx_, MBEDTLS_CIPHER_ID_AES, key, KEY_SIZE * 8);
+  derive_key(psk, "esphome c2s", client_nonce, server_nonce, key);
+  mbedtls_gcm_setkey(&this->rx_, MBEDTLS_CIPHER_ID_AES, key, KEY_SIZE * 8);
+  memset(key, 0, sizeof(key));
+}
+APIFrameCipher::~APIFrameCipher() {
+  mbedtls_gcm_free(&this->tx_);
+  mbedtls_gcm_free(&this->rx_);
+}
+void APIFrameCipher::make_iv_(uint64_t counter, uint8_t *iv) {
+  memset(iv, 0, IV_SIZE);
+  for (size_t i = 0; i < 8; i++)
+    iv[i] = counter >> (i * 8);
+}
+void APIFrameCipher::encrypt(const uint8_t *aad, size_t aad_len, uint8_t *data, size_t len, uint8_t *tag) {
+  uint8_t iv[IV_SIZE];
+  make_iv_(this->tx_counter_++, iv);
+  mbedtls_gcm_crypt_and_tag(&this->tx_, MBEDTLS_GCM_ENCRYPT, len, iv, IV_SIZE, aad, aad_len, data, data, TAG_SIZE,
+                            tag);
+}
+bool APIFrameCipher::decrypt(const uint8_t *aad, size_t aad_len, uint8_t *data, size_t len, const uint8_t *tag) {
+  uint8_t iv[IV_SIZE];
+  make_iv_(this->rx_counter_++, iv);
+  return mbedtls_gcm_auth_decrypt(&this->rx_, len, iv, IV_SIZE, aad, aad_len, tag, TAG_SIZE, data, data) == 0;
+}
+
+}  // namespace api
+}  // namespace esphome
+
+#endif  // USE_API_ENCRYPTION
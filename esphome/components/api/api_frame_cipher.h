@@ -0,0 +1,47 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_API_ENCRYPTION
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <mbedtls/gcm.h>
+
+namespace esphome {
+namespace api {
+
+/** AES-256-GCM for encrypted native API frames.
+ *
+ * Both sides derive one key per direction from the pre-shared key and the nonces exchanged at the start of the
+ * connection, so every connection uses fresh keys. The 96 bit GCM IV is the frame counter of the direction,
+ * which also rejects replayed or reordered frames. mbedtls uses the AES peripheral of the ESP32.
+ */
+class APIFrameCipher {
+ public:
+  static const size_t KEY_SIZE = 32;
+  static const size_t NONCE_SIZE = 16;
+  static const size_t TAG_SIZE = 16;
+
+  APIFrameCipher(const std::array<uint8_t, KEY_SIZE> &psk, const uint8_t *client_nonce, const uint8_t *server_nonce);
+  ~APIFrameCipher();
+
+  /// Encrypt len bytes at data in place and write the tag, the frame header in aad is authenticated too.
+  void encrypt(const uint8_t *aad, size_t aad_len, uint8_t *data, size_t len, uint8_t *tag);
+  /// Decrypt len bytes at data in place, returns false if the frame was modified or is out of order.
+  bool decrypt(const uint8_t *aad, size_t aad_len, uint8_t *data, size_t len, const uint8_t *tag);
+
+ protected:
+  static void make_iv_(uint64_t counter, uint8_t *iv);
+
+  mbedtls_gcm_context tx_;
+  mbedtls_gcm_context rx_;
+  uint64_t tx_counter_{0};
+  uint64_t rx_counter_{0};
+};
+
+}  // namespace api
+}  // namespace esphome
+
+#endif  // USE_API_ENCRYPTION
@@ -135,6 +135,9 @@ bool APIServerConnectionBase::send_text_sensor_state_response(const TextSensorSt
 bool APIServerConnectionBase::send_subscribe_logs_response(const SubscribeLogsResponse &msg) {
   return this->send_message_<SubscribeLogsResponse>(msg, 29);
 }
+bool APIServerConnectionBase::send_subscribe_logs_binary_response(const SubscribeLogsBinaryResponse &msg) {
+  return this->send_message_<SubscribeLogsBinaryResponse>(msg, 57);
+}
 bool APIServerConnectionBase::send_homeassistant_service_response(const HomeassistantServiceResponse &msg) {
   ESP_LOGVV(TAG, "send_homeassistant_service_response: %s", msg.dump().c_str());
   return this->send_message_<HomeassistantServiceResponse>(msg, 35);
@@ -198,6 +201,32 @@ bool APIServerConnectionBase::send_number_state_response(const NumberStateRespon
 #endif
 #ifdef USE_NUMBER
 #endif
+#ifdef USE_SENSOR_HISTORY
+#endif
+#ifdef USE_SENSOR_HISTORY
+bool APIServerConnectionBase::send_sensor_history_response(const SensorHistoryResponse &msg) {
+  ESP_LOGVV(TAG, "send_sensor_history_response: %s", msg.dump().c_str());
+  return this->send_message_<SensorHistoryResponse>(msg, 53);
+}
+#endif
+#ifdef USE_SENSOR
+bool APIServerConnectionBase::send_batched_sensor_state_response(const BatchedSensorStateResponse &msg) {
+  ESP_LOGVV(TAG, "send_batched_sensor_state_response: %s", msg.dump().c_str());
+  return this->send_message_<BatchedSensorStateResponse>(msg, 54);
+}
+#endif
+#ifdef USE_BINARY_SENSOR
+bool APIServerConnectionBase::send_batched_binary_sensor_state_response(const BatchedBinarySensorStateResponse &msg) {
+  ESP_LOGVV(TAG, "send_batched_binary_sensor_state_response: %s", msg.dump().c_str());
+  return this->send_message_<BatchedBinarySensorStateResponse>(msg, 55);
+}
+#endif
+#ifdef USE_SWITCH
+bool APIServerConnectionBase::send_batched_switch_state_response(const BatchedSwitchStateResponse &msg) {
+  ESP_LOGVV(TAG, "send_batched_switch_state_response: %s", msg.dump().c_str());
+  return this->send_message_<BatchedSwitchStateResponse>(msg, 56);
+}
+#endif
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -372,6 +401,15 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       msg.decode(msg_data, msg_size);
       ESP_LOGVV(TAG, "on_number_command_request: %s", msg.dump().c_str());
       this->on_number_command_request(msg);
+#endif
+      break;
+    }
+    case 52: {
+#ifdef USE_SENSOR_HISTORY
+      SensorHistoryRequest msg;
+      msg.decode(msg_data, msg_size);
+      ESP_LOGVV(TAG, "on_sensor_history_request: %s", msg.dump().c_str());
+      this->on_sensor_history_request(msg);
 #endif
       break;
     }
@@ -583,6 +621,19 @@ void APIServerConnection::on_number_command_request(const NumberCommandRequest &
   this->number_command(msg);
 }
 #endif
+#ifdef USE_SENSOR_HISTORY
+void APIServerConnection::on_sensor_history_request(const SensorHistoryRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  this->sensor_history(msg);
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
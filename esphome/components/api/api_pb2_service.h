@@ -83,6 +83,7 @@ class APIServerConnectionBase : public ProtoService {
 #endif
   virtual void on_subscribe_logs_request(const SubscribeLogsRequest &value){};
   bool send_subscribe_logs_response(const SubscribeLogsResponse &msg);
+  bool send_subscribe_logs_binary_response(const SubscribeLogsBinaryResponse &msg);
   virtual void on_subscribe_homeassistant_services_request(const SubscribeHomeassistantServicesRequest &value){};
   bool send_homeassistant_service_response(const HomeassistantServiceResponse &msg);
   virtual void on_subscribe_home_assistant_states_request(const SubscribeHomeAssistantStatesRequest &value){};
@@ -120,6 +121,21 @@ class APIServerConnectionBase : public ProtoService {
 #endif
 #ifdef USE_NUMBER
   virtual void on_number_command_request(const NumberCommandRequest &value){};
+#endif
+#ifdef USE_SENSOR_HISTORY
+  virtual void on_sensor_history_request(const SensorHistoryRequest &value){};
+#endif
+#ifdef USE_SENSOR_HISTORY
+  bool send_sensor_history_response(const SensorHistoryResponse &msg);
+#endif
+#ifdef USE_SENSOR
+  bool send_batched_sensor_state_response(const BatchedSensorStateResponse &msg);
+#endif
+#ifdef USE_BINARY_SENSOR
+  bool send_batched_binary_sensor_state_response(const BatchedBinarySensorStateResponse &msg);
+#endif
+#ifdef USE_SWITCH
+  bool send_batched_switch_state_response(const BatchedSwitchStateResponse &msg);
 #endif
  protected:
   bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) override;
@@ -159,6 +175,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #endif
 #ifdef USE_NUMBER
   virtual void number_command(const NumberCommandRequest &msg) = 0;
+#endif
+#ifdef USE_SENSOR_HISTORY
+  virtual void sensor_history(const SensorHistoryRequest &msg) = 0;
 #endif
  protected:
   void on_hello_request(const HelloRequest &msg) override;
@@ -194,6 +213,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_NUMBER
   void on_number_command_request(const NumberCommandRequest &msg) override;
 #endif
+#ifdef USE_SENSOR_HISTORY
+  void on_sensor_history_request(const SensorHistoryRequest &msg) override;
+#endif
 };
 
 }  // namespace api
@@ -21,6 +21,12 @@ static const char *const TAG = "api";
 void APIServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Home Assistant API server...");
   this->setup_controller();
+#ifdef USE_API_SOCKET
+  if (!this->server_.begin(this->port_)) {
+    this->mark_failed();
+    return;
+  }
+#else
   this->server_ = AsyncServer(this->port_);
   this->server_.setNoDelay(false);
   this->server_.begin();
@@ -35,14 +41,29 @@ void APIServer::setup() {
         a_this->clients_.push_back(new APIConnection(client, a_this));
       },
       this);
+#endif
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
-    logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
-      for (auto *c : this->clients_) {
-        if (!c->remove_)
-          c->send_log_message(level, tag, message);
-      }
-    });
+    logger::global_logger->add_on_log_callback(
+        [this](int level, const char *tag, const char *message) {
+          if (this->in_state_fanout_)
+            return;
+          for (auto *c : this->clients_) {
+            if (!c->remove_)
+              c->send_log_message(level, tag, message);
+          }
+        },
+        &this->log_subscription_level_);
+    logger::global_logger->add_on_binary_log_callback(
+        [this](int level, const char *tag, int line, const char *format, const uint8_t *args, size_t args_len) {
+          if (this->in_state_fanout_)
+            return;
+          for (auto *c : this->clients_) {
+            if (!c->remove_)
+              c->send_binary_log_message(level, tag, line, format, args, args_len);
+          }
+        },
+        &this->binary_log_subscription_level_);
   }
 #endif
 
@@ -59,6 +80,12 @@ void APIServer::setup() {
 #endif
 }
 void APIServer::loop() {
+#ifdef USE_API_SOCKET
+  while (auto *client = this->server_.accept_client(this->send_buffer_size_)) {
+    ESP_LOGD(TAG, "New client connected from %s", client->remoteIP().toString().c_str());
+    this->clients_.push_back(new APIConnection(client, this));
+  }
+#endif
   // Partition clients into remove and active
   auto new_end =
       std::partition(this->clients_.begin(), this->clients_.end(), [](APIConnection *conn) { return !conn->remove_; });
@@ -73,9 +100,15 @@ void APIServer::loop() {
   // resize vector
   this->clients_.erase(new_end, this->clients_.end());
 
+  int log_subscription_level = ESPHOME_LOG_LEVEL_NONE;
+  int binary_log_subscription_level = ESPHOME_LOG_LEVEL_NONE;
   for (auto *client : this->clients_) {
     client->loop();
+    int &level = client->log_binary_ ? binary_log_subscription_level : log_subscription_level;
+    level = std::max(level, client->log_subscription_);
   }
+  this->log_subscription_level_ = log_subscription_level;
+  this->binary_log_subscription_level_ = binary_log_subscription_level;
 
   if (this->reboot_timeout_ != 0) {
     const uint32_t now = millis();
@@ -94,6 +127,9 @@ void APIServer::loop() {
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network_get_address().c_str(), this->port_);
+#ifdef USE_API_ENCRYPTION
+  ESP_LOGCONFIG(TAG, "  Using encryption");
+#endif
 }
 bool APIServer::uses_password() const { return !this->password_.empty(); }
 bool APIServer::check_password(const std::string &password) const {
@@ -125,12 +161,43 @@ bool APIServer::check_password(const std::string &password) const {
   return result == 0;
 }
 void APIServer::handle_disconnect(APIConnection *conn) {}
+template<typename F>
+void APIServer::send_state_to_clients_(uint32_t message_type, uint32_t domain, uint32_t key, F &&send) {
+  // The first subscribed client encodes the message, the others get a copy of the encoded bytes. Log messages
+  // aren't sent to clients meanwhile, encoding them would overwrite the send buffer holding the state message.
+  APIConnection *encoded = nullptr;
+  bool copied = false;
+  this->in_state_fanout_ = true;
+  for (auto *c : this->clients_) {
+    if (c->remove_ || !c->is_state_subscribed(domain, key))
+      continue;
+    if (c->batches_state_(message_type)) {
+      // Only adds the state to the batch of the connection, nothing is encoded in its send buffer
+      send(c);
+      continue;
+    }
+    if (encoded == nullptr) {
+      encoded = c;
+      bool success = send(c);
+      c->update_pending_state_(message_type, key, success, c->send_buffer_);
+      continue;
+    }
+    if (!copied) {
+      this->shared_state_buffer_ = encoded->send_buffer_;
+      copied = true;
+    }
+    bool success = c->send_buffer(ProtoWriteBuffer{&this->shared_state_buffer_}, message_type);
+    c->update_pending_state_(message_type, key, success, this->shared_state_buffer_);
+  }
+  this->in_state_fanout_ = false;
+}
+
 #ifdef USE_BINARY_SENSOR
 void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_binary_sensor_state(obj, state);
+  this->send_state_to_clients_(21, STATE_DOMAIN_BINARY_SENSOR, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_binary_sensor_state(obj, state); });
 }
 #endif
 
@@ -138,8 +205,8 @@ void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
 void APIServer::on_cover_update(cover::Cover *obj) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_cover_state(obj);
+  this->send_state_to_clients_(22, STATE_DOMAIN_COVER, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_cover_state(obj); });
 }
 #endif
 
@@ -147,8 +214,8 @@ void APIServer::on_cover_update(cover::Cover *obj) {
 void APIServer::on_fan_update(fan::FanState *obj) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_fan_state(obj);
+  this->send_state_to_clients_(23, STATE_DOMAIN_FAN, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_fan_state(obj); });
 }
 #endif
 
@@ -156,8 +223,8 @@ void APIServer::on_fan_update(fan::FanState *obj) {
 void APIServer::on_light_update(light::LightState *obj) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_light_state(obj);
+  this->send_state_to_clients_(24, STATE_DOMAIN_LIGHT, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_light_state(obj); });
 }
 #endif
 
@@ -165,8 +232,8 @@ void APIServer::on_light_update(light::LightState *obj) {
 void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_sensor_state(obj, state);
+  this->send_state_to_clients_(25, STATE_DOMAIN_SENSOR, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_sensor_state(obj, state); });
 }
 #endif
 
@@ -174,8 +241,8 @@ void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
 void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_switch_state(obj, state);
+  this->send_state_to_clients_(26, STATE_DOMAIN_SWITCH, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_switch_state(obj, state); });
 }
 #endif
 
@@ -183,8 +250,8 @@ void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
 void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_text_sensor_state(obj, state);
+  this->send_state_to_clients_(27, STATE_DOMAIN_TEXT_SENSOR, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_text_sensor_state(obj, state); });
 }
 #endif
 
@@ -192,8 +259,8 @@ void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
 void APIServer::on_climate_update(climate::Climate *obj) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_climate_state(obj);
+  this->send_state_to_clients_(47, STATE_DOMAIN_CLIMATE, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_climate_state(obj); });
 }
 #endif
 
@@ -201,8 +268,8 @@ void APIServer::on_climate_update(climate::Climate *obj) {
 void APIServer::on_number_update(number::Number *obj, float state) {
   if (obj->is_internal())
     return;
-  for (auto *c : this->clients_)
-    c->send_number_state(obj, state);
+  this->send_state_to_clients_(50, STATE_DOMAIN_NUMBER, obj->get_object_id_hash(),
+                               [&](APIConnection *c) { return c->send_number_state(obj, state); });
 }
 #endif
 
@@ -216,14 +283,72 @@ void APIServer::send_homeassistant_service_call(const HomeassistantServiceRespon
     client->send_homeassistant_service_call(call);
   }
 }
+void APIServer::send_homeassistant_service_call(const std::vector<uint8_t> &encoded) {
+  for (auto *client : this->clients_) {
+    client->send_homeassistant_service_call(encoded);
+  }
+}
+bool APIServer::has_service_call_subscriber() const {
+  for (auto *client : this->clients_) {
+    if (client->service_call_subscription_)
+      return true;
+  }
+  return false;
+}
 APIServer::APIServer() { global_api_server = this; }
+// FNV-1 over the entity id, a separator and the attribute, no attribute is the same as an empty one
+static uint32_t state_sub_hash(const std::string &entity_id, const std::string &attribute) {
+  uint32_t hash = fnv1_hash(entity_id);
+  hash *= 16777619UL;
+  for (char c : attribute) {
+    hash *= 16777619UL;
+    hash ^= c;
+  }
+  return hash;
+}
+APIServer::HomeAssistantStateSubscription &APIServer::get_state_sub_(std::string entity_id,
+                                                                     optional<std::string> attribute) {
+  const uint32_t hash = state_sub_hash(entity_id, attribute.value());
+  auto it = std::lower_bound(
+      this->state_subs_.begin(), this->state_subs_.end(), hash,
+      [](const HomeAssistantStateSubscription &sub, uint32_t value) { return sub.hash < value; });
+  for (auto sub = it; sub != this->state_subs_.end() && sub->hash == hash; sub++) {
+    if (sub->entity_id == entity_id && sub->attribute.value() == attribute.value())
+      return *sub;
+  }
+  // Subscriptions are made during setup, so keeping the vector sorted here is cheap
+  HomeAssistantStateSubscription sub{};
+  sub.entity_id = std::move(entity_id);
+  sub.attribute = std::move(attribute);
+  sub.hash = hash;
+  return *this->state_subs_.insert(it, std::move(sub));
+}
 void APIServer::subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
-                                               std::function<void(std::string)> f) {
-  this->state_subs_.push_back(HomeAssistantStateSubscription{
-      .entity_id = std::move(entity_id),
-      .attribute = std::move(attribute),
-      .callback = std::move(f),
-  });
+                                               std::function<void(const std::string &)> f) {
+  this->get_state_sub_(std::move(entity_id), std::move(attribute)).callbacks.push_back(std::move(f));
+}
+void APIServer::subscribe_home_assistant_number_state(std::string entity_id, optional<std::string> attribute,
+                                                      std::function<void(const std::string &, optional<float>)> f) {
+  this->get_state_sub_(std::move(entity_id), std::move(attribute)).number_callbacks.push_back(std::move(f));
+}
+void APIServer::on_home_assistant_state(const std::string &entity_id, const std::string &attribute,
+                                        const std::string &state) {
+  const uint32_t hash = state_sub_hash(entity_id, attribute);
+  auto it = std::lower_bound(
+      this->state_subs_.begin(), this->state_subs_.end(), hash,
+      [](const HomeAssistantStateSubscription &sub, uint32_t value) { return sub.hash < value; });
+  for (; it != this->state_subs_.end() && it->hash == hash; it++) {
+    if (it->entity_id != entity_id || it->attribute.value() != attribute)
+      continue;
+    for (auto &callback : it->callbacks)
+      callback(state);
+    if (!it->number_callbacks.empty()) {
+      const optional<float> value = parse_float(state);
+      for (auto &callback : it->number_callbacks)
+        callback(state, value);
+    }
+    return;
+  }
 }
 const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_state_subs() const {
   return this->state_subs_;
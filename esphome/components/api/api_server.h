@@ -10,6 +10,8 @@
 #include "list_entities.h"
 #include "subscribe_state.h"
 #include "user_services.h"
+#include "api_socket.h"
+#include "api_frame_cipher.h"
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <AsyncTCP.h>
@@ -21,12 +23,19 @@
 namespace esphome {
 namespace api {
 
+#ifdef USE_API_SOCKET
+using APIClient = APISocketClient;
+#else
+using APIClient = AsyncClient;
+#endif
+
 class APIServer : public Component, public Controller {
  public:
   APIServer();
   void setup() override;
   uint16_t get_port() const;
   float get_setup_priority() const override;
+  bool is_loop_latency_critical() const override { return true; }
   void loop() override;
   void dump_config() override;
   void on_shutdown() override;
@@ -35,6 +44,19 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /// Collect log messages for up to this many milliseconds and send them in one TCP write, 0 to send right away.
+  void set_log_batch_delay(uint32_t log_batch_delay) { this->log_batch_delay_ = log_batch_delay; }
+  uint32_t get_log_batch_delay() const { return this->log_batch_delay_; }
+  void set_list_entities_cache(bool list_entities_cache) { this->list_entities_cache_enabled_ = list_entities_cache; }
+#ifdef USE_API_ENCRYPTION
+  /// Require all clients to encrypt their connection with this pre-shared key.
+  void set_encryption_key(std::array<uint8_t, APIFrameCipher::KEY_SIZE> key) { this->encryption_key_ = key; }
+  const std::array<uint8_t, APIFrameCipher::KEY_SIZE> &get_encryption_key() const { return this->encryption_key_; }
+#endif
+#ifdef USE_API_SOCKET
+  /// Maximum amount of data kept for each connection that the TCP stack didn't accept yet.
+  void set_send_buffer_size(size_t send_buffer_size) { this->send_buffer_size_ = send_buffer_size; }
+#endif
   void handle_disconnect(APIConnection *conn);
 #ifdef USE_BINARY_SENSOR
   void on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) override;
@@ -64,6 +86,10 @@ class APIServer : public Component, public Controller {
   void on_number_update(number::Number *obj, float state) override;
 #endif
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call);
+  /// Send an already encoded HomeassistantServiceResponse to all clients that subscribed to service calls.
+  void send_homeassistant_service_call(const std::vector<uint8_t> &encoded);
+  /// Whether any client subscribed to service calls, they don't need to be built otherwise.
+  bool has_service_call_subscriber() const;
   void register_user_service(UserServiceDescriptor *descriptor) { this->user_services_.push_back(descriptor); }
 #ifdef USE_HOMEASSISTANT_TIME
   void request_time();
@@ -71,24 +97,59 @@ class APIServer : public Component, public Controller {
 
   bool is_connected() const;
 
+  /// All subscribers of one entity state or attribute, Home Assistant is asked for it only once.
   struct HomeAssistantStateSubscription {
     std::string entity_id;
     optional<std::string> attribute;
-    std::function<void(std::string)> callback;
+    /// Hash of entity_id and attribute, state_subs_ is sorted by it.
+    uint32_t hash;
+    std::vector<std::function<void(const std::string &)>> callbacks;
+    /// Receive the state parsed as a number, it is parsed once for all of them.
+    std::vector<std::function<void(const std::string &, optional<float>)>> number_callbacks;
   };
 
   void subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
-                                      std::function<void(std::string)> f);
+                                      std::function<void(const std::string &)> f);
+  /// Like subscribe_home_assistant_state(), f also gets the state as a number, or nothing if it isn't one.
+  void subscribe_home_assistant_number_state(std::string entity_id, optional<std::string> attribute,
+                                             std::function<void(const std::string &, optional<float>)> f);
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
+  /// Pass a state sent by Home Assistant to the subscribers of the entity.
+  void on_home_assistant_state(const std::string &entity_id, const std::string &attribute, const std::string &state);
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
 
  protected:
+  friend ListEntitiesIterator;
+
+  /// Encode a state message once with send and copy the encoded message to all other subscribed clients.
+  template<typename F> void send_state_to_clients_(uint32_t message_type, uint32_t domain, uint32_t key, F &&send);
+  HomeAssistantStateSubscription &get_state_sub_(std::string entity_id, optional<std::string> attribute);
+
+#ifdef USE_API_SOCKET
+  APISocketServer server_;
+  size_t send_buffer_size_{4096};
+#else
   AsyncServer server_{0};
+#endif
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
   uint32_t last_connected_{0};
+  uint32_t log_batch_delay_{0};
   std::vector<APIConnection *> clients_;
+  /// Highest log level any client subscribed to, messages above it are not formatted for the API.
+  int log_subscription_level_{ESPHOME_LOG_LEVEL_NONE};
+  /// Same for the clients that subscribed to binary log messages, which need no formatting.
+  int binary_log_subscription_level_{ESPHOME_LOG_LEVEL_NONE};
+  /// Encoded state message shared by all clients in send_state_to_clients_().
+  std::vector<uint8_t> shared_state_buffer_;
+  bool in_state_fanout_{false};
+  /// Encoded ListEntities responses in iteration order, shared by all connections.
+  std::vector<std::vector<uint8_t>> list_entities_cache_;
+  bool list_entities_cache_enabled_{false};
   std::string password_;
+#ifdef USE_API_ENCRYPTION
+  std::array<uint8_t, APIFrameCipher::KEY_SIZE> encryption_key_{};
+#endif
   std::vector<HomeAssistantStateSubscription> state_subs_;
   std::vector<UserServiceDescriptor *> user_services_;
 };
@@ -97,7 +158,7 @@ extern APIServer *global_api_server;  // NOLINT(cppcoreguidelines-avoid-non-cons
 
 template<typename... Ts> class APIConnectedCondition : public Condition<Ts...> {
  public:
-  bool check(Ts... x) override { return global_api_server->is_connected(); }
+  bool check(const Ts &... x) override { return global_api_server->is_connected(); }
 };
 
 }  // namespace api
@@ -0,0 +1,171 @@
+#include "api_socket.h"
+
+#ifdef USE_API_SOCKET
+
+#include "esphome/core/log.h"
+#include <cerrno>
+#include <lwip/sockets.h>
+
+namespace esphome {
+namespace api {
+
+static const char *const TAG = "api.socket";
+
+static const size_t READ_CHUNK_SIZE = 256;
+static const size_t MAX_CHUNKS = 4;
+
+static bool set_non_blocking(int fd) {
+  int flags = lwip_fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && lwip_fcntl(fd, F_SETFL, flags | O_NONBLOCK) >= 0;
+}
+static bool would_block() { return errno == EWOULDBLOCK || errno == EAGAIN; }
+
+APISocketClient::APISocketClient(int fd, IPAddress remote_ip, size_t send_buffer_size)
+    : fd_(fd), remote_ip_(remote_ip), send_buffer_size_(send_buffer_size) {
+  this->queued_.reserve(MAX_CHUNKS);
+}
+APISocketClient::~APISocketClient() { this->close(true); }
+size_t APISocketClient::add(const char *data, size_t size, uint8_t apiflags) {
+  if (this->fd_ < 0 || size == 0)
+    return 0;
+  if (this->queued_.size() >= MAX_CHUNKS - 1)
+    // Keep a slot for the unsent data, which has to be written first
+    this->send();
+  this->queued_.push_back(Chunk{reinterpret_cast<const uint8_t *>(data), size});
+  return size;
+}
+bool APISocketClient::send() {
+  if (this->fd_ < 0) {
+    this->queued_.clear();
+    return false;
+  }
+  if (this->queued_.empty() && this->unsent_.empty())
+    return true;
+
+  // Older unsent data goes first, then header and payload of the new messages in a single call
+  struct iovec iov[MAX_CHUNKS];
+  int count = 0;
+  if (!this->unsent_.empty()) {
+    iov[count].iov_base = this->unsent_.data();
+    iov[count].iov_len = this->unsent_.size();
+    count++;
+  }
+  for (auto &chunk : this->queued_) {
+    iov[count].iov_base = const_cast<uint8_t *>(chunk.data);
+    iov[count].iov_len = chunk.size;
+    count++;
+  }
+
+  ssize_t written = lwip_writev(this->fd_, iov, count);
+  if (written < 0) {
+    if (!would_block()) {
+      ESP_LOGV(TAG, "Write failed with errno %d", errno);
+      this->queued_.clear();
+      this->close(true);
+      return false;
+    }
+    written = 0;
+  }
+
+  // Keep everything the TCP stack didn't accept
+  std::vector<uint8_t> rest;
+  size_t skip = written;
+  for (int i = 0; i < count; i++) {
+    auto *data = reinterpret_cast<const uint8_t *>(iov[i].iov_base);
+    size_t len = iov[i].iov_len;
+    if (skip >= len) {
+      skip -= len;
+      continue;
+    }
+    rest.insert(rest.end(), data + skip, data + len);
+    skip = 0;
+  }
+  this->unsent_.swap(rest);
+  this->queued_.clear();
+  return true;
+}
+void APISocketClient::flush() {
+  if (!this->unsent_.empty())
+    this->send();
+}
+size_t APISocketClient::space() const {
+  if (this->fd_ < 0)
+    return 0;
+  size_t queued = this->unsent_.size();
+  for (auto &chunk : this->queued_)
+    queued += chunk.size;
+  if (queued >= this->send_buffer_size_)
+    return 0;
+  return this->send_buffer_size_ - queued;
+}
+bool APISocketClient::read(std::vector<uint8_t> &out) {
+  if (this->fd_ < 0)
+    return false;
+  while (true) {
+    size_t old_size = out.size();
+    out.resize(old_size + READ_CHUNK_SIZE);
+    ssize_t received = lwip_recv(this->fd_, out.data() + old_size, READ_CHUNK_SIZE, 0);
+    if (received <= 0) {
+      out.resize(old_size);
+      if (received < 0 && would_block())
+        return true;
+      // 0 means the remote side closed the connection
+      this->close(true);
+      return false;
+    }
+    out.resize(old_size + received);
+    if (size_t(received) < READ_CHUNK_SIZE)
+      return true;
+  }
+}
+void APISocketClient::close(bool now) {
+  if (this->fd_ < 0)
+    return;
+  if (!now)
+    this->flush();
+  lwip_close(this->fd_);
+  this->fd_ = -1;
+  this->unsent_.clear();
+}
+
+bool APISocketServer::begin(uint16_t port) {
+  this->fd_ = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (this->fd_ < 0) {
+    ESP_LOGE(TAG, "Could not create socket, errno %d", errno);
+    return false;
+  }
+  int enable = 1;
+  lwip_setsockopt(this->fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (lwip_bind(this->fd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      lwip_listen(this->fd_, 4) != 0 || !set_non_blocking(this->fd_)) {
+    ESP_LOGE(TAG, "Could not listen on port %u, errno %d", port, errno);
+    lwip_close(this->fd_);
+    this->fd_ = -1;
+    return false;
+  }
+  return true;
+}
+APISocketClient *APISocketServer::accept_client(size_t send_buffer_size) {
+  if (this->fd_ < 0)
+    return nullptr;
+  struct sockaddr_in addr {};
+  socklen_t addr_len = sizeof(addr);
+  int fd = lwip_accept(this->fd_, reinterpret_cast<struct sockaddr *>(&addr), &addr_len);
+  if (fd < 0)
+    return nullptr;
+  if (!set_non_blocking(fd)) {
+    lwip_close(fd);
+    return nullptr;
+  }
+  return new APISocketClient(fd, IPAddress(addr.sin_addr.s_addr), send_buffer_size);
+}
+
+}  // namespace api
+}  // namespace esphome
+
+#endif  // USE_API_SOCKET
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_API_SOCKET
+
+#include <IPAddress.h>
+#include <vector>
+
+namespace esphome {
+namespace api {
+
+/** A TCP connection on a non-blocking lwIP socket, an alternative to AsyncClient.
+ *
+ * It offers the part of the AsyncClient interface APIConnection uses, but nothing happens in a background
+ * task: received data is read with read() from the main loop, queued data is written with one writev()
+ * call in send() and whatever the TCP stack didn't accept is kept and retried in flush().
+ */
+class APISocketClient {
+ public:
+  APISocketClient(int fd, IPAddress remote_ip, size_t send_buffer_size);
+  ~APISocketClient();
+
+  /// Queue data for the next send(), the data isn't copied and must stay valid until send() returns.
+  size_t add(const char *data, size_t size, uint8_t apiflags = 0);
+  /// Write all queued data, returns false if the connection is gone.
+  bool send();
+  /// Retry writing data a previous send() couldn't hand to the TCP stack.
+  void flush();
+  /// Number of bytes that can be queued without exceeding the send buffer size.
+  size_t space() const;
+  /// Append all received data to out, returns false if the connection is gone.
+  bool read(std::vector<uint8_t> &out);
+  void close(bool now = false);
+  bool disconnected() const { return this->fd_ < 0; }
+  IPAddress remoteIP() const { return this->remote_ip_; }  // NOLINT
+
+ protected:
+  struct Chunk {
+    const uint8_t *data;
+    size_t size;
+  };
+
+  int fd_;
+  IPAddress remote_ip_;
+  size_t send_buffer_size_;
+  std::vector<Chunk> queued_;
+  /// Data written with send() that the TCP stack didn't accept yet.
+  std::vector<uint8_t> unsent_;
+};
+
+/// A listening non-blocking lwIP socket, polled for new connections.
+class APISocketServer {
+ public:
+  bool begin(uint16_t port);
+  /// Accept one pending connection, returns nullptr if there is none.
+  APISocketClient *accept_client(size_t send_buffer_size);
+
+ protected:
+  int fd_{-1};
+};
+
+}  // namespace api
+}  // namespace esphome
+
+#endif  // USE_API_SOCKET
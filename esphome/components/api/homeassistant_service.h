@@ -5,62 +5,93 @@
 #include "api_pb2.h"
 #include "api_server.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace api {
 
 template<typename... Ts> class TemplatableKeyValuePair {
  public:
-  template<typename T> TemplatableKeyValuePair(std::string key, T value) : key(std::move(key)), value(value) {}
-  std::string key;
+  template<typename T> TemplatableKeyValuePair(const char *key, T value) : key(key), value(value) {}
+  const char *key;
   TemplatableStringValue<Ts...> value;
 };
 
+/** Action that sends a service call or event to Home Assistant.
+ *
+ * The HomeassistantServiceResponse is encoded right from the templatable values into a buffer that's kept
+ * between calls, values that aren't lambdas are encoded without a copy.
+ */
 template<typename... Ts> class HomeAssistantServiceCallAction : public Action<Ts...> {
  public:
   explicit HomeAssistantServiceCallAction(APIServer *parent, bool is_event) : parent_(parent), is_event_(is_event) {}
 
   TEMPLATABLE_STRING_VALUE(service);
-  template<typename T> void add_data(std::string key, T value) {
+  template<typename T> void add_data(const char *key, T value) {
     this->data_.push_back(TemplatableKeyValuePair<Ts...>(key, value));
   }
-  template<typename T> void add_data_template(std::string key, T value) {
+  template<typename T> void add_data_template(const char *key, T value) {
     this->data_template_.push_back(TemplatableKeyValuePair<Ts...>(key, value));
   }
-  template<typename T> void add_variable(std::string key, T value) {
+  template<typename T> void add_variable(const char *key, T value) {
     this->variables_.push_back(TemplatableKeyValuePair<Ts...>(key, value));
   }
 
-  void play(Ts... x) override {
-    HomeassistantServiceResponse resp;
-    resp.service = this->service_.value(x...);
-    resp.is_event = this->is_event_;
-    for (auto &it : this->data_) {
-      HomeassistantServiceMap kv;
-      kv.key = it.key;
-      kv.value = it.value.value(x...);
-      resp.data.push_back(kv);
-    }
-    for (auto &it : this->data_template_) {
-      HomeassistantServiceMap kv;
-      kv.key = it.key;
-      kv.value = it.value.value(x...);
-      resp.data_template.push_back(kv);
-    }
-    for (auto &it : this->variables_) {
-      HomeassistantServiceMap kv;
-      kv.key = it.key;
-      kv.value = it.value.value(x...);
-      resp.variables.push_back(kv);
-    }
-    this->parent_->send_homeassistant_service_call(resp);
+  void play(const Ts &... x) override {
+    if (!this->parent_->has_service_call_subscriber())
+      return;
+
+    this->buffer_.clear();
+    ProtoWriteBuffer buffer(&this->buffer_);
+    // string service = 1;
+    const std::string &service = this->evaluate_(this->service_, x...);
+    buffer.encode_string(1, service);
+    // repeated HomeassistantServiceMap data = 2;
+    for (auto &it : this->data_)
+      this->encode_map_(buffer, 2, it, x...);
+    // repeated HomeassistantServiceMap data_template = 3;
+    for (auto &it : this->data_template_)
+      this->encode_map_(buffer, 3, it, x...);
+    // repeated HomeassistantServiceMap variables = 4;
+    for (auto &it : this->variables_)
+      this->encode_map_(buffer, 4, it, x...);
+    // bool is_event = 5;
+    buffer.encode_bool(5, this->is_event_);
+    this->parent_->send_homeassistant_service_call(this->buffer_);
   }
 
  protected:
+  /// The value of a templatable string, lambda results are stored in scratch_ until the next call.
+  const std::string &evaluate_(TemplatableStringValue<Ts...> &value, const Ts &... x) {
+    if (!value.is_lambda())
+      return value.get_static_value();
+    this->scratch_ = value.value(x...);
+    return this->scratch_;
+  }
+  /// Encode a HomeassistantServiceMap message with the key and value of pair.
+  void encode_map_(ProtoWriteBuffer &buffer, uint32_t field_id, TemplatableKeyValuePair<Ts...> &pair,
+                   const Ts &... x) {
+    const std::string &value = this->evaluate_(pair.value, x...);
+    const size_t key_len = strlen(pair.key);
+    uint32_t nested_length = 0;
+    ProtoSize::add_string_field(nested_length, 1, pair.key, key_len);
+    ProtoSize::add_string_field(nested_length, 2, value);
+    buffer.encode_field_raw(field_id, 2);
+    buffer.encode_varint_raw(nested_length);
+    // string key = 1;
+    buffer.encode_string(1, pair.key, key_len);
+    // string value = 2;
+    buffer.encode_string(2, value);
+  }
+
   APIServer *parent_;
   bool is_event_;
   std::vector<TemplatableKeyValuePair<Ts...>> data_;
   std::vector<TemplatableKeyValuePair<Ts...>> data_template_;
   std::vector<TemplatableKeyValuePair<Ts...>> variables_;
+  /// The encoded message, keeps its capacity between calls.
+  std::vector<uint8_t> buffer_;
+  std::string scratch_;
 };
 
 }  // namespace api
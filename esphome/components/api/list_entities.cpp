@@ -7,52 +7,89 @@
 namespace esphome {
 namespace api {
 
+template<typename F> bool ListEntitiesIterator::send_cached_(uint32_t message_type, F &&encode) {
+  auto &cache = this->server_->list_entities_cache_;
+  if (!this->server_->list_entities_cache_enabled_)
+    return encode();
+  if (this->cache_index_ < cache.size()) {
+    if (!this->client_->send_buffer(ProtoWriteBuffer{&cache[this->cache_index_]}, message_type))
+      return false;
+  } else {
+    if (!encode())
+      return false;
+    // The first client listing the entities fills the cache, the metadata doesn't change after boot.
+    cache.push_back(this->client_->send_buffer_);
+  }
+  this->cache_index_++;
+  return true;
+}
+
 #ifdef USE_BINARY_SENSOR
 bool ListEntitiesIterator::on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
-  return this->client_->send_binary_sensor_info(binary_sensor);
+  return this->send_cached_(12, [&] { return this->client_->send_binary_sensor_info(binary_sensor); });
 }
 #endif
 #ifdef USE_COVER
-bool ListEntitiesIterator::on_cover(cover::Cover *cover) { return this->client_->send_cover_info(cover); }
+bool ListEntitiesIterator::on_cover(cover::Cover *cover) {
+  return this->send_cached_(13, [&] { return this->client_->send_cover_info(cover); });
+}
 #endif
 #ifdef USE_FAN
-bool ListEntitiesIterator::on_fan(fan::FanState *fan) { return this->client_->send_fan_info(fan); }
+bool ListEntitiesIterator::on_fan(fan::FanState *fan) {
+  return this->send_cached_(14, [&] { return this->client_->send_fan_info(fan); });
+}
 #endif
 #ifdef USE_LIGHT
-bool ListEntitiesIterator::on_light(light::LightState *light) { return this->client_->send_light_info(light); }
+bool ListEntitiesIterator::on_light(light::LightState *light) {
+  return this->send_cached_(15, [&] { return this->client_->send_light_info(light); });
+}
 #endif
 #ifdef USE_SENSOR
-bool ListEntitiesIterator::on_sensor(sensor::Sensor *sensor) { return this->client_->send_sensor_info(sensor); }
+bool ListEntitiesIterator::on_sensor(sensor::Sensor *sensor) {
+  return this->send_cached_(16, [&] { return this->client_->send_sensor_info(sensor); });
+}
 #endif
 #ifdef USE_SWITCH
-bool ListEntitiesIterator::on_switch(switch_::Switch *a_switch) { return this->client_->send_switch_info(a_switch); }
+bool ListEntitiesIterator::on_switch(switch_::Switch *a_switch) {
+  return this->send_cached_(17, [&] { return this->client_->send_switch_info(a_switch); });
+}
 #endif
 #ifdef USE_TEXT_SENSOR
 bool ListEntitiesIterator::on_text_sensor(text_sensor::TextSensor *text_sensor) {
-  return this->client_->send_text_sensor_info(text_sensor);
+  return this->send_cached_(18, [&] { return this->client_->send_text_sensor_info(text_sensor); });
 }
 #endif
 
+bool ListEntitiesIterator::on_begin() {
+  this->cache_index_ = 0;
+  return true;
+}
 bool ListEntitiesIterator::on_end() { return this->client_->send_list_info_done(); }
 ListEntitiesIterator::ListEntitiesIterator(APIServer *server, APIConnection *client)
     : ComponentIterator(server), client_(client) {}
 bool ListEntitiesIterator::on_service(UserServiceDescriptor *service) {
-  auto resp = service->encode_list_service_response();
-  return this->client_->send_list_entities_services_response(resp);
+  return this->send_cached_(41, [&] {
+    auto resp = service->encode_list_service_response();
+    return this->client_->send_list_entities_services_response(resp);
+  });
 }
 
 #ifdef USE_ESP32_CAMERA
 bool ListEntitiesIterator::on_camera(esp32_camera::ESP32Camera *camera) {
-  return this->client_->send_camera_info(camera);
+  return this->send_cached_(43, [&] { return this->client_->send_camera_info(camera); });
 }
 #endif
 
 #ifdef USE_CLIMATE
-bool ListEntitiesIterator::on_climate(climate::Climate *climate) { return this->client_->send_climate_info(climate); }
+bool ListEntitiesIterator::on_climate(climate::Climate *climate) {
+  return this->send_cached_(46, [&] { return this->client_->send_climate_info(climate); });
+}
 #endif
 
 #ifdef USE_NUMBER
-bool ListEntitiesIterator::on_number(number::Number *number) { return this->client_->send_number_info(number); }
+bool ListEntitiesIterator::on_number(number::Number *number) {
+  return this->send_cached_(49, [&] { return this->client_->send_number_info(number); });
+}
 #endif
 
 }  // namespace api
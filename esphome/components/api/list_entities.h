@@ -12,6 +12,7 @@ class APIConnection;
 class ListEntitiesIterator : public ComponentIterator {
  public:
   ListEntitiesIterator(APIServer *server, APIConnection *client);
+  bool on_begin() override;
 #ifdef USE_BINARY_SENSOR
   bool on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) override;
 #endif
@@ -46,7 +47,11 @@ class ListEntitiesIterator : public ComponentIterator {
   bool on_end() override;
 
  protected:
+  /// Send the cached encoding of the current entity, or encode it with encode and add it to the cache.
+  template<typename F> bool send_cached_(uint32_t message_type, F &&encode);
+
   APIConnection *client_;
+  size_t cache_index_{0};
 };
 
 }  // namespace api
@@ -0,0 +1,105 @@
+#include "proto_benchmark.h"
+
+namespace esphome {
+namespace api {
+
+// Bytes of a camera image in one message, about what fits in a TCP segment
+static const size_t CAMERA_CHUNK_SIZE = 1436;
+
+static const char *const CASE_NAMES[] = {
+    "encode SensorStateResponse",        "decode SensorStateResponse",
+    "encode LightCommandRequest",        "decode LightCommandRequest",
+    "encode ListEntitiesSensorResponse", "decode ListEntitiesSensorResponse",
+    "encode CameraImageResponse",        "decode CameraImageResponse",
+};
+
+// Same as APIServerConnectionBase::send_message_()
+template<class C> static void encode_message(const C &msg, std::vector<uint8_t> &buffer) {
+  uint32_t msg_size = 0;
+  msg.calculate_size(msg_size);
+  buffer.clear();
+  buffer.reserve(msg_size);
+  msg.encode(ProtoWriteBuffer(&buffer));
+}
+
+// Same as APIServerConnectionBase::read_message(), a new message for every decode
+template<class C> static void decode_message(const std::vector<uint8_t> &buffer) {
+  C msg;
+  msg.decode(buffer.data(), buffer.size());
+}
+
+ProtoBenchmark::ProtoBenchmark() {
+  this->sensor_state_.key = 0x1F2E3D4C;
+  this->sensor_state_.state = 21.5f;
+
+  this->light_command_.key = 0x5B6A7988;
+  this->light_command_.has_state = true;
+  this->light_command_.state = true;
+  this->light_command_.has_brightness = true;
+  this->light_command_.brightness = 0.8f;
+  this->light_command_.has_rgb = true;
+  this->light_command_.red = 1.0f;
+  this->light_command_.green = 0.5f;
+  this->light_command_.blue = 0.25f;
+  this->light_command_.has_transition_length = true;
+  this->light_command_.transition_length = 1000;
+
+  this->list_entities_sensor_.object_id = "living_room_temperature";
+  this->list_entities_sensor_.key = 0x1F2E3D4C;
+  this->list_entities_sensor_.name = "Living Room Temperature";
+  this->list_entities_sensor_.unique_id = "a4cf12b3c4d5sensorliving_room_temperature";
+  this->list_entities_sensor_.icon = "mdi:thermometer";
+  this->list_entities_sensor_.unit_of_measurement = "\xc2\xb0" "C";
+  this->list_entities_sensor_.accuracy_decimals = 1;
+  this->list_entities_sensor_.device_class = "temperature";
+  this->list_entities_sensor_.state_class = enums::STATE_CLASS_MEASUREMENT;
+
+  this->camera_image_.key = 0x0A1B2C3D;
+  this->camera_image_.data.resize(CAMERA_CHUNK_SIZE);
+  for (size_t i = 0; i < CAMERA_CHUNK_SIZE; i++)
+    this->camera_image_.data[i] = char(i * 31);
+
+  encode_message(this->sensor_state_, this->encoded_[0]);
+  encode_message(this->light_command_, this->encoded_[1]);
+  encode_message(this->list_entities_sensor_, this->encoded_[2]);
+  encode_message(this->camera_image_, this->encoded_[3]);
+  this->buffer_.reserve(this->encoded_[3].size());
+}
+
+size_t ProtoBenchmark::size() const { return sizeof(CASE_NAMES) / sizeof(CASE_NAMES[0]); }
+const char *ProtoBenchmark::get_name(size_t index) const { return CASE_NAMES[index]; }
+uint32_t ProtoBenchmark::get_message_size(size_t index) const { return this->encoded_[index / 2].size(); }
+
+void ProtoBenchmark::run(size_t index) {
+  switch (index) {
+    case 0:
+      encode_message(this->sensor_state_, this->buffer_);
+      break;
+    case 1:
+      decode_message<SensorStateResponse>(this->encoded_[0]);
+      break;
+    case 2:
+      encode_message(this->light_command_, this->buffer_);
+      break;
+    case 3:
+      decode_message<LightCommandRequest>(this->encoded_[1]);
+      break;
+    case 4:
+      encode_message(this->list_entities_sensor_, this->buffer_);
+      break;
+    case 5:
+      decode_message<ListEntitiesSensorResponse>(this->encoded_[2]);
+      break;
+    case 6:
+      encode_message(this->camera_image_, this->buffer_);
+      break;
+    case 7:
+      decode_message<CameraImageResponse>(this->encoded_[3]);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace api
+}  // namespace esphome
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "api_pb2.h"
+
+#include <vector>
+
+namespace esphome {
+namespace api {
+
+/** Encodes and decodes representative messages of api_pb2 to measure their cost.
+ *
+ * Runs on the host in tests/host/benchmarks and on a device with the api_benchmark option of the debug component,
+ * so that changes to the code generated by script/api_protobuf can be compared on both.
+ */
+class ProtoBenchmark {
+ public:
+  ProtoBenchmark();
+
+  /// Number of benchmark cases.
+  size_t size() const;
+  const char *get_name(size_t index) const;
+  /// Size of the encoded message of a case in bytes.
+  uint32_t get_message_size(size_t index) const;
+  /// Run a case once, like APIConnection sends or receives the message.
+  void run(size_t index);
+
+ protected:
+  SensorStateResponse sensor_state_;
+  LightCommandRequest light_command_;
+  ListEntitiesSensorResponse list_entities_sensor_;
+  CameraImageResponse camera_image_;
+  /// The messages above encoded, the input of the decode cases.
+  std::vector<uint8_t> encoded_[4];
+  std::vector<uint8_t> buffer_;
+};
+
+}  // namespace api
+}  // namespace esphome
@@ -7,41 +7,89 @@ namespace api {
 
 #ifdef USE_BINARY_SENSOR
 bool InitialStateIterator::on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_BINARY_SENSOR, binary_sensor->get_object_id_hash()))
+    return true;
   return this->client_->send_binary_sensor_state(binary_sensor, binary_sensor->state);
 }
 #endif
 #ifdef USE_COVER
-bool InitialStateIterator::on_cover(cover::Cover *cover) { return this->client_->send_cover_state(cover); }
+bool InitialStateIterator::on_cover(cover::Cover *cover) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_COVER, cover->get_object_id_hash()))
+    return true;
+  return this->client_->send_cover_state(cover);
+}
 #endif
 #ifdef USE_FAN
-bool InitialStateIterator::on_fan(fan::FanState *fan) { return this->client_->send_fan_state(fan); }
+bool InitialStateIterator::on_fan(fan::FanState *fan) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_FAN, fan->get_object_id_hash()))
+    return true;
+  return this->client_->send_fan_state(fan);
+}
 #endif
 #ifdef USE_LIGHT
-bool InitialStateIterator::on_light(light::LightState *light) { return this->client_->send_light_state(light); }
+bool InitialStateIterator::on_light(light::LightState *light) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_LIGHT, light->get_object_id_hash()))
+    return true;
+  return this->client_->send_light_state(light);
+}
 #endif
 #ifdef USE_SENSOR
 bool InitialStateIterator::on_sensor(sensor::Sensor *sensor) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_SENSOR, sensor->get_object_id_hash()))
+    return true;
   return this->client_->send_sensor_state(sensor, sensor->state);
 }
 #endif
 #ifdef USE_SWITCH
 bool InitialStateIterator::on_switch(switch_::Switch *a_switch) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_SWITCH, a_switch->get_object_id_hash()))
+    return true;
   return this->client_->send_switch_state(a_switch, a_switch->state);
 }
 #endif
 #ifdef USE_TEXT_SENSOR
 bool InitialStateIterator::on_text_sensor(text_sensor::TextSensor *text_sensor) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_TEXT_SENSOR, text_sensor->get_object_id_hash()))
+    return true;
   return this->client_->send_text_sensor_state(text_sensor, text_sensor->state);
 }
 #endif
 #ifdef USE_CLIMATE
-bool InitialStateIterator::on_climate(climate::Climate *climate) { return this->client_->send_climate_state(climate); }
+bool InitialStateIterator::on_climate(climate::Climate *climate) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_CLIMATE, climate->get_object_id_hash()))
+    return true;
+  return this->client_->send_climate_state(climate);
+}
 #endif
 #ifdef USE_NUMBER
 bool InitialStateIterator::on_number(number::Number *number) {
+  if (!this->client_->is_state_subscribed(STATE_DOMAIN_NUMBER, number->get_object_id_hash()))
+    return true;
   return this->client_->send_number_state(number, number->state);
 }
 #endif
+uint32_t state_domain_from_name(const std::string &name) {
+  static const struct {
+    const char *name;
+    uint32_t domain;
+  } DOMAINS[] = {
+      {"binary_sensor", STATE_DOMAIN_BINARY_SENSOR},
+      {"cover", STATE_DOMAIN_COVER},
+      {"fan", STATE_DOMAIN_FAN},
+      {"light", STATE_DOMAIN_LIGHT},
+      {"sensor", STATE_DOMAIN_SENSOR},
+      {"switch", STATE_DOMAIN_SWITCH},
+      {"text_sensor", STATE_DOMAIN_TEXT_SENSOR},
+      {"camera", STATE_DOMAIN_CAMERA},
+      {"climate", STATE_DOMAIN_CLIMATE},
+      {"number", STATE_DOMAIN_NUMBER},
+  };
+  for (auto &domain : DOMAINS) {
+    if (name == domain.name)
+      return domain.domain;
+  }
+  return 0;
+}
 InitialStateIterator::InitialStateIterator(APIServer *server, APIConnection *client)
     : ComponentIterator(server), client_(client) {}
 
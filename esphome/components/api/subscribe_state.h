@@ -10,6 +10,23 @@ namespace api {
 
 class APIConnection;
 
+/// Entity domains a client can subscribe to the states of with SubscribeStatesRequest, one bit each.
+enum StateDomain : uint32_t {
+  STATE_DOMAIN_BINARY_SENSOR = 1 << 0,
+  STATE_DOMAIN_COVER = 1 << 1,
+  STATE_DOMAIN_FAN = 1 << 2,
+  STATE_DOMAIN_LIGHT = 1 << 3,
+  STATE_DOMAIN_SENSOR = 1 << 4,
+  STATE_DOMAIN_SWITCH = 1 << 5,
+  STATE_DOMAIN_TEXT_SENSOR = 1 << 6,
+  STATE_DOMAIN_CAMERA = 1 << 7,
+  STATE_DOMAIN_CLIMATE = 1 << 8,
+  STATE_DOMAIN_NUMBER = 1 << 9,
+};
+
+/// The StateDomain bit of a domain name like "sensor", 0 if the name is unknown.
+uint32_t state_domain_from_name(const std::string &name);
+
 class InitialStateIterator : public ComponentIterator {
  public:
   InitialStateIterator(APIServer *server, APIConnection *client);
@@ -10,6 +10,7 @@ from esphome.const import (
     CONF_MASK_DISTURBER,
     CONF_DIV_RATIO,
     CONF_CAPACITANCE,
+    CONF_IRQ_PIN,
 )
 
 AUTO_LOAD = ["sensor", "binary_sensor"]
@@ -20,7 +21,6 @@ CONF_AS3935_ID = "as3935_id"
 as3935_ns = cg.esphome_ns.namespace("as3935")
 AS3935 = as3935_ns.class_("AS3935Component", cg.Component)
 
-CONF_IRQ_PIN = "irq_pin"
 AS3935_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(AS3935),
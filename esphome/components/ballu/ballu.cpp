@@ -118,6 +118,8 @@ void BalluClimate::transmit_state() {
   transmit.perform();
 }
 
+remote_base::RemoteSignature BalluClimate::get_signature() { return {BALLU_HEADER_MARK, BALLU_HEADER_SPACE}; }
+
 bool BalluClimate::on_receive(remote_base::RemoteReceiveData data) {
   // Validate header
   if (!data.expect_item(BALLU_HEADER_MARK, BALLU_HEADER_SPACE)) {
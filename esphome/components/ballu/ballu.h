@@ -25,6 +25,7 @@ class BalluClimate : public climate_ir::ClimateIR {
   void transmit_state() override;
   /// Handle received IR Buffer
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  remote_base::RemoteSignature get_signature() override;
 };
 
 }  // namespace ballu
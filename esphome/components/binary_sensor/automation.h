@@ -128,7 +128,7 @@ class StateTrigger : public Trigger<bool> {
 template<typename... Ts> class BinarySensorCondition : public Condition<Ts...> {
  public:
   BinarySensorCondition(BinarySensor *parent, bool state) : parent_(parent), state_(state) {}
-  bool check(Ts... x) override { return this->parent_->state == this->state_; }
+  bool check(const Ts &... x) override { return this->parent_->state == this->state_; }
 
  protected:
   BinarySensor *parent_;
@@ -140,7 +140,7 @@ template<typename... Ts> class BinarySensorPublishAction : public Action<Ts...>
   explicit BinarySensorPublishAction(BinarySensor *sensor) : sensor_(sensor) {}
   TEMPLATABLE_VALUE(bool, state)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto val = this->state_.value(x...);
     this->sensor_->publish_state(val);
   }
@@ -7,9 +7,6 @@ namespace binary_sensor {
 
 static const char *const TAG = "binary_sensor";
 
-void BinarySensor::add_on_state_callback(std::function<void(bool)> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
 
 void BinarySensor::publish_state(bool state) {
   if (!this->publish_dedup_.next(state))
@@ -44,10 +41,10 @@ void BinarySensor::send_state_internal(bool state, bool is_initial) {
 std::string BinarySensor::device_class() { return ""; }
 BinarySensor::BinarySensor(const std::string &name) : Nameable(name), state(false) {}
 BinarySensor::BinarySensor() : BinarySensor("") {}
-void BinarySensor::set_device_class(const std::string &device_class) { this->device_class_ = device_class; }
+void BinarySensor::set_device_class(const char *device_class) { this->device_class_ = device_class; }
 std::string BinarySensor::get_device_class() {
-  if (this->device_class_.has_value())
-    return *this->device_class_;
+  if (this->device_class_ != nullptr)
+    return this->device_class_;
   return this->device_class();
 }
 void BinarySensor::add_filter(Filter *filter) {
@@ -35,7 +35,9 @@ class BinarySensor : public Nameable {
    *
    * @param callback The void(bool) callback.
    */
-  void add_on_state_callback(std::function<void(bool)> &&callback);
+  template<typename F> void add_on_state_callback(F &&callback) {
+    this->state_callback_.add(std::forward<F>(callback));
+  }
 
   /** Publish a new state to the front-end.
    *
@@ -54,7 +56,7 @@ class BinarySensor : public Nameable {
   bool state;
 
   /// Manually set the Home Assistant device class (see binary_sensor::device_class)
-  void set_device_class(const std::string &device_class);
+  void set_device_class(const char *device_class);
 
   /// Get the device class for this binary sensor, using the manual override if specified.
   std::string get_device_class();
@@ -80,7 +82,7 @@ class BinarySensor : public Nameable {
   uint32_t hash_base() override;
 
   CallbackManager<void(bool)> state_callback_{};
-  optional<std::string> device_class_{};  ///< Stores the override of the device class
+  const char *device_class_{nullptr};  ///< Stores the override of the device class, nullptr if not set
   Filter *filter_list_{nullptr};
   bool has_state_{false};
   Deduplicator<bool> publish_dedup_;
@@ -26,38 +26,41 @@ void Filter::input(bool value, bool is_initial) {
   }
 }
 
-DelayedOnOffFilter::DelayedOnOffFilter(uint32_t delay) : delay_(delay) {}
+DelayedOnOffFilter::DelayedOnOffFilter(uint32_t delay)
+    : delay_(delay), timer_([this]() { this->output(this->pending_value_, this->pending_initial_); }) {}
 optional<bool> DelayedOnOffFilter::new_value(bool value, bool is_initial) {
-  if (value) {
-    this->set_timeout("ON_OFF", this->delay_, [this, is_initial]() { this->output(true, is_initial); });
-  } else {
-    this->set_timeout("ON_OFF", this->delay_, [this, is_initial]() { this->output(false, is_initial); });
-  }
+  this->pending_value_ = value;
+  this->pending_initial_ = is_initial;
+  this->timer_.start(this->delay_);
   return {};
 }
 
 float DelayedOnOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
-DelayedOnFilter::DelayedOnFilter(uint32_t delay) : delay_(delay) {}
+DelayedOnFilter::DelayedOnFilter(uint32_t delay)
+    : delay_(delay), timer_([this]() { this->output(true, this->pending_initial_); }) {}
 optional<bool> DelayedOnFilter::new_value(bool value, bool is_initial) {
   if (value) {
-    this->set_timeout("ON", this->delay_, [this, is_initial]() { this->output(true, is_initial); });
+    this->pending_initial_ = is_initial;
+    this->timer_.start(this->delay_);
     return {};
   } else {
-    this->cancel_timeout("ON");
+    this->timer_.stop();
     return false;
   }
 }
 
 float DelayedOnFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
-DelayedOffFilter::DelayedOffFilter(uint32_t delay) : delay_(delay) {}
+DelayedOffFilter::DelayedOffFilter(uint32_t delay)
+    : delay_(delay), timer_([this]() { this->output(false, this->pending_initial_); }) {}
 optional<bool> DelayedOffFilter::new_value(bool value, bool is_initial) {
   if (!value) {
-    this->set_timeout("OFF", this->delay_, [this, is_initial]() { this->output(false, is_initial); });
+    this->pending_initial_ = is_initial;
+    this->timer_.start(this->delay_);
     return {};
   } else {
-    this->cancel_timeout("OFF");
+    this->timer_.stop();
     return true;
   }
 }
@@ -66,7 +69,10 @@ float DelayedOffFilter::get_setup_priority() const { return setup_priority::HARD
 
 optional<bool> InvertFilter::new_value(bool value, bool is_initial) { return !value; }
 
-AutorepeatFilter::AutorepeatFilter(std::vector<AutorepeatFilterTiming> timings) : timings_(std::move(timings)) {}
+AutorepeatFilter::AutorepeatFilter(std::vector<AutorepeatFilterTiming> timings)
+    : timings_(std::move(timings)),
+      timing_timer_([this]() { this->next_timing_(); }),
+      on_off_timer_([this]() { this->next_value_(this->next_on_off_value_); }) {}
 
 optional<bool> AutorepeatFilter::new_value(bool value, bool is_initial) {
   if (value) {
@@ -77,8 +83,8 @@ optional<bool> AutorepeatFilter::new_value(bool value, bool is_initial) {
     this->next_timing_();
     return true;
   } else {
-    this->cancel_timeout("TIMING");
-    this->cancel_timeout("ON_OFF");
+    this->timing_timer_.stop();
+    this->on_off_timer_.stop();
     this->active_timing_ = 0;
     return false;
   }
@@ -90,7 +96,7 @@ void AutorepeatFilter::next_timing_() {
   // 2nd time: starts waiting the second delay and starts toggling with the first time_off / _on
   // last time: no delay to start but have to bump the index to reflect the last
   if (this->active_timing_ < this->timings_.size())
-    this->set_timeout("TIMING", this->timings_[this->active_timing_].delay, [this]() { this->next_timing_(); });
+    this->timing_timer_.start(this->timings_[this->active_timing_].delay);
 
   if (this->active_timing_ <= this->timings_.size()) {
     this->active_timing_++;
@@ -105,7 +111,8 @@ void AutorepeatFilter::next_timing_() {
 void AutorepeatFilter::next_value_(bool val) {
   const AutorepeatFilterTiming &timing = this->timings_[this->active_timing_ - 2];
   this->output(val, false);  // This is at least the second one so not initial
-  this->set_timeout("ON_OFF", val ? timing.time_on : timing.time_off, [this, val]() { this->next_value_(!val); });
+  this->next_on_off_value_ = !val;
+  this->on_off_timer_.start(val ? timing.time_on : timing.time_off);
 }
 
 float AutorepeatFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
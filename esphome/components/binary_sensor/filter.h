@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/timer_wheel.h"
 
 namespace esphome {
 
@@ -35,6 +36,9 @@ class DelayedOnOffFilter : public Filter, public Component {
 
  protected:
   uint32_t delay_;
+  WheelTimer timer_;
+  bool pending_value_{false};
+  bool pending_initial_{false};
 };
 
 class DelayedOnFilter : public Filter, public Component {
@@ -47,6 +51,8 @@ class DelayedOnFilter : public Filter, public Component {
 
  protected:
   uint32_t delay_;
+  WheelTimer timer_;
+  bool pending_initial_{false};
 };
 
 class DelayedOffFilter : public Filter, public Component {
@@ -59,6 +65,8 @@ class DelayedOffFilter : public Filter, public Component {
 
  protected:
   uint32_t delay_;
+  WheelTimer timer_;
+  bool pending_initial_{false};
 };
 
 class InvertFilter : public Filter {
@@ -91,6 +99,9 @@ class AutorepeatFilter : public Filter, public Component {
 
   std::vector<AutorepeatFilterTiming> timings_;
   uint8_t active_timing_{0};
+  WheelTimer timing_timer_;
+  WheelTimer on_off_timer_;
+  bool next_on_off_value_{false};
 };
 
 class LambdaFilter : public Filter {
@@ -19,12 +19,30 @@ void BLEClient::setup() {
   }
   this->set_states(espbt::ClientState::Idle);
   this->enabled = true;
+
+  if (this->cache_services_) {
+    uint32_t hash = fnv1_hash("ble_client_" + this->address_str());
+    this->attribute_cache_pref_ = global_preferences.make_preference<BLEClientAttributeCache>(hash);
+    if (!this->attribute_cache_pref_.load(&this->attribute_cache_) ||
+        this->attribute_cache_.count > BLE_CLIENT_MAX_CACHED_ATTRIBUTES)
+      this->attribute_cache_.count = 0;
+  }
 }
 
 void BLEClient::loop() {
   if (this->state() == espbt::ClientState::Discovered) {
     this->connect();
   }
+  if (this->cached_search_pending_) {
+    this->cached_search_pending_ = false;
+    if (this->state() == espbt::ClientState::Connecting) {
+      // Hand the nodes the cached handles as if the service discovery just completed
+      esp_ble_gattc_cb_param_t param{};
+      param.search_cmpl.status = ESP_GATT_OK;
+      param.search_cmpl.conn_id = this->conn_id;
+      this->gattc_event_handler(ESP_GATTC_SEARCH_CMPL_EVT, this->gattc_if, &param);
+    }
+  }
   for (auto *node : this->nodes_)
     node->loop();
 }
@@ -32,6 +50,8 @@ void BLEClient::loop() {
 void BLEClient::dump_config() {
   ESP_LOGCONFIG(TAG, "BLE Client:");
   ESP_LOGCONFIG(TAG, "  Address: %s", this->address_str().c_str());
+  if (this->cache_services_)
+    ESP_LOGCONFIG(TAG, "  Cached Attributes: %u", this->attribute_cache_.count);
 }
 
 bool BLEClient::parse_device(const espbt::ESPBTDevice &device) {
@@ -130,6 +150,13 @@ void BLEClient::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t es
         break;
       }
       ESP_LOGV(TAG, "cfg_mtu status %d, mtu %d", param->cfg_mtu.status, param->cfg_mtu.mtu);
+      if (this->cache_services_ && this->attribute_cache_.count != 0) {
+        ESP_LOGV(TAG, "[%s] Using %u cached attributes", this->address_str().c_str(), this->attribute_cache_.count);
+        this->restore_services_();
+        this->cached_search_pending_ = true;
+        break;
+      }
+      this->services_from_cache_ = false;
       esp_ble_gattc_search_service(esp_gattc_if, param->cfg_mtu.conn_id, NULL);
       break;
     }
@@ -141,6 +168,8 @@ void BLEClient::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t es
       for (auto &svc : this->services_)
         delete svc;
       this->services_.clear();
+      this->services_from_cache_ = false;
+      this->cached_search_pending_ = false;
       this->set_states(espbt::ClientState::Idle);
       break;
     }
@@ -155,11 +184,14 @@ void BLEClient::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t es
     }
     case ESP_GATTC_SEARCH_CMPL_EVT: {
       ESP_LOGV(TAG, "[%s] ESP_GATTC_SEARCH_CMPL_EVT", this->address_str().c_str());
-      for (auto &svc : this->services_) {
-        ESP_LOGI(TAG, "Service UUID: %s", svc->uuid.to_string().c_str());
-        ESP_LOGI(TAG, "  start_handle: 0x%x  end_handle: 0x%x", svc->start_handle, svc->end_handle);
-        svc->parse_characteristics();
+      if (!this->services_from_cache_) {
+        for (auto &svc : this->services_) {
+          ESP_LOGI(TAG, "Service UUID: %s", svc->uuid.to_string().c_str());
+          ESP_LOGI(TAG, "  start_handle: 0x%x  end_handle: 0x%x", svc->start_handle, svc->end_handle);
+          svc->parse_characteristics();
+        }
       }
+      this->attribute_cache_miss_ = false;
       this->set_states(espbt::ClientState::Connected);
       this->set_state(espbt::ClientState::Established);
       break;
@@ -184,6 +216,20 @@ void BLEClient::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t es
       }
       break;
     }
+    case ESP_GATTC_READ_CHAR_EVT:
+    case ESP_GATTC_READ_DESCR_EVT:
+    case ESP_GATTC_WRITE_CHAR_EVT:
+    case ESP_GATTC_WRITE_DESCR_EVT: {
+      bool read = event == ESP_GATTC_READ_CHAR_EVT || event == ESP_GATTC_READ_DESCR_EVT;
+      esp_gatt_status_t status = read ? param->read.status : param->write.status;
+      if (!this->services_from_cache_ || status != ESP_GATT_INVALID_HANDLE)
+        break;
+      // The device no longer has the attribute layout we stored, for example after a firmware update
+      ESP_LOGW(TAG, "[%s] Cached attributes are stale, reconnecting", this->address_str().c_str());
+      this->invalidate_attribute_cache_();
+      esp_ble_gattc_close(this->gattc_if, this->conn_id);
+      break;
+    }
 
     default:
       break;
@@ -191,6 +237,28 @@ void BLEClient::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t es
   for (auto *node : this->nodes_)
     node->gattc_event_handler(event, esp_gattc_if, param);
 
+  if (event == ESP_GATTC_SEARCH_CMPL_EVT && this->cache_services_) {
+    if (this->services_from_cache_ && this->attribute_cache_miss_) {
+      ESP_LOGD(TAG, "[%s] Cached attributes are incomplete, discovering services", this->address_str().c_str());
+      this->invalidate_attribute_cache_();
+      for (auto &svc : this->services_)
+        delete svc;
+      this->services_.clear();
+      this->services_from_cache_ = false;
+      this->set_states(espbt::ClientState::Connecting);
+      esp_ble_gattc_search_service(this->gattc_if, this->conn_id, NULL);
+      return;
+    }
+    if (!this->services_from_cache_) {
+      // Attributes that did not fit would be missed on every cached connection
+      if (this->attribute_cache_miss_)
+        this->attribute_cache_.count = 0;
+      if (this->attribute_cache_dirty_ || this->attribute_cache_miss_)
+        this->attribute_cache_pref_.save(&this->attribute_cache_);
+      this->attribute_cache_dirty_ = false;
+    }
+  }
+
   // Delete characteristics after clients have used them to save RAM.
   if (!all_established && this->all_nodes_established()) {
     for (auto &svc : this->services_)
@@ -260,9 +328,14 @@ BLEService *BLEClient::get_service(uint16_t uuid) { return this->get_service(esp
 
 BLECharacteristic *BLEClient::get_characteristic(espbt::ESPBTUUID service, espbt::ESPBTUUID chr) {
   auto svc = this->get_service(service);
-  if (svc == nullptr)
+  auto ch = svc == nullptr ? nullptr : svc->get_characteristic(chr);
+  if (ch == nullptr) {
+    if (this->services_from_cache_)
+      this->attribute_cache_miss_ = true;
     return nullptr;
-  return svc->get_characteristic(chr);
+  }
+  this->cache_attribute_(ch, nullptr);
+  return ch;
 }
 
 BLECharacteristic *BLEClient::get_characteristic(uint16_t service, uint16_t chr) {
@@ -292,12 +365,15 @@ BLECharacteristic *BLEService::get_characteristic(uint16_t uuid) {
 
 BLEDescriptor *BLEClient::get_descriptor(espbt::ESPBTUUID service, espbt::ESPBTUUID chr, espbt::ESPBTUUID descr) {
   auto svc = this->get_service(service);
-  if (svc == nullptr)
-    return nullptr;
-  auto ch = svc->get_characteristic(chr);
-  if (ch == nullptr)
+  auto ch = svc == nullptr ? nullptr : svc->get_characteristic(chr);
+  auto desc = ch == nullptr ? nullptr : ch->get_descriptor(descr);
+  if (desc == nullptr) {
+    if (this->services_from_cache_)
+      this->attribute_cache_miss_ = true;
     return nullptr;
-  return ch->get_descriptor(descr);
+  }
+  this->cache_attribute_(ch, desc);
+  return desc;
 }
 
 BLEDescriptor *BLEClient::get_descriptor(uint16_t service, uint16_t chr, uint16_t descr) {
@@ -305,6 +381,89 @@ BLEDescriptor *BLEClient::get_descriptor(uint16_t service, uint16_t chr, uint16_
                               espbt::ESPBTUUID::from_uint16(descr));
 }
 
+void BLEClient::cache_attribute_(BLECharacteristic *chr, BLEDescriptor *descr) {
+  if (!this->cache_services_ || this->services_from_cache_)
+    return;
+  this->store_cached_attribute_(chr, nullptr);
+  // The client config descriptor is needed later to enable notifications
+  auto config = chr->get_descriptor(ESP_GATT_UUID_CHAR_CLIENT_CONFIG);
+  if (config != nullptr)
+    this->store_cached_attribute_(chr, config);
+  if (descr != nullptr)
+    this->store_cached_attribute_(chr, descr);
+}
+
+void BLEClient::store_cached_attribute_(BLECharacteristic *chr, BLEDescriptor *descr) {
+  uint16_t handle = descr == nullptr ? chr->handle : descr->handle;
+  for (uint8_t i = 0; i < this->attribute_cache_.count; i++) {
+    if (this->attribute_cache_.attributes[i].handle == handle)
+      return;
+  }
+  if (this->attribute_cache_.count == BLE_CLIENT_MAX_CACHED_ATTRIBUTES) {
+    this->attribute_cache_miss_ = true;
+    return;
+  }
+  BLEClientCachedAttribute &attr = this->attribute_cache_.attributes[this->attribute_cache_.count++];
+  attr.service = chr->service->uuid.get_uuid();
+  attr.characteristic = chr->uuid.get_uuid();
+  attr.descriptor = descr == nullptr ? esp_bt_uuid_t{} : descr->uuid.get_uuid();
+  attr.handle = handle;
+  attr.properties = chr->properties;
+  this->attribute_cache_dirty_ = true;
+}
+
+void BLEClient::restore_services_() {
+  for (auto &svc : this->services_)
+    delete svc;
+  this->services_.clear();
+  // Characteristics first, so every descriptor finds its characteristic
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    for (uint8_t i = 0; i < this->attribute_cache_.count; i++) {
+      const BLEClientCachedAttribute &attr = this->attribute_cache_.attributes[i];
+      bool is_descriptor = attr.descriptor.len != 0;
+      if (is_descriptor != (pass == 1))
+        continue;
+      auto service_uuid = espbt::ESPBTUUID::from_uuid(attr.service);
+      BLEService *svc = this->get_service(service_uuid);
+      if (svc == nullptr) {
+        svc = new BLEService();
+        svc->uuid = service_uuid;
+        svc->start_handle = 0;
+        svc->end_handle = 0;
+        svc->client = this;
+        this->services_.push_back(svc);
+      }
+      auto char_uuid = espbt::ESPBTUUID::from_uuid(attr.characteristic);
+      BLECharacteristic *chr = svc->get_characteristic(char_uuid);
+      if (!is_descriptor) {
+        if (chr == nullptr) {
+          chr = new BLECharacteristic();
+          chr->uuid = char_uuid;
+          chr->handle = attr.handle;
+          chr->properties = attr.properties;
+          chr->service = svc;
+          svc->characteristics.push_back(chr);
+        }
+        continue;
+      }
+      if (chr == nullptr)
+        continue;
+      BLEDescriptor *desc = new BLEDescriptor();
+      desc->uuid = espbt::ESPBTUUID::from_uuid(attr.descriptor);
+      desc->handle = attr.handle;
+      desc->characteristic = chr;
+      chr->descriptors.push_back(desc);
+    }
+  }
+  this->services_from_cache_ = true;
+}
+
+void BLEClient::invalidate_attribute_cache_() {
+  this->attribute_cache_.count = 0;
+  this->attribute_cache_dirty_ = false;
+  this->attribute_cache_pref_.save(&this->attribute_cache_);
+}
+
 BLEService::~BLEService() {
   for (auto &chr : this->characteristics)
     delete chr;
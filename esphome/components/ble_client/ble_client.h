@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
 #include "esphome/components/esp32_ble_tracker/esp32_ble_tracker.h"
 
 #ifdef ARDUINO_ARCH_ESP32
@@ -76,6 +77,26 @@ class BLEService {
   BLECharacteristic *get_characteristic(uint16_t uuid);
 };
 
+static const uint8_t BLE_CLIENT_MAX_CACHED_ATTRIBUTES = 8;
+
+/// A characteristic (descriptor.len == 0) or descriptor a node looked up during service discovery.
+struct BLEClientCachedAttribute {
+  esp_bt_uuid_t service;
+  esp_bt_uuid_t characteristic;
+  esp_bt_uuid_t descriptor;
+  uint16_t handle;
+  esp_gatt_char_prop_t properties;
+};
+
+/** The attributes the nodes of a client used, stored in preferences keyed by the device address.
+ *
+ * With this, a reconnect can skip the service discovery and hand the nodes the stored handles instead.
+ */
+struct BLEClientAttributeCache {
+  uint8_t count;
+  BLEClientCachedAttribute attributes[BLE_CLIENT_MAX_CACHED_ATTRIBUTES];
+};
+
 class BLEClient : public espbt::ESPBTClient, public Component {
  public:
   void setup() override;
@@ -90,6 +111,7 @@ class BLEClient : public espbt::ESPBTClient, public Component {
   void set_address(uint64_t address) { this->address = address; }
 
   void set_enabled(bool enabled);
+  void set_cache_services(bool cache_services) { this->cache_services_ = cache_services; }
 
   void register_ble_node(BLEClientNode *node) {
     node->client = this;
@@ -130,8 +152,26 @@ class BLEClient : public espbt::ESPBTClient, public Component {
     return true;
   }
 
+  /// Remember a characteristic (and descriptor, if not null) a node looked up during a full discovery.
+  void cache_attribute_(BLECharacteristic *chr, BLEDescriptor *descr);
+  void store_cached_attribute_(BLECharacteristic *chr, BLEDescriptor *descr);
+  /// Rebuild the services the nodes need from the attribute cache.
+  void restore_services_();
+  /// Forget the cached attributes, the next connection discovers the services again.
+  void invalidate_attribute_cache_();
+
   std::vector<BLEClientNode *> nodes_;
   std::vector<BLEService *> services_;
+
+  bool cache_services_{true};
+  BLEClientAttributeCache attribute_cache_{};
+  ESPPreferenceObject attribute_cache_pref_;
+  bool attribute_cache_dirty_{false};
+  /// The attribute cache was full or a node looked up something it does not contain.
+  bool attribute_cache_miss_{false};
+  /// The services of this connection came from the cache, not from a discovery.
+  bool services_from_cache_{false};
+  bool cached_search_pending_{false};
 };
 
 }  // namespace ble_client
@@ -93,6 +93,7 @@ void BLESensor::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t ga
         break;
       ESP_LOGV(TAG, "[%s] ESP_GATTC_NOTIFY_EVT: handle=0x%x, value=0x%x", this->get_name().c_str(),
                param->notify.handle, param->notify.value[0]);
+      this->notified_ = true;
       this->publish_state(this->parse_data(param->notify.value, param->notify.value_len));
       break;
     }
@@ -123,6 +124,11 @@ void BLESensor::update() {
     ESP_LOGW(TAG, "[%s] Cannot poll, no service or characteristic found", this->get_name().c_str());
     return;
   }
+  if (this->notified_) {
+    // The device pushed a value since the last poll, reading it again would only cost airtime
+    this->notified_ = false;
+    return;
+  }
 
   auto status =
       esp_ble_gattc_read_char(this->parent()->gattc_if, this->parent()->conn_id, this->handle, ESP_GATT_AUTH_REQ_NONE);
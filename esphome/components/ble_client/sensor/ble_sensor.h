@@ -41,6 +41,7 @@ class BLESensor : public sensor::Sensor, public PollingComponent, public BLEClie
   float parse_data(uint8_t *value, uint16_t value_len);
   optional<data_to_value_t> data_to_value_func_{};
   bool notify_;
+  bool notified_{false};
   espbt::ESPBTUUID service_uuid_;
   espbt::ESPBTUUID char_uuid_;
   espbt::ESPBTUUID descr_uuid_;
@@ -5,6 +5,13 @@ namespace esphome {
 namespace canbus {
 
 static const char *const TAG = "canbus";
+/// Frames handled per loop, so that a busy bus can't block the other components.
+static const uint8_t MAX_FRAMES_PER_LOOP = 16;
+/// Frames that can wait for a free TX buffer.
+static const size_t TX_QUEUE_SIZE = 64;
+/// ISO-TP protocol control information, in the upper nibble of the first data byte.
+static const uint8_t ISOTP_FIRST_FRAME = 0x10;
+static const uint8_t ISOTP_CONSECUTIVE_FRAME = 0x20;
 
 void Canbus::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Canbus...");
@@ -25,24 +32,62 @@ void Canbus::dump_config() {
 void Canbus::send_data(uint32_t can_id, bool use_extended_id, const std::vector<uint8_t> &data) {
   struct CanFrame can_message;
 
-  uint8_t size = static_cast<uint8_t>(data.size());
+  size_t size = data.size();
   if (use_extended_id) {
-    ESP_LOGD(TAG, "send extended id=0x%08x size=%d", can_id, size);
+    ESP_LOGD(TAG, "send extended id=0x%08x size=%zu", can_id, size);
   } else {
-    ESP_LOGD(TAG, "send extended id=0x%03x size=%d", can_id, size);
+    ESP_LOGD(TAG, "send extended id=0x%03x size=%zu", can_id, size);
   }
-  if (size > CAN_MAX_DATA_LENGTH)
-    size = CAN_MAX_DATA_LENGTH;
-  can_message.can_data_length_code = size;
   can_message.can_id = can_id;
   can_message.use_extended_id = use_extended_id;
 
-  for (int i = 0; i < size; i++) {
-    can_message.data[i] = data[i];
-    ESP_LOGVV(TAG, "  data[%d]=%02x", i, can_message.data[i]);
+  // A first frame carries 6 bytes of data, each consecutive frame 7, and 12 bits encode the length
+  if (size > 0xFFF) {
+    ESP_LOGW(TAG, "Data of %zu bytes is too long to send", size);
+    return;
   }
+  size_t frames = size <= CAN_MAX_DATA_LENGTH ? 1 : 1 + (size - 6 + 7 - 1) / 7;
+  if (frames > TX_QUEUE_SIZE - this->tx_queue_.size()) {
+    ESP_LOGW(TAG, "TX queue full, dropping %zu bytes for id=0x%x", size, can_id);
+    return;
+  }
+
+  if (size <= CAN_MAX_DATA_LENGTH) {
+    can_message.can_data_length_code = size;
+    for (size_t i = 0; i < size; i++) {
+      can_message.data[i] = data[i];
+      ESP_LOGVV(TAG, "  data[%zu]=%02x", i, can_message.data[i]);
+    }
+    this->tx_queue_.push_back(can_message);
+  } else {
+    can_message.can_data_length_code = CAN_MAX_DATA_LENGTH;
+    can_message.data[0] = ISOTP_FIRST_FRAME | ((size >> 8) & 0x0F);
+    can_message.data[1] = size & 0xFF;
+    std::copy(data.begin(), data.begin() + 6, can_message.data + 2);
+    this->tx_queue_.push_back(can_message);
 
-  this->send_message(&can_message);
+    uint8_t sequence = 1;
+    for (size_t offset = 6; offset < size; offset += 7) {
+      size_t chunk = std::min<size_t>(7, size - offset);
+      can_message.can_data_length_code = 1 + chunk;
+      can_message.data[0] = ISOTP_CONSECUTIVE_FRAME | (sequence++ & 0x0F);
+      std::copy(data.begin() + offset, data.begin() + offset + chunk, can_message.data + 1);
+      this->tx_queue_.push_back(can_message);
+    }
+  }
+
+  this->process_tx_queue_();
+}
+
+void Canbus::process_tx_queue_() {
+  while (!this->tx_queue_.empty()) {
+    Error error = this->send_message(&this->tx_queue_.front());
+    if (error == ERROR_ALLTXBUSY)
+      return;  // retried from the next loop
+    if (error != ERROR_OK)
+      ESP_LOGW(TAG, "Sending frame id=0x%x failed: %d", this->tx_queue_.front().can_id, error);
+    this->tx_queue_.pop_front();
+  }
 }
 
 void Canbus::add_trigger(CanbusTrigger *trigger) {
@@ -55,9 +100,11 @@ void Canbus::add_trigger(CanbusTrigger *trigger) {
 };
 
 void Canbus::loop() {
+  this->process_tx_queue_();
+
   struct CanFrame can_message;
-  // readmessage
-  if (this->read_message(&can_message) == canbus::ERROR_OK) {
+  // read all received messages
+  for (uint8_t i = 0; i < MAX_FRAMES_PER_LOOP && this->read_message(&can_message) == canbus::ERROR_OK; i++) {
     if (can_message.use_extended_id) {
       ESP_LOGD(TAG, "received can message extended can_id=0x%x size=%d", can_message.can_id,
                can_message.can_data_length_code);
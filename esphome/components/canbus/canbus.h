@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/optional.h"
@@ -62,6 +63,11 @@ class Canbus : public Component {
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
   void loop() override;
 
+  /** Queue data for sending, it goes out from loop() as soon as the controller has a free TX buffer.
+   *
+   * Data longer than one frame is split ISO-TP style (ISO 15765-2) into a first frame and consecutive frames. These
+   * are sent back to back, without waiting for a flow control frame of the receiver.
+   */
   void send_data(uint32_t can_id, bool use_extended_id, const std::vector<uint8_t> &data);
   void set_can_id(uint32_t can_id) { this->can_id_ = can_id; }
   void set_use_extended_id(bool use_extended_id) { this->use_extended_id_ = use_extended_id; }
@@ -72,11 +78,16 @@ class Canbus : public Component {
  protected:
   template<typename... Ts> friend class CanbusSendAction;
   std::vector<CanbusTrigger *> triggers_{};
+  /// Frames waiting for a free TX buffer, oldest first.
+  std::deque<CanFrame> tx_queue_{};
   uint32_t can_id_;
   bool use_extended_id_;
   CanSpeed bit_rate_;
 
   virtual bool setup_internal();
+  /// Hand the queued frames to the controller until all its TX buffers are busy.
+  void process_tx_queue_();
+  /// Send a frame, returns ERROR_ALLTXBUSY to retry it later.
   virtual Error send_message(struct CanFrame *frame);
   virtual Error read_message(struct CanFrame *frame);
 };
@@ -96,7 +107,7 @@ template<typename... Ts> class CanbusSendAction : public Action<Ts...>, public P
 
   void set_use_extended_id(bool use_extended_id) { this->use_extended_id_ = use_extended_id; }
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto can_id = this->can_id_.has_value() ? *this->can_id_ : this->parent_->can_id_;
     auto use_extended_id =
         this->use_extended_id_.has_value() ? *this->use_extended_id_ : this->parent_->use_extended_id_;
@@ -123,6 +134,8 @@ class CanbusTrigger : public Trigger<std::vector<uint8_t>>, public Component {
   explicit CanbusTrigger(Canbus *parent, const std::uint32_t can_id, const bool use_extended_id)
       : parent_(parent), can_id_(can_id), use_extended_id_(use_extended_id){};
   void setup() override { this->parent_->add_trigger(this); }
+  uint32_t get_can_id() const { return this->can_id_; }
+  bool get_use_extended_id() const { return this->use_extended_id_; }
 
  protected:
   Canbus *parent_;
@@ -1,17 +1,33 @@
+import os
+
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import web_server_base
-from esphome.components.web_server_base import CONF_WEB_SERVER_BASE_ID
+from esphome.components.web_server_base import (
+    CONF_WEB_SERVER_BASE_ID,
+    compressed_include,
+)
 from esphome.const import CONF_ID
-from esphome.core import coroutine_with_priority
+from esphome.core import ID, coroutine_with_priority
 
-AUTO_LOAD = ["web_server_base"]
+AUTO_LOAD = ["json", "web_server_base"]
 DEPENDENCIES = ["wifi"]
 CODEOWNERS = ["@OttoWinter"]
 
 captive_portal_ns = cg.esphome_ns.namespace("captive_portal")
 CaptivePortal = captive_portal_ns.class_("CaptivePortal", cg.Component)
 
+# Files next to this module that are served gzip compressed, with their content type
+ASSETS = {
+    "index.html": "text/html",
+    "stylesheet.css": "text/css",
+    "lock.svg": "image/svg+xml",
+    "wifi-strength-1.svg": "image/svg+xml",
+    "wifi-strength-2.svg": "image/svg+xml",
+    "wifi-strength-3.svg": "image/svg+xml",
+    "wifi-strength-4.svg": "image/svg+xml",
+}
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(CaptivePortal),
@@ -29,3 +45,13 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID], paren)
     await cg.register_component(var, config)
     cg.add_define("USE_CAPTIVE_PORTAL")
+
+    for name, content_type in ASSETS.items():
+        id_ = ID(
+            "captive_portal_" + name.replace(".", "_").replace("-", "_"),
+            is_declaration=True,
+            type=cg.uint8,
+        )
+        path = os.path.join(os.path.dirname(__file__), name)
+        arr, size = compressed_include(id_, path)
+        cg.add(var.add_asset("/" + name, content_type, arr, size))
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <DNSServer.h>
+#include <string>
+#include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
@@ -29,33 +31,30 @@ class CaptivePortal : public AsyncWebHandler, public Component {
     delete this->dns_server_;
   }
 
+  /** Serve a gzip compressed file from PROGMEM under url, with an ETag so clients only download it once per firmware.
+   *
+   * The index page is static as well, it loads the networks from /config.json.
+   */
+  void add_asset(const char *url, const char *content_type, const uint8_t *data, size_t size) {
+    this->assets_.push_back(Asset{url, content_type, data, size});
+  }
+
   bool canHandle(AsyncWebServerRequest *request) override {
     if (!this->active_)
       return false;
 
     if (request->method() == HTTP_GET) {
-      if (request->url() == "/")
-        return true;
-      if (request->url() == "/stylesheet.css")
-        return true;
-      if (request->url() == "/wifi-strength-1.svg")
-        return true;
-      if (request->url() == "/wifi-strength-2.svg")
-        return true;
-      if (request->url() == "/wifi-strength-3.svg")
-        return true;
-      if (request->url() == "/wifi-strength-4.svg")
-        return true;
-      if (request->url() == "/lock.svg")
+      if (request->url() == "/config.json")
         return true;
       if (request->url() == "/wifisave")
         return true;
+      return this->find_asset_(request->url()) != nullptr;
     }
 
     return false;
   }
 
-  void handle_index(AsyncWebServerRequest *request);
+  void handle_config(AsyncWebServerRequest *request);
 
   void handle_wifisave(AsyncWebServerRequest *request);
 
@@ -66,6 +65,19 @@ class CaptivePortal : public AsyncWebHandler, public Component {
   bool initialized_{false};
   bool active_{false};
   DNSServer *dns_server_{nullptr};
+
+  struct Asset {
+    const char *url;
+    const char *content_type;
+    const uint8_t *data;
+    size_t size;
+  };
+  const Asset *find_asset_(const String &url) const;
+  std::vector<Asset> assets_;
+  std::string etag_;
+  /// The JSON of /config.json, rebuilt when the scan results changed since.
+  std::string config_json_;
+  uint32_t config_json_version_{0};
 };
 
 extern CaptivePortal *global_captive_portal;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
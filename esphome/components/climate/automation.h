@@ -21,7 +21,7 @@ template<typename... Ts> class ControlAction : public Action<Ts...> {
   TEMPLATABLE_VALUE(std::string, custom_preset)
   TEMPLATABLE_VALUE(ClimateSwingMode, swing_mode)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto call = this->climate_->make_call();
     call.set_mode(this->mode_.optional_value(x...));
     call.set_target_temperature(this->target_temperature_.optional_value(x...));
@@ -308,9 +308,6 @@ ClimateCall &ClimateCall::set_swing_mode(optional<ClimateSwingMode> swing_mode)
   return *this;
 }
 
-void Climate::add_on_state_callback(std::function<void()> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
 
 optional<ClimateDeviceRestoreState> Climate::restore_state_() {
   this->rtc_ = global_preferences.make_preference<ClimateDeviceRestoreState>(this->get_object_id_hash());
@@ -102,6 +102,8 @@ void LgIrClimate::transmit_state() {
   this->publish_state();
 }
 
+remote_base::RemoteSignature LgIrClimate::get_signature() { return {this->header_high_, this->header_low_}; }
+
 bool LgIrClimate::on_receive(remote_base::RemoteReceiveData data) {
   uint8_t nbits = 0;
   uint32_t remote_state = 0;
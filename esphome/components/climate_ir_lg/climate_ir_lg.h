@@ -36,6 +36,7 @@ class LgIrClimate : public climate_ir::ClimateIR {
   void transmit_state() override;
   /// Handle received IR Buffer
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  remote_base::RemoteSignature get_signature() override;
 
   bool send_swing_cmd_{false};
 
@@ -147,6 +147,8 @@ void CoolixClimate::transmit_state() {
   transmit.perform();
 }
 
+remote_base::RemoteSignature CoolixClimate::get_signature() { return {HEADER_MARK_US, HEADER_SPACE_US}; }
+
 bool CoolixClimate::on_receive(remote_base::RemoteReceiveData data) {
   // Decoded remote state y 3 bytes long code.
   uint32_t remote_state = 0;
@@ -31,6 +31,7 @@ class CoolixClimate : public climate_ir::ClimateIR {
   void transmit_state() override;
   /// Handle received IR Buffer
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  remote_base::RemoteSignature get_signature() override;
 
   bool send_swing_cmd_{false};
 };
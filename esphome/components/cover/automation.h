@@ -11,7 +11,7 @@ template<typename... Ts> class OpenAction : public Action<Ts...> {
  public:
   explicit OpenAction(Cover *cover) : cover_(cover) {}
 
-  void play(Ts... x) override { this->cover_->open(); }
+  void play(const Ts &... x) override { this->cover_->open(); }
 
  protected:
   Cover *cover_;
@@ -21,7 +21,7 @@ template<typename... Ts> class CloseAction : public Action<Ts...> {
  public:
   explicit CloseAction(Cover *cover) : cover_(cover) {}
 
-  void play(Ts... x) override { this->cover_->close(); }
+  void play(const Ts &... x) override { this->cover_->close(); }
 
  protected:
   Cover *cover_;
@@ -31,7 +31,7 @@ template<typename... Ts> class StopAction : public Action<Ts...> {
  public:
   explicit StopAction(Cover *cover) : cover_(cover) {}
 
-  void play(Ts... x) override { this->cover_->stop(); }
+  void play(const Ts &... x) override { this->cover_->stop(); }
 
  protected:
   Cover *cover_;
@@ -45,7 +45,7 @@ template<typename... Ts> class ControlAction : public Action<Ts...> {
   TEMPLATABLE_VALUE(float, position)
   TEMPLATABLE_VALUE(float, tilt)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto call = this->cover_->make_call();
     if (this->stop_.has_value())
       call.set_stop(this->stop_.value(x...));
@@ -67,7 +67,7 @@ template<typename... Ts> class CoverPublishAction : public Action<Ts...> {
   TEMPLATABLE_VALUE(float, tilt)
   TEMPLATABLE_VALUE(CoverOperation, current_operation)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     if (this->position_.has_value())
       this->cover_->position = this->position_.value(x...);
     if (this->tilt_.has_value())
@@ -84,7 +84,7 @@ template<typename... Ts> class CoverPublishAction : public Action<Ts...> {
 template<typename... Ts> class CoverIsOpenCondition : public Condition<Ts...> {
  public:
   CoverIsOpenCondition(Cover *cover) : cover_(cover) {}
-  bool check(Ts... x) override { return this->cover_->is_fully_open(); }
+  bool check(const Ts &... x) override { return this->cover_->is_fully_open(); }
 
  protected:
   Cover *cover_;
@@ -92,7 +92,7 @@ template<typename... Ts> class CoverIsOpenCondition : public Condition<Ts...> {
 template<typename... Ts> class CoverIsClosedCondition : public Condition<Ts...> {
  public:
   CoverIsClosedCondition(Cover *cover) : cover_(cover) {}
-  bool check(Ts... x) override { return this->cover_->is_fully_closed(); }
+  bool check(const Ts &... x) override { return this->cover_->is_fully_closed(); }
 
  protected:
   Cover *cover_;
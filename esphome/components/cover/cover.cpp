@@ -127,7 +127,7 @@ CoverCall &CoverCall::set_stop(bool stop) {
   return *this;
 }
 bool CoverCall::get_stop() const { return this->stop_; }
-void Cover::set_device_class(const std::string &device_class) { this->device_class_override_ = device_class; }
+void Cover::set_device_class(const char *device_class) { this->device_class_override_ = device_class; }
 CoverCall Cover::make_call() { return {this}; }
 void Cover::open() {
   auto call = this->make_call();
@@ -144,7 +144,6 @@ void Cover::stop() {
   call.set_command_stop();
   call.perform();
 }
-void Cover::add_on_state_callback(std::function<void()> &&f) { this->state_callback_.add(std::move(f)); }
 void Cover::publish_state(bool save) {
   this->position = clamp(this->position, 0.0f, 1.0f);
   this->tilt = clamp(this->tilt, 0.0f, 1.0f);
@@ -188,8 +187,8 @@ optional<CoverRestoreState> Cover::restore_state_() {
 }
 Cover::Cover() : Cover("") {}
 std::string Cover::get_device_class() {
-  if (this->device_class_override_.has_value())
-    return *this->device_class_override_;
+  if (this->device_class_override_ != nullptr)
+    return this->device_class_override_;
   return this->device_class();
 }
 bool Cover::is_fully_open() const { return this->position == COVER_OPEN; }
@@ -137,7 +137,11 @@ class Cover : public Nameable {
    */
   void stop();
 
-  void add_on_state_callback(std::function<void()> &&f);
+  template<typename F> void add_on_state_callback(F &&callback) {
+
+    this->state_callback_.add(std::forward<F>(callback));
+
+  }
 
   /** Publish the current state of the cover.
    *
@@ -149,7 +153,7 @@ class Cover : public Nameable {
   void publish_state(bool save = true);
 
   virtual CoverTraits get_traits() = 0;
-  void set_device_class(const std::string &device_class);
+  void set_device_class(const char *device_class);
   std::string get_device_class();
 
   /// Helper method to check if the cover is fully open. Equivalent to comparing .position against 1.0
@@ -167,7 +171,7 @@ class Cover : public Nameable {
   uint32_t hash_base() override;
 
   CallbackManager<void()> state_callback_{};
-  optional<std::string> device_class_override_{};
+  const char *device_class_override_{nullptr};
 
   ESPPreferenceObject rtc_;
 };
@@ -113,7 +113,7 @@ template<typename... Ts> class CS5460ARestartAction : public Action<Ts...> {
  public:
   CS5460ARestartAction(CS5460AComponent *cs5460a) : cs5460a_(cs5460a) {}
 
-  void play(Ts... x) override { cs5460a_->restart(); }
+  void play(const Ts &... x) override { cs5460a_->restart(); }
 
  protected:
   CS5460AComponent *cs5460a_;
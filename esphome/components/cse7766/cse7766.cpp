@@ -6,71 +6,50 @@ namespace cse7766 {
 
 static const char *const TAG = "cse7766";
 
-void CSE7766Component::loop() {
-  const uint32_t now = millis();
-  if (now - this->last_transmission_ >= 500) {
-    // last transmission too long ago. Reset RX index.
-    this->raw_data_index_ = 0;
-  }
-
-  if (this->available() == 0)
-    return;
-
-  this->last_transmission_ = now;
-  while (this->available() != 0) {
-    this->read_byte(&this->raw_data_[this->raw_data_index_]);
-    if (!this->check_byte_()) {
-      this->raw_data_index_ = 0;
+void CSE7766Component::setup() {
+  // The first header byte is the state register, only the second one is fixed
+  this->parser_.set_header({0x00, 0x5A}, {0x00, 0xFF});
+  this->parser_.set_fixed_length(24);
+  this->parser_.set_validator([this](const uint8_t *frame, size_t length) {
+    if (!this->check_frame_(frame)) {
       this->status_set_warning();
+      return false;
     }
-
-    if (this->raw_data_index_ == 23) {
-      this->parse_data_();
-      this->status_clear_warning();
-    }
-
-    this->raw_data_index_ = (this->raw_data_index_ + 1) % 24;
-  }
+    return true;
+  });
+  this->parser_.set_on_frame([this](const uint8_t *frame, size_t length) {
+    this->parse_data_(frame);
+    this->status_clear_warning();
+  });
 }
+void CSE7766Component::loop() { this->parser_.read_from(this); }
 float CSE7766Component::get_setup_priority() const { return setup_priority::DATA; }
 
-bool CSE7766Component::check_byte_() {
-  uint8_t index = this->raw_data_index_;
-  uint8_t byte = this->raw_data_[index];
-  if (index == 0) {
-    return !((byte != 0x55) && ((byte & 0xF0) != 0xF0) && (byte != 0xAA));
+bool CSE7766Component::check_frame_(const uint8_t *data) {
+  uint8_t header1 = data[0];
+  if ((header1 != 0x55) && ((header1 & 0xF0) != 0xF0) && (header1 != 0xAA)) {
+    ESP_LOGV(TAG, "Invalid Header 1 Start: 0x%02X!", header1);
+    return false;
   }
 
-  if (index == 1) {
-    if (byte != 0x5A) {
-      ESP_LOGV(TAG, "Invalid Header 2 Start: 0x%02X!", byte);
-      return false;
-    }
-    return true;
-  }
+  uint8_t checksum = 0;
+  for (uint8_t i = 2; i < 23; i++)
+    checksum += data[i];
 
-  if (index == 23) {
-    uint8_t checksum = 0;
-    for (uint8_t i = 2; i < 23; i++)
-      checksum += this->raw_data_[i];
-
-    if (checksum != this->raw_data_[23]) {
-      ESP_LOGW(TAG, "Invalid checksum from CSE7766: 0x%02X != 0x%02X", checksum, this->raw_data_[23]);
-      return false;
-    }
-    return true;
+  if (checksum != data[23]) {
+    ESP_LOGW(TAG, "Invalid checksum from CSE7766: 0x%02X != 0x%02X", checksum, data[23]);
+    return false;
   }
 
   return true;
 }
-void CSE7766Component::parse_data_() {
+void CSE7766Component::parse_data_(const uint8_t *data) {
   ESP_LOGVV(TAG, "CSE7766 Data: ");
   for (uint8_t i = 0; i < 23; i++) {
-    ESP_LOGVV(TAG, "  i=%u: 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", i, BYTE_TO_BINARY(this->raw_data_[i]),
-              this->raw_data_[i]);
+    ESP_LOGVV(TAG, "  i=%u: 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", i, BYTE_TO_BINARY(data[i]), data[i]);
   }
 
-  uint8_t header1 = this->raw_data_[0];
+  uint8_t header1 = data[0];
   if (header1 == 0xAA) {
     ESP_LOGW(TAG, "CSE7766 not calibrated!");
     return;
@@ -82,14 +61,14 @@ void CSE7766Component::parse_data_() {
     return;
   }
 
-  uint32_t voltage_calib = this->get_24_bit_uint_(2);
-  uint32_t voltage_cycle = this->get_24_bit_uint_(5);
-  uint32_t current_calib = this->get_24_bit_uint_(8);
-  uint32_t current_cycle = this->get_24_bit_uint_(11);
-  uint32_t power_calib = this->get_24_bit_uint_(14);
-  uint32_t power_cycle = this->get_24_bit_uint_(17);
+  uint32_t voltage_calib = this->get_24_bit_uint_(data, 2);
+  uint32_t voltage_cycle = this->get_24_bit_uint_(data, 5);
+  uint32_t current_calib = this->get_24_bit_uint_(data, 8);
+  uint32_t current_cycle = this->get_24_bit_uint_(data, 11);
+  uint32_t power_calib = this->get_24_bit_uint_(data, 14);
+  uint32_t power_cycle = this->get_24_bit_uint_(data, 17);
 
-  uint8_t adj = this->raw_data_[20];
+  uint8_t adj = data[20];
 
   bool power_ok = true;
   bool voltage_ok = true;
@@ -161,9 +140,8 @@ void CSE7766Component::update() {
   this->current_counts_ = 0;
 }
 
-uint32_t CSE7766Component::get_24_bit_uint_(uint8_t start_index) {
-  return (uint32_t(this->raw_data_[start_index]) << 16) | (uint32_t(this->raw_data_[start_index + 1]) << 8) |
-         uint32_t(this->raw_data_[start_index + 2]);
+uint32_t CSE7766Component::get_24_bit_uint_(const uint8_t *data, uint8_t start_index) {
+  return (uint32_t(data[start_index]) << 16) | (uint32_t(data[start_index + 1]) << 8) | uint32_t(data[start_index + 2]);
 }
 
 void CSE7766Component::dump_config() {
@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/frame_parser.h"
 
 namespace esphome {
 namespace cse7766 {
@@ -13,19 +14,18 @@ class CSE7766Component : public PollingComponent, public uart::UARTDevice {
   void set_current_sensor(sensor::Sensor *current_sensor) { current_sensor_ = current_sensor; }
   void set_power_sensor(sensor::Sensor *power_sensor) { power_sensor_ = power_sensor; }
 
+  void setup() override;
   void loop() override;
   float get_setup_priority() const override;
   void update() override;
   void dump_config() override;
 
  protected:
-  bool check_byte_();
-  void parse_data_();
-  uint32_t get_24_bit_uint_(uint8_t start_index);
+  bool check_frame_(const uint8_t *data);
+  void parse_data_(const uint8_t *data);
+  uint32_t get_24_bit_uint_(const uint8_t *data, uint8_t start_index);
 
-  uint8_t raw_data_[24];
-  uint8_t raw_data_index_{0};
-  uint32_t last_transmission_{0};
+  uart::FrameParser parser_;
   sensor::Sensor *voltage_sensor_{nullptr};
   sensor::Sensor *current_sensor_{nullptr};
   sensor::Sensor *power_sensor_{nullptr};
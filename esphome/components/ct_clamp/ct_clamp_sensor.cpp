@@ -1,6 +1,7 @@
 #include "ct_clamp_sensor.h"
 
 #include "esphome/core/log.h"
+#include <algorithm>
 #include <cmath>
 
 namespace esphome {
@@ -9,64 +10,105 @@ namespace ct_clamp {
 static const char *const TAG = "ct_clamp";
 
 void CTClampSensor::setup() {
+  this->continuous_ = this->source_->get_sample_rate() != 0;
   this->is_calibrating_offset_ = true;
-  this->high_freq_.start();
-  this->set_timeout("calibrate_offset", this->sample_duration_, [this]() {
-    this->high_freq_.stop();
-    this->is_calibrating_offset_ = false;
-    if (this->num_samples_ != 0) {
-      this->offset_ = this->sample_sum_ / this->num_samples_;
-    }
-  });
+  this->start_sampling_();
 }
 
 void CTClampSensor::dump_config() {
   LOG_SENSOR("", "CT Clamp Sensor", this);
   ESP_LOGCONFIG(TAG, "  Sample Duration: %.2fs", this->sample_duration_ / 1e3f);
+  if (this->continuous_)
+    ESP_LOGCONFIG(TAG, "  Continuous Sampling: %u Hz", this->source_->get_sample_rate());
   LOG_UPDATE_INTERVAL(this);
 }
 
 void CTClampSensor::update() {
-  if (this->is_calibrating_offset_)
+  if (this->is_calibrating_offset_ || this->is_sampling_)
     return;
 
   // Update only starts the sampling phase, in loop() the actual sampling is happening.
+  this->start_sampling_();
+}
+
+void CTClampSensor::start_sampling_() {
+  // Set sampling values
+  this->is_sampling_ = true;
+  this->num_samples_ = 0;
+  this->sample_sum_ = 0.0f;
+
+  if (this->continuous_) {
+    // The source buffers samples in the background, loop() only drains the buffer
+    this->target_samples_ = uint64_t(this->source_->get_sample_rate()) * this->sample_duration_ / 1000;
+    this->source_->start_continuous();
+    // In case the source stops delivering samples
+    this->set_timeout("read", this->sample_duration_ * 2 + 100, [this]() { this->finish_sampling_(); });
+    return;
+  }
 
   // Request a high loop() execution interval during sampling phase.
   this->high_freq_.start();
 
   // Set timeout for ending sampling phase
-  this->set_timeout("read", this->sample_duration_, [this]() {
-    this->is_sampling_ = false;
+  this->set_timeout("read", this->sample_duration_, [this]() { this->finish_sampling_(); });
+}
+
+void CTClampSensor::finish_sampling_() {
+  this->is_sampling_ = false;
+  if (this->continuous_) {
+    this->cancel_timeout("read");
+    this->source_->stop_continuous();
+  } else {
     this->high_freq_.stop();
+  }
 
-    if (this->num_samples_ == 0) {
-      // Shouldn't happen, but let's not crash if it does.
-      this->publish_state(NAN);
-      return;
+  if (this->is_calibrating_offset_) {
+    this->is_calibrating_offset_ = false;
+    if (this->num_samples_ != 0) {
+      this->offset_ = this->sample_sum_ / this->num_samples_;
     }
+    return;
+  }
 
-    float raw = this->sample_sum_ / this->num_samples_;
-    float irms = std::sqrt(raw);
-    ESP_LOGD(TAG, "'%s' - Raw Value: %.2fA", this->name_.c_str(), irms);
-    this->publish_state(irms);
-  });
+  if (this->num_samples_ == 0) {
+    // Shouldn't happen, but let's not crash if it does.
+    this->publish_state(NAN);
+    return;
+  }
 
-  // Set sampling values
-  this->is_sampling_ = true;
-  this->num_samples_ = 0;
-  this->sample_sum_ = 0.0f;
+  float raw = this->sample_sum_ / this->num_samples_;
+  float irms = std::sqrt(raw);
+  ESP_LOGD(TAG, "'%s' - Raw Value: %.2fA (%u samples)", this->name_.c_str(), irms, this->num_samples_);
+  this->publish_state(irms);
 }
 
 void CTClampSensor::loop() {
-  if (!this->is_sampling_ && !this->is_calibrating_offset_)
+  if (!this->is_sampling_)
+    return;
+
+  if (this->continuous_) {
+    float block[32];
+    while (this->num_samples_ < this->target_samples_) {
+      const size_t count =
+          this->source_->read_samples(block, std::min<size_t>(32, this->target_samples_ - this->num_samples_));
+      if (count == 0)
+        break;
+      for (size_t i = 0; i < count; i++)
+        this->process_sample_(block[i]);
+    }
+    if (this->num_samples_ >= this->target_samples_)
+      this->finish_sampling_();
     return;
+  }
 
   // Perform a single sample
   float value = this->source_->sample();
   if (isnan(value))
     return;
+  this->process_sample_(value);
+}
 
+void CTClampSensor::process_sample_(float value) {
   if (this->is_calibrating_offset_) {
     this->sample_sum_ += value;
     this->num_samples_++;
@@ -23,6 +23,10 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
   void set_source(voltage_sampler::VoltageSampler *source) { source_ = source; }
 
  protected:
+  void start_sampling_();
+  void process_sample_(float value);
+  void finish_sampling_();
+
   /// High Frequency loop() requester used during sampling phase.
   HighFrequencyLoopRequester high_freq_;
 
@@ -44,6 +48,13 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
   float sample_sum_ = 0.0f;
   uint32_t num_samples_ = 0;
   bool is_sampling_ = false;
+  /** Whether the source samples continuously, see voltage_sampler::VoltageSampler::get_sample_rate().
+   *
+   * Then a sampling phase takes exactly sample_duration worth of samples at the source's rate, so the RMS
+   * is computed over whole mains cycles for durations that are a multiple of 20 ms/16.7 ms.
+   */
+  bool continuous_ = false;
+  uint32_t target_samples_ = 0;
   /// Calibrate offset value once at boot
   bool is_calibrating_offset_ = false;
 };
@@ -204,6 +204,8 @@ bool DaikinClimate::parse_state_frame_(const uint8_t frame[]) {
   return true;
 }
 
+remote_base::RemoteSignature DaikinClimate::get_signature() { return {DAIKIN_HEADER_MARK, DAIKIN_HEADER_SPACE}; }
+
 bool DaikinClimate::on_receive(remote_base::RemoteReceiveData data) {
   uint8_t state_frame[DAIKIN_STATE_FRAME_SIZE] = {};
   if (!data.expect_item(DAIKIN_HEADER_MARK, DAIKIN_HEADER_SPACE)) {
@@ -57,6 +57,7 @@ class DaikinClimate : public climate_ir::ClimateIR {
   uint8_t temperature_();
   // Handle received IR Buffer
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  remote_base::RemoteSignature get_signature() override;
   bool parse_state_frame_(const uint8_t frame[]);
 };
 
@@ -2,26 +2,44 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
 from esphome.const import CONF_ID, CONF_PIN
+from esphome.core import CORE
 
 MULTI_CONF = True
 AUTO_LOAD = ["sensor"]
 
 CONF_ONE_WIRE_ID = "one_wire_id"
+CONF_RMT_CHANNEL = "rmt_channel"
 dallas_ns = cg.esphome_ns.namespace("dallas")
 DallasComponent = dallas_ns.class_("DallasComponent", cg.PollingComponent)
 ESPOneWire = dallas_ns.class_("ESPOneWire")
+ESP32RMTOneWire = dallas_ns.class_("ESP32RMTOneWire", ESPOneWire)
 
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(DallasComponent),
         cv.GenerateID(CONF_ONE_WIRE_ID): cv.declare_id(ESPOneWire),
         cv.Required(CONF_PIN): pins.internal_gpio_output_pin_schema,
+        # Uses this RMT channel for TX and the next one for RX
+        cv.Optional(CONF_RMT_CHANNEL): cv.All(
+            cv.only_on_esp32, cv.int_range(min=0, max=6)
+        ),
     }
 ).extend(cv.polling_component_schema("60s"))
 
 
 async def to_code(config):
     pin = await cg.gpio_pin_expression(config[CONF_PIN])
-    one_wire = cg.new_Pvariable(config[CONF_ONE_WIRE_ID], pin)
+    if CONF_RMT_CHANNEL in config:
+        one_wire = cg.Pvariable(
+            config[CONF_ONE_WIRE_ID],
+            ESP32RMTOneWire.new(pin, config[CONF_RMT_CHANNEL]),
+        )
+    else:
+        one_wire = cg.new_Pvariable(config[CONF_ONE_WIRE_ID], pin)
     var = cg.new_Pvariable(config[CONF_ID], one_wire)
     await cg.register_component(var, config)
+
+    # Start the conversions of all buses together so that they overlap
+    groups = CORE.data.setdefault("scheduler_phase_groups", {})
+    group = groups.setdefault(("dallas",), len(groups) + 1)
+    cg.add(cg.App.scheduler.set_phase_group(var, group))
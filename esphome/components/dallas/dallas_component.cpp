@@ -1,5 +1,7 @@
 #include "dallas_component.h"
 #include "esphome/core/log.h"
+#include "esphome/core/crc.h"
+#include <algorithm>
 
 namespace esphome {
 namespace dallas {
@@ -14,6 +16,9 @@ static const uint8_t DALLAS_MODEL_DS28EA00 = 0x42;
 static const uint8_t DALLAS_COMMAND_START_CONVERSION = 0x44;
 static const uint8_t DALLAS_COMMAND_READ_SCRATCH_PAD = 0xBE;
 static const uint8_t DALLAS_COMMAND_WRITE_SCRATCH_PAD = 0x4E;
+static const uint8_t DALLAS_COMMAND_COPY_SCRATCH_PAD = 0x48;
+/// Time a sensor needs to copy its scratch pad to EEPROM.
+static const uint32_t DALLAS_EEPROM_WRITE_TIME = 20;
 
 uint16_t DallasTemperatureSensor::millis_to_wait_for_conversion() const {
   switch (this->resolution_) {
@@ -31,17 +36,13 @@ uint16_t DallasTemperatureSensor::millis_to_wait_for_conversion() const {
 void DallasComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up DallasComponent...");
 
-  yield();
-  std::vector<uint64_t> raw_sensors;
-  {
-    InterruptLock lock;
-    raw_sensors = this->one_wire_->search_vec();
-  }
+  this->one_wire_->setup();
+  std::vector<uint64_t> raw_sensors = this->one_wire_->search_vec();
 
   for (auto &address : raw_sensors) {
     std::string s = uint64_to_string(address);
     auto *address8 = reinterpret_cast<uint8_t *>(&address);
-    if (crc8(address8, 7) != address8[7]) {
+    if (crc8_maxim(address8, 7) != address8[7]) {
       ESP_LOGW(TAG, "Dallas device 0x%s has invalid CRC.", s.c_str());
       continue;
     }
@@ -56,17 +57,51 @@ void DallasComponent::setup() {
 
   for (auto sensor : this->sensors_) {
     if (sensor->get_index().has_value()) {
-      if (*sensor->get_index() >= this->found_sensors_.size()) {
+      if (this->is_missing_(sensor)) {
         this->status_set_error();
         continue;
       }
       sensor->set_address(this->found_sensors_[*sensor->get_index()]);
     }
+  }
 
-    if (!sensor->setup_sensor()) {
+  // Read the fastest resolutions first, every sensor is then read as soon as its own conversion is done
+  std::stable_sort(this->sensors_.begin(), this->sensors_.end(),
+                   [](DallasTemperatureSensor *a, DallasTemperatureSensor *b) {
+                     return a->millis_to_wait_for_conversion() < b->millis_to_wait_for_conversion();
+                   });
+
+  // The sensors are configured one by one from loop()
+  this->setup_index_ = 0;
+  this->read_index_ = this->sensors_.size();
+}
+void DallasComponent::loop() {
+  if (int32_t(millis() - this->bus_busy_until_) < 0)
+    return;
+
+  if (this->setup_index_ < this->sensors_.size()) {
+    auto *sensor = this->sensors_[this->setup_index_++];
+    if (!this->is_missing_(sensor) && !sensor->setup_sensor())
       this->status_set_error();
-    }
+    return;
   }
+
+  if (this->conversion_requested_) {
+    this->conversion_requested_ = false;
+    this->start_conversion_();
+    return;
+  }
+
+  if (this->read_index_ >= this->sensors_.size())
+    return;
+  auto *sensor = this->sensors_[this->read_index_];
+  if (millis() - this->conversion_start_ < sensor->millis_to_wait_for_conversion())
+    return;
+  this->read_index_++;
+  this->read_sensor_(sensor);
+}
+bool DallasComponent::is_missing_(DallasTemperatureSensor *sensor) const {
+  return sensor->get_index().has_value() && *sensor->get_index() >= this->found_sensors_.size();
 }
 void DallasComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "DallasComponent:");
@@ -107,53 +142,39 @@ DallasTemperatureSensor *DallasComponent::get_sensor_by_index(uint8_t index, uin
   s->set_index(index);
   return s;
 }
-void DallasComponent::update() {
+void DallasComponent::update() { this->conversion_requested_ = true; }
+void DallasComponent::start_conversion_() {
   this->status_clear_warning();
 
-  bool result;
-  {
-    InterruptLock lock;
-    if (!this->one_wire_->reset()) {
-      result = false;
-    } else {
-      result = true;
-      this->one_wire_->skip();
-      this->one_wire_->write8(DALLAS_COMMAND_START_CONVERSION);
-    }
-  }
-
-  if (!result) {
+  if (!this->one_wire_->reset()) {
     ESP_LOGE(TAG, "Requesting conversion failed");
     this->status_set_warning();
+    this->read_index_ = this->sensors_.size();
     return;
   }
+  this->one_wire_->skip();
+  this->one_wire_->write8(DALLAS_COMMAND_START_CONVERSION);
 
-  for (auto *sensor : this->sensors_) {
-    this->set_timeout(sensor->get_address_name(), sensor->millis_to_wait_for_conversion(), [this, sensor] {
-      bool res;
-      {
-        InterruptLock lock;
-        res = sensor->read_scratch_pad();
-      }
-
-      if (!res) {
-        ESP_LOGW(TAG, "'%s' - Reseting bus for read failed!", sensor->get_name().c_str());
-        sensor->publish_state(NAN);
-        this->status_set_warning();
-        return;
-      }
-      if (!sensor->check_scratch_pad()) {
-        ESP_LOGW(TAG, "'%s' - Scratch pad checksum invalid!", sensor->get_name().c_str());
-        sensor->publish_state(NAN);
-        this->status_set_warning();
-        return;
-      }
-
-      float tempc = sensor->get_temp_c();
-      ESP_LOGD(TAG, "'%s': Got Temperature=%.1f°C", sensor->get_name().c_str(), tempc);
-      sensor->publish_state(tempc);
-    });
+  this->conversion_start_ = millis();
+  this->read_index_ = 0;
+}
+void DallasComponent::read_sensor_(DallasTemperatureSensor *sensor) {
+  if (!sensor->read_scratch_pad()) {
+    ESP_LOGW(TAG, "'%s' - Reseting bus for read failed!", sensor->get_name().c_str());
+    sensor->publish_state(NAN);
+    this->status_set_warning();
+    return;
+  }
+  if (!sensor->check_scratch_pad()) {
+    ESP_LOGW(TAG, "'%s' - Scratch pad checksum invalid!", sensor->get_name().c_str());
+    sensor->publish_state(NAN);
+    this->status_set_warning();
+    return;
   }
+
+  float tempc = sensor->get_temp_c();
+  ESP_LOGD(TAG, "'%s': Got Temperature=%.1f°C", sensor->get_name().c_str(), tempc);
+  sensor->publish_state(tempc);
 }
 DallasComponent::DallasComponent(ESPOneWire *one_wire) : one_wire_(one_wire) {}
 
@@ -190,13 +211,7 @@ bool ICACHE_RAM_ATTR DallasTemperatureSensor::read_scratch_pad() {
   return true;
 }
 bool DallasTemperatureSensor::setup_sensor() {
-  bool r;
-  {
-    InterruptLock lock;
-    r = this->read_scratch_pad();
-  }
-
-  if (!r) {
+  if (!this->read_scratch_pad()) {
     ESP_LOGE(TAG, "Reading scratchpad failed: reset");
     return false;
   }
@@ -229,24 +244,21 @@ bool DallasTemperatureSensor::setup_sensor() {
   }
 
   ESPOneWire *wire = this->parent_->one_wire_;
-  {
-    InterruptLock lock;
-    if (wire->reset()) {
-      wire->select(this->address_);
-      wire->write8(DALLAS_COMMAND_WRITE_SCRATCH_PAD);
-      wire->write8(this->scratch_pad_[2]);  // high alarm temp
-      wire->write8(this->scratch_pad_[3]);  // low alarm temp
-      wire->write8(this->scratch_pad_[4]);  // resolution
-      wire->reset();
+  if (wire->reset()) {
+    wire->select(this->address_);
+    wire->write8(DALLAS_COMMAND_WRITE_SCRATCH_PAD);
+    wire->write8(this->scratch_pad_[2]);  // high alarm temp
+    wire->write8(this->scratch_pad_[3]);  // low alarm temp
+    wire->write8(this->scratch_pad_[4]);  // resolution
+    wire->reset();
 
-      // write value to EEPROM
-      wire->select(this->address_);
-      wire->write8(0x48);
-    }
+    // write value to EEPROM
+    wire->select(this->address_);
+    wire->write8(DALLAS_COMMAND_COPY_SCRATCH_PAD);
   }
 
-  delay(20);  // allow it to finish operation
-  wire->reset();
+  // allow it to finish operation before the next transaction, loop() waits instead of blocking here
+  this->parent_->bus_busy_until_ = millis() + DALLAS_EEPROM_WRITE_TIME;
   return true;
 }
 bool DallasTemperatureSensor::check_scratch_pad() {
@@ -254,9 +266,9 @@ bool DallasTemperatureSensor::check_scratch_pad() {
   ESP_LOGVV(TAG, "Scratch pad: %02X.%02X.%02X.%02X.%02X.%02X.%02X.%02X.%02X (%02X)", this->scratch_pad_[0],
             this->scratch_pad_[1], this->scratch_pad_[2], this->scratch_pad_[3], this->scratch_pad_[4],
             this->scratch_pad_[5], this->scratch_pad_[6], this->scratch_pad_[7], this->scratch_pad_[8],
-            crc8(this->scratch_pad_, 8));
+            crc8_maxim(this->scratch_pad_, 8));
 #endif
-  return crc8(this->scratch_pad_, 8) == this->scratch_pad_[8];
+  return crc8_maxim(this->scratch_pad_, 8) == this->scratch_pad_[8];
 }
 float DallasTemperatureSensor::get_temp_c() {
   int16_t temp = (int16_t(this->scratch_pad_[1]) << 11) | (int16_t(this->scratch_pad_[0]) << 3);
@@ -20,14 +20,28 @@ class DallasComponent : public PollingComponent {
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
 
+  /// Request a new conversion, the bus transactions themselves run from loop().
   void update() override;
+  void loop() override;
 
  protected:
   friend DallasTemperatureSensor;
 
+  /// Whether the sensor was configured by index but no device was found for it.
+  bool is_missing_(DallasTemperatureSensor *sensor) const;
+  void start_conversion_();
+  void read_sensor_(DallasTemperatureSensor *sensor);
+
   ESPOneWire *one_wire_;
   std::vector<DallasTemperatureSensor *> sensors_;
   std::vector<uint64_t> found_sensors_;
+
+  // Bus state machine, each loop() iteration performs at most one transaction
+  size_t setup_index_{0};             ///< next sensor to configure after setup.
+  size_t read_index_{0};              ///< next sensor to read in the current conversion.
+  bool conversion_requested_{false};  ///< update() was called, start a conversion once the bus is free.
+  uint32_t conversion_start_{0};      ///< when the current conversion was started.
+  uint32_t bus_busy_until_{0};        ///< a sensor is writing its EEPROM, leave the bus alone until then.
 };
 
 /// Internal class that helps us create multiple sensors for one Dallas hub.
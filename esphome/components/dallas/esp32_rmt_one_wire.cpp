@@ -0,0 +1,172 @@
+#include "esp32_rmt_one_wire.h"
+#include "esphome/core/log.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#include <driver/gpio.h>
+#include <soc/gpio_struct.h>
+#include <soc/io_mux_reg.h>
+
+namespace esphome {
+namespace dallas {
+
+static const char *const TAG = "dallas.rmt_one_wire";
+
+// All durations in µs, the channels count with a clock divider of 80 (1 MHz)
+static const uint8_t RMT_CLOCK_DIVIDER = 80;
+static const uint16_t DURATION_RESET = 480;
+static const uint16_t DURATION_SLOT = 75;
+static const uint16_t DURATION_1_LOW = 2;
+static const uint16_t DURATION_0_LOW = 65;
+/// A device answering 0 holds the bus low for at least 15µs after the start of the slot.
+static const uint16_t DURATION_SAMPLE = 15 - DURATION_1_LOW;
+/// The receiver stops once the bus stays high for longer than a full slot.
+static const uint16_t DURATION_RX_IDLE = DURATION_SLOT + 2;
+static const size_t RX_BUFFER_SIZE = 512;
+
+ESP32RMTOneWire::ESP32RMTOneWire(GPIOPin *pin, uint8_t channel)
+    : ESPOneWire(pin), tx_channel_(rmt_channel_t(channel)), rx_channel_(rmt_channel_t(channel + 1)) {}
+
+void ESP32RMTOneWire::setup() {
+  gpio_num_t gpio = gpio_num_t(this->pin_->get_pin());
+
+  rmt_config_t tx{};
+  tx.rmt_mode = RMT_MODE_TX;
+  tx.channel = this->tx_channel_;
+  tx.gpio_num = gpio;
+  tx.clk_div = RMT_CLOCK_DIVIDER;
+  tx.mem_block_num = 1;
+  tx.tx_config.loop_en = false;
+  tx.tx_config.carrier_en = false;
+  tx.tx_config.idle_output_en = true;
+  tx.tx_config.idle_level = RMT_IDLE_LEVEL_HIGH;
+
+  rmt_config_t rx{};
+  rx.rmt_mode = RMT_MODE_RX;
+  rx.channel = this->rx_channel_;
+  rx.gpio_num = gpio;
+  rx.clk_div = RMT_CLOCK_DIVIDER;
+  rx.mem_block_num = 1;
+  rx.rx_config.filter_en = true;
+  rx.rx_config.filter_ticks_thresh = 30;
+  rx.rx_config.idle_threshold = DURATION_RX_IDLE;
+
+  esp_err_t error = rmt_config(&tx);
+  if (error == ESP_OK)
+    error = rmt_config(&rx);
+  if (error == ESP_OK)
+    error = rmt_driver_install(this->tx_channel_, 0, 0);
+  if (error == ESP_OK)
+    error = rmt_driver_install(this->rx_channel_, RX_BUFFER_SIZE, 0);
+  if (error == ESP_OK)
+    error = rmt_get_ringbuf_handle(this->rx_channel_, &this->rx_buffer_);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Configuring RMT channels for 1-Wire failed: %s", esp_err_to_name(error));
+    this->failed_ = true;
+    return;
+  }
+
+  // Connect both channels to the pin, RX first because setting up the TX pin disables the input path
+  rmt_set_pin(this->rx_channel_, RMT_MODE_RX, gpio);
+  rmt_set_pin(this->tx_channel_, RMT_MODE_TX, gpio);
+  PIN_INPUT_ENABLE(GPIO_PIN_MUX_REG[gpio]);
+  // Open drain, so that the devices can pull the bus low while the TX channel idles high
+  GPIO.pin[gpio].pad_driver = 1;
+}
+
+void ESP32RMTOneWire::flush_rx_() {
+  size_t size;
+  void *item;
+  while ((item = xRingbufferReceive(this->rx_buffer_, &size, 0)) != nullptr)
+    vRingbufferReturnItem(this->rx_buffer_, item);
+}
+
+bool ESP32RMTOneWire::reset() {
+  if (this->failed_)
+    return false;
+
+  rmt_item32_t item{};
+  item.level0 = 0;
+  item.duration0 = DURATION_RESET;
+  item.level1 = 1;
+  item.duration1 = 0;
+
+  // The presence pulse follows the long reset pulse, so receive until the bus idles for longer than that
+  rmt_set_rx_idle_thresh(this->rx_channel_, DURATION_RESET + 60);
+  this->flush_rx_();
+  rmt_rx_start(this->rx_channel_, true);
+
+  bool presence = false;
+  if (rmt_write_items(this->tx_channel_, &item, 1, true) == ESP_OK) {
+    size_t size = 0;
+    auto *rx = static_cast<rmt_item32_t *>(xRingbufferReceive(this->rx_buffer_, &size, pdMS_TO_TICKS(10)));
+    if (rx != nullptr) {
+      // our reset pulse, then the bus floats high until a device pulls it low again
+      presence = size >= 2 * sizeof(rmt_item32_t) && rx[0].level0 == 0 && rx[0].duration0 >= DURATION_RESET - 2 &&
+                 rx[0].level1 == 1 && rx[0].duration1 > 0 && rx[1].level0 == 0;
+      vRingbufferReturnItem(this->rx_buffer_, rx);
+    }
+  }
+
+  rmt_rx_stop(this->rx_channel_);
+  rmt_set_rx_idle_thresh(this->rx_channel_, DURATION_RX_IDLE);
+  return presence;
+}
+
+optional<uint8_t> ESP32RMTOneWire::transfer_(uint8_t bits, uint8_t count, bool sample) {
+  if (this->failed_)
+    return {};
+
+  rmt_item32_t items[8];
+  for (uint8_t i = 0; i < count; i++) {
+    bool bit = (bits >> i) & 1;
+    items[i].level0 = 0;
+    items[i].duration0 = bit ? DURATION_1_LOW : DURATION_0_LOW;
+    items[i].level1 = 1;
+    items[i].duration1 = DURATION_SLOT - items[i].duration0;
+  }
+
+  if (sample) {
+    this->flush_rx_();
+    rmt_rx_start(this->rx_channel_, true);
+  }
+  if (rmt_write_items(this->tx_channel_, items, count, true) != ESP_OK) {
+    if (sample)
+      rmt_rx_stop(this->rx_channel_);
+    return {};
+  }
+  if (!sample)
+    return bits;
+
+  size_t size = 0;
+  auto *rx = static_cast<rmt_item32_t *>(xRingbufferReceive(this->rx_buffer_, &size, pdMS_TO_TICKS(10)));
+  rmt_rx_stop(this->rx_channel_);
+  if (rx == nullptr)
+    return {};
+
+  optional<uint8_t> result;
+  if (size >= count * sizeof(rmt_item32_t)) {
+    uint8_t value = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      // a 1 only sees our own short low pulse, a device answering 0 stretches it past the sample point
+      if (rx[i].level0 == 0 && rx[i].duration0 <= DURATION_SAMPLE)
+        value |= 1 << i;
+    }
+    result = value;
+  }
+  vRingbufferReturnItem(this->rx_buffer_, rx);
+  return result;
+}
+
+void ESP32RMTOneWire::write_bit(bool bit) { this->transfer_(bit, 1, false); }
+
+bool ESP32RMTOneWire::read_bit() { return this->transfer_(1, 1, true).value_or(1) & 1; }
+
+void ESP32RMTOneWire::write8(uint8_t val) { this->transfer_(val, 8, false); }
+
+uint8_t ESP32RMTOneWire::read8() { return this->transfer_(0xFF, 8, true).value_or(0xFF); }
+
+}  // namespace dallas
+}  // namespace esphome
+
+#endif
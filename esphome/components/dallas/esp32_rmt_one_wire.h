@@ -0,0 +1,44 @@
+#pragma once
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#include "esp_one_wire.h"
+#include "esphome/core/optional.h"
+#include <driver/rmt.h>
+
+namespace esphome {
+namespace dallas {
+
+/** A 1-Wire bus master that lets two RMT channels generate and sample the time slots.
+ *
+ * The TX channel drives the pin open drain and the RX channel, on the next channel, records the bus
+ * level on the same pin. A byte is clocked out as one RMT transmission, so the CPU neither busy waits
+ * nor disables interrupts for the slot timing, and WiFi keeps being serviced during bus transactions.
+ */
+class ESP32RMTOneWire : public ESPOneWire {
+ public:
+  ESP32RMTOneWire(GPIOPin *pin, uint8_t channel);
+
+  void setup() override;
+
+  bool reset() override;
+  void write_bit(bool bit) override;
+  bool read_bit() override;
+  void write8(uint8_t val) override;
+  uint8_t read8() override;
+
+ protected:
+  /// Clock out `count` time slots, LSB of `bits` first, and return the bits sampled on the bus.
+  optional<uint8_t> transfer_(uint8_t bits, uint8_t count, bool sample);
+  void flush_rx_();
+
+  rmt_channel_t tx_channel_;
+  rmt_channel_t rx_channel_;
+  RingbufHandle_t rx_buffer_{nullptr};
+  bool failed_{false};
+};
+
+}  // namespace dallas
+}  // namespace esphome
+
+#endif
@@ -23,23 +23,28 @@ bool HOT ICACHE_RAM_ATTR ESPOneWire::reset() {
     delayMicroseconds(2);
   } while (!this->pin_->digital_read());
 
-  // Send 480µs LOW TX reset pulse
+  // Send 480µs LOW TX reset pulse, a longer pulse is fine so this part may be interrupted
   this->pin_->pin_mode(OUTPUT);
   this->pin_->digital_write(false);
   delayMicroseconds(480);
 
-  // Switch into RX mode, letting the pin float
-  this->pin_->pin_mode(INPUT_PULLUP);
-  // after 15µs-60µs wait time, responder pulls low for 60µs-240µs
-  // let's have 70µs just in case
-  delayMicroseconds(70);
+  bool r;
+  {
+    InterruptLock lock;
+    // Switch into RX mode, letting the pin float
+    this->pin_->pin_mode(INPUT_PULLUP);
+    // after 15µs-60µs wait time, responder pulls low for 60µs-240µs
+    // let's have 70µs just in case
+    delayMicroseconds(70);
 
-  bool r = !this->pin_->digital_read();
+    r = !this->pin_->digital_read();
+  }
   delayMicroseconds(410);
   return r;
 }
 
 void HOT ICACHE_RAM_ATTR ESPOneWire::write_bit(bool bit) {
+  InterruptLock lock;
   // Initiate write/read by pulling low.
   this->pin_->pin_mode(OUTPUT);
   this->pin_->digital_write(false);
@@ -61,6 +66,7 @@ void HOT ICACHE_RAM_ATTR ESPOneWire::write_bit(bool bit) {
 }
 
 bool HOT ICACHE_RAM_ATTR ESPOneWire::read_bit() {
+  InterruptLock lock;
   // Initiate read slot by pulling LOW for at least 1µs
   this->pin_->pin_mode(OUTPUT);
   this->pin_->digital_write(false);
@@ -83,8 +89,8 @@ void ICACHE_RAM_ATTR ESPOneWire::write8(uint8_t val) {
 }
 
 void ICACHE_RAM_ATTR ESPOneWire::write64(uint64_t val) {
-  for (uint8_t i = 0; i < 64; i++) {
-    this->write_bit(bool((1ULL << i) & val));
+  for (uint8_t i = 0; i < 8; i++) {
+    this->write8(uint8_t(val >> (i * 8)));
   }
 }
 
@@ -3,15 +3,26 @@
 #include "esphome/core/component.h"
 #include "esphome/core/esphal.h"
 
+#include <vector>
+
 namespace esphome {
 namespace dallas {
 
 extern const uint8_t ONE_WIRE_ROM_SELECT;
 extern const int ONE_WIRE_ROM_SEARCH;
 
+/** A 1-Wire bus master that bit-bangs the time slots on a GPIO pin.
+ *
+ * Interrupts are only disabled for the timing critical part of each time slot, the bus may idle
+ * between slots for as long as needed, so whole transactions never run with interrupts off.
+ */
 class ESPOneWire {
  public:
   explicit ESPOneWire(GPIOPin *pin);
+  virtual ~ESPOneWire() = default;
+
+  /// Prepare the bus, called by the component using it during setup.
+  virtual void setup() {}
 
   /** Reset the bus, should be done before all write operations.
    *
@@ -19,16 +30,16 @@ class ESPOneWire {
    *
    * @return Whether the operation was successful.
    */
-  bool reset();
+  virtual bool reset();
 
   /// Write a single bit to the bus, takes about 70µs.
-  void write_bit(bool bit);
+  virtual void write_bit(bool bit);
 
   /// Read a single bit from the bus, takes about 70µs
-  bool read_bit();
+  virtual bool read_bit();
 
   /// Write a word to the bus. LSB first.
-  void write8(uint8_t val);
+  virtual void write8(uint8_t val);
 
   /// Write a 64 bit unsigned integer to the bus. LSB first.
   void write64(uint64_t val);
@@ -37,7 +48,7 @@ class ESPOneWire {
   void skip();
 
   /// Read an 8 bit word from the bus.
-  uint8_t read8();
+  virtual uint8_t read8();
 
   /// Read an 64-bit unsigned integer from the bus.
   uint64_t read64();
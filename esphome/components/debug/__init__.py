@@ -5,15 +5,46 @@ from esphome.const import CONF_ID
 CODEOWNERS = ["@OttoWinter"]
 DEPENDENCIES = ["logger"]
 
+CONF_DEBUG_ID = "debug_id"
+CONF_PROFILER = "profiler"
+CONF_SETUP_TRACE = "setup_trace"
+CONF_I2C_STATS = "i2c_stats"
+CONF_ALLOC_STATS = "alloc_stats"
+CONF_API_BENCHMARK = "api_benchmark"
+
+# Heap functions that are counted by the alloc_stats option
+ALLOC_STATS_WRAPPED = ["malloc", "free", "realloc", "calloc"]
+
 debug_ns = cg.esphome_ns.namespace("debug")
-DebugComponent = debug_ns.class_("DebugComponent", cg.Component)
+DebugComponent = debug_ns.class_("DebugComponent", cg.PollingComponent)
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(DebugComponent),
+        cv.Optional(CONF_PROFILER, default=False): cv.boolean,
+        cv.Optional(CONF_SETUP_TRACE, default=False): cv.boolean,
+        cv.Optional(CONF_I2C_STATS): cv.All(cv.boolean, cv.requires_component("i2c")),
+        cv.Optional(CONF_ALLOC_STATS, default=False): cv.boolean,
+        cv.Optional(CONF_API_BENCHMARK): cv.All(
+            cv.boolean, cv.requires_component("api")
+        ),
     }
-).extend(cv.COMPONENT_SCHEMA)
+).extend(cv.polling_component_schema("60s"))
 
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+
+    if config[CONF_PROFILER]:
+        cg.add_define("USE_RUNTIME_STATS")
+    if config[CONF_SETUP_TRACE]:
+        cg.add_define("USE_SETUP_TRACE")
+    if config.get(CONF_I2C_STATS, False):
+        cg.add_define("USE_I2C_STATS")
+    if config.get(CONF_API_BENCHMARK, False):
+        cg.add_define("USE_API_BENCHMARK")
+    if config[CONF_ALLOC_STATS]:
+        cg.add_define("USE_ALLOC_STATS")
+        # Route all heap calls through the counting __wrap_* functions of the debug component
+        for func in ALLOC_STATS_WRAPPED:
+            cg.add_build_flag(f"-Wl,--wrap={func}")
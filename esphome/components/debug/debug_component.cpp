@@ -3,9 +3,20 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/version.h"
+#include "esphome/core/application.h"
+#include "esphome/core/preferences.h"
+#include <algorithm>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <rom/rtc.h>
+#include <esp_heap_caps.h>
+#endif
+
+#ifdef USE_I2C_STATS
+#include "esphome/components/i2c/i2c.h"
+#endif
+#ifdef USE_API_BENCHMARK
+#include "esphome/components/api/proto_benchmark.h"
 #endif
 
 namespace esphome {
@@ -13,6 +24,37 @@ namespace debug {
 
 static const char *const TAG = "debug";
 
+#ifdef USE_ALLOC_STATS
+// Counted from every task, on the ESP32 the totals may miss an operation when two cores update them at once.
+static AllocStats total_alloc_stats;  // NOLINT
+/// Heap operations outside of components, and on the ESP32 those of other tasks like WiFi and the TCP stack.
+static AllocStats other_alloc_stats;  // NOLINT
+#ifdef ARDUINO_ARCH_ESP32
+static TaskHandle_t loop_task_handle = nullptr;  // NOLINT
+#endif
+
+static AllocStats *alloc_stats_target() {
+#ifdef ARDUINO_ARCH_ESP32
+  // global_alloc_stats_target is only meaningful in the task running the components
+  if (xTaskGetCurrentTaskHandle() != loop_task_handle)
+    return &other_alloc_stats;
+#endif
+  AllocStats *target = global_alloc_stats_target;
+  return target != nullptr ? target : &other_alloc_stats;
+}
+static void count_alloc(size_t size) {
+  AllocStats *target = alloc_stats_target();
+  target->allocs++;
+  target->alloc_bytes += size;
+  total_alloc_stats.allocs++;
+  total_alloc_stats.alloc_bytes += size;
+}
+static void count_free() {
+  alloc_stats_target()->frees++;
+  total_alloc_stats.frees++;
+}
+#endif
+
 void DebugComponent::dump_config() {
 #ifndef ESPHOME_LOG_HAS_DEBUG
   ESP_LOGE(TAG, "Debug Component requires debug log level!");
@@ -23,6 +65,11 @@ void DebugComponent::dump_config() {
   ESP_LOGD(TAG, "ESPHome version %s", ESPHOME_VERSION);
   this->free_heap_ = ESP.getFreeHeap();
   ESP_LOGD(TAG, "Free Heap Size: %u bytes", this->free_heap_);
+  for (auto *usage = LargeBufferUsage::get_first(); usage != nullptr; usage = usage->get_next()) {
+    if (usage->get_internal() != 0 || usage->get_psram() != 0)
+      ESP_LOGD(TAG, "  Buffers of %s: %u bytes internal, %u bytes PSRAM", usage->get_name(), usage->get_internal(),
+               usage->get_psram());
+  }
 
   const char *flash_mode;
   switch (ESP.getFlashChipMode()) {
@@ -197,15 +244,188 @@ void DebugComponent::dump_config() {
   ESP_LOGD(TAG, "Reset Info: %s", ESP.getResetInfo().c_str());
 #endif
 }
+void DebugComponent::setup() {
+#ifdef USE_ALLOC_STATS
+#ifdef ARDUINO_ARCH_ESP32
+  loop_task_handle = xTaskGetCurrentTaskHandle();
+#endif
+  this->last_alloc_stats_time_ = millis();
+#endif
+}
 void DebugComponent::loop() {
+  // calculate loop time - from last call to this one
+  uint32_t now = millis();
+  // The first call has no previous one to measure from
+  if (this->last_loop_timetag_ != 0)
+    this->max_loop_time_ = std::max(this->max_loop_time_, now - this->last_loop_timetag_);
+  this->last_loop_timetag_ = now;
+
   uint32_t new_free_heap = ESP.getFreeHeap();
+  this->min_free_heap_ = std::min(this->min_free_heap_, new_free_heap);
   if (new_free_heap < this->free_heap_ / 2) {
     this->free_heap_ = new_free_heap;
     ESP_LOGD(TAG, "Free Heap Size: %u bytes", this->free_heap_);
     this->status_momentary_warning("heap", 1000);
   }
 }
+void DebugComponent::update() {
+#ifdef USE_SENSOR
+  if (this->loop_time_sensor_ != nullptr)
+    this->loop_time_sensor_->publish_state(this->max_loop_time_);
+  if (this->min_free_heap_sensor_ != nullptr && this->min_free_heap_ != UINT32_MAX)
+    this->min_free_heap_sensor_->publish_state(this->min_free_heap_);
+  if (this->largest_free_block_sensor_ != nullptr) {
+#ifdef ARDUINO_ARCH_ESP32
+    this->largest_free_block_sensor_->publish_state(heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+    this->largest_free_block_sensor_->publish_state(ESP.getMaxFreeBlockSize());
+#endif
+  }
+#ifdef USE_RUNTIME_STATS
+  // Before dump_runtime_stats_() resets the statistics
+  for (auto &entry : this->component_loop_time_sensors_) {
+    const RuntimeStats &stats = entry.first->get_runtime_stats();
+    if (stats.count != 0)
+      entry.second->publish_state(stats.get_average_us() / 1000.0f);
+  }
+#endif
+#endif
+  this->max_loop_time_ = 0;
+  this->min_free_heap_ = UINT32_MAX;
+
+  uint32_t flash_writes = global_preferences.get_flash_write_count();
+  if (flash_writes != this->last_flash_write_count_) {
+    ESP_LOGD(TAG, "Preferences flash writes since boot: %u", flash_writes);
+    this->last_flash_write_count_ = flash_writes;
+  }
+
+#ifdef USE_RUNTIME_STATS
+  this->dump_runtime_stats_();
+#endif
+#ifdef USE_ALLOC_STATS
+  this->dump_alloc_stats_();
+#endif
+#ifdef USE_API_BENCHMARK
+  this->run_api_benchmark_();
+#endif
+#ifdef USE_I2C_STATS
+  for (auto *bus : i2c::global_i2c_buses)
+    bus->dump_stats();
+#endif
+}
+#ifdef USE_RUNTIME_STATS
+void DebugComponent::dump_runtime_stats_() {
+  std::vector<Component *> components = App.get_components();
+  // Report the components that used the most time first
+  std::sort(components.begin(), components.end(), [](Component *a, Component *b) {
+    return a->get_runtime_stats().total_us > b->get_runtime_stats().total_us;
+  });
+
+  ESP_LOGI(TAG, "Component loop() runtime (since last report):");
+  for (auto *component : components) {
+    RuntimeStats &stats = component->get_runtime_stats();
+    if (stats.count == 0)
+      continue;
+    ESP_LOGI(TAG, "  %s: count=%u avg=%.2fms min=%.2fms max=%.2fms", component->get_component_source(),
+             stats.count, stats.get_average_us() / 1000.0f, stats.min_us / 1000.0f, stats.max_us / 1000.0f);
+    stats.reset();
+  }
+
+  App.scheduler.dump_runtime_stats();
+}
+#endif
+#ifdef USE_ALLOC_STATS
+void DebugComponent::dump_alloc_stats_() {
+  const uint32_t now = millis();
+  const float seconds = std::max(now - this->last_alloc_stats_time_, uint32_t(1)) / 1000.0f;
+  this->last_alloc_stats_time_ = now;
+
+  std::vector<Component *> components = App.get_components();
+  // Report the components that allocated the most first
+  std::sort(components.begin(), components.end(), [](Component *a, Component *b) {
+    return a->get_alloc_stats().allocs > b->get_alloc_stats().allocs;
+  });
+
+  ESP_LOGI(TAG, "Heap operations (since last report): allocs=%.1f/s frees=%.1f/s bytes=%.0f/s",
+           total_alloc_stats.allocs / seconds, total_alloc_stats.frees / seconds,
+           total_alloc_stats.alloc_bytes / seconds);
+  total_alloc_stats.reset();
+  for (auto *component : components) {
+    AllocStats &stats = component->get_alloc_stats();
+    if (stats.allocs == 0 && stats.frees == 0)
+      continue;
+    ESP_LOGI(TAG, "  %s: allocs=%.1f/s frees=%.1f/s bytes=%.0f/s", component->get_component_source(),
+             stats.allocs / seconds, stats.frees / seconds, stats.alloc_bytes / seconds);
+    stats.reset();
+  }
+  ESP_LOGI(TAG, "  <other>: allocs=%.1f/s frees=%.1f/s bytes=%.0f/s", other_alloc_stats.allocs / seconds,
+           other_alloc_stats.frees / seconds, other_alloc_stats.alloc_bytes / seconds);
+  other_alloc_stats.reset();
+}
+#endif
+#ifdef USE_API_BENCHMARK
+// Runs of each case per update, the whole benchmark blocks the loop for a few tens of milliseconds
+static const uint32_t API_BENCHMARK_RUNS = 100;
+
+void DebugComponent::run_api_benchmark_() {
+  api::ProtoBenchmark benchmark;
+  ESP_LOGI(TAG, "API protobuf benchmark (average of %u runs):", API_BENCHMARK_RUNS);
+  for (size_t i = 0; i < benchmark.size(); i++) {
+    // The first run fills the caches and grows the buffers
+    benchmark.run(i);
+#ifdef USE_ALLOC_STATS
+    AllocStats stats;
+    AllocStatsScope scope(&stats);
+#endif
+    const uint32_t start = ESP.getCycleCount();
+    for (uint32_t run = 0; run < API_BENCHMARK_RUNS; run++)
+      benchmark.run(i);
+    const uint32_t cycles = (ESP.getCycleCount() - start) / API_BENCHMARK_RUNS;
+#ifdef USE_ALLOC_STATS
+    ESP_LOGI(TAG, "  %s (%u bytes): cycles=%u allocs=%.1f alloc_bytes=%.1f", benchmark.get_name(i),
+             benchmark.get_message_size(i), cycles, stats.allocs / float(API_BENCHMARK_RUNS),
+             stats.alloc_bytes / float(API_BENCHMARK_RUNS));
+#else
+    ESP_LOGI(TAG, "  %s (%u bytes): cycles=%u", benchmark.get_name(i), benchmark.get_message_size(i), cycles);
+#endif
+    App.feed_wdt();
+  }
+}
+#endif
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
 }  // namespace esphome
+
+#ifdef USE_ALLOC_STATS
+// Linked in place of the heap functions with -Wl,--wrap, see the debug component's __init__.py
+extern "C" {
+void *__real_malloc(size_t size);              // NOLINT
+void __real_free(void *ptr);                   // NOLINT
+void *__real_realloc(void *ptr, size_t size);  // NOLINT
+void *__real_calloc(size_t num, size_t size);  // NOLINT
+
+void *__wrap_malloc(size_t size) {  // NOLINT
+  esphome::debug::count_alloc(size);
+  return __real_malloc(size);
+}
+void __wrap_free(void *ptr) {  // NOLINT
+  if (ptr != nullptr)
+    esphome::debug::count_free();
+  __real_free(ptr);
+}
+void *__wrap_realloc(void *ptr, size_t size) {  // NOLINT
+  // a realloc frees the old block and allocates a new one, at least from the point of view of fragmentation
+  if (ptr != nullptr)
+    esphome::debug::count_free();
+  if (size != 0)
+    esphome::debug::count_alloc(size);
+  return __real_realloc(ptr, size);
+}
+void *__wrap_calloc(size_t num, size_t size) {  // NOLINT
+  esphome::debug::count_alloc(num * size);
+  return __real_calloc(num, size);
+}
+}
+#endif
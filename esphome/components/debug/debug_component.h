@@ -1,18 +1,69 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include <vector>
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
 
 namespace esphome {
 namespace debug {
 
-class DebugComponent : public Component {
+class DebugComponent : public PollingComponent {
  public:
+  void setup() override;
   void loop() override;
+  void update() override;
   float get_setup_priority() const override;
+  bool setup_depends_on_previous() const override { return false; }
   void dump_config() override;
 
+#ifdef USE_SENSOR
+  void set_loop_time_sensor(sensor::Sensor *loop_time_sensor) { this->loop_time_sensor_ = loop_time_sensor; }
+  void set_min_free_heap_sensor(sensor::Sensor *min_free_heap_sensor) {
+    this->min_free_heap_sensor_ = min_free_heap_sensor;
+  }
+  void set_largest_free_block_sensor(sensor::Sensor *largest_free_block_sensor) {
+    this->largest_free_block_sensor_ = largest_free_block_sensor;
+  }
+#ifdef USE_RUNTIME_STATS
+  /// Publish the average loop() time of `component` since the last update in milliseconds.
+  void add_component_loop_time_sensor(Component *component, sensor::Sensor *sensor) {
+    this->component_loop_time_sensors_.emplace_back(component, sensor);
+  }
+#endif
+#endif
+
  protected:
+#ifdef USE_RUNTIME_STATS
+  void dump_runtime_stats_();
+#endif
+#ifdef USE_API_BENCHMARK
+  void run_api_benchmark_();
+#endif
+#ifdef USE_ALLOC_STATS
+  void dump_alloc_stats_();
+
+  uint32_t last_alloc_stats_time_{0};
+#endif
+
   uint32_t free_heap_{};
+  /// Lowest free heap seen by loop() since the last update.
+  uint32_t min_free_heap_{UINT32_MAX};
+  uint32_t last_loop_timetag_{0};
+  uint32_t max_loop_time_{0};
+  uint32_t last_flash_write_count_{0};
+
+#ifdef USE_SENSOR
+  sensor::Sensor *loop_time_sensor_{nullptr};
+  sensor::Sensor *min_free_heap_sensor_{nullptr};
+  sensor::Sensor *largest_free_block_sensor_{nullptr};
+#ifdef USE_RUNTIME_STATS
+  std::vector<std::pair<Component *, sensor::Sensor *>> component_loop_time_sensors_;
+#endif
+#endif
 };
 
 }  // namespace debug
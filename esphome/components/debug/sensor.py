@@ -0,0 +1,62 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_COMPONENT_ID,
+    ICON_COUNTER,
+    ICON_TIMER,
+    UNIT_MILLISECOND,
+)
+from . import CONF_DEBUG_ID, DebugComponent
+
+DEPENDENCIES = ["debug"]
+
+CONF_LOOP_TIME = "loop_time"
+CONF_MIN_FREE_HEAP = "min_free_heap"
+CONF_LARGEST_FREE_BLOCK = "largest_free_block"
+CONF_COMPONENT_LOOP_TIME = "component_loop_time"
+
+UNIT_BYTES = "B"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
+        cv.Optional(CONF_LOOP_TIME): sensor.sensor_schema(
+            UNIT_MILLISECOND, ICON_TIMER, 0
+        ),
+        cv.Optional(CONF_MIN_FREE_HEAP): sensor.sensor_schema(
+            UNIT_BYTES, ICON_COUNTER, 0
+        ),
+        cv.Optional(CONF_LARGEST_FREE_BLOCK): sensor.sensor_schema(
+            UNIT_BYTES, ICON_COUNTER, 0
+        ),
+        cv.Optional(CONF_COMPONENT_LOOP_TIME): sensor.sensor_schema(
+            UNIT_MILLISECOND, ICON_TIMER, 2
+        ).extend(
+            {
+                cv.Required(CONF_COMPONENT_ID): cv.use_id(cg.Component),
+            }
+        ),
+    }
+)
+
+
+async def to_code(config):
+    debug_component = await cg.get_variable(config[CONF_DEBUG_ID])
+
+    if CONF_LOOP_TIME in config:
+        sens = await sensor.new_sensor(config[CONF_LOOP_TIME])
+        cg.add(debug_component.set_loop_time_sensor(sens))
+    if CONF_MIN_FREE_HEAP in config:
+        sens = await sensor.new_sensor(config[CONF_MIN_FREE_HEAP])
+        cg.add(debug_component.set_min_free_heap_sensor(sens))
+    if CONF_LARGEST_FREE_BLOCK in config:
+        sens = await sensor.new_sensor(config[CONF_LARGEST_FREE_BLOCK])
+        cg.add(debug_component.set_largest_free_block_sensor(sens))
+    if CONF_COMPONENT_LOOP_TIME in config:
+        conf = config[CONF_COMPONENT_LOOP_TIME]
+        # The loop() times are measured by the profiler
+        cg.add_define("USE_RUNTIME_STATS")
+        component = await cg.get_variable(conf[CONF_COMPONENT_ID])
+        sens = await sensor.new_sensor(conf)
+        cg.add(debug_component.add_component_loop_time_sensor(component, sens))
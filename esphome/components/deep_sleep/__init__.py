@@ -1,13 +1,22 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins, automation
+from esphome.components import sensor
 from esphome.const import (
+    CONF_ATTENUATION,
+    CONF_BUFFER_SIZE,
     CONF_ID,
+    CONF_INTERVAL,
     CONF_MODE,
     CONF_NUMBER,
+    CONF_PIN,
     CONF_PINS,
+    CONF_TRIGGER_ID,
     CONF_RUN_DURATION,
+    CONF_SENSOR,
+    CONF_SENSORS,
     CONF_SLEEP_DURATION,
+    CONF_THRESHOLD,
     CONF_WAKEUP_PIN,
 )
 
@@ -28,6 +37,9 @@ EnterDeepSleepAction = deep_sleep_ns.class_("EnterDeepSleepAction", automation.A
 PreventDeepSleepAction = deep_sleep_ns.class_(
     "PreventDeepSleepAction", automation.Action
 )
+UlpSamplesTrigger = deep_sleep_ns.class_(
+    "UlpSamplesTrigger", automation.Trigger.template(cg.std_vector.template(float))
+)
 
 WakeupPinMode = deep_sleep_ns.enum("WakeupPinMode")
 WAKEUP_PIN_MODES = {
@@ -45,6 +57,77 @@ EXT1_WAKEUP_MODES = {
 
 CONF_WAKEUP_PIN_MODE = "wakeup_pin_mode"
 CONF_ESP32_EXT1_WAKEUP = "esp32_ext1_wakeup"
+CONF_FAST_WAKE = "fast_wake"
+CONF_FULL_WAKE_EVERY = "full_wake_every"
+CONF_UPDATE = "update"
+CONF_ESP32_ULP_ADC = "esp32_ulp_adc"
+CONF_WAKE_ABOVE = "wake_above"
+CONF_WAKE_BELOW = "wake_below"
+CONF_ON_SAMPLES = "on_samples"
+
+# GPIO number to ADC1 channel, the ULP can only sample ADC1
+ULP_ADC_CHANNELS = {36: 0, 37: 1, 38: 2, 39: 3, 32: 4, 33: 5, 34: 6, 35: 7}
+# Attenuation to the voltage of a full scale reading
+ULP_ADC_ATTENUATIONS = {
+    "0db": (cg.global_ns.ADC_ATTEN_DB_0, 1.1),
+    "2.5db": (cg.global_ns.ADC_ATTEN_DB_2_5, 1.5),
+    "6db": (cg.global_ns.ADC_ATTEN_DB_6, 2.2),
+    "11db": (cg.global_ns.ADC_ATTEN_DB_11, 3.9),
+}
+# The samples share the 512 bytes of RTC slow memory reserved for the ULP with
+# its program
+ULP_ADC_MAX_BUFFER_SIZE = 90
+
+FAST_WAKE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_FULL_WAKE_EVERY): cv.int_range(min=1),
+        cv.Optional(
+            CONF_RUN_DURATION, default="5s"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_UPDATE, default=[]): cv.ensure_list(
+            cv.use_id(cg.PollingComponent)
+        ),
+        cv.Required(CONF_SENSORS): cv.ensure_list(
+            cv.Schema(
+                {
+                    cv.Required(CONF_SENSOR): cv.use_id(sensor.Sensor),
+                    cv.Required(CONF_THRESHOLD): cv.positive_float,
+                }
+            )
+        ),
+    }
+)
+
+
+def validate_ulp_adc_pin(value):
+    value = pins.internal_gpio_input_pin_number(value)
+    if value not in ULP_ADC_CHANNELS:
+        raise cv.Invalid("The ULP can only sample the ADC1 pins GPIO32 to GPIO39")
+    return value
+
+
+ESP32_ULP_ADC_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_PIN): validate_ulp_adc_pin,
+        cv.Optional(CONF_ATTENUATION, default="0db"): cv.one_of(
+            *ULP_ADC_ATTENUATIONS, lower=True
+        ),
+        cv.Optional(CONF_INTERVAL, default="10s"): cv.All(
+            cv.positive_time_period_microseconds,
+            cv.Range(min=cv.TimePeriod(milliseconds=1)),
+        ),
+        cv.Optional(CONF_BUFFER_SIZE, default=30): cv.int_range(
+            min=1, max=ULP_ADC_MAX_BUFFER_SIZE
+        ),
+        cv.Optional(CONF_WAKE_ABOVE): cv.voltage,
+        cv.Optional(CONF_WAKE_BELOW): cv.voltage,
+        cv.Optional(CONF_ON_SAMPLES): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UlpSamplesTrigger),
+            }
+        ),
+    }
+)
 
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -68,6 +151,10 @@ CONFIG_SCHEMA = cv.Schema(
                 }
             ),
         ),
+        cv.Optional(CONF_FAST_WAKE): FAST_WAKE_SCHEMA,
+        cv.Optional(CONF_ESP32_ULP_ADC): cv.All(
+            cv.only_on_esp32, ESP32_ULP_ADC_SCHEMA
+        ),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -96,6 +183,45 @@ async def to_code(config):
         )
         cg.add(var.set_ext1_wakeup(struct))
 
+    if CONF_FAST_WAKE in config:
+        conf = config[CONF_FAST_WAKE]
+        cg.add(var.set_full_wake_every(conf[CONF_FULL_WAKE_EVERY]))
+        cg.add(var.set_fast_wake_run_duration(conf[CONF_RUN_DURATION]))
+        for update_id in conf[CONF_UPDATE]:
+            component = await cg.get_variable(update_id)
+            cg.add(var.add_fast_wake_update(component))
+        for sensor_conf in conf[CONF_SENSORS]:
+            sens = await cg.get_variable(sensor_conf[CONF_SENSOR])
+            cg.add(var.add_fast_wake_sensor(sens, sensor_conf[CONF_THRESHOLD]))
+        cg.add_define("USE_DEEP_SLEEP_FAST_WAKE")
+
+    if CONF_ESP32_ULP_ADC in config:
+        conf = config[CONF_ESP32_ULP_ADC]
+        attenuation, full_scale = ULP_ADC_ATTENUATIONS[conf[CONF_ATTENUATION]]
+
+        def to_raw(voltage):
+            return max(0, min(4095, int(round(voltage / full_scale * 4095))))
+
+        cg.add(
+            var.set_ulp_adc(
+                ULP_ADC_CHANNELS[conf[CONF_PIN]],
+                attenuation,
+                full_scale,
+                conf[CONF_INTERVAL].total_microseconds,
+                conf[CONF_BUFFER_SIZE],
+            )
+        )
+        if CONF_WAKE_ABOVE in conf:
+            cg.add(var.set_ulp_adc_wake_above(to_raw(conf[CONF_WAKE_ABOVE])))
+        if CONF_WAKE_BELOW in conf:
+            cg.add(var.set_ulp_adc_wake_below(to_raw(conf[CONF_WAKE_BELOW])))
+        for conf_ in conf.get(CONF_ON_SAMPLES, []):
+            trigger = cg.new_Pvariable(conf_[CONF_TRIGGER_ID], var)
+            await automation.build_automation(
+                trigger, [(cg.std_vector.template(float), "x")], conf_
+            )
+        cg.add_define("USE_DEEP_SLEEP_ULP_ADC")
+
     cg.add_define("USE_DEEP_SLEEP")
 
 
@@ -2,17 +2,61 @@
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 
+#ifdef ARDUINO_ARCH_ESP8266
+#include <user_interface.h>
+#endif
+
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+#include <esp32/ulp.h>
+#endif
+
 namespace esphome {
 namespace deep_sleep {
 
 static const char *const TAG = "deep_sleep";
 
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+/// Word offset of the sample count in RTC slow memory, the samples follow it and the program is before it.
+static const uint16_t ULP_DATA_OFFSET = 32;
+#endif
+
 bool global_has_deep_sleep = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 void DeepSleepComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Deep Sleep...");
   global_has_deep_sleep = true;
 
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+  this->read_ulp_samples_();
+#endif
+
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+  this->fast_wake_pref_ = global_preferences.make_preference<FastWakeState>(0x5A3C9E17UL, false);
+  if (!this->fast_wake_pref_.load(&this->fast_wake_state_))
+    this->fast_wake_state_ = FastWakeState{};
+  for (auto &sensor : this->fast_wake_sensors_) {
+    sensor.pref = global_preferences.make_preference<float>(sensor.sensor->get_object_id_hash() ^ 0x5A3C9E17UL, false);
+  }
+
+  this->fast_wake_state_.wake_count++;
+  this->fast_wake_ = this->is_timer_wake_() && !this->fast_wake_state_.full_wake_requested &&
+                     this->fast_wake_state_.wake_count % this->full_wake_every_ != 0;
+  this->save_fast_wake_state_(false);
+  if (this->fast_wake_) {
+    ESP_LOGI(TAG, "Fast wake %u of %u, not starting the network",
+             unsigned(this->fast_wake_state_.wake_count % this->full_wake_every_),
+             unsigned(this->full_wake_every_ - 1));
+    App.set_setup_cutoff(this->get_setup_priority());
+    for (auto *component : this->fast_wake_updates_)
+      component->update();
+    this->set_timeout(this->fast_wake_run_duration_, [this]() {
+      ESP_LOGW(TAG, "Fast wake sensors did not report in time");
+      this->begin_sleep();
+    });
+    return;
+  }
+#endif
+
   if (this->run_duration_.has_value())
     this->set_timeout(*this->run_duration_, [this]() { this->begin_sleep(); });
 }
@@ -30,11 +74,130 @@ void DeepSleepComponent::dump_config() {
     LOG_PIN("  Wakeup Pin: ", *this->wakeup_pin_);
   }
 #endif
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+  ESP_LOGCONFIG(TAG, "  ULP ADC1 Channel: %u", this->ulp_adc_channel_);
+  ESP_LOGCONFIG(TAG, "    Interval: %u ms", this->ulp_adc_interval_us_ / 1000);
+  ESP_LOGCONFIG(TAG, "    Buffer Size: %u", this->ulp_adc_buffer_size_);
+  if (this->ulp_adc_wake_above_ <= 4095)
+    ESP_LOGCONFIG(TAG, "    Wake Above: %.3f V", this->ulp_adc_wake_above_ * this->ulp_adc_full_scale_ / 4095.0f);
+  if (this->ulp_adc_wake_below_ > 0)
+    ESP_LOGCONFIG(TAG, "    Wake Below: %.3f V", this->ulp_adc_wake_below_ * this->ulp_adc_full_scale_ / 4095.0f);
+#endif
 }
 void DeepSleepComponent::loop() {
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+  if (this->fast_wake_) {
+    this->check_fast_wake_();
+    return;
+  }
+#endif
   if (this->next_enter_deep_sleep_)
     this->begin_sleep();
 }
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+void DeepSleepComponent::add_fast_wake_sensor(sensor::Sensor *sensor, float threshold) {
+  this->fast_wake_sensors_.push_back(FastWakeSensor{sensor, threshold, ESPPreferenceObject()});
+}
+bool DeepSleepComponent::is_timer_wake_() {
+#ifdef ARDUINO_ARCH_ESP32
+  return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+  return ESP.getResetInfoPtr()->reason == REASON_DEEP_SLEEP_AWAKE;
+#endif
+}
+void DeepSleepComponent::check_fast_wake_() {
+  for (auto &sensor : this->fast_wake_sensors_) {
+    if (!sensor.sensor->has_state())
+      return;
+  }
+  for (auto &sensor : this->fast_wake_sensors_) {
+    float reported;
+    const float state = sensor.sensor->get_state();
+    if (!sensor.pref.load(&reported) || std::isnan(reported) != std::isnan(state) ||
+        fabsf(state - reported) >= sensor.threshold) {
+      ESP_LOGI(TAG, "'%s' changed significantly, restarting into a full wake", sensor.sensor->get_name().c_str());
+      this->save_fast_wake_state_(true);
+      App.safe_reboot();
+      return;
+    }
+  }
+  ESP_LOGD(TAG, "No significant change in this fast wake");
+  this->begin_sleep(true);
+}
+void DeepSleepComponent::save_fast_wake_state_(bool full_wake_requested) {
+  this->fast_wake_state_.full_wake_requested = full_wake_requested;
+  this->fast_wake_pref_.save(&this->fast_wake_state_);
+}
+#endif
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+void DeepSleepComponent::set_ulp_adc(uint8_t channel, adc_atten_t attenuation, float full_scale,
+                                     uint32_t interval_us, uint8_t buffer_size) {
+  this->ulp_adc_channel_ = channel;
+  this->ulp_adc_attenuation_ = attenuation;
+  this->ulp_adc_full_scale_ = full_scale;
+  this->ulp_adc_interval_us_ = interval_us;
+  this->ulp_adc_buffer_size_ = buffer_size;
+}
+void DeepSleepComponent::read_ulp_samples_() {
+  // RTC slow memory holds garbage after a power on, only a wake from deep sleep has samples
+  const esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+  if (cause == ESP_SLEEP_WAKEUP_UNDEFINED)
+    return;
+  // The ULP stores its values in the lower half of the words
+  const uint16_t count = std::min<uint16_t>(RTC_SLOW_MEM[ULP_DATA_OFFSET] & 0xFFFF, this->ulp_adc_buffer_size_);
+  std::vector<float> samples;
+  samples.reserve(count);
+  for (uint16_t i = 0; i < count; i++) {
+    const uint16_t raw = RTC_SLOW_MEM[ULP_DATA_OFFSET + 1 + i] & 0xFFFF;
+    samples.push_back(raw * this->ulp_adc_full_scale_ / 4095.0f);
+  }
+  RTC_SLOW_MEM[ULP_DATA_OFFSET] = 0;
+  ESP_LOGD(TAG, "The ULP took %u samples%s", count, cause == ESP_SLEEP_WAKEUP_ULP ? " and woke up" : "");
+  if (count > 0)
+    this->ulp_samples_callback_.call(samples);
+}
+void DeepSleepComponent::start_ulp_() {
+  enum { LABEL_WAKE = 1 };
+  // clang-format off
+  const ulp_insn_t program[] = {
+      I_ADC(R0, 0, this->ulp_adc_channel_),       // R0 = sample of the ADC1 channel
+      I_MOVI(R3, ULP_DATA_OFFSET),
+      I_LD(R1, R3, 0),                            // R1 = sample count
+      I_ADDR(R2, R3, R1),
+      I_ST(R0, R2, 1),                            // samples[count] = R0
+      I_ADDI(R1, R1, 1),
+      I_ST(R1, R3, 0),                            // count++
+      M_BGE(LABEL_WAKE, this->ulp_adc_wake_above_),
+      M_BL(LABEL_WAKE, this->ulp_adc_wake_below_),
+      I_MOVR(R0, R1),
+      M_BGE(LABEL_WAKE, this->ulp_adc_buffer_size_),
+      I_HALT(),                                   // until the next period of the ULP timer
+      M_LABEL(LABEL_WAKE),
+      I_WAKE(),
+      I_END(),                                    // stop the ULP timer, the main CPU reads the samples
+      I_HALT(),
+  };
+  // clang-format on
+  adc1_config_width(ADC_WIDTH_BIT_12);
+  adc1_config_channel_atten(adc1_channel_t(this->ulp_adc_channel_), this->ulp_adc_attenuation_);
+  adc1_ulp_enable();
+
+  RTC_SLOW_MEM[ULP_DATA_OFFSET] = 0;
+  size_t size = sizeof(program) / sizeof(ulp_insn_t);
+  esp_err_t err = ulp_process_macros_and_load(0, program, &size);
+  if (err == ESP_OK && size > ULP_DATA_OFFSET)
+    err = ESP_ERR_NO_MEM;
+  if (err == ESP_OK)
+    err = ulp_set_wakeup_period(0, this->ulp_adc_interval_us_);
+  if (err == ESP_OK)
+    err = esp_sleep_enable_ulp_wakeup();
+  if (err == ESP_OK)
+    err = ulp_run(0);
+  if (err != ESP_OK)
+    ESP_LOGE(TAG, "Starting the ULP failed: %d", err);
+}
+#endif
 float DeepSleepComponent::get_loop_priority() const {
   return -100.0f;  // run after everything else is ready
 }
@@ -66,6 +229,18 @@ void DeepSleepComponent::begin_sleep(bool manual) {
 
   ESP_LOGI(TAG, "Beginning Deep Sleep");
 
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+  // After a full wake, the states reported now are what the next fast wakes compare to
+  if (!this->fast_wake_) {
+    for (auto &sensor : this->fast_wake_sensors_) {
+      if (sensor.sensor->has_state()) {
+        float state = sensor.sensor->get_state();
+        sensor.pref.save(&state);
+      }
+    }
+  }
+#endif
+
   App.run_safe_shutdown_hooks();
 
 #ifdef ARDUINO_ARCH_ESP32
@@ -80,6 +255,9 @@ void DeepSleepComponent::begin_sleep(bool manual) {
   if (this->ext1_wakeup_.has_value()) {
     esp_sleep_enable_ext1_wakeup(this->ext1_wakeup_->mask, this->ext1_wakeup_->wakeup_mode);
   }
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+  this->start_ulp_();
+#endif
   esp_deep_sleep_start();
 #endif
 
@@ -87,7 +265,14 @@ void DeepSleepComponent::begin_sleep(bool manual) {
   ESP.deepSleep(*this->sleep_duration_);
 #endif
 }
-float DeepSleepComponent::get_setup_priority() const { return setup_priority::LATE; }
+float DeepSleepComponent::get_setup_priority() const {
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+  // Decide whether to skip the network before it is set up
+  return setup_priority::WIFI + 1.0f;
+#else
+  return setup_priority::LATE;
+#endif
+}
 void DeepSleepComponent::prevent_deep_sleep() { this->prevent_ = true; }
 
 }  // namespace deep_sleep
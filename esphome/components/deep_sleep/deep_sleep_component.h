@@ -3,6 +3,15 @@
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/preferences.h"
+
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+#include <driver/adc.h>
+#endif
 
 namespace esphome {
 namespace deep_sleep {
@@ -55,6 +64,39 @@ class DeepSleepComponent : public Component {
 #endif
   /// Set a duration in ms for how long the code should run before entering deep sleep mode.
   void set_run_duration(uint32_t time_ms);
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+  /** Only do a full wake with network every `full_wake_every` wakes from the sleep timer.
+   *
+   * The other wakes skip WiFi and all components set up after it. They sample the fast wake sensors and go back
+   * to sleep, unless one of them changed by at least its threshold since the last full wake. In that case the
+   * node restarts into a full wake right away.
+   */
+  void set_full_wake_every(uint32_t full_wake_every) { this->full_wake_every_ = full_wake_every; }
+  /// Longest time a fast wake waits for the states of the fast wake sensors in ms.
+  void set_fast_wake_run_duration(uint32_t time_ms) { this->fast_wake_run_duration_ = time_ms; }
+  /// Request an update of this component right after a fast wake, for sensors with a long update interval.
+  void add_fast_wake_update(PollingComponent *component) { this->fast_wake_updates_.push_back(component); }
+  void add_fast_wake_sensor(sensor::Sensor *sensor, float threshold);
+  /// Whether this boot is a fast wake without network.
+  bool is_fast_wake() const { return this->fast_wake_; }
+#endif
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+  /** Sample an ADC1 channel with the ULP coprocessor every `interval_us` during deep sleep.
+   *
+   * The raw samples accumulate in RTC slow memory and the ULP only wakes the main CPU once `buffer_size` of them
+   * were taken or one of them crossed a wake threshold. The samples are passed to the callbacks after the wake.
+   */
+  void set_ulp_adc(uint8_t channel, adc_atten_t attenuation, float full_scale, uint32_t interval_us,
+                   uint8_t buffer_size);
+  /// Wake as soon as a raw 12 bit sample is at least this value.
+  void set_ulp_adc_wake_above(uint16_t raw) { this->ulp_adc_wake_above_ = raw; }
+  /// Wake as soon as a raw 12 bit sample is below this value.
+  void set_ulp_adc_wake_below(uint16_t raw) { this->ulp_adc_wake_below_ = raw; }
+  /// Called in setup with the voltages sampled by the ULP during the last deep sleep, oldest first.
+  void add_on_ulp_samples_callback(std::function<void(std::vector<float>)> callback) {
+    this->ulp_samples_callback_.add(std::move(callback));
+  }
+#endif
 
   void setup() override;
   void dump_config() override;
@@ -77,16 +119,68 @@ class DeepSleepComponent : public Component {
   optional<uint32_t> run_duration_;
   bool next_enter_deep_sleep_{false};
   bool prevent_{false};
+#ifdef USE_DEEP_SLEEP_FAST_WAKE
+  /// Kept in RTC memory across deep sleep.
+  struct FastWakeState {
+    uint32_t wake_count;
+    bool full_wake_requested;
+  };
+  struct FastWakeSensor {
+    sensor::Sensor *sensor;
+    float threshold;
+    /// The state reported in the last full wake, in RTC memory.
+    ESPPreferenceObject pref;
+  };
+
+  bool is_timer_wake_();
+  /// Called in the loop of a fast wake until all fast wake sensors have a state or the run duration is over.
+  void check_fast_wake_();
+  void save_fast_wake_state_(bool full_wake_requested);
+
+  uint32_t full_wake_every_{1};
+  uint32_t fast_wake_run_duration_{5000};
+  std::vector<PollingComponent *> fast_wake_updates_;
+  std::vector<FastWakeSensor> fast_wake_sensors_;
+  ESPPreferenceObject fast_wake_pref_;
+  FastWakeState fast_wake_state_{};
+  bool fast_wake_{false};
+#endif
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+  /// Read the samples the ULP took during the last deep sleep and pass them to the callbacks.
+  void read_ulp_samples_();
+  /// Load the sampling program into RTC slow memory and start the ULP timer.
+  void start_ulp_();
+
+  uint8_t ulp_adc_channel_{0};
+  adc_atten_t ulp_adc_attenuation_{ADC_ATTEN_DB_0};
+  float ulp_adc_full_scale_{1.1f};
+  uint32_t ulp_adc_interval_us_{10000000};
+  uint8_t ulp_adc_buffer_size_{30};
+  /// Above every 12 bit sample, so never trips unless set.
+  uint16_t ulp_adc_wake_above_{0xFFFF};
+  /// No sample is below 0, so never trips unless set.
+  uint16_t ulp_adc_wake_below_{0};
+  CallbackManager<void(std::vector<float>)> ulp_samples_callback_;
+#endif
 };
 
 extern bool global_has_deep_sleep;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
+#ifdef USE_DEEP_SLEEP_ULP_ADC
+class UlpSamplesTrigger : public Trigger<std::vector<float>> {
+ public:
+  explicit UlpSamplesTrigger(DeepSleepComponent *parent) {
+    parent->add_on_ulp_samples_callback([this](std::vector<float> samples) { this->trigger(std::move(samples)); });
+  }
+};
+#endif
+
 template<typename... Ts> class EnterDeepSleepAction : public Action<Ts...> {
  public:
   EnterDeepSleepAction(DeepSleepComponent *deep_sleep) : deep_sleep_(deep_sleep) {}
   TEMPLATABLE_VALUE(uint32_t, sleep_duration);
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     if (this->sleep_duration_.has_value()) {
       this->deep_sleep_->set_sleep_duration(this->sleep_duration_.value(x...));
     }
@@ -101,7 +195,7 @@ template<typename... Ts> class PreventDeepSleepAction : public Action<Ts...> {
  public:
   PreventDeepSleepAction(DeepSleepComponent *deep_sleep) : deep_sleep_(deep_sleep) {}
 
-  void play(Ts... x) override { this->deep_sleep_->prevent_deep_sleep(); }
+  void play(const Ts &... x) override { this->deep_sleep_->prevent_deep_sleep(); }
 
  protected:
   DeepSleepComponent *deep_sleep_;
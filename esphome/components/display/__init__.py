@@ -32,8 +32,16 @@ DisplayIsDisplayingPageCondition = display_ns.class_(
     "DisplayIsDisplayingPageCondition", automation.Condition
 )
 DisplayOnPageChangeTrigger = display_ns.class_("DisplayOnPageChangeTrigger")
+DisplayBenchmarkAction = display_ns.class_("DisplayBenchmarkAction", automation.Action)
+Font = display_ns.class_("Font")
+Image = display_ns.class_("Image")
 
 CONF_ON_PAGE_CHANGE = "on_page_change"
+CONF_DOUBLE_BUFFER = "double_buffer"
+CONF_BUFFER_MEMORY = "buffer_memory"
+CONF_FONTS = "fonts"
+CONF_IMAGES = "images"
+CONF_ITERATIONS = "iterations"
 
 DISPLAY_ROTATIONS = {
     0: display_ns.DISPLAY_ROTATION_0_DEGREES,
@@ -42,6 +50,13 @@ DISPLAY_ROTATIONS = {
     270: display_ns.DISPLAY_ROTATION_270_DEGREES,
 }
 
+BufferMemory = display_ns.enum("BufferMemory")
+BUFFER_MEMORIES = {
+    "AUTO": BufferMemory.BUFFER_MEMORY_AUTO,
+    "INTERNAL": BufferMemory.BUFFER_MEMORY_INTERNAL,
+    "PSRAM": BufferMemory.BUFFER_MEMORY_PSRAM,
+}
+
 
 def validate_rotation(value):
     value = cv.string(value)
@@ -59,6 +74,9 @@ BASIC_DISPLAY_SCHEMA = cv.Schema(
 FULL_DISPLAY_SCHEMA = BASIC_DISPLAY_SCHEMA.extend(
     {
         cv.Optional(CONF_ROTATION): validate_rotation,
+        cv.Optional(CONF_BUFFER_MEMORY, default="AUTO"): cv.enum(
+            BUFFER_MEMORIES, upper=True
+        ),
         cv.Optional(CONF_PAGES): cv.All(
             cv.ensure_list(
                 {
@@ -84,6 +102,8 @@ FULL_DISPLAY_SCHEMA = BASIC_DISPLAY_SCHEMA.extend(
 async def setup_display_core_(var, config):
     if CONF_ROTATION in config:
         cg.add(var.set_rotation(DISPLAY_ROTATIONS[config[CONF_ROTATION]]))
+    if config.get(CONF_BUFFER_MEMORY, "AUTO") != "AUTO":
+        cg.add(var.set_buffer_memory(config[CONF_BUFFER_MEMORY]))
     if CONF_PAGES in config:
         pages = []
         for conf in config[CONF_PAGES]:
@@ -158,6 +178,33 @@ async def display_page_show_previous_to_code(config, action_id, template_arg, ar
     return cg.new_Pvariable(action_id, template_arg, paren)
 
 
+@automation.register_action(
+    "display.benchmark",
+    DisplayBenchmarkAction,
+    maybe_simple_id(
+        {
+            cv.Required(CONF_ID): cv.use_id(DisplayBuffer),
+            cv.Optional(CONF_FONTS, default=[]): cv.ensure_list(cv.use_id(Font)),
+            cv.Optional(CONF_IMAGES, default=[]): cv.ensure_list(cv.use_id(Image)),
+            cv.Optional(CONF_ITERATIONS, default=20): cv.int_range(min=1),
+        }
+    ),
+)
+async def display_benchmark_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    fonts = []
+    for font_id in config[CONF_FONTS]:
+        fonts.append(await cg.get_variable(font_id))
+    cg.add(var.set_fonts(fonts))
+    images = []
+    for image_id in config[CONF_IMAGES]:
+        images.append(await cg.get_variable(image_id))
+    cg.add(var.set_images(images))
+    cg.add(var.set_iterations(config[CONF_ITERATIONS]))
+    return var
+
+
 @automation.register_condition(
     "display.is_displaying_page",
     DisplayIsDisplayingPageCondition,
@@ -2,7 +2,11 @@
 
 #include "esphome/core/application.h"
 #include "esphome/core/color.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <utility>
 
 namespace esphome {
@@ -13,13 +17,34 @@ static const char *const TAG = "display";
 const Color COLOR_OFF(0, 0, 0, 0);
 const Color COLOR_ON(255, 255, 255, 255);
 
+static LargeBufferUsage display_usage("display");  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+uint8_t *DisplayBuffer::allocate_buffer_(uint32_t length) {
+  bool psram = this->buffer_memory_ == BUFFER_MEMORY_PSRAM ||
+               (this->buffer_memory_ == BUFFER_MEMORY_AUTO && length >= PSRAM_BUFFER_THRESHOLD);
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->buffer_memory_ == BUFFER_MEMORY_PSRAM && !psramFound())
+    ESP_LOGW(TAG, "No PSRAM found, display buffer is put in internal RAM");
+#endif
+  return static_cast<uint8_t *>(
+      large_buffer_allocate(length, &display_usage, psram ? LARGE_BUFFER_PSRAM : LARGE_BUFFER_INTERNAL));
+}
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
-  this->buffer_ = new uint8_t[buffer_length];
+  this->buffer_ = this->allocate_buffer_(buffer_length);
   if (this->buffer_ == nullptr) {
     ESP_LOGE(TAG, "Could not allocate buffer for display!");
     return;
   }
   this->clear();
+
+  if (this->double_buffer_) {
+    this->back_buffer_ = this->allocate_buffer_(buffer_length);
+    if (this->back_buffer_ == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate second buffer for display, using a single one");
+      return;
+    }
+    memcpy(this->back_buffer_, this->buffer_, buffer_length);
+  }
 }
 void DisplayBuffer::fill(Color color) { this->filled_rectangle(0, 0, this->get_width(), this->get_height(), color); }
 void DisplayBuffer::clear() { this->fill(COLOR_OFF); }
@@ -87,14 +112,10 @@ void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, Color color) {
   }
 }
 void HOT DisplayBuffer::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
+  this->filled_rectangle(x, y, width, 1, color);
 }
 void HOT DisplayBuffer::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+  this->filled_rectangle(x, y, 1, height, color);
 }
 void DisplayBuffer::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
@@ -102,10 +123,64 @@ void DisplayBuffer::rectangle(int x1, int y1, int width, int height, Color color
   this->vertical_line(x1, y1, height, color);
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
-void DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+void HOT DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, Color color) {
+  // Clip to the screen so drivers can fill their buffer without checking every pixel
+  if (x1 < 0) {
+    width += x1;
+    x1 = 0;
+  }
+  if (y1 < 0) {
+    height += y1;
+    y1 = 0;
+  }
+  width = std::min(width, this->get_width() - x1);
+  height = std::min(height, this->get_height() - y1);
+  if (width <= 0 || height <= 0)
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      std::swap(x1, y1);
+      std::swap(width, height);
+      x1 = this->get_width_internal() - x1 - width;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      x1 = this->get_width_internal() - x1 - width;
+      y1 = this->get_height_internal() - y1 - height;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      std::swap(x1, y1);
+      std::swap(width, height);
+      y1 = this->get_height_internal() - y1 - height;
+      break;
+  }
+  this->fill_absolute_rect_internal(x1, y1, width, height, color);
+  App.feed_wdt();
+}
+void HOT DisplayBuffer::draw_packed_bitmap_(int x, int y, const uint8_t *data, int width, int height, Color color) {
+  const int stride = (width + 7) / 8;
+  for (int row = 0; row < height; row++, data += stride) {
+    uint8_t bits = 0;
+    int run_start = -1;
+    for (int col = 0; col <= width; col++) {
+      if (col % 8 == 0 && col < width)
+        bits = pgm_read_byte(data + col / 8);
+      const bool set = col < width && (bits & (0x80 >> (col % 8)));
+      if (set && run_start < 0) {
+        run_start = col;
+      } else if (!set && run_start >= 0) {
+        this->filled_rectangle(x + run_start, y + row, col - run_start, 1, color);
+        run_start = -1;
+      }
+    }
+  }
+}
+void HOT DisplayBuffer::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      this->draw_absolute_pixel_internal(i, j, color);
   }
 }
 void HOT DisplayBuffer::circle(int center_x, int center_xy, int radius, Color color) {
@@ -173,9 +248,7 @@ void DisplayBuffer::print(int x, int y, Font *font, Color color, TextAlign align
       ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
       if (!font->get_glyphs().empty()) {
         uint8_t glyph_width = font->get_glyphs()[0].glyph_data_->width;
-        for (int glyph_x = 0; glyph_x < glyph_width; glyph_x++)
-          for (int glyph_y = 0; glyph_y < height; glyph_y++)
-            this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
+        this->filled_rectangle(x_at, y_start, glyph_width, height, color);
         x_at += glyph_width;
       }
 
@@ -184,16 +257,9 @@ void DisplayBuffer::print(int x, int y, Font *font, Color color, TextAlign align
     }
 
     const Glyph &glyph = font->get_glyphs()[glyph_n];
-    int scan_x1, scan_y1, scan_width, scan_height;
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
-
-    for (int glyph_x = scan_x1; glyph_x < scan_x1 + scan_width; glyph_x++) {
-      for (int glyph_y = scan_y1; glyph_y < scan_y1 + scan_height; glyph_y++) {
-        if (glyph.get_pixel(glyph_x, glyph_y)) {
-          this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
-        }
-      }
-    }
+    const GlyphData *data = glyph.glyph_data_;
+    this->draw_packed_bitmap_(x_at + data->offset_x, y_start + data->offset_y, data->data, data->width, data->height,
+                              color);
 
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
 
@@ -207,26 +273,80 @@ void DisplayBuffer::vprintf_(int x, int y, Font *font, Color color, TextAlign al
     this->print(x, y, font, color, align, buffer);
 }
 
+DisplayBuffer::RotationTransform DisplayBuffer::get_rotation_transform_() {
+  const int w = this->get_width_internal() - 1;
+  const int h = this->get_height_internal() - 1;
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_90_DEGREES:
+      return {w, 0, -1, 0, 1, 0};
+    case DISPLAY_ROTATION_180_DEGREES:
+      return {w, -1, 0, h, 0, -1};
+    case DISPLAY_ROTATION_270_DEGREES:
+      return {0, 0, 1, h, -1, 0};
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      return {0, 1, 0, 0, 0, 1};
+  }
+}
+template<typename F>
+void HOT DisplayBuffer::blit_(int x, int y, int x_start, int y_start, int x_end, int y_end, F &&color_at) {
+  const RotationTransform t = this->get_rotation_transform_();
+  if (t.xy == 0) {
+    // Source rows are buffer rows
+    for (int src_y = y_start; src_y < y_end; src_y++) {
+      const int abs_y = t.y0 + (y + src_y) * t.yy;
+      for (int src_x = x_start; src_x < x_end; src_x++)
+        this->draw_absolute_pixel_internal(t.x0 + (x + src_x) * t.xx, abs_y, color_at(src_x, src_y));
+      App.feed_wdt();
+    }
+  } else {
+    // Rotated by 90 or 270 degrees, source columns are buffer rows
+    for (int src_x = x_start; src_x < x_end; src_x++) {
+      const int abs_y = t.y0 + (x + src_x) * t.yx;
+      for (int src_y = y_start; src_y < y_end; src_y++)
+        this->draw_absolute_pixel_internal(t.x0 + (y + src_y) * t.xy, abs_y, color_at(src_x, src_y));
+      App.feed_wdt();
+    }
+  }
+}
 void DisplayBuffer::image(int x, int y, Image *image, Color color_on, Color color_off) {
+  // Clip once, the blits don't check every pixel
+  const int x_start = std::max(0, -x);
+  const int y_start = std::max(0, -y);
+  const int x_end = std::min(image->get_width(), this->get_width() - x);
+  const int y_end = std::min(image->get_height(), this->get_height() - y);
+  if (x_start >= x_end || y_start >= y_end)
+    return;
+
   switch (image->get_type()) {
     case IMAGE_TYPE_BINARY:
-      for (int img_x = 0; img_x < image->get_width(); img_x++) {
-        for (int img_y = 0; img_y < image->get_height(); img_y++) {
-          this->draw_pixel_at(x + img_x, y + img_y, image->get_pixel(img_x, img_y) ? color_on : color_off);
-        }
-      }
+      this->blit_(x, y, x_start, y_start, x_end, y_end, [image, color_on, color_off](int img_x, int img_y) {
+        return image->get_pixel(img_x, img_y) ? color_on : color_off;
+      });
       break;
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < image->get_width(); img_x++) {
-        for (int img_y = 0; img_y < image->get_height(); img_y++) {
-          this->draw_pixel_at(x + img_x, y + img_y, image->get_grayscale_pixel(img_x, img_y));
-        }
-      }
+      this->blit_(x, y, x_start, y_start, x_end, y_end,
+                  [image](int img_x, int img_y) { return image->get_grayscale_pixel(img_x, img_y); });
       break;
     case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < image->get_width(); img_x++) {
-        for (int img_y = 0; img_y < image->get_height(); img_y++) {
-          this->draw_pixel_at(x + img_x, y + img_y, image->get_color_pixel(img_x, img_y));
+      this->blit_(x, y, x_start, y_start, x_end, y_end,
+                  [image](int img_x, int img_y) { return image->get_color_pixel(img_x, img_y); });
+      break;
+    case IMAGE_TYPE_RLE:
+      // Decode row by row, every run goes to the driver as one rectangle
+      for (int img_y = 0; img_y < image->get_height(); img_y++) {
+        const uint8_t *row = image->get_rle_row(img_y);
+        int img_x = 0;
+        while (img_x < image->get_width()) {
+          const uint8_t control = pgm_read_byte(row++);
+          if (control < 128) {
+            const int length = control + 1;
+            this->filled_rectangle(x + img_x, y + img_y, length, 1, image->get_palette_color(pgm_read_byte(row++)));
+            img_x += length;
+          } else {
+            for (int i = control - 127; i > 0; i--, img_x++)
+              this->draw_pixel_at(x + img_x, y + img_y, image->get_palette_color(pgm_read_byte(row++)));
+          }
         }
       }
       break;
@@ -280,6 +400,18 @@ void DisplayBuffer::print(int x, int y, Font *font, TextAlign align, const char
 void DisplayBuffer::print(int x, int y, Font *font, const char *text) {
   this->print(x, y, font, COLOR_ON, TextAlign::TOP_LEFT, text);
 }
+void DisplayBuffer::print_value(int x, int y, Font *font, Color color, TextAlign align, float value,
+                                int8_t accuracy_decimals, const char *suffix) {
+  char buffer[64];
+  size_t len = value_accuracy_to_buf(buffer, sizeof(buffer), value, accuracy_decimals);
+  const size_t suffix_len = std::min(strlen(suffix), sizeof(buffer) - 1 - len);
+  memcpy(buffer + len, suffix, suffix_len);
+  buffer[len + suffix_len] = '\0';
+  this->print(x, y, font, color, align, buffer);
+}
+void DisplayBuffer::print_value(int x, int y, Font *font, float value, int8_t accuracy_decimals, const char *suffix) {
+  this->print_value(x, y, font, COLOR_ON, TextAlign::TOP_LEFT, value, accuracy_decimals, suffix);
+}
 void DisplayBuffer::printf(int x, int y, Font *font, Color color, TextAlign align, const char *format, ...) {
   va_list arg;
   va_start(arg, format);
@@ -328,12 +460,78 @@ void DisplayBuffer::show_page(DisplayPage *page) {
 void DisplayBuffer::show_next_page() { this->page_->show_next(); }
 void DisplayBuffer::show_prev_page() { this->page_->show_prev(); }
 void DisplayBuffer::do_update_() {
+  if (this->is_double_buffered_()) {
+    // The buffer the last frame was rendered into may still be on its way to the display
+    std::swap(this->buffer_, this->back_buffer_);
+    this->clear_dirty_();
+  }
+
   this->clear();
   if (this->page_ != nullptr) {
     this->page_->get_writer()(*this);
   } else if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
+
+  if (this->is_double_buffered_()) {
+    // This buffer holds the frame before the last one: whatever changed between it and the last frame has to be
+    // sent as well to bring the display from the last frame to this one.
+    const int16_t x_low = this->dirty_x_low_, y_low = this->dirty_y_low_;
+    const int16_t x_high = this->dirty_x_high_, y_high = this->dirty_y_high_;
+    this->dirty_x_low_ = std::min(x_low, this->frame_dirty_x_low_);
+    this->dirty_y_low_ = std::min(y_low, this->frame_dirty_y_low_);
+    this->dirty_x_high_ = std::max(x_high, this->frame_dirty_x_high_);
+    this->dirty_y_high_ = std::max(y_high, this->frame_dirty_y_high_);
+    this->frame_dirty_x_low_ = x_low;
+    this->frame_dirty_y_low_ = y_low;
+    this->frame_dirty_x_high_ = x_high;
+    this->frame_dirty_y_high_ = y_high;
+  }
+}
+void DisplayBuffer::run_benchmark(const std::vector<Font *> &fonts, const std::vector<Image *> &images,
+                                  uint32_t iterations) {
+  const int width = this->get_width();
+  const int height = this->get_height();
+  ESP_LOGI(TAG, "Benchmark of a %dx%d display, average of %u calls:", width, height, iterations);
+
+  auto run = [iterations](const char *name, const std::function<void(uint32_t)> &operation) {
+    const uint32_t start = micros();
+    for (uint32_t i = 0; i < iterations; i++)
+      operation(i);
+    const uint32_t elapsed = micros() - start;
+    ESP_LOGI(TAG, "  %-24s %10.1f us", name, elapsed / float(iterations));
+    (void) elapsed;  // Only used by the log, which may be compiled out
+    App.feed_wdt();
+  };
+  // Alternate the color so drivers that skip unchanged pixels still do the work
+  auto color = [](uint32_t i) { return i & 1 ? COLOR_OFF : COLOR_ON; };
+
+  run("fill", [this, &color](uint32_t i) { this->fill(color(i)); });
+  run("line", [this, &color, width, height](uint32_t i) { this->line(0, 0, width - 1, height - 1, color(i)); });
+  run("horizontal_line", [this, &color, width, height](uint32_t i) {
+    this->horizontal_line(0, height / 2, width, color(i));
+  });
+  run("filled_rectangle", [this, &color, width, height](uint32_t i) {
+    this->filled_rectangle(width / 4, height / 4, width / 2, height / 2, color(i));
+  });
+  run("circle", [this, &color, width, height](uint32_t i) {
+    this->circle(width / 2, height / 2, std::min(width, height) / 4, color(i));
+  });
+  run("filled_circle", [this, &color, width, height](uint32_t i) {
+    this->filled_circle(width / 2, height / 2, std::min(width, height) / 4, color(i));
+  });
+
+  char name[32];
+  for (size_t n = 0; n < fonts.size(); n++) {
+    Font *font = fonts[n];
+    snprintf(name, sizeof(name), "print (font %u)", unsigned(n));
+    run(name, [this, &color, font](uint32_t i) { this->print(0, 0, font, color(i), "Hello World 12:34"); });
+  }
+  for (size_t n = 0; n < images.size(); n++) {
+    Image *image = images[n];
+    snprintf(name, sizeof(name), "image (%dx%d)", image->get_width(), image->get_height());
+    run(name, [this, image](uint32_t i) { this->image(0, 0, image); });
+  }
 }
 void DisplayOnPageChangeTrigger::process(DisplayPage *from, DisplayPage *to) {
   if ((this->from_ == nullptr || this->from_ == from) && (this->to_ == nullptr || this->to_ == to))
@@ -341,19 +539,19 @@ void DisplayOnPageChangeTrigger::process(DisplayPage *from, DisplayPage *to) {
 }
 #ifdef USE_TIME
 void DisplayBuffer::strftime(int x, int y, Font *font, Color color, TextAlign align, const char *format,
-                             time::ESPTime time) {
+                             const time::ESPTime &time) {
   char buffer[64];
   size_t ret = time.strftime(buffer, sizeof(buffer), format);
   if (ret > 0)
     this->print(x, y, font, color, align, buffer);
 }
-void DisplayBuffer::strftime(int x, int y, Font *font, Color color, const char *format, time::ESPTime time) {
+void DisplayBuffer::strftime(int x, int y, Font *font, Color color, const char *format, const time::ESPTime &time) {
   this->strftime(x, y, font, color, TextAlign::TOP_LEFT, format, time);
 }
-void DisplayBuffer::strftime(int x, int y, Font *font, TextAlign align, const char *format, time::ESPTime time) {
+void DisplayBuffer::strftime(int x, int y, Font *font, TextAlign align, const char *format, const time::ESPTime &time) {
   this->strftime(x, y, font, COLOR_ON, align, format, time);
 }
-void DisplayBuffer::strftime(int x, int y, Font *font, const char *format, time::ESPTime time) {
+void DisplayBuffer::strftime(int x, int y, Font *font, const char *format, const time::ESPTime &time) {
   this->strftime(x, y, font, COLOR_ON, TextAlign::TOP_LEFT, format, time);
 }
 #endif
@@ -401,6 +599,12 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
   *height = this->glyph_data_->height;
 }
 int Font::match_next_glyph(const char *str, int *match_length) {
+  const uint8_t c = str[0];
+  if (c < 128 && this->ascii_glyphs_[c] >= 0) {
+    *match_length = 1;
+    return this->ascii_glyphs_[c];
+  }
+
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -450,11 +654,28 @@ const std::vector<Glyph> &Font::get_glyphs() const { return this->glyphs_; }
 Font::Font(const GlyphData *data, int data_nr, int baseline, int bottom) : baseline_(baseline), bottom_(bottom) {
   for (int i = 0; i < data_nr; ++i)
     glyphs_.emplace_back(data + i);
+
+  // Skip the binary search for plain ASCII, unless a longer glyph starts with the character and has to win
+  for (auto &index : this->ascii_glyphs_)
+    index = -1;
+  for (int i = 0; i < data_nr; ++i) {
+    const uint8_t c = data[i].a_char[0];
+    if (c >= 128 || c == '\0')
+      continue;
+    if (data[i].a_char[1] == '\0') {
+      if (this->ascii_glyphs_[c] == -1)
+        this->ascii_glyphs_[c] = i;
+    } else {
+      this->ascii_glyphs_[c] = -2;
+    }
+  }
 }
 
 bool Image::get_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return false;
+  if (this->type_ == IMAGE_TYPE_RLE)
+    return this->get_rle_pixel_(this->get_rle_row(y), x).is_on();
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t pos = x + y * width_8;
   return pgm_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
@@ -462,6 +683,8 @@ bool Image::get_pixel(int x, int y) const {
 Color Image::get_color_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
+  if (this->type_ == IMAGE_TYPE_RLE)
+    return this->get_rle_pixel_(this->get_rle_row(y), x);
   const uint32_t pos = (x + y * this->width_) * 3;
   const uint32_t color32 = (pgm_read_byte(this->data_start_ + pos + 2) << 0) |
                            (pgm_read_byte(this->data_start_ + pos + 1) << 8) |
@@ -471,6 +694,8 @@ Color Image::get_color_pixel(int x, int y) const {
 Color Image::get_grayscale_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
+  if (this->type_ == IMAGE_TYPE_RLE)
+    return this->get_rle_pixel_(this->get_rle_row(y), x);
   const uint32_t pos = (x + y * this->width_);
   const uint8_t gray = pgm_read_byte(this->data_start_ + pos);
   return Color(gray | gray << 8 | gray << 16 | gray << 24);
@@ -478,12 +703,43 @@ Color Image::get_grayscale_pixel(int x, int y) const {
 int Image::get_width() const { return this->width_; }
 int Image::get_height() const { return this->height_; }
 ImageType Image::get_type() const { return this->type_; }
+Color Image::get_palette_color(uint8_t index) const {
+  const uint8_t *color = this->data_start_ + 1 + index * 2;
+  const uint16_t color565 = (pgm_read_byte(color) << 8) | pgm_read_byte(color + 1);
+  return ColorUtil::to_color(color565, COLOR_ORDER_RGB, COLOR_BITNESS_565, true);
+}
+const uint8_t *Image::get_rle_row(int y) const {
+  const uint32_t palette_size = pgm_read_byte(this->data_start_) + 1u;
+  const uint8_t *offset = this->data_start_ + 1 + palette_size * 2 + (this->get_rle_frame_() * this->height_ + y) * 4;
+  const uint32_t row = uint32_t(pgm_read_byte(offset)) | (uint32_t(pgm_read_byte(offset + 1)) << 8) |
+                       (uint32_t(pgm_read_byte(offset + 2)) << 16) | (uint32_t(pgm_read_byte(offset + 3)) << 24);
+  return this->data_start_ + row;
+}
+Color Image::get_rle_pixel_(const uint8_t *row, int x) const {
+  while (true) {
+    const uint8_t control = pgm_read_byte(row++);
+    if (control < 128) {
+      if (x <= control)
+        return this->get_palette_color(pgm_read_byte(row));
+      x -= control + 1;
+      row++;
+    } else {
+      const int length = control - 127;
+      if (x < length)
+        return this->get_palette_color(pgm_read_byte(row + x));
+      x -= length;
+      row += length;
+    }
+  }
+}
 Image::Image(const uint8_t *data_start, int width, int height, ImageType type)
     : width_(width), height_(height), type_(type), data_start_(data_start) {}
 
 bool Animation::get_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return false;
+  if (this->type_ == IMAGE_TYPE_RLE)
+    return Image::get_pixel(x, y);
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t frame_index = this->height_ * width_8 * this->current_frame_;
   if (frame_index >= this->width_ * this->height_ * this->animation_frame_count_)
@@ -494,6 +750,8 @@ bool Animation::get_pixel(int x, int y) const {
 Color Animation::get_color_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
+  if (this->type_ == IMAGE_TYPE_RLE)
+    return Image::get_color_pixel(x, y);
   const uint32_t frame_index = this->width_ * this->height_ * this->current_frame_;
   if (frame_index >= this->width_ * this->height_ * this->animation_frame_count_)
     return 0;
@@ -506,6 +764,8 @@ Color Animation::get_color_pixel(int x, int y) const {
 Color Animation::get_grayscale_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
+  if (this->type_ == IMAGE_TYPE_RLE)
+    return Image::get_grayscale_pixel(x, y);
   const uint32_t frame_index = this->width_ * this->height_ * this->current_frame_;
   if (frame_index >= this->width_ * this->height_ * this->animation_frame_count_)
     return 0;
@@ -4,6 +4,7 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/automation.h"
 #include "display_color_utils.h"
+#include <algorithm>
 
 #ifdef USE_TIME
 #include "esphome/components/time/real_time_clock.h"
@@ -68,7 +69,14 @@ extern const Color COLOR_OFF;
 /// Turn the pixel ON.
 extern const Color COLOR_ON;
 
-enum ImageType { IMAGE_TYPE_BINARY = 0, IMAGE_TYPE_GRAYSCALE = 1, IMAGE_TYPE_RGB24 = 2 };
+/** The pixel format of an Image.
+ *
+ * IMAGE_TYPE_RLE starts with the palette size minus one and that many big-endian RGB565 colors, followed by a
+ * little-endian uint32 offset from the start of the data for each row of each frame (rows that repeat share their
+ * encoding) and the rows. A row is a sequence of control bytes: below 128 the next palette index repeats
+ * control + 1 times, from 128 on control - 127 palette indices follow. Runs never cross rows.
+ */
+enum ImageType { IMAGE_TYPE_BINARY = 0, IMAGE_TYPE_GRAYSCALE = 1, IMAGE_TYPE_RGB24 = 2, IMAGE_TYPE_RLE = 3 };
 
 enum DisplayRotation {
   DISPLAY_ROTATION_0_DEGREES = 0,
@@ -77,6 +85,17 @@ enum DisplayRotation {
   DISPLAY_ROTATION_270_DEGREES = 270,
 };
 
+/// Where the framebuffer of a display is allocated.
+enum BufferMemory {
+  /// PSRAM for buffers of at least PSRAM_BUFFER_THRESHOLD bytes when there is some, internal RAM otherwise.
+  BUFFER_MEMORY_AUTO = 0,
+  BUFFER_MEMORY_INTERNAL = 1,
+  BUFFER_MEMORY_PSRAM = 2,
+};
+
+/// Buffers this large leave too little internal RAM for WiFi if they aren't moved to PSRAM.
+static const uint32_t PSRAM_BUFFER_THRESHOLD = 16384;
+
 class Font;
 class Image;
 class DisplayBuffer;
@@ -213,6 +232,33 @@ class DisplayBuffer {
    */
   void printf(int x, int y, Font *font, const char *format, ...) __attribute__((format(printf, 5, 6)));
 
+  /** Print `value` with `accuracy_decimals` decimals followed by `suffix` with the anchor point at [x,y] with `font`.
+   *
+   * Like printf("%.*f%s", ...), but formats with value_accuracy_to_buf(), which avoids the slow float printf.
+   *
+   * @param x The x coordinate of the text alignment anchor point.
+   * @param y The y coordinate of the text alignment anchor point.
+   * @param font The font to draw the text with.
+   * @param color The color to draw the text with.
+   * @param align The alignment of the text.
+   * @param value The value to print.
+   * @param accuracy_decimals The number of decimals to round the value to.
+   * @param suffix The text to print after the value, like a unit.
+   */
+  void print_value(int x, int y, Font *font, Color color, TextAlign align, float value, int8_t accuracy_decimals,
+                   const char *suffix = "");
+
+  /** Print `value` with `accuracy_decimals` decimals followed by `suffix` with the top left at [x,y] with `font`.
+   *
+   * @param x The x coordinate of the upper left corner.
+   * @param y The y coordinate of the upper left corner.
+   * @param font The font to draw the text with.
+   * @param value The value to print.
+   * @param accuracy_decimals The number of decimals to round the value to.
+   * @param suffix The text to print after the value, like a unit.
+   */
+  void print_value(int x, int y, Font *font, float value, int8_t accuracy_decimals, const char *suffix = "");
+
 #ifdef USE_TIME
   /** Evaluate the strftime-format `format` and print the result with the anchor point at [x,y] with `font`.
    *
@@ -224,7 +270,7 @@ class DisplayBuffer {
    * @param format The strftime format to use.
    * @param time The time to format.
    */
-  void strftime(int x, int y, Font *font, Color color, TextAlign align, const char *format, time::ESPTime time)
+  void strftime(int x, int y, Font *font, Color color, TextAlign align, const char *format, const time::ESPTime &time)
       __attribute__((format(strftime, 7, 0)));
 
   /** Evaluate the strftime-format `format` and print the result with the top left at [x,y] with `font`.
@@ -236,7 +282,7 @@ class DisplayBuffer {
    * @param format The strftime format to use.
    * @param time The time to format.
    */
-  void strftime(int x, int y, Font *font, Color color, const char *format, time::ESPTime time)
+  void strftime(int x, int y, Font *font, Color color, const char *format, const time::ESPTime &time)
       __attribute__((format(strftime, 6, 0)));
 
   /** Evaluate the strftime-format `format` and print the result with the anchor point at [x,y] with `font`.
@@ -248,7 +294,7 @@ class DisplayBuffer {
    * @param format The strftime format to use.
    * @param time The time to format.
    */
-  void strftime(int x, int y, Font *font, TextAlign align, const char *format, time::ESPTime time)
+  void strftime(int x, int y, Font *font, TextAlign align, const char *format, const time::ESPTime &time)
       __attribute__((format(strftime, 6, 0)));
 
   /** Evaluate the strftime-format `format` and print the result with the top left at [x,y] with `font`.
@@ -259,7 +305,7 @@ class DisplayBuffer {
    * @param format The strftime format to use.
    * @param time The time to format.
    */
-  void strftime(int x, int y, Font *font, const char *format, time::ESPTime time)
+  void strftime(int x, int y, Font *font, const char *format, const time::ESPTime &time)
       __attribute__((format(strftime, 5, 0)));
 #endif
 
@@ -304,20 +350,109 @@ class DisplayBuffer {
   /// Internal method to set the display rotation with.
   void set_rotation(DisplayRotation rotation);
 
+  /** Time the drawing primitives on this display and log the average microseconds per call.
+   *
+   * Draws straight into the buffer, the next update replaces the result. Only the drawing is timed, not sending the
+   * buffer to the display.
+   *
+   * @param fonts Fonts to time print() with.
+   * @param images Images to time image() with.
+   * @param iterations How often to repeat each operation.
+   */
+  void run_benchmark(const std::vector<Font *> &fonts, const std::vector<Image *> &images, uint32_t iterations);
+
+  /** Render into a second buffer while the previous frame is still being sent to the display.
+   *
+   * Only has an effect on drivers that send their buffer in the background, the second buffer is allocated like the
+   * first, see set_buffer_memory().
+   */
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
+
+  /// Choose where the buffers are allocated, internal RAM is used if PSRAM is requested but missing or full.
+  void set_buffer_memory(BufferMemory buffer_memory) { this->buffer_memory_ = buffer_memory; }
+
  protected:
   void vprintf_(int x, int y, Font *font, Color color, TextAlign align, const char *format, va_list arg);
 
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /** Fill a rectangle in absolute coordinates, already clipped to the display.
+   *
+   * Every filled primitive (lines, rectangles, fill()) ends up here. The default goes pixel by pixel through
+   * draw_absolute_pixel_internal(), drivers override it with row fills of their buffer or a hardware fill.
+   */
+  virtual void fill_absolute_rect_internal(int x, int y, int width, int height, Color color);
+
+  /** Draw the set bits of a 1 bit per pixel bitmap in PROGMEM, rows padded to whole bytes, MSB first.
+   *
+   * Each horizontal run of set pixels goes to the driver as one rectangle, see fill_absolute_rect_internal().
+   */
+  void draw_packed_bitmap_(int x, int y, const uint8_t *data, int width, int height, Color color);
+
+  /// The rotation as a map from screen to absolute coordinates: x0 + x * xx + y * xy, y0 + x * yx + y * yy.
+  struct RotationTransform {
+    int x0, xx, xy;
+    int y0, yx, yy;
+  };
+  RotationTransform get_rotation_transform_();
+
+  /** Draw the pixels [x_start, x_end) x [y_start, y_end) of a source placed at x, y with color_at(source_x, source_y).
+   *
+   * The range must be clipped to the screen already. The rotation is resolved once, and the loops run along the
+   * rows of the driver's buffer whatever the rotation.
+   */
+  template<typename F> void blit_(int x, int y, int x_start, int y_start, int x_end, int y_end, F &&color_at);
+
   virtual int get_height_internal() = 0;
 
   virtual int get_width_internal() = 0;
 
   void init_internal_(uint32_t buffer_length);
 
+  /// Allocate a buffer of length bytes in the memory chosen with set_buffer_memory().
+  uint8_t *allocate_buffer_(uint32_t length);
+
   void do_update_();
 
+  /** Grow the region that changed since the last flush by the pixel at the absolute coordinates x, y.
+   *
+   * Drivers call this when a pixel in their buffer actually changes value, so clearing and redrawing the same
+   * content every update leaves only the parts that moved dirty and the flush can skip the rest of the screen.
+   */
+  void mark_dirty_(int x, int y) {
+    this->dirty_x_low_ = std::min<int16_t>(this->dirty_x_low_, x);
+    this->dirty_y_low_ = std::min<int16_t>(this->dirty_y_low_, y);
+    this->dirty_x_high_ = std::max<int16_t>(this->dirty_x_high_, x);
+    this->dirty_y_high_ = std::max<int16_t>(this->dirty_y_high_, y);
+  }
+  /// Whether any pixel changed since the last clear_dirty_().
+  bool is_dirty_() const { return this->dirty_x_low_ <= this->dirty_x_high_; }
+  /// Mark the buffer as flushed to the display.
+  void clear_dirty_() {
+    this->dirty_x_low_ = INT16_MAX;
+    this->dirty_y_low_ = INT16_MAX;
+    this->dirty_x_high_ = -1;
+    this->dirty_y_high_ = -1;
+  }
+
+  /// Whether a second buffer is allocated, see set_double_buffer().
+  bool is_double_buffered_() const { return this->back_buffer_ != nullptr; }
+
   uint8_t *buffer_{nullptr};
+  /// The buffer of the previous frame, swapped with buffer_ by do_update_() when double buffered.
+  uint8_t *back_buffer_{nullptr};
+  bool double_buffer_{false};
+  BufferMemory buffer_memory_{BUFFER_MEMORY_AUTO};
+  /// The pixels changed by the last frame rendered alone, a frame is compared to the one rendered before it.
+  int16_t frame_dirty_x_low_{INT16_MAX};
+  int16_t frame_dirty_y_low_{INT16_MAX};
+  int16_t frame_dirty_x_high_{-1};
+  int16_t frame_dirty_y_high_{-1};
+  /// The bounding box (inclusive, in absolute coordinates) of the pixels changed since the last flush.
+  int16_t dirty_x_low_{INT16_MAX};
+  int16_t dirty_y_low_{INT16_MAX};
+  int16_t dirty_x_high_{-1};
+  int16_t dirty_y_high_{-1};
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
   DisplayPage *page_{nullptr};
@@ -391,6 +526,8 @@ class Font {
 
  protected:
   std::vector<Glyph> glyphs_;
+  /// The glyph of each ASCII character that is a single-character glyph and starts no longer one, -1 otherwise.
+  int16_t ascii_glyphs_[128];
   int baseline_;
   int bottom_;
 };
@@ -405,7 +542,17 @@ class Image {
   int get_height() const;
   ImageType get_type() const;
 
+  /// The color of a palette index of an IMAGE_TYPE_RLE image.
+  Color get_palette_color(uint8_t index) const;
+  /// The encoded runs of row y of the current frame of an IMAGE_TYPE_RLE image.
+  const uint8_t *get_rle_row(int y) const;
+
  protected:
+  /// The frame get_rle_row() decodes.
+  virtual int get_rle_frame_() const { return 0; }
+  /// Decode the pixel at x of an encoded row.
+  Color get_rle_pixel_(const uint8_t *row, int x) const;
+
   int width_;
   int height_;
   ImageType type_;
@@ -424,6 +571,8 @@ class Animation : public Image {
   void next_frame();
 
  protected:
+  int get_rle_frame_() const override { return this->current_frame_; }
+
   int current_frame_;
   int animation_frame_count_;
 };
@@ -432,7 +581,7 @@ template<typename... Ts> class DisplayPageShowAction : public Action<Ts...> {
  public:
   TEMPLATABLE_VALUE(DisplayPage *, page)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto *page = this->page_.value(x...);
     if (page != nullptr) {
       page->show();
@@ -444,7 +593,7 @@ template<typename... Ts> class DisplayPageShowNextAction : public Action<Ts...>
  public:
   DisplayPageShowNextAction(DisplayBuffer *buffer) : buffer_(buffer) {}
 
-  void play(Ts... x) override { this->buffer_->show_next_page(); }
+  void play(const Ts &... x) override { this->buffer_->show_next_page(); }
 
   DisplayBuffer *buffer_;
 };
@@ -453,9 +602,26 @@ template<typename... Ts> class DisplayPageShowPrevAction : public Action<Ts...>
  public:
   DisplayPageShowPrevAction(DisplayBuffer *buffer) : buffer_(buffer) {}
 
-  void play(Ts... x) override { this->buffer_->show_prev_page(); }
+  void play(const Ts &... x) override { this->buffer_->show_prev_page(); }
+
+  DisplayBuffer *buffer_;
+};
+
+template<typename... Ts> class DisplayBenchmarkAction : public Action<Ts...> {
+ public:
+  DisplayBenchmarkAction(DisplayBuffer *buffer) : buffer_(buffer) {}
 
+  void set_fonts(std::vector<Font *> fonts) { this->fonts_ = std::move(fonts); }
+  void set_images(std::vector<Image *> images) { this->images_ = std::move(images); }
+  void set_iterations(uint32_t iterations) { this->iterations_ = iterations; }
+
+  void play(const Ts &... x) override { this->buffer_->run_benchmark(this->fonts_, this->images_, this->iterations_); }
+
+ protected:
   DisplayBuffer *buffer_;
+  std::vector<Font *> fonts_;
+  std::vector<Image *> images_;
+  uint32_t iterations_{20};
 };
 
 template<typename... Ts> class DisplayIsDisplayingPageCondition : public Condition<Ts...> {
@@ -463,7 +629,7 @@ template<typename... Ts> class DisplayIsDisplayingPageCondition : public Conditi
   DisplayIsDisplayingPageCondition(DisplayBuffer *parent) : parent_(parent) {}
 
   void set_page(DisplayPage *page) { this->page_ = page; }
-  bool check(Ts... x) override { return this->parent_->get_active_page() == this->page_; }
+  bool check(const Ts &... x) override { return this->parent_->get_active_page() == this->page_; }
 
  protected:
   DisplayBuffer *parent_;
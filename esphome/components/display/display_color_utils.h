@@ -101,6 +101,21 @@ class ColorUtil {
     return 0;
   }
 
+  /** Convert count 8-bit pixels to big-endian RGB565, the byte order SPI panels expect, through a lookup table.
+   *
+   * @param src The pixels, each an index into lut.
+   * @param dst Where the 2 * count bytes go.
+   * @param count The number of pixels.
+   * @param lut The RGB565 color of each of the 256 pixel values.
+   */
+  static void indexed_to_565_be(const uint8_t *src, uint8_t *dst, size_t count, const uint16_t *lut) {
+    for (size_t i = 0; i < count; i++) {
+      const uint16_t color = lut[src[i]];
+      *dst++ = color >> 8;
+      *dst++ = color;
+    }
+  }
+
   static uint32_t color_to_grayscale4(Color color) {
     uint32_t gs4 = esp_scale8(color.white, 15);
     return gs4;
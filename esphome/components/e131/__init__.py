@@ -20,11 +20,13 @@ CHANNELS = {
 
 CONF_UNIVERSE = "universe"
 CONF_E131_ID = "e131_id"
+CONF_DDP = "ddp"
 
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(E131Component),
         cv.Optional(CONF_METHOD, default="MULTICAST"): cv.one_of(*METHODS, upper=True),
+        cv.Optional(CONF_DDP, default=False): cv.boolean,
     }
 )
 
@@ -33,6 +35,8 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     cg.add(var.set_method(METHODS[config[CONF_METHOD]]))
+    if config[CONF_DDP]:
+        cg.add(var.set_ddp(True))
 
 
 @register_addressable_effect(
@@ -1,6 +1,7 @@
 #include "e131.h"
 #include "e131_addressable_light_effect.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <WiFi.h>
@@ -16,6 +17,7 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int DDP_PORT = 4048;
 
 E131Component::E131Component() {}
 
@@ -23,6 +25,9 @@ E131Component::~E131Component() {
   if (udp_) {
     udp_->stop();
   }
+  if (ddp_udp_) {
+    ddp_udp_->stop();
+  }
 }
 
 void E131Component::setup() {
@@ -35,22 +40,29 @@ void E131Component::setup() {
   }
 
   join_igmp_groups_();
+
+  if (this->ddp_) {
+    ddp_udp_.reset(new WiFiUDP());
+    if (!ddp_udp_->begin(DDP_PORT)) {
+      ESP_LOGE(TAG, "Cannot bind DDP to %d.", DDP_PORT);
+      ddp_udp_.reset();
+    }
+  }
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
 
   while (uint16_t packet_size = udp_->parsePacket()) {
-    payload.resize(packet_size);
-
-    if (!udp_->read(&payload[0], payload.size())) {
+    // Oversized datagrams can't be valid, the rest of them is dropped with the next parsePacket()
+    size_t size = udp_->read(this->buffer_, std::min<size_t>(packet_size, sizeof(this->buffer_)));
+    if (size == 0) {
       continue;
     }
 
-    if (!packet_(payload, universe, packet)) {
-      ESP_LOGV(TAG, "Invalid packet recevied of size %zu.", payload.size());
+    if (!packet_(this->buffer_, size, universe, packet)) {
+      ESP_LOGV(TAG, "Invalid packet recevied of size %u.", packet_size);
       continue;
     }
 
@@ -58,6 +70,24 @@ void E131Component::loop() {
       ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
     }
   }
+
+  if (!ddp_udp_)
+    return;
+
+  while (uint16_t packet_size = ddp_udp_->parsePacket()) {
+    size_t size = ddp_udp_->read(this->buffer_, std::min<size_t>(packet_size, sizeof(this->buffer_)));
+    uint32_t offset;
+    const uint8_t *values;
+    uint16_t length;
+    if (size == 0 || !ddp_packet_(this->buffer_, size, offset, values, length)) {
+      ESP_LOGV(TAG, "Invalid DDP packet recevied of size %u.", packet_size);
+      continue;
+    }
+
+    if (!process_ddp_(offset, values, length)) {
+      ESP_LOGV(TAG, "Ignored DDP packet for offset %u of size %u.", offset, length);
+    }
+  }
 }
 
 void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
@@ -102,5 +132,17 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
   return handled;
 }
 
+bool E131Component::process_ddp_(uint32_t offset, const uint8_t *values, uint16_t length) {
+  bool handled = false;
+
+  ESP_LOGV(TAG, "Received DDP packet for offset %u, with %u bytes", offset, length);
+
+  for (auto light_effect : light_effects_) {
+    handled = light_effect->process_ddp_(offset, values, length) || handled;
+  }
+
+  return handled;
+}
+
 }  // namespace e131
 }  // namespace esphome
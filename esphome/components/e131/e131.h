@@ -4,7 +4,7 @@
 
 #include <memory>
 #include <set>
-#include <map>
+#include <vector>
 
 class UDP;
 
@@ -16,10 +16,19 @@ class E131AddressableLightEffect;
 enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
+/// Large enough for a full Ethernet frame, which holds any E1.31 or DDP packet.
+const size_t E131_RECEIVE_BUFFER_SIZE = 1472;
 
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  /// The start code followed by the channel values, points into the receive buffer of E131Component.
+  const uint8_t *values;
+};
+
+/// How many effects listen to a universe.
+struct E131Universe {
+  uint16_t universe;
+  uint16_t consumers;
 };
 
 class E131Component : public esphome::Component {
@@ -37,20 +46,27 @@ class E131Component : public esphome::Component {
 
  public:
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
+  /// Also listen for DDP packets, which address the LEDs of the active effects as one flat range of bytes.
+  void set_ddp(bool ddp) { this->ddp_ = ddp; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t size, int &universe, E131Packet &packet);
   bool process_(int universe, const E131Packet &packet);
+  bool ddp_packet_(const uint8_t *data, size_t size, uint32_t &offset, const uint8_t *&values, uint16_t &length);
+  bool process_ddp_(uint32_t offset, const uint8_t *values, uint16_t length);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
  protected:
   E131ListenMethod listen_method_{E131_MULTICAST};
+  bool ddp_{false};
   std::unique_ptr<UDP> udp_;
+  std::unique_ptr<UDP> ddp_udp_;
   std::set<E131AddressableLightEffect *> light_effects_;
-  std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  std::vector<E131Universe> universes_;
+  /// Datagrams are read into this buffer and parsed from there.
+  uint8_t buffer_[E131_RECEIVE_BUFFER_SIZE];
 };
 
 }  // namespace e131
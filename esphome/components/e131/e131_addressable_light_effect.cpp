@@ -6,7 +6,7 @@ namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = E131_MAX_PROPERTY_VALUES_COUNT - 1;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -53,37 +53,31 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
 
   int output_offset = (universe - first_universe_) * get_lights_per_universe();
   // limit amount of lights per universe and received
-  int output_end =
-      std::min(it->size(), std::min(output_offset + get_lights_per_universe(), output_offset + packet.count - 1));
-  auto input_data = packet.values + 1;
+  int count = std::min(get_lights_per_universe(), (packet.count - 1) / channels_);
+  count = std::min(count, it->size() - output_offset);
+  if (count <= 0)
+    return false;
 
   ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %d-%d.", get_name().c_str(), universe, output_offset,
-           output_end);
-
-  switch (channels_) {
-    case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
-      }
-      break;
-
-    case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
-            Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
-      }
-      break;
-
-    case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
-      break;
-  }
+           output_offset + count);
+
+  it->set_range_from_bytes(output_offset, packet.values + 1, count, channels_);
+  return true;
+}
+
+bool E131AddressableLightEffect::process_ddp_(uint32_t offset, const uint8_t *values, uint16_t length) {
+  auto it = get_addressable_();
+
+  // DDP addresses bytes across the whole strip, a packet may start in the middle of an LED
+  uint32_t output_offset = (offset + channels_ - 1) / channels_;
+  uint32_t skip = output_offset * channels_ - offset;
+  if (output_offset >= static_cast<uint32_t>(it->size()) || skip >= length)
+    return false;
+  int count = std::min<int>((length - skip) / channels_, it->size() - output_offset);
+
+  ESP_LOGV(TAG, "Applying DDP data for '%s', for %u-%u.", get_name().c_str(), output_offset, output_offset + count);
 
+  it->set_range_from_bytes(output_offset, values + skip, count, channels_);
   return true;
 }
 
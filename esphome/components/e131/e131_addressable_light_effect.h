@@ -34,6 +34,7 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  bool process_ddp_(uint32_t offset, const uint8_t *values, uint16_t length);
 
  protected:
   int first_universe_{0};
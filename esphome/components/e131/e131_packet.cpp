@@ -2,6 +2,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
 
+#include <algorithm>
 #include <lwip/ip_addr.h>
 #include <lwip/igmp.h>
 
@@ -53,23 +54,32 @@ union E131RawPacket {
 // Get the offset of `property_values[1]`
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
 
+static const uint8_t DDP_FLAGS_VERSION_MASK = 0xC0;
+static const uint8_t DDP_FLAGS_VERSION_1 = 0x40;
+static const uint8_t DDP_FLAGS_QUERY = 0x08;
+static const uint8_t DDP_FLAGS_TIMECODE = 0x10;
+static const uint8_t DDP_ID_DISPLAY = 1;
+static const uint8_t DDP_ID_ALL = 255;
+static const size_t DDP_HEADER_SIZE = 10;
+static const size_t DDP_TIMECODE_SIZE = 4;
+
 bool E131Component::join_igmp_groups_() {
   if (listen_method_ != E131_MULTICAST)
     return false;
   if (!udp_)
     return false;
 
-  for (auto universe : universe_consumers_) {
-    if (!universe.second)
+  for (auto universe : universes_) {
+    if (!universe.consumers)
       continue;
 
-    ip4_addr_t multicast_addr = {
-        static_cast<uint32_t>(IPAddress(239, 255, ((universe.first >> 8) & 0xff), ((universe.first >> 0) & 0xff)))};
+    ip4_addr_t multicast_addr = {static_cast<uint32_t>(
+        IPAddress(239, 255, ((universe.universe >> 8) & 0xff), ((universe.universe >> 0) & 0xff)))};
 
     auto err = igmp_joingroup(IP4_ADDR_ANY4, &multicast_addr);
 
     if (err) {
-      ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", universe.first);
+      ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", universe.universe);
     }
   }
 
@@ -77,8 +87,11 @@ bool E131Component::join_igmp_groups_() {
 }
 
 void E131Component::join_(int universe) {
-  // store only latest received packet for the given universe
-  auto consumers = ++universe_consumers_[universe];
+  auto entry = std::find_if(universes_.begin(), universes_.end(),
+                            [universe](const E131Universe &e) { return e.universe == universe; });
+  if (entry == universes_.end())
+    entry = universes_.insert(universes_.end(), E131Universe{static_cast<uint16_t>(universe), 0});
+  auto consumers = ++entry->consumers;
 
   if (consumers > 1) {
     return;  // we already joined before
@@ -90,11 +103,16 @@ void E131Component::join_(int universe) {
 }
 
 void E131Component::leave_(int universe) {
-  auto consumers = --universe_consumers_[universe];
+  auto entry = std::find_if(universes_.begin(), universes_.end(),
+                            [universe](const E131Universe &e) { return e.universe == universe; });
+  if (entry == universes_.end())
+    return;
+  auto consumers = --entry->consumers;
 
   if (consumers > 0) {
     return;  // we have other consumers of the given universe
   }
+  universes_.erase(entry);
 
   if (listen_method_ == E131_MULTICAST) {
     ip4_addr_t multicast_addr = {
@@ -106,11 +124,11 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t size, int &universe, E131Packet &packet) {
+  if (size < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -127,8 +145,31 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
   packet.count = htons(sbuff->property_value_count);
   if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
     return false;
+  if (size < E131_MIN_PACKET_SIZE - 1 + packet.count)
+    return false;
+
+  packet.values = sbuff->property_values;
+  return true;
+}
+
+bool E131Component::ddp_packet_(const uint8_t *data, size_t size, uint32_t &offset, const uint8_t *&values,
+                                uint16_t &length) {
+  if (size < DDP_HEADER_SIZE)
+    return false;
+  const uint8_t flags = data[0];
+  if ((flags & DDP_FLAGS_VERSION_MASK) != DDP_FLAGS_VERSION_1)
+    return false;
+  // Queries and non-display destinations (config, status) are not pixel data
+  if ((flags & DDP_FLAGS_QUERY) != 0 || (data[3] != DDP_ID_DISPLAY && data[3] != DDP_ID_ALL))
+    return false;
+
+  size_t header = DDP_HEADER_SIZE + ((flags & DDP_FLAGS_TIMECODE) != 0 ? DDP_TIMECODE_SIZE : 0);
+  offset = (uint32_t(data[4]) << 24) | (uint32_t(data[5]) << 16) | (uint32_t(data[6]) << 8) | data[7];
+  length = (uint16_t(data[8]) << 8) | data[9];
+  if (size < header + length)
+    return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  values = data + header;
   return true;
 }
 
@@ -1,9 +1,7 @@
 #pragma once
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
-
-#include <queue>
-#include <mutex>
+#include "esphome/core/lock_free_queue.h"
 
 #ifdef ARDUINO_ARCH_ESP32
 
@@ -14,7 +12,7 @@
 /*
  * BLE events come in from a separate Task (thread) in the ESP32 stack. Rather
  * than trying to deal wth various locking strategies, all incoming GAP and GATT
- * events will simply be placed on a semaphore guarded queue. The next time the
+ * events will simply be placed on a lock-free queue. The next time the
  * component runs loop(), these events are popped off the queue and handed at
  * this safer time.
  */
@@ -24,33 +22,26 @@ namespace esp32_ble {
 
 template<class T> class Queue {
  public:
-  Queue() { m = xSemaphoreCreateMutex(); }
-
+  /// Queue an element and take ownership of it. If the queue is full the element is freed and counted as dropped.
   void push(T *element) {
     if (element == nullptr)
       return;
-    if (xSemaphoreTake(m, 5L / portTICK_PERIOD_MS)) {
-      q.push(element);
-      xSemaphoreGive(m);
-    }
+    if (!this->q_.push(element))
+      delete element;
   }
 
   T *pop() {
-    T *element = nullptr;
-
-    if (xSemaphoreTake(m, 5L / portTICK_PERIOD_MS)) {
-      if (!q.empty()) {
-        element = q.front();
-        q.pop();
-      }
-      xSemaphoreGive(m);
-    }
+    T *element;
+    if (!this->q_.pop(element))
+      return nullptr;
     return element;
   }
 
+  /// Number of elements dropped because the main loop did not keep up.
+  uint32_t get_dropped_count() const { return this->q_.get_overflow_count(); }
+
  protected:
-  std::queue<T *> q;
-  SemaphoreHandle_t m;
+  LockFreeQueue<T *, 64> q_;
 };
 
 // Received GAP, GATTC and GATTS events are only queued, and get processed in the main loop().
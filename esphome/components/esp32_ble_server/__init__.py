@@ -10,20 +10,52 @@ ESP_PLATFORMS = [ESP_PLATFORM_ESP32]
 
 CONF_MANUFACTURER = "manufacturer"
 CONF_BLE_ID = "ble_id"
+CONF_MAX_MTU = "max_mtu"
+CONF_MIN_CONNECTION_INTERVAL = "min_connection_interval"
+CONF_MAX_CONNECTION_INTERVAL = "max_connection_interval"
 
 esp32_ble_server_ns = cg.esphome_ns.namespace("esp32_ble_server")
 BLEServer = esp32_ble_server_ns.class_("BLEServer", cg.Component)
 BLEServiceComponent = esp32_ble_server_ns.class_("BLEServiceComponent")
 
+connection_interval = cv.All(
+    cv.positive_time_period_microseconds,
+    cv.Range(min=cv.TimePeriod(microseconds=7500), max=cv.TimePeriod(seconds=4)),
+)
 
-CONFIG_SCHEMA = cv.Schema(
-    {
-        cv.GenerateID(): cv.declare_id(BLEServer),
-        cv.GenerateID(CONF_BLE_ID): cv.use_id(esp32_ble.ESP32BLE),
-        cv.Optional(CONF_MANUFACTURER, default="ESPHome"): cv.string,
-        cv.Optional(CONF_MODEL): cv.string,
-    }
-).extend(cv.COMPONENT_SCHEMA)
+
+def validate_connection_interval(config):
+    if config[CONF_MIN_CONNECTION_INTERVAL] > config[CONF_MAX_CONNECTION_INTERVAL]:
+        raise cv.Invalid(
+            f"{CONF_MIN_CONNECTION_INTERVAL} must not be greater than "
+            f"{CONF_MAX_CONNECTION_INTERVAL}"
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(BLEServer),
+            cv.GenerateID(CONF_BLE_ID): cv.use_id(esp32_ble.ESP32BLE),
+            cv.Optional(CONF_MANUFACTURER, default="ESPHome"): cv.string,
+            cv.Optional(CONF_MODEL): cv.string,
+            cv.Optional(CONF_MAX_MTU, default=517): cv.int_range(min=23, max=517),
+            cv.Optional(
+                CONF_MIN_CONNECTION_INTERVAL, default="15ms"
+            ): connection_interval,
+            cv.Optional(
+                CONF_MAX_CONNECTION_INTERVAL, default="30ms"
+            ): connection_interval,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    validate_connection_interval,
+)
+
+
+def to_connection_interval_units(value):
+    # The connection interval is given in units of 1.25 ms
+    return int(round(value.total_microseconds / 1250))
 
 
 async def to_code(config):
@@ -34,6 +66,13 @@ async def to_code(config):
     cg.add(var.set_manufacturer(config[CONF_MANUFACTURER]))
     if CONF_MODEL in config:
         cg.add(var.set_model(config[CONF_MODEL]))
+    cg.add(var.set_max_mtu(config[CONF_MAX_MTU]))
+    cg.add(
+        var.set_connection_interval(
+            to_connection_interval_units(config[CONF_MIN_CONNECTION_INTERVAL]),
+            to_connection_interval_units(config[CONF_MAX_CONNECTION_INTERVAL]),
+        )
+    )
     cg.add_define("USE_ESP32_BLE_SERVER")
 
     cg.add(parent.set_server(var))
@@ -4,6 +4,8 @@
 
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 #ifdef ARDUINO_ARCH_ESP32
 
 namespace esphome {
@@ -12,9 +14,6 @@ namespace esp32_ble_server {
 static const char *const TAG = "esp32_ble_server.characteristic";
 
 BLECharacteristic::BLECharacteristic(const ESPBTUUID uuid, uint32_t properties) : uuid_(uuid) {
-  this->set_value_lock_ = xSemaphoreCreateBinary();
-  xSemaphoreGive(this->set_value_lock_);
-
   this->properties_ = (esp_gatt_char_prop_t) 0;
 
   this->set_broadcast_property((properties & PROPERTY_BROADCAST) != 0);
@@ -25,11 +24,8 @@ BLECharacteristic::BLECharacteristic(const ESPBTUUID uuid, uint32_t properties)
   this->set_write_no_response_property((properties & PROPERTY_WRITE_NR) != 0);
 }
 
-void BLECharacteristic::set_value(std::vector<uint8_t> value) {
-  xSemaphoreTake(this->set_value_lock_, 0L);
-  this->value_ = value;
-  xSemaphoreGive(this->set_value_lock_);
-}
+// The value is only accessed from the main loop, the GATT events are handed over to it by ESP32BLE
+void BLECharacteristic::set_value(std::vector<uint8_t> value) { this->value_ = std::move(value); }
 void BLECharacteristic::set_value(const std::string &value) {
   this->set_value(std::vector<uint8_t>(value.begin(), value.end()));
 }
@@ -82,20 +78,29 @@ void BLECharacteristic::notify(bool notification) {
     ESP_LOGW(TAG, "notification=false is not yet supported");
     // TODO: Handle when notification=false
   }
-  if (this->service_->get_server()->get_connected_client_count() == 0)
-    return;
-
-  for (auto &client : this->service_->get_server()->get_clients()) {
-    size_t length = this->value_.size();
-    esp_err_t err = esp_ble_gatts_send_indicate(this->service_->get_server()->get_gatts_if(), client.first,
-                                                this->handle_, length, this->value_.data(), false);
-    if (err != ESP_OK) {
-      ESP_LOGE(TAG, "esp_ble_gatts_send_indicate failed %d", err);
+  BLEServer *server = this->service_->get_server();
+  for (auto &client : server->get_clients()) {
+    if (!server->queue_notification(client.first, this->handle_, this->value_)) {
+      ESP_LOGW(TAG, "Notification queue is full, dropping notification");
       return;
     }
   }
 }
 
+bool BLECharacteristic::stream(const uint8_t *data, size_t length) {
+  BLEServer *server = this->service_->get_server();
+  for (auto &client : server->get_clients()) {
+    // The header of a notification takes 3 bytes of the MTU
+    const size_t chunk = server->get_client_mtu(client.first) - 3;
+    for (size_t offset = 0; offset < length; offset += chunk) {
+      const size_t end = std::min(length, offset + chunk);
+      if (!server->queue_notification(client.first, this->handle_, std::vector<uint8_t>(data + offset, data + end)))
+        return false;
+    }
+  }
+  return true;
+}
+
 void BLECharacteristic::add_descriptor(BLEDescriptor *descriptor) { this->descriptors_.push_back(descriptor); }
 
 void BLECharacteristic::do_create(BLEService *service) {
@@ -205,7 +210,8 @@ void BLECharacteristic::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt
       if (!param->read.need_rsp)
         break;  // For some reason you can request a read but not want a response
 
-      uint16_t max_offset = 22;
+      // A read response has a 1 byte header
+      uint16_t max_offset = this->service_->get_server()->get_client_mtu(param->read.conn_id) - 1;
 
       esp_gatt_rsp_t response;
       if (param->read.is_long) {
@@ -42,7 +42,14 @@ class BLECharacteristic {
   void set_write_property(bool value);
   void set_write_no_response_property(bool value);
 
+  /// Queue a notification of the value to every connected client.
   void notify(bool notification = true);
+  /** Queue `data` as notifications to every connected client, split into chunks that fit the MTU of each client.
+   *
+   * For streaming data that is larger than one notification, false if the notification queue of the server is
+   * full. The value of the characteristic is not changed.
+   */
+  bool stream(const uint8_t *data, size_t length);
 
   void do_create(BLEService *service);
   void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
@@ -74,7 +81,6 @@ class BLECharacteristic {
 
   uint16_t value_read_offset_{0};
   std::vector<uint8_t> value_;
-  SemaphoreHandle_t set_value_lock_;
 
   std::vector<BLEDescriptor *> descriptors_;
 
@@ -13,6 +13,7 @@
 #include <esp_bt.h>
 #include <freertos/task.h>
 #include <esp_gap_ble_api.h>
+#include <esp_gatt_common_api.h>
 
 namespace esphome {
 namespace esp32_ble_server {
@@ -24,6 +25,12 @@ static const uint16_t MODEL_UUID = 0x2A24;
 static const uint16_t VERSION_UUID = 0x2A26;
 static const uint16_t MANUFACTURER_UUID = 0x2A29;
 
+/// The MTU of a connection before the client requests an MTU exchange.
+static const uint16_t DEFAULT_MTU = 23;
+static const size_t MAX_QUEUED_NOTIFICATIONS = 64;
+/// Supervision timeout of the requested connection parameters, in units of 10 ms.
+static const uint16_t CONNECTION_TIMEOUT = 400;
+
 void BLEServer::setup() {
   if (this->is_failed()) {
     ESP_LOGE(TAG, "BLE Server was marked failed by ESP32BLE");
@@ -38,10 +45,15 @@ void BLEServer::setup() {
 void BLEServer::loop() {
   switch (this->state_) {
     case RUNNING:
+      this->send_notifications_();
       return;
 
     case INIT: {
-      esp_err_t err = esp_ble_gatts_app_register(0);
+      esp_err_t err = esp_ble_gatt_set_local_mtu(this->max_mtu_);
+      if (err != ESP_OK) {
+        ESP_LOGW(TAG, "esp_ble_gatt_set_local_mtu failed: %d", err);
+      }
+      err = esp_ble_gatts_app_register(0);
       if (err != ESP_OK) {
         ESP_LOGE(TAG, "esp_ble_gatts_app_register failed: %d", err);
         this->mark_failed();
@@ -127,6 +139,19 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
       ESP_LOGD(TAG, "BLE Client connected");
       this->add_client_(param->connect.conn_id, (void *) this);
       this->connected_clients_++;
+      this->links_[param->connect.conn_id] = ClientLink{DEFAULT_MTU, false};
+
+      // Notifications queued in an event wait for the next connection event, a short interval keeps them flowing
+      esp_ble_conn_update_params_t conn_params = {};
+      memcpy(conn_params.bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+      conn_params.min_int = this->min_connection_interval_;
+      conn_params.max_int = this->max_connection_interval_;
+      conn_params.latency = 0;
+      conn_params.timeout = CONNECTION_TIMEOUT;
+      esp_err_t err = esp_ble_gap_update_conn_params(&conn_params);
+      if (err != ESP_OK) {
+        ESP_LOGW(TAG, "esp_ble_gap_update_conn_params failed: %d", err);
+      }
       for (auto *component : this->service_components_) {
         component->on_client_connect();
       }
@@ -142,6 +167,19 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
       }
       break;
     }
+    case ESP_GATTS_MTU_EVT: {
+      ESP_LOGD(TAG, "BLE Client MTU: %u", param->mtu.mtu);
+      auto it = this->links_.find(param->mtu.conn_id);
+      if (it != this->links_.end())
+        it->second.mtu = param->mtu.mtu;
+      break;
+    }
+    case ESP_GATTS_CONGEST_EVT: {
+      auto it = this->links_.find(param->congest.conn_id);
+      if (it != this->links_.end())
+        it->second.congested = param->congest.congested;
+      break;
+    }
     case ESP_GATTS_REG_EVT: {
       this->gatts_if_ = gatts_if;
       this->registered_ = true;
@@ -156,9 +194,59 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
   }
 }
 
+bool BLEServer::remove_client_(uint16_t conn_id) {
+  this->links_.erase(conn_id);
+  for (auto it = this->notifications_.begin(); it != this->notifications_.end();) {
+    if (it->conn_id == conn_id) {
+      it = this->notifications_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return this->clients_.erase(conn_id) > 0;
+}
+
+uint16_t BLEServer::get_client_mtu(uint16_t conn_id) const {
+  auto it = this->links_.find(conn_id);
+  if (it == this->links_.end())
+    return DEFAULT_MTU;
+  return it->second.mtu;
+}
+
+bool BLEServer::queue_notification(uint16_t conn_id, uint16_t handle, std::vector<uint8_t> data) {
+  if (this->notifications_.size() >= MAX_QUEUED_NOTIFICATIONS)
+    return false;
+  this->notifications_.push_back(Notification{conn_id, handle, std::move(data)});
+  return true;
+}
+
+void BLEServer::send_notifications_() {
+  while (!this->notifications_.empty()) {
+    Notification &notification = this->notifications_.front();
+    auto it = this->links_.find(notification.conn_id);
+    if (it != this->links_.end()) {
+      if (it->second.congested)
+        return;
+      esp_err_t err = esp_ble_gatts_send_indicate(this->gatts_if_, notification.conn_id, notification.handle,
+                                                  notification.data.size(), notification.data.data(), false);
+      if (err != ESP_OK) {
+        // Out of buffers in the stack, try again in the next loop
+        ESP_LOGV(TAG, "esp_ble_gatts_send_indicate failed %d", err);
+        return;
+      }
+    }
+    this->notifications_.pop_front();
+  }
+}
+
 float BLEServer::get_setup_priority() const { return setup_priority::BLUETOOTH - 10; }
 
-void BLEServer::dump_config() { ESP_LOGCONFIG(TAG, "ESP32 BLE Server:"); }
+void BLEServer::dump_config() {
+  ESP_LOGCONFIG(TAG, "ESP32 BLE Server:");
+  ESP_LOGCONFIG(TAG, "  Max MTU: %u", this->max_mtu_);
+  ESP_LOGCONFIG(TAG, "  Connection Interval: %.2f - %.2f ms", this->min_connection_interval_ * 1.25f,
+                this->max_connection_interval_ * 1.25f);
+}
 
 BLEServer *global_ble_server = nullptr;
 
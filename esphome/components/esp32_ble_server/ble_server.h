@@ -10,6 +10,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
 
+#include <deque>
 #include <map>
 
 #ifdef ARDUINO_ARCH_ESP32
@@ -42,6 +43,13 @@ class BLEServer : public Component {
 
   void set_manufacturer(const std::string &manufacturer) { this->manufacturer_ = manufacturer; }
   void set_model(const std::string &model) { this->model_ = model; }
+  /// The largest MTU accepted when a client requests an MTU exchange, up to 517.
+  void set_max_mtu(uint16_t max_mtu) { this->max_mtu_ = max_mtu; }
+  /// The connection interval requested from every client after it connects, in units of 1.25 ms.
+  void set_connection_interval(uint16_t min_interval, uint16_t max_interval) {
+    this->min_connection_interval_ = min_interval;
+    this->max_connection_interval_ = max_interval;
+  }
 
   BLEService *create_service(const uint8_t *uuid, bool advertise = false);
   BLEService *create_service(uint16_t uuid, bool advertise = false);
@@ -51,6 +59,16 @@ class BLEServer : public Component {
   esp_gatt_if_t get_gatts_if() { return this->gatts_if_; }
   uint32_t get_connected_client_count() { return this->connected_clients_; }
   const std::map<uint16_t, void *> &get_clients() { return this->clients_; }
+  /// The MTU negotiated with this client, the default of 23 until it requests a larger one.
+  uint16_t get_client_mtu(uint16_t conn_id) const;
+
+  /** Queue a notification of `data` to a client, false if the queue is full.
+   *
+   * The queue is sent from the loop as fast as the stack accepts the notifications, without waiting for each one
+   * to be sent, so that several of them go out in one connection event. Sending pauses while the connection
+   * is congested.
+   */
+  bool queue_notification(uint16_t conn_id, uint16_t handle, std::vector<uint8_t> data);
 
   void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
 
@@ -62,7 +80,9 @@ class BLEServer : public Component {
   void add_client_(uint16_t conn_id, void *client) {
     this->clients_.insert(std::pair<uint16_t, void *>(conn_id, client));
   }
-  bool remove_client_(uint16_t conn_id) { return this->clients_.erase(conn_id) > 0; }
+  bool remove_client_(uint16_t conn_id);
+  /// Send the queued notifications until the stack stops accepting them.
+  void send_notifications_();
 
   bool can_proceed_{false};
 
@@ -74,6 +94,21 @@ class BLEServer : public Component {
   uint32_t connected_clients_{0};
   std::map<uint16_t, void *> clients_;
 
+  uint16_t max_mtu_{ESP_GATT_MAX_MTU_SIZE};
+  uint16_t min_connection_interval_{12};
+  uint16_t max_connection_interval_{24};
+  struct ClientLink {
+    uint16_t mtu;
+    bool congested;
+  };
+  std::map<uint16_t, ClientLink> links_;
+  struct Notification {
+    uint16_t conn_id;
+    uint16_t handle;
+    std::vector<uint8_t> data;
+  };
+  std::deque<Notification> notifications_;
+
   std::vector<BLEService *> services_;
   BLEService *device_information_service_;
 
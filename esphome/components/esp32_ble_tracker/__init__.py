@@ -23,6 +23,9 @@ CONF_ESP32_BLE_ID = "esp32_ble_id"
 CONF_SCAN_PARAMETERS = "scan_parameters"
 CONF_WINDOW = "window"
 CONF_ACTIVE = "active"
+CONF_BUSY_WINDOW = "busy_window"
+CONF_BURST_INTERVAL = "burst_interval"
+CONF_BURST_DURATION = "burst_duration"
 esp32_ble_tracker_ns = cg.esphome_ns.namespace("esp32_ble_tracker")
 ESP32BLETracker = esp32_ble_tracker_ns.class_("ESP32BLETracker", cg.Component)
 ESPBTClient = esp32_ble_tracker_ns.class_("ESPBTClient")
@@ -61,6 +64,28 @@ def validate_scan_parameters(config):
             "cover all BLE channels."
         )
 
+    if CONF_BUSY_WINDOW not in config:
+        default_busy_window = cv.TimePeriodMilliseconds(milliseconds=10)
+        config[CONF_BUSY_WINDOW] = min(window, default_busy_window)
+    elif config[CONF_BUSY_WINDOW] > window:
+        raise cv.Invalid(
+            "Busy scan window ({}) needs to be smaller than scan window ({})"
+            "".format(config[CONF_BUSY_WINDOW], window)
+        )
+
+    if CONF_BURST_INTERVAL in config:
+        burst_duration = config[CONF_BURST_DURATION]
+        if burst_duration >= config[CONF_BURST_INTERVAL]:
+            raise cv.Invalid(
+                "Burst duration ({}) needs to be smaller than burst interval ({})"
+                "".format(burst_duration, config[CONF_BURST_INTERVAL])
+            )
+        if interval.total_milliseconds * 3 > burst_duration.total_milliseconds:
+            raise cv.Invalid(
+                "Burst duration needs to be at least three times the scan interval to"
+                "cover all BLE channels."
+            )
+
     return config
 
 
@@ -107,6 +132,16 @@ def as_hex(value):
     return cg.RawExpression(f"0x{value}ULL")
 
 
+def bt_uuid_expression(value):
+    """The ESPBTUUID expression for a value validated by bt_uuid."""
+    uuid = esp32_ble_tracker_ns.namespace("ESPBTUUID")
+    if len(value) == len(bt_uuid16_format):
+        return uuid.from_uint16(as_hex(value))
+    if len(value) == len(bt_uuid32_format):
+        return uuid.from_uint32(as_hex(value))
+    return uuid.from_raw(as_hex_array(value))
+
+
 def as_hex_array(value):
     value = value.replace("-", "")
     cpp_array = [
@@ -133,6 +168,15 @@ CONFIG_SCHEMA = cv.Schema(
                         CONF_WINDOW, default="30ms"
                     ): cv.positive_time_period_milliseconds,
                     cv.Optional(CONF_ACTIVE, default=True): cv.boolean,
+                    cv.Optional(
+                        CONF_BUSY_WINDOW
+                    ): cv.positive_time_period_milliseconds,
+                    cv.Inclusive(
+                        CONF_BURST_INTERVAL, "burst"
+                    ): cv.positive_time_period_milliseconds,
+                    cv.Inclusive(
+                        CONF_BURST_DURATION, "burst"
+                    ): cv.positive_time_period_milliseconds,
                 }
             ),
             validate_scan_parameters,
@@ -181,13 +225,24 @@ async def to_code(config):
     cg.add(var.set_scan_interval(int(params[CONF_INTERVAL].total_milliseconds / 0.625)))
     cg.add(var.set_scan_window(int(params[CONF_WINDOW].total_milliseconds / 0.625)))
     cg.add(var.set_scan_active(params[CONF_ACTIVE]))
+    cg.add(
+        var.set_busy_scan_window(
+            int(params[CONF_BUSY_WINDOW].total_milliseconds / 0.625)
+        )
+    )
+    if CONF_BURST_INTERVAL in params:
+        cg.add(var.set_burst_interval(params[CONF_BURST_INTERVAL]))
+        cg.add(var.set_burst_duration(params[CONF_BURST_DURATION]))
+    cg.add_define("USE_ESP32_BLE_TRACKER")
     for conf in config.get(CONF_ON_BLE_ADVERTISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        add_advertisement_interest(var, conf)
         if CONF_MAC_ADDRESS in conf:
             cg.add(trigger.set_address(conf[CONF_MAC_ADDRESS].as_hex))
         await automation.build_automation(trigger, [(ESPBTDeviceConstRef, "x")], conf)
     for conf in config.get(CONF_ON_BLE_SERVICE_DATA_ADVERTISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        add_advertisement_interest(var, conf)
         if len(conf[CONF_SERVICE_UUID]) == len(bt_uuid16_format):
             cg.add(trigger.set_service_uuid16(as_hex(conf[CONF_SERVICE_UUID])))
         elif len(conf[CONF_SERVICE_UUID]) == len(bt_uuid32_format):
@@ -200,6 +255,7 @@ async def to_code(config):
         await automation.build_automation(trigger, [(adv_data_t_const_ref, "x")], conf)
     for conf in config.get(CONF_ON_BLE_MANUFACTURER_DATA_ADVERTISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        add_advertisement_interest(var, conf)
         if len(conf[CONF_MANUFACTURER_ID]) == len(bt_uuid16_format):
             cg.add(trigger.set_manufacturer_uuid16(as_hex(conf[CONF_MANUFACTURER_ID])))
         elif len(conf[CONF_MANUFACTURER_ID]) == len(bt_uuid32_format):
@@ -212,13 +268,40 @@ async def to_code(config):
         await automation.build_automation(trigger, [(adv_data_t_const_ref, "x")], conf)
 
 
+def add_advertisement_interest(paren, config):
+    """Tell the tracker which advertisements a listener with this config can match.
+
+    The MAC address wins over the service UUID and manufacturer ID, listeners with
+    any of them only match advertisements that have them. Without any, the listener
+    is assumed to look at every advertisement.
+    """
+    if CONF_MAC_ADDRESS in config:
+        cg.add(paren.add_address_interest(config[CONF_MAC_ADDRESS].as_hex))
+    elif CONF_SERVICE_UUID in config:
+        cg.add(
+            paren.add_service_uuid_interest(
+                bt_uuid_expression(config[CONF_SERVICE_UUID])
+            )
+        )
+    elif CONF_MANUFACTURER_ID in config:
+        cg.add(
+            paren.add_manufacturer_id_interest(
+                bt_uuid_expression(config[CONF_MANUFACTURER_ID])
+            )
+        )
+    else:
+        cg.add(paren.add_any_interest())
+
+
 async def register_ble_device(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_listener(var))
+    add_advertisement_interest(paren, config)
     return var
 
 
 async def register_client(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_client(var))
+    add_advertisement_interest(paren, config)
     return var
@@ -44,19 +44,31 @@ void ESP32BLETracker::setup() {
     return;
   }
 
+  if (this->burst_interval_ != 0) {
+    this->set_interval("burst", this->burst_interval_, [this]() {
+      this->burst_ = true;
+      this->set_timeout("burst_end", this->burst_duration_, [this]() { this->burst_ = false; });
+    });
+  }
+
   global_esp32_ble_tracker->start_scan(true);
 }
 
 void ESP32BLETracker::loop() {
-  BLEEvent *ble_event = this->ble_events_.pop();
+  BLEEvent *ble_event = this->ble_events_.front();
   while (ble_event != nullptr) {
     if (ble_event->type_)
       this->real_gattc_event_handler(ble_event->event_.gattc.gattc_event, ble_event->event_.gattc.gattc_if,
                                      &ble_event->event_.gattc.gattc_param);
     else
       this->real_gap_event_handler(ble_event->event_.gap.gap_event, &ble_event->event_.gap.gap_param);
-    delete ble_event;
-    ble_event = this->ble_events_.pop();
+    this->ble_events_.pop();
+    ble_event = this->ble_events_.front();
+  }
+  const uint32_t dropped = this->ble_events_.get_dropped_count();
+  if (dropped != this->ble_events_dropped_) {
+    ESP_LOGW(TAG, "Dropped %u BLE events, the main loop is not keeping up", dropped - this->ble_events_dropped_);
+    this->ble_events_dropped_ = dropped;
   }
 
   bool connecting = false;
@@ -64,6 +76,7 @@ void ESP32BLETracker::loop() {
     if (client->state() == ClientState::Connecting || client->state() == ClientState::Discovered)
       connecting = true;
   }
+  this->update_scan_mode_();
   if (!connecting && xSemaphoreTake(this->scan_end_lock_, 0L)) {
     xSemaphoreGive(this->scan_end_lock_);
     global_esp32_ble_tracker->start_scan(false);
@@ -178,16 +191,31 @@ void ESP32BLETracker::start_scan(bool first) {
   }
 
   ESP_LOGD(TAG, "Starting scan...");
-  if (!first) {
-    for (auto *listener : this->listeners_)
-      listener->on_scan_end();
+  // A scan that was only cut short to change the window is not over for the listeners
+  if (!this->scan_mode_restart_) {
+    if (!first) {
+      for (auto *listener : this->listeners_)
+        listener->on_scan_end();
+    }
+    this->already_discovered_.clear();
   }
-  this->already_discovered_.clear();
+  this->scan_mode_restart_ = false;
+  this->scan_mode_ = this->get_desired_scan_mode_();
   this->scan_params_.scan_type = this->scan_active_ ? BLE_SCAN_TYPE_ACTIVE : BLE_SCAN_TYPE_PASSIVE;
   this->scan_params_.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
   this->scan_params_.scan_filter_policy = BLE_SCAN_FILTER_ALLOW_ALL;
   this->scan_params_.scan_interval = this->scan_interval_;
-  this->scan_params_.scan_window = this->scan_window_;
+  switch (this->scan_mode_) {
+    case SCAN_MODE_BUSY:
+      this->scan_params_.scan_window = this->busy_scan_window_;
+      break;
+    case SCAN_MODE_BURST:
+      this->scan_params_.scan_window = this->scan_interval_;
+      break;
+    default:
+      this->scan_params_.scan_window = this->scan_window_;
+      break;
+  }
 
   esp_ble_gap_set_scan_params(&this->scan_params_);
   esp_ble_gap_start_scanning(this->scan_duration_);
@@ -198,14 +226,39 @@ void ESP32BLETracker::start_scan(bool first) {
   });
 }
 
+ESP32BLETracker::ScanMode ESP32BLETracker::get_desired_scan_mode_() const {
+  if (this->busy_ && this->busy_scan_window_ != 0)
+    return SCAN_MODE_BUSY;
+  if (this->burst_)
+    return SCAN_MODE_BURST;
+  return SCAN_MODE_IDLE;
+}
+
+void ESP32BLETracker::update_scan_mode_() {
+  if (this->scan_mode_restart_ || this->get_desired_scan_mode_() == this->scan_mode_)
+    return;
+  // The scan end lock is released on the stop event, loop() then starts the next scan with the new window
+  this->scan_mode_restart_ = true;
+  esp_ble_gap_stop_scanning();
+}
+
+void ESP32BLETracker::request_busy_scan(uint32_t duration) {
+  this->busy_ = true;
+  this->set_timeout("busy", duration, [this]() { this->busy_ = false; });
+  this->update_scan_mode_();
+}
+
 void ESP32BLETracker::register_client(ESPBTClient *client) {
   client->app_id = ++this->app_id_;
   this->clients_.push_back(client);
 }
 
 void ESP32BLETracker::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
-  BLEEvent *gap_event = new BLEEvent(event, param);
-  global_esp32_ble_tracker->ble_events_.push(gap_event);
+  // Most advertisements around are of no interest, drop them before they take up the queue or get parsed
+  if (event == ESP_GAP_BLE_SCAN_RESULT_EVT && param->scan_rst.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT &&
+      !global_esp32_ble_tracker->filter_.matches(param->scan_rst))
+    return;
+  global_esp32_ble_tracker->ble_events_.emplace(event, param);
 }
 
 void ESP32BLETracker::real_gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
@@ -254,8 +307,7 @@ void ESP32BLETracker::gap_scan_result(const esp_ble_gap_cb_param_t::ble_scan_res
 
 void ESP32BLETracker::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
                                           esp_ble_gattc_cb_param_t *param) {
-  BLEEvent *gattc_event = new BLEEvent(event, gattc_if, param);
-  global_esp32_ble_tracker->ble_events_.push(gattc_event);
+  global_esp32_ble_tracker->ble_events_.emplace(event, gattc_if, param);
 }
 
 void ESP32BLETracker::real_gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
@@ -391,12 +443,61 @@ optional<ESPBLEiBeacon> ESPBLEiBeacon::from_manufacturer_data(const ServiceData
   return ESPBLEiBeacon(data.data.data());
 }
 
+/// Call f(type, record, record_length) for all records of an advertisement, until f returns true.
+template<typename F> static bool for_each_adv_record(const uint8_t *payload, uint8_t len, F &&f) {
+  size_t offset = 0;
+  while (offset + 2 < len) {
+    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
+    if (field_length == 0 || offset + field_length > len)
+      break;
+    const uint8_t record_type = payload[offset++];
+    const uint8_t *record = &payload[offset];
+    const uint8_t record_length = field_length - 1;
+    offset += record_length;
+    if (f(record_type, record, record_length))
+      return true;
+  }
+  return false;
+}
+static uint16_t read_uint16(const uint8_t *data) { return *reinterpret_cast<const uint16_t *>(data); }
+static uint32_t read_uint32(const uint8_t *data) { return *reinterpret_cast<const uint32_t *>(data); }
+/// The UUID a service UUID list or service data record starts with, false if it is not one or too short.
+static bool leading_uuid(uint8_t record_type, const uint8_t *record, uint8_t record_length, ESPBTUUID *uuid) {
+  switch (record_type) {
+    case ESP_BLE_AD_TYPE_16SRV_CMPL:
+    case ESP_BLE_AD_TYPE_16SRV_PART:
+    case ESP_BLE_AD_TYPE_SERVICE_DATA:
+      if (record_length < 2)
+        return false;
+      *uuid = ESPBTUUID::from_uint16(read_uint16(record));
+      return true;
+    case ESP_BLE_AD_TYPE_32SRV_CMPL:
+    case ESP_BLE_AD_TYPE_32SRV_PART:
+    case ESP_BLE_AD_TYPE_32SERVICE_DATA:
+      if (record_length < 4)
+        return false;
+      *uuid = ESPBTUUID::from_uint32(read_uint32(record));
+      return true;
+    case ESP_BLE_AD_TYPE_128SRV_CMPL:
+    case ESP_BLE_AD_TYPE_128SRV_PART:
+    case ESP_BLE_AD_TYPE_128SERVICE_DATA:
+      if (record_length < 16)
+        return false;
+      *uuid = ESPBTUUID::from_raw(record);
+      return true;
+    default:
+      return false;
+  }
+}
+
 void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
   for (uint8_t i = 0; i < ESP_BD_ADDR_LEN; i++)
     this->address_[i] = param.bda[i];
   this->address_type_ = param.ble_addr_type;
   this->rssi_ = param.rssi;
-  this->parse_adv_(param);
+  this->adv_len_ = std::min<size_t>(param.adv_data_len + param.scan_rsp_len, sizeof(this->adv_));
+  memcpy(this->adv_, param.ble_adv, this->adv_len_);
+  this->parsed_ = false;
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   ESP_LOGVV(TAG, "Parse Result:");
@@ -419,7 +520,7 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
             this->address_[2], this->address_[3], this->address_[4], this->address_[5], address_type);
 
   ESP_LOGVV(TAG, "  RSSI: %d", this->rssi_);
-  ESP_LOGVV(TAG, "  Name: '%s'", this->name_.c_str());
+  ESP_LOGVV(TAG, "  Name: '%s'", this->get_name().c_str());
   for (auto &it : this->tx_powers_) {
     ESP_LOGVV(TAG, "  TX Power: %d", it);
   }
@@ -441,13 +542,24 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
     ESP_LOGVV(TAG, "    Data: %s", hexencode(data.data).c_str());
   }
 
-  ESP_LOGVV(TAG, "Adv data: %s", hexencode(param.ble_adv, param.adv_data_len + param.scan_rsp_len).c_str());
+  ESP_LOGVV(TAG, "Adv data: %s", hexencode(this->adv_, this->adv_len_).c_str());
 #endif
 }
-void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
+void ESPBTDevice::parse_adv_() const {
+  if (this->parsed_)
+    return;
+  this->parsed_ = true;
+  this->name_.clear();
+  this->tx_powers_.clear();
+  this->appearance_.reset();
+  this->ad_flag_.reset();
+  this->service_uuids_.clear();
+  this->manufacturer_datas_.clear();
+  this->service_datas_.clear();
+
   size_t offset = 0;
-  const uint8_t *payload = param.ble_adv;
-  uint8_t len = param.adv_data_len + param.scan_rsp_len;
+  const uint8_t *payload = this->adv_;
+  uint8_t len = this->adv_len_;
 
   while (offset + 2 < len) {
     const uint8_t field_length = payload[offset++];  // First byte is length of adv record
@@ -478,7 +590,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        this->tx_powers_.push_back(*record);
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -594,6 +706,75 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
     }
   }
 }
+bool ESPBTDevice::has_service_uuid(const ESPBTUUID &uuid) const {
+  return for_each_adv_record(this->adv_, this->adv_len_,
+                             [&uuid](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+                               switch (record_type) {
+                                 case ESP_BLE_AD_TYPE_16SRV_CMPL:
+                                 case ESP_BLE_AD_TYPE_16SRV_PART:
+                                   for (uint8_t i = 0; i < record_length / 2; i++) {
+                                     if (ESPBTUUID::from_uint16(read_uint16(record + 2 * i)) == uuid)
+                                       return true;
+                                   }
+                                   return false;
+                                 case ESP_BLE_AD_TYPE_32SRV_CMPL:
+                                 case ESP_BLE_AD_TYPE_32SRV_PART:
+                                   for (uint8_t i = 0; i < record_length / 4; i++) {
+                                     if (ESPBTUUID::from_uint32(read_uint32(record + 4 * i)) == uuid)
+                                       return true;
+                                   }
+                                   return false;
+                                 case ESP_BLE_AD_TYPE_128SRV_CMPL:
+                                 case ESP_BLE_AD_TYPE_128SRV_PART:
+                                   return record_length >= 16 && ESPBTUUID::from_raw(record) == uuid;
+                                 default:
+                                   return false;
+                               }
+                             });
+}
+optional<ServiceDataView> ESPBTDevice::find_service_data(const ESPBTUUID &uuid) const {
+  optional<ServiceDataView> result;
+  for_each_adv_record(this->adv_, this->adv_len_,
+                      [&uuid, &result](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+                        uint8_t uuid_length;
+                        switch (record_type) {
+                          case ESP_BLE_AD_TYPE_SERVICE_DATA:
+                            uuid_length = 2;
+                            break;
+                          case ESP_BLE_AD_TYPE_32SERVICE_DATA:
+                            uuid_length = 4;
+                            break;
+                          case ESP_BLE_AD_TYPE_128SERVICE_DATA:
+                            uuid_length = 16;
+                            break;
+                          default:
+                            return false;
+                        }
+                        ServiceDataView view{};
+                        if (!leading_uuid(record_type, record, record_length, &view.uuid) || view.uuid != uuid)
+                          return false;
+                        view.data = record + uuid_length;
+                        view.size = record_length - uuid_length;
+                        result = view;
+                        return true;
+                      });
+  return result;
+}
+optional<ServiceDataView> ESPBTDevice::find_manufacturer_data(const ESPBTUUID &id) const {
+  optional<ServiceDataView> result;
+  for_each_adv_record(this->adv_, this->adv_len_,
+                      [&id, &result](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+                        if (record_type != ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE || record_length < 2)
+                          return false;
+                        ServiceDataView view{ESPBTUUID::from_uint16(read_uint16(record)), record + 2,
+                                             size_t(record_length - 2)};
+                        if (view.uuid != id)
+                          return false;
+                        result = view;
+                        return true;
+                      });
+  return result;
+}
 std::string ESPBTDevice::address_str() const {
   char mac[24];
   snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X", this->address_[0], this->address_[1], this->address_[2],
@@ -602,12 +783,102 @@ std::string ESPBTDevice::address_str() const {
 }
 uint64_t ESPBTDevice::address_uint64() const { return ble_addr_to_uint64(this->address_); }
 
+uint64_t ESPBTAdvertisementFilter::uuid_key_(const ESPBTUUID &uuid, uint64_t tag) {
+  esp_bt_uuid_t full = uuid.as_128bit().get_uuid();
+  uint64_t low, high;
+  memcpy(&low, full.uuid.uuid128, sizeof(low));
+  memcpy(&high, full.uuid.uuid128 + sizeof(low), sizeof(high));
+  return ((low ^ high) & ~(SERVICE_UUID_KEY | MANUFACTURER_ID_KEY)) | tag;
+}
+void ESPBTAdvertisementFilter::insert_(uint64_t key) {
+  if (key == 0 || this->contains_(key))
+    return;
+  if ((this->count_ + 1) * 2 > this->slots_.size()) {
+    std::vector<uint64_t> old;
+    old.swap(this->slots_);
+    this->slots_.resize(std::max<size_t>(8, old.size() * 2), 0);
+    for (uint64_t existing : old) {
+      if (existing == 0)
+        continue;
+      size_t i = this->slot_(existing);
+      while (this->slots_[i] != 0)
+        i = (i + 1) & (this->slots_.size() - 1);
+      this->slots_[i] = existing;
+    }
+  }
+  size_t i = this->slot_(key);
+  while (this->slots_[i] != 0)
+    i = (i + 1) & (this->slots_.size() - 1);
+  this->slots_[i] = key;
+  this->count_++;
+}
+bool ESPBTAdvertisementFilter::contains_(uint64_t key) const {
+  if (this->slots_.empty())
+    return false;
+  for (size_t i = this->slot_(key); this->slots_[i] != 0; i = (i + 1) & (this->slots_.size() - 1)) {
+    if (this->slots_[i] == key)
+      return true;
+  }
+  return false;
+}
+bool ESPBTAdvertisementFilter::matches(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) const {
+  if (this->is_open() || this->contains_(ble_addr_to_uint64(param.bda)))
+    return true;
+
+  return for_each_adv_record(param.ble_adv, param.adv_data_len + param.scan_rsp_len,
+                             [this](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
+                               switch (record_type) {
+                                 case ESP_BLE_AD_TYPE_16SRV_CMPL:
+                                 case ESP_BLE_AD_TYPE_16SRV_PART:
+                                   for (uint8_t i = 0; i < record_length / 2; i++) {
+                                     auto uuid = ESPBTUUID::from_uint16(read_uint16(record + 2 * i));
+                                     if (this->contains_(uuid_key_(uuid, SERVICE_UUID_KEY)))
+                                       return true;
+                                   }
+                                   return false;
+                                 case ESP_BLE_AD_TYPE_32SRV_CMPL:
+                                 case ESP_BLE_AD_TYPE_32SRV_PART:
+                                   for (uint8_t i = 0; i < record_length / 4; i++) {
+                                     auto uuid = ESPBTUUID::from_uint32(read_uint32(record + 4 * i));
+                                     if (this->contains_(uuid_key_(uuid, SERVICE_UUID_KEY)))
+                                       return true;
+                                   }
+                                   return false;
+                                 case ESP_BLE_AD_TYPE_128SRV_CMPL:
+                                 case ESP_BLE_AD_TYPE_128SRV_PART:
+                                 case ESP_BLE_AD_TYPE_SERVICE_DATA:
+                                 case ESP_BLE_AD_TYPE_32SERVICE_DATA:
+                                 case ESP_BLE_AD_TYPE_128SERVICE_DATA: {
+                                   ESPBTUUID uuid;
+                                   if (!leading_uuid(record_type, record, record_length, &uuid))
+                                     return false;
+                                   return this->contains_(uuid_key_(uuid, SERVICE_UUID_KEY));
+                                 }
+                                 case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE:
+                                   return record_length >= 2 &&
+                                          this->contains_(uuid_key_(ESPBTUUID::from_uint16(read_uint16(record)),
+                                                                    MANUFACTURER_ID_KEY));
+                                 default:
+                                   return false;
+                               }
+                             });
+}
+
 void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "BLE Tracker:");
   ESP_LOGCONFIG(TAG, "  Scan Duration: %u s", this->scan_duration_);
   ESP_LOGCONFIG(TAG, "  Scan Interval: %.1f ms", this->scan_interval_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Window: %.1f ms", this->scan_window_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Type: %s", this->scan_active_ ? "ACTIVE" : "PASSIVE");
+  if (this->busy_scan_window_ != 0)
+    ESP_LOGCONFIG(TAG, "  Busy Scan Window: %.1f ms", this->busy_scan_window_ * 0.625f);
+  if (this->burst_interval_ != 0)
+    ESP_LOGCONFIG(TAG, "  Burst Scans: %u ms every %u ms", this->burst_duration_, this->burst_interval_);
+  if (this->filter_.is_open()) {
+    ESP_LOGCONFIG(TAG, "  Advertisement Filter: none");
+  } else {
+    ESP_LOGCONFIG(TAG, "  Advertisement Filter: %u entries", this->filter_.size());
+  }
 }
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
   const uint64_t address = device.address_uint64();
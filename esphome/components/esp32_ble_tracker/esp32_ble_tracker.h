@@ -49,6 +49,13 @@ struct ServiceData {
   adv_data_t data;
 };
 
+/// Service or manufacturer data pointing into the advertisement of an ESPBTDevice, only valid while the device is.
+struct ServiceDataView {
+  ESPBTUUID uuid;
+  const uint8_t *data;
+  size_t size;
+};
+
 class ESPBLEiBeacon {
  public:
   ESPBLEiBeacon() { memset(&this->beacon_data_, 0, sizeof(this->beacon_data_)); }
@@ -71,6 +78,11 @@ class ESPBLEiBeacon {
   } PACKED beacon_data_;
 };
 
+/** A scanned device and its advertisement.
+ *
+ * Only the raw advertisement is stored. The fields are parsed on first access of any of the collections below, the
+ * find and has methods scan the raw records instead and never allocate.
+ */
 class ESPBTDevice {
  public:
   void parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
@@ -83,20 +95,51 @@ class ESPBTDevice {
 
   esp_ble_addr_type_t get_address_type() const { return this->address_type_; }
   int get_rssi() const { return rssi_; }
-  const std::string &get_name() const { return this->name_; }
+  const std::string &get_name() const {
+    this->parse_adv_();
+    return this->name_;
+  }
+
+  const std::vector<int8_t> &get_tx_powers() const {
+    this->parse_adv_();
+    return this->tx_powers_;
+  }
 
-  const std::vector<int8_t> &get_tx_powers() const { return tx_powers_; }
+  const optional<uint16_t> &get_appearance() const {
+    this->parse_adv_();
+    return this->appearance_;
+  }
+  const optional<uint8_t> &get_ad_flag() const {
+    this->parse_adv_();
+    return this->ad_flag_;
+  }
+  const std::vector<ESPBTUUID> &get_service_uuids() const {
+    this->parse_adv_();
+    return this->service_uuids_;
+  }
+
+  const std::vector<ServiceData> &get_manufacturer_datas() const {
+    this->parse_adv_();
+    return this->manufacturer_datas_;
+  }
 
-  const optional<uint16_t> &get_appearance() const { return appearance_; }
-  const optional<uint8_t> &get_ad_flag() const { return ad_flag_; }
-  const std::vector<ESPBTUUID> &get_service_uuids() const { return service_uuids_; }
+  const std::vector<ServiceData> &get_service_datas() const {
+    this->parse_adv_();
+    return this->service_datas_;
+  }
 
-  const std::vector<ServiceData> &get_manufacturer_datas() const { return manufacturer_datas_; }
+  /// Whether the advertisement lists this service UUID.
+  bool has_service_uuid(const ESPBTUUID &uuid) const;
+  /// The first service data for this UUID, without parsing the rest of the advertisement.
+  optional<ServiceDataView> find_service_data(const ESPBTUUID &uuid) const;
+  /// The first manufacturer data for this company ID, without parsing the rest of the advertisement.
+  optional<ServiceDataView> find_manufacturer_data(const ESPBTUUID &id) const;
 
-  const std::vector<ServiceData> &get_service_datas() const { return service_datas_; }
+  const uint8_t *get_raw_advertisement() const { return this->adv_; }
+  uint8_t get_raw_advertisement_length() const { return this->adv_len_; }
 
   optional<ESPBLEiBeacon> get_ibeacon() const {
-    for (auto &it : this->manufacturer_datas_) {
+    for (auto &it : this->get_manufacturer_datas()) {
       auto res = ESPBLEiBeacon::from_manufacturer_data(it);
       if (res.has_value())
         return *res;
@@ -105,20 +148,61 @@ class ESPBTDevice {
   }
 
  protected:
-  void parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Fill the collections from the raw advertisement, once.
+  void parse_adv_() const;
 
   esp_bd_addr_t address_{
       0,
   };
   esp_ble_addr_type_t address_type_{BLE_ADDR_TYPE_PUBLIC};
   int rssi_{0};
-  std::string name_{};
-  std::vector<int8_t> tx_powers_{};
-  optional<uint16_t> appearance_{};
-  optional<uint8_t> ad_flag_{};
-  std::vector<ESPBTUUID> service_uuids_;
-  std::vector<ServiceData> manufacturer_datas_{};
-  std::vector<ServiceData> service_datas_{};
+  uint8_t adv_[ESP_BLE_ADV_DATA_LEN_MAX + ESP_BLE_SCAN_RSP_DATA_LEN_MAX];
+  uint8_t adv_len_{0};
+  mutable bool parsed_{false};
+  mutable std::string name_{};
+  mutable std::vector<int8_t> tx_powers_{};
+  mutable optional<uint16_t> appearance_{};
+  mutable optional<uint8_t> ad_flag_{};
+  mutable std::vector<ESPBTUUID> service_uuids_;
+  mutable std::vector<ServiceData> manufacturer_datas_{};
+  mutable std::vector<ServiceData> service_datas_{};
+};
+
+/** The addresses, service UUIDs and manufacturer IDs the listeners care about.
+ *
+ * Checked for every advertisement in the Bluedroid task, before the advertisement is queued and parsed. Entries are
+ * 64 bit keys in a small open addressing hash set, UUIDs are folded from their 128 bit form, so a collision only ever
+ * lets an advertisement through. Only filled before scanning starts.
+ */
+class ESPBTAdvertisementFilter {
+ public:
+  void add_address(uint64_t address) { this->insert_(address); }
+  void add_service_uuid(const ESPBTUUID &uuid) { this->insert_(uuid_key_(uuid, SERVICE_UUID_KEY)); }
+  void add_manufacturer_id(const ESPBTUUID &id) { this->insert_(uuid_key_(id, MANUFACTURER_ID_KEY)); }
+  /// Let every advertisement through, for listeners that look at all of them.
+  void accept_all() { this->accept_all_ = true; }
+
+  /// Whether nothing is filtered out.
+  bool is_open() const { return this->accept_all_ || this->count_ == 0; }
+  size_t size() const { return this->count_; }
+
+  /// Whether the advertisement is from an address or has a service UUID or manufacturer ID that was added.
+  bool matches(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) const;
+
+ protected:
+  // Addresses only use the lower 48 bits, UUID keys are tagged in the upper two
+  static const uint64_t SERVICE_UUID_KEY = 1ULL << 63;
+  static const uint64_t MANUFACTURER_ID_KEY = 1ULL << 62;
+
+  static uint64_t uuid_key_(const ESPBTUUID &uuid, uint64_t tag);
+  void insert_(uint64_t key);
+  bool contains_(uint64_t key) const;
+  size_t slot_(uint64_t key) const { return (key * 0x9E3779B97F4A7C15ULL) >> 32 & (this->slots_.size() - 1); }
+
+  /// Power of two many slots, zero marks an empty slot.
+  std::vector<uint64_t> slots_;
+  size_t count_{0};
+  bool accept_all_{false};
 };
 
 class ESP32BLETracker;
@@ -165,6 +249,9 @@ class ESP32BLETracker : public Component {
   void set_scan_interval(uint32_t scan_interval) { scan_interval_ = scan_interval; }
   void set_scan_window(uint32_t scan_window) { scan_window_ = scan_window; }
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
+  void set_busy_scan_window(uint32_t busy_scan_window) { busy_scan_window_ = busy_scan_window; }
+  void set_burst_interval(uint32_t burst_interval) { burst_interval_ = burst_interval; }
+  void set_burst_duration(uint32_t burst_duration) { burst_duration_ = burst_duration; }
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -179,9 +266,41 @@ class ESP32BLETracker : public Component {
 
   void register_client(ESPBTClient *client);
 
+  /** Only pass advertisements from this address to the listeners.
+   *
+   * Once anything was added, advertisements that match none of the addresses, service UUIDs and manufacturer IDs are
+   * dropped before they are parsed, and unknown devices are no longer logged. Listeners that want to see everything
+   * call add_any_interest() instead.
+   */
+  void add_address_interest(uint64_t address) { this->filter_.add_address(address); }
+  /// Also pass advertisements listing or carrying data for this service UUID, see add_address_interest().
+  void add_service_uuid_interest(const ESPBTUUID &uuid) { this->filter_.add_service_uuid(uuid); }
+  /// Also pass advertisements with manufacturer data of this company ID, see add_address_interest().
+  void add_manufacturer_id_interest(const ESPBTUUID &id) { this->filter_.add_manufacturer_id(id); }
+  /// Some listener looks at every advertisement, don't filter any.
+  void add_any_interest() { this->filter_.accept_all(); }
+
+  /** Scan with the busy window for the next `duration` milliseconds.
+   *
+   * The scanner shares the 2.4GHz radio with WiFi, so components moving a lot of data over the network (OTA updates,
+   * camera streams) call this to leave WiFi more airtime. Calling it again extends the busy period. A running scan is
+   * restarted with the new window right away.
+   */
+  void request_busy_scan(uint32_t duration);
+
   void print_bt_device_info(const ESPBTDevice &device);
 
  protected:
+  enum ScanMode : uint8_t {
+    SCAN_MODE_IDLE = 0,
+    SCAN_MODE_BUSY,
+    SCAN_MODE_BURST,
+  };
+
+  /// The scan mode the current busy and burst state asks for.
+  ScanMode get_desired_scan_mode_() const;
+  /// Restart the running scan if its window does not match the desired scan mode anymore.
+  void update_scan_mode_();
   /// The FreeRTOS task managing the bluetooth interface.
   static bool ble_setup();
   /// Start a single scan by setting up the parameters and doing some esp-idf calls.
@@ -215,6 +334,17 @@ class ESP32BLETracker : public Component {
   uint32_t scan_interval_;
   uint32_t scan_window_;
   bool scan_active_;
+  /// The scan window while request_busy_scan() is in effect, 0 to keep scanning with scan_window_.
+  uint32_t busy_scan_window_{0};
+  /// Every burst_interval_ ms, scan continuously for burst_duration_ ms. 0 disables bursts.
+  uint32_t burst_interval_{0};
+  uint32_t burst_duration_{0};
+  bool busy_{false};
+  bool burst_{false};
+  /// The mode the running scan was started with.
+  ScanMode scan_mode_{SCAN_MODE_IDLE};
+  /// The running scan was stopped to switch modes, the next one continues it.
+  bool scan_mode_restart_{false};
   SemaphoreHandle_t scan_result_lock_;
   SemaphoreHandle_t scan_end_lock_;
   size_t scan_result_index_{0};
@@ -222,7 +352,9 @@ class ESP32BLETracker : public Component {
   esp_bt_status_t scan_start_failed_{ESP_BT_STATUS_SUCCESS};
   esp_bt_status_t scan_set_param_failed_{ESP_BT_STATUS_SUCCESS};
 
-  Queue<BLEEvent> ble_events_;
+  ESPBTAdvertisementFilter filter_;
+  EventRing<BLEEvent, 64> ble_events_;
+  uint32_t ble_events_dropped_{0};
 };
 
 extern ESP32BLETracker *global_esp32_ble_tracker;
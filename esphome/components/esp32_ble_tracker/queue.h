@@ -2,8 +2,10 @@
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 
-#include <queue>
-#include <mutex>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 #ifdef ARDUINO_ARCH_ESP32
 
@@ -13,43 +15,58 @@
 /*
  * BLE events come in from a separate Task (thread) in the ESP32 stack. Rather
  * than trying to deal wth various locking strategies, all incoming GAP and GATT
- * events will simply be placed on a semaphore guarded queue. The next time the
- * component runs loop(), these events are popped off the queue and handed at
+ * events will simply be copied into a lock-free ring. The next time the
+ * component runs loop(), these events are handled in place and popped off the ring at
  * this safer time.
  */
 
 namespace esphome {
 namespace esp32_ble_tracker {
 
-template<class T> class Queue {
+/** A fixed ring of SIZE slots that elements are constructed in and consumed from in place.
+ *
+ * Single producer single consumer: all GAP and GATTC callbacks run in the Bluedroid task, and only loop() consumes.
+ * Nothing is allocated after construction, a full ring drops the new element and counts it.
+ */
+template<class T, size_t SIZE> class EventRing {
+  static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "EventRing size must be a power of two");
+
  public:
-  Queue() { m = xSemaphoreCreateMutex(); }
-
-  void push(T *element) {
-    if (element == nullptr)
-      return;
-    if (xSemaphoreTake(m, 5L / portTICK_PERIOD_MS)) {
-      q.push(element);
-      xSemaphoreGive(m);
+  /// Construct an element in the next free slot, returns false (and counts a drop) if the ring is full.
+  template<typename... Args> bool emplace(Args &&...args) {
+    const uint32_t head = this->head_.load(std::memory_order_relaxed);
+    if (head - this->tail_.load(std::memory_order_acquire) == SIZE) {
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
     }
+    new (&this->slots_[head & (SIZE - 1)]) T(std::forward<Args>(args)...);
+    this->head_.store(head + 1, std::memory_order_release);
+    return true;
   }
 
-  T *pop() {
-    T *element = nullptr;
+  /// The oldest element, or nullptr if the ring is empty. Stays valid until pop().
+  T *front() {
+    const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (this->head_.load(std::memory_order_acquire) == tail)
+      return nullptr;
+    return reinterpret_cast<T *>(&this->slots_[tail & (SIZE - 1)]);
+  }
 
-    if (xSemaphoreTake(m, 5L / portTICK_PERIOD_MS)) {
-      if (!q.empty()) {
-        element = q.front();
-        q.pop();
-      }
-      xSemaphoreGive(m);
-    }
-    return element;
+  /// Destroy the oldest element and hand its slot back to the producer.
+  void pop() {
+    const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    reinterpret_cast<T *>(&this->slots_[tail & (SIZE - 1)])->~T();
+    this->tail_.store(tail + 1, std::memory_order_release);
   }
 
+  /// Number of elements dropped because the main loop did not keep up.
+  uint32_t get_dropped_count() const { return this->dropped_.load(std::memory_order_relaxed); }
+
  protected:
-  std::queue<T *> q;
-  SemaphoreHandle_t m;
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type slots_[SIZE];
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
 };
 
 // Received GAP and GATTC events are only queued, and get processed in the main loop().
@@ -59,6 +59,8 @@ CONF_VERTICAL_FLIP = "vertical_flip"
 CONF_HORIZONTAL_MIRROR = "horizontal_mirror"
 CONF_SATURATION = "saturation"
 CONF_TEST_PATTERN = "test_pattern"
+CONF_FALLBACK = "fallback"
+CONF_FRAME_BUFFER_COUNT = "frame_buffer_count"
 
 camera_range_param = cv.int_range(min=-2, max=2)
 
@@ -102,6 +104,17 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(CONF_VERTICAL_FLIP, default=True): cv.boolean,
         cv.Optional(CONF_HORIZONTAL_MIRROR, default=True): cv.boolean,
         cv.Optional(CONF_TEST_PATTERN, default=False): cv.boolean,
+        cv.Optional(CONF_FRAME_BUFFER_COUNT, default=1): cv.int_range(min=1, max=2),
+        cv.Optional(CONF_FALLBACK): cv.Schema(
+            {
+                cv.Optional(CONF_RESOLUTION, default="320X240"): cv.enum(
+                    FRAME_SIZES, upper=True
+                ),
+                cv.Optional(CONF_JPEG_QUALITY, default=30): cv.int_range(
+                    min=10, max=63
+                ),
+            }
+        ),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -119,11 +132,14 @@ SETTERS = {
     CONF_BRIGHTNESS: "set_brightness",
     CONF_SATURATION: "set_saturation",
     CONF_TEST_PATTERN: "set_test_pattern",
+    CONF_FRAME_BUFFER_COUNT: "set_frame_buffer_count",
 }
 
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID], config[CONF_NAME])
+    object_id, object_id_hash = cg.object_id_from_name(config[CONF_NAME])
+    cg.add(var.set_object_id(object_id, object_id_hash))
     await cg.register_component(var, config)
 
     for key, setter in SETTERS.items():
@@ -140,6 +156,11 @@ async def to_code(config):
     else:
         cg.add(var.set_idle_update_interval(1000 / config[CONF_IDLE_FRAMERATE]))
     cg.add(var.set_frame_size(config[CONF_RESOLUTION]))
+    if CONF_FALLBACK in config:
+        fallback = config[CONF_FALLBACK]
+        cg.add(
+            var.set_fallback(fallback[CONF_RESOLUTION], fallback[CONF_JPEG_QUALITY])
+        )
 
     cg.add_define("USE_ESP32_CAMERA")
     cg.add_build_flag("-DBOARD_HAS_PSRAM")
@@ -1,5 +1,8 @@
 #include "esp32_camera.h"
 #include "esphome/core/log.h"
+#ifdef USE_ESP32_BLE_TRACKER
+#include "esphome/components/esp32_ble_tracker/esp32_ble_tracker.h"
+#endif
 
 #ifdef ARDUINO_ARCH_ESP32
 
@@ -12,6 +15,10 @@ void ESP32Camera::setup() {
   global_esp32_camera = this;
 
   this->last_update_ = millis();
+  if (this->config_.fb_count > 1 && !psramFound()) {
+    ESP_LOGW(TAG, "Double buffering needs PSRAM, using a single frame buffer");
+    this->config_.fb_count = 1;
+  }
   esp_err_t err = esp_camera_init(&this->config_);
   if (err != ESP_OK) {
     ESP_LOGE(TAG, "esp_camera_init failed: %s", esp_err_to_name(err));
@@ -30,12 +37,12 @@ void ESP32Camera::setup() {
   this->framebuffer_get_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
   this->framebuffer_return_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
   xTaskCreatePinnedToCore(&ESP32Camera::framebuffer_task,
-                          "framebuffer_task",  // name
-                          1024,                // stack size
-                          nullptr,             // task pv params
-                          0,                   // priority
-                          nullptr,             // handle
-                          1                    // core
+                          "framebuffer_task",               // name
+                          1024,                             // stack size
+                          nullptr,                          // task pv params
+                          0,                                // priority
+                          &this->framebuffer_task_handle_,  // handle
+                          1                                 // core
   );
 }
 void ESP32Camera::dump_config() {
@@ -94,7 +101,7 @@ void ESP32Camera::dump_config() {
   sensor_t *s = esp_camera_sensor_get();
   auto st = s->status;
   ESP_LOGCONFIG(TAG, "  JPEG Quality: %u", st.quality);
-  // ESP_LOGCONFIG(TAG, "  Framebuffer Count: %u", conf.fb_count);
+  ESP_LOGCONFIG(TAG, "  Framebuffer Count: %u", conf.fb_count);
   ESP_LOGCONFIG(TAG, "  Contrast: %d", st.contrast);
   ESP_LOGCONFIG(TAG, "  Brightness: %d", st.brightness);
   ESP_LOGCONFIG(TAG, "  Saturation: %d", st.saturation);
@@ -117,6 +124,9 @@ void ESP32Camera::dump_config() {
   // ESP_LOGCONFIG(TAG, "  Lens Correction: %u", st.lenc);
   // ESP_LOGCONFIG(TAG, "  DCW: %u", st.dcw);
   ESP_LOGCONFIG(TAG, "  Test Pattern: %s", YESNO(st.colorbar));
+  if (this->has_fallback_())
+    ESP_LOGCONFIG(TAG, "  Fallback: JPEG Quality: %u, Frame Size: %u", this->fallback_jpeg_quality_,
+                  this->fallback_frame_size_);
 }
 void ESP32Camera::loop() {
   // check if we can return the image
@@ -125,15 +135,21 @@ void ESP32Camera::loop() {
     auto *fb = this->current_image_->get_raw_buffer();
     xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
     this->current_image_.reset();
+    this->update_fallback_(millis() - this->last_update_);
   }
 
   // Check if we should fetch a new image
   if (!this->has_requested_image_())
     return;
   if (this->current_image_.use_count() > 1) {
-    // image is still in use
+    // image is still in use by a client, don't capture frames nobody can receive
     return;
   }
+  if (!this->capture_requested_) {
+    // Frames are only captured on request, so that a waiting frame is never older than the request
+    xTaskNotifyGive(this->framebuffer_task_handle_);
+    this->capture_requested_ = true;
+  }
   const uint32_t now = millis();
   if (now - this->last_update_ <= this->max_update_interval_)
     return;
@@ -145,6 +161,7 @@ void ESP32Camera::loop() {
     ESP_LOGVV(TAG, "No frame ready");
     return;
   }
+  this->capture_requested_ = false;
 
   if (fb == nullptr) {
     ESP_LOGW(TAG, "Got invalid frame from camera!");
@@ -158,8 +175,39 @@ void ESP32Camera::loop() {
   this->last_update_ = now;
   this->single_requester_ = false;
 }
+void ESP32Camera::update_fallback_(uint32_t drain_time) {
+  if (!this->has_fallback_())
+    return;
+
+  if (!this->fallback_active_) {
+    // All clients together took more than two frame intervals to receive the image
+    if (drain_time > 2 * this->max_update_interval_) {
+      ESP_LOGD(TAG, "Clients fall behind (%u ms per image), using fallback settings", drain_time);
+      this->apply_settings_(this->fallback_frame_size_, this->fallback_jpeg_quality_);
+      this->fallback_active_ = true;
+      this->fast_images_ = 0;
+    }
+    return;
+  }
+
+  if (drain_time > this->max_update_interval_ / 2) {
+    this->fast_images_ = 0;
+    return;
+  }
+  if (++this->fast_images_ >= 10) {
+    ESP_LOGD(TAG, "Clients caught up, restoring configured settings");
+    this->apply_settings_(this->config_.frame_size, this->config_.jpeg_quality);
+    this->fallback_active_ = false;
+  }
+}
+void ESP32Camera::apply_settings_(framesize_t frame_size, uint8_t jpeg_quality) {
+  sensor_t *s = esp_camera_sensor_get();
+  s->set_framesize(s, frame_size);
+  s->set_quality(s, jpeg_quality);
+}
 void ESP32Camera::framebuffer_task(void *pv) {
   while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
     camera_fb_t *framebuffer = esp_camera_fb_get();
     xQueueSend(global_esp32_camera->framebuffer_get_queue_, &framebuffer, portMAX_DELAY);
     // return is no-op for config with 1 fb
@@ -201,41 +249,37 @@ void ESP32Camera::set_i2c_pins(uint8_t sda, uint8_t scl) {
   this->config_.pin_sscb_sda = sda;
   this->config_.pin_sscb_scl = scl;
 }
-void ESP32Camera::set_frame_size(ESP32CameraFrameSize size) {
+static framesize_t to_framesize(ESP32CameraFrameSize size) {
   switch (size) {
     case ESP32_CAMERA_SIZE_160X120:
-      this->config_.frame_size = FRAMESIZE_QQVGA;
-      break;
+      return FRAMESIZE_QQVGA;
     case ESP32_CAMERA_SIZE_176X144:
-      this->config_.frame_size = FRAMESIZE_QCIF;
-      break;
+      return FRAMESIZE_QCIF;
     case ESP32_CAMERA_SIZE_240X176:
-      this->config_.frame_size = FRAMESIZE_HQVGA;
-      break;
+      return FRAMESIZE_HQVGA;
     case ESP32_CAMERA_SIZE_320X240:
-      this->config_.frame_size = FRAMESIZE_QVGA;
-      break;
+      return FRAMESIZE_QVGA;
     case ESP32_CAMERA_SIZE_400X296:
-      this->config_.frame_size = FRAMESIZE_CIF;
-      break;
+      return FRAMESIZE_CIF;
     case ESP32_CAMERA_SIZE_640X480:
-      this->config_.frame_size = FRAMESIZE_VGA;
-      break;
+      return FRAMESIZE_VGA;
     case ESP32_CAMERA_SIZE_800X600:
-      this->config_.frame_size = FRAMESIZE_SVGA;
-      break;
+      return FRAMESIZE_SVGA;
     case ESP32_CAMERA_SIZE_1024X768:
-      this->config_.frame_size = FRAMESIZE_XGA;
-      break;
+      return FRAMESIZE_XGA;
     case ESP32_CAMERA_SIZE_1280X1024:
-      this->config_.frame_size = FRAMESIZE_SXGA;
-      break;
+      return FRAMESIZE_SXGA;
     case ESP32_CAMERA_SIZE_1600X1200:
-      this->config_.frame_size = FRAMESIZE_UXGA;
-      break;
+      return FRAMESIZE_UXGA;
   }
+  return FRAMESIZE_VGA;
 }
+void ESP32Camera::set_frame_size(ESP32CameraFrameSize size) { this->config_.frame_size = to_framesize(size); }
 void ESP32Camera::set_jpeg_quality(uint8_t quality) { this->config_.jpeg_quality = quality; }
+void ESP32Camera::set_fallback(ESP32CameraFrameSize size, uint8_t quality) {
+  this->fallback_frame_size_ = to_framesize(size);
+  this->fallback_jpeg_quality_ = quality;
+}
 void ESP32Camera::set_reset_pin(uint8_t pin) { this->config_.pin_reset = pin; }
 void ESP32Camera::set_power_down_pin(uint8_t pin) { this->config_.pin_pwdn = pin; }
 void ESP32Camera::add_image_callback(std::function<void(std::shared_ptr<CameraImage>)> &&f) {
@@ -249,7 +293,14 @@ void ESP32Camera::set_saturation(int saturation) { this->saturation_ = saturatio
 float ESP32Camera::get_setup_priority() const { return setup_priority::DATA; }
 uint32_t ESP32Camera::hash_base() { return 3010542557UL; }
 void ESP32Camera::request_image() { this->single_requester_ = true; }
-void ESP32Camera::request_stream() { this->last_stream_request_ = millis(); }
+void ESP32Camera::request_stream() {
+  this->last_stream_request_ = millis();
+#ifdef USE_ESP32_BLE_TRACKER
+  // Streams move a lot of data over WiFi, scan less while they last
+  if (esp32_ble_tracker::global_esp32_ble_tracker != nullptr)
+    esp32_ble_tracker::global_esp32_ble_tracker->request_busy_scan(5000);
+#endif
+}
 bool ESP32Camera::has_requested_image_() const {
   if (this->single_requester_)
     // single request
@@ -267,6 +318,7 @@ bool ESP32Camera::has_requested_image_() const {
   return false;
 }
 bool ESP32Camera::can_return_image_() const { return this->current_image_.use_count() == 1; }
+bool ESP32Camera::has_fallback_() const { return this->fallback_jpeg_quality_ != 0; }
 void ESP32Camera::set_max_update_interval(uint32_t max_update_interval) {
   this->max_update_interval_ = max_update_interval;
 }
@@ -274,6 +326,7 @@ void ESP32Camera::set_idle_update_interval(uint32_t idle_update_interval) {
   this->idle_update_interval_ = idle_update_interval;
 }
 void ESP32Camera::set_test_pattern(bool test_pattern) { this->test_pattern_ = test_pattern; }
+void ESP32Camera::set_frame_buffer_count(uint8_t count) { this->config_.fb_count = count; }
 
 ESP32Camera *global_esp32_camera;
 
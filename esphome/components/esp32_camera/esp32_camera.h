@@ -59,6 +59,12 @@ class ESP32Camera : public Component, public Nameable {
   void set_i2c_pins(uint8_t sda, uint8_t scl);
   void set_frame_size(ESP32CameraFrameSize size);
   void set_jpeg_quality(uint8_t quality);
+  /** Frame size and JPEG quality to switch to while clients fall behind.
+   *
+   * When the clients together take longer than two frame intervals to receive an image, the camera switches to
+   * these settings. It goes back to the configured ones after ten images were received within half an interval.
+   */
+  void set_fallback(ESP32CameraFrameSize size, uint8_t quality);
   void set_reset_pin(uint8_t pin);
   void set_power_down_pin(uint8_t pin);
   void set_vertical_flip(bool vertical_flip);
@@ -69,6 +75,12 @@ class ESP32Camera : public Component, public Nameable {
   void set_max_update_interval(uint32_t max_update_interval);
   void set_idle_update_interval(uint32_t idle_update_interval);
   void set_test_pattern(bool test_pattern);
+  /** Number of frame buffers, 2 needs PSRAM.
+   *
+   * With two buffers the driver captures the next frame while the clients still receive the current one, which
+   * raises the frame rate but keeps the sensor capturing even while nobody requests images.
+   */
+  void set_frame_buffer_count(uint8_t count);
   void setup() override;
   void loop() override;
   void dump_config() override;
@@ -81,6 +93,10 @@ class ESP32Camera : public Component, public Nameable {
   uint32_t hash_base() override;
   bool has_requested_image_() const;
   bool can_return_image_() const;
+  bool has_fallback_() const;
+  /// Switch between configured and fallback settings, drain_time is how long the clients needed for the last image.
+  void update_fallback_(uint32_t drain_time);
+  void apply_settings_(framesize_t frame_size, uint8_t jpeg_quality);
 
   static void framebuffer_task(void *pv);
 
@@ -98,6 +114,12 @@ class ESP32Camera : public Component, public Nameable {
   bool single_requester_{false};
   QueueHandle_t framebuffer_get_queue_;
   QueueHandle_t framebuffer_return_queue_;
+  TaskHandle_t framebuffer_task_handle_{nullptr};
+  bool capture_requested_{false};
+  framesize_t fallback_frame_size_{FRAMESIZE_QVGA};
+  uint8_t fallback_jpeg_quality_{0};
+  bool fallback_active_{false};
+  uint8_t fast_images_{0};
   CallbackManager<void(std::shared_ptr<CameraImage>)> new_image_callback_;
   uint32_t max_update_interval_{1000};
   uint32_t idle_update_interval_{15000};
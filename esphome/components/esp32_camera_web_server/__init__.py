@@ -0,0 +1,34 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import web_server_base
+from esphome.components.web_server_base import CONF_WEB_SERVER_BASE_ID
+from esphome.const import CONF_ID, ESP_PLATFORM_ESP32
+from esphome.core import coroutine_with_priority
+
+ESP_PLATFORMS = [ESP_PLATFORM_ESP32]
+DEPENDENCIES = ["esp32_camera"]
+AUTO_LOAD = ["web_server_base"]
+
+CONF_MAX_VIEWERS = "max_viewers"
+
+esp32_camera_web_server_ns = cg.esphome_ns.namespace("esp32_camera_web_server")
+CameraWebServer = esp32_camera_web_server_ns.class_("CameraWebServer", cg.Component)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(CameraWebServer),
+        cv.GenerateID(CONF_WEB_SERVER_BASE_ID): cv.use_id(
+            web_server_base.WebServerBase
+        ),
+        cv.Optional(CONF_MAX_VIEWERS, default=4): cv.int_range(min=1, max=16),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+@coroutine_with_priority(40.0)
+async def to_code(config):
+    paren = await cg.get_variable(config[CONF_WEB_SERVER_BASE_ID])
+
+    var = cg.new_Pvariable(config[CONF_ID], paren)
+    await cg.register_component(var, config)
+    cg.add(var.set_max_viewers(config[CONF_MAX_VIEWERS]))
@@ -0,0 +1,174 @@
+#include "camera_web_server.h"
+#include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+
+namespace esphome {
+namespace esp32_camera_web_server {
+
+static const char *const TAG = "esp32_camera_web_server";
+
+static const char *const STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=esphomeframe";
+static const char *const STREAM_PART_HEADER =
+    "%s--esphomeframe\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n";
+/// Upper bound for the frame data copied into the response buffer per call.
+static const size_t STREAM_CHUNK_SIZE = 4096;
+/// A viewer needing longer than this for a frame stops holding up the camera.
+static const uint32_t SLOW_VIEWER_TIMEOUT = 1000;
+/// The camera keeps streaming for five seconds after a request.
+static const uint32_t STREAM_REQUEST_INTERVAL = 1000;
+
+void CameraWebServer::setup() {
+  this->lock_ = xSemaphoreCreateMutex();
+  this->base_->init();
+  esp32_camera::global_esp32_camera->add_image_callback(
+      [this](std::shared_ptr<esp32_camera::CameraImage> image) { this->on_image_(image); });
+  this->base_->add_handler(this);
+}
+
+void CameraWebServer::loop() {
+  bool streaming = false;
+  bool snapshot = false;
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  for (auto it = this->viewers_.begin(); it != this->viewers_.end();) {
+    auto viewer = it->lock();
+    if (!viewer) {
+      it = this->viewers_.erase(it);
+      continue;
+    }
+    if (!viewer->snapshot)
+      streaming = true;
+    else if (viewer->waiting)
+      snapshot = true;
+    it++;
+  }
+  xSemaphoreGive(this->lock_);
+
+  const uint32_t now = millis();
+  if (streaming && now - this->last_stream_request_ > STREAM_REQUEST_INTERVAL) {
+    esp32_camera::global_esp32_camera->request_stream();
+    this->last_stream_request_ = now;
+  } else if (!streaming && snapshot) {
+    esp32_camera::global_esp32_camera->request_image();
+  }
+}
+
+void CameraWebServer::dump_config() {
+  ESP_LOGCONFIG(TAG, "ESP32 Camera Web Server:");
+  ESP_LOGCONFIG(TAG, "  Port: %u", this->base_->get_port());
+  ESP_LOGCONFIG(TAG, "  Max Viewers: %u", this->max_viewers_);
+}
+
+bool CameraWebServer::canHandle(AsyncWebServerRequest *request) {
+  if (request->method() != HTTP_GET)
+    return false;
+  return request->url() == "/stream" || request->url() == "/snapshot";
+}
+
+void CameraWebServer::handleRequest(AsyncWebServerRequest *request) {
+  auto viewer = std::make_shared<CameraViewer>();
+  viewer->snapshot = request->url() == "/snapshot";
+
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  size_t active = 0;
+  for (auto &other : this->viewers_) {
+    if (!other.expired())
+      active++;
+  }
+  if (active >= this->max_viewers_) {
+    xSemaphoreGive(this->lock_);
+    request->send(503, "text/plain", "Too many viewers");
+    return;
+  }
+  this->viewers_.push_back(viewer);
+  xSemaphoreGive(this->lock_);
+
+  ESP_LOGD(TAG, "New %s viewer", viewer->snapshot ? "snapshot" : "stream");
+  AsyncWebServerResponse *response = request->beginChunkedResponse(
+      viewer->snapshot ? "image/jpeg" : STREAM_CONTENT_TYPE,
+      [this, viewer](uint8_t *buffer, size_t max_len, size_t index) -> size_t {
+        return this->fill_(viewer.get(), buffer, max_len);
+      });
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+}
+
+void CameraWebServer::on_image_(const std::shared_ptr<esp32_camera::CameraImage> &image) {
+  const uint32_t now = millis();
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  for (auto &weak : this->viewers_) {
+    auto viewer = weak.lock();
+    if (!viewer || !viewer->waiting || viewer->done)
+      continue;
+    viewer->image = image;
+    viewer->offset = 0;
+    viewer->frame_start = now;
+    viewer->waiting = false;
+    viewer->header_offset = 0;
+    if (viewer->snapshot) {
+      viewer->header_length = 0;
+    } else {
+      int len = snprintf(viewer->header, sizeof(viewer->header), STREAM_PART_HEADER, viewer->first_frame ? "" : "\r\n",
+                         static_cast<unsigned>(image->get_data_length()));
+      viewer->header_length = len > 0 ? std::min<size_t>(len, sizeof(viewer->header) - 1) : 0;
+    }
+    viewer->first_frame = false;
+  }
+  xSemaphoreGive(this->lock_);
+}
+
+size_t CameraWebServer::fill_(CameraViewer *viewer, uint8_t *buffer, size_t max_len) {
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  size_t ret = this->fill_locked_(viewer, buffer, max_len);
+  xSemaphoreGive(this->lock_);
+  return ret;
+}
+
+size_t CameraWebServer::fill_locked_(CameraViewer *viewer, uint8_t *buffer, size_t max_len) {
+  if (viewer->done)
+    return 0;
+  if (viewer->waiting)
+    return RESPONSE_TRY_AGAIN;
+
+  size_t written = 0;
+  if (viewer->header_offset < viewer->header_length) {
+    size_t len = std::min(max_len, viewer->header_length - viewer->header_offset);
+    memcpy(buffer, viewer->header + viewer->header_offset, len);
+    viewer->header_offset += len;
+    written += len;
+  }
+  if (written == max_len)
+    return written;
+
+  if (viewer->image && millis() - viewer->frame_start > SLOW_VIEWER_TIMEOUT) {
+    // Let the camera capture again, this viewer will pick up a later frame when it is done
+    const uint8_t *rest = viewer->image->get_data_buffer() + viewer->offset;
+    viewer->copy.assign(rest, rest + viewer->image->get_data_length() - viewer->offset);
+    viewer->image.reset();
+    viewer->offset = 0;
+  }
+
+  const uint8_t *data = viewer->image ? viewer->image->get_data_buffer() : viewer->copy.data();
+  const size_t length = viewer->image ? viewer->image->get_data_length() : viewer->copy.size();
+  size_t len = std::min(std::min(max_len - written, length - viewer->offset), STREAM_CHUNK_SIZE);
+  memcpy(buffer + written, data + viewer->offset, len);
+  viewer->offset += len;
+  written += len;
+
+  if (viewer->offset == length) {
+    viewer->image.reset();
+    std::vector<uint8_t>().swap(viewer->copy);
+    if (viewer->snapshot)
+      viewer->done = true;
+    else
+      viewer->waiting = true;
+  }
+  return written;
+}
+
+}  // namespace esp32_camera_web_server
+}  // namespace esphome
+
+#endif
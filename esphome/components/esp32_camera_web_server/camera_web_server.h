@@ -0,0 +1,73 @@
+#pragma once
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#include "esphome/core/component.h"
+#include "esphome/components/esp32_camera/esp32_camera.h"
+#include "esphome/components/web_server_base/web_server_base.h"
+
+#include <memory>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace esphome {
+namespace esp32_camera_web_server {
+
+/// One HTTP client of /stream or /snapshot, owned by the chunked response serving it.
+struct CameraViewer {
+  /// The frame being sent, shared by reference count with the other viewers and the native API.
+  std::shared_ptr<esp32_camera::CameraImage> image;
+  /// What is left of the frame, copied out when the viewer held on to the shared one for too long.
+  std::vector<uint8_t> copy;
+  char header[96];
+  size_t header_length{0};
+  size_t header_offset{0};
+  /// Position in the frame data (image or copy).
+  size_t offset{0};
+  uint32_t frame_start{0};
+  /// Ready for the next frame, frames arriving while a viewer is still busy are skipped for it.
+  bool waiting{true};
+  bool first_frame{true};
+  bool snapshot{false};
+  bool done{false};
+};
+
+/** Serves the camera as MJPEG stream under /stream and single JPEG images under /snapshot.
+ *
+ * All viewers share the frame the camera hands to its image callbacks, and every viewer starts each part with the
+ * newest frame, so a slow viewer skips frames. The camera only captures once every holder released the frame, so a
+ * viewer still sending after SLOW_VIEWER_TIMEOUT copies the rest of the frame and lets go of the shared one.
+ */
+class CameraWebServer : public Component, public AsyncWebHandler {
+ public:
+  CameraWebServer(web_server_base::WebServerBase *base) : base_(base) {}
+  void set_max_viewers(uint8_t max_viewers) { this->max_viewers_ = max_viewers; }
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::WIFI - 1.0f; }
+
+  bool canHandle(AsyncWebServerRequest *request) override;
+  void handleRequest(AsyncWebServerRequest *request) override;
+
+ protected:
+  /// Hand a new frame to every waiting viewer, runs in the main loop.
+  void on_image_(const std::shared_ptr<esp32_camera::CameraImage> &image);
+  /// Fill the response buffer of a viewer, runs in the web server task.
+  size_t fill_(CameraViewer *viewer, uint8_t *buffer, size_t max_len);
+  size_t fill_locked_(CameraViewer *viewer, uint8_t *buffer, size_t max_len);
+
+  web_server_base::WebServerBase *base_;
+  uint8_t max_viewers_{4};
+  SemaphoreHandle_t lock_;
+  /// Guarded by lock_, the responses own the viewers.
+  std::vector<std::weak_ptr<CameraViewer>> viewers_;
+  uint32_t last_stream_request_{0};
+};
+
+}  // namespace esp32_camera_web_server
+}  // namespace esphome
+
+#endif
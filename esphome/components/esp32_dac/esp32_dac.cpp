@@ -5,30 +5,196 @@
 #ifdef ARDUINO_ARCH_ESP32
 
 #include <esp32-hal-dac.h>
+#include <driver/i2s.h>
+#include <soc/rtc.h>
+#include <soc/rtc_cntl_reg.h>
+#include <soc/rtc_io_reg.h>
+#include <soc/sens_reg.h>
+#include <algorithm>
+#include <cmath>
 
 namespace esphome {
 namespace esp32_dac {
 
 static const char *const TAG = "esp32_dac";
 
+// Ring of DMA buffers for play_samples(), in frames of two 16 bit channels
+static const int DMA_BUFFER_COUNT = 8;
+static const int DMA_BUFFER_LENGTH = 256;
+
 void ESP32DAC::setup() {
   ESP_LOGCONFIG(TAG, "Setting up ESP32 DAC Output...");
   this->pin_->setup();
   this->turn_off();
+  // loop() only feeds the DMA while samples play
+  this->disable_loop();
 }
 
 void ESP32DAC::dump_config() {
   ESP_LOGCONFIG(TAG, "ESP32 DAC:");
   LOG_PIN("  Pin: ", this->pin_);
+  if (this->sample_rate_ != 0)
+    ESP_LOGCONFIG(TAG, "  Sample Rate: %u Hz", this->sample_rate_);
   LOG_FLOAT_OUTPUT(this);
 }
 
+void ESP32DAC::loop() {
+  if (this->mode_ != ESP32_DAC_MODE_SAMPLES) {
+    this->disable_loop();
+    return;
+  }
+  this->fill_dma_();
+  // Stop once the ring played the last samples, the DMA would repeat its buffers otherwise
+  const uint32_t ring_duration = uint32_t(DMA_BUFFER_COUNT * DMA_BUFFER_LENGTH) * 1000 / this->sample_rate_ + 1;
+  if (this->draining_ && millis() - this->drain_start_ > ring_duration)
+    this->stop();
+}
+
 void ESP32DAC::write_state(float state) {
   if (this->pin_->is_inverted())
     state = 1.0f - state;
 
-  state = state * 255;
-  dacWrite(this->pin_->get_pin(), state);
+  this->level_ = state * 255;
+  // A tone or samples keep playing, the output returns to the new level when they stop
+  if (this->mode_ == ESP32_DAC_MODE_LEVEL)
+    this->write_level_();
+}
+
+void ESP32DAC::write_level_() {
+  // Also stops the cosine generator
+  dacWrite(this->pin_->get_pin(), this->level_);
+}
+
+void ESP32DAC::play_tone(float frequency, uint8_t scale) {
+  if (this->mode_ == ESP32_DAC_MODE_SAMPLES) {
+    this->stop_i2s_();
+    this->draining_ = false;
+  }
+
+  // The generator adds the step to a 16 bit phase on every cycle of the 8 MHz RTC clock
+  const uint32_t clk_8m_div = REG_GET_FIELD(RTC_CNTL_CLK_CONF_REG, RTC_CNTL_CK8M_DIV_SEL);
+  const float step_frequency = RTC_FAST_CLK_FREQ_APPROX / (1 + clk_8m_div) / 65536.0f;
+  const auto step = uint32_t(std::max(1L, std::min(0xFFFFL, lroundf(frequency / step_frequency))));
+  scale &= 0x03;
+
+  SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL1_REG, SENS_SW_FSTEP, step, SENS_SW_FSTEP_S);
+  SET_PERI_REG_MASK(SENS_SAR_DAC_CTRL1_REG, SENS_SW_TONE_EN);
+  // Inverting the MSB centers the cosine around mid scale
+  if (this->pin_->get_pin() == 26) {
+    SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_SCALE2, scale, SENS_DAC_SCALE2_S);
+    SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_INV2, 2, SENS_DAC_INV2_S);
+    SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_DC2, 0, SENS_DAC_DC2_S);
+    SET_PERI_REG_MASK(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_CW_EN2_M);
+    SET_PERI_REG_MASK(RTC_IO_PAD_DAC2_REG, RTC_IO_PDAC2_XPD_DAC | RTC_IO_PDAC2_DAC_XPD_FORCE);
+  } else {
+    SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_SCALE1, scale, SENS_DAC_SCALE1_S);
+    SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_INV1, 2, SENS_DAC_INV1_S);
+    SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_DC1, 0, SENS_DAC_DC1_S);
+    SET_PERI_REG_MASK(SENS_SAR_DAC_CTRL2_REG, SENS_DAC_CW_EN1_M);
+    SET_PERI_REG_MASK(RTC_IO_PAD_DAC1_REG, RTC_IO_PDAC1_XPD_DAC | RTC_IO_PDAC1_DAC_XPD_FORCE);
+  }
+  this->mode_ = ESP32_DAC_MODE_TONE;
+  ESP_LOGD(TAG, "Playing a tone of %.0f Hz", step * step_frequency);
+}
+
+void ESP32DAC::play_samples(const uint8_t *samples, size_t length, bool repeat) {
+  if (this->sample_rate_ == 0) {
+    ESP_LOGW(TAG, "Playing samples needs a sample_rate");
+    return;
+  }
+  if (length == 0) {
+    this->stop();
+    return;
+  }
+  if (!this->i2s_installed_ && !this->start_i2s_())
+    return;
+
+  this->samples_ = samples;
+  this->samples_length_ = length;
+  this->samples_position_ = 0;
+  this->samples_repeat_ = repeat;
+  this->draining_ = false;
+  this->mode_ = ESP32_DAC_MODE_SAMPLES;
+  this->fill_dma_();
+  this->enable_loop();
+}
+
+void ESP32DAC::stop() {
+  if (this->mode_ == ESP32_DAC_MODE_LEVEL)
+    return;
+  this->stop_i2s_();
+  this->mode_ = ESP32_DAC_MODE_LEVEL;
+  this->samples_ = nullptr;
+  this->draining_ = false;
+  this->write_level_();
+}
+
+bool ESP32DAC::start_i2s_() {
+  i2s_config_t config{};
+  config.mode = static_cast<i2s_mode_t>(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_DAC_BUILT_IN);
+  config.sample_rate = this->sample_rate_;
+  config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  // Both channels get the same samples, only the one of this DAC is enabled
+  config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+  config.communication_format = I2S_COMM_FORMAT_I2S_MSB;
+  config.dma_buf_count = DMA_BUFFER_COUNT;
+  config.dma_buf_len = DMA_BUFFER_LENGTH;
+  esp_err_t err = i2s_driver_install(I2S_NUM_0, &config, 0, nullptr);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Installing the I2S driver failed: %d", err);
+    return false;
+  }
+  const bool dac2 = this->pin_->get_pin() == 26;
+  // The cosine generator would be added to the samples
+  CLEAR_PERI_REG_MASK(SENS_SAR_DAC_CTRL2_REG, dac2 ? SENS_DAC_CW_EN2_M : SENS_DAC_CW_EN1_M);
+  i2s_set_dac_mode(dac2 ? I2S_DAC_CHANNEL_LEFT_EN : I2S_DAC_CHANNEL_RIGHT_EN);
+  this->i2s_installed_ = true;
+  return true;
+}
+
+void ESP32DAC::stop_i2s_() {
+  if (!this->i2s_installed_)
+    return;
+  i2s_set_dac_mode(I2S_DAC_CHANNEL_DISABLE);
+  i2s_driver_uninstall(I2S_NUM_0);
+  this->i2s_installed_ = false;
+}
+
+void ESP32DAC::fill_dma_() {
+  // Frames of two 16 bit channels, the DAC outputs the upper 8 bits
+  uint16_t buffer[2 * 64];
+  const size_t max_frames = sizeof(buffer) / sizeof(buffer[0]) / 2;
+  while (true) {
+    size_t frames;
+    if (this->samples_position_ < this->samples_length_) {
+      frames = std::min(max_frames, this->samples_length_ - this->samples_position_);
+      const uint8_t *samples = this->samples_ + this->samples_position_;
+      for (size_t i = 0; i < frames; i++)
+        buffer[2 * i] = buffer[2 * i + 1] = uint16_t(samples[i]) << 8;
+    } else {
+      // All samples are queued, keep the buffers of the ring at the level until they played
+      frames = max_frames;
+      std::fill(buffer, buffer + 2 * frames, uint16_t(this->level_) << 8);
+    }
+
+    size_t bytes_written = 0;
+    i2s_write(I2S_NUM_0, buffer, frames * 2 * sizeof(uint16_t), &bytes_written, 0);
+    const size_t written = bytes_written / (2 * sizeof(uint16_t));
+    if (this->samples_position_ < this->samples_length_) {
+      this->samples_position_ += written;
+      if (this->samples_position_ == this->samples_length_) {
+        if (this->samples_repeat_) {
+          this->samples_position_ = 0;
+        } else {
+          this->draining_ = true;
+          this->drain_start_ = millis();
+        }
+      }
+    }
+    // The ring is full
+    if (written < frames)
+      return;
+  }
 }
 
 }  // namespace esp32_dac
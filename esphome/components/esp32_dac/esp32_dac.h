@@ -10,20 +10,105 @@
 namespace esphome {
 namespace esp32_dac {
 
+enum ESP32DACMode {
+  /// The level set with set_level(), from write_state()
+  ESP32_DAC_MODE_LEVEL = 0,
+  /// The cosine generator of the DAC, see play_tone()
+  ESP32_DAC_MODE_TONE,
+  /// Samples output by I2S0 through DMA, see play_samples()
+  ESP32_DAC_MODE_SAMPLES,
+};
+
 class ESP32DAC : public output::FloatOutput, public Component {
  public:
   void set_pin(GPIOPin *pin) { pin_ = pin; }
+  /// Enable play_samples(), the samples are output at this rate in Hz.
+  void set_sample_rate(uint32_t sample_rate) { this->sample_rate_ = sample_rate; }
 
   /// Initialize pin
   void setup() override;
+  void loop() override;
   void dump_config() override;
   /// HARDWARE setup_priority
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
+  /** Output a cosine with the generator of the DAC, no CPU time is needed while it plays.
+   *
+   * The frequency has steps of about 130 Hz, from 130 Hz to 55 kHz. The amplitude is full scale divided by
+   * 2^scale (0-3). The generator is shared by both DACs, a tone on the other DAC has the same frequency,
+   * writing a level to the other DAC stops it.
+   */
+  void play_tone(float frequency, uint8_t scale = 0);
+  /** Output 8 bit samples at the sample rate, with the DAC driven by I2S0 through DMA.
+   *
+   * loop() copies the samples into the ring of DMA buffers, which holds 128 ms at 16 kHz, so the output
+   * doesn't depend on the timing of the main loop. The samples must stay valid until the output stops.
+   * With repeat, they are played until stop(), like a wavetable.
+   */
+  void play_samples(const uint8_t *samples, size_t length, bool repeat = false);
+  /// Stop a tone or samples and go back to the level of the output.
+  void stop();
+
+  ESP32DACMode get_mode() const { return this->mode_; }
+
  protected:
   void write_state(float state) override;
+  void write_level_();
+  bool start_i2s_();
+  void stop_i2s_();
+  /// Copy the next samples into the free DMA buffers, the level once all were queued.
+  void fill_dma_();
 
   GPIOPin *pin_;
+  uint32_t sample_rate_{0};
+  ESP32DACMode mode_{ESP32_DAC_MODE_LEVEL};
+  /// The last state written to the output, from 0 to 255.
+  uint8_t level_{0};
+  bool i2s_installed_{false};
+  const uint8_t *samples_{nullptr};
+  size_t samples_length_{0};
+  size_t samples_position_{0};
+  bool samples_repeat_{false};
+  /// All samples were queued at drain_start_, they have played once the ring of DMA buffers went around.
+  bool draining_{false};
+  uint32_t drain_start_{0};
+};
+
+template<typename... Ts> class PlayToneAction : public Action<Ts...> {
+ public:
+  PlayToneAction(ESP32DAC *parent) : parent_(parent) {}
+  TEMPLATABLE_VALUE(float, frequency);
+  void set_scale(uint8_t scale) { this->scale_ = scale; }
+
+  void play(const Ts &... x) override { this->parent_->play_tone(this->frequency_.value(x...), this->scale_); }
+
+ protected:
+  ESP32DAC *parent_;
+  uint8_t scale_{0};
+};
+
+template<typename... Ts> class PlaySamplesAction : public Action<Ts...> {
+ public:
+  PlaySamplesAction(ESP32DAC *parent, const uint8_t *samples, size_t length, bool repeat)
+      : parent_(parent), samples_(samples), length_(length), repeat_(repeat) {}
+
+  void play(const Ts &... x) override { this->parent_->play_samples(this->samples_, this->length_, this->repeat_); }
+
+ protected:
+  ESP32DAC *parent_;
+  const uint8_t *samples_;
+  size_t length_;
+  bool repeat_;
+};
+
+template<typename... Ts> class StopAction : public Action<Ts...> {
+ public:
+  StopAction(ESP32DAC *parent) : parent_(parent) {}
+
+  void play(const Ts &... x) override { this->parent_->stop(); }
+
+ protected:
+  ESP32DAC *parent_;
 };
 
 }  // namespace esp32_dac
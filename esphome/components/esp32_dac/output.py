@@ -1,11 +1,23 @@
-from esphome import pins
+from esphome import automation, pins
 from esphome.components import output
 import esphome.config_validation as cv
 import esphome.codegen as cg
-from esphome.const import CONF_ID, CONF_NUMBER, CONF_PIN, ESP_PLATFORM_ESP32
+from esphome.const import (
+    CONF_FREQUENCY,
+    CONF_ID,
+    CONF_NUMBER,
+    CONF_PIN,
+    CONF_RAW_DATA_ID,
+    CONF_REPEAT,
+    ESP_PLATFORM_ESP32,
+)
 
 ESP_PLATFORMS = [ESP_PLATFORM_ESP32]
 
+CONF_AMPLITUDE = "amplitude"
+CONF_SAMPLE_RATE = "sample_rate"
+CONF_SAMPLES = "samples"
+
 
 def valid_dac_pin(value):
     num = value[CONF_NUMBER]
@@ -13,8 +25,20 @@ def valid_dac_pin(value):
     return value
 
 
+def validate_tone_amplitude(value):
+    value = cv.percentage(value)
+    # The cosine generator divides the full scale amplitude by a power of two
+    for scale, amplitude in enumerate([1.0, 0.5, 0.25, 0.125]):
+        if abs(value - amplitude) < 1e-6:
+            return scale
+    raise cv.Invalid("The amplitude of a tone must be 100%, 50%, 25% or 12.5%")
+
+
 esp32_dac_ns = cg.esphome_ns.namespace("esp32_dac")
 ESP32DAC = esp32_dac_ns.class_("ESP32DAC", output.FloatOutput, cg.Component)
+PlayToneAction = esp32_dac_ns.class_("PlayToneAction", automation.Action)
+PlaySamplesAction = esp32_dac_ns.class_("PlaySamplesAction", automation.Action)
+StopAction = esp32_dac_ns.class_("StopAction", automation.Action)
 
 CONFIG_SCHEMA = output.FLOAT_OUTPUT_SCHEMA.extend(
     {
@@ -22,6 +46,9 @@ CONFIG_SCHEMA = output.FLOAT_OUTPUT_SCHEMA.extend(
         cv.Required(CONF_PIN): cv.All(
             pins.internal_gpio_output_pin_schema, valid_dac_pin
         ),
+        cv.Optional(CONF_SAMPLE_RATE): cv.All(
+            cv.frequency, cv.Range(min=5000, max=100000)
+        ),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -33,3 +60,60 @@ async def to_code(config):
 
     pin = await cg.gpio_pin_expression(config[CONF_PIN])
     cg.add(var.set_pin(pin))
+    if CONF_SAMPLE_RATE in config:
+        cg.add(var.set_sample_rate(int(config[CONF_SAMPLE_RATE])))
+
+
+@automation.register_action(
+    "output.esp32_dac.play_tone",
+    PlayToneAction,
+    cv.Schema(
+        {
+            cv.Required(CONF_ID): cv.use_id(ESP32DAC),
+            cv.Required(CONF_FREQUENCY): cv.templatable(
+                cv.All(cv.frequency, cv.Range(min=130, max=55000))
+            ),
+            cv.Optional(CONF_AMPLITUDE, default="100%"): validate_tone_amplitude,
+        }
+    ),
+)
+async def esp32_dac_play_tone_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_arg, paren)
+    template_ = await cg.templatable(config[CONF_FREQUENCY], args, float)
+    cg.add(var.set_frequency(template_))
+    cg.add(var.set_scale(config[CONF_AMPLITUDE]))
+    return var
+
+
+@automation.register_action(
+    "output.esp32_dac.play_samples",
+    PlaySamplesAction,
+    cv.Schema(
+        {
+            cv.Required(CONF_ID): cv.use_id(ESP32DAC),
+            cv.Required(CONF_SAMPLES): cv.All(
+                [cv.int_range(min=0, max=255)], cv.Length(min=1)
+            ),
+            cv.Optional(CONF_REPEAT, default=False): cv.boolean,
+            cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+        }
+    ),
+)
+async def esp32_dac_play_samples_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    samples = config[CONF_SAMPLES]
+    arr = cg.progmem_array(config[CONF_RAW_DATA_ID], samples)
+    return cg.new_Pvariable(
+        action_id, template_arg, paren, arr, len(samples), config[CONF_REPEAT]
+    )
+
+
+@automation.register_action(
+    "output.esp32_dac.stop",
+    StopAction,
+    automation.maybe_simple_id({cv.Required(CONF_ID): cv.use_id(ESP32DAC)}),
+)
+async def esp32_dac_stop_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, paren)
@@ -5,6 +5,7 @@ from esphome.const import (
     CONF_NAME,
     CONF_PIN,
     CONF_THRESHOLD,
+    CONF_WAKEUP_THRESHOLD,
     ESP_PLATFORM_ESP32,
     CONF_ID,
 )
@@ -47,6 +48,7 @@ CONFIG_SCHEMA = binary_sensor.BINARY_SENSOR_SCHEMA.extend(
         cv.GenerateID(CONF_ESP32_TOUCH_ID): cv.use_id(ESP32TouchComponent),
         cv.Required(CONF_PIN): validate_touch_pad,
         cv.Required(CONF_THRESHOLD): cv.uint16_t,
+        cv.Optional(CONF_WAKEUP_THRESHOLD, default=0): cv.uint16_t,
     }
 )
 
@@ -60,4 +62,5 @@ async def to_code(config):
         config[CONF_THRESHOLD],
     )
     await binary_sensor.register_binary_sensor(var, config)
+    cg.add(var.set_wakeup_threshold(config[CONF_WAKEUP_THRESHOLD]))
     cg.add(hub.register_touch_pad(var))
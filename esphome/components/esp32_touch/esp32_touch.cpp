@@ -3,6 +3,8 @@
 
 #ifdef ARDUINO_ARCH_ESP32
 
+#include <esp_sleep.h>
+
 namespace esphome {
 namespace esp32_touch {
 
@@ -19,12 +21,34 @@ void ESP32TouchComponent::setup() {
   touch_pad_set_meas_time(this->sleep_cycle_, this->meas_cycle_);
   touch_pad_set_voltage(this->high_voltage_reference_, this->low_voltage_reference_, this->voltage_attenuation_);
 
+  // Interrupt while a pad is below its threshold, the same condition loop() reports as touched
+  touch_pad_set_trigger_mode(TOUCH_TRIGGER_BELOW);
   for (auto *child : this->children_) {
-    // Disable interrupt threshold
-    touch_pad_config(child->get_touch_pad(), 0);
+    touch_pad_config(child->get_touch_pad(), child->get_threshold());
+  }
+  touch_pad_isr_register(ESP32TouchComponent::touch_isr, this);
+  touch_pad_intr_enable();
+
+  if (this->is_wakeup_source_()) {
+    // Wakes from light sleep at the normal thresholds, on_shutdown() sets the wakeup thresholds for deep sleep
+    esp_sleep_enable_touchpad_wakeup();
   }
 }
 
+void ICACHE_RAM_ATTR ESP32TouchComponent::touch_isr(void *arg) {
+  auto *component = static_cast<ESP32TouchComponent *>(arg);
+  touch_pad_clear_status();
+  component->enable_loop_soon_any_context();
+}
+
+bool ESP32TouchComponent::is_wakeup_source_() const {
+  for (auto *child : this->children_) {
+    if (child->get_wakeup_threshold() != 0)
+      return true;
+  }
+  return false;
+}
+
 void ESP32TouchComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Config for ESP32 Touch Hub:");
   ESP_LOGCONFIG(TAG, "  Meas cycle: %.2fms", this->meas_cycle_ / (8000000.0f / 1000.0f));
@@ -104,12 +128,16 @@ void ESP32TouchComponent::dump_config() {
     LOG_BINARY_SENSOR("  ", "Touch Pad", child);
     ESP_LOGCONFIG(TAG, "    Pad: T%d", child->get_touch_pad());
     ESP_LOGCONFIG(TAG, "    Threshold: %u", child->get_threshold());
+    if (child->get_wakeup_threshold() != 0) {
+      ESP_LOGCONFIG(TAG, "    Wakeup Threshold: %u", child->get_wakeup_threshold());
+    }
   }
 }
 
 void ESP32TouchComponent::loop() {
   const uint32_t now = millis();
   bool should_print = this->setup_mode_ && now - this->setup_mode_last_log_print_ > 250;
+  bool any_touched = false;
   for (auto *child : this->children_) {
     uint16_t value;
     if (this->iir_filter_enabled_()) {
@@ -119,7 +147,9 @@ void ESP32TouchComponent::loop() {
     }
 
     child->value_ = value;
-    child->publish_state(value < child->get_threshold());
+    const bool touched = value < child->get_threshold();
+    child->publish_state(touched);
+    any_touched |= touched;
 
     if (should_print) {
       ESP_LOGD(TAG, "Touch Pad '%s' (T%u): %u", child->get_name().c_str(), child->get_touch_pad(), value);
@@ -130,14 +160,31 @@ void ESP32TouchComponent::loop() {
     // Avoid spamming logs
     this->setup_mode_last_log_print_ = now;
   }
+
+  // The interrupt keeps firing while a pad is touched, with the IIR filter maybe before the filtered value is
+  // below the threshold. Nothing to do until then, except logging the values in setup mode.
+  if (!any_touched && !this->setup_mode_)
+    this->disable_loop();
 }
 
 void ESP32TouchComponent::on_shutdown() {
+  touch_pad_intr_disable();
+  touch_pad_isr_deregister(ESP32TouchComponent::touch_isr, this);
   if (this->iir_filter_enabled_()) {
     touch_pad_filter_stop();
     touch_pad_filter_delete();
   }
-  touch_pad_deinit();
+
+  if (!this->is_wakeup_source_()) {
+    touch_pad_deinit();
+    return;
+  }
+  // Keep measuring in deep sleep, only the pads with a wakeup threshold can wake the chip
+  touch_pad_set_fsm_mode(TOUCH_FSM_MODE_TIMER);
+  for (auto *child : this->children_) {
+    touch_pad_config(child->get_touch_pad(), child->get_wakeup_threshold());
+  }
+  esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_ON);
 }
 
 ESP32TouchBinarySensor::ESP32TouchBinarySensor(const std::string &name, touch_pad_t touch_pad, uint16_t threshold)
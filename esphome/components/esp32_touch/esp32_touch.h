@@ -10,6 +10,11 @@ namespace esp32_touch {
 
 class ESP32TouchBinarySensor;
 
+/** Hub for the touch pads of the ESP32.
+ *
+ * The touch peripheral measures the pads on its own and raises an interrupt while a pad is below its threshold.
+ * loop() only runs after such an interrupt and until all pads are released again, except in setup mode.
+ */
 class ESP32TouchComponent : public Component {
  public:
   void register_touch_pad(ESP32TouchBinarySensor *pad) { children_.push_back(pad); }
@@ -42,6 +47,10 @@ class ESP32TouchComponent : public Component {
  protected:
   /// Is the IIR filter enabled?
   bool iir_filter_enabled_() const { return iir_filter_ > 0; }
+  /// Does any pad wake the chip from sleep?
+  bool is_wakeup_source_() const;
+
+  static void touch_isr(void *arg);
 
   uint16_t sleep_cycle_{};
   uint16_t meas_cycle_{65535};
@@ -63,6 +72,9 @@ class ESP32TouchBinarySensor : public binary_sensor::BinarySensor {
   uint16_t get_threshold() const { return threshold_; }
   void set_threshold(uint16_t threshold) { threshold_ = threshold; }
   uint16_t get_value() const { return value_; }
+  /// The threshold for waking the chip from deep sleep, 0 if this pad doesn't wake it.
+  uint16_t get_wakeup_threshold() const { return wakeup_threshold_; }
+  void set_wakeup_threshold(uint16_t wakeup_threshold) { wakeup_threshold_ = wakeup_threshold; }
 
  protected:
   friend ESP32TouchComponent;
@@ -70,6 +82,7 @@ class ESP32TouchBinarySensor : public binary_sensor::BinarySensor {
   touch_pad_t touch_pad_;
   uint16_t threshold_;
   uint16_t value_;
+  uint16_t wakeup_threshold_{0};
 };
 
 }  // namespace esp32_touch
@@ -16,6 +16,8 @@ ExposureNotificationTrigger = exposure_notifications_ns.class_(
 )
 
 CONF_ON_EXPOSURE_NOTIFICATION = "on_exposure_notification"
+# The service UUID of Google/Apple exposure notification beacons
+EXPOSURE_NOTIFICATION_UUID = "FD6F"
 
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -36,4 +38,10 @@ async def to_code(config):
     for conf in config.get(CONF_ON_EXPOSURE_NOTIFICATION, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
         await automation.build_automation(trigger, [(ExposureNotification, "x")], conf)
-        await esp32_ble_tracker.register_ble_device(trigger, conf)
+        paren = await cg.get_variable(conf[esp32_ble_tracker.CONF_ESP32_BLE_ID])
+        cg.add(paren.register_listener(trigger))
+        cg.add(
+            paren.add_service_uuid_interest(
+                esp32_ble_tracker.bt_uuid_expression(EXPOSURE_NOTIFICATION_UUID)
+            )
+        )
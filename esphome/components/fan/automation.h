@@ -14,7 +14,7 @@ template<typename... Ts> class TurnOnAction : public Action<Ts...> {
   TEMPLATABLE_VALUE(bool, oscillating)
   TEMPLATABLE_VALUE(int, speed)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto call = this->state_->turn_on();
     if (this->oscillating_.has_value()) {
       call.set_oscillating(this->oscillating_.value(x...));
@@ -32,7 +32,7 @@ template<typename... Ts> class TurnOffAction : public Action<Ts...> {
  public:
   explicit TurnOffAction(FanState *state) : state_(state) {}
 
-  void play(Ts... x) override { this->state_->turn_off().perform(); }
+  void play(const Ts &... x) override { this->state_->turn_off().perform(); }
 
   FanState *state_;
 };
@@ -41,7 +41,7 @@ template<typename... Ts> class ToggleAction : public Action<Ts...> {
  public:
   explicit ToggleAction(FanState *state) : state_(state) {}
 
-  void play(Ts... x) override { this->state_->toggle().perform(); }
+  void play(const Ts &... x) override { this->state_->toggle().perform(); }
 
   FanState *state_;
 };
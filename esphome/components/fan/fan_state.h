@@ -72,7 +72,9 @@ class FanState : public Nameable, public Component {
   explicit FanState(const std::string &name);
 
   /// Register a callback that will be called each time the state changes.
-  void add_on_state_callback(std::function<void()> &&callback);
+  template<typename F> void add_on_state_callback(F &&callback) {
+    this->state_callback_.add(std::forward<F>(callback));
+  }
 
   /// Get the traits of this fan (i.e. what features it supports).
   const FanTraits &get_traits() const;
@@ -227,6 +227,10 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  bool get_raw_pixels_(light::ESPRawPixels *pixels) const override {
+    *pixels = {&this->leds_[0].r, 3, {0, 1, 2, 3}};
+    return true;
+  }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
@@ -10,7 +10,7 @@ from esphome.core import CORE, HexInt
 DEPENDENCIES = ["display"]
 MULTI_CONF = True
 
-Font = display.display_ns.class_("Font")
+Font = display.Font
 Glyph = display.display_ns.class_("Glyph")
 GlyphData = display.display_ns.struct("GlyphData")
 
@@ -242,6 +242,10 @@ uint8_t FujitsuGeneralClimate::checksum_state_(uint8_t const *message) {
 
 uint8_t FujitsuGeneralClimate::checksum_util_(uint8_t const *message) { return 255 - message[5]; }
 
+remote_base::RemoteSignature FujitsuGeneralClimate::get_signature() {
+  return {FUJITSU_GENERAL_HEADER_MARK, FUJITSU_GENERAL_HEADER_SPACE};
+}
+
 bool FujitsuGeneralClimate::on_receive(remote_base::RemoteReceiveData data) {
   ESP_LOGV(TAG, "Received IR message");
 
@@ -64,6 +64,7 @@ class FujitsuGeneralClimate : public climate_ir::ClimateIR {
 
   /// Parse incomming message
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  remote_base::RemoteSignature get_signature() override;
 
   /// Transmit message as IR pulses
   void transmit_(uint8_t const *message, uint8_t length);
@@ -16,6 +16,8 @@ globals_ns = cg.esphome_ns.namespace("globals")
 GlobalsComponent = globals_ns.class_("GlobalsComponent", cg.Component)
 GlobalVarSetAction = globals_ns.class_("GlobalVarSetAction", automation.Action)
 
+CONF_SAVE_INTERVAL = "save_interval"
+
 MULTI_CONF = True
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -23,6 +25,9 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Required(CONF_TYPE): cv.string_strict,
         cv.Optional(CONF_INITIAL_VALUE): cv.string_strict,
         cv.Optional(CONF_RESTORE_VALUE, default=False): cv.boolean,
+        cv.Optional(
+            CONF_SAVE_INTERVAL, default="0s"
+        ): cv.positive_time_period_milliseconds,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -48,6 +53,7 @@ async def to_code(config):
             value = value.encode()
         hash_ = int(hashlib.md5(value).hexdigest()[:8], 16)
         cg.add(glob.set_restore_value(hash_))
+        cg.add(glob.set_save_interval(config[CONF_SAVE_INTERVAL]))
 
 
 @automation.register_action(
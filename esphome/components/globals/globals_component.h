@@ -29,25 +29,43 @@ template<typename T> class GlobalsComponent : public Component {
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
   void loop() override {
-    if (this->restore_value_) {
-      int diff = memcmp(&this->value_, &this->prev_value_, sizeof(T));
-      if (diff != 0) {
-        this->rtc_.save(&this->value_);
-        memcpy(&this->prev_value_, &this->value_, sizeof(T));
-      }
-    }
+    if (!this->restore_value_)
+      return;
+    // Lambdas change the value through id() directly, so changes are found by comparing with the saved value
+    const uint32_t now = millis();
+    if (now - this->last_save_ < this->save_interval_)
+      return;
+    if (this->save_changed_())
+      this->last_save_ = now;
+  }
+
+  void on_shutdown() override {
+    if (this->restore_value_)
+      this->save_changed_();
   }
 
   void set_restore_value(uint32_t name_hash) {
     this->restore_value_ = true;
     this->name_hash_ = name_hash;
   }
+  /// Set the minimum time between two saves of a changed value in ms, the last change is saved on shutdown.
+  void set_save_interval(uint32_t save_interval) { this->save_interval_ = save_interval; }
 
  protected:
+  bool save_changed_() {
+    if (memcmp(&this->value_, &this->prev_value_, sizeof(T)) == 0)
+      return false;
+    this->rtc_.save(&this->value_);
+    memcpy(&this->prev_value_, &this->value_, sizeof(T));
+    return true;
+  }
+
   T value_{};
   T prev_value_{};
   bool restore_value_{false};
   uint32_t name_hash_{};
+  uint32_t save_interval_{0};
+  uint32_t last_save_{0};
   ESPPreferenceObject rtc_;
 };
 
@@ -59,7 +77,7 @@ template<class C, typename... Ts> class GlobalVarSetAction : public Action<Ts...
 
   TEMPLATABLE_VALUE(T, value);
 
-  void play(Ts... x) override { this->parent_->value() = this->value_.value(x...); }
+  void play(const Ts &... x) override { this->parent_->value() = this->value_.value(x...); }
 
  protected:
   C *parent_;
@@ -2,19 +2,39 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
 from esphome.components import binary_sensor
-from esphome.const import CONF_ID, CONF_PIN
+from esphome.const import CONF_ID, CONF_INTERRUPT, CONF_NUMBER, CONF_PIN
+from esphome.core import CORE
 from .. import gpio_ns
 
 GPIOBinarySensor = gpio_ns.class_(
     "GPIOBinarySensor", binary_sensor.BinarySensor, cg.Component
 )
 
-CONFIG_SCHEMA = binary_sensor.BINARY_SENSOR_SCHEMA.extend(
-    {
-        cv.GenerateID(): cv.declare_id(GPIOBinarySensor),
-        cv.Required(CONF_PIN): pins.gpio_input_pin_schema,
-    }
-).extend(cv.COMPONENT_SCHEMA)
+
+
+def validate_interrupt(config):
+    if not config[CONF_INTERRUPT]:
+        return config
+    pin = config[CONF_PIN]
+    if any(key in pin for key in pins.PIN_SCHEMA_REGISTRY):
+        raise cv.Invalid(
+            "Interrupt mode only works with internal GPIO pins", [CONF_INTERRUPT]
+        )
+    if CORE.is_esp8266 and pin[CONF_NUMBER] == 16:
+        raise cv.Invalid("GPIO16 on the ESP8266 has no interrupts", [CONF_INTERRUPT])
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    binary_sensor.BINARY_SENSOR_SCHEMA.extend(
+        {
+            cv.GenerateID(): cv.declare_id(GPIOBinarySensor),
+            cv.Required(CONF_PIN): pins.gpio_input_pin_schema,
+            cv.Optional(CONF_INTERRUPT, default=False): cv.boolean,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    validate_interrupt,
+)
 
 
 async def to_code(config):
@@ -24,3 +44,4 @@ async def to_code(config):
 
     pin = await cg.gpio_pin_expression(config[CONF_PIN])
     cg.add(var.set_pin(pin))
+    cg.add(var.set_use_interrupt(config[CONF_INTERRUPT]))
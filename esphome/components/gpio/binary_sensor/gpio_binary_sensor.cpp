@@ -6,17 +6,57 @@ namespace gpio {
 
 static const char *const TAG = "gpio.binary_sensor";
 
+void ICACHE_RAM_ATTR GPIOBinarySensorStore::gpio_intr(GPIOBinarySensorStore *arg) {
+  const uint32_t now = micros();
+  const bool level = arg->pin->digital_read();
+  if (level == arg->last_level) {
+    // The pin went back before this interrupt got to read it, report a zero length pulse
+    arg->edges.push(GPIOBinarySensorEdge{now, !level});
+  }
+  arg->last_level = level;
+  arg->edges.push(GPIOBinarySensorEdge{now, level});
+  arg->parent->enable_loop_soon_any_context();
+}
+
 void GPIOBinarySensor::setup() {
   this->pin_->setup();
-  this->publish_initial_state(this->pin_->digital_read());
+  const bool level = this->pin_->digital_read();
+  this->publish_initial_state(level);
+  if (this->use_interrupt_) {
+    this->store_.pin = this->pin_->to_isr();
+    this->store_.parent = this;
+    this->store_.last_level = level;
+    this->pin_->attach_interrupt(GPIOBinarySensorStore::gpio_intr, &this->store_, CHANGE);
+  }
 }
 
 void GPIOBinarySensor::dump_config() {
   LOG_BINARY_SENSOR("", "GPIO Binary Sensor", this);
   LOG_PIN("  Pin: ", this->pin_);
+  ESP_LOGCONFIG(TAG, "  Mode: %s", this->use_interrupt_ ? "interrupt" : "polling");
 }
 
-void GPIOBinarySensor::loop() { this->publish_state(this->pin_->digital_read()); }
+void GPIOBinarySensor::loop() {
+  if (!this->use_interrupt_) {
+    this->publish_state(this->pin_->digital_read());
+    return;
+  }
+
+  GPIOBinarySensorEdge edge;
+  while (this->store_.edges.pop(edge)) {
+    ESP_LOGVV(TAG, "'%s': Edge to %s at %u us", this->get_name().c_str(), ONOFF(edge.level), edge.time);
+    this->publish_state(edge.level);
+  }
+  const uint32_t overflow_count = this->store_.edges.get_overflow_count();
+  if (overflow_count != this->overflow_count_) {
+    ESP_LOGW(TAG, "'%s': Dropped %u edges, resyncing with the pin", this->get_name().c_str(),
+             overflow_count - this->overflow_count_);
+    this->overflow_count_ = overflow_count;
+    this->publish_state(this->pin_->digital_read());
+  }
+  // enable_loop_soon_any_context() in the interrupt wakes us up again
+  this->disable_loop();
+}
 
 float GPIOBinarySensor::get_setup_priority() const { return setup_priority::HARDWARE; }
 
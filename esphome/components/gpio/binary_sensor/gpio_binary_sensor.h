@@ -1,14 +1,39 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/esphal.h"
+#include "esphome/core/lock_free_queue.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
 
 namespace esphome {
 namespace gpio {
 
+struct GPIOBinarySensorEdge {
+  /// micros() when the interrupt ran.
+  uint32_t time;
+  bool level;
+};
+
+/// Store data in a class that doesn't use multiple-inheritance (vtables in flash)
+struct GPIOBinarySensorStore {
+  ISRInternalGPIOPin *pin;
+  Component *parent;
+  /// Level of the last queued edge, so that pulses shorter than the interrupt latency aren't lost.
+  volatile bool last_level{false};
+  LockFreeQueue<GPIOBinarySensorEdge, 32> edges;
+
+  static void gpio_intr(GPIOBinarySensorStore *arg);
+};
+
 class GPIOBinarySensor : public binary_sensor::BinarySensor, public Component {
  public:
   void set_pin(GPIOPin *pin) { pin_ = pin; }
+  /** Capture edges in an interrupt instead of reading the pin in every loop() iteration.
+   *
+   * Every edge is published in order, even ones shorter than a main loop iteration, and loop() is only
+   * running while there are edges to publish. Only works with internal pins.
+   */
+  void set_use_interrupt(bool use_interrupt) { use_interrupt_ = use_interrupt; }
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Setup pin
@@ -21,6 +46,9 @@ class GPIOBinarySensor : public binary_sensor::BinarySensor, public Component {
 
  protected:
   GPIOPin *pin_;
+  bool use_interrupt_{false};
+  GPIOBinarySensorStore store_;
+  uint32_t overflow_count_{0};
 };
 
 }  // namespace gpio
@@ -10,6 +10,7 @@ from esphome.const import (
     CONF_COURSE,
     CONF_ALTITUDE,
     CONF_SATELLITES,
+    CONF_PROTOCOL,
     STATE_CLASS_MEASUREMENT,
     STATE_CLASS_NONE,
     UNIT_DEGREES,
@@ -28,6 +29,11 @@ CODEOWNERS = ["@coogle"]
 gps_ns = cg.esphome_ns.namespace("gps")
 GPS = gps_ns.class_("GPS", cg.Component, uart.UARTDevice)
 GPSListener = gps_ns.class_("GPSListener")
+GPSProtocol = gps_ns.enum("GPSProtocol")
+GPS_PROTOCOLS = {
+    "NMEA": GPSProtocol.GPS_PROTOCOL_NMEA,
+    "UBX": GPSProtocol.GPS_PROTOCOL_UBX,
+}
 
 CONF_GPS_ID = "gps_id"
 MULTI_CONF = True
@@ -57,6 +63,9 @@ CONFIG_SCHEMA = (
             cv.Optional(CONF_SATELLITES): sensor.sensor_schema(
                 UNIT_EMPTY, ICON_EMPTY, 0, DEVICE_CLASS_EMPTY, STATE_CLASS_MEASUREMENT
             ),
+            cv.Optional(CONF_PROTOCOL, default="NMEA"): cv.enum(
+                GPS_PROTOCOLS, upper=True
+            ),
         }
     )
     .extend(cv.polling_component_schema("20s"))
@@ -69,6 +78,7 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     await uart.register_uart_device(var, config)
+    cg.add(var.set_protocol(config[CONF_PROTOCOL]))
 
     if CONF_LATITUDE in config:
         sens = await sensor.new_sensor(config[CONF_LATITUDE])
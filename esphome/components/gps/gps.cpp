@@ -1,13 +1,82 @@
 #include "gps.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 namespace gps {
 
 static const char *const TAG = "gps";
 
+static const uint8_t UBX_SYNC_1 = 0xB5;
+static const uint8_t UBX_SYNC_2 = 0x62;
+static const uint8_t UBX_CLASS_NAV = 0x01;
+static const uint8_t UBX_CLASS_CFG = 0x06;
+static const uint8_t UBX_NAV_PVT = 0x07;
+static const uint8_t UBX_CFG_MSG = 0x01;
+static const uint16_t UBX_NAV_PVT_PAYLOAD_LENGTH = 92;
+// sync (16bit) + class + id + length (16bit) + payload + checksum (16bit)
+static const uint8_t UBX_HEADER_LENGTH = 6;
+static const uint8_t UBX_FRAME_OVERHEAD = 8;
+
 TinyGPSPlus &GPSListener::get_tiny_gps() { return this->parent_->get_tiny_gps(); }
 
+static void ubx_checksum(const uint8_t *data, size_t length, uint8_t *ck_a, uint8_t *ck_b) {
+  uint8_t a = 0, b = 0;
+  for (size_t i = 0; i < length; i++) {
+    a += data[i];
+    b += a;
+  }
+  *ck_a = a;
+  *ck_b = b;
+}
+static int32_t get_i32(const uint8_t *data) {
+  return int32_t(encode_uint32(data[3], data[2], data[1], data[0]));
+}
+
+void GPS::setup() {
+  if (this->protocol_ != GPS_PROTOCOL_UBX)
+    return;
+
+  this->ubx_parser_.set_header({UBX_SYNC_1, UBX_SYNC_2, UBX_CLASS_NAV, UBX_NAV_PVT});
+  this->ubx_parser_.set_length_field(4, 2, false, UBX_FRAME_OVERHEAD);
+  this->ubx_parser_.set_max_length(UBX_NAV_PVT_PAYLOAD_LENGTH + UBX_FRAME_OVERHEAD);
+  this->ubx_parser_.set_validator([](const uint8_t *frame, size_t length) {
+    if (length != UBX_NAV_PVT_PAYLOAD_LENGTH + UBX_FRAME_OVERHEAD)
+      return false;
+    // The checksum covers class, id, length and payload
+    uint8_t ck_a, ck_b;
+    ubx_checksum(frame + 2, length - 4, &ck_a, &ck_b);
+    if (ck_a != frame[length - 2] || ck_b != frame[length - 1]) {
+      ESP_LOGW(TAG, "UBX NAV-PVT checksum mismatch!");
+      return false;
+    }
+    return true;
+  });
+  this->ubx_parser_.set_on_frame([this](const uint8_t *frame, size_t length) { this->on_nav_pvt_(frame); });
+
+  // Output NAV-PVT on the port we are connected to with every navigation solution
+  const uint8_t cfg_msg[] = {UBX_CLASS_NAV, UBX_NAV_PVT, 1};
+  this->write_ubx_(UBX_CLASS_CFG, UBX_CFG_MSG, cfg_msg, sizeof(cfg_msg));
+}
+
+void GPS::write_ubx_(uint8_t msg_class, uint8_t msg_id, const uint8_t *payload, uint16_t length) {
+  uint8_t header[UBX_HEADER_LENGTH] = {UBX_SYNC_1, UBX_SYNC_2, msg_class, msg_id, uint8_t(length & 0xFF),
+                                       uint8_t(length >> 8)};
+  uint8_t ck_a, ck_b;
+  ubx_checksum(header + 2, UBX_HEADER_LENGTH - 2, &ck_a, &ck_b);
+  // Continue the running sums of the header over the payload
+  for (uint16_t i = 0; i < length; i++) {
+    ck_a += payload[i];
+    ck_b += ck_a;
+  }
+  this->write_array(header, UBX_HEADER_LENGTH);
+  this->write_array(payload, length);
+  this->write_byte(ck_a);
+  this->write_byte(ck_b);
+}
+
 void GPS::update() {
   if (this->latitude_sensor_ != nullptr)
     this->latitude_sensor_->publish_state(this->latitude_);
@@ -29,43 +98,136 @@ void GPS::update() {
 }
 
 void GPS::loop() {
-  while (this->available() && !this->has_time_) {
-    if (this->tiny_gps_.encode(this->read())) {
-      if (tiny_gps_.location.isUpdated()) {
-        this->latitude_ = tiny_gps_.location.lat();
-        this->longitude_ = tiny_gps_.location.lng();
-
-        ESP_LOGD(TAG, "Location:");
-        ESP_LOGD(TAG, "  Lat: %f", this->latitude_);
-        ESP_LOGD(TAG, "  Lon: %f", this->longitude_);
-      }
+  const uint8_t *data;
+  size_t length;
+  while (!this->has_time_ && (length = this->read_buffer(&data)) != 0) {
+    if (this->protocol_ == GPS_PROTOCOL_UBX) {
+      this->ubx_parser_.feed(data, length);
+    } else {
+      this->parse_nmea_(data, length);
+    }
+  }
+}
 
-      if (tiny_gps_.speed.isUpdated()) {
-        this->speed_ = tiny_gps_.speed.kmph();
-        ESP_LOGD(TAG, "Speed:");
-        ESP_LOGD(TAG, "  %f km/h", this->speed_);
+void GPS::parse_nmea_(const uint8_t *data, size_t length) {
+  while (length != 0) {
+    switch (this->nmea_state_) {
+      case NMEAState::WAIT_FOR_START: {
+        const void *start = memchr(data, '$', length);
+        if (start == nullptr)
+          return;
+        length -= static_cast<const uint8_t *>(start) - data;
+        data = static_cast<const uint8_t *>(start);
+        this->nmea_type_length_ = 0;
+        this->nmea_state_ = NMEAState::READ_TYPE;
+        break;
       }
-      if (tiny_gps_.course.isUpdated()) {
-        this->course_ = tiny_gps_.course.deg();
-        ESP_LOGD(TAG, "Course:");
-        ESP_LOGD(TAG, "  %f °", this->course_);
-      }
-      if (tiny_gps_.altitude.isUpdated()) {
-        this->altitude_ = tiny_gps_.altitude.meters();
-        ESP_LOGD(TAG, "Altitude:");
-        ESP_LOGD(TAG, "  %f m", this->altitude_);
+      case NMEAState::READ_TYPE: {
+        const size_t count = std::min(sizeof(this->nmea_type_) - this->nmea_type_length_, length);
+        memcpy(this->nmea_type_ + this->nmea_type_length_, data, count);
+        this->nmea_type_length_ += count;
+        data += count;
+        length -= count;
+        if (this->nmea_type_length_ < sizeof(this->nmea_type_))
+          return;
+
+        // "$" + talker id (2 chars, for example GP or GN) + sentence type (3 chars)
+        const char *type = this->nmea_type_ + 3;
+        if (memcmp(type, "GGA", 3) != 0 && memcmp(type, "RMC", 3) != 0) {
+          this->nmea_state_ = NMEAState::WAIT_FOR_START;
+          break;
+        }
+        for (char c : this->nmea_type_)
+          this->tiny_gps_.encode(c);
+        this->nmea_state_ = NMEAState::FEED_SENTENCE;
+        break;
       }
-      if (tiny_gps_.satellites.isUpdated()) {
-        this->satellites_ = tiny_gps_.satellites.value();
-        ESP_LOGD(TAG, "Satellites:");
-        ESP_LOGD(TAG, "  %d", this->satellites_);
+      case NMEAState::FEED_SENTENCE: {
+        const void *end = memchr(data, '\n', length);
+        const size_t count = end == nullptr ? length : static_cast<const uint8_t *>(end) - data + 1;
+        for (size_t i = 0; i < count; i++) {
+          if (this->tiny_gps_.encode(data[i]))
+            this->on_nmea_sentence_();
+        }
+        data += count;
+        length -= count;
+        if (end != nullptr)
+          this->nmea_state_ = NMEAState::WAIT_FOR_START;
+        break;
       }
-
-      for (auto *listener : this->listeners_)
-        listener->on_update(this->tiny_gps_);
     }
   }
 }
 
+void GPS::on_nmea_sentence_() {
+  if (tiny_gps_.location.isUpdated()) {
+    this->latitude_ = tiny_gps_.location.lat();
+    this->longitude_ = tiny_gps_.location.lng();
+
+    ESP_LOGD(TAG, "Location:");
+    ESP_LOGD(TAG, "  Lat: %f", this->latitude_);
+    ESP_LOGD(TAG, "  Lon: %f", this->longitude_);
+  }
+
+  if (tiny_gps_.speed.isUpdated()) {
+    this->speed_ = tiny_gps_.speed.kmph();
+    ESP_LOGD(TAG, "Speed:");
+    ESP_LOGD(TAG, "  %f km/h", this->speed_);
+  }
+  if (tiny_gps_.course.isUpdated()) {
+    this->course_ = tiny_gps_.course.deg();
+    ESP_LOGD(TAG, "Course:");
+    ESP_LOGD(TAG, "  %f °", this->course_);
+  }
+  if (tiny_gps_.altitude.isUpdated()) {
+    this->altitude_ = tiny_gps_.altitude.meters();
+    ESP_LOGD(TAG, "Altitude:");
+    ESP_LOGD(TAG, "  %f m", this->altitude_);
+  }
+  if (tiny_gps_.satellites.isUpdated()) {
+    this->satellites_ = tiny_gps_.satellites.value();
+    ESP_LOGD(TAG, "Satellites:");
+    ESP_LOGD(TAG, "  %d", this->satellites_);
+  }
+
+  for (auto *listener : this->listeners_)
+    listener->on_update(this->tiny_gps_);
+}
+
+void GPS::on_nav_pvt_(const uint8_t *frame) {
+  const uint8_t *payload = frame + UBX_HEADER_LENGTH;
+  UBXNavPVT pvt{};
+  pvt.year = encode_uint16(payload[5], payload[4]);
+  pvt.month = payload[6];
+  pvt.day = payload[7];
+  pvt.hour = payload[8];
+  pvt.minute = payload[9];
+  pvt.second = payload[10];
+  pvt.date_valid = (payload[11] & 0x01) != 0;
+  pvt.time_valid = (payload[11] & 0x02) != 0;
+  pvt.fix_ok = (payload[21] & 0x01) != 0;
+  pvt.satellites = payload[23];
+  pvt.longitude = get_i32(payload + 24) * 1e-7;
+  pvt.latitude = get_i32(payload + 28) * 1e-7;
+  pvt.altitude = get_i32(payload + 36) / 1000.0f;
+  // mm/s to km/h
+  pvt.speed = get_i32(payload + 60) * 0.0036f;
+  pvt.course = get_i32(payload + 64) * 1e-5f;
+
+  this->satellites_ = pvt.satellites;
+  if (pvt.fix_ok) {
+    this->latitude_ = pvt.latitude;
+    this->longitude_ = pvt.longitude;
+    this->altitude_ = pvt.altitude;
+    this->speed_ = pvt.speed;
+    this->course_ = pvt.course;
+  }
+  ESP_LOGV(TAG, "NAV-PVT: fix=%s lat=%f lon=%f alt=%.1fm speed=%.1fkm/h course=%.1f° satellites=%u",
+           YESNO(pvt.fix_ok), pvt.latitude, pvt.longitude, pvt.altitude, pvt.speed, pvt.course, pvt.satellites);
+
+  for (auto *listener : this->listeners_)
+    listener->on_nav_pvt(pvt);
+}
+
 }  // namespace gps
 }  // namespace esphome
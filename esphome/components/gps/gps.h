@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/frame_parser.h"
 #include "esphome/components/sensor/sensor.h"
 #include <TinyGPS++.h>
 
@@ -10,9 +11,40 @@ namespace gps {
 
 class GPS;
 
+enum GPSProtocol {
+  GPS_PROTOCOL_NMEA,
+  GPS_PROTOCOL_UBX,
+};
+
+/// The fields of a UBX NAV-PVT message that the GPS component and its listeners use.
+struct UBXNavPVT {
+  uint16_t year;
+  uint8_t month;
+  uint8_t day;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t second;
+  bool date_valid;
+  bool time_valid;
+  /// The fix is valid, the position and velocity fields can be used.
+  bool fix_ok;
+  uint8_t satellites;
+  /// In degrees.
+  float latitude;
+  float longitude;
+  /// Height above mean sea level in meters.
+  float altitude;
+  /// Ground speed in km/h.
+  float speed;
+  /// Heading of motion in degrees.
+  float course;
+};
+
 class GPSListener {
  public:
   virtual void on_update(TinyGPSPlus &tiny_gps) = 0;
+  /// Called with each NAV-PVT message when the GPS uses the UBX protocol, tiny_gps isn't updated then.
+  virtual void on_nav_pvt(const UBXNavPVT &pvt) {}
   TinyGPSPlus &get_tiny_gps();
 
  protected:
@@ -29,6 +61,7 @@ class GPS : public PollingComponent, public uart::UARTDevice {
   void set_course_sensor(sensor::Sensor *course_sensor) { course_sensor_ = course_sensor; }
   void set_altitude_sensor(sensor::Sensor *altitude_sensor) { altitude_sensor_ = altitude_sensor; }
   void set_satellites_sensor(sensor::Sensor *satellites_sensor) { satellites_sensor_ = satellites_sensor; }
+  void set_protocol(GPSProtocol protocol) { protocol_ = protocol; }
 
   void register_listener(GPSListener *listener) {
     listener->parent_ = this;
@@ -36,12 +69,25 @@ class GPS : public PollingComponent, public uart::UARTDevice {
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
+  void setup() override;
   void loop() override;
   void update() override;
 
   TinyGPSPlus &get_tiny_gps() { return this->tiny_gps_; }
 
  protected:
+  enum class NMEAState : uint8_t {
+    WAIT_FOR_START,
+    READ_TYPE,
+    FEED_SENTENCE,
+  };
+
+  /// Pass the bytes of GGA and RMC sentences to tiny_gps, all other sentences are skipped.
+  void parse_nmea_(const uint8_t *data, size_t length);
+  void on_nmea_sentence_();
+  void on_nav_pvt_(const uint8_t *frame);
+  void write_ubx_(uint8_t msg_class, uint8_t msg_id, const uint8_t *payload, uint16_t length);
+
   float latitude_ = -1;
   float longitude_ = -1;
   float speed_ = -1;
@@ -57,7 +103,13 @@ class GPS : public PollingComponent, public uart::UARTDevice {
   sensor::Sensor *satellites_sensor_{nullptr};
 
   bool has_time_{false};
+  GPSProtocol protocol_{GPS_PROTOCOL_NMEA};
   TinyGPSPlus tiny_gps_;
+  /// The start of the current NMEA sentence up to its type, for example "$GPGGA".
+  char nmea_type_[6];
+  uint8_t nmea_type_length_{0};
+  NMEAState nmea_state_{NMEAState::WAIT_FOR_START};
+  uart::FrameParser ubx_parser_;
   std::vector<GPSListener *> listeners_{};
 };
 
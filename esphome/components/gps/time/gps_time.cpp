@@ -11,20 +11,33 @@ void GPSTime::from_tiny_gps_(TinyGPSPlus &tiny_gps) {
     return;
   if (!tiny_gps.time.isUpdated() || !tiny_gps.date.isUpdated())
     return;
-  if (tiny_gps.date.year() < 2019)
+  this->synchronize_(tiny_gps.date.year(), tiny_gps.date.month(), tiny_gps.date.day(), tiny_gps.time.hour(),
+                     tiny_gps.time.minute(), tiny_gps.time.second());
+}
+
+void GPSTime::on_nav_pvt(const UBXNavPVT &pvt) {
+  if (!this->ubx_sync_pending_ || !pvt.date_valid || !pvt.time_valid)
+    return;
+  this->synchronize_(pvt.year, pvt.month, pvt.day, pvt.hour, pvt.minute, pvt.second);
+  if (this->has_time_)
+    this->ubx_sync_pending_ = false;
+}
+
+void GPSTime::synchronize_(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second) {
+  if (year < 2019)
     return;
 
   time::ESPTime val{};
-  val.year = tiny_gps.date.year();
-  val.month = tiny_gps.date.month();
-  val.day_of_month = tiny_gps.date.day();
+  val.year = year;
+  val.month = month;
+  val.day_of_month = day;
   // Set these to valid value for  recalc_timestamp_utc - it's not used for calculation
   val.day_of_week = 1;
   val.day_of_year = 1;
 
-  val.hour = tiny_gps.time.hour();
-  val.minute = tiny_gps.time.minute();
-  val.second = tiny_gps.time.second();
+  val.hour = hour;
+  val.minute = minute;
+  val.second = second;
   val.recalc_timestamp_utc(false);
   this->synchronize_epoch_(val.timestamp);
   this->has_time_ = true;
@@ -9,15 +9,22 @@ namespace gps {
 
 class GPSTime : public time::RealTimeClock, public GPSListener {
  public:
-  void update() override { this->from_tiny_gps_(this->get_tiny_gps()); };
+  void update() override {
+    this->from_tiny_gps_(this->get_tiny_gps());
+    this->ubx_sync_pending_ = true;
+  };
   void on_update(TinyGPSPlus &tiny_gps) override {
     if (!this->has_time_)
       this->from_tiny_gps_(tiny_gps);
   }
+  void on_nav_pvt(const UBXNavPVT &pvt) override;
 
  protected:
   void from_tiny_gps_(TinyGPSPlus &tiny_gps);
+  void synchronize_(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second);
   bool has_time_{false};
+  /// With UBX the time is only in NAV-PVT messages, so update() synchronizes from the next one.
+  bool ubx_sync_pending_{true};
 };
 
 }  // namespace gps
@@ -310,6 +310,10 @@ bool HitachiClimate::parse_swing_(const uint8_t remote_state[]) {
   return true;
 }
 
+remote_base::RemoteSignature HitachiClimate::get_signature() {
+  return {HITACHI_AC344_HDR_MARK, HITACHI_AC344_HDR_SPACE};
+}
+
 bool HitachiClimate::on_receive(remote_base::RemoteReceiveData data) {
   // Validate header
   if (!data.expect_item(HITACHI_AC344_HDR_MARK, HITACHI_AC344_HDR_SPACE)) {
@@ -109,6 +109,7 @@ class HitachiClimate : public climate_ir::ClimateIR {
   void set_button_(uint8_t button);
   // Handle received IR Buffer
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  remote_base::RemoteSignature get_signature() override;
   bool parse_mode_(const uint8_t remote_state[]);
   bool parse_temperature_(const uint8_t remote_state[]);
   bool parse_fan_(const uint8_t remote_state[]);
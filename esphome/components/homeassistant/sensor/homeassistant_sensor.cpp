@@ -8,9 +8,8 @@ namespace homeassistant {
 static const char *const TAG = "homeassistant.sensor";
 
 void HomeassistantSensor::setup() {
-  api::global_api_server->subscribe_home_assistant_state(
-      this->entity_id_, this->attribute_, [this](const std::string &state) {
-        auto val = parse_float(state);
+  api::global_api_server->subscribe_home_assistant_number_state(
+      this->entity_id_, this->attribute_, [this](const std::string &state, optional<float> val) {
         if (!val.has_value()) {
           ESP_LOGW(TAG, "Can't convert '%s' to number!", state.c_str());
           this->publish_state(NAN);
@@ -99,6 +99,7 @@ async def to_code(config):
     cg.add(var.set_timeout(config[CONF_TIMEOUT]))
     cg.add(var.set_useragent(config[CONF_USERAGENT]))
     await cg.register_component(var, config)
+    cg.add_define("USE_HTTP_REQUEST")
 
 
 HTTP_REQUEST_ACTION_SCHEMA = cv.Schema(
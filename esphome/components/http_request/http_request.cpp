@@ -6,54 +6,131 @@ namespace http_request {
 
 static const char *const TAG = "http_request";
 
+/// Number of origins a connection is kept alive to, the least recently used one is closed first.
+static const uint8_t MAX_CONNECTIONS = 3;
+
+/// Passes everything written to it on to a callback, lets HTTPClient::writeToStream() decode the body.
+class CallbackStream : public Stream {
+ public:
+  explicit CallbackStream(const std::function<void(const uint8_t *data, size_t len)> &callback)
+      : callback_(callback) {}
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override {}
+  size_t write(uint8_t data) override { return this->write(&data, 1); }
+  size_t write(const uint8_t *data, size_t len) override {
+    this->callback_(data, len);
+    return len;
+  }
+
+ protected:
+  const std::function<void(const uint8_t *data, size_t len)> &callback_;
+};
+
+/// The scheme, host and port part of an URL.
+static std::string get_origin(const std::string &url) {
+  size_t host = url.find("://");
+  host = host == std::string::npos ? 0 : host + 3;
+  return url.substr(0, url.find('/', host));
+}
+
 void HttpRequestComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "HTTP Request:");
   ESP_LOGCONFIG(TAG, "  Timeout: %ums", this->timeout_);
   ESP_LOGCONFIG(TAG, "  User-Agent: %s", this->useragent_);
+  ESP_LOGCONFIG(TAG, "  Kept-alive Connections: %u", MAX_CONNECTIONS);
 }
 
 void HttpRequestComponent::set_url(std::string url) {
   this->url_ = std::move(url);
   this->secure_ = this->url_.compare(0, 6, "https:") == 0;
+}
+
+HttpConnection *HttpRequestComponent::get_connection_() {
+  std::string origin = get_origin(this->url_);
+  for (auto it = this->connections_.begin(); it != this->connections_.end(); ++it) {
+    HttpConnection *connection = *it;
+    if (connection->origin == origin) {
+      this->connections_.erase(it);
+      this->connections_.push_back(connection);
+      return connection;
+    }
+  }
+
+  if (this->connections_.size() >= MAX_CONNECTIONS) {
+    this->free_connection_(this->connections_.front());
+    this->connections_.erase(this->connections_.begin());
+  }
 
-  if (!this->last_url_.empty() && this->url_ != this->last_url_) {
-    // Close connection if url has been changed
-    this->client_.setReuse(false);
-    this->client_.end();
+  auto *connection = new HttpConnection();
+  connection->origin = origin;
+  connection->client.setReuse(true);
+#ifdef ARDUINO_ARCH_ESP8266
+  if (this->secure_) {
+    auto *secure = new BearSSL::WiFiClientSecure();
+    secure->setInsecure();
+    secure->setBufferSizes(512, 512);
+    connection->tls_session = new BearSSL::Session();
+    secure->setSession(connection->tls_session);
+    connection->wifi_client = secure;
+  } else {
+    connection->wifi_client = new WiFiClient();
   }
-  this->client_.setReuse(true);
+#endif
+  this->connections_.push_back(connection);
+  return connection;
+}
+
+void HttpRequestComponent::free_connection_(HttpConnection *connection) {
+  connection->client.setReuse(false);
+  connection->client.end();
+#ifdef ARDUINO_ARCH_ESP8266
+  delete connection->wifi_client;
+  delete connection->tls_session;
+#endif
+  delete connection;
 }
 
-void HttpRequestComponent::send(const std::vector<HttpRequestResponseTrigger *> &response_triggers) {
+bool HttpRequestComponent::send(const std::vector<HttpRequestResponseTrigger *> &response_triggers) {
+  this->connection_ = this->get_connection_();
+  HTTPClient &client = this->connection_->client;
+
   bool begin_status = false;
   const String url = this->url_.c_str();
 #ifdef ARDUINO_ARCH_ESP32
-  begin_status = this->client_.begin(url);
+  begin_status = client.begin(url);
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
 #ifndef CLANG_TIDY
-  this->client_.setFollowRedirects(true);
-  this->client_.setRedirectLimit(3);
-  begin_status = this->client_.begin(*this->get_wifi_client_(), url);
+  client.setFollowRedirects(true);
+  client.setRedirectLimit(3);
+  begin_status = client.begin(*this->connection_->wifi_client, url);
 #endif
 #endif
 
   if (!begin_status) {
-    this->client_.end();
+    client.end();
     this->status_set_warning();
     ESP_LOGW(TAG, "HTTP Request failed at the begin phase. Please check the configuration");
-    return;
+    return false;
   }
 
-  this->client_.setTimeout(this->timeout_);
+  client.setTimeout(this->timeout_);
   if (this->useragent_ != nullptr) {
-    this->client_.setUserAgent(this->useragent_);
+    client.setUserAgent(this->useragent_);
   }
   for (const auto &header : this->headers_) {
-    this->client_.addHeader(header.name, header.value, false, true);
+    client.addHeader(header.name, header.value, false, true);
   }
 
-  int http_code = this->client_.sendRequest(this->method_, this->body_.c_str());
+  bool reused = client.connected();
+  int http_code = client.sendRequest(this->method_, this->body_.c_str());
+  if (reused && (http_code == HTTPC_ERROR_SEND_HEADER_FAILED || http_code == HTTPC_ERROR_CONNECTION_LOST)) {
+    // The server closed the kept-alive connection in the meantime, the retry opens a new one
+    ESP_LOGD(TAG, "Kept-alive connection to %s was closed, reconnecting", this->connection_->origin.c_str());
+    http_code = client.sendRequest(this->method_, this->body_.c_str());
+  }
   for (auto *trigger : response_triggers)
     trigger->process(http_code);
 
@@ -61,45 +138,45 @@ void HttpRequestComponent::send(const std::vector<HttpRequestResponseTrigger *>
     ESP_LOGW(TAG, "HTTP Request failed; URL: %s; Error: %s", this->url_.c_str(),
              HTTPClient::errorToString(http_code).c_str());
     this->status_set_warning();
-    return;
+    return false;
   }
 
   if (http_code < 200 || http_code >= 300) {
     ESP_LOGW(TAG, "HTTP Request failed; URL: %s; Code: %d", this->url_.c_str(), http_code);
     this->status_set_warning();
-    return;
+    return false;
   }
 
   this->status_clear_warning();
   ESP_LOGD(TAG, "HTTP Request completed; URL: %s; Code: %d", this->url_.c_str(), http_code);
+  return true;
 }
 
-#ifdef ARDUINO_ARCH_ESP8266
-WiFiClient *HttpRequestComponent::get_wifi_client_() {
-  if (this->secure_) {
-    if (this->wifi_client_secure_ == nullptr) {
-      this->wifi_client_secure_ = new BearSSL::WiFiClientSecure();
-      this->wifi_client_secure_->setInsecure();
-      this->wifi_client_secure_->setBufferSizes(512, 512);
-    }
-    return this->wifi_client_secure_;
-  }
-
-  if (this->wifi_client_ == nullptr) {
-    this->wifi_client_ = new WiFiClient();
-  }
-  return this->wifi_client_;
-}
-#endif
-
 void HttpRequestComponent::close() {
-  this->last_url_ = this->url_;
-  this->client_.end();
+  // Keeps the connection open if the server allows it
+  if (this->connection_ != nullptr)
+    this->connection_->client.end();
+  this->connection_ = nullptr;
 }
 
 const char *HttpRequestComponent::get_string() {
-  static const String STR = this->client_.getString();
-  return STR.c_str();
+  if (this->connection_ == nullptr)
+    return "";
+  this->response_string_ = this->connection_->client.getString();
+  return this->response_string_.c_str();
+}
+
+bool HttpRequestComponent::read_body(const std::function<void(const uint8_t *data, size_t len)> &callback) {
+  if (this->connection_ == nullptr)
+    return false;
+  CallbackStream stream(callback);
+  int result = this->connection_->client.writeToStream(&stream);
+  if (result < 0) {
+    ESP_LOGW(TAG, "Reading response body failed; URL: %s; Error: %s", this->url_.c_str(),
+             HTTPClient::errorToString(result).c_str());
+    return false;
+  }
+  return true;
 }
 
 }  // namespace http_request
@@ -3,9 +3,11 @@
 #include "esphome/components/json/json_util.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
+#include <functional>
 #include <list>
 #include <map>
 #include <utility>
+#include <vector>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <HTTPClient.h>
@@ -25,6 +27,17 @@ struct Header {
 
 class HttpRequestResponseTrigger;
 
+/// A connection to one origin (scheme, host and port) that is kept alive between requests.
+struct HttpConnection {
+  std::string origin;
+  HTTPClient client;
+#ifdef ARDUINO_ARCH_ESP8266
+  WiFiClient *wifi_client{nullptr};
+  /// Lets a reconnect resume the previous TLS session instead of doing a full handshake.
+  BearSSL::Session *tls_session{nullptr};
+#endif
+};
+
 class HttpRequestComponent : public Component {
  public:
   void dump_config() override;
@@ -36,25 +49,34 @@ class HttpRequestComponent : public Component {
   void set_timeout(uint16_t timeout) { this->timeout_ = timeout; }
   void set_body(std::string body) { this->body_ = std::move(body); }
   void set_headers(std::list<Header> headers) { this->headers_ = std::move(headers); }
-  void send(const std::vector<HttpRequestResponseTrigger *> &response_triggers);
+  /// Send the request, returns whether the server answered with a 2xx status code.
+  bool send(const std::vector<HttpRequestResponseTrigger *> &response_triggers);
   void close();
+  /// Read the whole response body into memory, only use this for small responses.
   const char *get_string();
+  /** Hand the response body to `callback` in pieces as it arrives, without buffering all of it.
+   *
+   * Chunked transfer encoding is decoded. Only valid inside `on_response`, returns false if the body
+   * could not be read completely.
+   */
+  bool read_body(const std::function<void(const uint8_t *data, size_t len)> &callback);
 
  protected:
-  HTTPClient client_{};
+  /// Find the kept-alive connection for the origin of the current URL, or open a new one.
+  HttpConnection *get_connection_();
+  void free_connection_(HttpConnection *connection);
+
+  /// Least recently used first.
+  std::vector<HttpConnection *> connections_;
+  HttpConnection *connection_{nullptr};
+  String response_string_;
   std::string url_;
-  std::string last_url_;
   const char *method_;
   const char *useragent_{nullptr};
   bool secure_;
   uint16_t timeout_{5000};
   std::string body_;
   std::list<Header> headers_;
-#ifdef ARDUINO_ARCH_ESP8266
-  WiFiClient *wifi_client_{nullptr};
-  BearSSL::WiFiClientSecure *wifi_client_secure_{nullptr};
-  WiFiClient *get_wifi_client_();
-#endif
 };
 
 template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
@@ -74,7 +96,7 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
 
   void register_response_trigger(HttpRequestResponseTrigger *trigger) { this->response_triggers_.push_back(trigger); }
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     this->parent_->set_url(this->url_.value(x...));
     this->parent_->set_method(this->method_.value(x...));
     if (this->body_.has_value()) {
@@ -110,13 +132,13 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
   }
 
  protected:
-  void encode_json_(Ts... x, JsonObject &root) {
+  void encode_json_(const Ts &... x, JsonObject &root) {
     for (const auto &item : this->json_) {
       auto val = item.second;
       root[item.first] = val.value(x...);
     }
   }
-  void encode_json_func_(Ts... x, JsonObject &root) { this->json_func_(x..., root); }
+  void encode_json_func_(const Ts &... x, JsonObject &root) { this->json_func_(x..., root); }
   HttpRequestComponent *parent_;
   std::map<const char *, TemplatableValue<const char *, Ts...>> headers_{};
   std::map<const char *, TemplatableValue<std::string, Ts...>> json_{};
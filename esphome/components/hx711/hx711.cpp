@@ -15,16 +15,52 @@ void HX711Sensor::setup() {
 
   // Read sensor once without publishing to set the gain
   this->read_sensor_(nullptr);
+
+  if (this->use_interrupt_) {
+    this->store_.dout_pin = this->dout_pin_->to_isr();
+    this->store_.sck_pin = this->sck_pin_->to_isr();
+    this->store_.gain = this->gain_;
+    this->dout_pin_->attach_interrupt(HX711SensorStore::gpio_intr, &this->store_, FALLING);
+  }
 }
 
 void HX711Sensor::dump_config() {
   LOG_SENSOR("", "HX711", this);
   LOG_PIN("  DOUT Pin: ", this->dout_pin_);
   LOG_PIN("  SCK Pin: ", this->sck_pin_);
+  ESP_LOGCONFIG(TAG, "  Mode: %s", this->use_interrupt_ ? "interrupt (averaging)" : "polling");
   LOG_UPDATE_INTERVAL(this);
 }
 float HX711Sensor::get_setup_priority() const { return setup_priority::DATA; }
 void HX711Sensor::update() {
+  if (this->use_interrupt_) {
+    int64_t sum;
+    uint32_t count;
+    {
+      InterruptLock lock;
+      sum = this->store_.sum;
+      count = this->store_.count;
+      this->store_.sum = 0;
+      this->store_.count = 0;
+    }
+
+    if (count == 0) {
+      ESP_LOGW(TAG, "'%s': No readings since the last update!", this->name_.c_str());
+      this->status_set_warning();
+      // An edge can be missed if DOUT was already low when the interrupt was attached, a readout restarts the
+      // conversion cycle
+      if (!this->dout_pin_->digital_read())
+        this->read_sensor_(nullptr);
+      return;
+    }
+
+    this->status_clear_warning();
+    float value = float(sum) / float(count);
+    ESP_LOGD(TAG, "'%s': Got value %.1f (mean of %u readings)", this->name_.c_str(), value, count);
+    this->publish_state(value);
+    return;
+  }
+
   uint32_t result;
   if (this->read_sensor_(&result)) {
     int32_t value = static_cast<int32_t>(result);
@@ -70,5 +106,37 @@ bool HX711Sensor::read_sensor_(uint32_t *result) {
   return true;
 }
 
+void ICACHE_RAM_ATTR HX711SensorStore::gpio_intr(HX711SensorStore *arg) {
+  // DOUT also toggles while the bits are shifted out, only a low level after the readout means new data
+  if (arg->dout_pin->digital_read())
+    return;
+
+  uint32_t data = 0;
+  for (uint8_t i = 0; i < 24; i++) {
+    arg->sck_pin->digital_write(true);
+    delayMicroseconds(1);
+    data |= uint32_t(arg->dout_pin->digital_read()) << (23 - i);
+    arg->sck_pin->digital_write(false);
+    delayMicroseconds(1);
+  }
+  for (uint8_t i = 0; i < arg->gain; i++) {
+    arg->sck_pin->digital_write(true);
+    delayMicroseconds(1);
+    arg->sck_pin->digital_write(false);
+    delayMicroseconds(1);
+  }
+  // Drop the edges the readout itself caused
+  arg->dout_pin->clear_interrupt();
+
+  if (arg->discard > 0) {
+    arg->discard = arg->discard - 1;
+    return;
+  }
+  if (data & 0x800000ULL)
+    data |= 0xFF000000ULL;
+  arg->sum = arg->sum + static_cast<int32_t>(data);
+  arg->count = arg->count + 1;
+}
+
 }  // namespace hx711
 }  // namespace esphome
@@ -13,11 +13,27 @@ enum HX711Gain {
   HX711_GAIN_64 = 3,
 };
 
+/// State shared with the DOUT interrupt, the readout itself happens in the ISR.
+struct HX711SensorStore {
+  ISRInternalGPIOPin *dout_pin;
+  ISRInternalGPIOPin *sck_pin;
+  uint8_t gain;
+  /// Sum and number of the readings since the last update()
+  volatile int64_t sum{0};
+  volatile uint32_t count{0};
+  /// Readings to drop, the first conversion after power up still uses the previous gain
+  volatile uint8_t discard{1};
+
+  static void gpio_intr(HX711SensorStore *arg);
+};
+
 class HX711Sensor : public sensor::Sensor, public PollingComponent {
  public:
   void set_dout_pin(GPIOPin *dout_pin) { dout_pin_ = dout_pin; }
   void set_sck_pin(GPIOPin *sck_pin) { sck_pin_ = sck_pin; }
   void set_gain(HX711Gain gain) { gain_ = gain; }
+  /// Read every conversion when DOUT signals data ready and publish the mean of each update interval.
+  void set_use_interrupt(bool use_interrupt) { use_interrupt_ = use_interrupt; }
 
   void setup() override;
   void dump_config() override;
@@ -30,6 +46,8 @@ class HX711Sensor : public sensor::Sensor, public PollingComponent {
   GPIOPin *dout_pin_;
   GPIOPin *sck_pin_;
   HX711Gain gain_{HX711_GAIN_128};
+  bool use_interrupt_{false};
+  HX711SensorStore store_{};
 };
 
 }  // namespace hx711
@@ -16,6 +16,7 @@ hx711_ns = cg.esphome_ns.namespace("hx711")
 HX711Sensor = hx711_ns.class_("HX711Sensor", sensor.Sensor, cg.PollingComponent)
 
 CONF_DOUT_PIN = "dout_pin"
+CONF_USE_INTERRUPT = "use_interrupt"
 
 HX711Gain = hx711_ns.enum("HX711Gain")
 GAINS = {
@@ -24,7 +25,18 @@ GAINS = {
     64: HX711Gain.HX711_GAIN_64,
 }
 
-CONFIG_SCHEMA = (
+
+def validate_interrupt_pins(config):
+    if not config[CONF_USE_INTERRUPT]:
+        return config
+    for key in (CONF_DOUT_PIN, CONF_CLK_PIN):
+        if any(platform in config[key] for platform in pins.PIN_SCHEMA_REGISTRY):
+            raise cv.Invalid("use_interrupt requires internal GPIO pins", path=[key])
+    pins.validate_has_interrupt(config[CONF_DOUT_PIN])
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
     sensor.sensor_schema(
         UNIT_EMPTY, ICON_SCALE, 0, DEVICE_CLASS_EMPTY, STATE_CLASS_MEASUREMENT
     )
@@ -34,9 +46,11 @@ CONFIG_SCHEMA = (
             cv.Required(CONF_DOUT_PIN): pins.gpio_input_pin_schema,
             cv.Required(CONF_CLK_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_GAIN, default=128): cv.enum(GAINS, int=True),
+            cv.Optional(CONF_USE_INTERRUPT, default=False): cv.boolean,
         }
     )
-    .extend(cv.polling_component_schema("60s"))
+    .extend(cv.polling_component_schema("60s")),
+    validate_interrupt_pins,
 )
 
 
@@ -50,3 +64,4 @@ async def to_code(config):
     sck_pin = await cg.gpio_pin_expression(config[CONF_CLK_PIN])
     cg.add(var.set_sck_pin(sck_pin))
     cg.add(var.set_gain(config[CONF_GAIN]))
+    cg.add(var.set_use_interrupt(config[CONF_USE_INTERRUPT]))
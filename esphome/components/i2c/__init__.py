@@ -12,7 +12,7 @@ from esphome.const import (
     CONF_I2C_ID,
     CONF_MULTIPLEXER,
 )
-from esphome.core import coroutine_with_priority
+from esphome.core import CORE, coroutine_with_priority
 
 CODEOWNERS = ["@esphome/core"]
 i2c_ns = cg.esphome_ns.namespace("i2c")
@@ -83,7 +83,14 @@ async def register_i2c_device(var, config):
     cg.add(var.set_i2c_parent(parent))
     cg.add(var.set_i2c_address(config[CONF_ADDRESS]))
     if CONF_MULTIPLEXER in config:
-        multiplexer = await cg.get_variable(config[CONF_MULTIPLEXER][CONF_ID])
-        cg.add(
-            var.set_i2c_multiplexer(multiplexer, config[CONF_MULTIPLEXER][CONF_CHANNEL])
-        )
+        mux_config = config[CONF_MULTIPLEXER]
+        multiplexer = await cg.get_variable(mux_config[CONF_ID])
+        cg.add(var.set_i2c_multiplexer(multiplexer, mux_config[CONF_CHANNEL]))
+        if CONF_ID in config and config[CONF_ID].type.inherits_from(
+            cg.PollingComponent
+        ):
+            # Poll all devices behind one channel back to back
+            groups = CORE.data.setdefault("scheduler_phase_groups", {})
+            key = ("i2c", mux_config[CONF_ID].id, mux_config[CONF_CHANNEL])
+            group = groups.setdefault(key, len(groups) + 1)
+            cg.add(cg.App.scheduler.set_phase_group(var, group))
@@ -18,6 +18,9 @@ I2CComponent::I2CComponent() {
 #else
   this->wire_ = &Wire;
 #endif
+#ifdef USE_I2C_STATS
+  global_i2c_buses.push_back(this);
+#endif
 }
 
 void I2CComponent::setup() {
@@ -54,11 +57,25 @@ float I2CComponent::get_setup_priority() const { return setup_priority::BUS; }
 
 void I2CComponent::raw_begin_transmission(uint8_t address) {
   ESP_LOGVV(TAG, "Beginning Transmission to 0x%02X:", address);
+#ifdef USE_I2C_STATS
+  this->transmission_start_us_ = micros();
+  this->transmission_bytes_ = 0;
+#endif
   this->wire_->beginTransmission(address);
 }
 bool I2CComponent::raw_end_transmission(uint8_t address, bool send_stop) {
   uint8_t status = this->wire_->endTransmission(send_stop);
   ESP_LOGVV(TAG, "    Transmission ended. Status code: 0x%02X", status);
+#ifdef USE_I2C_STATS
+  this->record_(address, this->transmission_start_us_, this->transmission_bytes_);
+  if (status == 2 || status == 3) {
+    this->bus_stats_.nacks++;
+    this->address_stats_(address).nacks++;
+  } else if (status != 0) {
+    this->bus_stats_.errors++;
+    this->address_stats_(address).errors++;
+  }
+#endif
 
   switch (status) {
     case 0:
@@ -81,7 +98,18 @@ bool I2CComponent::raw_end_transmission(uint8_t address, bool send_stop) {
 }
 bool I2CComponent::raw_request_from(uint8_t address, uint8_t len) {
   ESP_LOGVV(TAG, "Requesting %u bytes from 0x%02X:", len, address);
+#ifdef USE_I2C_STATS
+  const uint32_t start = micros();
+#endif
   uint8_t ret = this->wire_->requestFrom(address, len);
+#ifdef USE_I2C_STATS
+  this->record_(address, start, ret);
+  if (ret != len) {
+    // The Wire API can't tell a NACK of the address from a timeout here
+    this->bus_stats_.errors++;
+    this->address_stats_(address).errors++;
+  }
+#endif
   if (ret != len) {
     ESP_LOGW(TAG, "Requesting %u bytes from 0x%02X failed!", len, address);
     return false;
@@ -94,6 +122,9 @@ void HOT I2CComponent::raw_write(uint8_t address, const uint8_t *data, uint8_t l
     this->wire_->write(data[i]);
     App.feed_wdt();
   }
+#ifdef USE_I2C_STATS
+  this->transmission_bytes_ += len;
+#endif
 }
 void HOT I2CComponent::raw_write_16(uint8_t address, const uint16_t *data, uint8_t len) {
   for (size_t i = 0; i < len; i++) {
@@ -103,6 +134,9 @@ void HOT I2CComponent::raw_write_16(uint8_t address, const uint16_t *data, uint8
     this->wire_->write(data[i]);
     App.feed_wdt();
   }
+#ifdef USE_I2C_STATS
+  this->transmission_bytes_ += len * 2;
+#endif
 }
 
 bool I2CComponent::raw_receive(uint8_t address, uint8_t *data, uint8_t len) {
@@ -177,6 +211,121 @@ bool I2CComponent::write_byte_16(uint8_t address, uint8_t a_register, uint16_t d
   return this->write_bytes_16(address, a_register, &data, 1);
 }
 
+void I2CComponent::queue_transaction(I2CTransaction &&transaction) {
+  transaction.resume_at_ = millis();
+  this->transactions_.push_back(std::move(transaction));
+  this->enable_loop();
+}
+void I2CComponent::loop() {
+  const uint32_t now = millis();
+  for (size_t i = 0; i < this->transactions_.size();) {
+    I2CTransaction &transaction = this->transactions_[i];
+    if (int32_t(now - transaction.resume_at_) < 0) {
+      i++;
+      continue;
+    }
+    bool success = this->run_transaction_(transaction);
+    if (success && transaction.next_step_ < transaction.steps_.size()) {
+      // Waiting
+      i++;
+      continue;
+    }
+    // The callback may queue the next transaction, so take this one out first
+    I2CTransaction done = std::move(transaction);
+    this->transactions_.erase(this->transactions_.begin() + i);
+    if (done.callback_)
+      done.callback_(success, done.result_);
+  }
+  if (this->transactions_.empty())
+    this->disable_loop();
+}
+bool I2CComponent::run_transaction_(I2CTransaction &transaction) {
+  while (transaction.next_step_ < transaction.steps_.size()) {
+    I2CTransaction::Step &step = transaction.steps_[transaction.next_step_++];
+    switch (step.type) {
+      case I2CTransaction::Step::WRITE:
+        if (!transaction.device_->write_bytes_raw(step.data))
+          return false;
+        break;
+      case I2CTransaction::Step::READ: {
+        const size_t offset = transaction.result_.size();
+        transaction.result_.resize(offset + step.value);
+        if (!transaction.device_->read_bytes_raw(transaction.result_.data() + offset, step.value))
+          return false;
+        break;
+      }
+      case I2CTransaction::Step::WAIT:
+        transaction.resume_at_ = millis() + step.value;
+        return true;
+    }
+  }
+  return true;
+}
+
+I2CTransaction &I2CTransaction::write(std::vector<uint8_t> data) {
+  this->steps_.push_back(Step{Step::WRITE, 0, std::move(data)});
+  return *this;
+}
+I2CTransaction &I2CTransaction::read(uint8_t len) {
+  this->steps_.push_back(Step{Step::READ, len, {}});
+  return *this;
+}
+I2CTransaction &I2CTransaction::wait(uint32_t ms) {
+  this->steps_.push_back(Step{Step::WAIT, ms, {}});
+  return *this;
+}
+I2CTransaction &I2CTransaction::then(callback_t &&callback) {
+  this->callback_ = std::move(callback);
+  return *this;
+}
+
+#ifdef USE_I2C_STATS
+std::vector<I2CComponent *> global_i2c_buses;  // NOLINT
+
+void I2CStats::record(uint32_t duration_us, uint32_t bytes) {
+  this->transactions++;
+  this->bytes += bytes;
+  this->busy_us += duration_us;
+  this->max_us = std::max(this->max_us, duration_us);
+}
+void I2CStats::reset() { *this = I2CStats(); }
+
+I2CStats &I2CComponent::address_stats_(uint8_t address) {
+  for (auto &entry : this->address_stats_list_) {
+    if (entry.address == address)
+      return entry.stats;
+  }
+  this->address_stats_list_.push_back(AddressStats{address, {}});
+  return this->address_stats_list_.back().stats;
+}
+void I2CComponent::record_(uint8_t address, uint32_t start_us, uint32_t bytes) {
+  const uint32_t duration = micros() - start_us;
+  this->bus_stats_.record(duration, bytes);
+  this->address_stats_(address).record(duration, bytes);
+}
+void I2CComponent::dump_stats() {
+  const uint32_t now = millis();
+  const uint32_t elapsed_ms = now - this->stats_since_;
+  this->stats_since_ = now;
+  const I2CStats &bus = this->bus_stats_;
+  // busy_us / (elapsed_ms * 1000) * 100
+  const float busy = elapsed_ms == 0 ? 0.0f : bus.busy_us / (elapsed_ms * 10.0f);
+  ESP_LOGI(TAG, "I2C bus SDA=GPIO%u SCL=GPIO%u (since last report):", this->sda_pin_, this->scl_pin_);
+  ESP_LOGI(TAG, "  busy=%.1f%% transactions=%u bytes=%u nacks=%u errors=%u max=%.2fms", busy, bus.transactions,
+           bus.bytes, bus.nacks, bus.errors, bus.max_us / 1000.0f);
+  for (auto &entry : this->address_stats_list_) {
+    const I2CStats &stats = entry.stats;
+    if (stats.transactions == 0)
+      continue;
+    ESP_LOGI(TAG, "  0x%02X: transactions=%u bytes=%u nacks=%u errors=%u busy=%.2fms max=%.2fms", entry.address,
+             stats.transactions, stats.bytes, stats.nacks, stats.errors, stats.busy_us / 1000.0f,
+             stats.max_us / 1000.0f);
+    entry.stats.reset();
+  }
+  this->bus_stats_.reset();
+}
+#endif
+
 void I2CDevice::set_i2c_address(uint8_t address) { this->address_ = address; }
 #ifdef USE_I2C_MULTIPLEXER
 void I2CDevice::set_i2c_multiplexer(I2CMultiplexer *multiplexer, uint8_t channel) {
@@ -185,6 +334,13 @@ void I2CDevice::set_i2c_multiplexer(I2CMultiplexer *multiplexer, uint8_t channel
   this->channel_ = channel;
 }
 
+void I2CMultiplexer::set_channel(uint8_t channelno) {
+  if (this->active_channel_ == channelno)
+    return;
+  // Only remember channels that were really switched to, a failed write is retried next time
+  this->active_channel_ = this->write_channel_(channelno) ? channelno : NO_CHANNEL;
+}
+
 void I2CDevice::check_multiplexer_() {
   if (this->multiplexer_ != nullptr) {
     ESP_LOGVV(TAG, "Multiplexer setting channel to %d", this->channel_);
@@ -4,12 +4,85 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include <functional>
+#include <vector>
 
 namespace esphome {
 namespace i2c {
 
 #define LOG_I2C_DEVICE(this) ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
 
+/// The most bytes one write transmission can hold, the register included, limited by the buffer of the Wire library.
+#if defined(I2C_BUFFER_LENGTH)
+static const size_t I2C_MAX_WRITE_LENGTH = I2C_BUFFER_LENGTH;
+#elif defined(BUFFER_LENGTH)
+static const size_t I2C_MAX_WRITE_LENGTH = BUFFER_LENGTH;
+#else
+static const size_t I2C_MAX_WRITE_LENGTH = 32;
+#endif
+
+class I2CComponent;
+class I2CDevice;
+
+#ifdef USE_I2C_STATS
+/// Bus traffic counters since the last report, see I2CComponent::dump_stats().
+struct I2CStats {
+  void record(uint32_t duration_us, uint32_t bytes);
+  void reset();
+
+  /// Completed writes (begin to end transmission) and reads (one request).
+  uint32_t transactions{0};
+  uint32_t bytes{0};
+  uint32_t nacks{0};
+  /// Timeouts, short reads and other bus errors.
+  uint32_t errors{0};
+  uint64_t busy_us{0};
+  uint32_t max_us{0};
+};
+
+/// All I2C buses, so the debug component can report their statistics.
+extern std::vector<I2CComponent *> global_i2c_buses;  // NOLINT
+#endif
+
+/** A list of bus operations for one device, run by I2CComponent::loop() without blocking the main loop.
+ *
+ * Build one with I2CDevice::transaction() and hand it to I2CDevice::queue_transaction(). Each write and read is
+ * a complete bus transfer, and wait() steps let the device convert while the rest of the firmware keeps running.
+ * Transactions of different devices interleave at their waits.
+ */
+class I2CTransaction {
+ public:
+  using callback_t = std::function<void(bool success, const std::vector<uint8_t> &data)>;
+
+  explicit I2CTransaction(I2CDevice *device) : device_(device) {}
+
+  /// Write bytes (the register, if the device has any, included).
+  I2CTransaction &write(std::vector<uint8_t> data);
+  /// Read `len` bytes, they are appended to the data passed to the callback.
+  I2CTransaction &read(uint8_t len);
+  /// Wait `ms` milliseconds before the next step.
+  I2CTransaction &wait(uint32_t ms);
+  /// Called once all steps are done or one failed, with the bytes of all reads.
+  I2CTransaction &then(callback_t &&callback);
+
+ protected:
+  friend I2CComponent;
+
+  struct Step {
+    enum Type : uint8_t { WRITE, READ, WAIT } type;
+    /// Bytes to read or milliseconds to wait.
+    uint32_t value;
+    std::vector<uint8_t> data;
+  };
+
+  I2CDevice *device_;
+  std::vector<Step> steps_;
+  callback_t callback_;
+  size_t next_step_{0};
+  uint32_t resume_at_{0};
+  std::vector<uint8_t> result_;
+};
+
 /** The I2CComponent is the base of ESPHome's i2c communication.
  *
  * It handles setting up the bus (with pins, clock frequency) and provides nice helper functions to
@@ -89,6 +162,14 @@ class I2CComponent : public Component {
   /// Write a single 16-bit word of data into the specified register of address. Return true if successful.
   bool write_byte_16(uint8_t address, uint8_t a_register, uint16_t data);
 
+  /// Queue a transaction, see I2CDevice::queue_transaction().
+  void queue_transaction(I2CTransaction &&transaction);
+
+#ifdef USE_I2C_STATS
+  /// Log the traffic of the bus and of each address on it, and reset the statistics.
+  void dump_stats();
+#endif
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Begin a write transmission to an address.
@@ -120,10 +201,30 @@ class I2CComponent : public Component {
   /// Setup the i2c. bus
   void setup() override;
   void dump_config() override;
+  /// Run queued transactions, disabled while there are none.
+  void loop() override;
   /// Set a very high setup priority to make sure it's loaded before all other hardware.
   float get_setup_priority() const override;
 
  protected:
+  /// Run steps until the next wait, returns false if a step failed.
+  bool run_transaction_(I2CTransaction &transaction);
+
+  std::vector<I2CTransaction> transactions_;
+#ifdef USE_I2C_STATS
+  struct AddressStats {
+    uint8_t address;
+    I2CStats stats;
+  };
+  I2CStats &address_stats_(uint8_t address);
+  void record_(uint8_t address, uint32_t start_us, uint32_t bytes);
+
+  I2CStats bus_stats_;
+  std::vector<AddressStats> address_stats_list_;
+  uint32_t transmission_start_us_{0};
+  uint32_t transmission_bytes_{0};
+  uint32_t stats_since_{0};
+#endif
   TwoWire *wire_;
   uint8_t sda_pin_;
   uint8_t scl_pin_;
@@ -279,6 +380,11 @@ class I2CDevice {
   /// Write a single 16-bit word of data into the specified register. Return true if successful.
   bool write_byte_16(uint8_t a_register, uint16_t data);
 
+  /// Start building a non-blocking transaction for this device.
+  I2CTransaction transaction() { return I2CTransaction(this); }
+  /// Run a transaction from the bus' loop(), its callback is called from there too.
+  void queue_transaction(I2CTransaction &&transaction) { this->parent_->queue_transaction(std::move(transaction)); }
+
  protected:
   // Checks for multiplexer set and set channel
   void check_multiplexer_();
@@ -292,7 +398,18 @@ class I2CDevice {
 class I2CMultiplexer : public I2CDevice {
  public:
   I2CMultiplexer() = default;
-  virtual void set_channel(uint8_t channelno);
+  /// Switch to a channel, the multiplexer is only written to if another channel is active.
+  void set_channel(uint8_t channelno);
+  /// Forget which channel is active, so that the next set_channel() writes it again.
+  void invalidate_channel() { this->active_channel_ = NO_CHANNEL; }
+
+ protected:
+  static const uint8_t NO_CHANNEL = 0xFF;
+
+  /// Write the channel to the hardware, return true if successful.
+  virtual bool write_channel_(uint8_t channelno) = 0;
+
+  uint8_t active_channel_{NO_CHANNEL};
 };
 }  // namespace i2c
 }  // namespace esphome
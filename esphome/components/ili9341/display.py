@@ -1,7 +1,7 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
-from esphome.components import display, spi
+from esphome.components import color, display, spi
 from esphome.const import (
     CONF_DC_PIN,
     CONF_ID,
@@ -14,6 +14,8 @@ from esphome.const import (
 DEPENDENCIES = ["spi"]
 
 CONF_LED_PIN = "led_pin"
+CONF_BUFFER_FORMAT = "buffer_format"
+CONF_PALETTE = "palette"
 
 ili9341_ns = cg.esphome_ns.namespace("ili9341")
 ili9341 = ili9341_ns.class_(
@@ -31,6 +33,23 @@ MODELS = {
 
 ILI9341_MODEL = cv.enum(MODELS, upper=True, space="_")
 
+ILI9341BufferFormat = ili9341_ns.enum("ILI9341BufferFormat")
+BUFFER_FORMATS = {
+    "RGB332": ILI9341BufferFormat.BUFFER_FORMAT_RGB332,
+    "RGB565": ILI9341BufferFormat.BUFFER_FORMAT_RGB565,
+    "INDEXED8": ILI9341BufferFormat.BUFFER_FORMAT_INDEXED8,
+}
+
+
+def validate_palette(config):
+    has_palette = CONF_PALETTE in config
+    if config[CONF_BUFFER_FORMAT] == "INDEXED8" and not has_palette:
+        raise cv.Invalid("The INDEXED8 buffer format requires a palette")
+    if config[CONF_BUFFER_FORMAT] != "INDEXED8" and has_palette:
+        raise cv.Invalid("A palette can only be used with the INDEXED8 buffer format")
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     display.FULL_DISPLAY_SCHEMA.extend(
         {
@@ -39,11 +58,18 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_DC_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_RESET_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_LED_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_BUFFER_FORMAT, default="RGB332"): cv.enum(
+                BUFFER_FORMATS, upper=True
+            ),
+            cv.Optional(CONF_PALETTE): cv.All(
+                cv.ensure_list(cv.use_id(color.ColorStruct)), cv.Length(min=1, max=256)
+            ),
         }
     )
     .extend(cv.polling_component_schema("1s"))
     .extend(spi.spi_device_schema()),
     cv.has_at_most_one_key(CONF_PAGES, CONF_LAMBDA),
+    validate_palette,
 )
 
 
@@ -59,6 +85,10 @@ async def to_code(config):
     await display.register_display(var, config)
     await spi.register_spi_device(var, config)
     cg.add(var.set_model(config[CONF_MODEL]))
+    cg.add(var.set_buffer_format(config[CONF_BUFFER_FORMAT]))
+    for color_id in config.get(CONF_PALETTE, []):
+        palette_color = await cg.get_variable(color_id)
+        cg.add(var.add_palette_color(palette_color))
     dc = await cg.gpio_pin_expression(config[CONF_DC_PIN])
     cg.add(var.set_dc_pin(dc))
 
@@ -2,6 +2,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
+#include <algorithm>
 
 namespace esphome {
 namespace ili9341 {
@@ -9,6 +10,19 @@ namespace ili9341 {
 static const char *const TAG = "ili9341";
 
 void ILI9341Display::setup_pins_() {
+  if (this->buffer_format_ != BUFFER_FORMAT_RGB565) {
+    this->lut_.resize(256);
+    for (size_t i = 0; i < 256; i++) {
+      if (this->buffer_format_ == BUFFER_FORMAT_RGB332) {
+        this->lut_[i] = this->convert_to_16bit_color_(i);
+      } else if (i < this->palette_.size()) {
+        this->lut_[i] = display::ColorUtil::color_to_565(this->palette_[i]);
+      }
+    }
+    if (this->palette_.empty())
+      this->palette_.push_back(COLOR_BLACK);
+    this->last_palette_color_ = this->palette_[0];
+  }
   this->init_internal_(this->get_buffer_length_());
   this->dc_pin_->setup();  // OUTPUT
   this->dc_pin_->digital_write(false);
@@ -28,6 +42,8 @@ void ILI9341Display::setup_pins_() {
 void ILI9341Display::dump_config() {
   LOG_DISPLAY("", "ili9341", this);
   ESP_LOGCONFIG(TAG, "  Width: %d, Height: %d,  Rotation: %d", this->width_, this->height_, this->rotation_);
+  static const char *const BUFFER_FORMATS[] = {"RGB332", "RGB565", "INDEXED8"};
+  ESP_LOGCONFIG(TAG, "  Buffer Format: %s", BUFFER_FORMATS[this->buffer_format_]);
   LOG_PIN("  Reset Pin: ", this->reset_pin_);
   LOG_PIN("  DC Pin: ", this->dc_pin_);
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
@@ -79,34 +95,63 @@ uint8_t ILI9341Display::read_command(uint8_t command_byte, uint8_t index) {
 }
 
 void ILI9341Display::update() {
+  // The RGB565 buffer is sent straight from memory, the last rows may still be on their way out
+  this->wait_async();
   this->do_update_();
   this->display_();
 }
 
 void ILI9341Display::display_() {
+  if (!this->is_dirty_())
+    return;
+
   // we will only update the changed window to the display
-  int w = this->x_high_ - this->x_low_ + 1;
-  int h = this->y_high_ - this->y_low_ + 1;
+  int w = this->dirty_x_high_ - this->dirty_x_low_ + 1;
+  int h = this->dirty_y_high_ - this->dirty_y_low_ + 1;
 
-  set_addr_window_(this->x_low_, this->y_low_, w, h);
+  set_addr_window_(this->dirty_x_low_, this->dirty_y_low_, w, h);
   this->start_data_();
-  uint32_t start_pos = ((this->y_low_ * this->width_) + x_low_);
-  for (uint16_t row = 0; row < h; row++) {
-    for (uint16_t col = 0; col < w; col++) {
-      uint32_t pos = start_pos + (row * width_) + col;
-
-      uint16_t color = convert_to_16bit_color_(buffer_[pos]);
-      this->write_byte(color >> 8);
-      this->write_byte(color);
+  const size_t stride = size_t(this->width_) * this->bytes_per_pixel_();
+  const uint8_t *row = this->buffer_ + this->dirty_y_low_ * stride + this->dirty_x_low_ * this->bytes_per_pixel_();
+  if (this->buffer_format_ == BUFFER_FORMAT_RGB565) {
+    if (w == this->width_) {
+      // Full rows are contiguous in the buffer
+      this->write_array_async(row, stride * h);
+    } else {
+      for (int y = 0; y < h; y++, row += stride)
+        this->write_array_async(row, w * 2);
     }
+    this->end_data_();
+    this->clear_dirty_();
+    return;
   }
-  this->end_data_();
 
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  uint8_t active = 0;
+  size_t filled = 0;
+  for (int y = 0; y < h; y++, row += stride) {
+    const uint8_t *src = row;
+    size_t remaining = w;
+    while (remaining != 0) {
+      const size_t count = std::min(remaining, (ILI9341_TRANSFER_BUFFER_SIZE - filled) / 2);
+      display::ColorUtil::indexed_to_565_be(src, this->transfer_buffer_[active] + filled, count, this->lut_.data());
+      src += count;
+      remaining -= count;
+      filled += count * 2;
+      if (filled == ILI9341_TRANSFER_BUFFER_SIZE) {
+        // The other buffer is done after this, convert the next pixels into it while this one is sent
+        this->wait_async();
+        this->write_array_async(this->transfer_buffer_[active], filled);
+        active ^= 1;
+        filled = 0;
+      }
+    }
+  }
+  if (filled != 0) {
+    this->wait_async();
+    this->write_array_async(this->transfer_buffer_[active], filled);
+  }
+  this->end_data_();
+  this->clear_dirty_();
 }
 
 uint16_t ILI9341Display::convert_to_16bit_color_(uint8_t color_8bit) {
@@ -129,24 +174,93 @@ uint8_t ILI9341Display::convert_to_8bit_color_(uint16_t color_16bit) {
   return ((b / 0x0A) | ((g / 0x09) << 2) | ((r / 0x04) << 5));
 }
 
-void ILI9341Display::fill(Color color) {
-  auto color565 = display::ColorUtil::color_to_565(color);
-  memset(this->buffer_, convert_to_8bit_color_(color565), this->get_buffer_length_());
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+uint16_t ILI9341Display::encode_color_(Color color) {
+  switch (this->buffer_format_) {
+    case BUFFER_FORMAT_RGB565:
+      return display::ColorUtil::color_to_565(color);
+    case BUFFER_FORMAT_INDEXED8:
+      return this->nearest_palette_index_(color);
+    case BUFFER_FORMAT_RGB332:
+    default:
+      return convert_to_8bit_color_(display::ColorUtil::color_to_565(color));
+  }
+}
+
+uint8_t ILI9341Display::nearest_palette_index_(Color color) {
+  // Drawing usually repeats one color for many pixels in a row
+  if (color.raw_32 == this->last_palette_color_.raw_32)
+    return this->last_palette_index_;
+
+  uint8_t best = 0;
+  uint32_t best_distance = UINT32_MAX;
+  for (size_t i = 0; i < this->palette_.size(); i++) {
+    const Color &entry = this->palette_[i];
+    const int32_t dr = int32_t(color.red) - entry.red;
+    const int32_t dg = int32_t(color.green) - entry.green;
+    const int32_t db = int32_t(color.blue) - entry.blue;
+    const uint32_t distance = dr * dr + dg * dg + db * db;
+    if (distance < best_distance) {
+      best = i;
+      best_distance = distance;
+    }
+  }
+  this->last_palette_color_ = color;
+  this->last_palette_index_ = best;
+  return best;
+}
+
+void HOT ILI9341Display::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const uint16_t value = this->encode_color_(color);
+  // do_update_() clears the screen every time, only what was drawn before becomes dirty
+  for (int j = y; j < y + height; j++) {
+    int first = -1;
+    int last = -1;
+    if (this->buffer_format_ == BUFFER_FORMAT_RGB565) {
+      uint8_t *pixel = this->buffer_ + (j * this->width_ + x) * 2;
+      for (int i = x; i < x + width; i++, pixel += 2) {
+        if (pixel[0] != (value >> 8) || pixel[1] != (value & 0xFF)) {
+          pixel[0] = value >> 8;
+          pixel[1] = value;
+          if (first < 0)
+            first = i;
+          last = i;
+        }
+      }
+    } else {
+      uint8_t *pixel = this->buffer_ + j * this->width_ + x;
+      for (int i = x; i < x + width; i++, pixel++) {
+        if (*pixel != value) {
+          *pixel = value;
+          if (first < 0)
+            first = i;
+          last = i;
+        }
+      }
+    }
+    if (first >= 0) {
+      this->mark_dirty_(first, j);
+      this->mark_dirty_(last, j);
+    }
+  }
 }
 
 void ILI9341Display::fill_internal_(Color color) {
   this->set_addr_window_(0, 0, this->get_width_internal(), this->get_height_internal());
   this->start_data_();
 
-  auto color565 = display::ColorUtil::color_to_565(color);
-  for (uint32_t i = 0; i < (this->get_width_internal()) * (this->get_height_internal()); i++) {
+  // Keep the buffer identical to the screen, the dirty tracking relies on it
+  const uint16_t value = this->encode_color_(color);
+  const uint16_t color565 = this->buffer_format_ == BUFFER_FORMAT_RGB565 ? value : this->lut_[value];
+  const uint32_t pixels = this->get_width_internal() * this->get_height_internal();
+  for (uint32_t i = 0; i < pixels; i++) {
     this->write_byte(color565 >> 8);
     this->write_byte(color565);
-    buffer_[i] = 0;
+    if (this->buffer_format_ == BUFFER_FORMAT_RGB565) {
+      buffer_[i * 2] = value >> 8;
+      buffer_[i * 2 + 1] = value;
+    } else {
+      buffer_[i] = value;
+    }
   }
   this->end_data_();
 }
@@ -155,28 +269,36 @@ void HOT ILI9341Display::draw_absolute_pixel_internal(int x, int y, Color color)
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
-  // low and high watermark may speed up drawing from buffer
-  this->x_low_ = (x < this->x_low_) ? x : this->x_low_;
-  this->y_low_ = (y < this->y_low_) ? y : this->y_low_;
-  this->x_high_ = (x > this->x_high_) ? x : this->x_high_;
-  this->y_high_ = (y > this->y_high_) ? y : this->y_high_;
-
   uint32_t pos = (y * width_) + x;
-  auto color565 = display::ColorUtil::color_to_565(color);
-  buffer_[pos] = convert_to_8bit_color_(color565);
+  const uint16_t value = this->encode_color_(color);
+  if (this->buffer_format_ == BUFFER_FORMAT_RGB565) {
+    pos *= 2;
+    if (buffer_[pos] == (value >> 8) && buffer_[pos + 1] == (value & 0xFF))
+      return;
+    buffer_[pos] = value >> 8;
+    buffer_[pos + 1] = value;
+  } else {
+    if (buffer_[pos] == value)
+      return;
+    buffer_[pos] = value;
+  }
+  this->mark_dirty_(x, y);
 }
 
-// should return the total size: return this->get_width_internal() * this->get_height_internal() * 2 // 16bit color
-// values per bit is huge
-uint32_t ILI9341Display::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal(); }
+uint32_t ILI9341Display::get_buffer_length_() {
+  return this->get_width_internal() * this->get_height_internal() * this->bytes_per_pixel_();
+}
 
 void ILI9341Display::start_command_() {
+  // Queued pixel data must be out before D/C changes
+  this->wait_async();
   this->dc_pin_->digital_write(false);
   this->enable();
 }
 
 void ILI9341Display::end_command_() { this->disable(); }
 void ILI9341Display::start_data_() {
+  this->wait_async();
   this->dc_pin_->digital_write(true);
   this->enable();
 }
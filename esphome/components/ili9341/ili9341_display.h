@@ -9,11 +9,24 @@
 namespace esphome {
 namespace ili9341 {
 
+/// Size of each of the two buffers display_() converts pixels into for the SPI transfer.
+static const size_t ILI9341_TRANSFER_BUFFER_SIZE = 512;
+
 enum ILI9341Model {
   M5STACK = 0,
   TFT_24,
 };
 
+/// How the framebuffer stores a pixel.
+enum ILI9341BufferFormat {
+  /// One byte of 3-3-2 bit color, converted to RGB565 while sending.
+  BUFFER_FORMAT_RGB332 = 0,
+  /// Two bytes in the byte order of the panel, sent without conversion.
+  BUFFER_FORMAT_RGB565,
+  /// One byte indexing the palette, drawn colors are matched to the nearest palette color.
+  BUFFER_FORMAT_INDEXED8,
+};
+
 class ILI9341Display : public PollingComponent,
                        public display::DisplayBuffer,
                        public spi::SPIDevice<spi::BIT_ORDER_MSB_FIRST, spi::CLOCK_POLARITY_LOW,
@@ -24,6 +37,8 @@ class ILI9341Display : public PollingComponent,
   void set_reset_pin(GPIOPin *reset) { this->reset_pin_ = reset; }
   void set_led_pin(GPIOPin *led) { this->led_pin_ = led; }
   void set_model(ILI9341Model model) { this->model_ = model; }
+  void set_buffer_format(ILI9341BufferFormat buffer_format) { this->buffer_format_ = buffer_format; }
+  void add_palette_color(Color color) { this->palette_.push_back(color); }
 
   void command(uint8_t value);
   void data(uint8_t value);
@@ -33,8 +48,6 @@ class ILI9341Display : public PollingComponent,
 
   void update() override;
 
-  void fill(Color color) override;
-
   void dump_config() override;
   void setup() override {
     this->setup_pins_();
@@ -43,6 +56,7 @@ class ILI9341Display : public PollingComponent,
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
   void setup_pins_();
 
   void init_lcd_(const uint8_t *init_cmd);
@@ -53,14 +67,20 @@ class ILI9341Display : public PollingComponent,
   void display_();
   uint16_t convert_to_16bit_color_(uint8_t color_8bit);
   uint8_t convert_to_8bit_color_(uint16_t color_16bit);
+  /// The value of a pixel of the given color in the framebuffer.
+  uint16_t encode_color_(Color color);
+  uint8_t nearest_palette_index_(Color color);
+  size_t bytes_per_pixel_() const { return this->buffer_format_ == BUFFER_FORMAT_RGB565 ? 2 : 1; }
 
   ILI9341Model model_;
+  ILI9341BufferFormat buffer_format_{BUFFER_FORMAT_RGB332};
+  std::vector<Color> palette_;
+  /// The RGB565 color of each 8-bit pixel value, for the formats that need converting.
+  std::vector<uint16_t> lut_;
+  Color last_palette_color_;
+  uint8_t last_palette_index_{0};
   int16_t width_{320};   ///< Display width as modified by current rotation
   int16_t height_{240};  ///< Display height as modified by current rotation
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
 
   uint32_t get_buffer_length_();
   int get_width_internal() override;
@@ -75,6 +95,8 @@ class ILI9341Display : public PollingComponent,
   GPIOPin *led_pin_{nullptr};
   GPIOPin *dc_pin_;
   GPIOPin *busy_pin_{nullptr};
+  /// One buffer is sent while display_() fills the other one.
+  uint8_t transfer_buffer_[2][ILI9341_TRANSFER_BUFFER_SIZE];
 };
 
 //-----------   M5Stack display --------------
@@ -17,9 +17,10 @@ IMAGE_TYPE = {
     "BINARY": ImageType.IMAGE_TYPE_BINARY,
     "GRAYSCALE": ImageType.IMAGE_TYPE_GRAYSCALE,
     "RGB24": ImageType.IMAGE_TYPE_RGB24,
+    "RLE": ImageType.IMAGE_TYPE_RLE,
 }
 
-Image_ = display.display_ns.class_("Image")
+Image_ = display.Image
 
 CONF_RAW_DATA_ID = "raw_data_id"
 
@@ -39,6 +40,80 @@ IMAGE_SCHEMA = cv.Schema(
 CONFIG_SCHEMA = cv.All(font.validate_pillow_installed, IMAGE_SCHEMA)
 
 
+def _encode_rle_row(row):
+    # A run costs two bytes, shorter repeats are cheaper inside a literal
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(127 + len(chunk))
+            out.extend(chunk)
+
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and row[i + run] == row[i] and run < 128:
+            run += 1
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.extend([run - 1, row[i]])
+        else:
+            literal.extend(row[i : i + run])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def encode_rle(frames):
+    """Encode RGB frames of the same size as IMAGE_TYPE_RLE, see display_buffer.h.
+
+    All frames share one palette of at most 256 colors, so images with more colors
+    are quantized. Rows repeating anywhere in the data, like the static parts of an
+    animation, are stored once.
+    """
+    from PIL import Image
+
+    width, height = frames[0].size
+    strip = Image.new("RGB", (width, height * len(frames)))
+    for index, frame in enumerate(frames):
+        strip.paste(frame, (0, height * index))
+    colors = strip.getcolors(256)
+    if colors is None:
+        _LOGGER.info("Image has more than 256 colors, reducing them for RLE")
+        indexed = strip.quantize(colors=256, dither=Image.NONE)
+        rgb = indexed.getpalette()
+        count = max(indexed.getdata()) + 1
+        palette = [tuple(rgb[i * 3 : i * 3 + 3]) for i in range(count)]
+        indices = list(indexed.getdata())
+    else:
+        palette = [color for _, color in colors]
+        lookup = {color: i for i, color in enumerate(palette)}
+        indices = [lookup[pix] for pix in strip.getdata()]
+
+    data = [len(palette) - 1]
+    for r, g, b in palette:
+        color565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        data += [color565 >> 8, color565 & 0xFF]
+
+    rows = len(frames) * height
+    header_size = len(data) + rows * 4
+    offsets = []
+    encoded = {}
+    row_data = []
+    for y in range(rows):
+        row = _encode_rle_row(indices[y * width : (y + 1) * width])
+        if row not in encoded:
+            encoded[row] = header_size + len(row_data)
+            row_data.extend(row)
+        offsets.append(encoded[row])
+    for offset in offsets:
+        data += [(offset >> shift) & 0xFF for shift in (0, 8, 16, 24)]
+    return data + row_data
+
+
 async def to_code(config):
     from PIL import Image
 
@@ -83,6 +158,9 @@ async def to_code(config):
             data[pos] = pix[2]
             pos += 1
 
+    elif config[CONF_TYPE] == "RLE":
+        data = encode_rle([image.convert("RGB")])
+
     elif config[CONF_TYPE] == "BINARY":
         image = image.convert("1", dither=dither)
         width8 = ((width + 7) // 8) * 8
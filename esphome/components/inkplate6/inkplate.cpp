@@ -35,6 +35,7 @@ void Inkplate6::setup() {
   this->display_data_5_pin_->setup();
   this->display_data_6_pin_->setup();
   this->display_data_7_pin_->setup();
+  this->init_pin_lut_();
 
   this->clean();
   this->display();
@@ -77,6 +78,22 @@ void Inkplate6::initialize_() {
 
   memset(this->buffer_, 0, buffer_size);
 }
+void Inkplate6::init_pin_lut_() {
+  GPIOPin *const pins[8] = {this->display_data_0_pin_, this->display_data_1_pin_, this->display_data_2_pin_,
+                            this->display_data_3_pin_, this->display_data_4_pin_, this->display_data_5_pin_,
+                            this->display_data_6_pin_, this->display_data_7_pin_};
+  this->data_pin_mask_ = 0;
+  for (auto *pin : pins)
+    this->data_pin_mask_ |= 1 << pin->get_pin();
+  for (uint32_t value = 0; value < 256; value++) {
+    uint32_t bits = 0;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      if (value & (1 << bit))
+        bits |= 1 << pins[bit]->get_pin();
+    }
+    this->pin_lut_[value] = bits;
+  }
+}
 float Inkplate6::get_setup_priority() const { return setup_priority::PROCESSOR; }
 size_t Inkplate6::get_buffer_length_() {
   if (this->greyscale_) {
@@ -255,25 +272,21 @@ void Inkplate6::display1b_() {
     for (int i = 0; i < this->get_height_internal(); i++) {
       buffer_value = *(buffer_ptr--);
       data = LUTB[(buffer_value >> 4) & 0x0F];
-      send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-             (((data & B11100000) >> 5) << 25);
+      send = this->pin_lut_[data];
       hscan_start_(send);
       data = LUTB[buffer_value & 0x0F];
-      send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-             (((data & B11100000) >> 5) << 25) | clock;
+      send = this->pin_lut_[data] | clock;
       GPIO.out_w1ts = send;
       GPIO.out_w1tc = send;
 
       for (int j = 0, jm = (this->get_width_internal() / 8) - 1; j < jm; j++) {
         buffer_value = *(buffer_ptr--);
         data = LUTB[(buffer_value >> 4) & 0x0F];
-        send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-               (((data & B11100000) >> 5) << 25) | clock;
+        send = this->pin_lut_[data] | clock;
         GPIO.out_w1ts = send;
         GPIO.out_w1tc = send;
         data = LUTB[buffer_value & 0x0F];
-        send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-               (((data & B11100000) >> 5) << 25) | clock;
+        send = this->pin_lut_[data] | clock;
         GPIO.out_w1ts = send;
         GPIO.out_w1tc = send;
       }
@@ -290,24 +303,20 @@ void Inkplate6::display1b_() {
   for (int i = 0; i < this->get_height_internal(); i++) {
     buffer_value = *(buffer_ptr--);
     data = LUT2[(buffer_value >> 4) & 0x0F];
-    send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-           (((data & B11100000) >> 5) << 25);
+    send = this->pin_lut_[data];
     hscan_start_(send);
     data = LUT2[buffer_value & 0x0F];
-    send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-           (((data & B11100000) >> 5) << 25) | clock;
+    send = this->pin_lut_[data] | clock;
     GPIO.out_w1ts = send;
     GPIO.out_w1tc = send;
     for (int j = 0, jm = (this->get_width_internal() / 8) - 1; j < jm; j++) {
       buffer_value = *(buffer_ptr--);
       data = LUT2[(buffer_value >> 4) & 0x0F];
-      send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-             (((data & B11100000) >> 5) << 25) | clock;
+      send = this->pin_lut_[data] | clock;
       GPIO.out_w1ts = send;
       GPIO.out_w1tc = send;
       data = LUT2[buffer_value & 0x0F];
-      send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-             (((data & B11100000) >> 5) << 25) | clock;
+      send = this->pin_lut_[data] | clock;
       GPIO.out_w1ts = send;
       GPIO.out_w1tc = send;
     }
@@ -321,8 +330,7 @@ void Inkplate6::display1b_() {
   vscan_start_();
   for (int i = 0; i < this->get_height_internal(); i++) {
     data = 0b00000000;
-    send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-           (((data & B11100000) >> 5) << 25);
+    send = this->pin_lut_[data];
     hscan_start_(send);
     send |= clock;
     GPIO.out_w1ts = send;
@@ -362,14 +370,20 @@ void Inkplate6::display3b_() {
 
   uint32_t clock = (1 << this->cl_pin_->get_pin());
   for (int k = 0; k < 8; k++) {
+    // The bus words of this phase for every buffer byte, which holds two pixels. Two bytes make one bus write.
+    for (uint32_t value = 0; value < 256; value++) {
+      const uint8_t pair = (waveform3Bit[value & 0x07][k] << 2) | waveform3Bit[(value >> 4) & 0x07][k];
+      this->greyscale_lut_[0][value] = this->pin_lut_[pair << 4];
+      this->greyscale_lut_[1][value] = this->pin_lut_[pair];
+    }
+    const uint32_t *lut_high = this->greyscale_lut_[0];
+    const uint32_t *lut_low = this->greyscale_lut_[1];
     const uint8_t *buffer_ptr = &this->buffer_[this->get_buffer_length_() - 1];
     uint32_t send;
     uint8_t pix1;
     uint8_t pix2;
     uint8_t pix3;
     uint8_t pix4;
-    uint8_t pixel;
-    uint8_t pixel2;
 
     vscan_start_();
     for (int i = 0; i < this->get_height_internal(); i++) {
@@ -377,16 +391,10 @@ void Inkplate6::display3b_() {
       pix2 = (*buffer_ptr--);
       pix3 = (*buffer_ptr--);
       pix4 = (*buffer_ptr--);
-      pixel = (waveform3Bit[pix1 & 0x07][k] << 6) | (waveform3Bit[(pix1 >> 4) & 0x07][k] << 4) |
-              (waveform3Bit[pix2 & 0x07][k] << 2) | (waveform3Bit[(pix2 >> 4) & 0x07][k] << 0);
-      pixel2 = (waveform3Bit[pix3 & 0x07][k] << 6) | (waveform3Bit[(pix3 >> 4) & 0x07][k] << 4) |
-               (waveform3Bit[pix4 & 0x07][k] << 2) | (waveform3Bit[(pix4 >> 4) & 0x07][k] << 0);
 
-      send = ((pixel & B00000011) << 4) | (((pixel & B00001100) >> 2) << 18) | (((pixel & B00010000) >> 4) << 23) |
-             (((pixel & B11100000) >> 5) << 25);
+      send = lut_high[pix1] | lut_low[pix2];
       hscan_start_(send);
-      send = ((pixel2 & B00000011) << 4) | (((pixel2 & B00001100) >> 2) << 18) | (((pixel2 & B00010000) >> 4) << 23) |
-             (((pixel2 & B11100000) >> 5) << 25) | clock;
+      send = lut_high[pix3] | lut_low[pix4] | clock;
       GPIO.out_w1ts = send;
       GPIO.out_w1tc = send;
 
@@ -395,18 +403,12 @@ void Inkplate6::display3b_() {
         pix2 = (*buffer_ptr--);
         pix3 = (*buffer_ptr--);
         pix4 = (*buffer_ptr--);
-        pixel = (waveform3Bit[pix1 & 0x07][k] << 6) | (waveform3Bit[(pix1 >> 4) & 0x07][k] << 4) |
-                (waveform3Bit[pix2 & 0x07][k] << 2) | (waveform3Bit[(pix2 >> 4) & 0x07][k] << 0);
-        pixel2 = (waveform3Bit[pix3 & 0x07][k] << 6) | (waveform3Bit[(pix3 >> 4) & 0x07][k] << 4) |
-                 (waveform3Bit[pix4 & 0x07][k] << 2) | (waveform3Bit[(pix4 >> 4) & 0x07][k] << 0);
 
-        send = ((pixel & B00000011) << 4) | (((pixel & B00001100) >> 2) << 18) | (((pixel & B00010000) >> 4) << 23) |
-               (((pixel & B11100000) >> 5) << 25) | clock;
+        send = lut_high[pix1] | lut_low[pix2] | clock;
         GPIO.out_w1ts = send;
         GPIO.out_w1tc = send;
 
-        send = ((pixel2 & B00000011) << 4) | (((pixel2 & B00001100) >> 2) << 18) | (((pixel2 & B00010000) >> 4) << 23) |
-               (((pixel2 & B11100000) >> 5) << 25) | clock;
+        send = lut_high[pix3] | lut_low[pix4] | clock;
         GPIO.out_w1ts = send;
         GPIO.out_w1tc = send;
       }
@@ -456,13 +458,11 @@ bool Inkplate6::partial_update_() {
     const uint8_t *data_ptr = &this->partial_buffer_2_[(this->get_buffer_length_() * 2) - 1];
     for (int i = 0; i < this->get_height_internal(); i++) {
       data = *(data_ptr--);
-      send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-             (((data & B11100000) >> 5) << 25);
+      send = this->pin_lut_[data];
       hscan_start_(send);
       for (int j = 0, jm = (this->get_width_internal() / 4) - 1; j < jm; j++) {
         data = *(data_ptr--);
-        send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-               (((data & B11100000) >> 5) << 25) | clock;
+        send = this->pin_lut_[data] | clock;
         GPIO.out_w1ts = send;
         GPIO.out_w1tc = send;
       }
@@ -557,8 +557,7 @@ void Inkplate6::clean_fast_(uint8_t c, uint8_t rep) {
   else if (c == 3)  // Skip
     data = B11111111;
 
-  uint32_t send = ((data & B00000011) << 4) | (((data & B00001100) >> 2) << 18) | (((data & B00010000) >> 4) << 23) |
-                  (((data & B11100000) >> 5) << 25);
+  uint32_t send = this->pin_lut_[data];
   uint32_t clock = (1 << this->cl_pin_->get_pin());
 
   for (int k = 0; k < rep; k++) {
@@ -103,18 +103,10 @@ class Inkplate6 : public PollingComponent, public display::DisplayBuffer, public
 
   size_t get_buffer_length_();
 
-  int get_data_pin_mask_() {
-    int data = 0;
-    data |= (1 << this->display_data_0_pin_->get_pin());
-    data |= (1 << this->display_data_1_pin_->get_pin());
-    data |= (1 << this->display_data_2_pin_->get_pin());
-    data |= (1 << this->display_data_3_pin_->get_pin());
-    data |= (1 << this->display_data_4_pin_->get_pin());
-    data |= (1 << this->display_data_5_pin_->get_pin());
-    data |= (1 << this->display_data_6_pin_->get_pin());
-    data |= (1 << this->display_data_7_pin_->get_pin());
-    return data;
-  }
+  /// Build pin_lut_ and the data pin mask from the configured data pins.
+  void init_pin_lut_();
+
+  uint32_t get_data_pin_mask_() { return this->data_pin_mask_; }
 
   uint8_t panel_on_ = 0;
   uint8_t temperature_;
@@ -122,6 +114,12 @@ class Inkplate6 : public PollingComponent, public display::DisplayBuffer, public
   uint8_t *partial_buffer_{nullptr};
   uint8_t *partial_buffer_2_{nullptr};
 
+  /// The GPIO.out bits that put a byte on the data bus, so a row is streamed with one lookup per bus write.
+  uint32_t pin_lut_[256];
+  uint32_t data_pin_mask_{0};
+  /// Bus words of the current greyscale phase for the first and second buffer byte of a bus write.
+  uint32_t greyscale_lut_[2][256];
+
   uint32_t full_update_every_;
   uint32_t partial_updates_{0};
 
@@ -6,19 +6,24 @@ namespace json {
 
 static const char *const TAG = "json";
 
+static LargeBufferUsage json_usage("json");  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 static char *global_json_build_buffer = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 static size_t global_json_build_buffer_size = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// Mutable copy of the JSON string that parse_json() parses in place.
+static std::vector<char> global_json_parse_buffer;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 void reserve_global_json_build_buffer(size_t required_size) {
   if (global_json_build_buffer_size == 0 || global_json_build_buffer_size < required_size) {
-    delete[] global_json_build_buffer;
+    large_buffer_free(global_json_build_buffer, global_json_build_buffer_size, &json_usage);
     global_json_build_buffer_size = std::max(required_size, global_json_build_buffer_size * 2);
 
     size_t remainder = global_json_build_buffer_size % 16U;
     if (remainder != 0)
       global_json_build_buffer_size += 16 - remainder;
 
-    global_json_build_buffer = new char[global_json_build_buffer_size];
+    global_json_build_buffer =
+        static_cast<char *>(large_buffer_allocate(global_json_build_buffer_size, &json_usage));
   }
 }
 
@@ -47,6 +52,12 @@ const char *build_json(const json_build_t &f, size_t *length) {
   return global_json_build_buffer;
 }
 void parse_json(const std::string &data, const json_parse_t &f) {
+  // ArduinoJson would copy a const string into the JSON buffer anyway, copy it into a buffer that keeps its
+  // capacity instead and parse that in place
+  global_json_parse_buffer.assign(data.c_str(), data.c_str() + data.size() + 1);
+  parse_json_in_place(global_json_parse_buffer.data(), f);
+}
+void parse_json_in_place(char *data, const json_parse_t &f) {
   global_json_buffer.clear();
   JsonObject &root = global_json_buffer.parseObject(data);
 
@@ -62,6 +73,17 @@ std::string build_json(const json_build_t &f) {
   const char *c_str = build_json(f, &len);
   return std::string(c_str, len);
 }
+std::string write_json(const json_write_t &f) {
+  std::string out;
+  write_json(out, f);
+  return out;
+}
+void write_json(std::string &out, const json_write_t &f) {
+  out.clear();
+  JsonWriter writer(out);
+  f(writer);
+  writer.finish();
+}
 
 VectorJsonBuffer::String::String(VectorJsonBuffer *parent) : parent_(parent), start_(parent->size_) {}
 void VectorJsonBuffer::String::append(char c) const {
@@ -73,8 +95,8 @@ const char *VectorJsonBuffer::String::c_str() const {
   return &this->parent_->buffer_[this->start_];
 }
 void VectorJsonBuffer::clear() {
-  for (char *block : this->free_blocks_)
-    free(block);  // NOLINT
+  for (auto &block : this->free_blocks_)
+    large_buffer_free(block.first, block.second, &json_usage);
 
   this->size_ = 0;
   this->free_blocks_.clear();
@@ -113,9 +135,9 @@ void VectorJsonBuffer::reserve(size_t size) {  // NOLINT
     target_capacity *= 2;
 
   char *old_buffer = this->buffer_;
-  this->buffer_ = new char[target_capacity];
+  this->buffer_ = static_cast<char *>(large_buffer_allocate(target_capacity, &json_usage));
   if (old_buffer != nullptr && this->capacity_ != 0) {
-    this->free_blocks_.push_back(old_buffer);
+    this->free_blocks_.emplace_back(old_buffer, this->capacity_);
     memcpy(this->buffer_, old_buffer, this->capacity_);
   }
   this->capacity_ = target_capacity;
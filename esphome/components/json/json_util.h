@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/helpers.h"
+#include "json_writer.h"
 #include <ArduinoJson.h>
 
 namespace esphome {
@@ -17,9 +18,25 @@ const char *build_json(const json_build_t &f, size_t *length);
 
 std::string build_json(const json_build_t &f);
 
+/// Callback function typedef for writing JSON objects with a JsonWriter.
+using json_write_t = std::function<void(JsonWriter &)>;
+
+/// Write a JSON object with the provided function, without an intermediate JsonObject.
+std::string write_json(const json_write_t &f);
+
+/// Write a JSON object with the provided function into out, replacing its contents but reusing its capacity.
+void write_json(std::string &out, const json_write_t &f);
+
 /// Parse a JSON string and run the provided json parse function if it's valid.
 void parse_json(const std::string &data, const json_parse_t &f);
 
+/** Parse a null-terminated JSON string in place and run the provided json parse function if it's valid.
+ *
+ * data is modified, the strings of the parsed object point into it, so it has to stay valid while f runs. The
+ * JSON buffer only needs room for the objects and arrays, not for a copy of the string.
+ */
+void parse_json_in_place(char *data, const json_parse_t &f);
+
 class VectorJsonBuffer : public ArduinoJson::Internals::JsonBufferBase<VectorJsonBuffer> {
  public:
   class String {
@@ -53,7 +70,8 @@ class VectorJsonBuffer : public ArduinoJson::Internals::JsonBufferBase<VectorJso
   char *buffer_{nullptr};
   size_t size_{0};
   size_t capacity_{0};
-  std::vector<char *> free_blocks_;
+  /// The buffers outgrown since the last clear(), with their capacity.
+  std::vector<std::pair<char *, size_t>> free_blocks_;
 };
 
 extern VectorJsonBuffer global_json_buffer;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
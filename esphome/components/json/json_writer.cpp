@@ -0,0 +1,111 @@
+#include "json_writer.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace json {
+
+JsonWriter::JsonWriter(std::string &out) : out_(out) { this->out_.push_back('{'); }
+
+void JsonWriter::add(const char *key, const char *value) { this->add_(key, value, strlen(value)); }
+void JsonWriter::add(const char *key, bool value) {
+  this->key_(key);
+  this->out_.append(value ? "true" : "false");
+}
+void JsonWriter::add(const char *key, float value) {
+  this->key_(key);
+  if (!std::isfinite(value)) {
+    // JSON has no representation for NaN and infinity
+    this->out_.append("null");
+    return;
+  }
+  char buffer[24];
+  int len = snprintf(buffer, sizeof(buffer), "%.7g", value);
+  this->out_.append(buffer, len);
+}
+void JsonWriter::add_value(const char *value) { this->add_(nullptr, value, strlen(value)); }
+
+void JsonWriter::begin_object(const char *key) { this->open_(key, '{', false); }
+void JsonWriter::begin_array(const char *key) { this->open_(key, '[', true); }
+void JsonWriter::end() {
+  if (this->depth_ == 0)
+    return;
+  this->out_.push_back((this->is_array_ & (1u << this->depth_)) ? ']' : '}');
+  this->depth_--;
+}
+void JsonWriter::finish() {
+  while (this->depth_ > 0)
+    this->end();
+  this->out_.push_back('}');
+}
+
+void JsonWriter::key_(const char *key) {
+  const uint32_t bit = 1u << this->depth_;
+  if (this->has_members_ & bit)
+    this->out_.push_back(',');
+  this->has_members_ |= bit;
+  if (key == nullptr)
+    return;
+  this->out_.push_back('"');
+  this->out_.append(key);
+  this->out_.append("\":");
+}
+void JsonWriter::add_(const char *key, const char *value, size_t len) {
+  this->key_(key);
+  this->out_.push_back('"');
+  for (size_t i = 0; i < len; i++) {
+    const char c = value[i];
+    switch (c) {
+      case '"':
+        this->out_.append("\\\"");
+        break;
+      case '\\':
+        this->out_.append("\\\\");
+        break;
+      case '\n':
+        this->out_.append("\\n");
+        break;
+      case '\r':
+        this->out_.append("\\r");
+        break;
+      case '\t':
+        this->out_.append("\\t");
+        break;
+      default:
+        if (uint8_t(c) < 0x20) {
+          char buffer[8];
+          snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          this->out_.append(buffer);
+        } else {
+          this->out_.push_back(c);
+        }
+        break;
+    }
+  }
+  this->out_.push_back('"');
+}
+void JsonWriter::uint_(uint64_t value) {
+  char buffer[20];
+  char *pos = buffer + sizeof(buffer);
+  do {
+    *--pos = char('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  this->out_.append(pos, buffer + sizeof(buffer) - pos);
+}
+void JsonWriter::open_(const char *key, char c, bool array) {
+  this->key_(key);
+  this->out_.push_back(c);
+  this->depth_++;
+  const uint32_t bit = 1u << this->depth_;
+  this->has_members_ &= ~bit;
+  if (array) {
+    this->is_array_ |= bit;
+  } else {
+    this->is_array_ &= ~bit;
+  }
+}
+
+}  // namespace json
+}  // namespace esphome
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace esphome {
+namespace json {
+
+/** Streaming JSON object writer.
+ *
+ * Unlike building a JsonObject and printing it, members are serialized directly into the output string as they
+ * are added, so there's no intermediate document and no copy of the result. The writer starts with an open root
+ * object, nested objects and arrays are closed with end() and finish() closes everything that's still open.
+ *
+ * Keys are expected to be plain string literals and aren't escaped, string values are.
+ */
+class JsonWriter {
+ public:
+  explicit JsonWriter(std::string &out);
+
+  void add(const char *key, const char *value);
+  void add(const char *key, const std::string &value) { this->add_(key, value.data(), value.size()); }
+  void add(const char *key, bool value);
+  void add(const char *key, float value);
+  void add(const char *key, double value) { this->add(key, float(value)); }
+  template<typename T,
+           typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+  void add(const char *key, T value) {
+    this->key_(key);
+    if (std::is_signed<T>::value && value < 0) {
+      this->out_.push_back('-');
+      this->uint_(uint64_t(-int64_t(value)));
+    } else {
+      this->uint_(uint64_t(value));
+    }
+  }
+
+  /// Add a string element to the currently open array.
+  void add_value(const char *value);
+  void add_value(const std::string &value) { this->add_(nullptr, value.data(), value.size()); }
+
+  void begin_object(const char *key);
+  void begin_array(const char *key);
+  /// Close the innermost nested object or array.
+  void end();
+  /// Close all open objects and arrays including the root object, nothing may be added afterwards.
+  void finish();
+
+ protected:
+  void key_(const char *key);
+  void add_(const char *key, const char *value, size_t len);
+  void uint_(uint64_t value);
+  void open_(const char *key, char c, bool array);
+
+  std::string &out_;
+  /// One bit per nesting level: whether the container already has a member, and whether it's an array.
+  uint32_t has_members_{0};
+  uint32_t is_array_{0};
+  uint8_t depth_{0};
+};
+
+}  // namespace json
+}  // namespace esphome
@@ -30,8 +30,12 @@ static const uint8_t LCD_DISPLAY_FUNCTION_5X10_DOTS = 0x04;
 
 void LCDDisplay::setup() {
   this->buffer_ = new uint8_t[this->rows_ * this->columns_];
-  for (uint8_t i = 0; i < this->rows_ * this->columns_; i++)
+  this->shown_buffer_ = new uint8_t[this->rows_ * this->columns_];
+  for (uint8_t i = 0; i < this->rows_ * this->columns_; i++) {
     this->buffer_[i] = ' ';
+    // Clearing the display below fills it with spaces
+    this->shown_buffer_[i] = ' ';
+  }
 
   uint8_t display_function = 0;
 
@@ -80,26 +84,29 @@ void LCDDisplay::setup() {
 }
 
 float LCDDisplay::get_setup_priority() const { return setup_priority::PROCESSOR; }
+uint8_t LCDDisplay::get_address_(uint8_t column, uint8_t row) const {
+  // Rows 0 and 1 start at 0x00 and 0x40, rows 2 and 3 continue them after the visible columns
+  uint8_t address = column;
+  if (row & 1)
+    address += 0x40;
+  if (row >= 2)
+    address += this->columns_;
+  return address;
+}
 void HOT LCDDisplay::display() {
-  this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0);
-
-  for (uint8_t i = 0; i < this->columns_; i++)
-    this->send(this->buffer_[i], true);
-
-  if (this->rows_ >= 3) {
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ * 2 + i], true);
-  }
-
-  if (this->rows_ >= 1) {
-    this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0x40);
-
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ + i], true);
-
-    if (this->rows_ >= 4) {
-      for (uint8_t i = 0; i < this->columns_; i++)
-        this->send(this->buffer_[this->columns_ * 3 + i], true);
+  // Only rewrite the characters that changed, the address counter moves on by itself over consecutive ones
+  int16_t cursor = -1;
+  for (uint8_t row = 0; row < this->rows_; row++) {
+    for (uint8_t column = 0; column < this->columns_; column++) {
+      const uint16_t pos = row * this->columns_ + column;
+      if (this->buffer_[pos] == this->shown_buffer_[pos])
+        continue;
+      const uint8_t address = this->get_address_(column, row);
+      if (cursor != address)
+        this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | address);
+      this->send(this->buffer_[pos], true);
+      this->shown_buffer_[pos] = this->buffer_[pos];
+      cursor = address + 1;
     }
   }
 }
@@ -151,13 +158,13 @@ void LCDDisplay::clear() {
     this->buffer_[i] = ' ';
 }
 #ifdef USE_TIME
-void LCDDisplay::strftime(uint8_t column, uint8_t row, const char *format, time::ESPTime time) {
+void LCDDisplay::strftime(uint8_t column, uint8_t row, const char *format, const time::ESPTime &time) {
   char buffer[64];
   size_t ret = time.strftime(buffer, sizeof(buffer), format);
   if (ret > 0)
     this->print(column, row, buffer);
 }
-void LCDDisplay::strftime(const char *format, time::ESPTime time) { this->strftime(0, 0, format, time); }
+void LCDDisplay::strftime(const char *format, const time::ESPTime &time) { this->strftime(0, 0, format, time); }
 #endif
 
 }  // namespace lcd_base
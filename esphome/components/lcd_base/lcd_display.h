@@ -41,10 +41,10 @@ class LCDDisplay : public PollingComponent {
 
 #ifdef USE_TIME
   /// Evaluate the strftime-format and print the text at the specified column and row.
-  void strftime(uint8_t column, uint8_t row, const char *format, time::ESPTime time)
+  void strftime(uint8_t column, uint8_t row, const char *format, const time::ESPTime &time)
       __attribute__((format(strftime, 4, 0)));
   /// Evaluate the strftime-format and print the text at column=0 and row=0.
-  void strftime(const char *format, time::ESPTime time) __attribute__((format(strftime, 2, 0)));
+  void strftime(const char *format, const time::ESPTime &time) __attribute__((format(strftime, 2, 0)));
 #endif
 
  protected:
@@ -55,9 +55,14 @@ class LCDDisplay : public PollingComponent {
   void command_(uint8_t value);
   virtual void call_writer() = 0;
 
+  /// The DDRAM address of the character at column, row.
+  uint8_t get_address_(uint8_t column, uint8_t row) const;
+
   uint8_t columns_;
   uint8_t rows_;
   uint8_t *buffer_{nullptr};
+  /// The characters currently shown on the display, display() only sends the ones that differ from buffer_.
+  uint8_t *shown_buffer_{nullptr};
 };
 
 }  // namespace lcd_base
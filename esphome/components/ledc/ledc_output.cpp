@@ -4,21 +4,42 @@
 #ifdef ARDUINO_ARCH_ESP32
 
 #include <esp32-hal-ledc.h>
+#include <driver/ledc.h>
 
 namespace esphome {
 namespace ledc {
 
 static const char *const TAG = "ledc.output";
 
-void LEDCOutput::write_state(float state) {
+uint32_t LEDCOutput::duty_for_state_(float state) {
   if (this->pin_->is_inverted())
     state = 1.0f - state;
 
   this->duty_ = state;
   const uint32_t max_duty = (uint32_t(1) << this->bit_depth_) - 1;
   const float duty_rounded = roundf(state * max_duty);
-  auto duty = static_cast<uint32_t>(duty_rounded);
-  ledcWrite(this->channel_, duty);
+  return static_cast<uint32_t>(duty_rounded);
+}
+
+void LEDCOutput::write_state(float state) { ledcWrite(this->channel_, this->duty_for_state_(state)); }
+
+void LEDCOutput::write_state_fade(float state, uint32_t fade_length) {
+  static bool fade_installed = false;
+  if (!fade_installed) {
+    esp_err_t err = ledc_fade_func_install(0);
+    if (err != ESP_OK) {
+      ESP_LOGW(TAG, "Installing the LEDC fade function failed: %d", err);
+      this->write_state(state);
+      return;
+    }
+    fade_installed = true;
+  }
+
+  // The Arduino core maps channels 0-7 to the high speed group and 8-15 to the low speed group
+  const auto speed_mode = static_cast<ledc_mode_t>(this->channel_ / 8);
+  const auto channel = static_cast<ledc_channel_t>(this->channel_ % 8);
+  ledc_set_fade_with_time(speed_mode, channel, this->duty_for_state_(state), fade_length);
+  ledc_fade_start(speed_mode, channel, LEDC_FADE_NO_WAIT);
 }
 
 void LEDCOutput::setup() {
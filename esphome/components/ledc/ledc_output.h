@@ -18,6 +18,8 @@ class LEDCOutput : public output::FloatOutput, public Component {
 
   void set_channel(uint8_t channel) { this->channel_ = channel; }
   void set_frequency(float frequency) { this->frequency_ = frequency; }
+  /// Let the LEDC hardware run the fades of light transitions, instead of writing each step from the loop.
+  void set_hardware_fade(bool hardware_fade) { this->hardware_fade_ = hardware_fade; }
   /// Dynamically change frequency at runtime
   void update_frequency(float frequency) override;
 
@@ -30,12 +32,19 @@ class LEDCOutput : public output::FloatOutput, public Component {
   /// Override FloatOutput's write_state.
   void write_state(float state) override;
 
+  bool supports_fade() const override { return this->hardware_fade_; }
+  void write_state_fade(float state, uint32_t fade_length) override;
+
  protected:
+  /// Apply the pin inversion and convert the state to a duty for the current bit depth.
+  uint32_t duty_for_state_(float state);
+
   GPIOPin *pin_;
   uint8_t channel_{};
   uint8_t bit_depth_{};
   float frequency_{};
   float duty_{0.0f};
+  bool hardware_fade_{false};
 };
 
 template<typename... Ts> class SetFrequencyAction : public Action<Ts...> {
@@ -43,7 +52,7 @@ template<typename... Ts> class SetFrequencyAction : public Action<Ts...> {
   SetFrequencyAction(LEDCOutput *parent) : parent_(parent) {}
   TEMPLATABLE_VALUE(float, frequency);
 
-  void play(Ts... x) {
+  void play(const Ts &... x) {
     float freq = this->frequency_.value(x...);
     this->parent_->update_frequency(freq);
   }
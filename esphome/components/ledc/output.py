@@ -12,6 +12,8 @@ from esphome.const import (
 
 ESP_PLATFORMS = [ESP_PLATFORM_ESP32]
 
+CONF_HARDWARE_FADE = "hardware_fade"
+
 
 def calc_max_frequency(bit_depth):
     return 80e6 / (2 ** bit_depth)
@@ -49,6 +51,7 @@ CONFIG_SCHEMA = output.FLOAT_OUTPUT_SCHEMA.extend(
         cv.Required(CONF_PIN): pins.internal_gpio_output_pin_schema,
         cv.Optional(CONF_FREQUENCY, default="1kHz"): cv.frequency,
         cv.Optional(CONF_CHANNEL): cv.int_range(min=0, max=15),
+        cv.Optional(CONF_HARDWARE_FADE, default=False): cv.boolean,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -61,6 +64,8 @@ async def to_code(config):
     if CONF_CHANNEL in config:
         cg.add(var.set_channel(config[CONF_CHANNEL]))
     cg.add(var.set_frequency(config[CONF_FREQUENCY]))
+    if config[CONF_HARDWARE_FADE]:
+        cg.add(var.set_hardware_fade(True))
 
 
 @automation.register_action(
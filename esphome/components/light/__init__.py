@@ -42,6 +42,8 @@ from .types import (  # noqa
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
+CONF_FRAME_RATE = "frame_rate"
+
 LightRestoreMode = light_ns.enum("LightRestoreMode")
 RESTORE_MODES = {
     "RESTORE_DEFAULT_OFF": LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -102,6 +104,7 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend(
             [cv.percentage], cv.Length(min=3, max=4)
         ),
         cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+        cv.Optional(CONF_FRAME_RATE): cv.int_range(min=1, max=200),
     }
 )
 
@@ -145,6 +148,9 @@ async def setup_light_core_(light_var, output_var, config):
     if CONF_COLOR_CORRECT in config:
         cg.add(output_var.set_correction(*config[CONF_COLOR_CORRECT]))
 
+    if CONF_FRAME_RATE in config:
+        cg.add(output_var.set_frame_rate(config[CONF_FRAME_RATE]))
+
     if CONF_POWER_SUPPLY in config:
         var_ = await cg.get_variable(config[CONF_POWER_SUPPLY])
         cg.add(output_var.set_power_supply(var_))
@@ -156,6 +162,8 @@ async def setup_light_core_(light_var, output_var, config):
 
 async def register_light(output_var, config):
     light_var = cg.new_Pvariable(config[CONF_ID], config[CONF_NAME], output_var)
+    object_id, object_id_hash = cg.object_id_from_name(config[CONF_NAME])
+    cg.add(light_var.set_object_id(object_id, object_id_hash))
     cg.add(cg.App.register_light(light_var))
     await cg.register_component(light_var, config)
     await setup_light_core_(light_var, output_var, config)
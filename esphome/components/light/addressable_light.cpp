@@ -1,5 +1,8 @@
 #include "addressable_light.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
+#include <algorithm>
+#include <cstring>
 
 namespace esphome {
 namespace light {
@@ -24,6 +27,180 @@ void AddressableLight::call_setup() {
 #endif
 }
 
+bool AddressableLight::begin_frame() {
+  if (this->frame_rate_ == 0)
+    return true;
+
+  // Counted from the start of the loop iteration, so all lights running at this rate agree on the frame
+  const auto frame = static_cast<uint32_t>(uint64_t(App.get_loop_start_time()) * this->frame_rate_ / 1000);
+  if (frame == this->last_frame_)
+    return false;
+  const uint32_t missed = frame - this->last_frame_ - 1;
+  this->last_frame_ = frame;
+  if (this->next_show_ || !this->can_show_()) {
+    // The previous frame is still waiting to go out, another one would only be overwritten
+    this->dropped_frames_ += missed + 1;
+    return false;
+  }
+  this->dropped_frames_ += missed;
+  this->schedule_show();
+  return true;
+}
+
+void AddressableLight::fill_range(int32_t from, int32_t to, const Color &color) {
+  ESPRawPixels pixels;
+  if (!this->get_raw_pixels_(&pixels)) {
+    for (int32_t i = from; i < to; i++)
+      this->get_view_internal(i) = color;
+    return;
+  }
+  if (to <= from)
+    return;
+
+  uint8_t led[4];
+  const uint8_t channels = pixels.stride == 4 ? 4 : 3;
+  for (uint8_t channel = 0; channel < channels; channel++)
+    led[pixels.offsets[channel]] = this->correction_.color_correct_channel(channel, color.raw[channel]);
+
+  uint8_t *dst = pixels.data + from * pixels.stride;
+  size_t length = (to - from) * pixels.stride;
+  uint8_t phase = 0;
+  while (length > 0 && (reinterpret_cast<uintptr_t>(dst) & 3) != 0) {
+    *dst++ = led[phase];
+    phase = (phase + 1) % pixels.stride;
+    length--;
+  }
+  // 12 bytes are a whole number of LEDs with both strides, so the pattern can be stored a word at a time from here
+  uint32_t words[3];
+  auto *pattern = reinterpret_cast<uint8_t *>(words);
+  for (uint8_t i = 0; i < 12; i++)
+    pattern[i] = led[(phase + i) % pixels.stride];
+  auto *dst32 = reinterpret_cast<uint32_t *>(dst);
+  for (; length >= 12; length -= 12, dst32 += 3) {
+    dst32[0] = words[0];
+    dst32[1] = words[1];
+    dst32[2] = words[2];
+  }
+  dst = reinterpret_cast<uint8_t *>(dst32);
+  for (size_t i = 0; i < length; i++)
+    dst[i] = pattern[i];
+}
+
+static Color color_from_bytes(const uint8_t *data, uint8_t channels, ESPWhiteFromRGB white_from_rgb) {
+  switch (channels) {
+    case 1:
+      return Color(data[0], data[0], data[0], data[0]);
+    case 4:
+      return Color(data[0], data[1], data[2], data[3]);
+    default:
+      switch (white_from_rgb) {
+        case WHITE_FROM_RGB_AVERAGE:
+          return Color(data[0], data[1], data[2], (data[0] + data[1] + data[2]) / 3);
+        case WHITE_FROM_RGB_MIN:
+          return Color(data[0], data[1], data[2], std::min(std::min(data[0], data[1]), data[2]));
+        default:
+          return Color(data[0], data[1], data[2]);
+      }
+  }
+}
+
+void HOT AddressableLight::set_range_from_bytes(int32_t from, const uint8_t *data, int32_t count, uint8_t channels,
+                                                ESPWhiteFromRGB white_from_rgb) {
+  ESPRawPixels pixels;
+  if (!this->get_raw_pixels_(&pixels)) {
+    for (int32_t i = 0; i < count; i++, data += channels)
+      this->get_view_internal(from + i).set(color_from_bytes(data, channels, white_from_rgb));
+    return;
+  }
+
+  const uint8_t led_channels = pixels.stride == 4 ? 4 : 3;
+  uint8_t *dst = pixels.data + from * pixels.stride;
+  for (int32_t i = 0; i < count; i++, data += channels, dst += pixels.stride) {
+    Color color = color_from_bytes(data, channels, white_from_rgb);
+    for (uint8_t channel = 0; channel < led_channels; channel++)
+      dst[pixels.offsets[channel]] = this->correction_.color_correct_channel(channel, color.raw[channel]);
+  }
+}
+
+void AddressableLight::copy_range(int32_t to, int32_t from, int32_t count) {
+  if (count <= 0 || to == from)
+    return;
+  ESPRawPixels pixels;
+  if (this->get_raw_pixels_(&pixels)) {
+    // Same correction on both sides, so the raw bytes can be moved as they are
+    memmove(pixels.data + to * pixels.stride, pixels.data + from * pixels.stride, count * pixels.stride);
+    return;
+  }
+
+  if (from > to) {
+    // Copy from left
+    for (int32_t i = 0; i < count; i++)
+      this->get_view_internal(to + i).set(this->get_view_internal(from + i).get());
+  } else {
+    // Copy from right
+    for (int32_t i = count - 1; i >= 0; i--)
+      this->get_view_internal(to + i).set(this->get_view_internal(from + i).get());
+  }
+}
+
+void HOT AddressableLight::map_raw_(const ESPRawPixels &pixels, int32_t from, int32_t to) {
+  // Tables by byte position within an LED instead of by channel, so the loop doesn't look up the offsets
+  const uint8_t *table[4];
+  for (uint8_t channel = 0; channel < pixels.stride; channel++)
+    table[pixels.offsets[channel]] = this->lut_ + 256 * channel;
+
+  uint8_t *p = pixels.data + from * pixels.stride;
+  uint8_t *end = pixels.data + to * pixels.stride;
+  if (pixels.stride == 4) {
+    for (; p < end; p += 4) {
+      p[0] = table[0][p[0]];
+      p[1] = table[1][p[1]];
+      p[2] = table[2][p[2]];
+      p[3] = table[3][p[3]];
+    }
+  } else {
+    for (; p < end; p += 3) {
+      p[0] = table[0][p[0]];
+      p[1] = table[1][p[1]];
+      p[2] = table[2][p[2]];
+    }
+  }
+}
+
+void AddressableLight::start_transition_(const ESPRawPixels &pixels) {
+  const size_t length = this->size() * pixels.stride;
+  if (this->transition_start_ == nullptr)
+    this->transition_start_ = new uint8_t[length];
+
+  uint8_t channel_at[4];
+  for (uint8_t channel = 0; channel < pixels.stride; channel++)
+    channel_at[pixels.offsets[channel]] = channel;
+  for (size_t i = 0; i < length;) {
+    for (uint8_t k = 0; k < pixels.stride; k++, i++)
+      this->transition_start_[i] = this->correction_.color_uncorrect_channel(channel_at[k], pixels.data[i]);
+  }
+  this->transition_running_ = true;
+}
+
+void HOT AddressableLight::step_transition_(const ESPRawPixels &pixels, const Color &target, uint8_t amount) {
+  uint8_t channel_at[4];
+  uint8_t target_at[4];
+  for (uint8_t channel = 0; channel < pixels.stride; channel++) {
+    channel_at[pixels.offsets[channel]] = channel;
+    target_at[pixels.offsets[channel]] = esp_scale8(target.raw[channel], amount);
+  }
+  const uint8_t keep = 255 - amount;
+
+  uint8_t *dst = pixels.data;
+  const uint8_t *start = this->transition_start_;
+  for (int32_t led = 0; led < this->size(); led++) {
+    for (uint8_t k = 0; k < pixels.stride; k++, dst++, start++) {
+      uint16_t value = esp_scale8(*start, keep) + target_at[k];
+      *dst = this->correction_.color_correct_channel(channel_at[k], value > 255 ? 255 : value);
+    }
+  }
+}
+
 Color esp_color_from_light_color_values(LightColorValues val) {
   auto r = static_cast<uint8_t>(roundf(val.get_color_brightness() * val.get_red() * 255.0f));
   auto g = static_cast<uint8_t>(roundf(val.get_color_brightness() * val.get_green() * 255.0f));
@@ -37,30 +214,25 @@ void AddressableLight::write_state(LightState *state) {
   auto max_brightness = static_cast<uint8_t>(roundf(val.get_brightness() * val.get_state() * 255.0f));
   this->correction_.set_local_brightness(max_brightness);
 
-  this->last_transition_progress_ = 0.0f;
-  this->accumulated_alpha_ = 0.0f;
-
-  if (this->is_effect_active())
+  if (this->is_effect_active()) {
+    this->transition_running_ = false;
     return;
+  }
 
   // don't use LightState helper, gamma correction+brightness is handled by ESPColorView
 
   if (state->transformer_ == nullptr || !state->transformer_->is_transition()) {
     // no transformer active or non-transition one
     this->all() = esp_color_from_light_color_values(val);
+    this->last_transition_progress_ = 0.0f;
+    this->accumulated_alpha_ = 0.0f;
+    this->transition_running_ = false;
   } else {
     // transition transformer active, activate specialized transition for addressable effects
     // instead of using a unified transition for all LEDs, we use the current state each LED as the
-    // start. Warning: ugly
-
-    // We can't use a direct lerp smoothing here though - that would require creating a copy of the original
-    // state of each LED at the start of the transition
-    // Instead, we "fake" the look of the LERP by using an exponential average over time and using
-    // dynamically-calculated alpha values to match the look of the
-
+    // start.
     float new_progress = state->transformer_->get_progress();
-    float prev_smoothed = LightTransitionTransformer::smoothed_progress(last_transition_progress_);
-    float new_smoothed = LightTransitionTransformer::smoothed_progress(new_progress);
+    float prev_progress = this->last_transition_progress_;
     this->last_transition_progress_ = new_progress;
 
     auto end_values = state->transformer_->get_end_values();
@@ -70,6 +242,23 @@ void AddressableLight::write_state(LightState *state) {
     this->correction_.set_local_brightness(255);
     target_color *= static_cast<uint8_t>(roundf(end_values.get_brightness() * end_values.get_state() * 255.0f));
 
+    ESPRawPixels pixels;
+    if (this->get_raw_pixels_(&pixels)) {
+      // Lerp directly from a copy of the colors the transition started at, the progress going back means a new
+      // transition replaced the previous one
+      if (!this->transition_running_ || new_progress < prev_progress)
+        this->start_transition_(pixels);
+      float smoothed = LightTransitionTransformer::smoothed_progress(new_progress);
+      this->step_transition_(pixels, target_color, static_cast<uint8_t>(roundf(smoothed * 255.0f)));
+      this->schedule_show();
+      return;
+    }
+
+    // Without access to the buffer we can't keep a copy of the start colors. Instead, we "fake" the look of the
+    // LERP by using an exponential average over time and using dynamically-calculated alpha values
+    float prev_smoothed = LightTransitionTransformer::smoothed_progress(prev_progress);
+    float new_smoothed = LightTransitionTransformer::smoothed_progress(new_progress);
+
     float denom = (1.0f - new_smoothed);
     float alpha = denom == 0.0f ? 0.0f : (new_smoothed - prev_smoothed) / denom;
 
@@ -91,8 +280,10 @@ void AddressableLight::write_state(LightState *state) {
       uint8_t inv_alpha8 = 255 - alpha8;
       Color add = target_color * alpha8;
 
-      for (auto led : *this)
-        led = add + led.get() * inv_alpha8;
+      this->map_range(0, this->size(), [add, inv_alpha8](uint8_t channel, uint8_t value) {
+        uint16_t sum = add.raw[channel] + esp_scale8(value, inv_alpha8);
+        return static_cast<uint8_t>(sum > 255 ? 255 : sum);
+      });
     }
   }
 
@@ -18,6 +18,26 @@ namespace light {
 
 using ESPColor = Color;
 
+/// Layout of the pixel buffer of a driver, see AddressableLight::get_raw_pixels_().
+struct ESPRawPixels {
+  /// The first byte of the first LED.
+  uint8_t *data;
+  /// Bytes per LED, 3 or 4. The white channel is only there with 4.
+  uint8_t stride;
+  /// Position of the red, green, blue and white byte within an LED.
+  uint8_t offsets[4];
+};
+
+/// How AddressableLight::set_range_from_bytes() picks the white channel of RGB colors.
+enum ESPWhiteFromRGB : uint8_t {
+  WHITE_FROM_RGB_OFF,
+  WHITE_FROM_RGB_AVERAGE,
+  WHITE_FROM_RGB_MIN,
+};
+
+/// Ranges shorter than this are mapped LED by LED, building the lookup tables costs more than it saves.
+static const int32_t ADDRESSABLE_LUT_MIN_LEDS = 128;
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
@@ -63,6 +83,39 @@ class AddressableLight : public LightOutput, public Component {
   }
   void schedule_show() { this->next_show_ = true; }
 
+  /** Render effects at a fixed frame rate instead of on every loop, 0 to disable.
+   *
+   * Lights with the same frame rate render in the same loop iteration. A frame is dropped if the previous one
+   * hasn't been sent out yet, so slow effects or strips lower the frame rate instead of piling up work.
+   */
+  void set_frame_rate(uint32_t frame_rate) { this->frame_rate_ = frame_rate; }
+  /// Whether an effect should render a frame now, see set_frame_rate(). Schedules a show if so.
+  bool begin_frame();
+  /// How many frames were dropped since boot because the light wasn't done with the previous one.
+  uint32_t get_dropped_frames() const { return this->dropped_frames_; }
+
+  /// Set the LEDs from from to to (exclusive) to color, which is corrected only once.
+  void fill_range(int32_t from, int32_t to, const Color &color);
+  /// Scale the LEDs from from to to (exclusive) by scale / 255, like ESPColorView::fade_to_black() on each of them.
+  void scale_range(int32_t from, int32_t to, uint8_t scale) {
+    this->map_range(from, to, [scale](uint8_t channel, uint8_t value) { return esp_scale8(value, scale); });
+  }
+  /** Replace each channel of the LEDs from from to to (exclusive) by f(channel, value).
+   *
+   * f gets and returns uncorrected values, channel is 0 to 3 for red, green, blue and white. On long ranges f and the
+   * color correction are evaluated only once for each channel and value, into a table the raw buffer is then mapped
+   * through. f must not depend on the LED it is called for.
+   */
+  template<typename F> void map_range(int32_t from, int32_t to, F &&f);
+  /** Set count LEDs starting at from to packed 8-bit colors, as received from E1.31 or DDP.
+   *
+   * channels is the number of bytes per LED: 1 for gray, 3 for RGB (with white from white_from_rgb) or 4 for RGBW.
+   */
+  void set_range_from_bytes(int32_t from, const uint8_t *data, int32_t count, uint8_t channels,
+                            ESPWhiteFromRGB white_from_rgb = WHITE_FROM_RGB_AVERAGE);
+  /// Copy the colors of count LEDs starting at from to the ones starting at to, the two may overlap.
+  void copy_range(int32_t to, int32_t from, int32_t count);
+
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
 #endif
@@ -70,7 +123,7 @@ class AddressableLight : public LightOutput, public Component {
   void call_setup() override;
 
  protected:
-  bool should_show_() const { return this->effect_active_ || this->next_show_; }
+  bool should_show_() const { return (this->effect_active_ && this->frame_rate_ == 0) || this->next_show_; }
   void mark_shown_() {
     this->next_show_ = false;
 #ifdef USE_POWER_SUPPLY
@@ -84,9 +137,22 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /// Whether the driver can start sending a frame right now, drivers that send in the background override this.
+  virtual bool can_show_() const { return true; }
+  /// Describe the pixel buffer for the batch operations, drivers that don't have one in a usual layout return false.
+  virtual bool get_raw_pixels_(ESPRawPixels *pixels) const { return false; }
+  /// Map the bytes of LED from to to (exclusive) through the per-channel tables in lut_.
+  void map_raw_(const ESPRawPixels &pixels, int32_t from, int32_t to);
+  /// Remember the uncorrected colors all LEDs start a transition from.
+  void start_transition_(const ESPRawPixels &pixels);
+  /// Set all LEDs amount / 255 of the way from their start color to target.
+  void step_transition_(const ESPRawPixels &pixels, const Color &target, uint8_t amount);
 
   bool effect_active_{false};
   bool next_show_{true};
+  uint32_t frame_rate_{0};
+  uint32_t last_frame_{0};
+  uint32_t dropped_frames_{0};
   ESPColorCorrection correction_{};
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
@@ -94,7 +160,38 @@ class AddressableLight : public LightOutput, public Component {
   LightState *state_parent_{nullptr};
   float last_transition_progress_{0.0f};
   float accumulated_alpha_{0.0f};
+  /// Uncorrected start colors of the running transition, laid out like the raw buffer. Allocated on first use.
+  uint8_t *transition_start_{nullptr};
+  bool transition_running_{false};
+  /// Lookup tables of map_range(), 256 bytes per channel. Allocated on first use.
+  uint8_t *lut_{nullptr};
 };
 
+template<typename F> void AddressableLight::map_range(int32_t from, int32_t to, F &&f) {
+  ESPRawPixels pixels;
+  if (to - from < ADDRESSABLE_LUT_MIN_LEDS || !this->get_raw_pixels_(&pixels)) {
+    for (int32_t i = from; i < to; i++) {
+      ESPColorView view = this->get_view_internal(i);
+      Color color = view.get();
+      for (uint8_t channel = 0; channel < 4; channel++)
+        color[channel] = f(channel, color[channel]);
+      view.set(color);
+    }
+    return;
+  }
+
+  if (this->lut_ == nullptr)
+    this->lut_ = new uint8_t[4 * 256];
+  const uint8_t channels = pixels.stride == 4 ? 4 : 3;
+  for (uint8_t channel = 0; channel < channels; channel++) {
+    uint8_t *table = this->lut_ + 256 * channel;
+    for (uint16_t raw = 0; raw < 256; raw++) {
+      uint8_t value = f(channel, this->correction_.color_uncorrect_channel(channel, raw));
+      table[raw] = this->correction_.color_correct_channel(channel, value);
+    }
+  }
+  this->map_raw_(pixels, from, to);
+}
+
 }  // namespace light
 }  // namespace esphome
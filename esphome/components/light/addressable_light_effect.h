@@ -26,6 +26,14 @@ inline static int16_t sin16_c(uint16_t theta) {
   return y;
 }
 inline static uint8_t half_sin8(uint8_t v) { return sin16_c(uint16_t(v) * 128u) >> 8; }
+/// Turn a probability into a threshold to compare random_uint32() against, so effects need no floats per frame.
+inline static uint32_t random_threshold(float probability) {
+  if (probability <= 0.0f)
+    return 0;
+  if (probability >= 1.0f)
+    return UINT32_MAX;
+  return static_cast<uint32_t>(probability * double(UINT32_MAX));
+}
 
 class AddressableLightEffect : public LightEffect {
  public:
@@ -38,6 +46,8 @@ class AddressableLightEffect : public LightEffect {
   void stop() override { this->get_addressable_()->set_effect_active(false); }
   virtual void apply(AddressableLight &it, const Color &current_color) = 0;
   void apply() override {
+    if (!this->get_addressable_()->begin_frame())
+      return;
     LightColorValues color = this->state_->remote_values;
     // not using any color correction etc. that will be handled by the addressable layer
     Color current_color =
@@ -204,18 +214,20 @@ class AddressableTwinkleEffect : public AddressableLightEffect {
         view = COLOR_BLACK;
       }
     }
-    while (random_float() < this->twinkle_probability_) {
+    while (random_uint32() < this->twinkle_threshold_) {
       const size_t pos = random_uint32() % addressable.size();
       if (addressable[pos].get_effect_data() != 0)
         continue;
       addressable[pos].set_effect_data(1);
     }
   }
-  void set_twinkle_probability(float twinkle_probability) { this->twinkle_probability_ = twinkle_probability; }
+  void set_twinkle_probability(float twinkle_probability) {
+    this->twinkle_threshold_ = random_threshold(twinkle_probability);
+  }
   void set_progress_interval(uint32_t progress_interval) { this->progress_interval_ = progress_interval; }
 
  protected:
-  float twinkle_probability_{0.05f};
+  uint32_t twinkle_threshold_{random_threshold(0.05f)};
   uint32_t progress_interval_{4};
   uint32_t last_progress_{0};
 };
@@ -250,7 +262,7 @@ class AddressableRandomTwinkleEffect : public AddressableLightEffect {
         view = Color(0, 0, 0, 0);
       }
     }
-    while (random_float() < this->twinkle_probability_) {
+    while (random_uint32() < this->twinkle_threshold_) {
       const size_t pos = random_uint32() % it.size();
       if (it[pos].get_effect_data() != 0)
         continue;
@@ -258,11 +270,13 @@ class AddressableRandomTwinkleEffect : public AddressableLightEffect {
       it[pos].set_effect_data(0b1000 | color);
     }
   }
-  void set_twinkle_probability(float twinkle_probability) { this->twinkle_probability_ = twinkle_probability; }
+  void set_twinkle_probability(float twinkle_probability) {
+    this->twinkle_threshold_ = random_threshold(twinkle_probability);
+  }
   void set_progress_interval(uint32_t progress_interval) { this->progress_interval_ = progress_interval; }
 
  protected:
-  float twinkle_probability_{};
+  uint32_t twinkle_threshold_{};
   uint32_t progress_interval_{};
   uint32_t last_progress_{0};
 };
@@ -293,7 +307,7 @@ class AddressableFireworksEffect : public AddressableLightEffect {
       it[i] = (it[i - 1].get() * 64) + it[i].get() + (it[i + 1].get() * 64);
     }
     it[last] = it[last].get() + (it[last - 1].get() * 128);
-    if (random_float() < this->spark_probability_) {
+    if (random_uint32() < this->spark_threshold_) {
       const size_t pos = random_uint32() % it.size();
       if (this->use_random_color_) {
         it[pos] = Color::random_color();
@@ -303,7 +317,7 @@ class AddressableFireworksEffect : public AddressableLightEffect {
     }
   }
   void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
-  void set_spark_probability(float spark_probability) { this->spark_probability_ = spark_probability; }
+  void set_spark_probability(float spark_probability) { this->spark_threshold_ = random_threshold(spark_probability); }
   void set_use_random_color(bool random_color) { this->use_random_color_ = random_color; }
   void set_fade_out_rate(uint8_t fade_out_rate) { this->fade_out_rate_ = fade_out_rate; }
 
@@ -311,7 +325,7 @@ class AddressableFireworksEffect : public AddressableLightEffect {
   uint8_t fade_out_rate_{};
   uint32_t update_interval_{};
   uint32_t last_update_{0};
-  float spark_probability_{};
+  uint32_t spark_threshold_{};
   bool use_random_color_{};
 };
 
@@ -328,7 +342,7 @@ class AddressableFlickerEffect : public AddressableLightEffect {
     this->last_update_ = now;
     fast_random_set_seed(random_uint32());
     for (auto var : it) {
-      const uint8_t flicker = fast_random_8() % intensity;
+      const uint8_t flicker = esp_scale8(fast_random_8(), intensity);
       // scale down by random factor
       var = var.get() * (255 - flicker);
 
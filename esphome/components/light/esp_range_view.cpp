@@ -17,11 +17,7 @@ ESPColorView ESPRangeView::operator[](int32_t index) const {
 ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
-void ESPRangeView::set(const Color &color) {
-  for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
-  }
-}
+void ESPRangeView::set(const Color &color) { this->parent_->fill_range(this->begin_, this->end_, color); }
 
 void ESPRangeView::set_red(uint8_t red) {
   for (auto c : *this)
@@ -44,21 +40,29 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
     c.set_effect_data(effect_data);
 }
 
+// Same as the Color operations, one channel at a time
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
-}
-void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  this->parent_->map_range(this->begin_, this->end_,
+                           [amnt](uint8_t channel, uint8_t value) { return 255 - esp_scale8(value, amnt); });
 }
+void ESPRangeView::fade_to_black(uint8_t amnt) { this->parent_->scale_range(this->begin_, this->end_, amnt); }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  this->parent_->map_range(this->begin_, this->end_, [delta](uint8_t channel, uint8_t value) {
+    return static_cast<uint8_t>(uint8_t(value + delta) < value ? 255 : value + delta);
+  });
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  this->parent_->map_range(this->begin_, this->end_, [delta](uint8_t channel, uint8_t value) {
+    return static_cast<uint8_t>(delta > value ? 0 : value - delta);
+  });
+}
+void ESPRangeView::blend(const Color &color, uint8_t amnt) {
+  const Color add = color * amnt;
+  const uint8_t keep = 255 - amnt;
+  this->parent_->map_range(this->begin_, this->end_, [add, keep](uint8_t channel, uint8_t value) {
+    uint16_t sum = add.raw[channel] + esp_scale8(value, keep);
+    return static_cast<uint8_t>(sum > 255 ? 255 : sum);
+  });
 }
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
@@ -71,22 +75,7 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
     return *this;
   }
 
-  // If both equal, already done
-  if (rhs.begin_ == this->begin_)
-    return *this;
-
-  if (rhs.begin_ > this->begin_) {
-    // Copy from left
-    for (int32_t i = 0; i < this->size(); i++) {
-      (*this)[i].set(rhs[i].get());
-    }
-  } else {
-    // Copy from right
-    for (int32_t i = this->size() - 1; i >= 0; i--) {
-      (*this)[i].set(rhs[i].get());
-    }
-  }
-
+  this->parent_->copy_range(this->begin_, rhs.begin_, this->size());
   return *this;
 }
 
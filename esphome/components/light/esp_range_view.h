@@ -33,6 +33,8 @@ class ESPRangeView : public ESPColorSettable {
   void fade_to_black(uint8_t amnt) override;
   void lighten(uint8_t delta) override;
   void darken(uint8_t delta) override;
+  /// Mix color into each LED, amnt 0 keeps the LEDs as they are and 255 sets them to color.
+  void blend(const Color &color, uint8_t amnt);
 
   ESPRangeView &operator=(const Color &rhs) {
     this->set(rhs);
@@ -168,11 +168,12 @@ void LightCall::perform() {
   if (!this->has_transition_()) {
     this->parent_->target_state_reached_callback_.call();
   }
+  // Publish and save in the next loop, so that a burst of calls is only published and saved once
   if (this->publish_) {
-    this->parent_->publish_state();
+    this->parent_->publish_pending_ = true;
   }
   if (this->save_) {
-    this->parent_->save_remote_values_();
+    this->parent_->save_pending_ = true;
   }
 }
 
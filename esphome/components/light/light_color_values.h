@@ -124,26 +124,28 @@ class LightColorValues {
   }
 
 #ifdef USE_JSON
-  /** Dump this color into a JsonObject. Only dumps values if the corresponding traits are marked supported by traits.
+  /** Write this color into a JSON object. Only writes values if the corresponding traits are marked supported by
+   * traits.
    *
-   * @param root The json root object.
+   * @param root The json writer of the object.
    * @param traits The traits object used for determining whether to include certain attributes.
    */
-  void dump_json(JsonObject &root, const LightTraits &traits) const {
-    root["state"] = (this->get_state() != 0.0f) ? "ON" : "OFF";
+  void dump_json(json::JsonWriter &root, const LightTraits &traits) const {
+    root.add("state", (this->get_state() != 0.0f) ? "ON" : "OFF");
     if (traits.get_supports_brightness())
-      root["brightness"] = uint8_t(this->get_brightness() * 255);
+      root.add("brightness", uint8_t(this->get_brightness() * 255));
     if (traits.get_supports_rgb()) {
-      JsonObject &color = root.createNestedObject("color");
-      color["r"] = uint8_t(this->get_color_brightness() * this->get_red() * 255);
-      color["g"] = uint8_t(this->get_color_brightness() * this->get_green() * 255);
-      color["b"] = uint8_t(this->get_color_brightness() * this->get_blue() * 255);
+      root.begin_object("color");
+      root.add("r", uint8_t(this->get_color_brightness() * this->get_red() * 255));
+      root.add("g", uint8_t(this->get_color_brightness() * this->get_green() * 255));
+      root.add("b", uint8_t(this->get_color_brightness() * this->get_blue() * 255));
+      root.end();
     }
     if (traits.get_supports_rgb_white_value()) {
-      root["white_value"] = uint8_t(this->get_white() * 255);
+      root.add("white_value", uint8_t(this->get_white() * 255));
     }
     if (traits.get_supports_color_temperature())
-      root["color_temp"] = uint32_t(this->get_color_temperature());
+      root.add("color_temp", uint32_t(this->get_color_temperature()));
   }
 #endif
 
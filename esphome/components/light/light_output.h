@@ -17,6 +17,13 @@ class LightOutput {
 
   virtual void setup_state(LightState *state) {}
 
+  /** Whether the outputs of this light can fade to new values in hardware.
+   *
+   * During transitions, write_state() of such a light is only called a few times, and it must fade to the values
+   * over LightState::get_fade_length() ms.
+   */
+  virtual bool supports_fade() { return false; }
+
   virtual void write_state(LightState *state) = 0;
 };
 
@@ -7,6 +7,11 @@ namespace light {
 
 static const char *const TAG = "light";
 
+/// Number of straight segments a transition is split into for hardware fades.
+static const uint32_t FADE_SEGMENTS = 8;
+/// Shortest hardware fade segment in ms, so short transitions write less often.
+static const uint32_t MIN_FADE_SEGMENT_LENGTH = 50;
+
 LightState::LightState(const std::string &name, LightOutput *output) : Nameable(name), output_(output) {}
 
 LightTraits LightState::get_traits() { return this->output_->get_traits(); }
@@ -91,6 +96,17 @@ void LightState::dump_config() {
   }
 }
 void LightState::loop() {
+  // Publish and save the calls since the last loop
+  if (this->publish_pending_) {
+    this->publish_pending_ = false;
+    this->publish_state();
+  }
+  if (this->save_pending_) {
+    this->save_pending_ = false;
+    this->save_remote_values_();
+  }
+  this->transition_started_ = false;
+
   // Apply effect (if any)
   auto *effect = this->get_active_effect_();
   if (effect != nullptr) {
@@ -105,11 +121,24 @@ void LightState::loop() {
       if (this->transformer_->publish_at_end())
         this->publish_state();
       this->transformer_ = nullptr;
+      this->next_write_ = true;
+    } else if (this->transformer_->is_transition() && this->output_->supports_fade()) {
+      // Let the outputs fade in hardware, approximating the transition curve by a few straight segments
+      const uint32_t now = millis();
+      if (int32_t(now - this->fade_end_) >= 0) {
+        auto *transition = static_cast<LightTransitionTransformer *>(this->transformer_.get());
+        const uint32_t segment = std::max(transition->get_length() / FADE_SEGMENTS, MIN_FADE_SEGMENT_LENGTH);
+        const uint32_t remaining = transition->get_end_time() - now;
+        this->fade_end_ = now + std::min(segment, remaining);
+        this->current_values = transition->get_values_at(this->fade_end_);
+        this->remote_values = transition->get_remote_values();
+        this->next_write_ = true;
+      }
     } else {
       this->current_values = this->transformer_->get_values();
       this->remote_values = this->transformer_->get_remote_values();
+      this->next_write_ = true;
     }
-    this->next_write_ = true;
   }
 
   if (this->next_write_) {
@@ -118,6 +147,13 @@ void LightState::loop() {
   }
 }
 
+void LightState::on_shutdown() {
+  if (this->save_pending_) {
+    this->save_pending_ = false;
+    this->save_remote_values_();
+  }
+}
+
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 uint32_t LightState::hash_base() { return 1114400283; }
 
@@ -134,17 +170,11 @@ std::string LightState::get_effect_name() {
     return "None";
 }
 
-void LightState::add_new_remote_values_callback(std::function<void()> &&send_callback) {
-  this->remote_values_callback_.add(std::move(send_callback));
-}
-void LightState::add_new_target_state_reached_callback(std::function<void()> &&send_callback) {
-  this->target_state_reached_callback_.add(std::move(send_callback));
-}
 
 #ifdef USE_JSON
-void LightState::dump_json(JsonObject &root) {
+void LightState::dump_json(json::JsonWriter &root) {
   if (this->supports_effects())
-    root["effect"] = this->get_effect_name();
+    root.add("effect", this->get_effect_name());
   this->remote_values.dump_json(root, this->output_->get_traits());
 }
 #endif
@@ -212,8 +242,25 @@ void LightState::stop_effect_() {
 }
 
 void LightState::start_transition_(const LightColorValues &target, uint32_t length) {
-  this->transformer_ = make_unique<LightTransitionTransformer>(millis(), length, this->current_values, target);
+  const uint32_t now = millis();
+  if (this->transition_started_ && this->transformer_ != nullptr && this->transformer_->is_transition()) {
+    // Another call since the last loop, the transition didn't progress yet so just replace it in place
+    *static_cast<LightTransitionTransformer *>(this->transformer_.get()) =
+        LightTransitionTransformer(now, length, this->current_values, target);
+  } else {
+    this->transformer_ = make_unique<LightTransitionTransformer>(now, length, this->current_values, target);
+  }
+  this->transition_started_ = true;
   this->remote_values = this->transformer_->get_remote_values();
+  // Start a new fade segment in the next loop
+  this->fade_end_ = now;
+}
+
+uint32_t LightState::get_fade_length() const {
+  if (this->transformer_ == nullptr || !this->transformer_->is_transition())
+    return 0;
+  const auto remaining = int32_t(this->fade_end_ - millis());
+  return remaining > 0 ? remaining : 0;
 }
 
 void LightState::start_flash_(const LightColorValues &target, uint32_t length) {
@@ -45,6 +45,8 @@ class LightState : public Nameable, public Component {
   void setup() override;
   void dump_config() override;
   void loop() override;
+  /// Save the remote values if a call didn't get to it in loop() yet.
+  void on_shutdown() override;
   /// Shortly after HARDWARE.
   float get_setup_priority() const override;
 
@@ -81,21 +83,25 @@ class LightState : public Nameable, public Component {
    * This lets front-end components subscribe to light change events. This callback is called once
    * when the remote color values are changed.
    *
-   * @param send_callback The callback.
+   * @param callback The callback.
    */
-  void add_new_remote_values_callback(std::function<void()> &&send_callback);
+  template<typename F> void add_new_remote_values_callback(F &&callback) {
+    this->remote_values_callback_.add(std::forward<F>(callback));
+  }
 
   /**
    * The callback is called once the state of current_values and remote_values are equal (when the
    * transition is finished).
    *
-   * @param send_callback
+   * @param callback
    */
-  void add_new_target_state_reached_callback(std::function<void()> &&send_callback);
+  template<typename F> void add_new_target_state_reached_callback(F &&callback) {
+    this->target_state_reached_callback_.add(std::forward<F>(callback));
+  }
 
 #ifdef USE_JSON
   /// Dump the state of this light as JSON.
-  void dump_json(JsonObject &root);
+  void dump_json(json::JsonWriter &root);
 #endif
 
   /// Set the default transition length, i.e. the transition length when no transition is provided.
@@ -117,6 +123,12 @@ class LightState : public Nameable, public Component {
   /// Add effects for this light state.
   void add_effects(const std::vector<LightEffect *> &effects);
 
+  /** The time in ms the outputs should take to fade to current_values in write_state(), 0 to set them right away.
+   *
+   * Only used for lights whose output supports fades, see LightOutput::supports_fade().
+   */
+  uint32_t get_fade_length() const;
+
   void current_values_as_binary(bool *binary);
 
   void current_values_as_brightness(float *brightness);
@@ -166,6 +178,14 @@ class LightState : public Nameable, public Component {
   std::unique_ptr<LightTransformer> transformer_{nullptr};
   /// Whether the light value should be written in the next cycle.
   bool next_write_{true};
+  /// The millis() time at which the current hardware fade segment of a transition ends.
+  uint32_t fade_end_{0};
+  /// Whether a call since the last loop asked to publish the remote values, they are published once in loop().
+  bool publish_pending_{false};
+  /// Whether a call since the last loop asked to save the remote values, they are saved once in loop().
+  bool save_pending_{false};
+  /// Whether the current transition was started since the last loop, a following call replaces it.
+  bool transition_started_{false};
 
   /// Object used to store the persisted values of the light.
   ESPPreferenceObject rtc_;
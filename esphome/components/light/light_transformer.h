@@ -31,7 +31,14 @@ class LightTransformer {
   virtual bool publish_at_end() = 0;
   virtual bool is_transition() = 0;
 
-  float get_progress() { return clamp((millis() - this->start_time_) / float(this->length_), 0.0f, 1.0f); }
+  float get_progress() { return this->get_progress_at(millis()); }
+  /// The progress at `time` (in millis()), which must not be before the start of this transformation.
+  float get_progress_at(uint32_t time) const {
+    return clamp((time - this->start_time_) / float(this->length_), 0.0f, 1.0f);
+  }
+  /// The millis() time at which this transformation is finished.
+  uint32_t get_end_time() const { return this->start_time_ + this->length_; }
+  uint32_t get_length() const { return this->length_; }
 
  protected:
   const LightColorValues &get_start_values_() const { return this->start_values_; }
@@ -60,8 +67,11 @@ class LightTransitionTransformer : public LightTransformer {
     }
   }
 
-  LightColorValues get_values() override {
-    float v = LightTransitionTransformer::smoothed_progress(this->get_progress());
+  LightColorValues get_values() override { return this->get_values_at(millis()); }
+
+  /// The values at `time` (in millis()), for outputs that fade to the values of a later time in hardware.
+  LightColorValues get_values_at(uint32_t time) const {
+    float v = LightTransitionTransformer::smoothed_progress(this->get_progress_at(time));
     return LightColorValues::lerp(this->get_start_values_(), this->get_target_values_(), v);
   }
 
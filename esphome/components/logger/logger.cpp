@@ -1,4 +1,6 @@
 #include "logger.h"
+#include <cstdarg>
+#include <cstring>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <esp_log.h>
@@ -42,10 +44,150 @@ void Logger::write_header_(int level, const char *tag, int line) {
   this->printf_to_buffer_("%s[%s][%s:%03u]: ", color, letter, tag, line);
 }
 
+#ifdef USE_LOGGER_ASYNC
+/// Set in the level of binary records in the async ring.
+static const uint8_t ASYNC_BINARY_RECORD = 0x80;
+#endif
+
+static inline char read_format_char(const char *p, bool in_flash) {
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  if (in_flash)
+    return pgm_read_byte(p);
+#endif
+  return *p;
+}
+
+size_t HOT encode_log_args(const char *format, bool format_in_flash, va_list args, uint8_t *out, size_t size) {
+  size_t at = 0;
+  auto put = [&](const void *data, size_t len) {
+    if (at + len > size)
+      return false;
+    memcpy(out + at, data, len);
+    at += len;
+    return true;
+  };
+  const char *p = format;
+  auto next = [&]() { return read_format_char(++p, format_in_flash); };
+
+  for (char c = read_format_char(p, format_in_flash); c != '\0'; c = next()) {
+    if (c != '%')
+      continue;
+    c = next();
+    while (c == '-' || c == '+' || c == ' ' || c == '#' || c == '0')
+      c = next();
+    // Width, then precision
+    for (int i = 0; i < 2; i++) {
+      if (c == '*') {
+        const int32_t value = va_arg(args, int);
+        if (!put(&value, 4))
+          return at;
+        c = next();
+      }
+      while (c >= '0' && c <= '9')
+        c = next();
+      if (i != 0 || c != '.')
+        break;
+      c = next();
+    }
+    int longs = 0;
+    bool size_type = false;
+    bool long_double = false;
+    while (c == 'h' || c == 'l' || c == 'j' || c == 'z' || c == 't' || c == 'L') {
+      longs += c == 'l' ? 1 : c == 'j' ? 2 : 0;
+      size_type |= c == 'z' || c == 't';
+      long_double |= c == 'L';
+      c = next();
+    }
+
+    switch (c) {
+      case '%':
+        break;
+      case 'd':
+      case 'i':
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+      case 'c': {
+        if (longs >= 2) {
+          const uint64_t value = va_arg(args, unsigned long long);
+          if (!put(&value, 8))
+            return at;
+          break;
+        }
+        uint32_t value;
+        if (size_type) {
+          value = va_arg(args, size_t);
+        } else if (longs == 1) {
+          value = va_arg(args, unsigned long);
+        } else {
+          value = va_arg(args, unsigned int);
+        }
+        if (!put(&value, 4))
+          return at;
+        break;
+      }
+      case 'p': {
+        const uint32_t value = reinterpret_cast<uintptr_t>(va_arg(args, void *));
+        if (!put(&value, 4))
+          return at;
+        break;
+      }
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A': {
+        if (long_double)
+          return at;
+        const double value = va_arg(args, double);
+        if (!put(&value, 8))
+          return at;
+        break;
+      }
+      case 's': {
+        const char *value = va_arg(args, const char *);
+        if (value == nullptr)
+          value = "(null)";
+        const size_t len = strlen(value) + 1;
+        if (!put(value, len)) {
+          // Cut off, the client sees the missing terminator
+          if (at < size) {
+            memcpy(out + at, value, size - at);
+            at = size;
+          }
+          return at;
+        }
+        break;
+      }
+      case 'n':
+        va_arg(args, void *);
+        break;
+      default:
+        return at;
+    }
+  }
+  return at;
+}
+
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag))
+  const bool text = this->is_level_consumed_(level);
+  const bool binary = this->is_level_binary_consumed_(level);
+  if ((!text && !binary) || level > this->level_for(tag))
     return;
 
+  if (binary) {
+    va_list copy;
+    va_copy(copy, args);
+    this->log_binary_(level, tag, line, format, false, copy);
+    va_end(copy);
+    if (!text)
+      return;
+  }
+
   this->reset_buffer_();
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(format, args);
@@ -55,9 +197,20 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format,
                           va_list args) {  // NOLINT
-  if (level > this->level_for(tag))
+  const bool text = this->is_level_consumed_(level);
+  const bool binary = this->is_level_binary_consumed_(level);
+  if ((!text && !binary) || level > this->level_for(tag))
     return;
 
+  if (binary) {
+    va_list copy;
+    va_copy(copy, args);
+    this->log_binary_(level, tag, line, reinterpret_cast<const char *>(format), true, copy);
+    va_end(copy);
+    if (!text)
+      return;
+  }
+
   this->reset_buffer_();
   // copy format string
   const char *format_pgm_p = (PGM_P) format;
@@ -82,15 +235,25 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
 #endif
 
 int HOT Logger::level_for(const char *tag) {
-  // Uses std::vector<> for low memory footprint, though the vector
-  // could be sorted to minimize lookup times. This feature isn't used that
-  // much anyway so it doesn't matter too much.
+  if (this->log_levels_.empty())
+    return ESPHOME_LOG_LEVEL;
+
+  // Tags are string literals (static const char *const TAG), so the pointer identifies the tag.
+  // Remember the result for that pointer to avoid comparing strings on every log call.
+  TagLevelCacheEntry &entry = this->tag_level_cache_[(reinterpret_cast<uintptr_t>(tag) >> 2) % TAG_LEVEL_CACHE_SIZE];
+  if (entry.tag == tag)
+    return entry.level;
+
+  int level = ESPHOME_LOG_LEVEL;
   for (auto &it : this->log_levels_) {
     if (it.tag == tag) {
-      return it.level;
+      level = it.level;
+      break;
     }
   }
-  return ESPHOME_LOG_LEVEL;
+  entry.tag = tag;
+  entry.level = level;
+  return level;
 }
 void HOT Logger::log_message_(int level, const char *tag, int offset) {
   // remove trailing newline
@@ -101,6 +264,13 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   this->set_null_terminator_();
 
   const char *msg = this->tx_buffer_ + offset;
+#ifdef USE_LOGGER_ASYNC
+  if (this->async_active_) {
+    if (!this->push_async_(level, tag, msg))
+      this->dropped_messages_++;
+    return;
+  }
+#endif
   if (this->baud_rate_ > 0)
     this->hw_serial_->println(msg);
 #ifdef ARDUINO_ARCH_ESP32
@@ -116,6 +286,157 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
 #endif
 }
 
+void HOT Logger::log_binary_(int level, const char *tag, int line, const char *format, bool format_in_flash,
+                             va_list args) {
+  const size_t len = encode_log_args(format, format_in_flash, args, this->binary_buffer_, this->tx_buffer_size_);
+#ifdef USE_LOGGER_ASYNC
+  if (this->async_active_) {
+    uint8_t header[2 * sizeof(const char *) + 2];
+    memcpy(header, &tag, sizeof(tag));
+    memcpy(header + sizeof(tag), &format, sizeof(format));
+    header[2 * sizeof(const char *)] = line & 0xFF;
+    header[2 * sizeof(const char *) + 1] = (line >> 8) & 0xFF;
+    if (!this->push_async_record_(level | ASYNC_BINARY_RECORD, header, sizeof(header), this->binary_buffer_, len))
+      this->dropped_messages_++;
+    return;
+  }
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+  // Same as for formatted messages, see log_message_()
+  if (xPortGetFreeHeapSize() > 2048)
+    this->binary_log_callback_.call(level, tag, line, format, this->binary_buffer_, len);
+#else
+  this->binary_log_callback_.call(level, tag, line, format, this->binary_buffer_, len);
+#endif
+}
+
+#ifdef USE_LOGGER_ASYNC
+bool HOT Logger::push_async_(int level, const char *tag, const char *msg) {
+  return this->push_async_record_(level, tag, strlen(tag) + 1, msg, strlen(msg) + 1);
+}
+bool HOT Logger::push_async_record_(uint8_t level, const void *first, size_t first_len, const void *second,
+                                    size_t second_len) {
+  const size_t len = 3 + first_len + second_len;
+  const size_t size = this->async_buffer_size_;
+  const size_t head = this->async_head_;
+  size_t tail = this->async_tail_;
+
+  if (tail >= head) {
+    // Free space is [tail, size) and [0, head), the tail may only reach size when it doesn't become head
+    if (size - tail < len + (head == 0 ? 1 : 0)) {
+      if (head <= len)
+        return false;
+      // Not enough room at the end, mark the wrap-around and continue at the start
+      if (size - tail >= 2) {
+        this->async_buffer_[tail] = 0;
+        this->async_buffer_[tail + 1] = 0;
+      }
+      tail = 0;
+    }
+  } else if (head - tail <= len) {
+    return false;
+  }
+
+  this->async_buffer_[tail] = len & 0xFF;
+  this->async_buffer_[tail + 1] = len >> 8;
+  this->async_buffer_[tail + 2] = level;
+  memcpy(this->async_buffer_ + tail + 3, first, first_len);
+  memcpy(this->async_buffer_ + tail + 3 + first_len, second, second_len);
+  // Publish the record only after it has been written completely
+  this->async_tail_ = (tail + len) % size;
+  return true;
+}
+void Logger::loop() {
+  this->async_active_ = true;
+
+  while (true) {
+    size_t head = this->async_head_;
+    if (head != this->async_tail_ &&
+        (this->async_buffer_size_ - head < 2 ||
+         (this->async_buffer_[head] | this->async_buffer_[head + 1]) == 0)) {
+      // Wrap-around marker
+      head = this->async_head_ = 0;
+    }
+    if (head == this->async_tail_)
+      break;
+
+    const uint8_t *record = this->async_buffer_ + head;
+    const size_t len = record[0] | (record[1] << 8);
+    if (record[2] & ASYNC_BINARY_RECORD) {
+      const char *tag;
+      const char *format;
+      memcpy(&tag, record + 3, sizeof(tag));
+      memcpy(&format, record + 3 + sizeof(tag), sizeof(format));
+      const uint8_t *line = record + 3 + 2 * sizeof(const char *);
+      const uint8_t *args = line + 2;
+      // The record stays in the ring until the callbacks are done, like a formatted one
+      const int level = record[2] & ~ASYNC_BINARY_RECORD;
+#ifdef ARDUINO_ARCH_ESP32
+      if (xPortGetFreeHeapSize() > 2048)
+        this->binary_log_callback_.call(level, tag, line[0] | (line[1] << 8), format, args, record + len - args);
+#else
+      this->binary_log_callback_.call(level, tag, line[0] | (line[1] << 8), format, args, record + len - args);
+#endif
+      this->async_head_ = (head + len) % this->async_buffer_size_;
+      continue;
+    }
+    const int level = record[2];
+    const char *tag = reinterpret_cast<const char *>(record + 3);
+    const char *msg = tag + strlen(tag) + 1;
+
+    if (!this->async_callbacks_done_) {
+      // The record stays in the ring until it has been written, callbacks that log themselves append after it
+#ifdef ARDUINO_ARCH_ESP32
+      if (xPortGetFreeHeapSize() > 2048)
+        this->log_callback_.call(level, tag, msg);
+#else
+      this->log_callback_.call(level, tag, msg);
+#endif
+      this->async_callbacks_done_ = true;
+    }
+
+    if (this->baud_rate_ > 0) {
+      const size_t msg_len = strlen(msg);
+      const size_t total = msg_len + 2;
+      size_t available = this->hw_serial_->availableForWrite();
+      while (available > 0 && this->async_sent_ < total) {
+        const size_t chunk = std::min(available, msg_len > this->async_sent_ ? msg_len - this->async_sent_ : 0);
+        if (chunk > 0) {
+          this->hw_serial_->write(reinterpret_cast<const uint8_t *>(msg) + this->async_sent_, chunk);
+        } else {
+          this->hw_serial_->write(this->async_sent_ == msg_len ? '\r' : '\n');
+        }
+        const size_t written = chunk > 0 ? chunk : 1;
+        this->async_sent_ += written;
+        available -= written;
+      }
+      if (this->async_sent_ < total)
+        break;
+    }
+
+    this->async_sent_ = 0;
+    this->async_callbacks_done_ = false;
+    this->async_head_ = (head + len) % this->async_buffer_size_;
+  }
+
+  if (this->async_head_ == this->async_tail_) {
+    this->high_freq_.stop();
+    if (this->dropped_messages_ != this->reported_dropped_messages_) {
+      ESP_LOGW(TAG, "%u log messages were dropped, the async buffer was full",
+               this->dropped_messages_ - this->reported_dropped_messages_);
+      this->reported_dropped_messages_ = this->dropped_messages_;
+    }
+  } else {
+    // Keep draining without waiting for the next loop interval
+    this->high_freq_.start();
+  }
+}
+void Logger::set_async_buffer_size(size_t size) {
+  this->async_buffer_size_ = size;
+  this->async_buffer_ = new uint8_t[size];
+}
+#endif
+
 Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size, UARTSelection uart)
     : baud_rate_(baud_rate), tx_buffer_size_(tx_buffer_size), uart_(uart) {
   // add 1 to buffer size for null terminator
@@ -172,11 +493,26 @@ void Logger::pre_setup() {
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
 void Logger::set_log_level(const std::string &tag, int log_level) {
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
+  for (auto &entry : this->tag_level_cache_)
+    entry.tag = nullptr;
 }
 UARTSelection Logger::get_uart() const { return this->uart_; }
 void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
+  this->has_unfiltered_callback_ = true;
   this->log_callback_.add(std::move(callback));
 }
+void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback,
+                                 const int *level) {
+  this->callback_levels_.push_back(level);
+  this->log_callback_.add(std::move(callback));
+}
+void Logger::add_on_binary_log_callback(
+    std::function<void(int, const char *, int, const char *, const uint8_t *, size_t)> &&callback, const int *level) {
+  if (this->binary_buffer_ == nullptr)
+    this->binary_buffer_ = new uint8_t[this->tx_buffer_size_];
+  this->binary_callback_levels_.push_back(level);
+  this->binary_log_callback_.add(std::move(callback));
+}
 float Logger::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 const char *const LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
 #ifdef ARDUINO_ARCH_ESP32
@@ -190,6 +526,10 @@ void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[ESPHOME_LOG_LEVEL]);
   ESP_LOGCONFIG(TAG, "  Log Baud Rate: %u", this->baud_rate_);
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", UART_SELECTIONS[this->uart_]);
+#ifdef USE_LOGGER_ASYNC
+  ESP_LOGCONFIG(TAG, "  Async Buffer Size: %u", this->async_buffer_size_);
+  ESP_LOGCONFIG(TAG, "  Dropped Messages: %u", this->dropped_messages_);
+#endif
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
@@ -40,6 +40,18 @@ class Logger : public Component {
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
 
+#ifdef USE_LOGGER_ASYNC
+  /** Queue log messages in a ring buffer of the given size and write them to the UART from loop().
+   *
+   * Logging then no longer waits for the UART, messages that don't fit in the ring are dropped and counted.
+   * Log callbacks (API, MQTT, on_message) are called from loop() too.
+   */
+  void set_async_buffer_size(size_t size);
+  /// The number of messages dropped because the async buffer was full.
+  uint32_t get_dropped_messages() const { return this->dropped_messages_; }
+  void loop() override;
+#endif
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Set up this component.
@@ -50,6 +62,22 @@ class Logger : public Component {
 
   /// Register a callback that will be called for every log message sent
   void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  /** Register a callback that only wants messages up to the level stored at level.
+   *
+   * The owner of level keeps it up to date, for example set it to ESPHOME_LOG_LEVEL_NONE while no client is
+   * connected. When no consumer wants a message (serial logging disabled and all callbacks filtered), the
+   * message isn't formatted at all.
+   */
+  void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback, const int *level);
+  /** Register a callback that gets messages up to the level stored at level without formatting them.
+   *
+   * It's called with the level, tag, line and format string of the message and its arguments encoded by
+   * encode_log_args(). A message that no other consumer wants isn't formatted at all, its arguments are only
+   * encoded. The tag and format string are always string literals, so a client that has the firmware can
+   * identify them by their address.
+   */
+  void add_on_binary_log_callback(
+      std::function<void(int, const char *, int, const char *, const uint8_t *, size_t)> &&callback, const int *level);
 
   float get_setup_priority() const override;
 
@@ -62,6 +90,30 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+  void log_binary_(int level, const char *tag, int line, const char *format, bool format_in_flash, va_list args);
+  /// Whether any consumer (serial or callback) wants a message of this level.
+  inline bool is_level_consumed_(int level) const {
+    if (this->baud_rate_ > 0 || this->has_unfiltered_callback_)
+      return true;
+    for (const int *callback_level : this->callback_levels_) {
+      if (level <= *callback_level)
+        return true;
+    }
+    return false;
+  }
+  /// Whether any binary callback wants a message of this level.
+  inline bool is_level_binary_consumed_(int level) const {
+    for (const int *callback_level : this->binary_callback_levels_) {
+      if (level <= *callback_level)
+        return true;
+    }
+    return false;
+  }
+#ifdef USE_LOGGER_ASYNC
+  bool push_async_(int level, const char *tag, const char *msg);
+  /// Append a record of the two parts to the ring, `level` has ASYNC_BINARY_RECORD set for binary messages.
+  bool push_async_record_(uint8_t level, const void *first, size_t first_len, const void *second, size_t second_len);
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -112,20 +164,66 @@ class Logger : public Component {
     int level;
   };
   std::vector<LogLevelOverride> log_levels_;
+  /// Direct-mapped cache of level_for() results, keyed by the address of the tag.
+  static const uint8_t TAG_LEVEL_CACHE_SIZE = 16;
+  struct TagLevelCacheEntry {
+    const char *tag;
+    int level;
+  };
+  TagLevelCacheEntry tag_level_cache_[TAG_LEVEL_CACHE_SIZE]{};
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+  bool has_unfiltered_callback_{false};
+  std::vector<const int *> callback_levels_;
+  CallbackManager<void(int, const char *, int, const char *, const uint8_t *, size_t)> binary_log_callback_{};
+  std::vector<const int *> binary_callback_levels_;
+  /// The encoded arguments of the current binary message, tx_buffer_size_ bytes once a binary callback is added.
+  uint8_t *binary_buffer_{nullptr};
+#ifdef USE_LOGGER_ASYNC
+  /** Ring of records [length low, length high, level, tag..., '\0', message..., '\0'].
+   *
+   * Binary messages are stored as [length low, length high, level | ASYNC_BINARY_RECORD, tag pointer, format
+   * pointer, line low, line high, arguments...].
+   *
+   * Records never wrap around the end: a length of 0 (or less than two bytes left) marks that the next
+   * record starts at offset 0. async_head_ == async_tail_ means the ring is empty.
+   */
+  uint8_t *async_buffer_{nullptr};
+  size_t async_buffer_size_{0};
+  volatile size_t async_head_{0};
+  volatile size_t async_tail_{0};
+  /// Bytes of the record at async_head_ already written to the UART, including the trailing "\r\n".
+  size_t async_sent_{0};
+  bool async_callbacks_done_{false};
+  /// Until loop() runs for the first time, messages are written synchronously.
+  bool async_active_{false};
+  uint32_t dropped_messages_{0};
+  uint32_t reported_dropped_messages_{0};
+  HighFrequencyLoopRequester high_freq_;
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
+/** Encode the arguments of a printf format string for a binary log message, returns the number of bytes written.
+ *
+ * The arguments are stored little endian in the order of the conversions: integers, characters, pointers and `*`
+ * widths as 4 bytes, `ll` and `j` integers and all floating point values (as double) as 8 bytes and strings NUL
+ * terminated. A string that doesn't fit in `size` is cut off and ends the arguments, and so does a conversion
+ * that isn't known (the types of the arguments after it are unknown too).
+ */
+size_t encode_log_args(const char *format, bool format_in_flash, va_list args, uint8_t *out, size_t size);
+
 class LoggerMessageTrigger : public Trigger<int, const char *, const char *> {
  public:
   explicit LoggerMessageTrigger(Logger *parent, int level) {
     this->level_ = level;
-    parent->add_on_log_callback([this](int level, const char *tag, const char *message) {
-      if (level <= this->level_) {
-        this->trigger(level, tag, message);
-      }
-    });
+    parent->add_on_log_callback(
+        [this](int level, const char *tag, const char *message) {
+          if (level <= this->level_) {
+            this->trigger(level, tag, message);
+          }
+        },
+        &this->level_);
   }
 
  protected:
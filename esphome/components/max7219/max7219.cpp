@@ -118,8 +118,11 @@ void MAX7219Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up MAX7219...");
   this->spi_setup();
   this->buffer_ = new uint8_t[this->num_chips_ * 8];
-  for (uint8_t i = 0; i < this->num_chips_ * 8; i++)
+  this->sent_buffer_ = new uint8_t[this->num_chips_ * 8];
+  for (uint8_t i = 0; i < this->num_chips_ * 8; i++) {
     this->buffer_[i] = 0;
+    this->sent_buffer_[i] = 0;
+  }
 
   // let's assume the user has all 8 digits connected, only important in daisy chained setups anyway
   this->send_to_all_(MAX7219_REGISTER_SCAN_LIMIT, 7);
@@ -140,15 +143,27 @@ void MAX7219Component::dump_config() {
 }
 
 void MAX7219Component::display() {
+  // One register/data pair per chip, all shifted out in a single write
+  std::vector<uint8_t> frame(this->num_chips_ * 2u);
   for (uint8_t i = 0; i < 8; i++) {
+    // Digits that did not change on any chip in the chain are not sent again
+    bool changed = !this->sent_valid_;
+    for (uint8_t j = 0; j < this->num_chips_; j++) {
+      uint8_t index = reverse_ ? (num_chips_ - j - 1) * 8 + i : j * 8 + i;
+      frame[j * 2] = 8 - i;
+      frame[j * 2 + 1] = buffer_[index];
+      if (this->sent_buffer_[index] != buffer_[index]) {
+        this->sent_buffer_[index] = buffer_[index];
+        changed = true;
+      }
+    }
+    if (!changed)
+      continue;
     this->enable();
-    for (uint8_t j = 0; j < this->num_chips_; j++)
-      if (reverse_)
-        this->send_byte_(8 - i, buffer_[(num_chips_ - j - 1) * 8 + i]);
-      else
-        this->send_byte_(8 - i, buffer_[j * 8 + i]);
+    this->write_array(frame);
     this->disable();
   }
+  this->sent_valid_ = true;
 }
 void MAX7219Component::send_byte_(uint8_t a_register, uint8_t data) {
   this->write_byte(a_register);
@@ -221,14 +236,16 @@ void MAX7219Component::set_intensity(uint8_t intensity) {
 void MAX7219Component::set_num_chips(uint8_t num_chips) { this->num_chips_ = num_chips; }
 
 #ifdef USE_TIME
-uint8_t MAX7219Component::strftime(uint8_t pos, const char *format, time::ESPTime time) {
+uint8_t MAX7219Component::strftime(uint8_t pos, const char *format, const time::ESPTime &time) {
   char buffer[64];
   size_t ret = time.strftime(buffer, sizeof(buffer), format);
   if (ret > 0)
     return this->print(pos, buffer);
   return 0;
 }
-uint8_t MAX7219Component::strftime(const char *format, time::ESPTime time) { return this->strftime(0, format, time); }
+uint8_t MAX7219Component::strftime(const char *format, const time::ESPTime &time) {
+  return this->strftime(0, format, time);
+}
 #endif
 
 }  // namespace max7219
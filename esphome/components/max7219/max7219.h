@@ -48,10 +48,10 @@ class MAX7219Component : public PollingComponent,
 
 #ifdef USE_TIME
   /// Evaluate the strftime-format and print the result at the given position.
-  uint8_t strftime(uint8_t pos, const char *format, time::ESPTime time) __attribute__((format(strftime, 3, 0)));
+  uint8_t strftime(uint8_t pos, const char *format, const time::ESPTime &time) __attribute__((format(strftime, 3, 0)));
 
   /// Evaluate the strftime-format and print the result at position 0.
-  uint8_t strftime(const char *format, time::ESPTime time) __attribute__((format(strftime, 2, 0)));
+  uint8_t strftime(const char *format, const time::ESPTime &time) __attribute__((format(strftime, 2, 0)));
 #endif
 
  protected:
@@ -61,6 +61,9 @@ class MAX7219Component : public PollingComponent,
   uint8_t intensity_{15};  /// Intensity of the display from 0 to 15 (most)
   uint8_t num_chips_{1};
   uint8_t *buffer_;
+  /// The digits as last sent to the chips, only changed digits are sent again
+  uint8_t *sent_buffer_;
+  bool sent_valid_{false};
   bool reverse_{false};
   optional<max7219_writer_t> writer_{};
 };
@@ -28,6 +28,8 @@ void MAX7219Component::setup() {
   this->max_displaybuffer_.reserve(500);  // Create base space to write buffer
   // Initialize buffer with 0 for display so all non written pixels are blank
   this->max_displaybuffer_.resize(this->num_chips_ * 8, 0);
+  this->digit_buffer_.resize(this->num_chips_ * 8, 0);
+  this->sent_buffer_.resize(this->num_chips_ * 8, 0);
   // let's assume the user has all 8 digits connected, only important in daisy chained setups anyway
   this->send_to_all_(MAX7219_REGISTER_SCAN_LIMIT, 7);
   // let's use our own ASCII -> led pattern encoding
@@ -105,7 +107,7 @@ void MAX7219Component::display() {
   // Run this loop for every MAX CHIP (GRID OF 64 leds)
   // Run this routine for the rows of every chip 8x row 0 top to 7 bottom
   // Fill the pixel parameter with diplay data
-  // Send the data to the chip
+  // Convert the data to the digit registers of the chip
   for (uint8_t i = 0; i < this->num_chips_; i++) {
     for (uint8_t j = 0; j < 8; j++) {
       if (this->reverse_) {
@@ -114,8 +116,28 @@ void MAX7219Component::display() {
         pixels[j] = this->max_displaybuffer_[i * 8 + j];
       }
     }
-    this->send64pixels(i, pixels);
+    for (uint8_t col = 0; col < 8; col++)
+      this->digit_buffer_[i * 8 + col] = this->digit_register_(pixels, col);
   }
+
+  // Send each digit register to all chips at once, but only if it changed on any of them. Scrolling changes all
+  // registers, but a static or partly changing display is not retransmitted.
+  for (uint8_t col = 0; col < 8; col++) {
+    // The digit registers are undefined after power up, so the first display() sends all of them
+    bool changed = !this->sent_valid_;
+    for (uint8_t i = 0; i < this->num_chips_ && !changed; i++)
+      changed = this->digit_buffer_[i * 8 + col] != this->sent_buffer_[i * 8 + col];
+    if (!changed)
+      continue;
+
+    this->enable();
+    for (uint8_t i = 0; i < this->num_chips_; i++) {
+      this->send_byte_(col + 1, this->digit_buffer_[i * 8 + col]);
+      this->sent_buffer_[i * 8 + col] = this->digit_buffer_[i * 8 + col];
+    }
+    this->disable();
+  }
+  this->sent_valid_ = true;
 }
 
 int MAX7219Component::get_height_internal() {
@@ -217,33 +239,35 @@ void MAX7219Component::send_char(uint8_t chip, uint8_t data) {
 
 // send one character (data) to position (chip)
 
+uint8_t MAX7219Component::digit_register_(const uint8_t pixels[8], uint8_t col) {
+  uint8_t b = 0;  // rotate pixels 90 degrees -- set byte to 0
+  if (this->orientation_ == 0) {
+    for (uint8_t i = 0; i < 8; i++) {
+      // run this loop 8 times for all the pixels[8] received
+      b |= ((pixels[i] >> col) & 1) << (7 - i);  // change the column bits into row bits
+    }
+  } else if (this->orientation_ == 1) {
+    b = pixels[col];
+  } else if (this->orientation_ == 2) {
+    for (uint8_t i = 0; i < 8; i++) {
+      b |= ((pixels[i] >> (7 - col)) & 1) << i;
+    }
+  } else {
+    b = pixels[7 - col];
+  }
+  return this->invert_ ? ~b : b;
+}
+
 void MAX7219Component::send64pixels(uint8_t chip, const uint8_t pixels[8]) {
   for (uint8_t col = 0; col < 8; col++) {  // RUN THIS LOOP 8 times until column is 7
     this->enable();                        // start sending by enabling SPI
     for (uint8_t i = 0; i < chip; i++)     // send extra NOPs to push the pixels out to extra displays
       this->send_byte_(MAX7219_REGISTER_NOOP,
                        MAX7219_REGISTER_NOOP);  // run this loop unit the matching chip is reached
-    uint8_t b = 0;                              // rotate pixels 90 degrees -- set byte to 0
-    if (this->orientation_ == 0) {
-      for (uint8_t i = 0; i < 8; i++) {
-        // run this loop 8 times for all the pixels[8] received
-        b |= ((pixels[i] >> col) & 1) << (7 - i);  // change the column bits into row bits
-      }
-    } else if (this->orientation_ == 1) {
-      b = pixels[col];
-    } else if (this->orientation_ == 2) {
-      for (uint8_t i = 0; i < 8; i++) {
-        b |= ((pixels[i] >> (7 - col)) & 1) << i;
-      }
-    } else {
-      b = pixels[7 - col];
-    }
     // send this byte to dispay at selected chip
-    if (this->invert_) {
-      this->send_byte_(col + 1, ~b);
-    } else {
-      this->send_byte_(col + 1, b);
-    }
+    uint8_t b = this->digit_register_(pixels, col);
+    this->send_byte_(col + 1, b);
+    this->sent_buffer_[chip * 8 + col] = b;
     for (int i = 0; i < this->num_chips_ - chip - 1; i++)  // end with enough NOPs so later chips don't update
       this->send_byte_(MAX7219_REGISTER_NOOP, MAX7219_REGISTER_NOOP);
     this->disable();  // all done disable SPI
@@ -284,14 +308,14 @@ uint8_t MAX7219Component::printdigitf(const char *format, ...) {
 }
 
 #ifdef USE_TIME
-uint8_t MAX7219Component::strftimedigit(uint8_t pos, const char *format, time::ESPTime time) {
+uint8_t MAX7219Component::strftimedigit(uint8_t pos, const char *format, const time::ESPTime &time) {
   char buffer[64];
   size_t ret = time.strftime(buffer, sizeof(buffer), format);
   if (ret > 0)
     return this->printdigit(pos, buffer);
   return 0;
 }
-uint8_t MAX7219Component::strftimedigit(const char *format, time::ESPTime time) {
+uint8_t MAX7219Component::strftimedigit(const char *format, const time::ESPTime &time) {
   return this->strftimedigit(0, format, time);
 }
 #endif
@@ -75,15 +75,18 @@ class MAX7219Component : public PollingComponent,
 
 #ifdef USE_TIME
   /// Evaluate the strftime-format and print the result at the given position.
-  uint8_t strftimedigit(uint8_t pos, const char *format, time::ESPTime time) __attribute__((format(strftime, 3, 0)));
+  uint8_t strftimedigit(uint8_t pos, const char *format, const time::ESPTime &time)
+      __attribute__((format(strftime, 3, 0)));
 
   /// Evaluate the strftime-format and print the result at position 0.
-  uint8_t strftimedigit(const char *format, time::ESPTime time) __attribute__((format(strftime, 2, 0)));
+  uint8_t strftimedigit(const char *format, const time::ESPTime &time) __attribute__((format(strftime, 2, 0)));
 #endif
 
  protected:
   void send_byte_(uint8_t a_register, uint8_t data);
   void send_to_all_(uint8_t a_register, uint8_t data);
+  /// The value of digit register `col` + 1 for the 8x8 `pixels` of one chip, rotated and inverted as configured.
+  uint8_t digit_register_(const uint8_t pixels[8], uint8_t col);
 
   uint8_t intensity_;  /// Intensity of the display from 0 to 15 (most)
   uint8_t num_chips_;
@@ -99,6 +102,10 @@ class MAX7219Component : public PollingComponent,
   uint8_t orientation_;
   uint8_t bckgrnd_ = 0x0;
   std::vector<uint8_t> max_displaybuffer_;
+  /// The digit registers of all chips for the current frame, and as last sent to the chips
+  std::vector<uint8_t> digit_buffer_;
+  std::vector<uint8_t> sent_buffer_;
+  bool sent_valid_{false};
   uint32_t last_scroll_ = 0;
   uint16_t stepsleft_;
   size_t get_buffer_length_();
@@ -14,14 +14,26 @@ void MCP23017::setup() {
     return;
   }
 
+  uint8_t config = 0x00;
   if (this->open_drain_ints_) {
     // enable open-drain interrupt pins, 3.3V-safe
-    this->write_reg(mcp23x17_base::MCP23X17_IOCONA, 0x04);
-    this->write_reg(mcp23x17_base::MCP23X17_IOCONB, 0x04);
+    config |= 0x04;
+  }
+  if (this->interrupt_pin_ != nullptr) {
+    // mirror INTA and INTB, so that one pin signals changes on both ports
+    config |= 0x40;
+    this->interrupt_pin_->setup();
+  }
+  if (config != 0x00) {
+    this->write_reg(mcp23x17_base::MCP23X17_IOCONA, config);
+    this->write_reg(mcp23x17_base::MCP23X17_IOCONB, config);
   }
 }
 
-void MCP23017::dump_config() { ESP_LOGCONFIG(TAG, "MCP23017:"); }
+void MCP23017::dump_config() {
+  ESP_LOGCONFIG(TAG, "MCP23017:");
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
+}
 
 bool MCP23017::read_reg(uint8_t reg, uint8_t *value) {
   if (this->is_failed())
@@ -29,6 +41,12 @@ bool MCP23017::read_reg(uint8_t reg, uint8_t *value) {
 
   return this->read_byte(reg, value);
 }
+bool MCP23017::read_regs(uint8_t reg, uint8_t *data, uint8_t len) {
+  if (this->is_failed())
+    return false;
+
+  return this->read_bytes(reg, data, len);
+}
 bool MCP23017::write_reg(uint8_t reg, uint8_t value) {
   if (this->is_failed())
     return false;
@@ -17,6 +17,7 @@ class MCP23017 : public mcp23x17_base::MCP23X17Base, public i2c::I2CDevice {
 
  protected:
   bool read_reg(uint8_t reg, uint8_t *value) override;
+  bool read_regs(uint8_t reg, uint8_t *data, uint8_t len) override;
   bool write_reg(uint8_t reg, uint8_t value) override;
 };
 
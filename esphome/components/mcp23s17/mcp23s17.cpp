@@ -23,7 +23,11 @@ void MCP23S17::setup() {
   this->transfer_byte(0b00011000);  // Enable HAEN pins for addressing
   this->disable();
 
-  if (this->open_drain_ints_) {
+  if (this->interrupt_pin_ != nullptr) {
+    // mirror INTA and INTB, so that one pin signals changes on both ports, keep HAEN enabled
+    this->write_reg(mcp23x17_base::MCP23X17_IOCONA, this->open_drain_ints_ ? 0b01011100 : 0b01011000);
+    this->interrupt_pin_->setup();
+  } else if (this->open_drain_ints_) {
     // enable open-drain interrupt pins, 3.3V-safe
     this->write_reg(mcp23x17_base::MCP23X17_IOCONA, 0x04);
     this->write_reg(mcp23x17_base::MCP23X17_IOCONB, 0x04);
@@ -33,6 +37,7 @@ void MCP23S17::setup() {
 void MCP23S17::dump_config() {
   ESP_LOGCONFIG(TAG, "MCP23S17:");
   LOG_PIN("  CS Pin: ", this->cs_);
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
 }
 
 bool MCP23S17::read_reg(uint8_t reg, uint8_t *value) {
@@ -44,6 +49,17 @@ bool MCP23S17::read_reg(uint8_t reg, uint8_t *value) {
   return true;
 }
 
+bool MCP23S17::read_regs(uint8_t reg, uint8_t *data, uint8_t len) {
+  // sequential mode (SEQOP cleared) increments the address after each byte
+  this->enable();
+  this->transfer_byte(this->device_opcode_ | 1);
+  this->transfer_byte(reg);
+  for (uint8_t i = 0; i < len; i++)
+    data[i] = this->transfer_byte(0xFF);
+  this->disable();
+  return true;
+}
+
 bool MCP23S17::write_reg(uint8_t reg, uint8_t value) {
   this->enable();
   this->transfer_byte(this->device_opcode_);
@@ -20,6 +20,7 @@ class MCP23S17 : public mcp23x17_base::MCP23X17Base,
 
  protected:
   bool read_reg(uint8_t reg, uint8_t *value) override;
+  bool read_regs(uint8_t reg, uint8_t *data, uint8_t len) override;
   bool write_reg(uint8_t reg, uint8_t value) override;
 
   uint8_t device_opcode_ = 0x40;
@@ -7,11 +7,14 @@ namespace mcp23x08_base {
 static const char *const TAG = "mcp23x08_base";
 
 bool MCP23X08Base::digital_read(uint8_t pin) {
-  uint8_t bit = pin % 8;
-  uint8_t reg_addr = mcp23x08_base::MCP23X08_GPIO;
-  uint8_t value = 0;
-  this->read_reg(reg_addr, &value);
-  return value & (1 << bit);
+  if (!this->gpio_cache_valid_) {
+    uint8_t value;
+    if (this->read_reg(mcp23x08_base::MCP23X08_GPIO, &value)) {
+      this->gpio_cache_ = value;
+      this->gpio_cache_valid_ = true;
+    }
+  }
+  return this->gpio_cache_ & (1 << (pin % 8));
 }
 
 void MCP23X08Base::digital_write(uint8_t pin, bool value) {
@@ -79,6 +82,8 @@ void MCP23X08Base::update_reg(uint8_t pin, bool pin_value, uint8_t reg_addr) {
     reg_value &= ~(1 << bit);
 
   this->write_reg(reg_addr, reg_value);
+  // outputs, pull-ups and interrupt settings can all change what GPIO reads back
+  this->gpio_cache_valid_ = false;
 
   if (reg_addr == mcp23x08_base::MCP23X08_OLAT) {
     this->olat_ = reg_value;
@@ -7,11 +7,15 @@ namespace mcp23x17_base {
 static const char *const TAG = "mcp23x17_base";
 
 bool MCP23X17Base::digital_read(uint8_t pin) {
-  uint8_t bit = pin % 8;
-  uint8_t reg_addr = pin < 8 ? mcp23x17_base::MCP23X17_GPIOA : mcp23x17_base::MCP23X17_GPIOB;
-  uint8_t value = 0;
-  this->read_reg(reg_addr, &value);
-  return value & (1 << bit);
+  if (!this->gpio_cache_valid_) {
+    // GPIOA and GPIOB are adjacent, so both ports are read in one sequential transaction
+    uint8_t data[2];
+    if (this->read_regs(mcp23x17_base::MCP23X17_GPIOA, data, 2)) {
+      this->gpio_cache_ = (uint16_t(data[1]) << 8) | data[0];
+      this->gpio_cache_valid_ = true;
+    }
+  }
+  return this->gpio_cache_ & (1 << pin);
 }
 
 void MCP23X17Base::digital_write(uint8_t pin, bool value) {
@@ -81,6 +85,8 @@ void MCP23X17Base::update_reg(uint8_t pin, bool pin_value, uint8_t reg_addr) {
     reg_value &= ~(1 << bit);
 
   this->write_reg(reg_addr, reg_value);
+  // outputs, pull-ups and interrupt settings can all change what GPIO reads back
+  this->gpio_cache_valid_ = false;
 
   if (reg_addr == mcp23x17_base::MCP23X17_OLATA) {
     this->olat_a_ = reg_value;
@@ -7,6 +7,7 @@ from esphome.const import (
     CONF_MODE,
     CONF_INVERTED,
     CONF_INTERRUPT,
+    CONF_INTERRUPT_PIN,
     CONF_OPEN_DRAIN_INTERRUPT,
 )
 from esphome.core import coroutine
@@ -35,6 +36,7 @@ MCP23XXX_GPIO_MODES = {
 MCP23XXX_CONFIG_SCHEMA = cv.Schema(
     {
         cv.Optional(CONF_OPEN_DRAIN_INTERRUPT, default=False): cv.boolean,
+        cv.Optional(CONF_INTERRUPT_PIN): pins.internal_gpio_input_pin_schema,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -44,6 +46,9 @@ async def register_mcp23xxx(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     cg.add(var.set_open_drain_ints(config[CONF_OPEN_DRAIN_INTERRUPT]))
+    if CONF_INTERRUPT_PIN in config:
+        interrupt_pin = await cg.gpio_pin_expression(config[CONF_INTERRUPT_PIN])
+        cg.add(var.set_interrupt_pin(interrupt_pin))
     return var
 
 
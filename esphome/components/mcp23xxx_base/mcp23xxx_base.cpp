@@ -6,13 +6,31 @@ namespace mcp23xxx_base {
 
 float MCP23XXXBase::get_setup_priority() const { return setup_priority::IO; }
 
+void MCP23XXXBase::loop() {
+  // INT is active low and stays asserted until the GPIO registers are read
+  if (this->interrupt_pin_ != nullptr && this->interrupt_pin_->digital_read())
+    return;
+  this->gpio_cache_valid_ = false;
+}
+
+bool MCP23XXXBase::read_regs(uint8_t reg, uint8_t *data, uint8_t len) {
+  for (uint8_t i = 0; i < len; i++) {
+    if (!this->read_reg(reg + i, &data[i]))
+      return false;
+  }
+  return true;
+}
+
 MCP23XXXGPIOPin::MCP23XXXGPIOPin(MCP23XXXBase *parent, uint8_t pin, uint8_t mode, bool inverted,
                                  MCP23XXXInterruptMode interrupt_mode)
     : GPIOPin(pin, mode, inverted), parent_(parent), interrupt_mode_(interrupt_mode) {}
 void MCP23XXXGPIOPin::setup() { this->pin_mode(this->mode_); }
 void MCP23XXXGPIOPin::pin_mode(uint8_t mode) {
   this->parent_->pin_mode(this->pin_, mode);
-  this->parent_->pin_interrupt_mode(this->pin_, this->interrupt_mode_);
+  MCP23XXXInterruptMode interrupt_mode = this->interrupt_mode_;
+  if (interrupt_mode == MCP23XXX_NO_INTERRUPT && mode != MCP23XXX_OUTPUT && this->parent_->has_interrupt_pin())
+    interrupt_mode = MCP23XXX_CHANGE;
+  this->parent_->pin_interrupt_mode(this->pin_, interrupt_mode);
 }
 bool MCP23XXXGPIOPin::digital_read() { return this->parent_->digital_read(this->pin_) != this->inverted_; }
 void MCP23XXXGPIOPin::digital_write(bool value) { this->parent_->digital_write(this->pin_, value != this->inverted_); }
@@ -23,17 +23,31 @@ class MCP23XXXBase : public Component {
   virtual void pin_interrupt_mode(uint8_t pin, MCP23XXXInterruptMode interrupt_mode);
 
   void set_open_drain_ints(const bool value) { this->open_drain_ints_ = value; }
+  /** Only refresh the GPIO snapshot when this pin, connected to the (mirrored) INT output, is low.
+   *
+   * Input pins without an explicit interrupt mode then interrupt on change, so that no change is missed.
+   */
+  void set_interrupt_pin(GPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
+  bool has_interrupt_pin() const { return this->interrupt_pin_ != nullptr; }
   float get_setup_priority() const override;
+  /// Invalidate the GPIO snapshot once per loop iteration, or only after an interrupt if an INT pin is set.
+  void loop() override;
 
  protected:
   // read a given register
   virtual bool read_reg(uint8_t reg, uint8_t *value);
+  // read `len` consecutive registers, starting at `reg`
+  virtual bool read_regs(uint8_t reg, uint8_t *data, uint8_t len);
   // write a value to a given register
   virtual bool write_reg(uint8_t reg, uint8_t value);
   // update registers with given pin value.
   virtual void update_reg(uint8_t pin, bool pin_value, uint8_t reg_a);
 
   bool open_drain_ints_;
+  GPIOPin *interrupt_pin_{nullptr};
+  /// The GPIO registers read in this loop iteration, all reads share one bus transaction
+  uint16_t gpio_cache_{0};
+  bool gpio_cache_valid_{false};
 };
 
 class MCP23XXXGPIOPin : public GPIOPin {
@@ -15,6 +15,8 @@ const struct MCP2515::RxBnRegs MCP2515::RXB[N_RXBUFFERS] = {{MCP_RXB0CTRL, MCP_R
 
 bool MCP2515::setup_internal() {
   this->spi_setup();
+  if (this->interrupt_pin_ != nullptr)
+    this->interrupt_pin_->setup();
 
   if (this->reset_() == canbus::ERROR_FAIL)
     return false;
@@ -24,6 +26,70 @@ bool MCP2515::setup_internal() {
   return true;
 }
 
+void MCP2515::loop() {
+  // The triggers register themselves during their setup, after ours
+  if (!this->filters_set_) {
+    this->filters_set_ = true;
+    this->setup_filters_();
+  }
+  canbus::Canbus::loop();
+}
+
+void MCP2515::setup_filters_() {
+  std::vector<uint32_t> std_ids;
+  std::vector<uint32_t> ext_ids;
+  for (auto *trigger : this->triggers_) {
+    auto &ids = trigger->get_use_extended_id() ? ext_ids : std_ids;
+    if (std::find(ids.begin(), ids.end(), trigger->get_can_id()) == ids.end())
+      ids.push_back(trigger->get_can_id());
+  }
+  if (std_ids.empty() && ext_ids.empty())
+    return;
+
+  // RXB0 has two filters and RXB1 four, give the larger group of IDs to RXB1. Frames that match RXB0 roll
+  // over to RXB1 when it is full.
+  static const RXF RXB0_FILTERS[] = {RXF0, RXF1};
+  static const RXF RXB1_FILTERS[] = {RXF2, RXF3, RXF4, RXF5};
+  bool rxb1_extended = ext_ids.size() >= std_ids.size();
+  const auto &rxb1_ids = rxb1_extended ? ext_ids : std_ids;
+  const auto &rxb0_ids = rxb1_extended ? std_ids : ext_ids;
+  if (rxb0_ids.empty()) {
+    // Only one kind of ID, spread them over all six filters
+    std::vector<uint32_t> ids0(rxb1_ids.begin(), rxb1_ids.begin() + std::min<size_t>(2, rxb1_ids.size()));
+    std::vector<uint32_t> ids1(rxb1_ids.size() > 2 ? rxb1_ids.begin() + 2 : rxb1_ids.begin(), rxb1_ids.end());
+    if (rxb1_ids.size() > 6) {
+      ids0 = rxb1_ids;
+      ids1 = rxb1_ids;
+    }
+    this->set_filter_group_(MASK0, RXB0_FILTERS, 2, rxb1_extended, ids0);
+    this->set_filter_group_(MASK1, RXB1_FILTERS, 4, rxb1_extended, ids1);
+  } else {
+    this->set_filter_group_(MASK0, RXB0_FILTERS, 2, !rxb1_extended, rxb0_ids);
+    this->set_filter_group_(MASK1, RXB1_FILTERS, 4, rxb1_extended, rxb1_ids);
+  }
+  this->set_mode_(this->mcp_mode_);
+  ESP_LOGD(TAG, "Hardware filters set for %zu standard and %zu extended IDs", std_ids.size(), ext_ids.size());
+}
+
+void MCP2515::set_filter_group_(MASK mask, const RXF *filters, uint8_t n_filters, bool extended,
+                                const std::vector<uint32_t> &ids) {
+  uint32_t full_mask = extended ? 0x1FFFFFFF : 0x7FF;
+  if (ids.size() <= n_filters) {
+    // An exact filter per ID, the unused ones repeat the last ID
+    this->set_filter_mask_(mask, extended, full_mask);
+    for (uint8_t i = 0; i < n_filters; i++)
+      this->set_filter_(filters[i], extended, ids[std::min<size_t>(i, ids.size() - 1)]);
+    return;
+  }
+  // Too many IDs: only compare the bits all of them have in common, Canbus::loop() still checks the exact ID
+  uint32_t differing = 0;
+  for (uint32_t id : ids)
+    differing |= id ^ ids[0];
+  this->set_filter_mask_(mask, extended, full_mask & ~differing);
+  for (uint8_t i = 0; i < n_filters; i++)
+    this->set_filter_(filters[i], extended, ids[0]);
+}
+
 canbus::Error MCP2515::reset_() {
   this->enable();
   this->transfer_byte(INSTRUCTION_RESET);
@@ -233,17 +299,24 @@ canbus::Error MCP2515::set_filter_(const RXF num, const bool extended, const uin
   return canbus::ERROR_OK;
 }
 
-canbus::Error MCP2515::send_message_(TXBn txbn, struct canbus::CanFrame *frame) {
+canbus::Error MCP2515::send_message_(TXBn txbn, struct canbus::CanFrame *frame, uint8_t priority) {
   const struct TxBnRegs *txbuf = &TXB[txbn];
 
-  uint8_t data[13];
+  // CTRL (for the priority), ID, DLC and data in one write, then request to send
+  uint8_t data[14];
 
-  prepare_id_(data, frame->use_extended_id, frame->can_id);
-  data[MCP_DLC] =
+  data[0] = priority;
+  prepare_id_(&data[1], frame->use_extended_id, frame->can_id);
+  data[1 + MCP_DLC] =
       frame->remote_transmission_request ? (frame->can_data_length_code | RTR_MASK) : frame->can_data_length_code;
-  memcpy(&data[MCP_DATA], frame->data, frame->can_data_length_code);
-  set_registers_(txbuf->SIDH, data, 5 + frame->can_data_length_code);
-  modify_register_(txbuf->CTRL, TXB_TXREQ, TXB_TXREQ);
+  memcpy(&data[1 + MCP_DATA], frame->data, frame->can_data_length_code);
+  set_registers_(txbuf->CTRL, data, 6 + frame->can_data_length_code);
+  this->tx_priority_[txbn] = priority;
+
+  static const INSTRUCTION RTS[N_TXBUFFERS] = {INSTRUCTION_RTS_TX0, INSTRUCTION_RTS_TX1, INSTRUCTION_RTS_TX2};
+  this->enable();
+  this->transfer_byte(RTS[txbn]);
+  this->disable();
 
   return canbus::ERROR_OK;
 }
@@ -252,29 +325,40 @@ canbus::Error MCP2515::send_message(struct canbus::CanFrame *frame) {
   if (frame->can_data_length_code > canbus::CAN_MAX_DATA_LENGTH) {
     return canbus::ERROR_FAILTX;
   }
-  TXBn tx_buffers[N_TXBUFFERS] = {TXB0, TXB1, TXB2};
-
-  for (auto &tx_buffer : tx_buffers) {
-    const struct TxBnRegs *txbuf = &TXB[tx_buffer];
-    uint8_t ctrlval = read_register_(txbuf->CTRL);
-    if ((ctrlval & TXB_TXREQ) == 0) {
-      return send_message_(tx_buffer, frame);
+  static const uint8_t STAT_TXREQ[N_TXBUFFERS] = {STAT_TX0REQ, STAT_TX1REQ, STAT_TX2REQ};
+
+  // The buffer with the highest priority is sent first, so give each frame a lower priority than the ones still
+  // pending to send queued frames in order
+  uint8_t status = get_status_();
+  int free_buffer = -1;
+  uint8_t priority = TXB_TXP;
+  for (int i = 0; i < N_TXBUFFERS; i++) {
+    if (status & STAT_TXREQ[i]) {
+      if (this->tx_priority_[i] == 0)
+        return canbus::ERROR_ALLTXBUSY;
+      priority = std::min<uint8_t>(priority, this->tx_priority_[i] - 1);
+    } else if (free_buffer == -1) {
+      free_buffer = i;
     }
   }
+  if (free_buffer == -1)
+    return canbus::ERROR_ALLTXBUSY;
 
-  return canbus::ERROR_FAILTX;
+  return send_message_(static_cast<TXBn>(free_buffer), frame, priority);
 }
 
 canbus::Error MCP2515::read_message_(RXBn rxbn, struct canbus::CanFrame *frame) {
-  const struct RxBnRegs *rxb = &RXB[rxbn];
-
-  uint8_t tbufdata[5];
-
-  read_registers_(rxb->SIDH, tbufdata, 5);
+  // READ RX BUFFER reads the ID, DLC and data in one transaction and clears RXnIF when CS is released
+  uint8_t tbufdata[5 + canbus::CAN_MAX_DATA_LENGTH];
+  this->enable();
+  this->transfer_byte(rxbn == RXB0 ? INSTRUCTION_READ_RX0 : INSTRUCTION_READ_RX1);
+  for (auto &value : tbufdata)
+    value = this->transfer_byte(0x00);
+  this->disable();
 
   uint32_t id = (tbufdata[MCP_SIDH] << 3) + (tbufdata[MCP_SIDL] >> 5);
   bool use_extended_id = false;
-  bool remote_transmission_request = false;
+  bool remote_transmission_request;
 
   if ((tbufdata[MCP_SIDL] & TXB_EXIDE_MASK) == TXB_EXIDE_MASK) {
     id = (id << 2) + (tbufdata[MCP_SIDL] & 0x03);
@@ -282,6 +366,10 @@ canbus::Error MCP2515::read_message_(RXBn rxbn, struct canbus::CanFrame *frame)
     id = (id << 8) + tbufdata[MCP_EID0];
     // id |= canbus::CAN_EFF_FLAG;
     use_extended_id = true;
+    remote_transmission_request = (tbufdata[MCP_DLC] & RTR_MASK) != 0;
+  } else {
+    // SRR, the remote transmission request of standard frames
+    remote_transmission_request = (tbufdata[MCP_SIDL] & 0x10) != 0;
   }
 
   uint8_t dlc = (tbufdata[MCP_DLC] & DLC_MASK);
@@ -289,37 +377,48 @@ canbus::Error MCP2515::read_message_(RXBn rxbn, struct canbus::CanFrame *frame)
     return canbus::ERROR_FAIL;
   }
 
-  uint8_t ctrl = read_register_(rxb->CTRL);
-  if (ctrl & RXB_CTRL_RTR) {
-    // id |= canbus::CAN_RTR_FLAG;
-    remote_transmission_request = true;
-  }
-
   frame->can_id = id;
   frame->can_data_length_code = dlc;
   frame->use_extended_id = use_extended_id;
   frame->remote_transmission_request = remote_transmission_request;
-
-  read_registers_(rxb->DATA, frame->data, dlc);
-
-  modify_register_(MCP_CANINTF, rxb->CANINTF_RXnIF, 0);
+  memcpy(frame->data, &tbufdata[MCP_DATA], dlc);
 
   return canbus::ERROR_OK;
 }
 
 canbus::Error MCP2515::read_message(struct canbus::CanFrame *frame) {
-  canbus::Error rc;
-  uint8_t stat = get_status_();
+  if (this->rx_next_ < this->rx_count_) {
+    *frame = this->rx_frames_[this->rx_next_++];
+    return canbus::ERROR_OK;
+  }
+  this->rx_count_ = this->rx_next_ = 0;
 
+  // INT is low while a frame (or an error) is pending
+  if (this->interrupt_pin_ != nullptr && this->interrupt_pin_->digital_read())
+    return canbus::ERROR_NOMSG;
+
+  // Empty both RX buffers at once, RXB0 first as it holds the older frame when it rolled over to RXB1
+  uint8_t stat = get_status_();
   if (stat & STAT_RX0IF) {
-    rc = read_message_(RXB0, frame);
-  } else if (stat & STAT_RX1IF) {
-    rc = read_message_(RXB1, frame);
-  } else {
-    rc = canbus::ERROR_NOMSG;
+    if (this->read_message_(RXB0, &this->rx_frames_[this->rx_count_]) == canbus::ERROR_OK)
+      this->rx_count_++;
+  }
+  if (stat & STAT_RX1IF) {
+    if (this->read_message_(RXB1, &this->rx_frames_[this->rx_count_]) == canbus::ERROR_OK)
+      this->rx_count_++;
+  }
+  if ((stat & STAT_RXIF_MASK) == 0 && this->interrupt_pin_ != nullptr) {
+    // An error interrupt, for example a receive buffer overflow
+    ESP_LOGV(TAG, "Clearing error flags 0x%02X", this->get_error_flags_());
+    this->clear_rx_n_ovr_flags_();
+    this->clear_merr_();
+    this->clear_errif_();
   }
 
-  return rc;
+  if (this->rx_count_ == 0)
+    return canbus::ERROR_NOMSG;
+  *frame = this->rx_frames_[this->rx_next_++];
+  return canbus::ERROR_OK;
 }
 
 bool MCP2515::check_receive_() {
@@ -47,7 +47,13 @@ enum EFLG : uint8_t {
   EFLG_EWARN = (1 << 0)
 };
 
-enum STAT : uint8_t { STAT_RX0IF = (1 << 0), STAT_RX1IF = (1 << 1) };
+enum STAT : uint8_t {
+  STAT_RX0IF = (1 << 0),
+  STAT_RX1IF = (1 << 1),
+  STAT_TX0REQ = (1 << 2),
+  STAT_TX1REQ = (1 << 4),
+  STAT_TX2REQ = (1 << 6)
+};
 
 static const uint8_t STAT_RXIF_MASK = STAT_RX0IF | STAT_RX1IF;
 static const uint8_t EFLG_ERRORMASK = EFLG_RX1OVR | EFLG_RX0OVR | EFLG_TXBO | EFLG_TXEP | EFLG_RXEP;
@@ -59,6 +65,10 @@ class MCP2515 : public canbus::Canbus,
   MCP2515(){};
   void set_mcp_clock(CanClock clock) { this->mcp_clock_ = clock; };
   void set_mcp_mode(const CanctrlReqopMode mode) { this->mcp_mode_ = mode; }
+  /// The INT pin, when set loop() only talks to the MCP2515 while it signals received frames.
+  void set_interrupt_pin(GPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
+
+  void loop() override;
   static const struct TxBnRegs {
     REGISTER CTRL;
     REGISTER SIDH;
@@ -75,7 +85,20 @@ class MCP2515 : public canbus::Canbus,
  protected:
   CanClock mcp_clock_{MCP_8MHZ};
   CanctrlReqopMode mcp_mode_ = CANCTRL_REQOP_NORMAL;
+  GPIOPin *interrupt_pin_{nullptr};
+  bool filters_set_{false};
+  /// Frames read from both RX buffers in one go, handed out by read_message().
+  canbus::CanFrame rx_frames_[N_RXBUFFERS];
+  uint8_t rx_count_{0};
+  uint8_t rx_next_{0};
+  /// TXP priority of the frame last loaded into each TX buffer.
+  uint8_t tx_priority_[N_TXBUFFERS]{};
+
   bool setup_internal() override;
+  /// Program the acceptance masks and filters from the IDs of the on_frame triggers.
+  void setup_filters_();
+  void set_filter_group_(MASK mask, const RXF *filters, uint8_t n_filters, bool extended,
+                         const std::vector<uint32_t> &ids);
   canbus::Error set_mode_(CanctrlReqopMode mode);
 
   uint8_t read_register_(REGISTER reg);
@@ -91,7 +114,7 @@ class MCP2515 : public canbus::Canbus,
   canbus::Error set_bitrate_(canbus::CanSpeed can_speed, CanClock can_clock);
   canbus::Error set_filter_mask_(MASK mask, bool extended, uint32_t ul_data);
   canbus::Error set_filter_(RXF num, bool extended, uint32_t ul_data);
-  canbus::Error send_message_(TXBn txbn, struct canbus::CanFrame *frame);
+  canbus::Error send_message_(TXBn txbn, struct canbus::CanFrame *frame, uint8_t priority);
   canbus::Error send_message(struct canbus::CanFrame *frame) override;
   canbus::Error read_message_(RXBn rxbn, struct canbus::CanFrame *frame);
   canbus::Error read_message(struct canbus::CanFrame *frame) override;
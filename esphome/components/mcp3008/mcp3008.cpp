@@ -37,6 +37,22 @@ float MCP3008::read_data(uint8_t pin) {
   return data / 1023.0f;
 }
 
+size_t MCP3008::read_many(uint8_t pin, float *out, size_t n, uint32_t rate) {
+  const uint8_t command = ((0x01 << 7) |          // start bit
+                           ((pin & 0x07) << 4));  // channel number
+  voltage_sampler::SamplePacer pacer(rate);
+  for (size_t i = 0; i < n; i++) {
+    // Each conversion starts with CS going low, so only the three bytes of a frame can be chained
+    uint8_t frame[3] = {0x01, command, 0x00};
+    pacer.wait();
+    this->enable();
+    this->transfer_array(frame, sizeof(frame));
+    this->disable();
+    out[i] = ((frame[1] & 0x03) << 8 | frame[2]) / 1023.0f;
+  }
+  return n;
+}
+
 MCP3008Sensor::MCP3008Sensor(MCP3008 *parent, const std::string &name, uint8_t pin, float reference_voltage)
     : PollingComponent(1000), parent_(parent), pin_(pin) {
   this->set_name(name);
@@ -56,6 +72,12 @@ float MCP3008Sensor::sample() {
   value_v = (value_v * this->reference_voltage_);
   return value_v;
 }
+size_t MCP3008Sensor::sample_many(float *out, size_t n, uint32_t rate) {
+  const size_t count = this->parent_->read_many(this->pin_, out, n, rate);
+  for (size_t i = 0; i < count; i++)
+    out[i] *= this->reference_voltage_;
+  return count;
+}
 void MCP3008Sensor::update() { this->publish_state(this->sample()); }
 
 }  // namespace mcp3008
@@ -20,6 +20,8 @@ class MCP3008 : public Component,
   void dump_config() override;
   float get_setup_priority() const override;
   float read_data(uint8_t pin);
+  /// Read `n` conversions of `pin` (as a fraction of the reference voltage), `rate` per second or back to back.
+  size_t read_many(uint8_t pin, float *out, size_t n, uint32_t rate);
 
  protected:
 };
@@ -34,6 +36,7 @@ class MCP3008Sensor : public PollingComponent, public sensor::Sensor, public vol
   void dump_config() override;
   float get_setup_priority() const override;
   float sample() override;
+  size_t sample_many(float *out, size_t n, uint32_t rate) override;
 
  protected:
   MCP3008 *parent_;
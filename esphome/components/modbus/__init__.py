@@ -13,11 +13,15 @@ ModbusDevice = modbus_ns.class_("ModbusDevice")
 MULTI_CONF = True
 
 CONF_MODBUS_ID = "modbus_id"
+CONF_SEND_WAIT_TIME = "send_wait_time"
 CONFIG_SCHEMA = (
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(Modbus),
             cv.Optional(CONF_FLOW_CONTROL_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(
+                CONF_SEND_WAIT_TIME, default="250ms"
+            ): cv.positive_time_period_milliseconds,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -36,6 +40,8 @@ async def to_code(config):
         pin = await gpio_pin_expression(config[CONF_FLOW_CONTROL_PIN])
         cg.add(var.set_flow_control_pin(pin))
 
+    cg.add(var.set_send_wait_time(config[CONF_SEND_WAIT_TIME]))
+
 
 def modbus_device_schema(default_address):
     schema = {
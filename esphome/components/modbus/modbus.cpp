@@ -1,5 +1,7 @@
 #include "modbus.h"
 #include "esphome/core/log.h"
+#include "esphome/core/crc.h"
+#include <algorithm>
 
 namespace esphome {
 namespace modbus {
@@ -10,6 +12,11 @@ void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
   }
+  this->add_on_receive_callback([this]() { this->enable_loop(); });
+
+  // 3.5 characters of 11 bits, the spec fixes it at 1.75ms above 19200 baud
+  const uint32_t baud_rate = this->parent_->get_baud_rate();
+  this->frame_gap_us_ = baud_rate > 19200 ? 1750 : 38500000UL / baud_rate;
 }
 void Modbus::loop() {
   const uint32_t now = millis();
@@ -18,31 +25,30 @@ void Modbus::loop() {
     this->last_modbus_byte_ = now;
   }
 
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
-    if (this->parse_modbus_byte_(byte)) {
-      this->last_modbus_byte_ = now;
-    } else {
-      this->rx_buffer_.clear();
-    }
-  }
-}
-
-uint16_t crc16(const uint8_t *data, uint8_t len) {
-  uint16_t crc = 0xFFFF;
-  while (len--) {
-    crc ^= *data++;
-    for (uint8_t i = 0; i < 8; i++) {
-      if ((crc & 0x01) != 0) {
-        crc >>= 1;
-        crc ^= 0xA001;
+  const uint8_t *data;
+  size_t len;
+  while ((len = this->read_buffer(&data)) != 0) {
+    for (size_t i = 0; i < len; i++) {
+      if (this->parse_modbus_byte_(data[i])) {
+        this->last_modbus_byte_ = now;
       } else {
-        crc >>= 1;
+        this->rx_buffer_.clear();
       }
     }
+    this->last_frame_us_ = micros();
   }
-  return crc;
+
+  if (!this->in_flight_.empty() && now - this->sent_at_ > this->send_wait_time_) {
+    ESP_LOGW(TAG, "Modbus device 0x%02X didn't respond to function 0x%02X in time", this->frame_.address,
+             this->frame_.function);
+    this->in_flight_.clear();
+  }
+  if (this->in_flight_.empty() && !this->queue_.empty() && micros() - this->last_frame_us_ >= this->frame_gap_us_)
+    this->send_next_();
+
+  // Nothing to time out or send, the UART wakes us up on the next byte
+  if (this->rx_buffer_.empty() && this->in_flight_.empty() && this->queue_.empty())
+    this->disable_loop();
 }
 
 bool Modbus::parse_modbus_byte_(uint8_t byte) {
@@ -57,13 +63,30 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
 
   // Byte 1: Function (msb indicates error)
   if (at == 1)
-    return (byte & 0x80) != 0x80;
+    return true;
 
-  // Byte 2: Size (with modbus rtu function code 4/3)
+  // Byte 2: Size (with modbus rtu function code 4/3), or the exception code of an error
   // See also https://en.wikipedia.org/wiki/Modbus
   if (at == 2)
     return true;
 
+  if ((raw[1] & 0x80) == 0x80) {
+    // Byte 3..4: CRC of an error response
+    if (at == 3)
+      return true;
+    uint16_t computed_crc = crc16_modbus(raw, 3);
+    uint16_t remote_crc = uint16_t(raw[3]) | (uint16_t(raw[4]) << 8);
+    if (computed_crc != remote_crc) {
+      ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
+      return false;
+    }
+    ESP_LOGW(TAG, "Modbus device 0x%02X answered function 0x%02X with exception 0x%02X", address, raw[1] & 0x7F,
+             raw[2]);
+    if (!this->in_flight_.empty() && this->frame_.address == address)
+      this->in_flight_.clear();
+    return false;
+  }
+
   uint8_t data_len = raw[2];
   // Byte 3..3+data_len-1: Data
   if (at < 3 + data_len)
@@ -73,7 +96,7 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
   if (at == 3 + data_len)
     return true;
   // Byte 3+len+1: CRC_HI (over all bytes)
-  uint16_t computed_crc = crc16(raw, 3 + data_len);
+  uint16_t computed_crc = crc16_modbus(raw, 3 + data_len);
   uint16_t remote_crc = uint16_t(raw[3 + data_len]) | (uint16_t(raw[3 + data_len + 1]) << 8);
   if (computed_crc != remote_crc) {
     ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
@@ -81,20 +104,52 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
   }
 
   std::vector<uint8_t> data(this->rx_buffer_.begin() + 3, this->rx_buffer_.begin() + 3 + data_len);
+  this->dispatch_(address, data);
 
-  bool found = false;
-  for (auto *device : this->devices_) {
-    if (device->address_ == address) {
-      device->on_modbus_data(data);
-      found = true;
-    }
+  // return false to reset buffer
+  return false;
+}
+
+void Modbus::dispatch_(uint8_t address, const std::vector<uint8_t> &data) {
+  if (this->in_flight_.empty() || this->frame_.address != address) {
+    // Late for its timeout, or not asked for at all
+    ESP_LOGW(TAG, "Got unexpected Modbus frame from address 0x%02X!", address);
+    return;
   }
-  if (!found) {
-    ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X!", address);
+
+  // Move them out first, a device may queue its next request right away
+  std::vector<ModbusRequest> requests;
+  requests.swap(this->in_flight_);
+  if (requests.size() == 1 && requests[0].device != nullptr) {
+    requests[0].device->on_modbus_data(data);
+    return;
   }
 
-  // return false to reset buffer
-  return false;
+  for (auto &request : requests) {
+    if (request.device == nullptr) {
+      bool found = false;
+      for (auto *device : this->devices_) {
+        if (device->address_ == address) {
+          device->on_modbus_data(data);
+          found = true;
+        }
+      }
+      if (!found) {
+        ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X!", address);
+      }
+      continue;
+    }
+
+    // Merged register reads, hand each device its own registers
+    const size_t offset = (request.start_address - this->frame_.start_address) * 2u;
+    const size_t length = request.register_count * 2u;
+    if (offset + length > data.size()) {
+      ESP_LOGW(TAG, "Modbus response from 0x%02X is too short for registers %u-%u", address, request.start_address,
+               request.start_address + request.register_count - 1);
+      continue;
+    }
+    request.device->on_modbus_data(std::vector<uint8_t>(data.begin() + offset, data.begin() + offset + length));
+  }
 }
 
 void Modbus::dump_config() {
@@ -106,25 +161,79 @@ float Modbus::get_setup_priority() const {
   return setup_priority::BUS - 1.0f;
 }
 void Modbus::send(uint8_t address, uint8_t function, uint16_t start_address, uint16_t register_count) {
-  uint8_t frame[8];
-  frame[0] = address;
-  frame[1] = function;
-  frame[2] = start_address >> 8;
-  frame[3] = start_address >> 0;
-  frame[4] = register_count >> 8;
-  frame[5] = register_count >> 0;
-  auto crc = crc16(frame, 6);
-  frame[6] = crc >> 0;
-  frame[7] = crc >> 8;
+  this->enqueue_(ModbusRequest{nullptr, address, function, start_address, register_count});
+}
+void Modbus::queue_request(ModbusDevice *device, uint8_t function, uint16_t start_address, uint16_t register_count) {
+  this->enqueue_(ModbusRequest{device, device->address_, function, start_address, register_count});
+}
+void Modbus::enqueue_(const ModbusRequest &request) {
+  for (auto &queued : this->queue_) {
+    if (queued.device == request.device && queued.address == request.address &&
+        queued.function == request.function && queued.start_address == request.start_address &&
+        queued.register_count == request.register_count)
+      return;
+  }
+  this->queue_.push_back(request);
+  this->enable_loop();
+}
+void Modbus::send_next_() {
+  ModbusRequest frame = this->queue_.front();
+  this->queue_.pop_front();
+  this->in_flight_.push_back(frame);
+
+  // Only register reads of a device can be merged, their responses are split up by register again in dispatch_()
+  const bool is_read = frame.function == 0x03 || frame.function == 0x04;
+  bool merged = is_read && frame.device != nullptr;
+  while (merged) {
+    merged = false;
+    for (auto it = this->queue_.begin(); it != this->queue_.end(); ++it) {
+      if (it->device == nullptr || it->address != frame.address || it->function != frame.function)
+        continue;
+      const uint32_t frame_end = uint32_t(frame.start_address) + frame.register_count;
+      const uint32_t end = uint32_t(it->start_address) + it->register_count;
+      // Overlapping or adjacent
+      if (it->start_address > frame_end || end < frame.start_address)
+        continue;
+      const uint16_t start = std::min(frame.start_address, it->start_address);
+      const uint32_t merged_end = std::max(frame_end, end);
+      if (merged_end - start > MODBUS_MAX_READ_REGISTERS)
+        continue;
+      frame.start_address = start;
+      frame.register_count = merged_end - start;
+      this->in_flight_.push_back(*it);
+      this->queue_.erase(it);
+      merged = true;
+      break;
+    }
+  }
+  if (this->in_flight_.size() > 1) {
+    ESP_LOGV(TAG, "Merged %u requests to 0x%02X into registers %u-%u", unsigned(this->in_flight_.size()), frame.address,
+             frame.start_address, frame.start_address + frame.register_count - 1);
+  }
+  this->frame_ = frame;
+
+  uint8_t data[8];
+  data[0] = frame.address;
+  data[1] = frame.function;
+  data[2] = frame.start_address >> 8;
+  data[3] = frame.start_address >> 0;
+  data[4] = frame.register_count >> 8;
+  data[5] = frame.register_count >> 0;
+  auto crc = crc16_modbus(data, 6);
+  data[6] = crc >> 0;
+  data[7] = crc >> 8;
 
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(true);
 
-  this->write_array(frame, 8);
+  this->write_array(data, 8);
   this->flush();
 
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
+
+  this->sent_at_ = millis();
+  this->last_frame_us_ = micros();
 }
 
 }  // namespace modbus
@@ -2,12 +2,26 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
+#include <deque>
 
 namespace esphome {
 namespace modbus {
 
 class ModbusDevice;
 
+/// The most registers one read request may ask for.
+static const uint16_t MODBUS_MAX_READ_REGISTERS = 125;
+
+/// A read waiting for the bus, see Modbus::queue_request().
+struct ModbusRequest {
+  /// Gets the data of its registers, or nullptr to hand the response to all devices with the address.
+  ModbusDevice *device;
+  uint8_t address;
+  uint8_t function;
+  uint16_t start_address;
+  uint16_t register_count;
+};
+
 class Modbus : public uart::UARTDevice, public Component {
  public:
   Modbus() = default;
@@ -22,21 +36,48 @@ class Modbus : public uart::UARTDevice, public Component {
 
   float get_setup_priority() const override;
 
+  /// Queue a request, the response goes to all devices with this address.
   void send(uint8_t address, uint8_t function, uint16_t start_address, uint16_t register_count);
 
+  /** Queue a request for `device`.
+   *
+   * Requests go out one at a time, with the inter-frame gap of the baud rate between frames, and each waits for its
+   * response or for send_wait_time. Register reads (functions 3 and 4) of the same address that overlap or touch
+   * are merged into one frame, and every device gets the data of the registers it asked for. A request that is
+   * still queued isn't queued a second time.
+   */
+  void queue_request(ModbusDevice *device, uint8_t function, uint16_t start_address, uint16_t register_count);
+
   void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
+  void set_send_wait_time(uint16_t send_wait_time) { this->send_wait_time_ = send_wait_time; }
 
  protected:
   GPIOPin *flow_control_pin_{nullptr};
 
   bool parse_modbus_byte_(uint8_t byte);
+  void enqueue_(const ModbusRequest &request);
+  /// Send the next queued request, merged with all queued requests it can be merged with.
+  void send_next_();
+  /// Hand the data of a response to the devices waiting for it.
+  void dispatch_(uint8_t address, const std::vector<uint8_t> &data);
 
   std::vector<uint8_t> rx_buffer_;
   uint32_t last_modbus_byte_{0};
   std::vector<ModbusDevice *> devices_;
+
+  std::deque<ModbusRequest> queue_;
+  /// The request on the bus, covering the registers of all requests merged into it.
+  ModbusRequest frame_;
+  /// The queued requests the frame on the bus answers, empty while the bus is idle.
+  std::vector<ModbusRequest> in_flight_;
+  uint32_t sent_at_{0};
+  uint16_t send_wait_time_{250};
+  /// t3.5 of the baud rate in microseconds.
+  uint32_t frame_gap_us_{1750};
+  /// End of the last frame sent or received.
+  uint32_t last_frame_us_{0};
 };
 
-uint16_t crc16(const uint8_t *data, uint8_t len);
 
 class ModbusDevice {
  public:
@@ -45,7 +86,7 @@ class ModbusDevice {
   virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
 
   void send(uint8_t function, uint16_t start_address, uint16_t register_count) {
-    this->parent_->send(this->address_, function, start_address, register_count);
+    this->parent_->queue_request(this, function, start_address, register_count);
   }
 
  protected:
@@ -15,10 +15,11 @@ class MonochromaticLightOutput : public light::LightOutput {
     traits.set_supports_brightness(true);
     return traits;
   }
+  bool supports_fade() override { return this->output_->supports_fade(); }
   void write_state(light::LightState *state) override {
     float bright;
     state->current_values_as_brightness(&bright);
-    this->output_->set_level(bright);
+    this->output_->set_level(bright, state->get_fade_length());
   }
 
  protected:
@@ -42,6 +42,9 @@ from esphome.core import coroutine_with_priority, CORE
 DEPENDENCIES = ["network"]
 AUTO_LOAD = ["json", "async_tcp"]
 
+CONF_PUBLISH_INTERVAL = "publish_interval"
+CONF_PUBLISH_QUEUE_SIZE = "publish_queue_size"
+
 
 def validate_message_just_topic(value):
     value = cv.publish_topic(value)
@@ -168,6 +171,12 @@ CONFIG_SCHEMA = cv.All(
                 cv.only_on_esp8266, cv.ensure_list(validate_fingerprint)
             ),
             cv.Optional(CONF_KEEPALIVE, default="15s"): cv.positive_time_period_seconds,
+            cv.Optional(
+                CONF_PUBLISH_INTERVAL, default="0ms"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(
+                CONF_PUBLISH_QUEUE_SIZE, default=32
+            ): cv.int_range(min=2, max=255),
             cv.Optional(
                 CONF_REBOOT_TIMEOUT, default="15min"
             ): cv.positive_time_period_milliseconds,
@@ -272,6 +281,8 @@ async def to_code(config):
         cg.add_build_flag("-DASYNC_TCP_SSL_ENABLED=1")
 
     cg.add(var.set_keep_alive(config[CONF_KEEPALIVE]))
+    cg.add(var.set_publish_interval(config[CONF_PUBLISH_INTERVAL]))
+    cg.add(var.set_publish_queue_size(config[CONF_PUBLISH_QUEUE_SIZE]))
 
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
 
@@ -4,6 +4,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
+#include <algorithm>
 #include <utility>
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -213,6 +214,9 @@ void MQTTClientComponent::check_connected() {
   // MQTT Client needs some time to be fully set up.
   delay(100);  // NOLINT
 
+  // All components resend their discovery and state below, older queued messages would only be duplicates
+  this->publish_queue_.clear();
+
   this->resubscribe_subscriptions_();
 
   for (MQTTComponent *component : this->children_)
@@ -284,6 +288,7 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->process_publish_queue_();
       }
       break;
   }
@@ -339,6 +344,7 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
       .resubscribe_timeout = 0,
   };
   this->resubscribe_subscription_(&subscription);
+  this->subscription_trie_.add(topic, this->subscriptions_.size());
   this->subscriptions_.push_back(subscription);
 }
 
@@ -354,6 +360,7 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
       .resubscribe_timeout = 0,
   };
   this->resubscribe_subscription_(&subscription);
+  this->subscription_trie_.add(topic, this->subscriptions_.size());
   this->subscriptions_.push_back(subscription);
 }
 
@@ -375,6 +382,10 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
     else
       ++it;
   }
+  // Indices of the remaining subscriptions moved
+  this->subscription_trie_.clear();
+  for (size_t i = 0; i < this->subscriptions_.size(); i++)
+    this->subscription_trie_.add(this->subscriptions_[i].topic, i);
 }
 
 // Publish
@@ -388,25 +399,63 @@ bool MQTTClientComponent::publish(const std::string &topic, const char *payload,
     // critical components will re-transmit their messages
     return false;
   }
-  bool logging_topic = topic == this->log_message_.topic;
-  uint16_t ret = this->mqtt_client_.publish(topic.c_str(), qos, retain, payload, payload_length);
-  delay(0);
-  if (ret == 0 && !logging_topic && this->is_connected()) {
-    delay(0);
-    ret = this->mqtt_client_.publish(topic.c_str(), qos, retain, payload, payload_length);
-    delay(0);
+  if (topic == this->log_message_.topic) {
+    // Log messages are never queued, a full queue would only produce more of them
+    return this->mqtt_client_.publish(topic.c_str(), qos, retain, payload, payload_length) != 0;
   }
 
-  if (!logging_topic) {
-    if (ret != 0) {
-      ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d)", topic.c_str(), payload, retain);
-    } else {
-      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", topic.c_str(),
-               payload_length);  // NOLINT
-      this->status_momentary_warning("publish", 1000);
+  // A message for this topic is still waiting, only its latest payload is worth sending
+  for (auto &message : this->publish_queue_) {
+    if (message.topic == topic) {
+      message.payload.assign(payload, payload_length);
+      message.qos = qos;
+      message.retain = retain;
+      return true;
     }
   }
-  return ret != 0;
+
+  bool live_queued = std::any_of(this->publish_queue_.begin(), this->publish_queue_.end(),
+                                 [](const QueuedMessage &message) { return !message.deferred; });
+  if (!this->publish_deferred_ && !live_queued && millis() - this->last_publish_ >= this->publish_interval_) {
+    if (this->send_publish_(topic, payload, payload_length, qos, retain))
+      return true;
+  }
+
+  if (this->publish_queue_.size() >= this->publish_queue_size_) {
+    ESP_LOGV(TAG, "Publish queue full, dropping topic='%s'", topic.c_str());
+    this->status_momentary_warning("publish", 1000);
+    return false;
+  }
+  this->publish_queue_.push_back(
+      QueuedMessage{topic, std::string(payload, payload_length), qos, retain, this->publish_deferred_});
+  return true;
+}
+bool MQTTClientComponent::send_publish_(const std::string &topic, const char *payload, size_t payload_length,
+                                        uint8_t qos, bool retain) {
+  uint16_t ret = this->mqtt_client_.publish(topic.c_str(), qos, retain, payload, payload_length);
+  if (ret == 0) {
+    ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", topic.c_str(),
+             payload_length);  // NOLINT
+    this->status_momentary_warning("publish", 1000);
+    return false;
+  }
+  ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d)", topic.c_str(), payload, retain);
+  this->last_publish_ = millis();
+  return true;
+}
+void MQTTClientComponent::process_publish_queue_() {
+  while (!this->publish_queue_.empty()) {
+    if (millis() - this->last_publish_ < this->publish_interval_)
+      return;
+    auto it = std::find_if(this->publish_queue_.begin(), this->publish_queue_.end(),
+                           [](const QueuedMessage &message) { return !message.deferred; });
+    if (it == this->publish_queue_.end())
+      it = this->publish_queue_.begin();
+    // Stays queued until the client has room again
+    if (!this->send_publish_(it->topic, it->payload.data(), it->payload.size(), it->qos, it->retain))
+      return;
+    this->publish_queue_.erase(it);
+  }
 }
 
 bool MQTTClientComponent::publish(const MQTTMessage &message) {
@@ -418,62 +467,10 @@ bool MQTTClientComponent::publish_json(const std::string &topic, const json::jso
   const char *message = json::build_json(f, &len);
   return this->publish(topic, message, len, qos, retain);
 }
-
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
-    }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
-  }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
+bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_write_t &f, uint8_t qos,
+                                       bool retain) {
+  json::write_json(this->json_buffer_, f);
+  return this->publish(topic, this->json_buffer_.data(), this->json_buffer_.size(), qos, retain);
 }
 
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
@@ -482,9 +479,13 @@ void MQTTClientComponent::on_message(const std::string &topic, const std::string
   // in an ISR.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_)
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
+    std::vector<uint16_t> matches;
+    this->subscription_trie_.match(topic, matches);
+    for (uint16_t index : matches) {
+      // Callbacks may add subscriptions
+      if (index < this->subscriptions_.size())
+        this->subscriptions_[index].callback(topic, payload);
+    }
 #ifdef ARDUINO_ARCH_ESP8266
   });
 #endif
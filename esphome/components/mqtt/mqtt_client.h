@@ -5,6 +5,7 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/log.h"
 #include "esphome/components/json/json_util.h"
+#include "mqtt_topic_trie.h"
 #include <AsyncMqttClient.h>
 #include "lwip/ip_addr.h"
 
@@ -90,6 +91,20 @@ class MQTTClientComponent : public Component {
   /// Set the keep alive time in seconds, every 0.7*keep_alive a ping will be sent.
   void set_keep_alive(uint16_t keep_alive_s);
 
+  /// Set the minimum time in ms between two publishes, 0 sends as fast as the TCP connection accepts them.
+  void set_publish_interval(uint32_t publish_interval) { this->publish_interval_ = publish_interval; }
+  /// Set the maximum number of messages waiting in the outbound queue.
+  void set_publish_queue_size(size_t publish_queue_size) { this->publish_queue_size_ = publish_queue_size; }
+
+  /** While deferred, published messages are always queued, behind the live state updates of other components.
+   *
+   * Used for discovery and the initial state that follows it, which would otherwise be sent by all components at
+   * the same moment on every reconnect.
+   */
+  void set_publish_deferred(bool deferred) { this->publish_deferred_ = deferred; }
+  /// Whether the outbound queue has room for the discovery and initial state of another component.
+  bool can_defer_publish() const { return this->publish_queue_.size() < this->publish_queue_size_ / 2; }
+
   /** Set the Home Assistant discovery info
    *
    * See <a href="https://www.home-assistant.io/docs/mqtt/discovery/">MQTT Discovery</a>.
@@ -142,7 +157,7 @@ class MQTTClientComponent : public Component {
 
   /** Subscribe to an MQTT topic and call callback when a message is received.
    *
-   * @param topic The topic. Wildcards are currently not supported.
+   * @param topic The topic, may contain '+' and '#' wildcards.
    * @param callback The callback function.
    * @param qos The QoS of this subscription.
    */
@@ -152,7 +167,7 @@ class MQTTClientComponent : public Component {
    *
    * If an invalid JSON payload is received, the callback will not be called.
    *
-   * @param topic The topic. Wildcards are currently not supported.
+   * @param topic The topic, may contain '+' and '#' wildcards.
    * @param callback The callback with a parsed JsonObject that will be called when a message with matching topic is
    * received.
    * @param qos The QoS of this subscription.
@@ -193,6 +208,14 @@ class MQTTClientComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos = 0, bool retain = false);
 
+  /** Construct and send a JSON MQTT message, streaming it into a reused buffer with a JsonWriter.
+   *
+   * @param topic The topic.
+   * @param f The Json Message writer.
+   * @param retain Whether to retain the message.
+   */
+  bool publish_json(const std::string &topic, const json::json_write_t &f, uint8_t qos = 0, bool retain = false);
+
   /// Setup the MQTT client, registering a bunch of callbacks and attempting to connect.
   void setup() override;
   void dump_config() override;
@@ -235,6 +258,19 @@ class MQTTClientComponent : public Component {
   /// Re-calculate the availability property.
   void recalculate_availability_();
 
+  struct QueuedMessage {
+    std::string topic;
+    std::string payload;
+    uint8_t qos;
+    bool retain;
+    bool deferred;
+  };
+
+  /// Hand a message to the MQTT client, returns false if its buffers are full.
+  bool send_publish_(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos, bool retain);
+  /// Send queued messages, live state updates before deferred ones, as the rate limit allows.
+  void process_publish_queue_();
+
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
@@ -260,9 +296,13 @@ class MQTTClientComponent : public Component {
   std::string topic_prefix_{};
   MQTTMessage log_message_;
   std::string payload_buffer_;
+  /// Reused for outgoing JSON messages, so its capacity settles at the largest discovery message.
+  std::string json_buffer_;
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Subscription topics by index into subscriptions_, for dispatching incoming messages.
+  MQTTTopicTrie subscription_trie_;
   AsyncMqttClient mqtt_client_;
   MQTTClientState state_{MQTT_CLIENT_DISCONNECTED};
   IPAddress ip_;
@@ -273,6 +313,11 @@ class MQTTClientComponent : public Component {
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
   optional<AsyncMqttClientDisconnectReason> disconnect_reason_{};
+  std::vector<QueuedMessage> publish_queue_;
+  size_t publish_queue_size_{32};
+  uint32_t publish_interval_{0};
+  uint32_t last_publish_{0};
+  bool publish_deferred_{false};
 };
 
 extern MQTTClientComponent *global_mqtt_client;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -309,7 +354,7 @@ template<typename... Ts> class MQTTPublishAction : public Action<Ts...> {
   TEMPLATABLE_VALUE(uint8_t, qos)
   TEMPLATABLE_VALUE(bool, retain)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     this->parent_->publish(this->topic_.value(x...), this->payload_.value(x...), this->qos_.value(x...),
                            this->retain_.value(x...));
   }
@@ -327,7 +372,7 @@ template<typename... Ts> class MQTTPublishJsonAction : public Action<Ts...> {
 
   void set_payload(std::function<void(Ts..., JsonObject &)> payload) { this->payload_ = payload; }
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto f = std::bind(&MQTTPublishJsonAction<Ts...>::encode_, this, x..., std::placeholders::_1);
     auto topic = this->topic_.value(x...);
     auto qos = this->qos_.value(x...);
@@ -336,7 +381,7 @@ template<typename... Ts> class MQTTPublishJsonAction : public Action<Ts...> {
   }
 
  protected:
-  void encode_(Ts... x, JsonObject &root) { this->payload_(x..., root); }
+  void encode_(const Ts &... x, JsonObject &root) { this->payload_(x..., root); }
   std::function<void(Ts..., JsonObject &)> payload_;
   MQTTClientComponent *parent_;
 };
@@ -344,7 +389,7 @@ template<typename... Ts> class MQTTPublishJsonAction : public Action<Ts...> {
 template<typename... Ts> class MQTTConnectedCondition : public Condition<Ts...> {
  public:
   MQTTConnectedCondition(MQTTClientComponent *parent) : parent_(parent) {}
-  bool check(Ts... x) override { return this->parent_->is_connected(); }
+  bool check(const Ts &... x) override { return this->parent_->is_connected(); }
 
  protected:
   MQTTClientComponent *parent_;
@@ -18,26 +18,37 @@ std::string MQTTComponent::get_discovery_topic_(const MQTTDiscoveryInfo &discove
 }
 
 std::string MQTTComponent::get_default_topic_for_(const std::string &suffix) const {
-  return global_mqtt_client->get_topic_prefix() + "/" + this->component_type() + "/" + this->get_default_object_id_() +
-         "/" + suffix;
+  std::string topic;
+  const std::string &prefix = global_mqtt_client->get_topic_prefix();
+  std::string component_type = this->component_type();
+  std::string object_id = this->get_default_object_id_();
+  topic.reserve(prefix.size() + component_type.size() + object_id.size() + suffix.size() + 3);
+  topic.append(prefix).append("/").append(component_type).append("/").append(object_id).append("/").append(suffix);
+  return topic;
 }
 
-const std::string MQTTComponent::get_state_topic_() const {
+const std::string &MQTTComponent::get_state_topic_() const {
   if (this->custom_state_topic_.empty())
-    return this->get_default_topic_for_("state");
+    this->custom_state_topic_ = this->get_default_topic_for_("state");
   return this->custom_state_topic_;
 }
 
-const std::string MQTTComponent::get_command_topic_() const {
+const std::string &MQTTComponent::get_command_topic_() const {
   if (this->custom_command_topic_.empty())
-    return this->get_default_topic_for_("command");
+    this->custom_command_topic_ = this->get_default_topic_for_("command");
   return this->custom_command_topic_;
 }
 
 bool MQTTComponent::publish(const std::string &topic, const std::string &payload) {
+  return this->publish(topic, payload.data(), payload.size());
+}
+bool MQTTComponent::publish(const std::string &topic, const char *payload, size_t payload_length) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish(topic, payload, 0, this->retain_);
+  return global_mqtt_client->publish(topic, payload, payload_length, 0, this->retain_);
+}
+bool MQTTComponent::publish(const std::string &topic, const char *payload) {
+  return this->publish(topic, payload, strlen(payload));
 }
 
 bool MQTTComponent::publish_json(const std::string &topic, const json::json_build_t &f) {
@@ -45,6 +56,11 @@ bool MQTTComponent::publish_json(const std::string &topic, const json::json_buil
     return false;
   return global_mqtt_client->publish_json(topic, f, 0, this->retain_);
 }
+bool MQTTComponent::publish_json(const std::string &topic, const json::json_write_t &f) {
+  if (topic.empty())
+    return false;
+  return global_mqtt_client->publish_json(topic, f, 0, this->retain_);
+}
 
 bool MQTTComponent::send_discovery_() {
   const MQTTDiscoveryInfo &discovery_info = global_mqtt_client->get_discovery_info();
@@ -58,7 +74,7 @@ bool MQTTComponent::send_discovery_() {
 
   return global_mqtt_client->publish_json(
       this->get_discovery_topic_(discovery_info),
-      [this](JsonObject &root) {
+      [this](json::JsonWriter &root) {
         SendDiscoveryConfig config;
         config.state_topic = true;
         config.command_topic = true;
@@ -66,46 +82,47 @@ bool MQTTComponent::send_discovery_() {
         this->send_discovery(root, config);
 
         std::string name = this->friendly_name();
-        root["name"] = name;
+        root.add("name", name);
         if (config.state_topic)
-          root["state_topic"] = this->get_state_topic_();
+          root.add("state_topic", this->get_state_topic_());
         if (config.command_topic)
-          root["command_topic"] = this->get_command_topic_();
+          root.add("command_topic", this->get_command_topic_());
 
         if (this->availability_ == nullptr) {
           if (!global_mqtt_client->get_availability().topic.empty()) {
-            root["availability_topic"] = global_mqtt_client->get_availability().topic;
+            root.add("availability_topic", global_mqtt_client->get_availability().topic);
             if (global_mqtt_client->get_availability().payload_available != "online")
-              root["payload_available"] = global_mqtt_client->get_availability().payload_available;
+              root.add("payload_available", global_mqtt_client->get_availability().payload_available);
             if (global_mqtt_client->get_availability().payload_not_available != "offline")
-              root["payload_not_available"] = global_mqtt_client->get_availability().payload_not_available;
+              root.add("payload_not_available", global_mqtt_client->get_availability().payload_not_available);
           }
         } else if (!this->availability_->topic.empty()) {
-          root["availability_topic"] = this->availability_->topic;
+          root.add("availability_topic", this->availability_->topic);
           if (this->availability_->payload_available != "online")
-            root["payload_available"] = this->availability_->payload_available;
+            root.add("payload_available", this->availability_->payload_available);
           if (this->availability_->payload_not_available != "offline")
-            root["payload_not_available"] = this->availability_->payload_not_available;
+            root.add("payload_not_available", this->availability_->payload_not_available);
         }
 
         const std::string &node_name = App.get_name();
         std::string unique_id = this->unique_id();
         if (!unique_id.empty()) {
-          root["unique_id"] = unique_id;
+          root.add("unique_id", unique_id);
         } else {
           // default to almost-unique ID. It's a hack but the only way to get that
           // gorgeous device registry view.
-          root["unique_id"] = "ESP" + this->component_type() + this->get_default_object_id_();
+          root.add("unique_id", "ESP" + this->component_type() + this->get_default_object_id_());
         }
 
-        JsonObject &device_info = root.createNestedObject("device");
-        device_info["identifiers"] = get_mac_address();
-        device_info["name"] = node_name;
-        device_info["sw_version"] = "esphome v" ESPHOME_VERSION " " + App.get_compilation_time();
+        root.begin_object("device");
+        root.add("identifiers", get_mac_address());
+        root.add("name", node_name);
+        root.add("sw_version", "esphome v" ESPHOME_VERSION " " + App.get_compilation_time());
 #ifdef ARDUINO_BOARD
-        device_info["model"] = ARDUINO_BOARD;
+        root.add("model", ARDUINO_BOARD);
 #endif
-        device_info["manufacturer"] = "espressif";
+        root.add("manufacturer", "espressif");
+        root.end();
       },
       0, discovery_info.retain);
 }
@@ -159,14 +176,7 @@ void MQTTComponent::call_setup() {
   if (!this->is_connected_())
     return;
 
-  if (this->is_discovery_enabled()) {
-    if (!this->send_discovery_()) {
-      this->schedule_resend_state();
-    }
-  }
-  if (!this->send_initial_state()) {
-    this->schedule_resend_state();
-  }
+  this->send_discovery_and_state_();
 }
 
 void MQTTComponent::call_loop() {
@@ -178,8 +188,16 @@ void MQTTComponent::call_loop() {
   if (!this->resend_state_ || !this->is_connected_()) {
     return;
   }
+  // Let the queue drain first, a reconnect would otherwise build the discovery of all components at once
+  if (!global_mqtt_client->can_defer_publish())
+    return;
 
   this->resend_state_ = false;
+  this->send_discovery_and_state_();
+}
+void MQTTComponent::send_discovery_and_state_() {
+  // Queued behind live state updates, the initial state stays after the discovery that announces it
+  global_mqtt_client->set_publish_deferred(true);
   if (this->is_discovery_enabled()) {
     if (!this->send_discovery_()) {
       this->schedule_resend_state();
@@ -188,6 +206,7 @@ void MQTTComponent::call_loop() {
   if (!this->send_initial_state()) {
     this->schedule_resend_state();
   }
+  global_mqtt_client->set_publish_deferred(false);
 }
 void MQTTComponent::schedule_resend_state() { this->resend_state_ = true; }
 std::string MQTTComponent::unique_id() { return ""; }
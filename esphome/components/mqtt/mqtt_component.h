@@ -22,13 +22,13 @@ struct SendDiscoveryConfig {
 
 #define MQTT_COMPONENT_CUSTOM_TOPIC_(name, type) \
  protected: \
-  std::string custom_##name##_##type##_topic_{}; \
+  mutable std::string custom_##name##_##type##_topic_{}; \
 \
  public: \
   void set_custom_##name##_##type##_topic(const std::string &topic) { this->custom_##name##_##type##_topic_ = topic; } \
-  const std::string get_##name##_##type##_topic() const { \
+  const std::string &get_##name##_##type##_topic() const { \
     if (this->custom_##name##_##type##_topic_.empty()) \
-      return this->get_default_topic_for_(#name "/" #type); \
+      this->custom_##name##_##type##_topic_ = this->get_default_topic_for_(#name "/" #type); \
     return this->custom_##name##_##type##_topic_; \
   }
 
@@ -61,7 +61,7 @@ class MQTTComponent : public Component {
   void call_loop() override;
 
   /// Send discovery info the Home Assistant, override this.
-  virtual void send_discovery(JsonObject &root, SendDiscoveryConfig &config) = 0;
+  virtual void send_discovery(json::JsonWriter &root, SendDiscoveryConfig &config) = 0;
 
   virtual bool send_initial_state() = 0;
 
@@ -102,6 +102,8 @@ class MQTTComponent : public Component {
    * @param payload The payload.
    */
   bool publish(const std::string &topic, const std::string &payload);
+  bool publish(const std::string &topic, const char *payload, size_t payload_length);
+  bool publish(const std::string &topic, const char *payload);
 
   /** Construct and send a JSON MQTT message.
    *
@@ -109,6 +111,7 @@ class MQTTComponent : public Component {
    * @param f The Json Message builder.
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f);
+  bool publish_json(const std::string &topic, const json::json_write_t &f);
 
   /** Subscribe to a MQTT topic.
    *
@@ -150,16 +153,21 @@ class MQTTComponent : public Component {
    */
   virtual std::string unique_id();
 
-  /// Get the MQTT topic that new states will be shared to.
-  const std::string get_state_topic_() const;
+  /** Get the MQTT topic that new states will be shared to.
+   *
+   * Like all topics, the default is built on first use and kept, so publishing doesn't allocate.
+   */
+  const std::string &get_state_topic_() const;
 
   /// Get the MQTT topic for listening to commands.
-  const std::string get_command_topic_() const;
+  const std::string &get_command_topic_() const;
 
   bool is_connected_() const;
 
   /// Internal method to start sending discovery info, this will call send_discovery().
   bool send_discovery_();
+  /// Publish discovery and the initial state, deferred behind the live state updates of other components.
+  void send_discovery_and_state_();
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -167,8 +175,8 @@ class MQTTComponent : public Component {
   std::string get_default_object_id_() const;
 
  protected:
-  std::string custom_state_topic_{};
-  std::string custom_command_topic_{};
+  mutable std::string custom_state_topic_{};
+  mutable std::string custom_command_topic_{};
   bool retain_{true};
   bool discovery_enabled_{true};
   Availability *availability_{nullptr};
@@ -74,14 +74,14 @@ void MQTTFanComponent::setup() {
 }
 bool MQTTFanComponent::send_initial_state() { return this->publish_state(); }
 std::string MQTTFanComponent::friendly_name() const { return this->state_->get_name(); }
-void MQTTFanComponent::send_discovery(JsonObject &root, mqtt::SendDiscoveryConfig &config) {
+void MQTTFanComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   if (this->state_->get_traits().supports_oscillation()) {
-    root["oscillation_command_topic"] = this->get_oscillation_command_topic();
-    root["oscillation_state_topic"] = this->get_oscillation_state_topic();
+    root.add("oscillation_command_topic", this->get_oscillation_command_topic());
+    root.add("oscillation_state_topic", this->get_oscillation_state_topic());
   }
   if (this->state_->get_traits().supports_speed()) {
-    root["speed_command_topic"] = this->get_speed_command_topic();
-    root["speed_state_topic"] = this->get_speed_state_topic();
+    root.add("speed_command_topic", this->get_speed_command_topic());
+    root.add("speed_state_topic", this->get_speed_state_topic());
   }
 }
 bool MQTTFanComponent::is_internal() { return this->state_->is_internal(); }
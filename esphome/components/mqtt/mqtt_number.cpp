@@ -34,14 +34,14 @@ void MQTTNumberComponent::dump_config() {
 std::string MQTTNumberComponent::component_type() const { return "number"; }
 
 std::string MQTTNumberComponent::friendly_name() const { return this->number_->get_name(); }
-void MQTTNumberComponent::send_discovery(JsonObject &root, mqtt::SendDiscoveryConfig &config) {
+void MQTTNumberComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   const auto &traits = number_->traits;
   // https://www.home-assistant.io/integrations/number.mqtt/
   if (!traits.get_icon().empty())
-    root["icon"] = traits.get_icon();
-  root["min_value"] = traits.get_min_value();
-  root["max_value"] = traits.get_max_value();
-  root["step"] = traits.get_step();
+    root.add("icon", traits.get_icon());
+  root.add("min_value", traits.get_min_value());
+  root.add("max_value", traits.get_max_value());
+  root.add("step", traits.get_step());
 
   config.command_topic = true;
 }
@@ -40,11 +40,11 @@ void MQTTSwitchComponent::dump_config() {
 }
 
 std::string MQTTSwitchComponent::component_type() const { return "switch"; }
-void MQTTSwitchComponent::send_discovery(JsonObject &root, mqtt::SendDiscoveryConfig &config) {
+void MQTTSwitchComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   if (!this->switch_->get_icon().empty())
-    root["icon"] = this->switch_->get_icon();
+    root.add("icon", this->switch_->get_icon());
   if (this->switch_->assumed_state())
-    root["optimistic"] = true;
+    root.add("optimistic", true);
 }
 bool MQTTSwitchComponent::send_initial_state() { return this->publish_state(this->switch_->state); }
 bool MQTTSwitchComponent::is_internal() { return this->switch_->is_internal(); }
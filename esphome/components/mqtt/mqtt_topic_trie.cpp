@@ -0,0 +1,93 @@
+#include "mqtt_topic_trie.h"
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace mqtt {
+
+void MQTTTopicTrie::clear() {
+  this->nodes_.clear();
+  this->nodes_.emplace_back();
+}
+
+uint16_t MQTTTopicTrie::child_(uint16_t node, const char *level, size_t len) const {
+  for (uint16_t child : this->nodes_[node].children) {
+    const std::string &name = this->nodes_[child].level;
+    if (name.size() == len && memcmp(name.data(), level, len) == 0)
+      return child;
+  }
+  return 0;
+}
+
+void MQTTTopicTrie::add(const std::string &filter, uint16_t index) {
+  uint16_t node = 0;
+  const char *level = filter.c_str();
+  while (true) {
+    const char *end = strchr(level, '/');
+    size_t len = end == nullptr ? strlen(level) : end - level;
+    if (len == 1 && *level == '#') {
+      // Multi-level wildcard, MQTT mandates that this must be at the end of the filter
+      this->nodes_[node].multi_level.push_back(index);
+      return;
+    }
+
+    uint16_t next;
+    if (len == 1 && *level == '+') {
+      next = this->nodes_[node].single_level;
+      if (next == 0) {
+        next = this->nodes_.size();
+        this->nodes_.emplace_back();
+        this->nodes_[next].level = "+";
+        this->nodes_[node].single_level = next;
+      }
+    } else {
+      next = this->child_(node, level, len);
+      if (next == 0) {
+        next = this->nodes_.size();
+        this->nodes_.emplace_back();
+        this->nodes_[next].level.assign(level, len);
+        this->nodes_[node].children.push_back(next);
+      }
+    }
+    node = next;
+
+    if (end == nullptr)
+      break;
+    level = end + 1;
+  }
+  this->nodes_[node].filters.push_back(index);
+}
+
+void MQTTTopicTrie::match_(uint16_t node, const char *level, bool wildcards, std::vector<uint16_t> &out) const {
+  const Node &n = this->nodes_[node];
+  if (level == nullptr) {
+    // All levels consumed
+    out.insert(out.end(), n.filters.begin(), n.filters.end());
+    return;
+  }
+  // '#' needs at least one more character in the topic
+  if (wildcards && *level != '\0')
+    out.insert(out.end(), n.multi_level.begin(), n.multi_level.end());
+
+  const char *end = strchr(level, '/');
+  size_t len = end == nullptr ? strlen(level) : end - level;
+  const char *next = end == nullptr ? nullptr : end + 1;
+
+  uint16_t child = this->child_(node, level, len);
+  if (child != 0)
+    this->match_(child, next, true, out);
+  // Like '#', '+' doesn't match an empty last level
+  if (wildcards && n.single_level != 0 && (len != 0 || next != nullptr))
+    this->match_(n.single_level, next, true, out);
+}
+
+void MQTTTopicTrie::match(const std::string &topic, std::vector<uint16_t> &out) const {
+  if (topic.empty())
+    return;
+  size_t old_size = out.size();
+  this->match_(0, topic.c_str(), topic[0] != '$', out);
+  std::sort(out.begin() + old_size, out.end());
+}
+
+}  // namespace mqtt
+}  // namespace esphome
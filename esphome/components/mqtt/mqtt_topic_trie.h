@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** Subscription topic filters compiled into a tree with one node per topic level.
+ *
+ * Matching a message topic walks the tree level by level, following the literal child and the '+' child and
+ * collecting '#' filters on the way, so the cost depends on the number of topic levels and not on the number of
+ * subscriptions. As mandated by the MQTT spec, wildcards don't match a first level that starts with '$'.
+ */
+class MQTTTopicTrie {
+ public:
+  MQTTTopicTrie() { this->clear(); }
+
+  /// Remove all filters.
+  void clear();
+  /// Add a topic filter, index is reported back by match() for messages matching it.
+  void add(const std::string &filter, uint16_t index);
+  /// Append the indices of all filters matching topic to out, in ascending order.
+  void match(const std::string &topic, std::vector<uint16_t> &out) const;
+
+ protected:
+  struct Node {
+    std::string level;
+    std::vector<uint16_t> children;
+    /// Index of the '+' child, 0 if there is none (the root is never a child).
+    uint16_t single_level{0};
+    /// Filters ending at this node.
+    std::vector<uint16_t> filters;
+    /// Filters ending with a '#' directly below this node.
+    std::vector<uint16_t> multi_level;
+  };
+
+  uint16_t child_(uint16_t node, const char *level, size_t len) const;
+  void match_(uint16_t node, const char *level, bool wildcards, std::vector<uint16_t> &out) const;
+
+  std::vector<Node> nodes_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
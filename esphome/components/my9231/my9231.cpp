@@ -32,6 +32,7 @@ void MY9231OutputComponent::setup() {
   this->pin_di_->digital_write(false);
   this->pin_dcki_->setup();
   this->pin_dcki_->digital_write(false);
+  this->dcki_level_ = false;
   this->pwm_amounts_.resize(this->num_channels_, 0);
   uint8_t command = 0;
   if (this->bit_depth_ <= 8) {
@@ -96,7 +97,9 @@ void MY9231OutputComponent::init_chips_(uint8_t command) {
 void MY9231OutputComponent::write_word_(uint16_t value, uint8_t bits) {
   for (uint8_t i = bits; i > 0; i--) {
     this->pin_di_->digital_write(value & (1 << (i - 1)));
-    this->pin_dcki_->digital_write(!this->pin_dcki_->digital_read());
+    // Data is latched on both DCKI edges, keep track of the level instead of reading the pin back for each bit
+    this->dcki_level_ = !this->dcki_level_;
+    this->pin_dcki_->digital_write(this->dcki_level_);
   }
 }
 void MY9231OutputComponent::send_di_pulses_(uint8_t count) {
@@ -55,6 +55,7 @@ class MY9231OutputComponent : public Component {
   uint16_t num_channels_;
   uint8_t num_chips_;
   std::vector<uint16_t> pwm_amounts_;
+  bool dcki_level_{false};
   bool update_{true};
 };
 
@@ -85,6 +85,10 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   void loop() override {
     if (!this->should_show_())
       return;
+    // The DMA, I2S, RMT and UART methods send a copy of the buffer in the background. Hand them the next frame only
+    // once the previous one is out, instead of waiting for it inside Show(), so the effects keep running meanwhile.
+    if (!this->controller_->CanShow())
+      return;
 
     this->mark_shown_();
     this->controller_->Dirty();
@@ -105,6 +109,8 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
  protected:
+  bool can_show_() const override { return this->controller_->CanShow(); }
+
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *controller_{nullptr};
   uint8_t *effect_data_{nullptr};
   uint8_t rgb_offsets_[4]{0, 1, 2, 3};
@@ -126,6 +132,10 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                nullptr, this->effect_data_ + index, &this->correction_);
   }
+  bool get_raw_pixels_(light::ESPRawPixels *pixels) const override {
+    *pixels = {this->controller_->Pixels(), 3, {this->rgb_offsets_[0], this->rgb_offsets_[1], this->rgb_offsets_[2]}};
+    return true;
+  }
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbwFeature>
@@ -145,6 +155,12 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
   }
+  bool get_raw_pixels_(light::ESPRawPixels *pixels) const override {
+    *pixels = {this->controller_->Pixels(),
+               4,
+               {this->rgb_offsets_[0], this->rgb_offsets_[1], this->rgb_offsets_[2], this->rgb_offsets_[3]}};
+    return true;
+  }
 };
 
 }  // namespace neopixelbus
@@ -7,6 +7,7 @@ namespace esphome {
 namespace nextion {
 
 static const char *const TAG = "nextion";
+static const size_t QUEUE_POOL_SIZE = 16;
 
 void Nextion::setup() {
   this->is_setup_ = false;
@@ -21,6 +22,7 @@ void Nextion::setup() {
 
   // Reboot it
   this->send_command_("rest");
+  this->flush_commands_();
 
   this->ignore_is_setup_ = false;
 }
@@ -32,12 +34,64 @@ bool Nextion::send_command_(const std::string &command) {
 
   ESP_LOGN(TAG, "send_command %s", command.c_str());
 
-  this->write_str(command.c_str());
-  const uint8_t to_send[3] = {0xFF, 0xFF, 0xFF};
-  this->write_array(to_send, sizeof(to_send));
+  this->command_buffer_ += command;
+  this->command_buffer_ += COMMAND_DELIMITER;
   return true;
 }
 
+void Nextion::flush_commands_() {
+  if (this->command_buffer_.empty())
+    return;
+  this->write_array(reinterpret_cast<const uint8_t *>(this->command_buffer_.data()), this->command_buffer_.size());
+  this->command_buffer_.clear();
+}
+
+bool Nextion::is_value_sent_(const std::string &key, const std::string &value) {
+  auto it = this->sent_values_.find(key);
+  return it != this->sent_values_.end() && it->second == value;
+}
+
+NextionQueue *Nextion::new_queue_entry_(NextionComponentBase *component) {
+  NextionQueue *entry;
+  if (this->queue_pool_.empty()) {
+    entry = new NextionQueue;
+  } else {
+    entry = this->queue_pool_.back();
+    this->queue_pool_.pop_back();
+  }
+  entry->component = component;
+  entry->queue_time = millis();
+  return entry;
+}
+
+NextionComponentBase *Nextion::new_no_result_component_(const std::string &variable_name) {
+  NextionComponentBase *component;
+  if (this->no_result_pool_.empty()) {
+    component = new NextionComponentBase;
+  } else {
+    component = this->no_result_pool_.back();
+    this->no_result_pool_.pop_back();
+  }
+  component->set_variable_name(variable_name);
+  return component;
+}
+
+void Nextion::free_queue_entry_(NextionQueue *entry) {
+  if (entry->component != nullptr && entry->component->get_queue_type() == NextionQueueType::NO_RESULT) {
+    if (this->no_result_pool_.size() < QUEUE_POOL_SIZE) {
+      this->no_result_pool_.push_back(entry->component);
+    } else {
+      delete entry->component;
+    }
+  }
+  entry->component = nullptr;
+  if (this->queue_pool_.size() < QUEUE_POOL_SIZE) {
+    this->queue_pool_.push_back(entry);
+  } else {
+    delete entry;
+  }
+}
+
 bool Nextion::check_connect_() {
   if (this->get_is_connected_())
     return true;
@@ -110,7 +164,10 @@ void Nextion::reset_(bool reset_nextion) {
   while (this->available()) {  // Clear receive buffer
     this->read_byte(&d);
   };
+  for (auto *entry : this->nextion_queue_)
+    this->free_queue_entry_(entry);
   this->nextion_queue_.clear();
+  this->sent_values_.clear();
 }
 
 void Nextion::dump_config() {
@@ -185,6 +242,8 @@ bool Nextion::send_command_printf(const char *format, ...) {
   }
 
   if (this->send_command_(buffer)) {
+    // A raw command may change anything on the display
+    this->sent_values_.clear();
     this->add_no_result_to_queue_("send_command_printf");
     return true;
   }
@@ -212,8 +271,10 @@ void Nextion::print_queue_members_() {
 #endif
 
 void Nextion::loop() {
-  if (!this->check_connect_() || this->is_updating_)
+  if (!this->check_connect_() || this->is_updating_) {
+    this->flush_commands_();
     return;
+  }
 
   if (this->nextion_reports_is_setup_ && !this->sent_setup_commands_) {
     this->ignore_is_setup_ = true;
@@ -238,6 +299,7 @@ void Nextion::loop() {
 
   this->process_serial_();            // Receive serial data
   this->process_nextion_commands_();  // Process nextion return commands
+  this->flush_commands_();
 
   if (!this->nextion_reports_is_setup_) {
     if (this->started_ms_ == 0)
@@ -266,19 +328,17 @@ bool Nextion::remove_from_q_(bool report_empty) {
     if (component->get_variable_name() == "sleep_wake") {
       this->is_sleeping_ = false;
     }
-    delete component;
   }
-  delete nb;
+  this->free_queue_entry_(nb);
   this->nextion_queue_.pop_front();
   return true;
 }
 
 void Nextion::process_serial_() {
-  uint8_t d;
-
-  while (this->available()) {
-    read_byte(&d);
-    this->command_data_ += d;
+  const uint8_t *data;
+  size_t len;
+  while ((len = this->read_buffer(&data)) != 0) {
+    this->command_data_.append(reinterpret_cast<const char *>(data), len);
   }
 }
 // nextion.tech/instruction-set/
@@ -307,6 +367,11 @@ void Nextion::process_nextion_commands_() {
     to_process_length -= 1;
     to_process = this->command_data_.substr(1, to_process_length);
 
+    // Anything but a plain acknowledgement may mean that the display changed values by itself (touch, page change,
+    // wake up, restart) or failed to apply one, so forget what was sent and send the next values again
+    if (this->nextion_event_ != 0x01)
+      this->sent_values_.clear();
+
     switch (this->nextion_event_) {
       case 0x00:  // instruction sent by user has failed
         ESP_LOGW(TAG, "Nextion reported invalid instruction!");
@@ -369,8 +434,8 @@ void Nextion::process_nextion_commands_() {
 
               found = index;
 
+              this->free_queue_entry_(nb);
               delete component;
-              delete nb;
 
               break;
             }
@@ -480,7 +545,7 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_string(to_process, true, false);
         }
 
-        delete nb;
+        this->free_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -526,7 +591,7 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_int(value, true, false);
         }
 
-        delete nb;
+        this->free_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -694,6 +759,7 @@ void Nextion::process_nextion_commands_() {
             size_t buffer_to_send = component->get_wave_buffer().size() < 255 ? component->get_wave_buffer().size()
                                                                               : 255;  // ADDT command can only send 255
 
+            this->flush_commands_();
             this->write_array(component->get_wave_buffer().data(), static_cast<int>(buffer_to_send));
 
             ESP_LOGN(TAG, "Nextion sending waveform data for component id %d and waveform id %d, size %zu",
@@ -706,8 +772,8 @@ void Nextion::process_nextion_commands_() {
                                                  component->get_wave_buffer().begin() + buffer_to_send);
             }
             found = index;
+            this->free_queue_entry_(nb);
             delete component;
-            delete nb;
             break;
           }
           ++index;
@@ -753,10 +819,9 @@ void Nextion::process_nextion_commands_() {
           if (component->get_variable_name() == "sleep_wake") {
             this->is_sleeping_ = false;
           }
-          delete component;
         }
 
-        delete this->nextion_queue_[i];
+        this->free_queue_entry_(this->nextion_queue_[i]);
 
         this->nextion_queue_.erase(this->nextion_queue_.begin() + i);
 
@@ -824,6 +889,8 @@ void Nextion::set_nextion_text_state(const std::string &name, const std::string
 
 void Nextion::all_components_send_state_(bool force_update) {
   ESP_LOGD(TAG, "all_components_send_state_ ");
+  if (force_update)
+    this->sent_values_.clear();
   for (auto *binarysensortype : this->binarysensortype_) {
     if (force_update || binarysensortype->get_needs_to_send_update())
       binarysensortype->send_state_to_nextion();
@@ -862,6 +929,8 @@ void Nextion::update_components_by_prefix(const std::string &prefix) {
 }
 
 uint16_t Nextion::recv_ret_string_(std::string &response, uint32_t timeout, bool recv_flag) {
+  this->flush_commands_();
+
   uint16_t ret = 0;
   uint8_t c = 0;
   uint8_t nr_of_ff_bytes = 0;
@@ -910,12 +979,7 @@ uint16_t Nextion::recv_ret_string_(std::string &response, uint32_t timeout, bool
  * @param variable_name Name for the queue
  */
 void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  nextion_queue->component = new nextion::NextionComponentBase;
-  nextion_queue->component->set_variable_name(variable_name);
-
-  nextion_queue->queue_time = millis();
+  nextion::NextionQueue *nextion_queue = this->new_queue_entry_(this->new_no_result_component_(variable_name));
 
   this->nextion_queue_.push_back(nextion_queue);
 
@@ -1006,8 +1070,17 @@ void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &varia
   if ((!this->is_setup() && !this->ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_ignore_sleep_printf_(variable_name, "%s=%d", variable_name_to_send.c_str(),
-                                                         state_value);
+  // Sleep safe commands control the display itself and are always sent
+  std::string value = to_string(state_value);
+  if (!is_sleep_safe && this->is_value_sent_(variable_name_to_send, value)) {
+    ESP_LOGN(TAG, "Not sending unchanged %s=%s", variable_name_to_send.c_str(), value.c_str());
+    return;
+  }
+
+  if (this->add_no_result_to_queue_with_ignore_sleep_printf_(variable_name, "%s=%d", variable_name_to_send.c_str(),
+                                                             state_value) &&
+      !is_sleep_safe)
+    this->sent_values_[variable_name_to_send] = value;
 }
 
 /**
@@ -1034,26 +1107,27 @@ void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &varia
   if ((!this->is_setup() && !this->ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_printf_(variable_name, "%s=\"%s\"", variable_name_to_send.c_str(),
-                                            state_value.c_str());
+  std::string value = "\"" + state_value + "\"";
+  if (this->is_value_sent_(variable_name_to_send, value)) {
+    ESP_LOGN(TAG, "Not sending unchanged %s=%s", variable_name_to_send.c_str(), value.c_str());
+    return;
+  }
+
+  if (this->add_no_result_to_queue_with_printf_(variable_name, "%s=%s", variable_name_to_send.c_str(), value.c_str()))
+    this->sent_values_[variable_name_to_send] = value;
 }
 
 void Nextion::add_to_get_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_))
     return;
 
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  nextion_queue->component = component;
-  nextion_queue->queue_time = millis();
-
   ESP_LOGN(TAG, "Add to queue type: %s component %s", component->get_queue_type_string().c_str(),
            component->get_variable_name().c_str());
 
   std::string command = "get " + component->get_variable_name_to_send();
 
   if (this->send_command_(command)) {
-    this->nextion_queue_.push_back(nextion_queue);
+    this->nextion_queue_.push_back(this->new_queue_entry_(component));
   }
 }
 
@@ -1069,18 +1143,13 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return;
 
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  nextion_queue->component = new nextion::NextionComponentBase;
-  nextion_queue->queue_time = millis();
-
   size_t buffer_to_send = component->get_wave_buffer_size() < 255 ? component->get_wave_buffer_size()
                                                                   : 255;  // ADDT command can only send 255
 
   std::string command = "addt " + to_string(component->get_component_id()) + "," +
                         to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
   if (this->send_command_(command)) {
-    this->nextion_queue_.push_back(nextion_queue);
+    this->nextion_queue_.push_back(this->new_queue_entry_(this->new_no_result_component_("")));
   }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <deque>
+#include <map>
 #include "esphome/core/defines.h"
 #include "esphome/components/uart/uart.h"
 #include "nextion_base.h"
@@ -729,6 +730,24 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 
  protected:
   std::deque<NextionQueue *> nextion_queue_;
+  /// Finished queue entries (and the components of NO_RESULT entries) kept for reuse.
+  std::vector<NextionQueue *> queue_pool_;
+  std::vector<NextionComponentBase *> no_result_pool_;
+  NextionQueue *new_queue_entry_(NextionComponentBase *component);
+  NextionComponentBase *new_no_result_component_(const std::string &variable_name);
+  /// Return a finished entry to the pool, together with its component for NO_RESULT entries.
+  void free_queue_entry_(NextionQueue *entry);
+
+  /// Commands are collected here and written with a single UART write per loop.
+  std::string command_buffer_;
+  void flush_commands_();
+
+  /// Last value sent to each component property, to skip sending the same value again.
+  std::map<std::string, std::string> sent_values_;
+  bool is_value_sent_(const std::string &key, const std::string &value);
+  /// Set `component.property` to `value` (already formatted for the command), unless it was sent already.
+  void set_component_property_(const std::string &variable_name, const char *component, const char *property,
+                               const std::string &value);
   uint16_t recv_ret_string_(std::string &response, uint32_t timeout, bool recv_flag);
   void all_components_send_state_(bool force_update = false);
   uint64_t comok_sent_ = 0;
@@ -778,15 +797,18 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 #endif
 
   /**
-   * will request chunk_size chunks from the web server
-   * and send each to the nextion
-   * @param int contentLength Total size of the file
-   * @param uint32_t chunk_size
-   * @return true if success, false for failure.
+   * will stream the file from range_start from the web server
+   * and send it to the nextion in 4096 byte chunks, downloading the next chunk while the nextion writes one
+   * @param int range_start The offset to start at
+   * @return the offset to continue from, -1 for failure.
    */
   int content_length_ = 0;
   int tft_size_ = 0;
   int upload_by_chunks_(HTTPClient *http, int range_start);
+  /// Read from the stream until `len` bytes are in `buffer`, returns false if that took longer than `timeout` ms.
+  bool fill_transfer_buffer_(WiFiClient *stream, uint8_t *buffer, size_t *received, size_t len, uint32_t timeout);
+  /// Ask the nextion to accept an upload at `baud_rate`, returns true when it is ready for the data.
+  bool start_upload_(uint32_t baud_rate);
 
   bool upload_with_range_(uint32_t range_start, uint32_t range_end);
 
@@ -7,7 +7,10 @@ namespace nextion {
 static const char *const TAG = "nextion";
 
 // Sleep safe commands
-void Nextion::soft_reset() { this->send_command_("rest"); }
+void Nextion::soft_reset() {
+  this->sent_values_.clear();
+  this->send_command_("rest");
+}
 
 void Nextion::set_wake_up_page(uint8_t page_id) {
   if (page_id > 255) {
@@ -108,7 +111,11 @@ void Nextion::set_component_text_printf(const char *component, const char *forma
 }
 
 // General Nextion
-void Nextion::goto_page(const char *page) { this->add_no_result_to_queue_with_printf_("goto_page", "page %s", page); }
+void Nextion::goto_page(const char *page) {
+  // Components of the new page start with the values of the page editor
+  this->sent_values_.clear();
+  this->add_no_result_to_queue_with_printf_("goto_page", "page %s", page);
+}
 
 void Nextion::set_backlight_brightness(float brightness) {
   if (brightness < 0 || brightness > 1.0) {
@@ -144,15 +151,26 @@ void Nextion::disable_component_touch(const char *component) {
 }
 
 void Nextion::set_component_picture(const char *component, const char *picture) {
-  this->add_no_result_to_queue_with_printf_("set_component_picture", "%s.val=%s", component, picture);
+  this->set_component_property_("set_component_picture", component, "val", picture);
 }
 
 void Nextion::set_component_text(const char *component, const char *text) {
-  this->add_no_result_to_queue_with_printf_("set_component_text", "%s.txt=\"%s\"", component, text);
+  this->set_component_property_("set_component_text", component, "txt", "\"" + std::string(text) + "\"");
 }
 
 void Nextion::set_component_value(const char *component, int value) {
-  this->add_no_result_to_queue_with_printf_("set_component_value", "%s.val=%d", component, value);
+  this->set_component_property_("set_component_value", component, "val", to_string(value));
+}
+
+void Nextion::set_component_property_(const std::string &variable_name, const char *component, const char *property,
+                                      const std::string &value) {
+  std::string key = std::string(component) + "." + property;
+  if (this->is_value_sent_(key, value)) {
+    ESP_LOGN(TAG, "Not sending unchanged %s=%s", key.c_str(), value.c_str());
+    return;
+  }
+  if (this->add_no_result_to_queue_with_printf_(variable_name, "%s=%s", key.c_str(), value.c_str()))
+    this->sent_values_[key] = value;
 }
 
 void Nextion::add_waveform_data(int component_id, uint8_t channel_number, uint8_t value) {
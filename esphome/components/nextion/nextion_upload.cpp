@@ -13,37 +13,41 @@ static const char *const TAG = "nextion_upload";
 // Followed guide
 // https://unofficialnextion.com/t/nextion-upload-protocol-v1-2-the-fast-one/1044/2
 
-int Nextion::upload_by_chunks_(HTTPClient *http, int range_start) {
-  int range_end = 0;
-
-  if (range_start == 0 && this->transfer_buffer_size_ > 16384) {  // Start small at the first run in case of a big skip
-    range_end = 16384 - 1;
-  } else {
-    range_end = range_start + this->transfer_buffer_size_ - 1;
+static const uint32_t UPLOAD_CHUNK_SIZE = 4096;
+/// The fastest baud rate the Nextion accepts for uploads, tried before falling back to the configured one.
+static const uint32_t UPLOAD_BAUD_RATE = 921600;
+
+static LargeBufferUsage nextion_upload_usage(  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    "nextion_upload");
+
+bool Nextion::fill_transfer_buffer_(WiFiClient *stream, uint8_t *buffer, size_t *received, size_t len,
+                                    uint32_t timeout) {
+  uint32_t start = millis();
+  while (*received < len) {
+    size_t size = stream->available();
+    if (size == 0) {
+      if (timeout == 0 || millis() - start > timeout)
+        return false;
+      App.feed_wdt();
+      delay(0);
+      continue;
+    }
+    size = std::min(size, len - *received);
+    *received += stream->readBytes(&buffer[*received], size);
   }
+  return true;
+}
 
-  if (range_end > this->tft_size_)
-    range_end = this->tft_size_;
-
-  bool begin_status = false;
-#ifdef ARDUINO_ARCH_ESP32
-  begin_status = http->begin(this->tft_url_.c_str());
-#endif
-#ifdef ARDUINO_ARCH_ESP8266
-#ifndef CLANG_TIDY
-  http->setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  http->setRedirectLimit(3);
-  begin_status = http->begin(*this->get_wifi_client_(), this->tft_url_.c_str());
-#endif
-#endif
-
+int Nextion::upload_by_chunks_(HTTPClient *http, int range_start) {
+  // Request the whole rest of the file, it streams over the same connection until the Nextion asks to skip ahead
   char range_header[64];
-  sprintf(range_header, "bytes=%d-%d", range_start, range_end);
+  sprintf(range_header, "bytes=%d-%d", range_start, this->tft_size_ - 1);
 
   ESP_LOGD(TAG, "Requesting range: %s", range_header);
 
   int tries = 1;
   int code = 0;
+  bool begin_status = false;
   while (tries <= 5) {
 #ifdef ARDUINO_ARCH_ESP32
     begin_status = http->begin(this->tft_url_.c_str());
@@ -77,29 +81,24 @@ int Nextion::upload_by_chunks_(HTTPClient *http, int range_start) {
     return -1;
   }
 
-  std::string recv_string;
-  size_t size = 0;
-  int sent = 0;
-  int range = range_end - range_start;
-
-  while (sent < range) {
-    size = http->getStreamPtr()->available();
-    if (!size) {
-      App.feed_wdt();
-      delay(0);
-      continue;
-    }
-    int c = http->getStreamPtr()->readBytes(
-        &this->transfer_buffer_[sent], ((size > this->transfer_buffer_size_) ? this->transfer_buffer_size_ : size));
-    sent += c;
+  WiFiClient *stream = http->getStreamPtr();
+  // Two chunks: one is written to the Nextion while the next one is downloaded
+  uint8_t *current = this->transfer_buffer_;
+  uint8_t *next = this->transfer_buffer_ + UPLOAD_CHUNK_SIZE;
+  int offset = range_start;
+  size_t current_len = std::min<size_t>(UPLOAD_CHUNK_SIZE, this->tft_size_ - offset);
+  size_t received = 0;
+  if (!this->fill_transfer_buffer_(stream, current, &received, current_len, 15000)) {
+    ESP_LOGW(TAG, "Timeout downloading the tft file at %d", offset);
+    http->end();
+    return -1;
   }
-  http->end();
-  ESP_LOGN(TAG, "this->content_length_ %d sent %d", this->content_length_, sent);
-  for (uint32_t i = 0; i < range; i += 4096) {
-    this->write_array(&this->transfer_buffer_[i], 4096);
-    this->content_length_ -= 4096;
-    ESP_LOGN(TAG, "this->content_length_ %d range %d range_end %d range_start %d", this->content_length_, range,
-             range_end, range_start);
+
+  while (true) {
+    this->write_array(current, current_len);
+    offset += current_len;
+    this->content_length_ -= current_len;
+    ESP_LOGN(TAG, "this->content_length_ %d offset %d", this->content_length_, offset);
 
     if (!this->upload_first_chunk_sent_) {
       this->upload_first_chunk_sent_ = true;
@@ -107,21 +106,87 @@ int Nextion::upload_by_chunks_(HTTPClient *http, int range_start) {
       App.feed_wdt();
     }
 
-    this->recv_ret_string_(recv_string, 2048, true);
-    if (recv_string[0] == 0x08) {
-      uint32_t result = 0;
-      for (int i = 0; i < 4; ++i) {
-        result += static_cast<uint8_t>(recv_string[i + 1]) << (8 * i);
+    // Download the next chunk while the Nextion writes this one to its flash. It answers 0x05 to continue, or
+    // 0x08 with the offset to continue from when it can skip the unchanged part of the file.
+    size_t next_len = std::min<size_t>(UPLOAD_CHUNK_SIZE, this->tft_size_ - offset);
+    received = 0;
+    uint8_t response[5];
+    size_t response_len = 0;
+    uint32_t start = millis();
+    while (millis() - start < 5000) {
+      if (this->available()) {
+        this->read_byte(&response[response_len++]);
+        if (response[0] != 0x08 || response_len == sizeof(response))
+          break;
+        continue;
       }
+      if (received < next_len) {
+        this->fill_transfer_buffer_(stream, next, &received, next_len, 0);
+      } else {
+        App.feed_wdt();
+        delay(1);
+      }
+    }
+
+    if (response_len == 0) {
+      ESP_LOGW(TAG, "No response from the Nextion at %d", offset);
+    } else if (response[0] == 0x08 && response_len == sizeof(response)) {
+      uint32_t result = encode_uint32(response[4], response[3], response[2], response[1]);
       if (result > 0) {
-        ESP_LOGD(TAG, "Nextion reported new range %d", result);
+        ESP_LOGD(TAG, "Nextion reported new range %u", result);
         this->content_length_ = this->tft_size_ - result;
+        http->end();
         return result;
       }
     }
-    recv_string.clear();
+
+    if (next_len == 0)
+      break;
+    if (!this->fill_transfer_buffer_(stream, next, &received, next_len, 15000)) {
+      ESP_LOGW(TAG, "Timeout downloading the tft file at %d", offset);
+      http->end();
+      return -1;
+    }
+    std::swap(current, next);
+    current_len = next_len;
   }
-  return range_end + 1;
+  http->end();
+  return offset;
+}
+
+bool Nextion::start_upload_(uint32_t baud_rate) {
+  char command[128];
+  // Tells the Nextion the content length of the tft file and baud rate it will be sent at
+  // Once the Nextion accepts the command it will wait until the file is successfully uploaded
+  // If it fails for any reason a power cycle of the display will be needed
+  sprintf(command, "whmi-wris %d,%u,1", this->content_length_, baud_rate);
+
+  // Clear serial receive buffer
+  uint8_t d;
+  while (this->available()) {
+    this->read_byte(&d);
+  };
+
+  this->send_command_(command);
+  this->flush_commands_();
+  // The Nextion answers at the new baud rate
+  if (baud_rate != this->parent_->get_baud_rate())
+    this->parent_->update_baud_rate(baud_rate);
+
+  App.feed_wdt();
+
+  std::string response;
+  ESP_LOGD(TAG, "Waiting for upgrade response at %u baud", baud_rate);
+  this->recv_ret_string_(response, 2000, true);  // This can take some time to return
+
+  // The Nextion display will, if it's ready to accept data, send a 0x05 byte.
+  ESP_LOGD(TAG, "Upgrade response is %s %zu", response.c_str(), response.length());
+
+  for (int i = 0; i < response.length(); i++) {
+    ESP_LOGD(TAG, "Available %d : 0x%02X", i, response[i]);
+  }
+
+  return response.find(0x05) != std::string::npos;
 }
 
 void Nextion::upload_tft() {
@@ -154,12 +219,8 @@ void Nextion::upload_tft() {
   if (!begin_status) {
     this->is_updating_ = false;
     ESP_LOGD(TAG, "connection failed");
-#ifdef ARDUINO_ARCH_ESP32
-    if (psramFound())
-      free(this->transfer_buffer_);
-    else
-#endif
-      delete this->transfer_buffer_;
+    large_buffer_free(this->transfer_buffer_, this->transfer_buffer_size_, &nextion_upload_usage);
+    this->transfer_buffer_ = nullptr;
     return;
   } else {
     ESP_LOGD(TAG, "Connected");
@@ -207,86 +268,42 @@ void Nextion::upload_tft() {
 
   this->send_command_("sleep=0");
   this->set_backlight_brightness(1.0);
+  this->flush_commands_();
   delay(250);  // NOLINT
 
   App.feed_wdt();
 
-  char command[128];
-  // Tells the Nextion the content length of the tft file and baud rate it will be sent at
-  // Once the Nextion accepts the command it will wait until the file is successfully uploaded
-  // If it fails for any reason a power cycle of the display will be needed
-  sprintf(command, "whmi-wris %d,%d,1", this->content_length_, this->parent_->get_baud_rate());
-
-  // Clear serial receive buffer
-  uint8_t d;
-  while (this->available()) {
-    this->read_byte(&d);
-  };
-
-  this->send_command_(command);
-
-  App.feed_wdt();
-
-  std::string response;
-  ESP_LOGD(TAG, "Waiting for upgrade response");
-  this->recv_ret_string_(response, 2000, true);  // This can take some time to return
-
-  // The Nextion display will, if it's ready to accept data, send a 0x05 byte.
-  ESP_LOGD(TAG, "Upgrade response is %s %zu", response.c_str(), response.length());
-
-  for (int i = 0; i < response.length(); i++) {
-    ESP_LOGD(TAG, "Available %d : 0x%02X", i, response[i]);
+  uint32_t baud_rate = this->parent_->get_baud_rate();
+  bool ready = false;
+  if (baud_rate < UPLOAD_BAUD_RATE) {
+    ready = this->start_upload_(UPLOAD_BAUD_RATE);
+    if (!ready) {
+      ESP_LOGD(TAG, "Nextion did not accept %u baud, using %u baud", UPLOAD_BAUD_RATE, baud_rate);
+      this->parent_->update_baud_rate(baud_rate);
+      delay(250);  // NOLINT
+    }
   }
+  if (!ready)
+    ready = this->start_upload_(baud_rate);
 
-  if (response.find(0x05) != std::string::npos) {
+  if (ready) {
     ESP_LOGD(TAG, "preparation for tft update done");
   } else {
-    ESP_LOGD(TAG, "preparation for tft update failed %d \"%s\"", response[0], response.c_str());
+    ESP_LOGD(TAG, "preparation for tft update failed");
     this->upload_end_();
   }
 
-  // Nextion wants 4096 bytes at a time. Make chunk_size a multiple of 4096
-#ifdef ARDUINO_ARCH_ESP32
-  uint32_t chunk_size = 8192;
-  if (psramFound()) {
-    chunk_size = this->content_length_;
-  } else {
-    if (ESP.getFreeHeap() > 40960) {  // 32K to keep on hand
-      int chunk = int((ESP.getFreeHeap() - 32768) / 4096);
-      chunk_size = chunk * 4096;
-      chunk_size = chunk_size > 65536 ? 65536 : chunk_size;
-    } else if (ESP.getFreeHeap() < 10240) {
-      chunk_size = 4096;
-    }
-  }
-#else
-  uint32_t chunk_size = ESP.getFreeHeap() < 10240 ? 4096 : 8192;
-#endif
+  // Nextion wants 4096 bytes at a time, keep one chunk to download while the other one is sent
+  uint32_t chunk_size = 2 * UPLOAD_CHUNK_SIZE;
 
   if (this->transfer_buffer_ == nullptr) {
-#ifdef ARDUINO_ARCH_ESP32
-    if (psramFound()) {
-      ESP_LOGD(TAG, "Allocating PSRAM buffer size %d, Free PSRAM size is %u", chunk_size, ESP.getFreePsram());
-      this->transfer_buffer_ = (uint8_t *) ps_malloc(chunk_size);
-      if (this->transfer_buffer_ == nullptr) {
-        ESP_LOGE(TAG, "Could not allocate buffer size %d!", chunk_size);
-        this->upload_end_();
-      }
-    } else {
-#endif
-      ESP_LOGD(TAG, "Allocating buffer size %d, Heap size is %u", chunk_size, ESP.getFreeHeap());
-      this->transfer_buffer_ = new uint8_t[chunk_size];
-      if (!this->transfer_buffer_) {  // Try a smaller size
-        ESP_LOGD(TAG, "Could not allocate buffer size: %d trying 4096 instead", chunk_size);
-        chunk_size = 4096;
-        ESP_LOGD(TAG, "Allocating %d buffer", chunk_size);
-        this->transfer_buffer_ = new uint8_t[chunk_size];
-
-        if (!this->transfer_buffer_)
-          this->upload_end_();
-#ifdef ARDUINO_ARCH_ESP32
-      }
-#endif
+    ESP_LOGD(TAG, "Allocating buffer size %d, Heap size is %u", chunk_size, ESP.getFreeHeap());
+    // Keep the internal heap for the (TLS) connection
+    this->transfer_buffer_ =
+        static_cast<uint8_t *>(large_buffer_allocate(chunk_size, &nextion_upload_usage, LARGE_BUFFER_PSRAM));
+    if (this->transfer_buffer_ == nullptr) {
+      ESP_LOGE(TAG, "Could not allocate buffer size %d!", chunk_size);
+      this->upload_end_();
     }
 
     this->transfer_buffer_size_ = chunk_size;
@@ -70,7 +70,7 @@ NUMBER_SCHEMA = cv.MQTT_COMPONENT_SCHEMA.extend(
 async def setup_number_core_(
     var, config, *, min_value: float, max_value: float, step: Optional[float]
 ):
-    cg.add(var.set_name(config[CONF_NAME]))
+    cg.setup_entity_name(var, config[CONF_NAME])
     if CONF_INTERNAL in config:
         cg.add(var.set_internal(config[CONF_INTERNAL]))
 
@@ -19,7 +19,7 @@ template<typename... Ts> class NumberSetAction : public Action<Ts...> {
   NumberSetAction(Number *number) : number_(number) {}
   TEMPLATABLE_VALUE(float, value)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto call = this->number_->make_call();
     call.set_value(this->value_.value(x...));
     call.perform();
@@ -55,7 +55,7 @@ template<typename... Ts> class NumberInRangeCondition : public Condition<Ts...>
 
   void set_min(float min) { this->min_ = min; }
   void set_max(float max) { this->max_ = max; }
-  bool check(Ts... x) override {
+  bool check(const Ts &... x) override {
     const float state = this->parent_->state;
     if (isnan(this->min_)) {
       return state <= this->max_;
@@ -37,9 +37,6 @@ void Number::publish_state(float state) {
   this->state_callback_.call(state);
 }
 
-void Number::add_on_state_callback(std::function<void(float)> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
 
 uint32_t Number::hash_base() { return 2282307003UL; }
 
@@ -40,14 +40,14 @@ class NumberTraits {
   float get_max_value() const { return max_value_; }
   void set_step(float step) { step_ = step; }
   float get_step() const { return step_; }
-  void set_icon(std::string icon) { icon_ = std::move(icon); }
-  const std::string &get_icon() const { return icon_; }
+  void set_icon(const char *icon) { icon_ = icon; }
+  std::string get_icon() const { return icon_; }
 
  protected:
   float min_value_ = NAN;
   float max_value_ = NAN;
   float step_ = NAN;
-  std::string icon_;
+  const char *icon_{""};
 };
 
 /** Base-class for all numbers.
@@ -63,7 +63,11 @@ class Number : public Nameable {
   NumberCall make_call() { return NumberCall(this); }
   void set(float value) { make_call().set_value(value).perform(); }
 
-  void add_on_state_callback(std::function<void(float)> &&callback);
+  template<typename F> void add_on_state_callback(F &&callback) {
+
+    this->state_callback_.add(std::forward<F>(callback));
+
+  }
 
   NumberTraits traits;
 
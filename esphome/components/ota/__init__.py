@@ -3,6 +3,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import automation
 from esphome.const import (
+    ARDUINO_VERSION_ESP8266,
     CONF_ID,
     CONF_NUM_ATTEMPTS,
     CONF_PASSWORD,
@@ -22,6 +23,18 @@ CONF_ON_PROGRESS = "on_progress"
 CONF_ON_END = "on_end"
 CONF_ON_ERROR = "on_error"
 
+
+def _supports_compressed_images():
+    """Whether the ESP8266 bootloader of the selected core unpacks gzip images."""
+    framework_versions = {v: k for k, v in ARDUINO_VERSION_ESP8266.items()}
+    version = framework_versions.get(CORE.arduino_version)
+    if version is None:
+        return False
+    if version == "dev":
+        return True
+    return tuple(int(x) for x in version.split(".")) >= (2, 7, 0)
+
+
 ota_ns = cg.esphome_ns.namespace("ota")
 OTAState = ota_ns.enum("OTAState")
 OTAComponent = ota_ns.class_("OTAComponent", cg.Component)
@@ -88,6 +101,8 @@ async def to_code(config):
 
     if CORE.is_esp8266:
         cg.add_library("Update", None)
+        if _supports_compressed_images():
+            cg.add_define("USE_OTA_COMPRESSION")
     elif CORE.is_esp32:
         cg.add_library("Hash", None)
 
@@ -5,11 +5,22 @@
 #include "esphome/core/util.h"
 
 #include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
 #include <MD5Builder.h>
 #ifdef ARDUINO_ARCH_ESP32
 #include <Update.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
 #endif
 #include <StreamString.h>
+#ifdef USE_ESP32_BLE_TRACKER
+#include "esphome/components/esp32_ble_tracker/esp32_ble_tracker.h"
+#endif
+#ifdef USE_WIFI
+#include "esphome/components/wifi/wifi_component.h"
+#endif
 
 namespace esphome {
 namespace ota {
@@ -18,6 +29,24 @@ static const char *const TAG = "ota";
 
 static const uint8_t OTA_VERSION_1_0 = 1;
 
+static const uint8_t FEATURE_SUPPORTS_COMPRESSION = 0x01;
+static const uint8_t FEATURE_SUPPORTS_RESUME = 0x02;
+static const uint8_t FEATURE_SUPPORTS_DELTA = 0x04;
+
+static const uint8_t UPLOAD_MODE_DELTA = 0x01;
+static const uint8_t DELTA_COMMAND_LITERAL = 0x00;
+static const uint8_t DELTA_COMMAND_COPY = 0x01;
+
+/// How long an interrupted update is kept open for the client to reconnect and resume it.
+static const uint32_t OTA_RESUME_TIMEOUT = 5 * 60 * 1000;
+
+/// Size of the heap buffer the binary is received into, enough to empty the TCP receive window in one read.
+#ifdef ARDUINO_ARCH_ESP32
+static const size_t OTA_DATA_BUFFER_SIZE = 8192;
+#else
+static const size_t OTA_DATA_BUFFER_SIZE = 2048;
+#endif
+
 void OTAComponent::setup() {
   this->server_ = new WiFiServer(this->port_);
   this->server_->begin();
@@ -53,11 +82,20 @@ void OTAComponent::handle_() {
   bool update_started = false;
   uint32_t total = 0;
   uint32_t last_progress = 0;
-  uint8_t buf[1024];
+  // word aligned, delta copies read the running firmware into it
+  alignas(uint32_t) uint8_t buf[1024];
   char *sbuf = reinterpret_cast<char *>(buf);
+  std::unique_ptr<uint8_t[]> data_buf;
+  uint8_t *data = buf;
+  size_t data_size = sizeof(buf);
   uint32_t ota_size;
   uint8_t ota_features;
-  (void) ota_features;
+  uint8_t device_features;
+  OTAResponseTypes res;
+  bool resume_candidate = false;
+  bool resumable = false;
+  bool delta = false;
+  uint32_t resume_offset = 0;
 
   if (!this->client_.connected()) {
     this->client_ = this->server_->available();
@@ -71,6 +109,16 @@ void OTAComponent::handle_() {
 
   ESP_LOGD(TAG, "Starting OTA Update from %s...", this->client_.remoteIP().toString().c_str());
   this->status_set_warning();
+#ifdef USE_WIFI
+  // The loop doesn't run during the update, so power save has to be left now
+  if (wifi::global_wifi_component != nullptr)
+    wifi::global_wifi_component->suspend_power_save();
+#endif
+#ifdef USE_ESP32_BLE_TRACKER
+  // Leave the radio to WiFi, the main loop is blocked until the update finishes or fails
+  if (esp32_ble_tracker::global_esp32_ble_tracker != nullptr)
+    esp32_ble_tracker::global_esp32_ble_tracker->request_busy_scan(30000);
+#endif
 #ifdef USE_OTA_STATE_CALLBACK
   this->state_callback_.call(OTA_STARTED, 0.0f, 0);
 #endif
@@ -99,8 +147,23 @@ void OTAComponent::handle_() {
   ota_features = buf[0];  // NOLINT
   ESP_LOGV(TAG, "OTA features is 0x%02X", ota_features);
 
-  // Acknowledge header - 1 byte
-  this->client_.write(OTA_RESPONSE_HEADER_OK);
+  // The bootloader unpacks gzip compressed images when it copies them over the running firmware, so the client may
+  // send the binary compressed (and its size and MD5 are those of the compressed image)
+  device_features = FEATURE_SUPPORTS_RESUME | FEATURE_SUPPORTS_DELTA;
+#ifdef USE_OTA_COMPRESSION
+  device_features |= FEATURE_SUPPORTS_COMPRESSION;
+#endif
+
+  // Acknowledge header - 1 byte, plus 1 byte of our own features for clients that know about them
+  if ((ota_features & (FEATURE_SUPPORTS_RESUME | FEATURE_SUPPORTS_DELTA)) != 0) {
+    this->client_.write(OTA_RESPONSE_SUPPORTS_FEATURES);
+    this->client_.write(device_features);
+  } else if ((ota_features & device_features & FEATURE_SUPPORTS_COMPRESSION) != 0) {
+    this->client_.write(OTA_RESPONSE_SUPPORTS_COMPRESSION);
+  } else {
+    this->client_.write(OTA_RESPONSE_HEADER_OK);
+  }
+  ota_features &= device_features;
 
   if (!this->password_.empty()) {
     this->client_.write(OTA_RESPONSE_REQUEST_AUTH);
@@ -161,6 +224,21 @@ void OTAComponent::handle_() {
   // Acknowledge auth OK - 1 byte
   this->client_.write(OTA_RESPONSE_AUTH_OK);
 
+  if ((ota_features & FEATURE_SUPPORTS_DELTA) != 0) {
+    // Send MD5 of the running firmware, 32 bytes hex, so that the client can pick the image to diff against
+    this->running_size_ = ESP.getSketchSize();
+    String running_md5 = ESP.getSketchMD5();
+    if (running_md5.length() == 32) {
+      memcpy(sbuf, running_md5.c_str(), 32);
+    } else {
+      memset(sbuf, '0', 32);
+    }
+    if (this->client_.write(reinterpret_cast<uint8_t *>(sbuf), 32) != 32) {
+      ESP_LOGW(TAG, "Writing running firmware MD5 failed!");
+      goto error;
+    }
+  }
+
   // Read size, 4 bytes MSB first
   if (!this->wait_receive_(buf, 4)) {
     ESP_LOGW(TAG, "Reading size failed!");
@@ -177,36 +255,16 @@ void OTAComponent::handle_() {
   global_preferences.prevent_write(true);
 #endif
 
-  if (!Update.begin(ota_size, U_FLASH)) {
-    StreamString ss;
-    Update.printError(ss);
-#ifdef ARDUINO_ARCH_ESP8266
-    if (ss.indexOf("Invalid bootstrapping") != -1) {
-      error_code = OTA_RESPONSE_ERROR_INVALID_BOOTSTRAPPING;
+  // An interrupted update of an image with the same size can be resumed, the MD5 below tells if it is the same image
+  resume_candidate = this->resume_pending_ && (ota_features & FEATURE_SUPPORTS_RESUME) != 0 &&
+                     ota_size == this->resume_size_;
+  if (!resume_candidate) {
+    this->abort_resume_();
+    res = this->begin_update_(ota_size);
+    if (res != OTA_RESPONSE_UPDATE_PREPARE_OK) {
+      error_code = res;
       goto error;
     }
-    if (ss.indexOf("new Flash config wrong") != -1 || ss.indexOf("new Flash config wsong") != -1) {
-      error_code = OTA_RESPONSE_ERROR_WRONG_NEW_FLASH_CONFIG;
-      goto error;
-    }
-    if (ss.indexOf("Flash config wrong real") != -1 || ss.indexOf("Flash config wsong real") != -1) {
-      error_code = OTA_RESPONSE_ERROR_WRONG_CURRENT_FLASH_CONFIG;
-      goto error;
-    }
-    if (ss.indexOf("Not Enough Space") != -1) {
-      error_code = OTA_RESPONSE_ERROR_ESP8266_NOT_ENOUGH_SPACE;
-      goto error;
-    }
-#endif
-#ifdef ARDUINO_ARCH_ESP32
-    if (ss.indexOf("Bad Size Given") != -1) {
-      error_code = OTA_RESPONSE_ERROR_ESP32_NOT_ENOUGH_SPACE;
-      goto error;
-    }
-#endif
-    ESP_LOGW(TAG, "Preparing OTA partition failed! '%s'", ss.c_str());
-    error_code = OTA_RESPONSE_ERROR_UPDATE_PREPARE;
-    goto error;
   }
   update_started = true;
 
@@ -220,22 +278,78 @@ void OTAComponent::handle_() {
   }
   sbuf[32] = '\0';
   ESP_LOGV(TAG, "Update: Binary MD5 is %s", sbuf);
-  Update.setMD5(sbuf);
-
-  // Acknowledge MD5 OK - 1 byte
-  this->client_.write(OTA_RESPONSE_BIN_MD5_OK);
+  if (resume_candidate && strcmp(sbuf, this->resume_md5_) == 0) {
+    this->cancel_timeout("resume");
+    this->resume_pending_ = false;
+    resume_offset = Update.progress();
+    ESP_LOGD(TAG, "Resuming interrupted update at %u of %u bytes", resume_offset, ota_size);  // NOLINT
+  } else {
+    if (resume_candidate) {
+      this->abort_resume_();
+      res = this->begin_update_(ota_size);
+      if (res != OTA_RESPONSE_UPDATE_PREPARE_OK) {
+        update_started = false;
+        error_code = res;
+        goto error;
+      }
+    }
+    Update.setMD5(sbuf);
+    memcpy(this->resume_md5_, sbuf, sizeof(this->resume_md5_));
+    this->resume_size_ = ota_size;
+  }
+  resumable = (ota_features & FEATURE_SUPPORTS_RESUME) != 0;
+
+  if (resume_offset != 0) {
+    // Acknowledge resume - 1 byte, then the offset to continue at, 4 bytes MSB first
+    this->client_.write(OTA_RESPONSE_RESUME_OK);
+    buf[0] = resume_offset >> 24;
+    buf[1] = resume_offset >> 16;
+    buf[2] = resume_offset >> 8;
+    buf[3] = resume_offset;
+    this->client_.write(buf, 4);
+  } else {
+    // Acknowledge MD5 OK - 1 byte
+    this->client_.write(OTA_RESPONSE_BIN_MD5_OK);
+  }
+  total = resume_offset;
 
-  while (!Update.isFinished()) {
-    size_t available = this->wait_receive_(buf, 0);
-    if (!available) {
+  if ((ota_features & FEATURE_SUPPORTS_DELTA) != 0) {
+    // Read upload mode - 1 byte
+    if (!this->wait_receive_(buf, 1)) {
+      ESP_LOGW(TAG, "Reading upload mode failed!");
       goto error;
     }
+    delta = buf[0] == UPLOAD_MODE_DELTA;
+    ESP_LOGV(TAG, "Update: Receiving %s", delta ? "delta against running firmware" : "full image");
+  }
 
-    uint32_t written = Update.write(buf, available);
-    if (written != available) {
-      ESP_LOGW(TAG, "Error writing binary data to flash: %u != %u!", written, available);  // NOLINT
-      error_code = OTA_RESPONSE_ERROR_WRITING_FLASH;
-      goto error;
+  // Flash writes block the loop, a large buffer lets the sender refill the TCP window meanwhile
+  data_buf.reset(new (std::nothrow) uint8_t[OTA_DATA_BUFFER_SIZE]);
+  if (data_buf) {
+    data = data_buf.get();
+    data_size = OTA_DATA_BUFFER_SIZE;
+  }
+
+  while (!Update.isFinished()) {
+    uint32_t written;
+    if (delta) {
+      res = this->write_delta_command_(data, data_size, written);
+      if (res != OTA_RESPONSE_OK) {
+        error_code = res;
+        goto error;
+      }
+    } else {
+      size_t available = this->wait_receive_(data, 0, true, data_size);
+      if (!available) {
+        goto error;
+      }
+
+      written = Update.write(data, available);
+      if (written != available) {
+        ESP_LOGW(TAG, "Error writing binary data to flash: %u != %u!", written, available);  // NOLINT
+        error_code = OTA_RESPONSE_ERROR_WRITING_FLASH;
+        goto error;
+      }
     }
     total += written;
 
@@ -281,7 +395,9 @@ void OTAComponent::handle_() {
   App.safe_reboot();
 
 error:
-  if (update_started) {
+  // A dropped connection leaves the update open, the client reconnects and continues where it stopped
+  resumable = resumable && error_code == OTA_RESPONSE_ERROR_UNKNOWN && !Update.hasError();
+  if (update_started && !resumable) {
     StreamString ss;
     Update.printError(ss);
     ESP_LOGW(TAG, "Update end failed! Error: %s", ss.c_str());
@@ -292,14 +408,26 @@ error:
   }
   this->client_.stop();
 
+  if (resumable) {
+    ESP_LOGW(TAG, "Keeping update open at %u of %u bytes to resume it", Update.progress(), ota_size);  // NOLINT
+    this->resume_pending_ = true;
+    this->set_timeout("resume", OTA_RESUME_TIMEOUT, [this]() {
+      ESP_LOGW(TAG, "Interrupted update was not resumed, aborting it.");
+      this->abort_resume_();
+#ifdef ARDUINO_ARCH_ESP8266
+      global_preferences.prevent_write(false);
+#endif
+    });
+  }
+
 #ifdef ARDUINO_ARCH_ESP32
-  if (update_started) {
+  if (update_started && !resumable) {
     Update.abort();
   }
 #endif
 
 #ifdef ARDUINO_ARCH_ESP8266
-  if (update_started) {
+  if (update_started && !resumable) {
     Update.end();
   }
 #endif
@@ -310,11 +438,111 @@ error:
 #endif
 
 #ifdef ARDUINO_ARCH_ESP8266
-  global_preferences.prevent_write(false);
+  if (!this->resume_pending_)
+    global_preferences.prevent_write(false);
+#endif
+}
+
+OTAResponseTypes OTAComponent::begin_update_(uint32_t ota_size) {
+  if (!Update.begin(ota_size, U_FLASH)) {
+    StreamString ss;
+    Update.printError(ss);
+#ifdef ARDUINO_ARCH_ESP8266
+    if (ss.indexOf("Invalid bootstrapping") != -1) {
+      return OTA_RESPONSE_ERROR_INVALID_BOOTSTRAPPING;
+    }
+    if (ss.indexOf("new Flash config wrong") != -1 || ss.indexOf("new Flash config wsong") != -1) {
+      return OTA_RESPONSE_ERROR_WRONG_NEW_FLASH_CONFIG;
+    }
+    if (ss.indexOf("Flash config wrong real") != -1 || ss.indexOf("Flash config wsong real") != -1) {
+      return OTA_RESPONSE_ERROR_WRONG_CURRENT_FLASH_CONFIG;
+    }
+    if (ss.indexOf("Not Enough Space") != -1) {
+      return OTA_RESPONSE_ERROR_ESP8266_NOT_ENOUGH_SPACE;
+    }
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+    if (ss.indexOf("Bad Size Given") != -1) {
+      return OTA_RESPONSE_ERROR_ESP32_NOT_ENOUGH_SPACE;
+    }
+#endif
+    ESP_LOGW(TAG, "Preparing OTA partition failed! '%s'", ss.c_str());
+    return OTA_RESPONSE_ERROR_UPDATE_PREPARE;
+  }
+  return OTA_RESPONSE_UPDATE_PREPARE_OK;
+}
+
+OTAResponseTypes OTAComponent::write_delta_command_(uint8_t *data, size_t data_size, uint32_t &written) {
+  // Read command - 1 byte type, 4 bytes source offset and 4 bytes length, both MSB first
+  uint8_t header[9];
+  if (!this->wait_receive_(header, 9)) {
+    ESP_LOGW(TAG, "Reading delta command failed!");
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  uint8_t command = header[0];
+  uint32_t offset = encode_uint32(header[1], header[2], header[3], header[4]);
+  uint32_t length = encode_uint32(header[5], header[6], header[7], header[8]);
+
+  if (command == DELTA_COMMAND_COPY) {
+    if (offset % 4 != 0 || offset > this->running_size_ || length > this->running_size_ - offset) {
+      ESP_LOGW(TAG, "Delta copy of %u bytes at 0x%08X is outside of the running firmware!", length, offset);
+      return OTA_RESPONSE_ERROR_INVALID_DELTA;
+    }
+  } else if (command != DELTA_COMMAND_LITERAL) {
+    ESP_LOGW(TAG, "Unknown delta command 0x%02X!", command);
+    return OTA_RESPONSE_ERROR_INVALID_DELTA;
+  }
+
+  written = 0;
+  while (written < length) {
+    size_t chunk = std::min(size_t(length - written), data_size);
+    if (command == DELTA_COMMAND_COPY) {
+      if (!this->read_running_(offset + written, data, chunk)) {
+        ESP_LOGW(TAG, "Reading running firmware at 0x%08X failed!", offset + written);
+        return OTA_RESPONSE_ERROR_INVALID_DELTA;
+      }
+    } else {
+      chunk = this->wait_receive_(data, 0, true, chunk);
+      if (!chunk)
+        return OTA_RESPONSE_ERROR_UNKNOWN;
+    }
+
+    uint32_t res = Update.write(data, chunk);
+    if (res != chunk) {
+      ESP_LOGW(TAG, "Error writing binary data to flash: %u != %u!", res, chunk);  // NOLINT
+      return OTA_RESPONSE_ERROR_WRITING_FLASH;
+    }
+    written += chunk;
+    App.feed_wdt();
+  }
+  return OTA_RESPONSE_OK;
+}
+
+bool OTAComponent::read_running_(uint32_t offset, uint8_t *data, size_t len) {
+#ifdef ARDUINO_ARCH_ESP32
+  const esp_partition_t *running = esp_ota_get_running_partition();
+  return running != nullptr && esp_partition_read(running, offset, data, len) == ESP_OK;
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+  // The sketch starts at the beginning of the flash, reads must be word aligned and a multiple of 4 bytes long
+  return ESP.flashRead(offset, reinterpret_cast<uint32_t *>(data), (len + 3) & ~size_t(3));
+#endif
+}
+
+void OTAComponent::abort_resume_() {
+  if (!this->resume_pending_)
+    return;
+  this->cancel_timeout("resume");
+  this->resume_pending_ = false;
+#ifdef ARDUINO_ARCH_ESP32
+  Update.abort();
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+  Update.end();
 #endif
 }
 
-size_t OTAComponent::wait_receive_(uint8_t *buf, size_t bytes, bool check_disconnected) {
+size_t OTAComponent::wait_receive_(uint8_t *buf, size_t bytes, bool check_disconnected, size_t max_bytes) {
   size_t available = 0;
   uint32_t start = millis();
   do {
@@ -338,7 +566,7 @@ size_t OTAComponent::wait_receive_(uint8_t *buf, size_t bytes, bool check_discon
   } while (bytes == 0 ? available == 0 : available < bytes);
 
   if (bytes == 0)
-    bytes = std::min(available, size_t(1024));
+    bytes = std::min(available, max_bytes);
 
   bool success = false;
   for (uint32_t i = 0; !success && i < 100; i++) {
@@ -19,6 +19,9 @@ enum OTAResponseTypes {
   OTA_RESPONSE_BIN_MD5_OK = 67,
   OTA_RESPONSE_RECEIVE_OK = 68,
   OTA_RESPONSE_UPDATE_END_OK = 69,
+  OTA_RESPONSE_SUPPORTS_COMPRESSION = 70,
+  OTA_RESPONSE_SUPPORTS_FEATURES = 71,
+  OTA_RESPONSE_RESUME_OK = 72,
 
   OTA_RESPONSE_ERROR_MAGIC = 128,
   OTA_RESPONSE_ERROR_UPDATE_PREPARE = 129,
@@ -30,6 +33,7 @@ enum OTAResponseTypes {
   OTA_RESPONSE_ERROR_WRONG_NEW_FLASH_CONFIG = 135,
   OTA_RESPONSE_ERROR_ESP8266_NOT_ENOUGH_SPACE = 136,
   OTA_RESPONSE_ERROR_ESP32_NOT_ENOUGH_SPACE = 137,
+  OTA_RESPONSE_ERROR_INVALID_DELTA = 138,
   OTA_RESPONSE_ERROR_UNKNOWN = 255,
 };
 
@@ -61,6 +65,7 @@ class OTAComponent : public Component {
   void setup() override;
   void dump_config() override;
   float get_setup_priority() const override;
+  bool is_loop_latency_critical() const override { return true; }
   void loop() override;
 
   uint16_t get_port() const;
@@ -74,7 +79,14 @@ class OTAComponent : public Component {
   uint32_t read_rtc_();
 
   void handle_();
-  size_t wait_receive_(uint8_t *buf, size_t bytes, bool check_disconnected = true);
+  OTAResponseTypes begin_update_(uint32_t ota_size);
+  /// Receive one delta command and write its output to the update, `written` is the number of bytes written.
+  OTAResponseTypes write_delta_command_(uint8_t *data, size_t data_size, uint32_t &written);
+  bool read_running_(uint32_t offset, uint8_t *data, size_t len);
+  /// Abandon an interrupted update that was kept around for a resume.
+  void abort_resume_();
+  /// Receive exactly `bytes` bytes, or with bytes == 0 whatever is available, up to `max_bytes`.
+  size_t wait_receive_(uint8_t *buf, size_t bytes, bool check_disconnected = true, size_t max_bytes = 1024);
 
   std::string password_;
 
@@ -90,6 +102,11 @@ class OTAComponent : public Component {
   uint8_t safe_mode_num_attempts_;
   ESPPreferenceObject rtc_;
 
+  bool resume_pending_{false};  ///< an interrupted update is still open and can be resumed.
+  uint32_t resume_size_;
+  char resume_md5_[33];
+  uint32_t running_size_{0};  ///< size of the running firmware, delta copies may not read past it.
+
 #ifdef USE_OTA_STATE_CALLBACK
   CallbackManager<void(OTAState, float, uint8_t)> state_callback_{};
 #endif
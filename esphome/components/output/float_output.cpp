@@ -19,7 +19,9 @@ void FloatOutput::set_min_power(float min_power) {
 
 float FloatOutput::get_min_power() const { return this->min_power_; }
 
-void FloatOutput::set_level(float state) {
+void FloatOutput::set_level(float state) { this->set_level(state, 0); }
+
+void FloatOutput::set_level(float state, uint32_t fade_length) {
   state = clamp(state, 0.0f, 1.0f);
 
 #ifdef USE_POWER_SUPPLY
@@ -31,12 +33,14 @@ void FloatOutput::set_level(float state) {
 #endif
   if (this->is_inverted())
     state = 1.0f - state;
-  if (state == 0.0f) {  // regardless of min_power_, 0.0 means off
-    this->write_state(state);
-    return;
+  float adjusted_value = state;
+  if (state != 0.0f)  // regardless of min_power_, 0.0 means off
+    adjusted_value = (state * (this->max_power_ - this->min_power_)) + this->min_power_;
+  if (fade_length != 0 && this->supports_fade()) {
+    this->write_state_fade(adjusted_value, fade_length);
+  } else {
+    this->write_state(adjusted_value);
   }
-  float adjusted_value = (state * (this->max_power_ - this->min_power_)) + this->min_power_;
-  this->write_state(adjusted_value);
 }
 
 void FloatOutput::write_state(bool state) { this->set_level(state != this->inverted_ ? 1.0f : 0.0f); }
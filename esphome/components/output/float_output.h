@@ -52,6 +52,15 @@ class FloatOutput : public BinaryOutput {
    */
   void set_level(float state);
 
+  /** Set the level of this float output, fading to it over `fade_length` ms if the output can fade in hardware.
+   *
+   * Outputs that can't (see supports_fade()) set the level right away.
+   */
+  void set_level(float state, uint32_t fade_length);
+
+  /// Whether this output can fade to a level by itself, without being written repeatedly.
+  virtual bool supports_fade() const { return false; }
+
   /** Set the frequency of the output for PWM outputs.
    *
    * Implemented only by components which can set the output PWM frequency.
@@ -73,6 +82,8 @@ class FloatOutput : public BinaryOutput {
   /// Implement BinarySensor's write_enabled; this should never be called.
   void write_state(bool state) override;
   virtual void write_state(float state) = 0;
+  /// Fade to the state over `fade_length` ms (never 0), only called for outputs that support fades.
+  virtual void write_state_fade(float state, uint32_t fade_length) { this->write_state(state); }
 
   float max_power_{1.0f};
   float min_power_{0.0f};
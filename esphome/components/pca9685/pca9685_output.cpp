@@ -84,11 +84,17 @@ void PCA9685Output::dump_config() {
 }
 
 void PCA9685Output::loop() {
-  if (this->min_channel_ == 0xFF || !this->update_)
+  if (this->min_channel_ == 0xFF || this->update_channels_ == 0)
     return;
 
+  // Write the range of changed channels in one auto-increment burst, starting at its LEDn_ON_L register
+  uint8_t first = __builtin_ctz(this->update_channels_);
+  uint8_t last = 31 - __builtin_clz(this->update_channels_);
+  uint8_t data[16 * 4];
+  uint8_t *ptr = data;
+
   const uint16_t num_channels = this->max_channel_ - this->min_channel_ + 1;
-  for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
+  for (uint8_t channel = first; channel <= last; channel++) {
     uint16_t phase_begin = uint16_t(channel - this->min_channel_) / num_channels * 4096;
     uint16_t phase_end;
     uint16_t amount = this->pwm_amounts_[channel];
@@ -106,26 +112,28 @@ void PCA9685Output::loop() {
     ESP_LOGVV(TAG, "Channel %02u: amount=%04u phase_begin=%04u phase_end=%04u", channel, amount, phase_begin,
               phase_end);
 
-    uint8_t data[4];
-    data[0] = phase_begin & 0xFF;
-    data[1] = (phase_begin >> 8) & 0xFF;
-    data[2] = phase_end & 0xFF;
-    data[3] = (phase_end >> 8) & 0xFF;
+    *ptr++ = phase_begin & 0xFF;
+    *ptr++ = (phase_begin >> 8) & 0xFF;
+    *ptr++ = phase_end & 0xFF;
+    *ptr++ = (phase_end >> 8) & 0xFF;
+  }
 
-    uint8_t reg = PCA9685_REGISTER_LED0 + 4 * channel;
-    if (!this->write_bytes(reg, data, 4)) {
-      this->status_set_warning();
-      return;
-    }
+  uint8_t reg = PCA9685_REGISTER_LED0 + 4 * first;
+  if (!this->write_bytes(reg, data, ptr - data)) {
+    this->status_set_warning();
+    return;
   }
 
   this->status_clear_warning();
-  this->update_ = false;
+  this->update_channels_ = 0;
 }
 
 PCA9685Channel *PCA9685Output::create_channel(uint8_t channel) {
   this->min_channel_ = std::min(this->min_channel_, channel);
   this->max_channel_ = std::max(this->max_channel_, channel);
+  // The phases depend on the channel range, so write all channels once it is known
+  for (uint8_t i = this->min_channel_; i <= this->max_channel_; i++)
+    this->update_channels_ |= 1 << i;
   auto *c = new PCA9685Channel(this, channel);
   return c;
 }
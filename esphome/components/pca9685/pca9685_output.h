@@ -49,7 +49,7 @@ class PCA9685Output : public Component, public i2c::I2CDevice {
 
   void set_channel_value_(uint8_t channel, uint16_t value) {
     if (this->pwm_amounts_[channel] != value)
-      this->update_ = true;
+      this->update_channels_ |= 1 << channel;
     this->pwm_amounts_[channel] = value;
   }
 
@@ -61,7 +61,8 @@ class PCA9685Output : public Component, public i2c::I2CDevice {
   uint16_t pwm_amounts_[16] = {
       0,
   };
-  bool update_{true};
+  /// Bit mask of the channels that changed since the last loop(), written together in the next one
+  uint16_t update_channels_{0};
 };
 
 }  // namespace pca9685
@@ -75,9 +75,7 @@ void HOT PCD8544::display() {
     this->command(this->PCD8544_SETXADDR | col);
 
     this->start_data_();
-    for (; col <= maxcol; col++) {
-      this->write_byte(this->buffer_[(this->get_width_internal() * p) + col]);
-    }
+    this->write_array(this->buffer_ + this->get_width_internal() * p, maxcol - col + 1);
     this->end_data_();
   }
 
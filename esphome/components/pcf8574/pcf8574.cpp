@@ -14,19 +14,30 @@ void PCF8574Component::setup() {
     return;
   }
 
+  if (this->interrupt_pin_ != nullptr)
+    this->interrupt_pin_->setup();
+
   this->write_gpio_();
   this->read_gpio_();
 }
+void PCF8574Component::loop() {
+  // INT is active low and is released when the port is read
+  if (this->interrupt_pin_ != nullptr && this->interrupt_pin_->digital_read())
+    return;
+  this->input_valid_ = false;
+}
 void PCF8574Component::dump_config() {
   ESP_LOGCONFIG(TAG, "PCF8574:");
   LOG_I2C_DEVICE(this)
   ESP_LOGCONFIG(TAG, "  Is PCF8575: %s", YESNO(this->pcf8575_));
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
   if (this->is_failed()) {
     ESP_LOGE(TAG, "Communication with PCF8574 failed!");
   }
 }
 bool PCF8574Component::digital_read(uint8_t pin) {
-  this->read_gpio_();
+  if (!this->input_valid_)
+    this->read_gpio_();
   return this->input_mask_ & (1 << pin);
 }
 void PCF8574Component::digital_write(uint8_t pin, bool value) {
@@ -71,6 +82,7 @@ bool PCF8574Component::read_gpio_() {
     this->status_set_warning();
     return false;
   }
+  this->input_valid_ = true;
   this->status_clear_warning();
   return true;
 }
@@ -87,6 +99,8 @@ bool PCF8574Component::write_gpio_() {
   uint8_t data[2];
   data[0] = value;
   data[1] = value >> 8;
+  // The quasi-bidirectional pins read back what is written, for outputs and for inputs that are released
+  this->input_valid_ = false;
   if (!this->write_bytes_raw(data, this->pcf8575_ ? 2 : 1)) {
     this->status_set_warning();
     return false;
@@ -18,10 +18,14 @@ class PCF8574Component : public Component, public i2c::I2CDevice {
   PCF8574Component() = default;
 
   void set_pcf8575(bool pcf8575) { pcf8575_ = pcf8575; }
+  /// Only read the port again after the INT output (active low) connected to this pin signalled a change.
+  void set_interrupt_pin(GPIOPin *interrupt_pin) { interrupt_pin_ = interrupt_pin; }
 
   /// Check i2c availability and setup masks
   void setup() override;
-  /// Helper function to read the value of a pin.
+  /// Invalidate the port state once per loop iteration, or only after an interrupt if an INT pin is set.
+  void loop() override;
+  /// Helper function to read the value of a pin, all reads in one loop iteration share one bus transaction.
   bool digital_read(uint8_t pin);
   /// Helper function to write the value of a pin.
   void digital_write(uint8_t pin, bool value);
@@ -43,7 +47,10 @@ class PCF8574Component : public Component, public i2c::I2CDevice {
   uint16_t output_mask_{0x00};
   /// The state read in read_gpio_ - 1 means HIGH, 0 means LOW
   uint16_t input_mask_{0x00};
+  /// Whether input_mask_ was read in this loop iteration
+  bool input_valid_{false};
   bool pcf8575_;  ///< TRUE->16-channel PCF8575, FALSE->8-channel PCF8574
+  GPIOPin *interrupt_pin_{nullptr};
 };
 
 /// Helper class to expose a PCF8574 pin as an internal input GPIO pin.
@@ -17,95 +17,56 @@ void PMSX003Component::set_formaldehyde_sensor(sensor::Sensor *formaldehyde_sens
   formaldehyde_sensor_ = formaldehyde_sensor;
 }
 
-void PMSX003Component::loop() {
-  const uint32_t now = millis();
-  if (now - this->last_transmission_ >= 500) {
-    // last transmission too long ago. Reset RX index.
-    this->data_index_ = 0;
-  }
-
-  if (this->available() == 0)
-    return;
-
-  this->last_transmission_ = now;
-  while (this->available() != 0) {
-    this->read_byte(&this->data_[this->data_index_]);
-    auto check = this->check_byte_();
-    if (!check.has_value()) {
-      // finished
-      this->parse_data_();
-      this->data_index_ = 0;
-    } else if (!*check) {
-      // wrong data
-      this->data_index_ = 0;
-    } else {
-      // next byte
-      this->data_index_++;
-    }
-  }
+void PMSX003Component::setup() {
+  // start (16bit) + length (16bit) + DATA (payload_length-2 bytes) + checksum (16bit)
+  this->parser_.set_header({0x42, 0x4D});
+  this->parser_.set_length_field(2, 2, true, 4);
+  this->parser_.set_validator(
+      [this](const uint8_t *frame, size_t length) { return this->check_frame_(frame, length); });
+  this->parser_.set_on_frame([this](const uint8_t *frame, size_t length) { this->parse_data_(frame); });
 }
+void PMSX003Component::loop() { this->parser_.read_from(this); }
 float PMSX003Component::get_setup_priority() const { return setup_priority::DATA; }
-optional<bool> PMSX003Component::check_byte_() {
-  uint8_t index = this->data_index_;
-  uint8_t byte = this->data_[index];
-
-  if (index == 0)
-    return byte == 0x42;
-
-  if (index == 1)
-    return byte == 0x4D;
-
-  if (index == 2)
-    return true;
-
-  uint16_t payload_length = this->get_16_bit_uint_(2);
-  if (index == 3) {
-    bool length_matches = false;
-    switch (this->type_) {
-      case PMSX003_TYPE_X003:
-        length_matches = payload_length == 28 || payload_length == 20;
-        break;
-      case PMSX003_TYPE_5003T:
-        length_matches = payload_length == 28;
-        break;
-      case PMSX003_TYPE_5003ST:
-        length_matches = payload_length == 36;
-        break;
-    }
-
-    if (!length_matches) {
-      ESP_LOGW(TAG, "PMSX003 length %u doesn't match. Are you using the correct PMSX003 type?", payload_length);
-      return false;
-    }
-    return true;
+bool PMSX003Component::check_frame_(const uint8_t *data, size_t length) {
+  uint16_t payload_length = length - 4;
+  bool length_matches = false;
+  switch (this->type_) {
+    case PMSX003_TYPE_X003:
+      length_matches = payload_length == 28 || payload_length == 20;
+      break;
+    case PMSX003_TYPE_5003T:
+      length_matches = payload_length == 28;
+      break;
+    case PMSX003_TYPE_5003ST:
+      length_matches = payload_length == 36;
+      break;
   }
 
-  // start (16bit) + length (16bit) + DATA (payload_length-2 bytes) + checksum (16bit)
-  uint8_t total_size = 4 + payload_length;
-
-  if (index < total_size - 1)
-    return true;
+  if (!length_matches) {
+    ESP_LOGW(TAG, "PMSX003 length %u doesn't match. Are you using the correct PMSX003 type?", payload_length);
+    return false;
+  }
 
   // checksum is without checksum bytes
   uint16_t checksum = 0;
-  for (uint8_t i = 0; i < total_size - 2; i++)
-    checksum += this->data_[i];
+  for (size_t i = 0; i < length - 2; i++)
+    checksum += data[i];
 
-  uint16_t check = this->get_16_bit_uint_(total_size - 2);
+  uint16_t check = this->get_16_bit_uint_(data, length - 2);
   if (checksum != check) {
     ESP_LOGW(TAG, "PMSX003 checksum mismatch! 0x%02X!=0x%02X", checksum, check);
     return false;
   }
 
-  return {};
+  return true;
 }
 
-void PMSX003Component::parse_data_() {
+void PMSX003Component::parse_data_(const uint8_t *data) {
   switch (this->type_) {
     case PMSX003_TYPE_X003: {
-      uint16_t pm_1_0_concentration = this->get_16_bit_uint_(10);
-      uint16_t pm_2_5_concentration = this->get_16_bit_uint_(12);
-      uint16_t pm_10_0_concentration = this->get_16_bit_uint_(14);
+      uint16_t pm_1_0_concentration = this->get_16_bit_uint_(data, 10);
+      uint16_t pm_2_5_concentration = this->get_16_bit_uint_(data, 12);
+      uint16_t pm_10_0_concentration = this->get_16_bit_uint_(data, 14);
       ESP_LOGD(TAG,
                "Got PM1.0 Concentration: %u µg/m^3, PM2.5 Concentration %u µg/m^3, PM10.0 Concentration: %u µg/m^3",
                pm_1_0_concentration, pm_2_5_concentration, pm_10_0_concentration);
@@ -118,9 +79,9 @@ void PMSX003Component::parse_data_() {
       break;
     }
     case PMSX003_TYPE_5003T: {
-      uint16_t pm_2_5_concentration = this->get_16_bit_uint_(12);
-      float temperature = this->get_16_bit_uint_(24) / 10.0f;
-      float humidity = this->get_16_bit_uint_(26) / 10.0f;
+      uint16_t pm_2_5_concentration = this->get_16_bit_uint_(data, 12);
+      float temperature = this->get_16_bit_uint_(data, 24) / 10.0f;
+      float humidity = this->get_16_bit_uint_(data, 26) / 10.0f;
       ESP_LOGD(TAG, "Got PM2.5 Concentration: %u µg/m^3, Temperature: %.1f°C, Humidity: %.1f%%", pm_2_5_concentration,
                temperature, humidity);
       if (this->pm_2_5_sensor_ != nullptr)
@@ -132,12 +93,12 @@ void PMSX003Component::parse_data_() {
       break;
     }
     case PMSX003_TYPE_5003ST: {
-      uint16_t pm_1_0_concentration = this->get_16_bit_uint_(10);
-      uint16_t pm_2_5_concentration = this->get_16_bit_uint_(12);
-      uint16_t pm_10_0_concentration = this->get_16_bit_uint_(14);
-      uint16_t formaldehyde = this->get_16_bit_uint_(28);
-      float temperature = this->get_16_bit_uint_(30) / 10.0f;
-      float humidity = this->get_16_bit_uint_(32) / 10.0f;
+      uint16_t pm_1_0_concentration = this->get_16_bit_uint_(data, 10);
+      uint16_t pm_2_5_concentration = this->get_16_bit_uint_(data, 12);
+      uint16_t pm_10_0_concentration = this->get_16_bit_uint_(data, 14);
+      uint16_t formaldehyde = this->get_16_bit_uint_(data, 28);
+      float temperature = this->get_16_bit_uint_(data, 30) / 10.0f;
+      float humidity = this->get_16_bit_uint_(data, 32) / 10.0f;
       ESP_LOGD(TAG, "Got PM2.5 Concentration: %u µg/m^3, Temperature: %.1f°C, Humidity: %.1f%% Formaldehyde: %u µg/m^3",
                pm_2_5_concentration, temperature, humidity, formaldehyde);
       if (this->pm_1_0_sensor_ != nullptr)
@@ -158,8 +119,8 @@ void PMSX003Component::parse_data_() {
 
   this->status_clear_warning();
 }
-uint16_t PMSX003Component::get_16_bit_uint_(uint8_t start_index) {
-  return (uint16_t(this->data_[start_index]) << 8) | uint16_t(this->data_[start_index + 1]);
+uint16_t PMSX003Component::get_16_bit_uint_(const uint8_t *data, uint8_t start_index) {
+  return (uint16_t(data[start_index]) << 8) | uint16_t(data[start_index + 1]);
 }
 void PMSX003Component::dump_config() {
   ESP_LOGCONFIG(TAG, "PMSX003:");
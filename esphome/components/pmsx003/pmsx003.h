@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/frame_parser.h"
 
 namespace esphome {
 namespace pmsx003 {
@@ -16,6 +17,7 @@ enum PMSX003Type {
 class PMSX003Component : public uart::UARTDevice, public Component {
  public:
   PMSX003Component() = default;
+  void setup() override;
   void loop() override;
   float get_setup_priority() const override;
   void dump_config() override;
@@ -29,13 +31,11 @@ class PMSX003Component : public uart::UARTDevice, public Component {
   void set_formaldehyde_sensor(sensor::Sensor *formaldehyde_sensor);
 
  protected:
-  optional<bool> check_byte_();
-  void parse_data_();
-  uint16_t get_16_bit_uint_(uint8_t start_index);
+  bool check_frame_(const uint8_t *data, size_t length);
+  void parse_data_(const uint8_t *data);
+  uint16_t get_16_bit_uint_(const uint8_t *data, uint8_t start_index);
 
-  uint8_t data_[64];
-  uint8_t data_index_{0};
-  uint32_t last_transmission_{0};
+  uart::FrameParser parser_;
   PMSX003Type type_;
   sensor::Sensor *pm_1_0_sensor_{nullptr};
   sensor::Sensor *pm_2_5_sensor_{nullptr};
@@ -1,8 +1,14 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome import automation
+from esphome import automation, pins
 from esphome.components import nfc
-from esphome.const import CONF_ID, CONF_ON_TAG_REMOVED, CONF_ON_TAG, CONF_TRIGGER_ID
+from esphome.const import (
+    CONF_ID,
+    CONF_ON_TAG_REMOVED,
+    CONF_ON_TAG,
+    CONF_TRIGGER_ID,
+    CONF_IRQ_PIN,
+)
 
 CODEOWNERS = ["@OttoWinter", "@jesserockz"]
 AUTO_LOAD = ["binary_sensor", "nfc"]
@@ -28,6 +34,7 @@ PN532IsWritingCondition = pn532_ns.class_(
 PN532_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(PN532),
+        cv.Optional(CONF_IRQ_PIN): pins.gpio_input_pin_schema,
         cv.Optional(CONF_ON_TAG): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(PN532OnTagTrigger),
@@ -60,6 +67,10 @@ def CONFIG_SCHEMA(conf):
 async def setup_pn532(var, config):
     await cg.register_component(var, config)
 
+    if CONF_IRQ_PIN in config:
+        irq_pin = await cg.gpio_pin_expression(config[CONF_IRQ_PIN])
+        cg.add(var.set_irq_pin(irq_pin))
+
     for conf in config.get(CONF_ON_TAG, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
         cg.add(var.register_ontag_trigger(trigger))
@@ -13,6 +13,8 @@ static const char *const TAG = "pn532";
 
 void PN532::setup() {
   ESP_LOGCONFIG(TAG, "Setting up PN532...");
+  if (this->irq_pin_ != nullptr)
+    this->irq_pin_->setup();
 
   // Get version data
   if (!this->write_command_({PN532_COMMAND_VERSION_DATA})) {
@@ -73,12 +75,28 @@ void PN532::setup() {
   }
 
   this->turn_off_rf_();
+
+  if (this->irq_pin_ != nullptr)
+    this->start_auto_poll_();
 }
 
 void PN532::update() {
   for (auto *obj : this->binary_sensors_)
     obj->on_scan_end();
 
+  if (this->irq_pin_ != nullptr) {
+    // Tags are reported as they come, the PN532 finds a tag that stays again and again
+    if (!this->tag_seen_ && !this->current_uid_.empty()) {
+      this->report_tag_removed_();
+      this->current_uid_ = {};
+    }
+    this->tag_seen_ = false;
+    // Polling couldn't be started before
+    if (!this->requested_read_)
+      this->start_auto_poll_();
+    return;
+  }
+
   if (!this->write_command_({
           PN532_COMMAND_INLISTPASSIVETARGET,
           0x01,  // max 1 card
@@ -92,37 +110,74 @@ void PN532::update() {
   this->requested_read_ = true;
 }
 
+void PN532::start_auto_poll_() {
+  if (!this->write_command_({
+          PN532_COMMAND_INAUTOPOLL,
+          0xFF,  // poll until a tag is found
+          0x01,  // every 150ms
+          0x10,  // Mifare (ISO14443A 106 kbit/s)
+      })) {
+    ESP_LOGW(TAG, "Starting tag polling failed!");
+    this->status_set_warning();
+    return;
+  }
+  this->status_clear_warning();
+  this->requested_read_ = true;
+}
+
 void PN532::loop() {
   if (!this->requested_read_)
     return;
 
+  if (this->irq_pin_ != nullptr) {
+    // The IRQ pin is pulled low when the response is ready, until then the bus isn't used
+    if (this->irq_pin_->digital_read())
+      return;
+
+    std::vector<uint8_t> read;
+    bool success = this->read_response(PN532_COMMAND_INAUTOPOLL, read);
+    this->requested_read_ = false;
+    if (success && read.size() >= 3 && read[0] != 0) {
+      // Remove type and length of the target, the rest is like the response of InListPassiveTarget
+      read.erase(read.begin() + 1, read.begin() + 3);
+      this->tag_seen_ = true;
+    }
+    this->process_read_(success, read);
+
+    this->turn_off_rf_();
+    this->start_auto_poll_();
+    return;
+  }
+
   std::vector<uint8_t> read;
   bool success = this->read_response(PN532_COMMAND_INLISTPASSIVETARGET, read);
 
   this->requested_read_ = false;
+  this->process_read_(success, read);
+  this->turn_off_rf_();
+}
+
+void PN532::report_tag_removed_() {
+  if (this->current_uid_.empty())
+    return;
+  auto tag = new nfc::NfcTag(this->current_uid_);
+  for (auto *trigger : this->triggers_ontagremoved_)
+    trigger->process(tag);
+}
 
+void PN532::process_read_(bool success, std::vector<uint8_t> &read) {
   if (!success) {
     // Something failed
-    if (!this->current_uid_.empty()) {
-      auto tag = new nfc::NfcTag(this->current_uid_);
-      for (auto *trigger : this->triggers_ontagremoved_)
-        trigger->process(tag);
-    }
+    this->report_tag_removed_();
     this->current_uid_ = {};
-    this->turn_off_rf_();
     return;
   }
 
   uint8_t num_targets = read[0];
   if (num_targets != 1) {
     // no tags found or too many
-    if (!this->current_uid_.empty()) {
-      auto tag = new nfc::NfcTag(this->current_uid_);
-      for (auto *trigger : this->triggers_ontagremoved_)
-        trigger->process(tag);
-    }
+    this->report_tag_removed_();
     this->current_uid_ = {};
-    this->turn_off_rf_();
     return;
   }
 
@@ -198,8 +253,6 @@ void PN532::loop() {
   }
 
   this->read_mode();
-
-  this->turn_off_rf_();
 }
 
 bool PN532::write_command_(const std::vector<uint8_t> &data) {
@@ -353,6 +406,7 @@ void PN532::dump_config() {
       break;
   }
 
+  LOG_PIN("  IRQ Pin: ", this->irq_pin_);
   LOG_UPDATE_INTERVAL(this);
 
   for (auto *child : this->binary_sensors_) {
@@ -14,6 +14,7 @@ static const uint8_t PN532_COMMAND_SAMCONFIGURATION = 0x14;
 static const uint8_t PN532_COMMAND_RFCONFIGURATION = 0x32;
 static const uint8_t PN532_COMMAND_INDATAEXCHANGE = 0x40;
 static const uint8_t PN532_COMMAND_INLISTPASSIVETARGET = 0x4A;
+static const uint8_t PN532_COMMAND_INAUTOPOLL = 0x60;
 
 class PN532BinarySensor;
 class PN532OnTagTrigger;
@@ -29,6 +30,11 @@ class PN532 : public PollingComponent {
 
   void loop() override;
 
+  /** With the IRQ pin the PN532 polls for tags by itself (InAutoPoll) and reports them through the pin.
+   *
+   * Tags are then read as soon as they are presented, the bus is only used when the pin is active.
+   */
+  void set_irq_pin(GPIOPin *irq_pin) { this->irq_pin_ = irq_pin; }
   void register_tag(PN532BinarySensor *tag) { this->binary_sensors_.push_back(tag); }
   void register_ontag_trigger(PN532OnTagTrigger *trig) { this->triggers_ontag_.push_back(trig); }
   void register_ontagremoved_trigger(PN532OnTagTrigger *trig) { this->triggers_ontagremoved_.push_back(trig); }
@@ -46,6 +52,9 @@ class PN532 : public PollingComponent {
 
  protected:
   void turn_off_rf_();
+  void start_auto_poll_();
+  void process_read_(bool success, std::vector<uint8_t> &read);
+  void report_tag_removed_();
   bool write_command_(const std::vector<uint8_t> &data);
   bool read_ack_();
   void send_nack_();
@@ -77,7 +86,10 @@ class PN532 : public PollingComponent {
   bool write_mifare_ultralight_tag_(std::vector<uint8_t> &uid, nfc::NdefMessage *message);
   bool clean_mifare_ultralight_();
 
+  GPIOPin *irq_pin_{nullptr};
   bool requested_read_{false};
+  /// A tag was read since the last update, only used with the IRQ pin.
+  bool tag_seen_{false};
   std::vector<PN532BinarySensor *> binary_sensors_;
   std::vector<PN532OnTagTrigger *> triggers_ontag_;
   std::vector<PN532OnTagTrigger *> triggers_ontagremoved_;
@@ -129,7 +141,7 @@ class PN532OnFinishedWriteTrigger : public Trigger<> {
 
 template<typename... Ts> class PN532IsWritingCondition : public Condition<Ts...>, public Parented<PN532> {
  public:
-  bool check(Ts... x) override { return this->parent_->is_writing(); }
+  bool check(const Ts &... x) override { return this->parent_->is_writing(); }
 };
 
 }  // namespace pn532
@@ -1,310 +1,334 @@
 #include "prometheus_handler.h"
 #include "esphome/core/application.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain");
+/// Escape a label value as required by the text exposition format.
+static void append_label_value(std::string &out, const std::string &value) {
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      out.push_back('\\');
+      out.push_back(c);
+    } else if (c == '\n') {
+      out.append("\\n");
+    } else {
+      out.push_back(c);
+    }
+  }
+}
+/// Append a float like value_accuracy_to_string(), but without allocating a string.
+static void append_value(std::string &out, float value, int8_t accuracy_decimals) {
+  char buffer[VALUE_ACCURACY_MAX_LEN];
+  size_t len = value_accuracy_to_buf(buffer, sizeof(buffer), value, accuracy_decimals);
+  out.append(buffer, len);
+}
+static void append_value(std::string &out, int value) {
+  char buffer[12];
+  int len = snprintf(buffer, sizeof(buffer), "%d", value);
+  out.append(buffer, len);
+}
+/// Append one data point: metric, labels, extra labels starting with a comma, then value.
+static void append_row(std::string &out, const char *metric, const std::string &labels, const char *extra_labels) {
+  out.append(metric);
+  out.append(labels);
+  out.append(extra_labels);
+  out.append("} ");
+}
 
+void PrometheusHandler::setup() {
+  // The entities don't change after setup, so the layout of the page and all label sets are built only once
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
+  this->add_domain_(METRIC_SENSOR);
   for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+    this->add_entity_(METRIC_SENSOR, obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
+  this->add_domain_(METRIC_BINARY_SENSOR);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+    this->add_entity_(METRIC_BINARY_SENSOR, obj);
 #endif
 
 #ifdef USE_FAN
-  this->fan_type_(stream);
+  this->add_domain_(METRIC_FAN);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+    this->add_entity_(METRIC_FAN, obj);
 #endif
 
 #ifdef USE_LIGHT
-  this->light_type_(stream);
+  this->add_domain_(METRIC_LIGHT);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+    this->add_entity_(METRIC_LIGHT, obj);
 #endif
 
 #ifdef USE_COVER
-  this->cover_type_(stream);
+  this->add_domain_(METRIC_COVER);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+    this->add_entity_(METRIC_COVER, obj);
 #endif
 
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
+  this->add_domain_(METRIC_SWITCH);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+    this->add_entity_(METRIC_SWITCH, obj);
 #endif
 
-  req->send(stream);
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+void PrometheusHandler::add_domain_(MetricDomain domain) { this->slots_.push_back(Slot{domain, nullptr, ""}); }
+void PrometheusHandler::add_entity_(MetricDomain domain, Nameable *obj) {
+  if (obj->is_internal())
+    return;
+  std::string labels = "{id=\"";
+  append_label_value(labels, obj->get_object_id());
+  labels.append("\",name=\"");
+  append_label_value(labels, obj->get_name());
+  labels.push_back('"');
+  this->slots_.push_back(Slot{domain, obj, std::move(labels)});
 }
 
-// Type-specific implementation
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  // One slot is serialized at a time while the response is sent, so the page is never held in memory as a whole
+  struct Cursor {
+    size_t slot{0};
+    std::string chunk;
+    size_t offset{0};
+  };
+  auto cursor = std::make_shared<Cursor>();
+  cursor->chunk.reserve(512);
+  AsyncWebServerResponse *response = req->beginChunkedResponse(
+      "text/plain; version=0.0.4", [this, cursor](uint8_t *buffer, size_t max_len, size_t index) -> size_t {
+        size_t written = 0;
+        while (written < max_len) {
+          if (cursor->offset == cursor->chunk.size()) {
+            if (cursor->slot >= this->slots_.size())
+              break;
+            cursor->chunk.clear();
+            cursor->offset = 0;
+            this->write_slot_(this->slots_[cursor->slot++], cursor->chunk);
+            continue;
+          }
+          size_t len = std::min(max_len - written, cursor->chunk.size() - cursor->offset);
+          memcpy(buffer + written, cursor->chunk.data() + cursor->offset, len);
+          cursor->offset += len;
+          written += len;
+        }
+        return written;
+      });
+  req->send(response);
+}
+
+void PrometheusHandler::write_slot_(const Slot &slot, std::string &out) {
+  switch (slot.domain) {
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_sensor_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_sensor_failed GAUGE\n"));
+    case METRIC_SENSOR:
+      if (slot.obj == nullptr) {
+        out.append("# TYPE esphome_sensor_value gauge\n"
+                   "# TYPE esphome_sensor_failed gauge\n");
+      } else {
+        this->sensor_row_(out, static_cast<sensor::Sensor *>(slot.obj), slot.labels);
+      }
+      break;
+#endif
+#ifdef USE_BINARY_SENSOR
+    case METRIC_BINARY_SENSOR:
+      if (slot.obj == nullptr) {
+        out.append("# TYPE esphome_binary_sensor_value gauge\n"
+                   "# TYPE esphome_binary_sensor_failed gauge\n");
+      } else {
+        this->binary_sensor_row_(out, static_cast<binary_sensor::BinarySensor *>(slot.obj), slot.labels);
+      }
+      break;
+#endif
+#ifdef USE_FAN
+    case METRIC_FAN:
+      if (slot.obj == nullptr) {
+        out.append("# TYPE esphome_fan_value gauge\n"
+                   "# TYPE esphome_fan_failed gauge\n"
+                   "# TYPE esphome_fan_speed gauge\n"
+                   "# TYPE esphome_fan_oscillation gauge\n");
+      } else {
+        this->fan_row_(out, static_cast<fan::FanState *>(slot.obj), slot.labels);
+      }
+      break;
+#endif
+#ifdef USE_LIGHT
+    case METRIC_LIGHT:
+      if (slot.obj == nullptr) {
+        out.append("# TYPE esphome_light_state gauge\n"
+                   "# TYPE esphome_light_color gauge\n"
+                   "# TYPE esphome_light_effect_active gauge\n");
+      } else {
+        this->light_row_(out, static_cast<light::LightState *>(slot.obj), slot.labels);
+      }
+      break;
+#endif
+#ifdef USE_COVER
+    case METRIC_COVER:
+      if (slot.obj == nullptr) {
+        out.append("# TYPE esphome_cover_value gauge\n"
+                   "# TYPE esphome_cover_failed gauge\n"
+                   "# TYPE esphome_cover_tilt gauge\n");
+      } else {
+        this->cover_row_(out, static_cast<cover::Cover *>(slot.obj), slot.labels);
+      }
+      break;
+#endif
+#ifdef USE_SWITCH
+    case METRIC_SWITCH:
+      if (slot.obj == nullptr) {
+        out.append("# TYPE esphome_switch_value gauge\n"
+                   "# TYPE esphome_switch_failed gauge\n");
+      } else {
+        this->switch_row_(out, static_cast<switch_::Switch *>(slot.obj), slot.labels);
+      }
+      break;
+#endif
+    default:
+      break;
+  }
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
-  if (obj->is_internal())
-    return;
-  if (!isnan(obj->state)) {
+
+// Type-specific implementation
+#ifdef USE_SENSOR
+void PrometheusHandler::sensor_row_(std::string &out, sensor::Sensor *obj, const std::string &labels) {
+  if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 0\n"));
+    append_row(out, "esphome_sensor_failed", labels, "");
+    out.append("0\n");
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print('\n');
+    out.append("esphome_sensor_value");
+    out.append(labels);
+    out.append(",unit=\"");
+    append_label_value(out, obj->get_unit_of_measurement());
+    out.append("\"} ");
+    append_value(out, obj->state, obj->get_accuracy_decimals());
+    out.push_back('\n');
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 1\n"));
+    append_row(out, "esphome_sensor_failed", labels, "");
+    out.append("1\n");
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_binary_sensor_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_binary_sensor_failed GAUGE\n"));
-}
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
-  if (obj->is_internal())
-    return;
+void PrometheusHandler::binary_sensor_row_(std::string &out, binary_sensor::BinarySensor *obj,
+                                           const std::string &labels) {
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 0\n"));
+    append_row(out, "esphome_binary_sensor_failed", labels, "");
+    out.append("0\n");
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->state);
-    stream->print('\n');
+    append_row(out, "esphome_binary_sensor_value", labels, "");
+    out.append(obj->state ? "1\n" : "0\n");
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 1\n"));
+    append_row(out, "esphome_binary_sensor_failed", labels, "");
+    out.append("1\n");
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_fan_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_failed GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_speed GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_oscillation GAUGE\n"));
-}
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::FanState *obj) {
-  if (obj->is_internal())
-    return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::fan_row_(std::string &out, fan::FanState *obj, const std::string &labels) {
+  append_row(out, "esphome_fan_failed", labels, "");
+  out.append("0\n");
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+  append_row(out, "esphome_fan_value", labels, "");
+  out.append(obj->state ? "1\n" : "0\n");
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->speed);
-    stream->print('\n');
+    append_row(out, "esphome_fan_speed", labels, "");
+    append_value(out, obj->speed);
+    out.push_back('\n');
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print('\n');
+    append_row(out, "esphome_fan_oscillation", labels, "");
+    out.append(obj->oscillating ? "1\n" : "0\n");
   }
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_light_state GAUGE\n"));
-  stream->print(F("#TYPE esphome_light_color GAUGE\n"));
-  stream->print(F("#TYPE esphome_light_effect_active GAUGE\n"));
-}
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
-  if (obj->is_internal())
-    return;
+void PrometheusHandler::light_row_(std::string &out, light::LightState *obj, const std::string &labels) {
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(F("\n"));
+  append_row(out, "esphome_light_state", labels, "");
+  out.append(obj->remote_values.is_on() ? "1\n" : "0\n");
   // Brightness and RGBW
   light::LightColorValues color = obj->current_values;
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(F("\n"));
+  append_row(out, "esphome_light_color", labels, ",channel=\"brightness\"");
+  append_value(out, brightness, 2);
+  out.push_back('\n');
+  append_row(out, "esphome_light_color", labels, ",channel=\"r\"");
+  append_value(out, r, 2);
+  out.push_back('\n');
+  append_row(out, "esphome_light_color", labels, ",channel=\"g\"");
+  append_value(out, g, 2);
+  out.push_back('\n');
+  append_row(out, "esphome_light_color", labels, ",channel=\"b\"");
+  append_value(out, b, 2);
+  out.push_back('\n');
+  append_row(out, "esphome_light_color", labels, ",channel=\"w\"");
+  append_value(out, w, 2);
+  out.push_back('\n');
   // Effect
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
+    append_row(out, "esphome_light_effect_active", labels, ",effect=\"None\"");
+    out.append("0\n");
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(F("\"} 1\n"));
+    out.append("esphome_light_effect_active");
+    out.append(labels);
+    out.append(",effect=\"");
+    append_label_value(out, effect);
+    out.append("\"} 1\n");
   }
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_cover_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_cover_failed GAUGE\n"));
-}
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
-  if (obj->is_internal())
-    return;
-  if (!isnan(obj->position)) {
+void PrometheusHandler::cover_row_(std::string &out, cover::Cover *obj, const std::string &labels) {
+  if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 0\n"));
+    append_row(out, "esphome_cover_failed", labels, "");
+    out.append("0\n");
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->position);
-    stream->print('\n');
+    append_row(out, "esphome_cover_value", labels, "");
+    append_value(out, obj->position, 2);
+    out.push_back('\n');
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(obj->get_object_id().c_str());
-      stream->print(F("\",name=\""));
-      stream->print(obj->get_name().c_str());
-      stream->print(F("\"} "));
-      stream->print(obj->tilt);
-      stream->print('\n');
+      append_row(out, "esphome_cover_tilt", labels, "");
+      append_value(out, obj->tilt, 2);
+      out.push_back('\n');
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 1\n"));
+    append_row(out, "esphome_cover_failed", labels, "");
+    out.append("1\n");
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_switch_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_switch_failed GAUGE\n"));
-}
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
-  if (obj->is_internal())
-    return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::switch_row_(std::string &out, switch_::Switch *obj, const std::string &labels) {
+  append_row(out, "esphome_switch_failed", labels, "");
+  out.append("0\n");
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+  append_row(out, "esphome_switch_value", labels, "");
+  out.append(obj->state ? "1\n" : "0\n");
 }
 #endif
 
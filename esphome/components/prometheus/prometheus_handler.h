@@ -4,6 +4,9 @@
 #include "esphome/core/controller.h"
 #include "esphome/core/component.h"
 
+#include <string>
+#include <vector>
+
 namespace esphome {
 namespace prometheus {
 
@@ -22,58 +25,65 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
+  enum MetricDomain : uint8_t {
+    METRIC_SENSOR,
+    METRIC_BINARY_SENSOR,
+    METRIC_FAN,
+    METRIC_LIGHT,
+    METRIC_COVER,
+    METRIC_SWITCH,
+  };
+  /// Part of the metrics page: the type lines of a domain if obj is nullptr, otherwise the metrics of an entity.
+  struct Slot {
+    MetricDomain domain;
+    void *obj;
+    /// Precomputed label set of the entity without the closing brace, like {id="x",name="y"
+    std::string labels;
+  };
+
+  void add_domain_(MetricDomain domain);
+  void add_entity_(MetricDomain domain, Nameable *obj);
+  /// Append the metrics of one slot to out.
+  void write_slot_(const Slot &slot, std::string &out);
+
 #ifdef USE_SENSOR
-  /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  void sensor_row_(std::string &out, sensor::Sensor *obj, const std::string &labels);
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
   /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  void binary_sensor_row_(std::string &out, binary_sensor::BinarySensor *obj, const std::string &labels);
 #endif
 
 #ifdef USE_FAN
-  /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
   /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::FanState *obj);
+  void fan_row_(std::string &out, fan::FanState *obj, const std::string &labels);
 #endif
 
 #ifdef USE_LIGHT
-  /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
   /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  void light_row_(std::string &out, light::LightState *obj, const std::string &labels);
 #endif
 
 #ifdef USE_COVER
-  /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
   /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  void cover_row_(std::string &out, cover::Cover *obj, const std::string &labels);
 #endif
 
 #ifdef USE_SWITCH
-  /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
   /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  void switch_row_(std::string &out, switch_::Switch *obj, const std::string &labels);
 #endif
 
+  std::vector<Slot> slots_;
   web_server_base::WebServerBase *base_;
 };
 
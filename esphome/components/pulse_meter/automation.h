@@ -14,7 +14,7 @@ template<typename... Ts> class SetTotalPulsesAction : public Action<Ts...> {
 
   TEMPLATABLE_VALUE(uint32_t, total_pulses)
 
-  void play(Ts... x) override { this->pulse_meter_->set_total_pulses(this->total_pulses_.value(x...)); }
+  void play(const Ts &... x) override { this->pulse_meter_->set_total_pulses(this->total_pulses_.value(x...)); }
 
  protected:
   PulseMeterSensor *pulse_meter_;
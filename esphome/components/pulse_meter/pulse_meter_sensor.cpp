@@ -6,37 +6,49 @@ namespace pulse_meter {
 
 static const char *const TAG = "pulse_meter";
 
+/// Batches span at least this long, longer periods make up a batch on their own.
+static const uint32_t BATCH_DURATION_US = 1000000UL;
+
 void PulseMeterSensor::setup() {
   this->pin_->setup();
   this->isr_pin_ = pin_->to_isr();
   this->pin_->attach_interrupt(PulseMeterSensor::gpio_intr, this, CHANGE);
 
   this->last_detected_edge_us_ = 0;
-  this->last_valid_edge_us_ = 0;
 }
 
 void PulseMeterSensor::loop() {
-  const uint32_t now = micros();
+  PulseMeterEdge edge;
+  while (this->edges_.pop(edge)) {
+    if (this->has_last_edge_)
+      this->add_period_(edge.count - this->last_edge_.count, edge.time - this->last_edge_.time);
+    this->has_last_edge_ = true;
+    this->last_edge_ = edge;
+  }
+
+  const uint32_t overflow_count = this->edges_.get_overflow_count();
+  if (overflow_count != this->overflow_count_) {
+    // The pulse counts in the edges still give the right rate, only the jitter misses these periods
+    ESP_LOGV(TAG, "'%s': Edge queue overflowed %u times", this->get_name().c_str(),
+             overflow_count - this->overflow_count_);
+    this->overflow_count_ = overflow_count;
+  }
+
+  if (this->batch_time_us_ >= BATCH_DURATION_US)
+    this->publish_batch_();
 
   // If we've exceeded our timeout interval without receiving any pulses, assume 0 pulses/min until
-  // we get at least two valid pulses.
-  const uint32_t time_since_valid_edge_us = now - this->last_valid_edge_us_;
-  if ((this->last_valid_edge_us_ != 0) && (time_since_valid_edge_us > this->timeout_us_)) {
+  // we get at least two valid pulses. Read the time after the queue so that no edge is newer than now.
+  const uint32_t now = micros();
+  const uint32_t time_since_valid_edge_us = now - this->last_edge_.time;
+  if (this->has_last_edge_ && time_since_valid_edge_us > this->timeout_us_) {
     ESP_LOGD(TAG, "No pulse detected for %us, assuming 0 pulses/min", time_since_valid_edge_us / 1000000);
-    this->last_valid_edge_us_ = 0;
-    this->pulse_width_us_ = 0;
+    this->has_last_edge_ = false;
+    this->reset_batch_();
   }
-
-  // We quantize our pulse widths to 1 ms to avoid unnecessary jitter
-  const uint32_t pulse_width_ms = this->pulse_width_us_ / 1000;
-  if (this->pulse_width_dedupe_.next(pulse_width_ms)) {
-    if (pulse_width_ms == 0) {
-      // Treat 0 pulse width as 0 pulses/min (normally because we've not detected any pulses for a while)
-      this->publish_state(0);
-    } else {
-      // Calculate pulses/min from the pulse width in ms
-      this->publish_state((60.0 * 1000.0) / pulse_width_ms);
-    }
+  if (!this->has_last_edge_ && this->rate_dedupe_.next(0.0f)) {
+    // Treat not having any pulses (yet) as 0 pulses/min
+    this->publish_state(0);
   }
 
   if (this->total_sensor_ != nullptr) {
@@ -47,6 +59,38 @@ void PulseMeterSensor::loop() {
   }
 }
 
+void PulseMeterSensor::add_period_(uint32_t pulses, uint32_t period_us) {
+  this->batch_pulses_ += pulses;
+  this->batch_time_us_ += period_us;
+  if (pulses != 1)
+    // Spans edges dropped from the queue, only good for the mean rate
+    return;
+
+  this->batch_periods_++;
+  const float delta = period_us - this->batch_mean_us_;
+  this->batch_mean_us_ += delta / this->batch_periods_;
+  this->batch_m2_ += delta * (period_us - this->batch_mean_us_);
+}
+
+void PulseMeterSensor::publish_batch_() {
+  const float rate = (60.0f * 1000000.0f * this->batch_pulses_) / this->batch_time_us_;
+  if (this->rate_dedupe_.next(rate))
+    this->publish_state(rate);
+
+  if (this->jitter_sensor_ != nullptr && this->batch_periods_ >= 2)
+    this->jitter_sensor_->publish_state(sqrtf(this->batch_m2_ / (this->batch_periods_ - 1)));
+
+  this->reset_batch_();
+}
+
+void PulseMeterSensor::reset_batch_() {
+  this->batch_pulses_ = 0;
+  this->batch_time_us_ = 0;
+  this->batch_periods_ = 0;
+  this->batch_mean_us_ = 0.0f;
+  this->batch_m2_ = 0.0f;
+}
+
 void PulseMeterSensor::set_total_pulses(uint32_t pulses) { this->total_pulses_ = pulses; }
 
 void PulseMeterSensor::dump_config() {
@@ -54,6 +98,7 @@ void PulseMeterSensor::dump_config() {
   LOG_PIN("  Pin: ", this->pin_);
   ESP_LOGCONFIG(TAG, "  Filtering pulses shorter than %u µs", this->filter_us_);
   ESP_LOGCONFIG(TAG, "  Assuming 0 pulses/min after not receiving a pulse for %us", this->timeout_us_ / 1000000);
+  LOG_SENSOR("  ", "Jitter", this->jitter_sensor_);
 }
 
 void ICACHE_RAM_ATTR PulseMeterSensor::gpio_intr(PulseMeterSensor *sensor) {
@@ -69,13 +114,10 @@ void ICACHE_RAM_ATTR PulseMeterSensor::gpio_intr(PulseMeterSensor *sensor) {
 
   // Check to see if we should filter this edge out
   if ((now - sensor->last_detected_edge_us_) >= sensor->filter_us_) {
-    // Don't measure the first valid pulse (we need at least two pulses to measure the width)
-    if (sensor->last_valid_edge_us_ != 0) {
-      sensor->pulse_width_us_ = (now - sensor->last_valid_edge_us_);
-    }
-
     sensor->total_pulses_++;
-    sensor->last_valid_edge_us_ = now;
+    sensor->edge_count_++;
+    // loop() measures the periods between the queued edges
+    sensor->edges_.push(PulseMeterEdge{now, sensor->edge_count_});
   }
 
   sensor->last_detected_edge_us_ = now;
@@ -4,16 +4,32 @@
 #include "esphome/core/esphal.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/lock_free_queue.h"
 
 namespace esphome {
 namespace pulse_meter {
 
+struct PulseMeterEdge {
+  /// micros() when the interrupt ran.
+  uint32_t time;
+  /// Number of valid edges so far, a jump of more than one means edges were dropped from a full queue.
+  uint32_t count;
+};
+
+/** Measures the rate of pulses on a pin in pulses/min.
+ *
+ * The interrupt only timestamps the edges into a queue, loop() collects the periods into batches of about a
+ * second (or a single period for slow pulses) and publishes their mean rate and jitter, so that high pulse
+ * rates don't lose edges and give stable readings.
+ */
 class PulseMeterSensor : public sensor::Sensor, public Component {
  public:
   void set_pin(GPIOPin *pin) { this->pin_ = pin; }
   void set_filter_us(uint32_t filter) { this->filter_us_ = filter; }
   void set_timeout_us(uint32_t timeout) { this->timeout_us_ = timeout; }
   void set_total_sensor(sensor::Sensor *sensor) { this->total_sensor_ = sensor; }
+  /// Publish the standard deviation of the pulse periods of each batch in µs.
+  void set_jitter_sensor(sensor::Sensor *sensor) { this->jitter_sensor_ = sensor; }
 
   void set_total_pulses(uint32_t pulses);
 
@@ -25,19 +41,34 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
  protected:
   static void gpio_intr(PulseMeterSensor *sensor);
 
+  void add_period_(uint32_t pulses, uint32_t period_us);
+  void publish_batch_();
+  void reset_batch_();
+
   GPIOPin *pin_ = nullptr;
   ISRInternalGPIOPin *isr_pin_;
   uint32_t filter_us_ = 0;
   uint32_t timeout_us_ = 1000000UL * 60UL * 5UL;
   sensor::Sensor *total_sensor_ = nullptr;
+  sensor::Sensor *jitter_sensor_ = nullptr;
 
-  Deduplicator<uint32_t> pulse_width_dedupe_;
+  Deduplicator<float> rate_dedupe_;
   Deduplicator<uint32_t> total_dedupe_;
 
   volatile uint32_t last_detected_edge_us_ = 0;
-  volatile uint32_t last_valid_edge_us_ = 0;
-  volatile uint32_t pulse_width_us_ = 0;
   volatile uint32_t total_pulses_ = 0;
+  volatile uint32_t edge_count_ = 0;
+  LockFreeQueue<PulseMeterEdge, 128> edges_;
+  uint32_t overflow_count_ = 0;
+
+  bool has_last_edge_ = false;
+  PulseMeterEdge last_edge_{};
+  // Statistics of the current batch, the mean and M2 are updated with Welford's method for the jitter
+  uint32_t batch_pulses_ = 0;
+  uint32_t batch_time_us_ = 0;
+  uint32_t batch_periods_ = 0;
+  float batch_mean_us_ = 0.0f;
+  float batch_m2_ = 0.0f;
 };
 
 }  // namespace pulse_meter
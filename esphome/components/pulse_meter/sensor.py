@@ -11,8 +11,10 @@ from esphome.const import (
     CONF_TOTAL,
     CONF_VALUE,
     ICON_PULSE,
+    ICON_TIMER,
     STATE_CLASS_MEASUREMENT,
     STATE_CLASS_NONE,
+    UNIT_MICROSECOND,
     UNIT_PULSES,
     UNIT_PULSES_PER_MINUTE,
     DEVICE_CLASS_EMPTY,
@@ -21,6 +23,8 @@ from esphome.core import CORE
 
 CODEOWNERS = ["@stevebaxter"]
 
+CONF_JITTER = "jitter"
+
 pulse_meter_ns = cg.esphome_ns.namespace("pulse_meter")
 
 PulseMeterSensor = pulse_meter_ns.class_(
@@ -61,6 +65,13 @@ CONFIG_SCHEMA = sensor.sensor_schema(
         cv.Optional(CONF_TOTAL): sensor.sensor_schema(
             UNIT_PULSES, ICON_PULSE, 0, DEVICE_CLASS_EMPTY, STATE_CLASS_NONE
         ),
+        cv.Optional(CONF_JITTER): sensor.sensor_schema(
+            UNIT_MICROSECOND,
+            ICON_TIMER,
+            1,
+            DEVICE_CLASS_EMPTY,
+            STATE_CLASS_MEASUREMENT,
+        ),
     }
 )
 
@@ -79,6 +90,10 @@ async def to_code(config):
         sens = await sensor.new_sensor(config[CONF_TOTAL])
         cg.add(var.set_total_sensor(sens))
 
+    if CONF_JITTER in config:
+        sens = await sensor.new_sensor(config[CONF_JITTER])
+        cg.add(var.set_jitter_sensor(sens))
+
 
 @automation.register_action(
     "pulse_meter.set_total_pulses",
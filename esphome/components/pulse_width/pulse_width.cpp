@@ -1,5 +1,6 @@
 #include "pulse_width.h"
 #include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 namespace pulse_width {
@@ -12,17 +13,35 @@ void ICACHE_RAM_ATTR PulseWidthSensorStore::gpio_intr(PulseWidthSensorStore *arg
   if (new_level) {
     arg->last_rise_ = now;
   } else {
-    arg->last_width_ = (now - arg->last_rise_);
+    const uint32_t width = now - arg->last_rise_;
+    arg->last_width_ = width;
+    arg->width_sum_ += width;
+    arg->width_count_++;
   }
 }
 
+float PulseWidthSensorStore::take_mean_pulse_width_s() {
+  uint64_t sum;
+  uint32_t count;
+  {
+    InterruptLock lock;
+    sum = this->width_sum_;
+    count = this->width_count_;
+    this->width_sum_ = 0;
+    this->width_count_ = 0;
+  }
+  if (count == 0)
+    return this->get_pulse_width_s();
+  return sum / 1e6f / count;
+}
+
 void PulseWidthSensor::dump_config() {
   LOG_SENSOR("", "Pulse Width", this)
   LOG_UPDATE_INTERVAL(this)
   LOG_PIN("  Pin: ", this->pin_);
 }
 void PulseWidthSensor::update() {
-  float width = this->store_.get_pulse_width_s();
+  float width = this->store_.take_mean_pulse_width_s();
   ESP_LOGCONFIG(TAG, "'%s' - Got pulse width %.3f s", this->name_.c_str(), width);
   this->publish_state(width);
 }
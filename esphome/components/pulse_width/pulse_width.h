@@ -20,11 +20,19 @@ class PulseWidthSensorStore {
   uint32_t get_pulse_width_us() const { return this->last_width_; }
   float get_pulse_width_s() const { return this->last_width_ / 1e6f; }
   uint32_t get_last_rise() const { return last_rise_; }
+  /** Mean width of the pulses that ended since the last call, in seconds.
+   *
+   * Falls back to the width of the last pulse if none ended in between.
+   */
+  float take_mean_pulse_width_s();
 
  protected:
   ISRInternalGPIOPin *pin_;
   volatile uint32_t last_width_{0};
   volatile uint32_t last_rise_{0};
+  // Sum and number of the pulse widths since the last take_mean_pulse_width_s()
+  volatile uint64_t width_sum_{0};
+  volatile uint32_t width_count_{0};
 };
 
 class PulseWidthSensor : public sensor::Sensor, public PollingComponent {
@@ -39,6 +39,8 @@ std::string format_uid(std::vector<uint8_t> &uid) {
 
 void RC522::setup() {
   state_ = STATE_SETUP;
+  if (irq_pin_ != nullptr)
+    irq_pin_->setup();
   // Pull device out of power down / reset state.
 
   // First set the resetPowerDownPin as digital input, to check the MFRC522 power down mode.
@@ -92,6 +94,14 @@ void RC522::initialize_() {
   pcd_write_register(MODE_REG, 0x3D);  // Default 0x3F. Set the preset value for the CRC coprocessor for the CalcCRC
                                        // command to 0x6363 (ISO 14443-3 part 6.2.4)
 
+  if (irq_pin_ != nullptr) {
+    // IRqInv=1 => IRQ pin is low while an interrupt is requested. Enable RxIRq, IdleIRq and TimerIRq, which end a
+    // transceive.
+    pcd_write_register(COM_I_EN_REG, 0x80 | WAIT_I_RQ | 0x01);
+    // IRQPushPull=1 => IRQ pin is a standard CMOS output. Enable CRCIRq, which ends a CRC calculation.
+    pcd_write_register(DIV_I_EN_REG, 0x80 | 0x04);
+  }
+
   state_ = STATE_INIT;
 }
 
@@ -106,6 +116,7 @@ void RC522::dump_config() {
   }
 
   LOG_PIN("  RESET Pin: ", this->reset_pin_);
+  LOG_PIN("  IRQ Pin: ", this->irq_pin_);
 
   LOG_UPDATE_INTERVAL(this);
 
@@ -373,9 +384,16 @@ void RC522::pcd_transceive_data_(uint8_t send_len) {
   awaiting_comm_time_ = millis();
 }
 
+bool RC522::irq_active_() {
+  // The IRQ pin is active low, see initialize_()
+  return irq_pin_ == nullptr || !irq_pin_->digital_read();
+}
+
 RC522::StatusCode RC522::await_transceive_() {
   if (millis() - awaiting_comm_time_ < 2)  // wait at least 2 ms
     return STATUS_WAITING;
+  if (!irq_active_() && millis() - awaiting_comm_time_ < 40)  // no need to ask the chip yet
+    return STATUS_WAITING;
   uint8_t n = pcd_read_register(
       COM_IRQ_REG);  // ComIrqReg[7..0] bits are: Set1 TxIRq RxIRq IdleIRq HiAlertIRq LoAlertIRq ErrIRq TimerIRq
   if (n & 0x01) {    // Timer interrupt - nothing received in 25ms
@@ -443,6 +461,8 @@ void RC522::pcd_calculate_crc_(uint8_t *data,  ///< In: Pointer to the data to t
   ESP_LOGVV(TAG, "pcd_calculate_crc_(..., %d, ...)", length);
   pcd_write_register(COMMAND_REG, PCD_IDLE);        // Stop any active command.
   pcd_write_register(DIV_IRQ_REG, 0x04);            // Clear the CRCIRq interrupt request bit
+  if (irq_pin_ != nullptr)
+    pcd_write_register(COM_IRQ_REG, 0x7F);  // Clear the interrupts of the last transceive, they keep the IRQ pin active
   pcd_write_register(FIFO_LEVEL_REG, 0x80);         // FlushBuffer = 1, FIFO initialization
   pcd_write_register(FIFO_DATA_REG, length, data);  // Write data to the FIFO
   pcd_write_register(COMMAND_REG, PCD_CALC_CRC);    // Start the calculation
@@ -454,6 +474,8 @@ void RC522::pcd_calculate_crc_(uint8_t *data,  ///< In: Pointer to the data to t
 RC522::StatusCode RC522::await_crc_() {
   if (millis() - awaiting_comm_time_ < 2)  // wait at least 2 ms
     return STATUS_WAITING;
+  if (!irq_active_() && millis() - awaiting_comm_time_ < 89)  // no need to ask the chip yet
+    return STATUS_WAITING;
 
   // DivIrqReg[7..0] bits are: Set2 reserved reserved MfinActIRq reserved CRCIRq reserved reserved
   uint8_t n = pcd_read_register(DIV_IRQ_REG);
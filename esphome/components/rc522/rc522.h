@@ -24,6 +24,8 @@ class RC522 : public PollingComponent {
   void register_trigger(RC522Trigger *trig) { this->triggers_.push_back(trig); }
 
   void set_reset_pin(GPIOPin *reset) { this->reset_pin_ = reset; }
+  /// With the IRQ pin, the end of a command is seen on the pin instead of polling the interrupt registers.
+  void set_irq_pin(GPIOPin *irq_pin) { this->irq_pin_ = irq_pin; }
 
  protected:
   // Return codes from the functions in this class. Remember to update GetStatusCodeName() if you add more.
@@ -235,7 +237,11 @@ class RC522 : public PollingComponent {
   uint8_t rx_align_;
   uint8_t *valid_bits_;
 
+  /// Whether the interrupt request is active, or true without an IRQ pin.
+  bool irq_active_();
+
   GPIOPin *reset_pin_{nullptr};
+  GPIOPin *irq_pin_{nullptr};
   uint8_t reset_count_{0};
   uint32_t reset_timeout_{0};
   std::vector<RC522BinarySensor *> binary_sensors_;
@@ -4,6 +4,7 @@
 #include "esphome/core/automation.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/frame_parser.h"
 
 namespace esphome {
 namespace rdm6300 {
@@ -13,6 +14,7 @@ class RDM6300Trigger;
 
 class RDM6300Component : public Component, public uart::UARTDevice {
  public:
+  void setup() override;
   void loop() override;
 
   void register_card(RDM6300BinarySensor *obj) { this->cards_.push_back(obj); }
@@ -21,7 +23,11 @@ class RDM6300Component : public Component, public uart::UARTDevice {
   float get_setup_priority() const override { return setup_priority::DATA; }
 
  protected:
-  int8_t read_state_{-1};
+  /// Decodes the hex digits of a frame into buffer_ and checks them.
+  bool check_frame_(const uint8_t *data);
+  void process_frame_();
+
+  uart::FrameParser parser_;
   uint8_t buffer_[6]{};
   std::vector<RDM6300BinarySensor *> cards_;
   std::vector<RDM6300Trigger *> triggers_;
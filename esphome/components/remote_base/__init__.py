@@ -28,7 +28,7 @@ from esphome.const import (
     CONF_RC_CODE_1,
     CONF_RC_CODE_2,
 )
-from esphome.core import coroutine
+from esphome.core import TimePeriod, coroutine
 from esphome.jsonschema import jschema_extractor
 from esphome.util import Registry, SimpleRegistry
 
@@ -456,6 +456,27 @@ def validate_raw_alternating(value):
     return value
 
 
+def raw_code_parts(code):
+    """Split the durations of a raw code into int16 parts, for storage in flash.
+
+    Durations over 32767us become several parts with the same sign, which are added
+    again when the code is read. Only transmitted codes can have them, the schema of
+    received codes rejects them.
+    """
+    parts = []
+    for value in code:
+        if isinstance(value, TimePeriod):
+            value = value.total_microseconds
+        value = int(value)
+        sign = -1 if value < 0 else 1
+        value = abs(value)
+        while value > 32767:
+            parts.append(sign * 32767)
+            value -= 32767
+        parts.append(sign * value)
+    return parts
+
+
 RawData, RawBinarySensor, RawTrigger, RawAction, RawDumper = declare_protocol("Raw")
 CONF_CODE_STORAGE_ID = "code_storage_id"
 RAW_SCHEMA = cv.Schema(
@@ -465,17 +486,42 @@ RAW_SCHEMA = cv.Schema(
             cv.Length(min=1),
             validate_raw_alternating,
         ),
-        cv.GenerateID(CONF_CODE_STORAGE_ID): cv.declare_id(cg.int32),
+        cv.GenerateID(CONF_CODE_STORAGE_ID): cv.declare_id(cg.int16),
+    }
+)
+
+
+def validate_raw_received_durations(value):
+    # The receiver clamps the durations it measures to the int16 range
+    for i, val in enumerate(value):
+        if isinstance(val, TimePeriod):
+            val = val.total_microseconds
+        if abs(val) > 32767:
+            raise cv.Invalid(
+                f"Received durations are limited to 32767us, please see index {i + 1}",
+                [i],
+            )
+    return value
+
+
+RAW_BINARY_SENSOR_SCHEMA = RAW_SCHEMA.extend(
+    {
+        cv.Required(CONF_CODE): cv.All(
+            [cv.Any(cv.int_, cv.time_period_microseconds)],
+            cv.Length(min=1),
+            validate_raw_alternating,
+            validate_raw_received_durations,
+        ),
     }
 )
 
 
-@register_binary_sensor("raw", RawBinarySensor, RAW_SCHEMA)
+@register_binary_sensor("raw", RawBinarySensor, RAW_BINARY_SENSOR_SCHEMA)
 def raw_binary_sensor(var, config):
-    code_ = config[CONF_CODE]
-    arr = cg.progmem_array(config[CONF_CODE_STORAGE_ID], code_)
+    parts = raw_code_parts(config[CONF_CODE])
+    arr = cg.progmem_array(config[CONF_CODE_STORAGE_ID], parts)
     cg.add(var.set_data(arr))
-    cg.add(var.set_len(len(code_)))
+    cg.add(var.set_len(len(parts)))
 
 
 @register_trigger("raw", RawTrigger, cg.std_vector.template(cg.int32))
@@ -505,9 +551,9 @@ async def raw_action(var, config, args):
         template_ = await cg.templatable(code_, args, cg.std_vector.template(cg.int32))
         cg.add(var.set_code_template(template_))
     else:
-        code_ = config[CONF_CODE]
-        arr = cg.progmem_array(config[CONF_CODE_STORAGE_ID], code_)
-        cg.add(var.set_code_static(arr, len(code_)))
+        parts = raw_code_parts(code_)
+        arr = cg.progmem_array(config[CONF_CODE_STORAGE_ID], parts)
+        cg.add(var.set_code_static(arr, len(parts)))
     templ = await cg.templatable(config[CONF_CARRIER_FREQUENCY], args, cg.uint32)
     cg.add(var.set_carrier_frequency(templ))
 
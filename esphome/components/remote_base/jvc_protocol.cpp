@@ -28,6 +28,7 @@ void JVCProtocol::encode(RemoteTransmitData *dst, const JVCData &data) {
 
   dst->mark(BIT_HIGH_US);
 }
+RemoteSignature JVCProtocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<JVCData> JVCProtocol::decode(RemoteReceiveData src) {
   JVCData out{.data = 0};
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
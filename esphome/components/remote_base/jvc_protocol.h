@@ -16,6 +16,7 @@ class JVCProtocol : public RemoteProtocol<JVCData> {
   void encode(RemoteTransmitData *dst, const JVCData &data) override;
   optional<JVCData> decode(RemoteReceiveData src) override;
   void dump(const JVCData &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(JVC)
@@ -24,7 +25,7 @@ template<typename... Ts> class JVCAction : public RemoteTransmitterActionBase<Ts
  public:
   TEMPLATABLE_VALUE(uint32_t, data)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     JVCData data{};
     data.data = this->data_.value(x...);
     JVCProtocol().encode(dst, data);
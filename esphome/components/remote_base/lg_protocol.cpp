@@ -27,6 +27,7 @@ void LGProtocol::encode(RemoteTransmitData *dst, const LGData &data) {
 
   dst->mark(BIT_HIGH_US);
 }
+RemoteSignature LGProtocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<LGData> LGProtocol::decode(RemoteReceiveData src) {
   LGData out{
       .data = 0,
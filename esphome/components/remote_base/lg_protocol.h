@@ -18,6 +18,7 @@ class LGProtocol : public RemoteProtocol<LGData> {
   void encode(RemoteTransmitData *dst, const LGData &data) override;
   optional<LGData> decode(RemoteReceiveData src) override;
   void dump(const LGData &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(LG)
@@ -27,7 +28,7 @@ template<typename... Ts> class LGAction : public RemoteTransmitterActionBase<Ts.
   TEMPLATABLE_VALUE(uint32_t, data)
   TEMPLATABLE_VALUE(uint8_t, nbits)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     LGData data{};
     data.data = this->data_.value(x...);
     data.nbits = this->nbits_.value(x...);
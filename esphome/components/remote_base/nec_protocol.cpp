@@ -33,6 +33,7 @@ void NECProtocol::encode(RemoteTransmitData *dst, const NECData &data) {
 
   dst->mark(BIT_HIGH_US);
 }
+RemoteSignature NECProtocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<NECData> NECProtocol::decode(RemoteReceiveData src) {
   NECData data{
       .address = 0,
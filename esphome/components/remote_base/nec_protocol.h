@@ -17,6 +17,7 @@ class NECProtocol : public RemoteProtocol<NECData> {
   void encode(RemoteTransmitData *dst, const NECData &data) override;
   optional<NECData> decode(RemoteReceiveData src) override;
   void dump(const NECData &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(NEC)
@@ -26,7 +27,7 @@ template<typename... Ts> class NECAction : public RemoteTransmitterActionBase<Ts
   TEMPLATABLE_VALUE(uint16_t, address)
   TEMPLATABLE_VALUE(uint16_t, command)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     NECData data{};
     data.address = this->address_.value(x...);
     data.command = this->command_.value(x...);
@@ -33,6 +33,7 @@ void PanasonicProtocol::encode(RemoteTransmitData *dst, const PanasonicData &dat
   }
   dst->mark(BIT_HIGH_US);
 }
+RemoteSignature PanasonicProtocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<PanasonicData> PanasonicProtocol::decode(RemoteReceiveData src) {
   PanasonicData out{
       .address = 0,
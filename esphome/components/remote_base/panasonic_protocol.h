@@ -18,6 +18,7 @@ class PanasonicProtocol : public RemoteProtocol<PanasonicData> {
   void encode(RemoteTransmitData *dst, const PanasonicData &data) override;
   optional<PanasonicData> decode(RemoteReceiveData src) override;
   void dump(const PanasonicData &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Panasonic)
@@ -27,7 +28,7 @@ template<typename... Ts> class PanasonicAction : public RemoteTransmitterActionB
   TEMPLATABLE_VALUE(uint16_t, address)
   TEMPLATABLE_VALUE(uint32_t, command)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     PanasonicData data{};
     data.address = this->address_.value(x...);
     data.command = this->command_.value(x...);
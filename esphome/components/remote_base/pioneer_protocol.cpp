@@ -86,6 +86,7 @@ void PioneerProtocol::encode(RemoteTransmitData *dst, const PioneerData &data) {
     dst->mark(BIT_HIGH_US);
   }
 }
+RemoteSignature PioneerProtocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<PioneerData> PioneerProtocol::decode(RemoteReceiveData src) {
   uint16_t address1 = 0;
   uint16_t command1 = 0;
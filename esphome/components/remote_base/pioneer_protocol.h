@@ -17,6 +17,7 @@ class PioneerProtocol : public RemoteProtocol<PioneerData> {
   void encode(RemoteTransmitData *dst, const PioneerData &data) override;
   optional<PioneerData> decode(RemoteReceiveData src) override;
   void dump(const PioneerData &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Pioneer)
@@ -26,7 +27,7 @@ template<typename... Ts> class PioneerAction : public RemoteTransmitterActionBas
   TEMPLATABLE_VALUE(uint16_t, rc_code_1)
   TEMPLATABLE_VALUE(uint16_t, rc_code_2)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     PioneerData data{};
     data.rc_code_1 = this->rc_code_1_.value(x...);
     data.rc_code_2 = this->rc_code_2_.value(x...);
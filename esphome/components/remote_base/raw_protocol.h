@@ -6,33 +6,46 @@
 namespace esphome {
 namespace remote_base {
 
+/** Call f with each duration of a raw code stored in flash, until it returns false.
+ *
+ * Codegen stores codes as int16 parts, durations that don't fit are split into consecutive parts with the same sign,
+ * which are added up again here. Returns false if f did.
+ */
+template<typename F> bool for_each_raw_duration(const int16_t *code, size_t len, F &&f) {
+  int32_t value = 0;
+  for (size_t i = 0; i < len; i++) {
+    const auto part = static_cast<int16_t>(pgm_read_word(code + i));
+    if (i != 0 && (part < 0) != (value < 0)) {
+      if (!f(value))
+        return false;
+      value = 0;
+    }
+    value += part;
+  }
+  return len == 0 || f(value);
+}
+
 class RawBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   bool matches(RemoteReceiveData src) override {
-    for (size_t i = 0; i < this->len_; i++) {
-      auto val = this->data_[i];
-      if (val < 0) {
-        if (!src.expect_space(static_cast<uint32_t>(-val)))
-          return false;
-      } else {
-        if (!src.expect_mark(static_cast<uint32_t>(val)))
-          return false;
-      }
-    }
-    return true;
+    return for_each_raw_duration(this->data_, this->len_, [&src](int32_t val) {
+      if (val < 0)
+        return src.expect_space(static_cast<uint32_t>(-val));
+      return src.expect_mark(static_cast<uint32_t>(val));
+    });
   }
-  void set_data(const int32_t *data) { data_ = data; }
+  void set_data(const int16_t *data) { data_ = data; }
   void set_len(size_t len) { len_ = len; }
 
  protected:
-  const int32_t *data_;
+  const int16_t *data_;
   size_t len_;
 };
 
 class RawTrigger : public Trigger<std::vector<int32_t>>, public Component, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    this->trigger(*src.get_raw_data());
+    this->trigger(src.get_raw_data());
     return false;
   }
 };
@@ -40,21 +53,22 @@ class RawTrigger : public Trigger<std::vector<int32_t>>, public Component, publi
 template<typename... Ts> class RawAction : public RemoteTransmitterActionBase<Ts...> {
  public:
   void set_code_template(std::function<std::vector<int32_t>(Ts...)> func) { this->code_func_ = func; }
-  void set_code_static(const int32_t *code, size_t len) {
+  void set_code_static(const int16_t *code, size_t len) {
     this->code_static_ = code;
     this->code_static_len_ = len;
   }
   TEMPLATABLE_VALUE(uint32_t, carrier_frequency);
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     if (this->code_static_ != nullptr) {
-      for (size_t i = 0; i < this->code_static_len_; i++) {
-        auto val = this->code_static_[i];
+      dst->reserve(this->code_static_len_);
+      for_each_raw_duration(this->code_static_, this->code_static_len_, [dst](int32_t val) {
         if (val < 0)
           dst->space(static_cast<uint32_t>(-val));
         else
           dst->mark(static_cast<uint32_t>(val));
-      }
+        return true;
+      });
     } else {
       dst->set_data(this->code_func_(x...));
     }
@@ -63,8 +77,9 @@ template<typename... Ts> class RawAction : public RemoteTransmitterActionBase<Ts
 
  protected:
   std::function<std::vector<int32_t>(Ts...)> code_func_{};
-  const int32_t *code_static_{nullptr};
-  int32_t code_static_len_{0};
+  /// Read from flash as the code is sent, see for_each_raw_duration().
+  const int16_t *code_static_{nullptr};
+  size_t code_static_len_{0};
 };
 
 class RawDumper : public RemoteReceiverDumperBase {
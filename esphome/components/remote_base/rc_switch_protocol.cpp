@@ -248,12 +248,14 @@ bool RCSwitchDumper::dump(RemoteReceiveData src) {
     uint8_t out_nbits;
     const RCSwitchBase *protocol = &RC_SWITCH_PROTOCOLS[i];
     if (protocol->decode(src, &out_data, &out_nbits) && out_nbits >= 3) {
+#ifdef ESPHOME_LOG_HAS_DEBUG
       char buffer[65];
       for (uint8_t j = 0; j < out_nbits; j++)
         buffer[j] = (out_data & ((uint64_t) 1 << (out_nbits - j - 1))) ? '1' : '0';
 
       buffer[out_nbits] = '\0';
       ESP_LOGD(TAG, "Received RCSwitch Raw: protocol=%u data='%s'", i, buffer);
+#endif
 
       // only send first decoded protocol
       return true;
@@ -24,7 +24,9 @@ void RemoteRMTChannel::config_rmt(rmt_config_t &rmt) {
 }
 #endif
 
-void RemoteReceiverBinarySensorBase::dump_config() { LOG_BINARY_SENSOR("", "Remote Receiver Binary Sensor", this); }
+void RemoteReceiverBinarySensorBase::dump_config() {
+  LOG_BINARY_SENSOR("", "Remote Receiver Binary Sensor", static_cast<binary_sensor::BinarySensor *>(this));
+}
 
 void RemoteTransmitterBase::send_(uint32_t send_times, uint32_t send_wait) {
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
@@ -54,9 +54,20 @@ class RemoteTransmitData {
   uint32_t carrier_frequency_{0};
 };
 
+/// The leader mark and space every frame of a protocol starts with, zero lengths match anything.
+struct RemoteSignature {
+  uint32_t header_mark;
+  uint32_t header_space;
+};
+
+/** The durations of a received signal in microseconds, marks positive and spaces negative.
+ *
+ * Only points to the durations, which stay owned by the receiver and are only valid while listeners and dumpers run.
+ */
 class RemoteReceiveData {
  public:
-  RemoteReceiveData(std::vector<int32_t> *data, uint8_t tolerance) : data_(data), tolerance_(tolerance) {}
+  RemoteReceiveData(const int16_t *data, uint32_t size, uint8_t tolerance)
+      : data_(data), size_(size), tolerance_(tolerance) {}
 
   bool peek_mark(uint32_t length, uint32_t offset = 0) {
     if (int32_t(this->index_ + offset) >= this->size())
@@ -116,22 +127,30 @@ class RemoteReceiveData {
     return false;
   }
 
+  /// Whether the data at the current position starts with the leader of signature.
+  bool matches(const RemoteSignature &signature) {
+    return (signature.header_mark == 0 || this->peek_mark(signature.header_mark)) &&
+           (signature.header_space == 0 || this->peek_space(signature.header_space, 1));
+  }
+
   void reset() { this->index_ = 0; }
 
-  int32_t pos(uint32_t index) const { return (*this->data_)[index]; }
+  int32_t pos(uint32_t index) const { return this->data_[index]; }
 
   int32_t operator[](uint32_t index) const { return this->pos(index); }
 
-  int32_t size() const { return this->data_->size(); }
+  int32_t size() const { return this->size_; }
 
-  std::vector<int32_t> *get_raw_data() { return this->data_; }
+  /// A copy of all durations, for handing them on after the receiver is done with them.
+  std::vector<int32_t> get_raw_data() const { return std::vector<int32_t>(this->data_, this->data_ + this->size_); }
 
  protected:
   int32_t lower_bound_(uint32_t length) { return int32_t(100 - this->tolerance_) * length / 100U; }
   int32_t upper_bound_(uint32_t length) { return int32_t(100 + this->tolerance_) * length / 100U; }
 
   uint32_t index_{0};
-  std::vector<int32_t> *data_;
+  const int16_t *data_;
+  uint32_t size_;
   uint8_t tolerance_;
 };
 
@@ -142,6 +161,9 @@ template<typename T> class RemoteProtocol {
   virtual optional<T> decode(RemoteReceiveData src) = 0;
 
   virtual void dump(const T &data) = 0;
+
+  /// Frames that don't start like this are never passed to decode() by the receiver.
+  virtual RemoteSignature get_signature() { return {0, 0}; }
 };
 
 class RemoteComponentBase {
@@ -211,12 +233,16 @@ class RemoteTransmitterBase : public RemoteComponentBase {
 class RemoteReceiverListener {
  public:
   virtual bool on_receive(RemoteReceiveData data) = 0;
+  /// Frames that don't start with this leader are not offered to on_receive(), see RemoteReceiveData::matches().
+  virtual RemoteSignature get_signature() { return {0, 0}; }
 };
 
 class RemoteReceiverDumperBase {
  public:
   virtual bool dump(RemoteReceiveData src) = 0;
   virtual bool is_secondary() { return false; }
+  /// Frames that don't start with this leader are not offered to dump().
+  virtual RemoteSignature get_signature() { return {0, 0}; }
 };
 
 class RemoteReceiverBase : public RemoteComponentBase {
@@ -233,40 +259,44 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void set_tolerance(uint8_t tolerance) { tolerance_ = tolerance; }
 
  protected:
-  bool call_listeners_() {
+  /// Durations are stored in 16 bits, anything longer only ever matters as being long.
+  static int16_t to_duration_(int32_t value) { return clamp<int32_t>(value, -INT16_MAX, INT16_MAX); }
+
+  // The leader is checked here once per decoder, so decoders only ever parse frames of their own protocol
+  bool call_listeners_(const int16_t *data, uint32_t size) {
+    RemoteReceiveData frame(data, size, this->tolerance_);
     bool success = false;
     for (auto *listener : this->listeners_) {
-      auto data = RemoteReceiveData(&this->temp_, this->tolerance_);
-      if (listener->on_receive(data))
+      if (frame.matches(listener->get_signature()) && listener->on_receive(frame))
         success = true;
     }
     return success;
   }
-  void call_dumpers_() {
+  void call_dumpers_(const int16_t *data, uint32_t size) {
+    RemoteReceiveData frame(data, size, this->tolerance_);
     bool success = false;
     for (auto *dumper : this->dumpers_) {
-      auto data = RemoteReceiveData(&this->temp_, this->tolerance_);
-      if (dumper->dump(data))
+      if (frame.matches(dumper->get_signature()) && dumper->dump(frame))
         success = true;
     }
     if (!success) {
       for (auto *dumper : this->secondary_dumpers_) {
-        auto data = RemoteReceiveData(&this->temp_, this->tolerance_);
-        dumper->dump(data);
+        if (frame.matches(dumper->get_signature()))
+          dumper->dump(frame);
       }
     }
   }
-  void call_listeners_dumpers_() {
-    if (this->call_listeners_())
+  void call_listeners_dumpers_(const int16_t *data, uint32_t size) {
+    if (this->call_listeners_(data, size))
       return;
     // If a listener handled, then do not dump
-    this->call_dumpers_();
+    this->call_dumpers_(data, size);
   }
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
-  std::vector<int32_t> temp_;
+  std::vector<int16_t> temp_;
   uint8_t tolerance_{25};
 };
 
@@ -299,6 +329,9 @@ template<typename T, typename D> class RemoteReceiverBinarySensor : public Remot
     return res.has_value() && *res == this->data_;
   }
 
+ public:
+  RemoteSignature get_signature() override { return T().get_signature(); }
+
  public:
   void set_data(D data) { data_ = data; }
 
@@ -307,6 +340,9 @@ template<typename T, typename D> class RemoteReceiverBinarySensor : public Remot
 };
 
 template<typename T, typename D> class RemoteReceiverTrigger : public Trigger<D>, public RemoteReceiverListener {
+ public:
+  RemoteSignature get_signature() override { return T().get_signature(); }
+
  protected:
   bool on_receive(RemoteReceiveData src) override {
     auto proto = T();
@@ -326,7 +362,7 @@ template<typename... Ts> class RemoteTransmitterActionBase : public Action<Ts...
   TEMPLATABLE_VALUE(uint32_t, send_times);
   TEMPLATABLE_VALUE(uint32_t, send_wait);
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto call = this->parent_->transmit();
     this->encode(call.get_data(), x...);
     call.set_send_times(this->send_times_.value_or(x..., 1));
@@ -335,7 +371,7 @@ template<typename... Ts> class RemoteTransmitterActionBase : public Action<Ts...
   }
 
  protected:
-  virtual void encode(RemoteTransmitData *dst, Ts... x) = 0;
+  virtual void encode(RemoteTransmitData *dst, const Ts &... x) = 0;
 
   RemoteTransmitterBase *parent_{};
 };
@@ -350,6 +386,7 @@ template<typename T, typename D> class RemoteReceiverDumper : public RemoteRecei
     proto.dump(*decoded);
     return true;
   }
+  RemoteSignature get_signature() override { return T().get_signature(); }
 };
 
 #define DECLARE_REMOTE_PROTOCOL_(prefix) \
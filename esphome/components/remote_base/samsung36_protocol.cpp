@@ -50,6 +50,7 @@ void Samsung36Protocol::encode(RemoteTransmitData *dst, const Samsung36Data &dat
   dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
 }
 
+RemoteSignature Samsung36Protocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<Samsung36Data> Samsung36Protocol::decode(RemoteReceiveData src) {
   Samsung36Data out{
       .address = 0,
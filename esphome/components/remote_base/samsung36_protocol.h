@@ -18,6 +18,7 @@ class Samsung36Protocol : public RemoteProtocol<Samsung36Data> {
   void encode(RemoteTransmitData *dst, const Samsung36Data &data) override;
   optional<Samsung36Data> decode(RemoteReceiveData src) override;
   void dump(const Samsung36Data &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Samsung36)
@@ -27,7 +28,7 @@ template<typename... Ts> class Samsung36Action : public RemoteTransmitterActionB
   TEMPLATABLE_VALUE(uint16_t, address)
   TEMPLATABLE_VALUE(uint32_t, command)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     Samsung36Data data{};
     data.address = this->address_.value(x...);
     data.command = this->command_.value(x...);
@@ -29,6 +29,7 @@ void SamsungProtocol::encode(RemoteTransmitData *dst, const SamsungData &data) {
 
   dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
 }
+RemoteSignature SamsungProtocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<SamsungData> SamsungProtocol::decode(RemoteReceiveData src) {
   SamsungData out{
       .data = 0,
@@ -18,6 +18,7 @@ class SamsungProtocol : public RemoteProtocol<SamsungData> {
   void encode(RemoteTransmitData *dst, const SamsungData &data) override;
   optional<SamsungData> decode(RemoteReceiveData src) override;
   void dump(const SamsungData &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Samsung)
@@ -27,7 +28,7 @@ template<typename... Ts> class SamsungAction : public RemoteTransmitterActionBas
   TEMPLATABLE_VALUE(uint64_t, data)
   TEMPLATABLE_VALUE(uint8_t, nbits)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     SamsungData data{};
     data.data = this->data_.value(x...);
     data.nbits = this->nbits_.value(x...);
@@ -25,6 +25,7 @@ void SonyProtocol::encode(RemoteTransmitData *dst, const SonyData &data) {
       dst->item(BIT_ZERO_HIGH_US, BIT_LOW_US);
   }
 }
+RemoteSignature SonyProtocol::get_signature() { return {HEADER_HIGH_US, HEADER_LOW_US}; }
 optional<SonyData> SonyProtocol::decode(RemoteReceiveData src) {
   SonyData out{
       .data = 0,
@@ -18,6 +18,7 @@ class SonyProtocol : public RemoteProtocol<SonyData> {
   void encode(RemoteTransmitData *dst, const SonyData &data) override;
   optional<SonyData> decode(RemoteReceiveData src) override;
   void dump(const SonyData &data) override;
+  RemoteSignature get_signature() override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Sony)
@@ -27,7 +28,7 @@ template<typename... Ts> class SonyAction : public RemoteTransmitterActionBase<T
   TEMPLATABLE_VALUE(uint32_t, data)
   TEMPLATABLE_VALUE(uint8_t, nbits)
 
-  void encode(RemoteTransmitData *dst, Ts... x) override {
+  void encode(RemoteTransmitData *dst, const Ts &... x) override {
     SonyData data{};
     data.data = this->data_.value(x...);
     data.nbits = this->nbits_.value(x...);
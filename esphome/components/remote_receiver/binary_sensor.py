@@ -9,5 +9,5 @@ CONFIG_SCHEMA = remote_base.validate_binary_sensor
 
 async def to_code(config):
     var = await remote_base.build_binary_sensor(config)
-    cg.add(var.set_name(config[CONF_NAME]))
+    cg.setup_entity_name(var, config[CONF_NAME])
     await binary_sensor.register_binary_sensor(var, config)
@@ -43,6 +43,8 @@ class RemoteReceiverComponent : public remote_base::RemoteReceiverBase,
   void dump_config() override;
   void loop() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
+  // Latency critical, the buffer of received pulses must not overflow
+  bool is_loop_latency_critical() const override { return true; }
 
   void set_buffer_size(uint32_t buffer_size) { this->buffer_size_ = buffer_size; }
   void set_filter_us(uint8_t filter_us) { this->filter_us_ = filter_us; }
@@ -50,7 +52,8 @@ class RemoteReceiverComponent : public remote_base::RemoteReceiverBase,
 
  protected:
 #ifdef ARDUINO_ARCH_ESP32
-  void decode_rmt_(rmt_item32_t *item, size_t len);
+  /// Turn len bytes of RMT items into durations, which are written over the items. Returns how many there are.
+  uint32_t decode_rmt_(rmt_item32_t *item, size_t len);
   RingbufHandle_t ringbuf_;
   esp_err_t error_code_{ESP_OK};
 #endif
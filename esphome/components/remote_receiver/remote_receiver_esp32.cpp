@@ -72,23 +72,21 @@ void RemoteReceiverComponent::loop() {
   size_t len = 0;
   auto *item = (rmt_item32_t *) xRingbufferReceive(this->ringbuf_, &len, 0);
   if (item != nullptr) {
-    this->decode_rmt_(item, len);
+    const uint32_t size = this->decode_rmt_(item, len);
+    // The durations live in the ring buffer item, it can only be returned once everyone has seen them
+    if (size != 0)
+      this->call_listeners_dumpers_(reinterpret_cast<int16_t *>(item), size);
     vRingbufferReturnItem(this->ringbuf_, item);
-
-    if (this->temp_.empty())
-      return;
-
-    this->call_listeners_dumpers_();
   }
 }
-void RemoteReceiverComponent::decode_rmt_(rmt_item32_t *item, size_t len) {
+uint32_t RemoteReceiverComponent::decode_rmt_(rmt_item32_t *item, size_t len) {
   bool prev_level = false;
   uint32_t prev_length = 0;
-  this->temp_.clear();
   int32_t multiplier = this->pin_->is_inverted() ? -1 : 1;
+  const size_t count = len / sizeof(rmt_item32_t);
 
   ESP_LOGVV(TAG, "START:");
-  for (size_t i = 0; i < len; i++) {
+  for (size_t i = 0; i < count; i++) {
     if (item[i].level0) {
       ESP_LOGVV(TAG, "%u A: ON %uus (%u ticks)", i, this->to_microseconds(item[i].duration0), item[i].duration0);
     } else {
@@ -102,55 +100,49 @@ void RemoteReceiverComponent::decode_rmt_(rmt_item32_t *item, size_t len) {
   }
   ESP_LOGVV(TAG, "\n");
 
-  this->temp_.reserve(len / 4);
-  for (size_t i = 0; i < len; i++) {
-    if (item[i].duration0 == 0u) {
+  // Every duration ends at a half item at least, so the 16 bit durations never overtake the 32 bit items they are
+  // read from
+  auto *out = reinterpret_cast<int16_t *>(item);
+  uint32_t size = 0;
+  auto push = [&]() {
+    int32_t us = this->to_microseconds(prev_length);
+    out[size++] = to_duration_(prev_level ? us * multiplier : -us * multiplier);
+  };
+  for (size_t i = 0; i < count; i++) {
+    const rmt_item32_t current = item[i];
+    if (current.duration0 == 0u) {
       // Do nothing
-    } else if (bool(item[i].level0) == prev_level) {
-      prev_length += item[i].duration0;
+    } else if (bool(current.level0) == prev_level) {
+      prev_length += current.duration0;
     } else {
-      if (prev_length > 0) {
-        if (prev_level) {
-          this->temp_.push_back(this->to_microseconds(prev_length) * multiplier);
-        } else {
-          this->temp_.push_back(-int32_t(this->to_microseconds(prev_length)) * multiplier);
-        }
-      }
-      prev_level = bool(item[i].level0);
-      prev_length = item[i].duration0;
+      if (prev_length > 0)
+        push();
+      prev_level = bool(current.level0);
+      prev_length = current.duration0;
     }
 
     if (this->to_microseconds(prev_length) > this->idle_us_) {
       break;
     }
 
-    if (item[i].duration1 == 0u) {
+    if (current.duration1 == 0u) {
       // Do nothing
-    } else if (bool(item[i].level1) == prev_level) {
-      prev_length += item[i].duration1;
+    } else if (bool(current.level1) == prev_level) {
+      prev_length += current.duration1;
     } else {
-      if (prev_length > 0) {
-        if (prev_level) {
-          this->temp_.push_back(this->to_microseconds(prev_length) * multiplier);
-        } else {
-          this->temp_.push_back(-int32_t(this->to_microseconds(prev_length)) * multiplier);
-        }
-      }
-      prev_level = bool(item[i].level1);
-      prev_length = item[i].duration1;
+      if (prev_length > 0)
+        push();
+      prev_level = bool(current.level1);
+      prev_length = current.duration1;
     }
 
     if (this->to_microseconds(prev_length) > this->idle_us_) {
       break;
     }
   }
-  if (prev_length > 0) {
-    if (prev_level) {
-      this->temp_.push_back(this->to_microseconds(prev_length) * multiplier);
-    } else {
-      this->temp_.push_back(-int32_t(this->to_microseconds(prev_length)) * multiplier);
-    }
-  }
+  if (prev_length > 0)
+    push();
+  return size;
 }
 
 }  // namespace remote_receiver
@@ -103,15 +103,15 @@ void RemoteReceiverComponent::loop() {
 
     ESP_LOGVV(TAG, "  i=%u buffer[%u]=%u - buffer[%u]=%u -> %d", i, s.buffer_read_at, s.buffer[s.buffer_read_at], prev,
               s.buffer[prev], multiplier * delta);
-    this->temp_.push_back(multiplier * delta);
+    this->temp_.push_back(to_duration_(multiplier * delta));
     prev = s.buffer_read_at;
     s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
     multiplier *= -1;
   }
   s.buffer_read_at = (s.buffer_size + s.buffer_read_at - 1) % s.buffer_size;
-  this->temp_.push_back(this->idle_us_ * multiplier);
+  this->temp_.push_back(to_duration_(this->idle_us_ * multiplier));
 
-  this->call_listeners_dumpers_();
+  this->call_listeners_dumpers_(this->temp_.data(), this->temp_.size());
 }
 
 }  // namespace remote_receiver
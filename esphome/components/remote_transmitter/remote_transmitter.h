@@ -36,10 +36,15 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
 #ifdef ARDUINO_ARCH_ESP32
   void configure_rmt();
+  /// Convert rmt_source_ into rmt_temp_.
+  void convert_rmt_items_();
 
   uint32_t current_carrier_frequency_{UINT32_MAX};
   bool initialized_{false};
+  /// The items last sent, reused while the same code is sent again.
   std::vector<rmt_item32_t> rmt_temp_;
+  /// The durations rmt_temp_ was converted from.
+  std::vector<int32_t> rmt_source_;
   esp_err_t error_code_{ESP_OK};
 #endif
   uint8_t carrier_duty_percent_{50};
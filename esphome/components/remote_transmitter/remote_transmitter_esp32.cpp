@@ -70,21 +70,13 @@ void RemoteTransmitterComponent::configure_rmt() {
   }
 }
 
-void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t send_wait) {
-  if (this->is_failed())
-    return;
-
-  if (this->current_carrier_frequency_ != this->temp_.get_carrier_frequency()) {
-    this->current_carrier_frequency_ = this->temp_.get_carrier_frequency();
-    this->configure_rmt();
-  }
-
+void RemoteTransmitterComponent::convert_rmt_items_() {
   this->rmt_temp_.clear();
-  this->rmt_temp_.reserve((this->temp_.get_data().size() + 1) / 2);
+  this->rmt_temp_.reserve((this->rmt_source_.size() + 1) / 2);
   uint32_t rmt_i = 0;
   rmt_item32_t rmt_item;
 
-  for (int32_t val : this->temp_.get_data()) {
+  for (int32_t val : this->rmt_source_) {
     bool level = val >= 0;
     if (!level)
       val = -val;
@@ -111,6 +103,21 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     rmt_item.duration1 = 0;
     this->rmt_temp_.push_back(rmt_item);
   }
+}
+
+void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t send_wait) {
+  if (this->is_failed())
+    return;
+
+  if (this->current_carrier_frequency_ != this->temp_.get_carrier_frequency()) {
+    this->current_carrier_frequency_ = this->temp_.get_carrier_frequency();
+    this->configure_rmt();
+  }
+
+  if (this->rmt_source_ != this->temp_.get_data()) {
+    this->rmt_source_ = this->temp_.get_data();
+    this->convert_rmt_items_();
+  }
 
   for (uint16_t i = 0; i < send_times; i++) {
     esp_err_t error = rmt_write_items(this->channel_, this->rmt_temp_.data(), this->rmt_temp_.size(), true);
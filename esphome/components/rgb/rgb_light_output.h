@@ -19,12 +19,16 @@ class RGBLightOutput : public light::LightOutput {
     traits.set_supports_rgb(true);
     return traits;
   }
+  bool supports_fade() override {
+    return this->red_->supports_fade() && this->green_->supports_fade() && this->blue_->supports_fade();
+  }
   void write_state(light::LightState *state) override {
     float red, green, blue;
     state->current_values_as_rgb(&red, &green, &blue, false);
-    this->red_->set_level(red);
-    this->green_->set_level(green);
-    this->blue_->set_level(blue);
+    const uint32_t fade_length = state->get_fade_length();
+    this->red_->set_level(red, fade_length);
+    this->green_->set_level(green, fade_length);
+    this->blue_->set_level(blue, fade_length);
   }
 
  protected:
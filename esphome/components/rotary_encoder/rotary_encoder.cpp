@@ -92,33 +92,13 @@ void ICACHE_RAM_ATTR HOT RotaryEncoderSensorStore::gpio_intr(RotaryEncoderSensor
 
   int8_t rotation_dir = 0;
   uint16_t new_state = STATE_LOOKUP_TABLE[input_state];
-  if ((new_state & arg->resolution & STATE_HAS_INCREMENTED) != 0) {
-    if (arg->counter < arg->max_value)
-      arg->counter++;
+  if ((new_state & arg->resolution & STATE_HAS_INCREMENTED) != 0)
     rotation_dir = 1;
-  }
-  if ((new_state & arg->resolution & STATE_HAS_DECREMENTED) != 0) {
-    if (arg->counter > arg->min_value)
-      arg->counter--;
+  if ((new_state & arg->resolution & STATE_HAS_DECREMENTED) != 0)
     rotation_dir = -1;
-  }
 
-  if (rotation_dir != 0) {
-    auto first_zero = std::find(arg->rotation_events.begin(), arg->rotation_events.end(), 0);  // find first zero
-    if (first_zero == arg->rotation_events.begin()  // are we at the start (first event this loop iteration)
-        || std::signbit(*std::prev(first_zero)) !=
-               std::signbit(rotation_dir)  // or is the last stored event the wrong direction
-        || *std::prev(first_zero) == std::numeric_limits<int8_t>::lowest()  // or the last event slot is full (negative)
-        || *std::prev(first_zero) == std::numeric_limits<int8_t>::max()) {  // or the last event slot is full (positive)
-      if (first_zero != arg->rotation_events.end()) {                       // we have a free rotation slot
-        *first_zero += rotation_dir;                                        // store the rotation into a new slot
-      } else {
-        arg->rotation_events_overflow = true;
-      }
-    } else {
-      *std::prev(first_zero) += rotation_dir;  // store the rotation into the previous slot
-    }
-  }
+  if (rotation_dir != 0 && !arg->steps.push(RotaryEncoderStep{micros(), rotation_dir}))
+    arg->dropped += rotation_dir;
 
   arg->state = new_state;
 }
@@ -153,51 +133,91 @@ void RotaryEncoderSensor::dump_config() {
       ESP_LOGCONFIG(TAG, "  Resolution: 4 Pulse Per Cycle");
       break;
   }
+  if (this->publish_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Publish Interval: %u ms", this->publish_interval_);
+  }
+  if (this->acceleration_threshold_us_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Acceleration: up to %ux below %u ms per step", this->acceleration_max_multiplier_,
+                  this->acceleration_threshold_us_ / 1000);
+  }
 }
 void RotaryEncoderSensor::loop() {
-  std::array<int8_t, 8> rotation_events;
-  bool rotation_events_overflow;
-  ets_intr_lock();
-  rotation_events = this->store_.rotation_events;
-  rotation_events_overflow = this->store_.rotation_events_overflow;
-
-  this->store_.rotation_events.fill(0);
-  this->store_.rotation_events_overflow = false;
-  ets_intr_unlock();
-
-  if (rotation_events_overflow) {
+  RotaryEncoderStep step;
+  while (this->store_.steps.pop(step))
+    this->apply_step_(step.direction, this->step_multiplier_(step));
+
+  int32_t dropped;
+  {
+    InterruptLock lock;
+    dropped = this->store_.dropped;
+    this->store_.dropped = 0;
+  }
+  if (dropped != 0) {
     ESP_LOGW(TAG, "Captured more rotation events than expected");
+    for (; dropped > 0; dropped--)
+      this->apply_step_(1, 1);
+    for (; dropped < 0; dropped++)
+      this->apply_step_(-1, 1);
   }
 
-  for (auto events : rotation_events) {
-    if (events == 0)  // we are at the end of the recorded events
-      break;
+  if (this->pin_i_ != nullptr && this->pin_i_->digital_read()) {
+    this->counter_ = 0;
+  }
+  const uint32_t now = millis();
+  if (this->last_published_ != this->counter_ && now - this->last_publish_ >= this->publish_interval_) {
+    this->last_published_ = this->counter_;
+    this->last_publish_ = now;
+    this->publish_state(this->counter_);
+  }
+}
 
-    if (events > 0) {
-      while (events--) {
-        this->on_clockwise_callback_.call();
-      }
-    } else {
-      while (events++) {
-        this->on_anticlockwise_callback_.call();
-      }
-    }
+int32_t RotaryEncoderSensor::step_multiplier_(const RotaryEncoderStep &step) {
+  const uint32_t interval = step.time - this->last_step_time_;
+  const bool same_direction = step.direction == this->last_direction_;
+  this->last_step_time_ = step.time;
+  this->last_direction_ = step.direction;
+
+  if (!same_direction || interval == 0) {
+    this->velocity_ = 0.0f;
+  } else {
+    // Smooth over the last few steps, a single step interval is very noisy on cheap encoders
+    const float velocity = step.direction * 1e6f / interval;
+    this->velocity_ = this->velocity_ == 0.0f ? velocity : this->velocity_ * 0.75f + velocity * 0.25f;
   }
 
-  if (this->pin_i_ != nullptr && this->pin_i_->digital_read()) {
-    this->store_.counter = 0;
+  const uint32_t threshold = this->acceleration_threshold_us_;
+  if (threshold == 0 || !same_direction || interval >= threshold)
+    return 1;
+  // Linear from 1 at the threshold to the maximum multiplier for back to back steps
+  return 1 + ((this->acceleration_max_multiplier_ - 1) * (threshold - interval) + threshold / 2) / threshold;
+}
+
+void RotaryEncoderSensor::apply_step_(int8_t direction, int32_t multiplier) {
+  for (int32_t i = 0; i < multiplier; i++) {
+    if (direction > 0 && this->counter_ < this->max_value_)
+      this->counter_++;
+    if (direction < 0 && this->counter_ > this->min_value_)
+      this->counter_--;
   }
-  int counter = this->store_.counter;
-  if (this->store_.last_read != counter) {
-    this->store_.last_read = counter;
-    this->publish_state(counter);
+
+  if (direction > 0) {
+    this->on_clockwise_callback_.call();
+  } else {
+    this->on_anticlockwise_callback_.call();
   }
 }
 
+float RotaryEncoderSensor::get_velocity() const {
+  // Stopped once no step came for half a second
+  if (micros() - this->last_step_time_ > 500000UL)
+    return 0.0f;
+  return this->velocity_;
+}
+
 float RotaryEncoderSensor::get_setup_priority() const { return setup_priority::DATA; }
 void RotaryEncoderSensor::set_resolution(RotaryEncoderResolution mode) { this->store_.resolution = mode; }
-void RotaryEncoderSensor::set_min_value(int32_t min_value) { this->store_.min_value = min_value; }
-void RotaryEncoderSensor::set_max_value(int32_t max_value) { this->store_.max_value = max_value; }
+void RotaryEncoderSensor::set_min_value(int32_t min_value) { this->min_value_ = min_value; }
+void RotaryEncoderSensor::set_max_value(int32_t max_value) { this->max_value_ = max_value; }
 
 }  // namespace rotary_encoder
 }  // namespace esphome
@@ -1,10 +1,9 @@
 #pragma once
 
-#include <array>
-
 #include "esphome/core/component.h"
 #include "esphome/core/esphal.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/lock_free_queue.h"
 #include "esphome/components/sensor/sensor.h"
 
 namespace esphome {
@@ -18,19 +17,24 @@ enum RotaryEncoderResolution {
   ROTARY_ENCODER_4_PULSES_PER_CYCLE = 0x1100,  /// increment counter by 4 with every A-B cycle, most inaccurate
 };
 
+struct RotaryEncoderStep {
+  /// micros() when the interrupt decoded the step.
+  uint32_t time;
+  /// 1 for clockwise, -1 for anticlockwise.
+  int8_t direction;
+};
+
 struct RotaryEncoderSensorStore {
   ISRInternalGPIOPin *pin_a;
   ISRInternalGPIOPin *pin_b;
 
-  volatile int32_t counter{0};
   RotaryEncoderResolution resolution{ROTARY_ENCODER_1_PULSE_PER_CYCLE};
-  int32_t min_value{INT32_MIN};
-  int32_t max_value{INT32_MAX};
-  int32_t last_read{0};
   uint8_t state{0};
 
-  std::array<int8_t, 8> rotation_events{};
-  bool rotation_events_overflow{false};
+  /// Decoded steps for loop(), which keeps the counter.
+  LockFreeQueue<RotaryEncoderStep, 32> steps;
+  /// Sum of the steps that didn't fit into the queue, applied without acceleration.
+  volatile int32_t dropped{0};
 
   static void gpio_intr(RotaryEncoderSensorStore *arg);
 };
@@ -51,10 +55,29 @@ class RotaryEncoderSensor : public sensor::Sensor, public Component {
 
   /// Manually set the value of the counter.
   void set_value(int value) {
-    this->store_.counter = value;
+    this->counter_ = value;
     this->loop();
   }
 
+  /** Publish at most once per interval with the accumulated change, 0 publishes every change right away.
+   *
+   * The on_clockwise/on_anticlockwise triggers still fire for every single step.
+   */
+  void set_publish_interval(uint32_t publish_interval) { this->publish_interval_ = publish_interval; }
+
+  /** Speed up fast spins, each step counts up to `max_multiplier` times.
+   *
+   * Steps in the same direction closer than `threshold_us` are multiplied, linearly from 1 at the threshold
+   * to `max_multiplier` for back to back steps.
+   */
+  void set_acceleration(uint32_t threshold_us, uint32_t max_multiplier) {
+    this->acceleration_threshold_us_ = threshold_us;
+    this->acceleration_max_multiplier_ = max_multiplier;
+  }
+
+  /// Current rotation speed in steps per second, positive when turning clockwise.
+  float get_velocity() const;
+
   void set_reset_pin(GPIOPin *pin_i) { this->pin_i_ = pin_i; }
   void set_min_value(int32_t min_value);
   void set_max_value(int32_t max_value);
@@ -80,8 +103,25 @@ class RotaryEncoderSensor : public sensor::Sensor, public Component {
   GPIOPin *pin_b_;
   GPIOPin *pin_i_{nullptr};  /// Index pin, if this is not nullptr, the counter will reset to 0 once this pin is HIGH.
 
+  /// How many counts a step is worth, also updates the direction and velocity accounting.
+  int32_t step_multiplier_(const RotaryEncoderStep &step);
+  void apply_step_(int8_t direction, int32_t multiplier);
+
   RotaryEncoderSensorStore store_{};
 
+  int32_t counter_{0};
+  int32_t min_value_{INT32_MIN};
+  int32_t max_value_{INT32_MAX};
+  int32_t last_published_{0};
+  uint32_t last_publish_{0};
+  uint32_t publish_interval_{0};
+
+  uint32_t acceleration_threshold_us_{0};
+  uint32_t acceleration_max_multiplier_{1};
+  uint32_t last_step_time_{0};
+  int8_t last_direction_{0};
+  float velocity_{0.0f};
+
   CallbackManager<void()> on_clockwise_callback_;
   CallbackManager<void()> on_anticlockwise_callback_;
 };
@@ -91,7 +131,7 @@ template<typename... Ts> class RotaryEncoderSetValueAction : public Action<Ts...
   RotaryEncoderSetValueAction(RotaryEncoderSensor *encoder) : encoder_(encoder) {}
   TEMPLATABLE_VALUE(int, value)
 
-  void play(Ts... x) override { this->encoder_->set_value(this->value_.value(x...)); }
+  void play(const Ts &... x) override { this->encoder_->set_value(this->value_.value(x...)); }
 
  protected:
   RotaryEncoderSensor *encoder_;
@@ -3,6 +3,7 @@ import esphome.config_validation as cv
 from esphome import pins, automation
 from esphome.components import sensor
 from esphome.const import (
+    CONF_ACCELERATION,
     CONF_ID,
     CONF_RESOLUTION,
     CONF_MIN_VALUE,
@@ -15,6 +16,7 @@ from esphome.const import (
     CONF_PIN_A,
     CONF_PIN_B,
     CONF_TRIGGER_ID,
+    CONF_THRESHOLD,
 )
 
 rotary_encoder_ns = cg.esphome_ns.namespace("rotary_encoder")
@@ -28,6 +30,8 @@ RESOLUTIONS = {
 CONF_PIN_RESET = "pin_reset"
 CONF_ON_CLOCKWISE = "on_clockwise"
 CONF_ON_ANTICLOCKWISE = "on_anticlockwise"
+CONF_PUBLISH_INTERVAL = "publish_interval"
+CONF_MAX_MULTIPLIER = "max_multiplier"
 
 RotaryEncoderSensor = rotary_encoder_ns.class_(
     "RotaryEncoderSensor", sensor.Sensor, cg.Component
@@ -73,6 +77,17 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_RESOLUTION, default=1): cv.enum(RESOLUTIONS, int=True),
             cv.Optional(CONF_MIN_VALUE): cv.int_,
             cv.Optional(CONF_MAX_VALUE): cv.int_,
+            cv.Optional(CONF_PUBLISH_INTERVAL): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_ACCELERATION): cv.Schema(
+                {
+                    cv.Optional(
+                        CONF_THRESHOLD, default="50ms"
+                    ): cv.positive_time_period_microseconds,
+                    cv.Optional(CONF_MAX_MULTIPLIER, default=10): cv.int_range(
+                        min=2, max=1000
+                    ),
+                }
+            ),
             cv.Optional(CONF_ON_CLOCKWISE): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -111,6 +126,13 @@ async def to_code(config):
         cg.add(var.set_min_value(config[CONF_MIN_VALUE]))
     if CONF_MAX_VALUE in config:
         cg.add(var.set_max_value(config[CONF_MAX_VALUE]))
+    if CONF_PUBLISH_INTERVAL in config:
+        cg.add(var.set_publish_interval(config[CONF_PUBLISH_INTERVAL]))
+    if CONF_ACCELERATION in config:
+        accel = config[CONF_ACCELERATION]
+        cg.add(
+            var.set_acceleration(accel[CONF_THRESHOLD], accel[CONF_MAX_MULTIPLIER])
+        )
 
     for conf in config.get(CONF_ON_CLOCKWISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
@@ -1,5 +1,6 @@
 #include "scd30.h"
 #include "esphome/core/log.h"
+#include "esphome/core/crc.h"
 
 namespace esphome {
 namespace scd30 {
@@ -192,33 +193,10 @@ bool SCD30Component::write_command_(uint16_t command, uint16_t data) {
   raw[1] = command & 0xFF;
   raw[2] = data >> 8;
   raw[3] = data & 0xFF;
-  raw[4] = sht_crc_(raw[2], raw[3]);
+  raw[4] = crc8_sensirion(&raw[2], 2);
   return this->write_bytes_raw(raw, 5);
 }
 
-uint8_t SCD30Component::sht_crc_(uint8_t data1, uint8_t data2) {
-  uint8_t bit;
-  uint8_t crc = 0xFF;
-
-  crc ^= data1;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  crc ^= data2;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  return crc;
-}
-
 bool SCD30Component::read_data_(uint16_t *data, uint8_t len) {
   const uint8_t num_bytes = len * 3;
   auto *buf = new uint8_t[num_bytes];
@@ -230,7 +208,7 @@ bool SCD30Component::read_data_(uint16_t *data, uint8_t len) {
 
   for (uint8_t i = 0; i < len; i++) {
     const uint8_t j = 3 * i;
-    uint8_t crc = sht_crc_(buf[j], buf[j + 1]);
+    uint8_t crc = crc8_sensirion(&buf[j], 2);
     if (crc != buf[j + 2]) {
       ESP_LOGE(TAG, "CRC8 Checksum invalid! 0x%02X != 0x%02X", buf[j + 2], crc);
       delete[](buf);
@@ -15,12 +15,14 @@ SingleScript = script_ns.class_("SingleScript", Script)
 RestartScript = script_ns.class_("RestartScript", Script)
 QueueingScript = script_ns.class_("QueueingScript", Script, cg.Component)
 ParallelScript = script_ns.class_("ParallelScript", Script)
+ScriptFullPolicy = script_ns.enum("ScriptFullPolicy")
 
 CONF_SINGLE = "single"
 CONF_RESTART = "restart"
 CONF_QUEUED = "queued"
 CONF_PARALLEL = "parallel"
 CONF_MAX_RUNS = "max_runs"
+CONF_WHEN_FULL = "when_full"
 
 SCRIPT_MODES = {
     CONF_SINGLE: SingleScript,
@@ -29,8 +31,18 @@ SCRIPT_MODES = {
     CONF_PARALLEL: ParallelScript,
 }
 
+FULL_POLICIES = {
+    "drop": ScriptFullPolicy.SCRIPT_FULL_DROP,
+    "overwrite": ScriptFullPolicy.SCRIPT_FULL_OVERWRITE,
+}
+
 
 def check_max_runs(value):
+    if CONF_WHEN_FULL in value and CONF_MAX_RUNS not in value:
+        raise cv.Invalid(
+            "The option 'when_full' requires 'max_runs'.",
+            path=[CONF_WHEN_FULL],
+        )
     if CONF_MAX_RUNS not in value:
         return value
     if value[CONF_MODE] not in [CONF_QUEUED, CONF_PARALLEL]:
@@ -56,6 +68,7 @@ CONFIG_SCHEMA = automation.validate_automation(
             *SCRIPT_MODES, lower=True
         ),
         cv.Optional(CONF_MAX_RUNS): cv.positive_int,
+        cv.Optional(CONF_WHEN_FULL): cv.enum(FULL_POLICIES, lower=True),
     },
     extra_validators=cv.All(check_max_runs, assign_declare_id),
 )
@@ -71,6 +84,8 @@ async def to_code(config):
 
         if CONF_MAX_RUNS in conf:
             cg.add(trigger.set_max_runs(conf[CONF_MAX_RUNS]))
+        if CONF_WHEN_FULL in conf:
+            cg.add(trigger.set_full_policy(conf[CONF_WHEN_FULL]))
 
         if conf[CONF_MODE] == CONF_QUEUED:
             await cg.register_component(trigger, conf)
@@ -1,4 +1,5 @@
 #include "script.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -6,6 +7,17 @@ namespace script {
 
 static const char *const TAG = "script";
 
+void Script::log_dropped_run_(const char *mode) {
+  // High rate triggers would otherwise flood the log with one warning per dropped run
+  this->dropped_runs_++;
+  const uint32_t now = millis();
+  if (this->dropped_runs_ != 1 && now - this->last_dropped_warning_ < 1000)
+    return;
+  this->last_dropped_warning_ = now;
+  ESP_LOGW(TAG, "Script '%s' maximum number of %s runs exceeded! (%u runs dropped)", this->name_.c_str(), mode,
+           this->dropped_runs_);
+}
+
 void SingleScript::execute() {
   if (this->is_action_running()) {
     ESP_LOGW(TAG, "Script '%s' is already running! (mode: single)", this->name_.c_str());
@@ -29,11 +41,18 @@ void QueueingScript::execute() {
     // num_runs_ is the number of *queued* instances, so total number of instances is
     // num_runs_ + 1
     if (this->max_runs_ != 0 && this->num_runs_ + 1 >= this->max_runs_) {
-      ESP_LOGW(TAG, "Script '%s' maximum number of queued runs exceeded!", this->name_.c_str());
+      if (this->full_policy_ == SCRIPT_FULL_DROP) {
+        this->log_dropped_run_("queued");
+        return;
+      }
+      // All queued runs are the same, so the new run takes the place of the one in progress
+      ESP_LOGD(TAG, "Script '%s' queue full, stopping the current instance (mode: queued)", this->name_.c_str());
+      Script::stop();
+      this->trigger();
       return;
     }
 
-    ESP_LOGD(TAG, "Script '%s' queueing new instance (mode: queued)", this->name_.c_str());
+    ESP_LOGV(TAG, "Script '%s' queueing new instance (mode: queued)", this->name_.c_str());
     this->num_runs_++;
     return;
   }
@@ -55,10 +74,20 @@ void QueueingScript::loop() {
   }
 }
 
+void ParallelScript::set_max_runs(int max_runs) {
+  this->max_runs_ = max_runs;
+  App.scheduler.add_pool_reservation(max_runs);
+}
+
 void ParallelScript::execute() {
   if (this->max_runs_ != 0 && this->automation_parent_->num_running() >= this->max_runs_) {
-    ESP_LOGW(TAG, "Script '%s' maximum number of parallel runs exceeded!", this->name_.c_str());
-    return;
+    if (this->full_policy_ == SCRIPT_FULL_DROP) {
+      this->log_dropped_run_("parallel");
+      return;
+    }
+    // The actions can't stop a single run, all of them make room for the new one
+    ESP_LOGD(TAG, "Script '%s' maximum number of parallel runs reached, stopping them", this->name_.c_str());
+    this->stop();
   }
   this->trigger();
 }
@@ -6,6 +6,14 @@
 namespace esphome {
 namespace script {
 
+/// What queued and parallel scripts do when they are executed while max_runs runs are pending.
+enum ScriptFullPolicy {
+  /// Discard the new run.
+  SCRIPT_FULL_DROP = 0,
+  /// Stop the runs in progress to make room for the new one.
+  SCRIPT_FULL_OVERWRITE,
+};
+
 /// The abstract base class for all script types.
 class Script : public Trigger<> {
  public:
@@ -23,7 +31,12 @@ class Script : public Trigger<> {
   void set_name(const std::string &name) { name_ = name; }
 
  protected:
+  /// Count a run discarded because the script is full, warnings are limited to one per second.
+  void log_dropped_run_(const char *mode);
+
   std::string name_;
+  uint32_t dropped_runs_{0};
+  uint32_t last_dropped_warning_{0};
 };
 
 /** A script type for which only a single instance at a time is allowed.
@@ -56,10 +69,12 @@ class QueueingScript : public Script, public Component {
   void stop() override;
   void loop() override;
   void set_max_runs(int max_runs) { max_runs_ = max_runs; }
+  void set_full_policy(ScriptFullPolicy full_policy) { full_policy_ = full_policy; }
 
  protected:
   int num_runs_ = 0;
   int max_runs_ = 0;
+  ScriptFullPolicy full_policy_{SCRIPT_FULL_DROP};
 };
 
 /** A script type that executes new instances in parallel.
@@ -70,17 +85,20 @@ class QueueingScript : public Script, public Component {
 class ParallelScript : public Script {
  public:
   void execute() override;
-  void set_max_runs(int max_runs) { max_runs_ = max_runs; }
+  /// Also reserves scheduler items for the runs, each run waits in at most one delay at a time.
+  void set_max_runs(int max_runs);
+  void set_full_policy(ScriptFullPolicy full_policy) { full_policy_ = full_policy; }
 
  protected:
   int max_runs_ = 0;
+  ScriptFullPolicy full_policy_{SCRIPT_FULL_DROP};
 };
 
 template<typename... Ts> class ScriptExecuteAction : public Action<Ts...> {
  public:
   ScriptExecuteAction(Script *script) : script_(script) {}
 
-  void play(Ts... x) override { this->script_->execute(); }
+  void play(const Ts &... x) override { this->script_->execute(); }
 
  protected:
   Script *script_;
@@ -90,7 +108,7 @@ template<typename... Ts> class ScriptStopAction : public Action<Ts...> {
  public:
   ScriptStopAction(Script *script) : script_(script) {}
 
-  void play(Ts... x) override { this->script_->stop(); }
+  void play(const Ts &... x) override { this->script_->stop(); }
 
  protected:
   Script *script_;
@@ -100,7 +118,7 @@ template<typename... Ts> class IsRunningCondition : public Condition<Ts...> {
  public:
   explicit IsRunningCondition(Script *parent) : parent_(parent) {}
 
-  bool check(Ts... x) override { return this->parent_->is_running(); }
+  bool check(const Ts &... x) override { return this->parent_->is_running(); }
 
  protected:
   Script *parent_;
@@ -110,7 +128,7 @@ template<typename... Ts> class ScriptWaitAction : public Action<Ts...>, public C
  public:
   ScriptWaitAction(Script *script) : script_(script) {}
 
-  void play_complex(Ts... x) override {
+  void play_complex(const Ts &... x) override {
     this->num_running_++;
     // Check if we can continue immediately.
     if (!this->script_->is_running()) {
@@ -133,7 +151,7 @@ template<typename... Ts> class ScriptWaitAction : public Action<Ts...>, public C
 
   float get_setup_priority() const override { return setup_priority::DATA; }
 
-  void play(Ts... x) override { /* ignore - see play_complex */
+  void play(const Ts &... x) override { /* ignore - see play_complex */
   }
 
  protected:
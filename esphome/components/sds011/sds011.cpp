@@ -29,6 +29,11 @@ static const uint8_t SDS011_MODE_SLEEP = 0x00;
 static const uint8_t SDS011_MODE_WORK = 0x01;
 
 void SDS011Component::setup() {
+  this->parser_.set_header({SDS011_MSG_HEAD, SDS011_COMMAND_ID_DATA});
+  this->parser_.set_fixed_length(SDS011_MSG_RESPONSE_LENGTH);
+  this->parser_.set_validator([this](const uint8_t *frame, size_t length) { return this->check_frame_(frame); });
+  this->parser_.set_on_frame([this](const uint8_t *frame, size_t length) { this->parse_data_(frame); });
+
   if (this->rx_mode_only_) {
     // In RX-only mode we do not setup the sensor, it is assumed to be setup
     // already
@@ -74,36 +79,7 @@ void SDS011Component::dump_config() {
   this->check_uart_settings(9600);
 }
 
-void SDS011Component::loop() {
-  const uint32_t now = millis();
-  if ((now - this->last_transmission_ >= 500) && this->data_index_) {
-    // last transmission too long ago. Reset RX index.
-    ESP_LOGV(TAG, "Last transmission too long ago. Reset RX index.");
-    this->data_index_ = 0;
-  }
-
-  if (this->available() == 0) {
-    return;
-  }
-
-  this->last_transmission_ = now;
-  while (this->available() != 0) {
-    this->read_byte(&this->data_[this->data_index_]);
-    auto check = this->check_byte_();
-    if (!check.has_value()) {
-      // finished
-      this->parse_data_();
-      this->data_index_ = 0;
-    } else if (!*check) {
-      // wrong data
-      ESP_LOGV(TAG, "Byte %i of received data frame is invalid.", this->data_index_);
-      this->data_index_ = 0;
-    } else {
-      // next byte
-      this->data_index_++;
-    }
-  }
-}
+void SDS011Component::loop() { this->parser_.read_from(this); }
 
 float SDS011Component::get_setup_priority() const { return setup_priority::DATA; }
 
@@ -125,45 +101,20 @@ uint8_t SDS011Component::sds011_checksum_(const uint8_t *command_data, uint8_t l
   return sum;
 }
 
-optional<bool> SDS011Component::check_byte_() const {
-  uint8_t index = this->data_index_;
-  uint8_t byte = this->data_[index];
-
-  if (index == 0) {
-    return byte == SDS011_MSG_HEAD;
+bool SDS011Component::check_frame_(const uint8_t *data) const {
+  // checksum is without checksum bytes
+  uint8_t checksum = sds011_checksum_(data + 2, SDS011_DATA_RESPONSE_LENGTH);
+  if (checksum != data[8]) {
+    ESP_LOGW(TAG, "SDS011 Checksum doesn't match: 0x%02X!=0x%02X", data[8], checksum);
+    return false;
   }
-
-  if (index == 1) {
-    return byte == SDS011_COMMAND_ID_DATA;
-  }
-
-  if ((index >= 2) && (index <= 7)) {
-    return true;
-  }
-
-  if (index == 8) {
-    // checksum is without checksum bytes
-    uint8_t checksum = sds011_checksum_(this->data_ + 2, SDS011_DATA_RESPONSE_LENGTH);
-    if (checksum != byte) {
-      ESP_LOGW(TAG, "SDS011 Checksum doesn't match: 0x%02X!=0x%02X", byte, checksum);
-      return false;
-    }
-    return true;
-  }
-
-  if (index == 9) {
-    if (byte != SDS011_MSG_TAIL) {
-      return false;
-    }
-  }
-
-  return {};
+  return data[9] == SDS011_MSG_TAIL;
 }
 
-void SDS011Component::parse_data_() {
+void SDS011Component::parse_data_(const uint8_t *data) {
   this->status_clear_warning();
-  const float pm_2_5_concentration = this->get_16_bit_uint_(2) / 10.0f;
-  const float pm_10_0_concentration = this->get_16_bit_uint_(4) / 10.0f;
+  const float pm_2_5_concentration = this->get_16_bit_uint_(data, 2) / 10.0f;
+  const float pm_10_0_concentration = this->get_16_bit_uint_(data, 4) / 10.0f;
 
   ESP_LOGD(TAG, "Got PM2.5 Concentration: %.1f µg/m³, PM10.0 Concentration: %.1f µg/m³", pm_2_5_concentration,
            pm_10_0_concentration);
@@ -179,8 +130,8 @@ void SDS011Component::parse_data_() {
   }
 }
 
-uint16_t SDS011Component::get_16_bit_uint_(uint8_t start_index) const {
-  return (uint16_t(this->data_[start_index + 1]) << 8) | uint16_t(this->data_[start_index]);
+uint16_t SDS011Component::get_16_bit_uint_(const uint8_t *data, uint8_t start_index) const {
+  return (uint16_t(data[start_index + 1]) << 8) | uint16_t(data[start_index]);
 }
 void SDS011Component::set_update_interval_min(uint8_t update_interval_min) {
   this->update_interval_min_ = update_interval_min;
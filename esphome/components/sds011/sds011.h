@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/frame_parser.h"
 
 namespace esphome {
 namespace sds011 {
@@ -30,16 +31,14 @@ class SDS011Component : public Component, public uart::UARTDevice {
  protected:
   void sds011_write_command_(const uint8_t *command);
   uint8_t sds011_checksum_(const uint8_t *command_data, uint8_t length) const;
-  optional<bool> check_byte_() const;
-  void parse_data_();
-  uint16_t get_16_bit_uint_(uint8_t start_index) const;
+  bool check_frame_(const uint8_t *data) const;
+  void parse_data_(const uint8_t *data);
+  uint16_t get_16_bit_uint_(const uint8_t *data, uint8_t start_index) const;
 
   sensor::Sensor *pm_2_5_sensor_{nullptr};
   sensor::Sensor *pm_10_0_sensor_{nullptr};
 
-  uint8_t data_[10];
-  uint8_t data_index_{0};
-  uint32_t last_transmission_{0};
+  uart::FrameParser parser_;
   uint8_t update_interval_min_;
 
   bool rx_mode_only_;
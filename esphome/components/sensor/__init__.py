@@ -26,6 +26,7 @@ from esphome.const import (
     CONF_STATE_CLASS,
     CONF_TO,
     CONF_TRIGGER_ID,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_WINDOW_SIZE,
     CONF_NAME,
@@ -146,8 +147,10 @@ SensorPublishAction = sensor_ns.class_("SensorPublishAction", automation.Action)
 # Filters
 Filter = sensor_ns.class_("Filter")
 MedianFilter = sensor_ns.class_("MedianFilter", Filter)
+QuantileFilter = sensor_ns.class_("QuantileFilter", Filter)
 MinFilter = sensor_ns.class_("MinFilter", Filter)
 MaxFilter = sensor_ns.class_("MaxFilter", Filter)
+RangeFilter = sensor_ns.class_("RangeFilter", Filter)
 SlidingWindowMovingAverageFilter = sensor_ns.class_(
     "SlidingWindowMovingAverageFilter", Filter
 )
@@ -293,6 +296,31 @@ async def median_filter_to_code(config, filter_id):
     )
 
 
+CONF_QUANTILE = "quantile"
+QUANTILE_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
+            cv.Optional(CONF_QUANTILE, default=0.9): cv.zero_to_one_float,
+        }
+    ),
+    validate_send_first_at,
+)
+
+
+@FILTER_REGISTRY.register("quantile", QuantileFilter, QUANTILE_SCHEMA)
+async def quantile_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(
+        filter_id,
+        config[CONF_WINDOW_SIZE],
+        config[CONF_SEND_EVERY],
+        config[CONF_SEND_FIRST_AT],
+        config[CONF_QUANTILE],
+    )
+
+
 MIN_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -337,6 +365,28 @@ async def max_filter_to_code(config, filter_id):
     )
 
 
+RANGE_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
+        }
+    ),
+    validate_send_first_at,
+)
+
+
+@FILTER_REGISTRY.register("range", RangeFilter, RANGE_SCHEMA)
+async def range_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(
+        filter_id,
+        config[CONF_WINDOW_SIZE],
+        config[CONF_SEND_EVERY],
+        config[CONF_SEND_FIRST_AT],
+    )
+
+
 SLIDING_AVERAGE_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -484,12 +534,46 @@ async def calibrate_polynomial_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id, res)
 
 
+def _affine_filter(conf):
+    """Return (slope, bias) if the filter is an affine transformation that can be fused, otherwise None."""
+    if conf[CONF_TYPE_ID].is_manual:
+        return None
+    entry, value = cg.extract_registry_entry_config(FILTER_REGISTRY, conf)
+    if entry.name == "offset":
+        return 1.0, value
+    if entry.name == "multiply":
+        return value, 0.0
+    if entry.name == "calibrate_linear":
+        return fit_linear([c[CONF_FROM] for c in value], [c[CONF_TO] for c in value])
+    return None
+
+
 async def build_filters(config):
-    return await cg.build_registry_list(FILTER_REGISTRY, config)
+    # Runs of offset, multiply and calibrate_linear filters are fused into a single
+    # calibrate_linear filter, which saves an object and a virtual call per filter and value.
+    filters = []
+    i = 0
+    while i < len(config):
+        affine = _affine_filter(config[i])
+        j = i + 1
+        while affine is not None and j < len(config):
+            nxt = _affine_filter(config[j])
+            if nxt is None:
+                break
+            affine = (nxt[0] * affine[0], nxt[0] * affine[1] + nxt[1])
+            j += 1
+        if j - i > 1:
+            filter_id = config[i][CONF_TYPE_ID].copy()
+            filter_id.type = CalibrateLinearFilter
+            filters.append(cg.new_Pvariable(filter_id, affine[0], affine[1]))
+        else:
+            filters.append(await cg.build_registry_entry(FILTER_REGISTRY, config[i]))
+        i = j
+    return filters
 
 
 async def setup_sensor_core_(var, config):
-    cg.add(var.set_name(config[CONF_NAME]))
+    cg.setup_entity_name(var, config[CONF_NAME])
     if CONF_INTERNAL in config:
         cg.add(var.set_internal(config[CONF_INTERNAL]))
     if CONF_DEVICE_CLASS in config:
@@ -1,6 +1,7 @@
 #include "filter.h"
 #include "sensor.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 namespace esphome {
 namespace sensor {
@@ -39,17 +40,60 @@ uint32_t Filter::calculate_remaining_interval(uint32_t input) {
   }
 }
 
+// SortedWindow
+void SortedWindow::set_window_size(size_t window_size) {
+  this->ring_.set_capacity(window_size);
+  this->sorted_.clear();
+  this->sorted_.shrink_to_fit();
+  this->sorted_.reserve(window_size);
+}
+void SortedWindow::push(float value) {
+  if (this->ring_.full()) {
+    // push_back() drops the oldest value
+    float oldest = this->ring_.front();
+    this->sorted_.erase(std::lower_bound(this->sorted_.begin(), this->sorted_.end(), oldest));
+  }
+  this->ring_.push_back(value);
+  this->sorted_.insert(std::upper_bound(this->sorted_.begin(), this->sorted_.end(), value), value);
+}
+float SortedWindow::quantile(float quantile) const {
+  if (this->sorted_.empty())
+    return NAN;
+  float pos = clamp(quantile, 0.0f, 1.0f) * (this->sorted_.size() - 1);
+  size_t index = pos;
+  if (index + 1 >= this->sorted_.size())
+    return this->sorted_.back();
+  float frac = pos - index;
+  return this->sorted_[index] + (this->sorted_[index + 1] - this->sorted_[index]) * frac;
+}
+
+// SlidingExtremum
+void SlidingExtremum::set_window_size(size_t window_size) { this->entries_.set_capacity(window_size); }
+void SlidingExtremum::push(float value) {
+  this->seq_++;
+  // Drop the oldest value once it's out of the window
+  if (!this->entries_.empty() && this->seq_ - this->entries_.front().seq >= this->entries_.capacity())
+    this->entries_.pop_front();
+  // Drop all values that the new one supersedes
+  while (!this->entries_.empty()) {
+    float back = this->entries_.back().value;
+    if (this->maximum_ ? back > value : back < value)
+      break;
+    this->entries_.pop_back();
+  }
+  this->entries_.push_back(Entry{value, this->seq_});
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MedianFilter::new_value(float value) {
   if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
-    }
-    this->queue_.push_back(value);
+    this->window_.push(value);
     ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
   }
 
@@ -57,17 +101,9 @@ optional<float> MedianFilter::new_value(float value) {
     this->send_at_ = 0;
 
     float median = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float> median_queue = this->queue_;
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size % 2) {
-        median = median_queue[queue_size / 2];
-      } else {
-        median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-      }
-    }
+    if (!this->window_.empty())
+      // With an even number of values this is the mean of the two middle ones
+      median = this->window_.quantile(0.5f);
 
     ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f) SENDING", this, median);
     return median;
@@ -77,17 +113,45 @@ optional<float> MedianFilter::new_value(float value) {
 
 uint32_t MedianFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
 
+// QuantileFilter
+QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
+    : send_every_(send_every), send_at_(send_every - send_first_at), quantile_(quantile) {
+  this->window_.set_window_size(window_size);
+}
+void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
+void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
+optional<float> QuantileFilter::new_value(float value) {
+  if (!isnan(value)) {
+    this->window_.push(value);
+    ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f)", this, value);
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+
+    float result = 0.0f;
+    if (!this->window_.empty())
+      result = this->window_.quantile(this->quantile_);
+
+    ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING", this, result);
+    return result;
+  }
+  return {};
+}
+
+uint32_t QuantileFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+
 // MinFilter
 MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MinFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MinFilter::new_value(float value) {
   if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
-    }
-    this->queue_.push_back(value);
+    this->window_.push(value);
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
   }
 
@@ -95,10 +159,8 @@ optional<float> MinFilter::new_value(float value) {
     this->send_at_ = 0;
 
     float min = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float>::iterator it = std::min_element(queue_.begin(), queue_.end());
-      min = *it;
-    }
+    if (!this->window_.empty())
+      min = this->window_.get();
 
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING", this, min);
     return min;
@@ -110,15 +172,14 @@ uint32_t MinFilter::expected_interval(uint32_t input) { return input * this->sen
 
 // MaxFilter
 MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->window_.set_window_size(window_size);
+}
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MaxFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
 optional<float> MaxFilter::new_value(float value) {
   if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
-    }
-    this->queue_.push_back(value);
+    this->window_.push(value);
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
   }
 
@@ -126,10 +187,8 @@ optional<float> MaxFilter::new_value(float value) {
     this->send_at_ = 0;
 
     float max = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float>::iterator it = std::max_element(queue_.begin(), queue_.end());
-      max = *it;
-    }
+    if (!this->window_.empty())
+      max = this->window_.get();
 
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING", this, max);
     return max;
@@ -139,16 +198,51 @@ optional<float> MaxFilter::new_value(float value) {
 
 uint32_t MaxFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
 
+// RangeFilter
+RangeFilter::RangeFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->set_window_size(window_size);
+}
+void RangeFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void RangeFilter::set_window_size(size_t window_size) {
+  this->min_.set_window_size(window_size);
+  this->max_.set_window_size(window_size);
+}
+optional<float> RangeFilter::new_value(float value) {
+  if (!isnan(value)) {
+    this->min_.push(value);
+    this->max_.push(value);
+    ESP_LOGVV(TAG, "RangeFilter(%p)::new_value(%f)", this, value);
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+
+    float range = 0.0f;
+    if (!this->min_.empty())
+      range = this->max_.get() - this->min_.get();
+
+    ESP_LOGVV(TAG, "RangeFilter(%p)::new_value(%f) SENDING", this, range);
+    return range;
+  }
+  return {};
+}
+
+uint32_t RangeFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : queue_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->queue_.set_capacity(window_size);
+  this->sum_ = 0;
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
   if (!isnan(value)) {
-    if (this->queue_.size() == this->window_size_) {
-      this->sum_ -= this->queue_[0];
+    if (this->queue_.full()) {
+      this->sum_ -= this->queue_.front();
       this->queue_.pop_front();
     }
     this->queue_.push_back(value);
@@ -165,8 +259,8 @@ optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
     if (this->send_at_ >= 10000) {
       // Recalculate to prevent floating point error accumulating
       this->sum_ = 0;
-      for (auto v : this->queue_)
-        this->sum_ += v;
+      for (size_t i = 0; i < this->queue_.size(); i++)
+        this->sum_ += this->queue_[i];
       average = this->sum_ / this->queue_.size();
       this->send_at_ = 0;
     }
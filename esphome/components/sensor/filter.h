@@ -2,8 +2,8 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
-#include <queue>
 #include <utility>
+#include <vector>
 
 namespace esphome {
 namespace sensor {
@@ -47,6 +47,55 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** The values of a sliding window, kept in sorted order next to the ring buffer of arrival order.
+ *
+ * A new value replaces the oldest one with two binary searches and a move of the values in between, so quantiles
+ * can be read directly without copying and sorting the window. Both buffers are allocated once.
+ */
+class SortedWindow {
+ public:
+  void set_window_size(size_t window_size);
+  void push(float value);
+
+  bool empty() const { return this->sorted_.empty(); }
+  size_t size() const { return this->sorted_.size(); }
+  /// Quantile between 0 and 1 of the values in the window, linearly interpolated between neighbouring values.
+  float quantile(float quantile) const;
+
+ protected:
+  RingBuffer<float> ring_;
+  std::vector<float> sorted_;
+};
+
+/** Minimum or maximum of a sliding window, with a monotonic deque on a ring buffer.
+ *
+ * Values that can never become the extremum again, because a newer value is smaller (larger for the maximum), are
+ * dropped when they're pushed, so the front of the deque is always the current extremum. Every value is added and
+ * removed once, which makes updates O(1) amortized. The ring buffer is allocated once for the window size.
+ */
+class SlidingExtremum {
+ public:
+  explicit SlidingExtremum(bool maximum) : maximum_(maximum) {}
+
+  void set_window_size(size_t window_size);
+  void push(float value);
+
+  bool empty() const { return this->entries_.empty(); }
+  /// The minimum or maximum of the window, only valid if not empty().
+  float get() const { return this->entries_.front().value; }
+
+ protected:
+  struct Entry {
+    float value;
+    /// Number of the value since the start, to expire it once it drops out of the window.
+    uint32_t seq;
+  };
+
+  RingBuffer<Entry> entries_;
+  uint32_t seq_{0};
+  bool maximum_;
+};
+
 /** Simple median filter.
  *
  * Takes the median of the last <send_every> values and pushes it out every <send_every>.
@@ -71,10 +120,41 @@ class MedianFilter : public Filter {
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
+};
+
+/** Quantile filter, the generalization of the median filter.
+ *
+ * Takes the given quantile (for example 0.9 for the 90th percentile) of the last <window_size> values and pushes
+ * it out every <send_every>.
+ */
+class QuantileFilter : public Filter {
+ public:
+  /** Construct a QuantileFilter.
+   *
+   * @param window_size The number of values that should be used in the calculation.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Must be less than or equal to
+   *   send_every.
+   * @param quantile The quantile between 0 and 1.
+   */
+  explicit QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile);
+
+  optional<float> new_value(float value) override;
+
+  void set_send_every(size_t send_every);
+  void set_window_size(size_t window_size);
+  void set_quantile(float quantile);
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  SortedWindow window_;
+  size_t send_every_;
+  size_t send_at_;
+  float quantile_;
 };
 
 /** Simple min filter.
@@ -101,10 +181,9 @@ class MinFilter : public Filter {
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  std::deque<float> queue_;
+  SlidingExtremum window_{false};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -131,10 +210,39 @@ class MaxFilter : public Filter {
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  std::deque<float> queue_;
+  SlidingExtremum window_{true};
+  size_t send_every_;
+  size_t send_at_;
+};
+
+/** Range filter.
+ *
+ * Takes the difference between the max and the min (peak to peak) of the last <window_size> values and pushes it
+ * out every <send_every>.
+ */
+class RangeFilter : public Filter {
+ public:
+  /** Construct a RangeFilter.
+   *
+   * @param window_size The number of values that the range should be returned from.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Must be less than or equal to
+   *   send_every.
+   */
+  explicit RangeFilter(size_t window_size, size_t send_every, size_t send_first_at);
+
+  optional<float> new_value(float value) override;
+
+  void set_send_every(size_t send_every);
+  void set_window_size(size_t window_size);
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  SlidingExtremum min_{false};
+  SlidingExtremum max_{true};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -163,10 +271,9 @@ class SlidingWindowMovingAverageFilter : public Filter {
 
  protected:
   float sum_{0.0};
-  std::deque<float> queue_;
+  RingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple exponential moving average filter.
@@ -47,24 +47,20 @@ int8_t Sensor::accuracy_decimals() { return 0; }
 Sensor::Sensor(const std::string &name) : Nameable(name), state(NAN), raw_state(NAN) {}
 Sensor::Sensor() : Sensor("") {}
 
-void Sensor::set_unit_of_measurement(const std::string &unit_of_measurement) {
+void Sensor::set_unit_of_measurement(const char *unit_of_measurement) {
   this->unit_of_measurement_ = unit_of_measurement;
 }
-void Sensor::set_icon(const std::string &icon) { this->icon_ = icon; }
+void Sensor::set_icon(const char *icon) { this->icon_ = icon; }
 void Sensor::set_accuracy_decimals(int8_t accuracy_decimals) { this->accuracy_decimals_ = accuracy_decimals; }
-void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
-void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
-  this->raw_callback_.add(std::move(callback));
-}
 std::string Sensor::get_icon() {
-  if (this->icon_.has_value())
-    return *this->icon_;
+  if (this->icon_ != nullptr)
+    return this->icon_;
   return this->icon();
 }
-void Sensor::set_device_class(const std::string &device_class) { this->device_class_ = device_class; }
+void Sensor::set_device_class(const char *device_class) { this->device_class_ = device_class; }
 std::string Sensor::get_device_class() {
-  if (this->device_class_.has_value())
-    return *this->device_class_;
+  if (this->device_class_ != nullptr)
+    return this->device_class_;
   return this->device_class();
 }
 std::string Sensor::device_class() { return ""; }
@@ -78,8 +74,8 @@ void Sensor::set_state_class(const std::string &state_class) {
 }
 void Sensor::set_last_reset_type(LastResetType last_reset_type) { this->last_reset_type = last_reset_type; }
 std::string Sensor::get_unit_of_measurement() {
-  if (this->unit_of_measurement_.has_value())
-    return *this->unit_of_measurement_;
+  if (this->unit_of_measurement_ != nullptr)
+    return this->unit_of_measurement_;
   return this->unit_of_measurement();
 }
 int8_t Sensor::get_accuracy_decimals() {
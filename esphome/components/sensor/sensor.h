@@ -69,13 +69,13 @@ class Sensor : public Nameable {
    *
    * @param unit_of_measurement The unit of measurement, "" to disable.
    */
-  void set_unit_of_measurement(const std::string &unit_of_measurement);
+  void set_unit_of_measurement(const char *unit_of_measurement);
 
   /** Manually set the icon of this sensor. By default the sensor's default defined by icon() is used.
    *
    * @param icon The icon, for example "mdi:flash". "" to disable.
    */
-  void set_icon(const std::string &icon);
+  void set_icon(const char *icon);
 
   /** Manually set the accuracy in decimals for this sensor. By default, the sensor's default defined by
    * accuracy_decimals() is used.
@@ -131,9 +131,11 @@ class Sensor : public Nameable {
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
-  void add_on_state_callback(std::function<void(float)> &&callback);
+  template<typename F> void add_on_state_callback(F &&callback) { this->callback_.add(std::forward<F>(callback)); }
   /// Add a callback that will be called every time the sensor sends a raw value.
-  void add_on_raw_state_callback(std::function<void(float)> &&callback);
+  template<typename F> void add_on_raw_state_callback(F &&callback) {
+    this->raw_callback_.add(std::forward<F>(callback));
+  }
 
   /** This member variable stores the last state that has passed through all filters.
    *
@@ -145,7 +147,7 @@ class Sensor : public Nameable {
   float state;
 
   /// Manually set the Home Assistant device class (see sensor::device_class)
-  void set_device_class(const std::string &device_class);
+  void set_device_class(const char *device_class);
 
   /// Get the device class for this sensor, using the manual override if specified.
   std::string get_device_class();
@@ -223,16 +225,16 @@ class Sensor : public Nameable {
   /// Return the accuracy in decimals for this sensor.
   virtual int8_t accuracy_decimals();  // NOLINT
 
-  optional<std::string> device_class_{};  ///< Stores the override of the device class
+  const char *device_class_{nullptr};  ///< Stores the override of the device class, nullptr if not set
 
   uint32_t hash_base() override;
 
   CallbackManager<void(float)> raw_callback_;  ///< Storage for raw state callbacks.
   CallbackManager<void(float)> callback_;      ///< Storage for filtered state callbacks.
-  /// Override the unit of measurement
-  optional<std::string> unit_of_measurement_;
-  /// Override the icon advertised to Home Assistant, otherwise sensor's icon will be used.
-  optional<std::string> icon_;
+  /// Override the unit of measurement, nullptr if not set.
+  const char *unit_of_measurement_{nullptr};
+  /// Override the icon advertised to Home Assistant, otherwise (nullptr) sensor's icon will be used.
+  const char *icon_{nullptr};
   /// Override the accuracy in decimals, otherwise the sensor's values will be used.
   optional<int8_t> accuracy_decimals_;
   Filter *filter_list_{nullptr};  ///< Store all active filters.
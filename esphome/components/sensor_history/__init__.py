@@ -0,0 +1,61 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import CONF_DURATION, CONF_ID, CONF_INTERVAL, CONF_SENSOR
+
+DEPENDENCIES = ["sensor"]
+MULTI_CONF = True
+
+sensor_history_ns = cg.esphome_ns.namespace("sensor_history")
+SensorHistory = sensor_history_ns.class_("SensorHistory", cg.Component)
+
+CONF_PSRAM = "psram"
+CONF_TIERS = "tiers"
+
+
+def validate_tier(config):
+    if config[CONF_DURATION] < config[CONF_INTERVAL]:
+        raise cv.Invalid("The duration of a tier must be at least its interval")
+    return config
+
+
+TIER_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_INTERVAL): cv.positive_time_period_milliseconds,
+            cv.Required(CONF_DURATION): cv.positive_time_period_milliseconds,
+        }
+    ),
+    validate_tier,
+)
+
+DEFAULT_TIERS = [
+    {CONF_INTERVAL: "1s", CONF_DURATION: "10min"},
+    {CONF_INTERVAL: "1min", CONF_DURATION: "24h"},
+]
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(SensorHistory),
+        cv.Required(CONF_SENSOR): cv.use_id(sensor.Sensor),
+        cv.Optional(CONF_TIERS, default=DEFAULT_TIERS): cv.All(
+            cv.ensure_list(TIER_SCHEMA), cv.Length(min=1, max=8)
+        ),
+        cv.Optional(CONF_PSRAM): cv.All(cv.only_on_esp32, cv.boolean),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    sens = await cg.get_variable(config[CONF_SENSOR])
+    cg.add(var.set_sensor(sens))
+    for tier in config[CONF_TIERS]:
+        interval = tier[CONF_INTERVAL].total_milliseconds
+        length = tier[CONF_DURATION].total_milliseconds // interval
+        cg.add(var.add_tier(interval, length))
+    if CONF_PSRAM in config:
+        cg.add(var.set_psram(config[CONF_PSRAM]))
+    cg.add_define("USE_SENSOR_HISTORY")
@@ -0,0 +1,121 @@
+#include "sensor_history.h"
+#include "esphome/core/log.h"
+#include <cstring>
+
+namespace esphome {
+namespace sensor_history {
+
+static const char *const TAG = "sensor_history";
+
+static const uint16_t HALF_NAN = 0x7E00;
+
+static LargeBufferUsage sensor_history_usage(  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    "sensor_history");
+
+uint16_t float_to_half(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  uint16_t sign = (bits >> 16) & 0x8000;
+  int32_t exponent = int32_t((bits >> 23) & 0xFF) - 127 + 15;
+  uint32_t mantissa = bits & 0x7FFFFF;
+
+  if (((bits >> 23) & 0xFF) == 0xFF)
+    return mantissa != 0 ? HALF_NAN : sign | 0x7C00;
+  if (exponent >= 0x1F)
+    // Too large, saturate to infinity
+    return sign | 0x7C00;
+  if (exponent <= 0) {
+    if (exponent < -10)
+      return sign;
+    // Subnormal
+    mantissa |= 0x800000;
+    uint32_t shift = 14 - exponent;
+    uint16_t half = sign | (mantissa >> shift);
+    uint32_t rest = mantissa & ((1u << shift) - 1);
+    uint32_t halfway = 1u << (shift - 1);
+    if (rest > halfway || (rest == halfway && (half & 1)))
+      half++;
+    return half;
+  }
+  uint16_t half = sign | (exponent << 10) | (mantissa >> 13);
+  // Round to nearest even, a carry into the exponent is still correct
+  uint32_t rest = mantissa & 0x1FFF;
+  if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+    half++;
+  return half;
+}
+float half_to_float(uint16_t value) {
+  uint32_t sign = uint32_t(value & 0x8000) << 16;
+  uint32_t exponent = (value >> 10) & 0x1F;
+  uint32_t mantissa = value & 0x3FF;
+  uint32_t bits;
+  if (exponent == 0x1F) {
+    bits = sign | 0x7F800000 | (mantissa << 13);
+  } else if (exponent != 0) {
+    bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  } else if (mantissa == 0) {
+    bits = sign;
+  } else {
+    // Subnormal half, normalize it
+    exponent = 127 - 15 + 1;
+    while (!(mantissa & 0x400)) {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+  }
+  float result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+void HistoryTier::allocate_(bool psram) {
+  this->samples_ = static_cast<uint16_t *>(large_buffer_allocate(
+      this->capacity_ * sizeof(uint16_t), &sensor_history_usage, psram ? LARGE_BUFFER_PSRAM : LARGE_BUFFER_INTERNAL));
+  this->last_sample_ = millis();
+}
+void HistoryTier::add_(float value) {
+  this->sum_ += value;
+  this->count_++;
+}
+void HistoryTier::sample_() {
+  uint16_t sample = this->count_ == 0 ? HALF_NAN : float_to_half(this->sum_ / this->count_);
+  this->sum_ = 0.0f;
+  this->count_ = 0;
+  if (this->size_ < this->capacity_) {
+    this->samples_[(this->head_ + this->size_) % this->capacity_] = sample;
+    this->size_++;
+  } else {
+    this->samples_[this->head_] = sample;
+    this->head_ = (this->head_ + 1) % this->capacity_;
+  }
+  this->last_sample_ = millis();
+}
+
+std::vector<SensorHistory *> global_sensor_histories;  // NOLINT
+
+SensorHistory::SensorHistory() { global_sensor_histories.push_back(this); }
+
+void SensorHistory::setup() {
+  for (auto &tier : this->tiers_) {
+    tier.allocate_(this->psram_);
+    HistoryTier *t = &tier;
+    this->set_interval(tier.get_interval(), [t]() { t->sample_(); });
+  }
+  this->sensor_->add_on_state_callback([this](float value) {
+    if (isnan(value))
+      return;
+    for (auto &tier : this->tiers_)
+      tier.add_(value);
+  });
+}
+void SensorHistory::dump_config() {
+  ESP_LOGCONFIG(TAG, "Sensor History for '%s':", this->sensor_->get_name().c_str());
+  for (auto &tier : this->tiers_) {
+    ESP_LOGCONFIG(TAG, "  Tier: %u samples every %u ms (%u bytes)", (unsigned) tier.capacity(), tier.get_interval(),
+                  (unsigned) (tier.capacity() * sizeof(uint16_t)));
+  }
+}
+
+}  // namespace sensor_history
+}  // namespace esphome
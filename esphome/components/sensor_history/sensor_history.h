@@ -0,0 +1,81 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/components/sensor/sensor.h"
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace sensor_history {
+
+/// Convert to IEEE 754 half precision, which keeps about 3 significant digits in 2 bytes.
+uint16_t float_to_half(float value);
+float half_to_float(uint16_t value);
+
+/** One resolution of a sensor history, a ring buffer of the means of the values over every interval.
+ *
+ * Samples are stored as half precision floats, an interval without any value is stored as NaN.
+ */
+class HistoryTier {
+ public:
+  HistoryTier(uint32_t interval, size_t capacity) : interval_(interval), capacity_(capacity) {}
+
+  /// Time between two samples in milliseconds.
+  uint32_t get_interval() const { return this->interval_; }
+  size_t capacity() const { return this->capacity_; }
+  size_t size() const { return this->size_; }
+  /// Sample i, 0 is the oldest one.
+  float get(size_t i) const { return half_to_float(this->get_raw(i)); }
+  uint16_t get_raw(size_t i) const { return this->samples_[(this->head_ + i) % this->capacity_]; }
+  /// Time since the newest sample was taken in milliseconds.
+  uint32_t get_age() const { return millis() - this->last_sample_; }
+
+ protected:
+  friend class SensorHistory;
+
+  void allocate_(bool psram);
+  void add_(float value);
+  void sample_();
+
+  uint32_t interval_;
+  size_t capacity_;
+  uint16_t *samples_{nullptr};
+  size_t head_{0};
+  size_t size_{0};
+  /// Sum and number of the values of the current interval.
+  float sum_{0.0f};
+  uint32_t count_{0};
+  uint32_t last_sample_{0};
+};
+
+/** The recent values of a sensor at a few resolutions, for example every second for 10 minutes and every minute
+ * for 24 hours, for graphs on displays and for clients of the native API.
+ */
+class SensorHistory : public Component {
+ public:
+  SensorHistory();
+
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  void add_tier(uint32_t interval, size_t length) { this->tiers_.emplace_back(interval, length); }
+  /// Keep the samples in PSRAM if the ESP32 has it.
+  void set_psram(bool psram) { this->psram_ = psram; }
+
+  sensor::Sensor *get_sensor() const { return this->sensor_; }
+  const std::vector<HistoryTier> &get_tiers() const { return this->tiers_; }
+
+ protected:
+  sensor::Sensor *sensor_{nullptr};
+  std::vector<HistoryTier> tiers_;
+  bool psram_{false};
+};
+
+/// All sensor histories, to look them up by their sensor.
+extern std::vector<SensorHistory *> global_sensor_histories;  // NOLINT
+
+}  // namespace sensor_history
+}  // namespace esphome
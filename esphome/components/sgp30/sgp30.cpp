@@ -1,5 +1,6 @@
 #include "sgp30.h"
 #include "esphome/core/log.h"
+#include "esphome/core/crc.h"
 #include "esphome/core/application.h"
 
 namespace esphome {
@@ -196,7 +197,7 @@ void SGP30Component::send_env_data_() {
   uint8_t humidity_dec = uint8_t(std::floor((absolute_humidity - std::floor(absolute_humidity)) * 256));
   ESP_LOGD(TAG, "Calculated Absolute humidity: %0.3f g/m³ (0x%04X)", absolute_humidity,
            uint16_t(uint16_t(humidity_full) << 8 | uint16_t(humidity_dec)));
-  uint8_t crc = sht_crc_(humidity_full, humidity_dec);
+  uint8_t crc = crc8_sensirion(uint16_t(humidity_full << 8 | humidity_dec));
   uint8_t data[4];
   data[0] = SGP30_CMD_SET_ABSOLUTE_HUMIDITY & 0xFF;
   data[1] = humidity_full;
@@ -212,10 +213,10 @@ void SGP30Component::write_iaq_baseline_(uint16_t eco2_baseline, uint16_t tvoc_b
   data[0] = SGP30_CMD_SET_IAQ_BASELINE & 0xFF;
   data[1] = tvoc_baseline >> 8;
   data[2] = tvoc_baseline & 0xFF;
-  data[3] = sht_crc_(data[1], data[2]);
+  data[3] = crc8_sensirion(&data[1], 2);
   data[4] = eco2_baseline >> 8;
   data[5] = eco2_baseline & 0xFF;
-  data[6] = sht_crc_(data[4], data[5]);
+  data[6] = crc8_sensirion(&data[4], 2);
   if (!this->write_bytes(SGP30_CMD_SET_IAQ_BASELINE >> 8, data, 7)) {
     ESP_LOGE(TAG, "Error applying eCO2 baseline: 0x%04X, TVOC baseline: 0x%04X", eco2_baseline, tvoc_baseline);
   } else
@@ -307,29 +308,6 @@ bool SGP30Component::write_command_(uint16_t command) {
   return this->write_byte(command >> 8, command & 0xFF);
 }
 
-uint8_t SGP30Component::sht_crc_(uint8_t data1, uint8_t data2) {
-  uint8_t bit;
-  uint8_t crc = 0xFF;
-
-  crc ^= data1;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  crc ^= data2;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  return crc;
-}
-
 bool SGP30Component::read_data_(uint16_t *data, uint8_t len) {
   const uint8_t num_bytes = len * 3;
   auto *buf = new uint8_t[num_bytes];
@@ -341,7 +319,7 @@ bool SGP30Component::read_data_(uint16_t *data, uint8_t len) {
 
   for (uint8_t i = 0; i < len; i++) {
     const uint8_t j = 3 * i;
-    uint8_t crc = sht_crc_(buf[j], buf[j + 1]);
+    uint8_t crc = crc8_sensirion(&buf[j], 2);
     if (crc != buf[j + 2]) {
       ESP_LOGE(TAG, "CRC8 Checksum invalid! 0x%02X != 0x%02X", buf[j + 2], crc);
       delete[](buf);
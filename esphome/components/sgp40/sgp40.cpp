@@ -1,4 +1,5 @@
 #include "esphome/core/log.h"
+#include "esphome/core/crc.h"
 #include "sgp40.h"
 
 namespace esphome {
@@ -177,11 +178,11 @@ uint16_t SGP40Component::measure_raw_() {
   uint16_t rhticks = llround((uint16_t)((humidity * 65535) / 100));
   command[2] = rhticks >> 8;
   command[3] = rhticks & 0xFF;
-  command[4] = generate_crc_(command + 2, 2);
+  command[4] = crc8_sensirion(command + 2, 2);
   uint16_t tempticks = (uint16_t)(((temperature + 45) * 65535) / 175);
   command[5] = tempticks >> 8;
   command[6] = tempticks & 0xFF;
-  command[7] = generate_crc_(command + 5, 2);
+  command[7] = crc8_sensirion(command + 5, 2);
 
   if (!this->write_bytes_raw(command, 8)) {
     this->status_set_warning();
@@ -199,22 +200,6 @@ uint16_t SGP40Component::measure_raw_() {
   return raw_data[0];
 }
 
-uint8_t SGP40Component::generate_crc_(const uint8_t *data, uint8_t datalen) {
-  // calculates 8-Bit checksum with given polynomial
-  uint8_t crc = SGP40_CRC8_INIT;
-
-  for (uint8_t i = 0; i < datalen; i++) {
-    crc ^= data[i];
-    for (uint8_t b = 0; b < 8; b++) {
-      if (crc & 0x80)
-        crc = (crc << 1) ^ SGP40_CRC8_POLYNOMIAL;
-      else
-        crc <<= 1;
-    }
-  }
-  return crc;
-}
-
 void SGP40Component::update() {
   this->seconds_since_last_store_ += this->update_interval_ / 1000;
 
@@ -267,29 +252,6 @@ bool SGP40Component::write_command_(uint16_t command) {
   return this->write_byte(command >> 8, command & 0xFF);
 }
 
-uint8_t SGP40Component::sht_crc_(uint8_t data1, uint8_t data2) {
-  uint8_t bit;
-  uint8_t crc = 0xFF;
-
-  crc ^= data1;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  crc ^= data2;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  return crc;
-}
-
 bool SGP40Component::read_data_(uint16_t *data, uint8_t len) {
   const uint8_t num_bytes = len * 3;
   std::vector<uint8_t> buf(num_bytes);
@@ -300,7 +262,7 @@ bool SGP40Component::read_data_(uint16_t *data, uint8_t len) {
 
   for (uint8_t i = 0; i < len; i++) {
     const uint8_t j = 3 * i;
-    uint8_t crc = sht_crc_(buf[j], buf[j + 1]);
+    uint8_t crc = crc8_sensirion(&buf[j], 2);
     if (crc != buf[j + 2]) {
       ESP_LOGE(TAG, "CRC8 Checksum invalid! 0x%02X != 0x%02X", buf[j + 2], crc);
       return false;
@@ -19,8 +19,6 @@ struct SGP40Baselines {
 
 // commands and constants
 static const uint8_t SGP40_FEATURESET = 0x0020;     ///< The required set for this library
-static const uint8_t SGP40_CRC8_POLYNOMIAL = 0x31;  ///< Seed for SGP40's CRC polynomial
-static const uint8_t SGP40_CRC8_INIT = 0xFF;        ///< Init value for CRC
 static const uint8_t SGP40_WORD_LEN = 2;            ///< 2 bytes per word
 
 // Commands
@@ -58,11 +56,9 @@ class SGP40Component : public PollingComponent, public sensor::Sensor, public i2
   bool read_data_(uint16_t *data, uint8_t len);
   int16_t sensirion_init_sensors_();
   int16_t sgp40_probe_();
-  uint8_t sht_crc_(uint8_t data1, uint8_t data2);
   uint64_t serial_number_;
   uint16_t featureset_;
   int32_t measure_voc_index_();
-  uint8_t generate_crc_(const uint8_t *data, uint8_t datalen);
   uint16_t measure_raw_();
   ESPPreferenceObject pref_;
   int32_t seconds_since_last_store_;
@@ -1,5 +1,6 @@
 #include "sht3xd.h"
 #include "esphome/core/log.h"
+#include "esphome/core/crc.h"
 
 namespace esphome {
 namespace sht3xd {
@@ -76,29 +77,6 @@ bool SHT3XDComponent::write_command_(uint16_t command) {
   return this->write_byte(command >> 8, command & 0xFF);
 }
 
-uint8_t sht_crc(uint8_t data1, uint8_t data2) {
-  uint8_t bit;
-  uint8_t crc = 0xFF;
-
-  crc ^= data1;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  crc ^= data2;
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80)
-      crc = (crc << 1) ^ 0x131;
-    else
-      crc = (crc << 1);
-  }
-
-  return crc;
-}
-
 bool SHT3XDComponent::read_data_(uint16_t *data, uint8_t len) {
   const uint8_t num_bytes = len * 3;
   auto *buf = new uint8_t[num_bytes];
@@ -110,7 +88,7 @@ bool SHT3XDComponent::read_data_(uint16_t *data, uint8_t len) {
 
   for (uint8_t i = 0; i < len; i++) {
     const uint8_t j = 3 * i;
-    uint8_t crc = sht_crc(buf[j], buf[j + 1]);
+    uint8_t crc = crc8_sensirion(&buf[j], 2);
     if (crc != buf[j + 2]) {
       ESP_LOGE(TAG, "CRC8 Checksum invalid! 0x%02X != 0x%02X", buf[j + 2], crc);
       delete[](buf);
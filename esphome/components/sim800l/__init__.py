@@ -1,7 +1,7 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import automation
-from esphome.const import CONF_ID, CONF_TRIGGER_ID
+from esphome.const import CONF_BAUD_RATE, CONF_ID, CONF_TRIGGER_ID
 from esphome.components import uart
 
 DEPENDENCIES = ["uart"]
@@ -15,12 +15,16 @@ Sim800LReceivedMessageTrigger = sim800l_ns.class_(
     "Sim800LReceivedMessageTrigger",
     automation.Trigger.template(cg.std_string, cg.std_string),
 )
+Sim800LIncomingCallTrigger = sim800l_ns.class_(
+    "Sim800LIncomingCallTrigger", automation.Trigger.template(cg.std_string)
+)
 
 # Actions
 Sim800LSendSmsAction = sim800l_ns.class_("Sim800LSendSmsAction", automation.Action)
 Sim800LDialAction = sim800l_ns.class_("Sim800LDialAction", automation.Action)
 
 CONF_ON_SMS_RECEIVED = "on_sms_received"
+CONF_ON_INCOMING_CALL = "on_incoming_call"
 CONF_RECIPIENT = "recipient"
 CONF_MESSAGE = "message"
 
@@ -35,6 +39,27 @@ CONFIG_SCHEMA = cv.All(
                     ),
                 }
             ),
+            cv.Optional(CONF_ON_INCOMING_CALL): automation.validate_automation(
+                {
+                    cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
+                        Sim800LIncomingCallTrigger
+                    ),
+                }
+            ),
+            # The modem starts at the baud rate of the UART and is switched with AT+IPR
+            cv.Optional(CONF_BAUD_RATE): cv.one_of(
+                1200,
+                2400,
+                4800,
+                9600,
+                19200,
+                38400,
+                57600,
+                115200,
+                230400,
+                460800,
+                int=True,
+            ),
         }
     )
     .extend(cv.polling_component_schema("5s"))
@@ -55,6 +80,13 @@ async def to_code(config):
         await automation.build_automation(
             trigger, [(cg.std_string, "message"), (cg.std_string, "sender")], conf
         )
+    for conf in config.get(CONF_ON_INCOMING_CALL, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(
+            trigger, [(cg.std_string, "caller_id")], conf
+        )
+    if CONF_BAUD_RATE in config:
+        cg.add(var.set_baud_rate(config[CONF_BAUD_RATE]))
 
 
 SIM800L_SEND_SMS_SCHEMA = cv.Schema(
@@ -9,281 +9,317 @@ static const char *const TAG = "sim800l";
 
 const char ASCII_CR = 0x0D;
 const char ASCII_LF = 0x0A;
+const char ASCII_CTRL_Z = 0x1A;
+const char ASCII_ESC = 0x1B;
 
-void Sim800LComponent::update() {
-  if (this->watch_dog_++ == 2) {
-    this->state_ = STATE_INIT;
-    this->write(26);
+/// After this many commands in a row timed out, the modem is initialized again.
+static const uint8_t MAX_FAILED_COMMANDS = 3;
+
+static bool starts_with(const std::string &str, const char *prefix) {
+  return str.compare(0, strlen(prefix), prefix) == 0;
+}
+
+/// The n-th (from 0) quoted field of a response line like `+CMGR: "REC UNREAD","+31628870634",...`.
+static std::string quoted_field(const std::string &line, uint8_t n) {
+  size_t start = line.find('"');
+  while (start != std::string::npos) {
+    const size_t end = line.find('"', start + 1);
+    if (end == std::string::npos)
+      break;
+    if (n-- == 0)
+      return line.substr(start + 1, end - start - 1);
+    start = line.find('"', end + 1);
   }
+  return "";
+}
+
+void Sim800LComponent::setup() { this->initial_baud_rate_ = this->parent_->get_baud_rate(); }
 
-  if (state_ == STATE_INIT) {
-    if (this->registered_ && this->send_pending_) {
-      this->send_cmd_("AT+CSCS=\"GSM\"");
-      this->state_ = STATE_SENDINGSMS1;
-    } else if (this->registered_ && this->dial_pending_) {
-      this->send_cmd_("AT+CSCS=\"GSM\"");
-      this->state_ = STATE_DIALING1;
-    } else {
-      this->send_cmd_("AT");
-      this->state_ = STATE_CHECK_AT;
+void Sim800LComponent::update() {
+  if (!this->initialized_) {
+    // Probe the modem, unless that is already underway
+    if (this->queue_.empty() || !this->queue_.front().init) {
+      this->queue_.push_front(Command{"AT", "", nullptr,
+                                      [this](bool ok) {
+                                        if (ok)
+                                          this->queue_setup_();
+                                      },
+                                      2000, true});
+      this->send_next_command_();
     }
-    this->expect_ack_ = true;
+    return;
   }
-  if (state_ == STATE_RECEIVEDSMS) {
-    // Serial Buffer should have flushed.
-    // Send cmd to delete received sms
-    char delete_cmd[20];
-    sprintf(delete_cmd, "AT+CMGD=%d", this->parse_index_);
-    this->send_cmd_(delete_cmd);
-    this->state_ = STATE_CHECK_SMS;
-    this->expect_ack_ = true;
+
+  this->queue_command_("AT+CREG?", nullptr, [this](const std::string &line) {
+    // Response: "+CREG: 0,1" -- the 1 (or 5 when roaming) means registered
+    if (!starts_with(line, "+CREG:"))
+      return;
+    const size_t comma = line.find(',');
+    const bool registered = comma != std::string::npos && (line[comma + 1] == '1' || line[comma + 1] == '5');
+    if (registered != this->registered_)
+      ESP_LOGD(TAG, registered ? "Registered OK" : "Registration Fail");
+    this->registered_ = registered;
+  });
+  this->queue_command_("AT+CSQ", nullptr, [this](const std::string &line) {
+    if (starts_with(line, "+CSQ:")) {
+      this->rssi_ = strtol(line.c_str() + 5, nullptr, 10);
+      ESP_LOGD(TAG, "RSSI: %d", this->rssi_);
+    }
+  });
+}
+
+void Sim800LComponent::queue_setup_() {
+  std::vector<Command> commands;
+  auto add = [&commands](const char *text) { commands.push_back(Command{text, "", nullptr, nullptr, 5000, true}); };
+  add("ATE0");
+  // Errors with a description
+  add("AT+CMEE=2");
+  // Text mode SMS with the GSM character set
+  add("AT+CMGF=1");
+  add("AT+CSCS=\"GSM\"");
+  // Store received SMS and notify with +CMTI
+  add("AT+CNMI=2,1,0,0,0");
+  // Report the number of callers with +CLIP
+  add("AT+CLIP=1");
+  if (this->baud_rate_ != 0 && this->baud_rate_ != this->parent_->get_baud_rate()) {
+    // The modem still answers at the old rate, then switches
+    commands.push_back(Command{"AT+IPR=" + to_string(this->baud_rate_), "", nullptr,
+                               [this](bool ok) {
+                                 if (ok)
+                                   this->parent_->update_baud_rate(this->baud_rate_);
+                               },
+                               5000, true});
   }
+  // Also checks that the modem answers at the new baud rate
+  commands.push_back(Command{"AT", "", nullptr,
+                             [this](bool ok) {
+                               if (ok)
+                                 this->on_initialized_();
+                             },
+                             5000, true});
+  this->queue_.insert(this->queue_.begin(), std::make_move_iterator(commands.begin()),
+                      std::make_move_iterator(commands.end()));
 }
 
-void Sim800LComponent::send_cmd_(const std::string &message) {
-  ESP_LOGV(TAG, "S: %s - %d", message.c_str(), this->state_);
-  this->watch_dog_ = 0;
-  this->write_str(message.c_str());
-  this->write_byte(ASCII_LF);
+void Sim800LComponent::on_initialized_() {
+  ESP_LOGD(TAG, "Modem initialized");
+  this->initialized_ = true;
+  // SMS that were received before, every new one is notified with +CMTI
+  this->queue_command_(
+      "AT+CMGL=\"ALL\"", [this](bool ok) { this->publish_received_sms_(); },
+      [this](const std::string &line) { this->parse_sms_line_(line, ""); }, 20000);
+  this->update();
 }
 
-void Sim800LComponent::parse_cmd_(std::string message) {
-  ESP_LOGV(TAG, "R: %s - %d", message.c_str(), this->state_);
+void Sim800LComponent::queue_command_(const std::string &text, std::function<void(bool)> &&on_done,
+                                      std::function<void(const std::string &)> &&on_line, uint32_t timeout) {
+  this->queue_.push_back(Command{text, "", std::move(on_line), std::move(on_done), timeout, false});
+  this->send_next_command_();
+}
 
-  if (message.empty())
+void Sim800LComponent::send_next_command_() {
+  if (this->command_active_ || this->queue_.empty())
+    return;
+  const Command &command = this->queue_.front();
+  // Commands other than the initialization wait for the modem
+  if (!this->initialized_ && !command.init)
     return;
+  ESP_LOGV(TAG, "S: %s", command.text.c_str());
+  this->write_str(command.text.c_str());
+  this->write_byte(ASCII_CR);
+  this->command_active_ = true;
+  this->prompt_answered_ = false;
+  this->command_sent_at_ = millis();
+}
 
-  if (this->expect_ack_) {
-    bool ok = message == "OK";
-    this->expect_ack_ = false;
-    if (!ok) {
-      if (this->state_ == STATE_CHECK_AT && message == "AT") {
-        // Expected ack but AT echo received
-        this->state_ = STATE_DISABLE_ECHO;
-        this->expect_ack_ = true;
-      } else {
-        ESP_LOGW(TAG, "Not ack. %d %s", this->state_, message.c_str());
-        this->state_ = STATE_IDLE;  // Let it timeout
-        return;
-      }
-    }
-  }
+void Sim800LComponent::finish_command_(bool ok) {
+  Command command = std::move(this->queue_.front());
+  this->queue_.pop_front();
+  this->command_active_ = false;
+  this->failed_commands_ = 0;
+  if (command.on_done)
+    command.on_done(ok);
+  this->send_next_command_();
+}
+
+void Sim800LComponent::handle_line_(const std::string &line) {
+  ESP_LOGV(TAG, "R: %s", line.c_str());
+  if (line.empty())
+    return;
 
-  switch (this->state_) {
-    case STATE_INIT: {
-      // While we were waiting for update to check for messages, this notifies a message
-      // is available.
-      bool message_available = message.compare(0, 6, "+CMTI:") == 0;
-      if (!message_available)
-        break;
-      // Else fall thru ...
+  if (this->command_active_) {
+    const Command &command = this->queue_.front();
+    if (line == "OK") {
+      this->finish_command_(true);
+      return;
     }
-    case STATE_CHECK_SMS:
-      send_cmd_("AT+CMGL=\"ALL\"");
-      this->state_ = STATE_PARSE_SMS;
-      this->parse_index_ = 0;
-      break;
-    case STATE_DISABLE_ECHO:
-      send_cmd_("ATE0");
-      this->state_ = STATE_CHECK_AT;
-      this->expect_ack_ = true;
-      break;
-    case STATE_CHECK_AT:
-      send_cmd_("AT+CMGF=1");
-      this->state_ = STATE_CREG;
-      this->expect_ack_ = true;
-      break;
-    case STATE_CREG:
-      send_cmd_("AT+CREG?");
-      this->state_ = STATE_CREGWAIT;
-      break;
-    case STATE_CREGWAIT: {
-      // Response: "+CREG: 0,1" -- the one there means registered ok
-      //           "+CREG: -,-" means not registered ok
-      bool registered = message.compare(0, 6, "+CREG:") == 0 && (message[9] == '1' || message[9] == '5');
-      if (registered) {
-        if (!this->registered_)
-          ESP_LOGD(TAG, "Registered OK");
-        this->state_ = STATE_CSQ;
-        this->expect_ack_ = true;
-      } else {
-        ESP_LOGW(TAG, "Registration Fail");
-        if (message[7] == '0') {  // Network registration is disable, enable it
-          send_cmd_("AT+CREG=1");
-          this->expect_ack_ = true;
-          this->state_ = STATE_CHECK_AT;
-        } else {
-          // Keep waiting registration
-          this->state_ = STATE_CREG;
-        }
-      }
-      this->registered_ = registered;
-      break;
+    if (line == "ERROR" || starts_with(line, "+CME ERROR:") || starts_with(line, "+CMS ERROR:")) {
+      ESP_LOGW(TAG, "%s failed: %s", command.text.c_str(), line.c_str());
+      this->finish_command_(false);
+      return;
     }
-    case STATE_CSQ:
-      send_cmd_("AT+CSQ");
-      this->state_ = STATE_CSQ_RESPONSE;
-      break;
-    case STATE_CSQ_RESPONSE:
-      if (message.compare(0, 5, "+CSQ:") == 0) {
-        size_t comma = message.find(',', 6);
-        if (comma != 6) {
-          this->rssi_ = strtol(message.substr(6, comma - 6).c_str(), nullptr, 10);
-          ESP_LOGD(TAG, "RSSI: %d", this->rssi_);
-        }
-      }
-      this->expect_ack_ = true;
-      this->state_ = STATE_CHECK_SMS;
-      break;
-    case STATE_PARSE_SMS:
-      this->state_ = STATE_PARSE_SMS_RESPONSE;
-      break;
-    case STATE_PARSE_SMS_RESPONSE:
-      if (message.compare(0, 6, "+CMGL:") == 0 && this->parse_index_ == 0) {
-        size_t start = 7;
-        size_t end = message.find(',', start);
-        uint8_t item = 0;
-        while (end != start) {
-          item++;
-          if (item == 1) {  // Slot Index
-            this->parse_index_ = strtol(message.substr(start, end - start).c_str(), nullptr, 10);
-          }
-          // item 2 = STATUS, usually "REC UNERAD"
-          if (item == 3) {  // recipient
-            // Add 1 and remove 2 from substring to get rid of "quotes"
-            this->sender_ = message.substr(start + 1, end - start - 2);
-            break;
-          }
-          // item 4 = ""
-          // item 5 = Received timestamp
-          start = end + 1;
-          end = message.find(',', start);
-        }
-
-        if (item < 2) {
-          ESP_LOGD(TAG, "Invalid message %d %s", this->state_, message.c_str());
-          return;
-        }
-        this->state_ = STATE_RECEIVESMS;
-      }
-      // Otherwise we receive another OK, we do nothing just wait polling to continuously check for SMS
-      if (message == "OK")
-        this->state_ = STATE_INIT;
-      break;
-    case STATE_RECEIVESMS:
-      /* Our recipient is set and the message body is in message
-        kick ESPHome callback now
-      */
-      ESP_LOGD(TAG, "Received SMS from: %s", this->sender_.c_str());
-      ESP_LOGD(TAG, "%s", message.c_str());
-      this->callback_.call(message, this->sender_);
-      /* If the message is multiline, next lines will contain message data.
-         If there were other messages in the list, next line will be +CMGL: ...
-         At the end of the list the new line and the OK should be received.
-         To keep this simple just first line of message if considered, then
-         the next state will swallow all received data and in next poll event
-         this message index is marked for deletion.
-      */
-      this->state_ = STATE_RECEIVEDSMS;
-      break;
-    case STATE_RECEIVEDSMS:
-      // Let the buffer flush. Next poll will request to delete the parsed index message.
-      break;
-    case STATE_SENDINGSMS1:
-      this->send_cmd_("AT+CMGS=\"" + this->recipient_ + "\"");
-      this->state_ = STATE_SENDINGSMS2;
-      break;
-    case STATE_SENDINGSMS2:
-      if (message == ">") {
-        // Send sms body
-        ESP_LOGD(TAG, "Sending message: '%s'", this->outgoing_message_.c_str());
-        this->write_str(this->outgoing_message_.c_str());
-        this->write(26);
-        this->state_ = STATE_SENDINGSMS3;
-      } else {
-        this->registered_ = false;
-        this->state_ = STATE_INIT;
-        this->send_cmd_("AT+CMEE=2");
-        this->write(26);
-      }
-      break;
-    case STATE_SENDINGSMS3:
-      if (message.compare(0, 6, "+CMGS:") == 0) {
-        ESP_LOGD(TAG, "SMS Sent OK: %s", message.c_str());
-        this->send_pending_ = false;
-        this->state_ = STATE_CHECK_SMS;
-        this->expect_ack_ = true;
-      }
-      break;
-    case STATE_DIALING1:
-      this->send_cmd_("ATD" + this->recipient_ + ';');
-      this->state_ = STATE_DIALING2;
-      break;
-    case STATE_DIALING2:
-      if (message == "OK") {
-        // Dialing
-        ESP_LOGD(TAG, "Dialing: '%s'", this->recipient_.c_str());
-        this->state_ = STATE_INIT;
-        this->dial_pending_ = false;
-      } else {
-        this->registered_ = false;
-        this->state_ = STATE_INIT;
-        this->send_cmd_("AT+CMEE=2");
-        this->write(26);
-      }
-      break;
-    default:
-      ESP_LOGD(TAG, "Unhandled: %s - %d", message.c_str(), this->state_);
-      break;
+    // Echo, until ATE0 took effect
+    if (line == command.text)
+      return;
+  }
+  // The text of an SMS could look like a result code
+  if (!this->in_sms_text_ && this->handle_urc_(line))
+    return;
+  if (this->command_active_ && this->queue_.front().on_line) {
+    this->queue_.front().on_line(line);
+    return;
   }
+  ESP_LOGD(TAG, "Unhandled: %s", line.c_str());
 }
 
-void Sim800LComponent::loop() {
-  // Read message
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
+bool Sim800LComponent::handle_urc_(const std::string &line) {
+  if (starts_with(line, "+CMTI:")) {
+    // +CMTI: "SM",3 -- a new SMS in slot 3
+    const size_t comma = line.rfind(',');
+    if (comma != std::string::npos)
+      this->read_sms_(line.substr(comma + 1));
+    return true;
+  }
+  if (line == "RING") {
+    ESP_LOGD(TAG, "Incoming call");
+    return true;
+  }
+  if (starts_with(line, "+CLIP:")) {
+    const std::string caller_id = quoted_field(line, 0);
+    ESP_LOGD(TAG, "Call from %s", caller_id.c_str());
+    this->incoming_call_callback_.call(caller_id);
+    return true;
+  }
+  if (line == "NO CARRIER" || line == "BUSY" || line == "NO ANSWER" || line == "NO DIALTONE") {
+    ESP_LOGD(TAG, "Call ended: %s", line.c_str());
+    return true;
+  }
+  if (line == "RDY") {
+    // The modem restarted
+    ESP_LOGW(TAG, "Modem restarted");
+    this->initialized_ = false;
+    this->registered_ = false;
+    return true;
+  }
+  if (line == "Call Ready" || line == "SMS Ready" || starts_with(line, "+CFUN:") || starts_with(line, "+CPIN:")) {
+    ESP_LOGD(TAG, "%s", line.c_str());
+    return true;
+  }
+  return false;
+}
 
-    if (this->read_pos_ == SIM800L_READ_BUFFER_LENGTH)
-      this->read_pos_ = 0;
+void Sim800LComponent::read_sms_(const std::string &index) {
+  this->queue_command_(
+      "AT+CMGR=" + index, [this](bool ok) { this->publish_received_sms_(); },
+      [this, index](const std::string &line) { this->parse_sms_line_(line, index); });
+}
 
-    ESP_LOGVV(TAG, "Buffer pos: %u %d", this->read_pos_, byte);  // NOLINT
+void Sim800LComponent::parse_sms_line_(const std::string &line, const std::string &index) {
+  // +CMGR: "REC UNREAD","+31628870634","","21/01/01,12:00:00+04"
+  // +CMGL: 1,"REC UNREAD","+31628870634","","21/01/01,12:00:00+04"
+  const bool cmgr = starts_with(line, "+CMGR:");
+  if (cmgr || starts_with(line, "+CMGL:")) {
+    ReceivedSms sms;
+    sms.index = cmgr ? index : to_string(strtol(line.c_str() + 6, nullptr, 10));
+    sms.sender = quoted_field(line, 1);
+    this->received_.push_back(std::move(sms));
+    this->in_sms_text_ = true;
+    return;
+  }
+  if (!this->in_sms_text_)
+    return;
+  std::string &message = this->received_.back().message;
+  if (!message.empty())
+    message += '\n';
+  message += line;
+}
 
-    if (byte == ASCII_CR)
-      continue;
-    if (byte >= 0x7F)
-      byte = '?';  // need to be valid utf8 string for log functions.
-    this->read_buffer_[this->read_pos_] = byte;
+void Sim800LComponent::publish_received_sms_() {
+  this->in_sms_text_ = false;
+  std::vector<ReceivedSms> received;
+  received.swap(this->received_);
+  for (auto &sms : received) {
+    ESP_LOGD(TAG, "Received SMS from: %s", sms.sender.c_str());
+    ESP_LOGD(TAG, "%s", sms.message.c_str());
+    this->callback_.call(sms.message, sms.sender);
+    this->queue_command_("AT+CMGD=" + sms.index);
+  }
+}
 
-    if (this->state_ == STATE_SENDINGSMS2 && this->read_pos_ == 0 && byte == '>')
-      this->read_buffer_[++this->read_pos_] = ASCII_LF;
+void Sim800LComponent::loop() {
+  const uint8_t *data;
+  size_t length;
+  while ((length = this->read_buffer(&data)) != 0) {
+    for (size_t i = 0; i < length; i++) {
+      char byte = data[i];
+      if (byte == ASCII_CR)
+        continue;
+      if (byte == ASCII_LF) {
+        this->read_buffer_[this->read_pos_] = 0;
+        this->read_pos_ = 0;
+        this->handle_line_(this->read_buffer_);
+        continue;
+      }
+      // The prompt for the text of AT+CMGS is not terminated by a newline
+      if (byte == '>' && this->read_pos_ == 0 && this->command_active_ && !this->prompt_answered_ &&
+          !this->queue_.front().data.empty()) {
+        const std::string &text = this->queue_.front().data;
+        ESP_LOGD(TAG, "Sending message: '%s'", text.c_str());
+        this->write_str(text.c_str());
+        this->write_byte(ASCII_CTRL_Z);
+        this->prompt_answered_ = true;
+        continue;
+      }
+      if (uint8_t(byte) >= 0x7F)
+        byte = '?';  // need to be valid utf8 string for log functions.
+      if (this->read_pos_ < SIM800L_READ_BUFFER_LENGTH - 1)
+        this->read_buffer_[this->read_pos_++] = byte;
+    }
+  }
 
-    if (this->read_buffer_[this->read_pos_] == ASCII_LF) {
-      this->read_buffer_[this->read_pos_] = 0;
-      this->read_pos_ = 0;
-      this->parse_cmd_(this->read_buffer_);
-    } else {
-      this->read_pos_++;
+  if (this->command_active_ && millis() - this->command_sent_at_ > this->queue_.front().timeout) {
+    const Command &command = this->queue_.front();
+    ESP_LOGW(TAG, "%s timed out", command.text.c_str());
+    if (!command.data.empty() && !this->prompt_answered_)
+      this->write_byte(ASCII_ESC);  // Leave the prompt
+    const uint8_t failed = this->failed_commands_ + 1;
+    this->in_sms_text_ = false;
+    this->finish_command_(false);
+    this->failed_commands_ = failed;
+    if (failed >= MAX_FAILED_COMMANDS && this->initialized_) {
+      ESP_LOGW(TAG, "Modem doesn't respond, initializing it again");
+      this->initialized_ = false;
+      this->registered_ = false;
+      // A restarted modem is back at the rate of the UART
+      if (this->parent_->get_baud_rate() != this->initial_baud_rate_)
+        this->parent_->update_baud_rate(this->initial_baud_rate_);
     }
   }
 }
 
 void Sim800LComponent::send_sms(const std::string &recipient, const std::string &message) {
   ESP_LOGD(TAG, "Sending to %s: %s", recipient.c_str(), message.c_str());
-  this->recipient_ = recipient;
-  this->outgoing_message_ = message;
-  this->send_pending_ = true;
-  this->update();
+  this->queue_.push_back(Command{"AT+CMGS=\"" + recipient + "\"", message,
+                                 [](const std::string &line) {
+                                   if (starts_with(line, "+CMGS:"))
+                                     ESP_LOGD(TAG, "SMS Sent OK: %s", line.c_str());
+                                 },
+                                 nullptr, 60000, false});
+  this->send_next_command_();
 }
 void Sim800LComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "SIM800L:");
+  if (this->baud_rate_ != 0)
+    ESP_LOGCONFIG(TAG, "  Baud Rate: %u", this->baud_rate_);
   ESP_LOGCONFIG(TAG, "  RSSI: %d dB", this->rssi_);
+  LOG_UPDATE_INTERVAL(this);
 }
 void Sim800LComponent::dial(const std::string &recipient) {
   ESP_LOGD(TAG, "Dialing %s", recipient.c_str());
-  this->recipient_ = recipient;
-  this->dial_pending_ = true;
-  this->update();
+  this->queue_command_("ATD" + recipient + ';', [recipient](bool ok) {
+    if (ok)
+      ESP_LOGD(TAG, "Dialing: '%s'", recipient.c_str());
+  });
 }
 
 }  // namespace sim800l
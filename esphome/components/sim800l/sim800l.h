@@ -1,6 +1,8 @@
 #pragma once
 
+#include <deque>
 #include <utility>
+#include <vector>
 
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
@@ -11,63 +13,90 @@ namespace sim800l {
 
 const uint8_t SIM800L_READ_BUFFER_LENGTH = 255;
 
-enum State {
-  STATE_IDLE = 0,
-  STATE_INIT,
-  STATE_CHECK_AT,
-  STATE_CREG,
-  STATE_CREGWAIT,
-  STATE_CSQ,
-  STATE_CSQ_RESPONSE,
-  STATE_IDLEWAIT,
-  STATE_SENDINGSMS1,
-  STATE_SENDINGSMS2,
-  STATE_SENDINGSMS3,
-  STATE_CHECK_SMS,
-  STATE_PARSE_SMS,
-  STATE_PARSE_SMS_RESPONSE,
-  STATE_RECEIVESMS,
-  STATE_READSMS,
-  STATE_RECEIVEDSMS,
-  STATE_DELETEDSMS,
-  STATE_DISABLE_ECHO,
-  STATE_PARSE_SMS_OK,
-  STATE_DIALING1,
-  STATE_DIALING2
-};
-
+/** SIM800L GSM modem, sends and receives SMS and dials.
+ *
+ * AT commands are sent from a queue, each when the previous one has its final result (OK or an error). The
+ * lines received meanwhile are its response, except for unsolicited result codes like +CMTI (a new SMS) and
+ * RING, which are handled as they arrive. Received SMS are read from the +CMTI notification, update() only
+ * checks the network registration and signal strength.
+ */
 class Sim800LComponent : public uart::UARTDevice, public PollingComponent {
  public:
-  /// Retrieve the latest sensor values. This operation takes approximately 16ms.
+  void setup() override;
+  /// Check the network registration and signal strength, and initialize the modem if it stopped responding.
   void update() override;
   void loop() override;
   void dump_config() override;
+  /// Switch the modem and the UART to this baud rate once the modem responds, 0 keeps the rate of the UART.
+  void set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
   void add_on_sms_received_callback(std::function<void(std::string, std::string)> callback) {
     this->callback_.add(std::move(callback));
   }
+  /// Called with the number of the caller on every ring of an incoming call.
+  void add_on_incoming_call_callback(std::function<void(std::string)> callback) {
+    this->incoming_call_callback_.add(std::move(callback));
+  }
   void send_sms(const std::string &recipient, const std::string &message);
   void dial(const std::string &recipient);
 
  protected:
-  void send_cmd_(const std::string &);
-  void parse_cmd_(std::string);
+  struct Command {
+    std::string text;
+    /// Sent after the "> " prompt of the modem and terminated with Ctrl-Z, the text of AT+CMGS.
+    std::string data;
+    /// Called with each line of the response before the final result.
+    std::function<void(const std::string &)> on_line;
+    /// Called with the final result, true for OK.
+    std::function<void(bool)> on_done;
+    uint32_t timeout;
+    /// Part of the initialization, sent before the other commands, which wait until the modem is initialized.
+    bool init;
+  };
+
+  void queue_command_(const std::string &text, std::function<void(bool)> &&on_done = nullptr,
+                      std::function<void(const std::string &)> &&on_line = nullptr, uint32_t timeout = 5000);
+  /// Queue the commands that set up the modem once it responds to AT.
+  void queue_setup_();
+  /// The last setup command succeeded, send the queued commands and read the stored SMS.
+  void on_initialized_();
+  void send_next_command_();
+  void finish_command_(bool ok);
+  void handle_line_(const std::string &line);
+  /// Handle an unsolicited result code, false if the line is none.
+  bool handle_urc_(const std::string &line);
+  /// Read the SMS in the given storage slot, publish and delete it.
+  void read_sms_(const std::string &index);
+  /// A line of the response of AT+CMGR or AT+CMGL, the header of an SMS or its text.
+  void parse_sms_line_(const std::string &line, const std::string &index);
+  void publish_received_sms_();
+
+  std::deque<Command> queue_;
+  /// The command at the front of the queue was sent and waits for its final result.
+  bool command_active_{false};
+  bool prompt_answered_{false};
+  uint32_t command_sent_at_{0};
+  uint8_t failed_commands_{0};
+  bool initialized_{false};
 
-  std::string sender_;
   char read_buffer_[SIM800L_READ_BUFFER_LENGTH];
   size_t read_pos_{0};
-  uint8_t parse_index_{0};
-  uint8_t watch_dog_{0};
-  bool expect_ack_{false};
-  sim800l::State state_{STATE_IDLE};
+  uint32_t baud_rate_{0};
+  uint32_t initial_baud_rate_{0};
   bool registered_{false};
   int rssi_{0};
 
-  std::string recipient_;
-  std::string outgoing_message_;
-  bool send_pending_;
-  bool dial_pending_;
+  struct ReceivedSms {
+    std::string index;
+    std::string sender;
+    std::string message;
+  };
+  /// The SMS of the current AT+CMGR/AT+CMGL response.
+  std::vector<ReceivedSms> received_;
+  /// The next lines are the text of the last SMS in received_.
+  bool in_sms_text_{false};
 
   CallbackManager<void(std::string, std::string)> callback_;
+  CallbackManager<void(std::string)> incoming_call_callback_;
 };
 
 class Sim800LReceivedMessageTrigger : public Trigger<std::string, std::string> {
@@ -78,13 +107,20 @@ class Sim800LReceivedMessageTrigger : public Trigger<std::string, std::string> {
   }
 };
 
+class Sim800LIncomingCallTrigger : public Trigger<std::string> {
+ public:
+  explicit Sim800LIncomingCallTrigger(Sim800LComponent *parent) {
+    parent->add_on_incoming_call_callback([this](std::string caller_id) { this->trigger(std::move(caller_id)); });
+  }
+};
+
 template<typename... Ts> class Sim800LSendSmsAction : public Action<Ts...> {
  public:
   Sim800LSendSmsAction(Sim800LComponent *parent) : parent_(parent) {}
   TEMPLATABLE_VALUE(std::string, recipient)
   TEMPLATABLE_VALUE(std::string, message)
 
-  void play(Ts... x) {
+  void play(const Ts &... x) {
     auto recipient = this->recipient_.value(x...);
     auto message = this->message_.value(x...);
     this->parent_->send_sms(recipient, message);
@@ -99,7 +135,7 @@ template<typename... Ts> class Sim800LDialAction : public Action<Ts...> {
   Sim800LDialAction(Sim800LComponent *parent) : parent_(parent) {}
   TEMPLATABLE_VALUE(std::string, recipient)
 
-  void play(Ts... x) {
+  void play(const Ts &... x) {
     auto recipient = this->recipient_.value(x...);
     this->parent_->dial(recipient);
   }
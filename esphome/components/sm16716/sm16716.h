@@ -49,7 +49,11 @@ class SM16716 : public Component {
     this->pwm_amounts_[index] = value;
   }
   void write_bit_(bool value) {
-    this->data_pin_->digital_write(value);
+    // The data line often stays at the same level for many bits (the reset frame, dark channels)
+    if (value != this->data_level_) {
+      this->data_pin_->digital_write(value);
+      this->data_level_ = value;
+    }
     this->clock_pin_->digital_write(true);
     this->clock_pin_->digital_write(false);
   }
@@ -64,6 +68,7 @@ class SM16716 : public Component {
   uint8_t num_channels_;
   uint8_t num_chips_;
   std::vector<uint8_t> pwm_amounts_;
+  bool data_level_{false};
   bool update_{true};
 };
 
@@ -1,12 +1,15 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
+from esphome.components import spi
 from esphome.const import (
     CONF_ID,
+    CONF_SPI_ID,
     CONF_NUMBER,
     CONF_INVERTED,
     CONF_DATA_PIN,
     CONF_CLOCK_PIN,
+    CONF_TYPE,
 )
 
 DEPENDENCIES = []
@@ -15,31 +18,67 @@ MULTI_CONF = True
 sn74hc595_ns = cg.esphome_ns.namespace("sn74hc595")
 
 SN74HC595Component = sn74hc595_ns.class_("SN74HC595Component", cg.Component)
+SN74HC595SPIComponent = sn74hc595_ns.class_(
+    "SN74HC595SPIComponent", SN74HC595Component, spi.SPIDevice
+)
 SN74HC595GPIOPin = sn74hc595_ns.class_("SN74HC595GPIOPin", cg.GPIOPin)
 
 CONF_SN74HC595 = "sn74hc595"
 CONF_LATCH_PIN = "latch_pin"
 CONF_OE_PIN = "oe_pin"
 CONF_SR_COUNT = "sr_count"
-CONFIG_SCHEMA = cv.Schema(
+TYPE_GPIO = "gpio"
+TYPE_SPI = "spi"
+
+_COMMON_SCHEMA = cv.Schema(
     {
-        cv.Required(CONF_ID): cv.declare_id(SN74HC595Component),
-        cv.Required(CONF_DATA_PIN): pins.gpio_output_pin_schema,
-        cv.Required(CONF_CLOCK_PIN): pins.gpio_output_pin_schema,
         cv.Required(CONF_LATCH_PIN): pins.gpio_output_pin_schema,
         cv.Optional(CONF_OE_PIN): pins.gpio_output_pin_schema,
         cv.Optional(CONF_SR_COUNT, default=1): cv.int_range(1, 4),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
+CONFIG_SCHEMA = cv.typed_schema(
+    {
+        TYPE_GPIO: _COMMON_SCHEMA.extend(
+            {
+                cv.Required(CONF_ID): cv.declare_id(SN74HC595Component),
+                cv.Required(CONF_DATA_PIN): pins.gpio_output_pin_schema,
+                cv.Required(CONF_CLOCK_PIN): pins.gpio_output_pin_schema,
+            }
+        ),
+        TYPE_SPI: _COMMON_SCHEMA.extend(
+            {
+                cv.Required(CONF_ID): cv.declare_id(SN74HC595SPIComponent),
+            }
+        ).extend(spi.spi_device_schema(cs_pin_required=False)),
+    },
+    default_type=TYPE_GPIO,
+    lower=True,
+)
+
+
+def _final_validate(config):
+    if config[CONF_TYPE] == TYPE_SPI:
+        spi.final_validate_device_schema(
+            "sn74hc595", require_mosi=True, require_miso=False
+        )(config)
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
-    data_pin = await cg.gpio_pin_expression(config[CONF_DATA_PIN])
-    cg.add(var.set_data_pin(data_pin))
-    clock_pin = await cg.gpio_pin_expression(config[CONF_CLOCK_PIN])
-    cg.add(var.set_clock_pin(clock_pin))
+    if config[CONF_TYPE] == TYPE_SPI:
+        await spi.register_spi_device(var, config)
+    else:
+        data_pin = await cg.gpio_pin_expression(config[CONF_DATA_PIN])
+        cg.add(var.set_data_pin(data_pin))
+        clock_pin = await cg.gpio_pin_expression(config[CONF_CLOCK_PIN])
+        cg.add(var.set_clock_pin(clock_pin))
     latch_pin = await cg.gpio_pin_expression(config[CONF_LATCH_PIN])
     cg.add(var.set_latch_pin(latch_pin))
     if CONF_OE_PIN in config:
@@ -14,39 +14,66 @@ void SN74HC595Component::setup() {
     this->oe_pin_->digital_write(true);
   }
 
-  // initialize output pins
-  this->clock_pin_->pin_mode(OUTPUT);
-  this->data_pin_->pin_mode(OUTPUT);
+  // initialize output pins, data and clock are driven by the SPI bus in SPI mode
+  if (this->data_pin_ != nullptr) {
+    this->clock_pin_->pin_mode(OUTPUT);
+    this->data_pin_->pin_mode(OUTPUT);
+    this->clock_pin_->digital_write(LOW);
+    this->data_pin_->digital_write(LOW);
+  }
   this->latch_pin_->pin_mode(OUTPUT);
-  this->clock_pin_->digital_write(LOW);
-  this->data_pin_->digital_write(LOW);
   this->latch_pin_->digital_write(LOW);
 
   // send state to shift register
   this->write_gpio_();
 }
 
-void SN74HC595Component::dump_config() { ESP_LOGCONFIG(TAG, "SN74HC595:"); }
+void SN74HC595Component::loop() {
+  if (this->dirty_)
+    this->write_gpio_();
+  this->disable_loop();
+}
+
+void SN74HC595Component::dump_config() {
+  ESP_LOGCONFIG(TAG, "SN74HC595:");
+  LOG_PIN("  Data Pin: ", this->data_pin_);
+  LOG_PIN("  Clock Pin: ", this->clock_pin_);
+  LOG_PIN("  Latch Pin: ", this->latch_pin_);
+  ESP_LOGCONFIG(TAG, "  Shift registers: %u", this->sr_count_);
+}
 
 bool SN74HC595Component::digital_read_(uint8_t pin) { return this->output_bits_ >> pin; }
 
 void SN74HC595Component::digital_write_(uint8_t pin, bool value) {
   uint32_t mask = 1UL << pin;
-  this->output_bits_ &= ~mask;
+  uint32_t bits = this->output_bits_ & ~mask;
   if (value)
-    this->output_bits_ |= mask;
-  this->write_gpio_();
+    bits |= mask;
+  if (bits == this->output_bits_)
+    return;
+  this->output_bits_ = bits;
+
+  // All writes until the next loop() are shifted out together
+  this->dirty_ = true;
+  this->enable_loop();
 }
 
-bool SN74HC595Component::write_gpio_() {
-  for (int i = this->sr_count_ - 1; i >= 0; i--) {
-    uint8_t data = (uint8_t)(this->output_bits_ >> (8 * i) & 0xff);
+void SN74HC595Component::write_bytes_(const uint8_t *data, uint8_t len) {
+  for (uint8_t i = 0; i < len; i++) {
     for (int j = 0; j < 8; j++) {
-      this->data_pin_->digital_write(data & (1 << (7 - j)));
+      this->data_pin_->digital_write(data[i] & (1 << (7 - j)));
       this->clock_pin_->digital_write(true);
       this->clock_pin_->digital_write(false);
     }
   }
+}
+
+bool SN74HC595Component::write_gpio_() {
+  uint8_t data[4];
+  for (uint8_t i = 0; i < this->sr_count_; i++)
+    data[i] = uint8_t(this->output_bits_ >> (8 * (this->sr_count_ - 1 - i)));
+  this->write_bytes_(data, this->sr_count_);
+  this->dirty_ = false;
 
   // pulse latch to activate new values
   this->latch_pin_->digital_write(true);
@@ -62,6 +89,25 @@ bool SN74HC595Component::write_gpio_() {
 
 float SN74HC595Component::get_setup_priority() const { return setup_priority::IO; }
 
+#ifdef USE_SPI
+void SN74HC595SPIComponent::setup() {
+  this->spi_setup();
+  SN74HC595Component::setup();
+}
+
+void SN74HC595SPIComponent::dump_config() {
+  SN74HC595Component::dump_config();
+  ESP_LOGCONFIG(TAG, "  Mode: SPI");
+}
+
+void SN74HC595SPIComponent::write_bytes_(const uint8_t *data, uint8_t len) {
+  // No chip select, the bytes take effect with the latch pulse
+  this->enable();
+  this->write_array(data, len);
+  this->disable();
+}
+#endif
+
 void SN74HC595GPIOPin::setup() {}
 
 bool SN74HC595GPIOPin::digital_read() { return this->parent_->digital_read_(this->pin_) != this->inverted_; }
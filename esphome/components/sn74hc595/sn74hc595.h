@@ -2,6 +2,11 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/esphal.h"
+#include "esphome/core/defines.h"
+
+#ifdef USE_SPI
+#include "esphome/components/spi/spi.h"
+#endif
 
 namespace esphome {
 namespace sn74hc595 {
@@ -11,6 +16,8 @@ class SN74HC595Component : public Component {
   SN74HC595Component() = default;
 
   void setup() override;
+  /// Shift out the pin changes of the last loop iteration at once, then sleep until the next change.
+  void loop() override;
   float get_setup_priority() const override;
   void dump_config() override;
 
@@ -28,15 +35,33 @@ class SN74HC595Component : public Component {
   bool digital_read_(uint8_t pin);
   void digital_write_(uint8_t pin, bool value);
   bool write_gpio_();
+  /// Shift out the bytes for the last register in the chain first, without latching them.
+  virtual void write_bytes_(const uint8_t *data, uint8_t len);
 
-  GPIOPin *data_pin_;
-  GPIOPin *clock_pin_;
+  GPIOPin *data_pin_{nullptr};
+  GPIOPin *clock_pin_{nullptr};
   GPIOPin *latch_pin_;
   GPIOPin *oe_pin_;
   uint8_t sr_count_;
   bool have_oe_pin_{false};
   uint32_t output_bits_{0x00};
+  /// Whether output_bits_ changed since they were last shifted out
+  bool dirty_{false};
+};
+
+#ifdef USE_SPI
+/// A SN74HC595 chain connected to the MOSI and CLK pins of a (hardware) SPI bus, latched after each transfer.
+class SN74HC595SPIComponent : public SN74HC595Component,
+                              public spi::SPIDevice<spi::BIT_ORDER_MSB_FIRST, spi::CLOCK_POLARITY_LOW,
+                                                    spi::CLOCK_PHASE_LEADING, spi::DATA_RATE_4MHZ> {
+ public:
+  void setup() override;
+  void dump_config() override;
+
+ protected:
+  void write_bytes_(const uint8_t *data, uint8_t len) override;
 };
+#endif
 
 /// Helper class to expose a SC74HC595 pin as an internal output GPIO pin.
 class SN74HC595GPIOPin : public GPIOPin {
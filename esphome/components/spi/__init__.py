@@ -18,6 +18,8 @@ SPIComponent = spi_ns.class_("SPIComponent", cg.Component)
 SPIDevice = spi_ns.class_("SPIDevice")
 MULTI_CONF = True
 
+CONF_USE_DMA = "use_dma"
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -25,6 +27,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_CLK_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_MISO_PIN): pins.gpio_input_pin_schema,
             cv.Optional(CONF_MOSI_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_USE_DMA): cv.All(cv.only_on_esp32, cv.boolean),
         }
     ),
     cv.has_at_least_one_key(CONF_MISO_PIN, CONF_MOSI_PIN),
@@ -34,6 +37,7 @@ CONFIG_SCHEMA = cv.All(
 @coroutine_with_priority(1.0)
 async def to_code(config):
     cg.add_global(spi_ns.using)
+    cg.add_define("USE_SPI")
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
@@ -45,6 +49,9 @@ async def to_code(config):
     if CONF_MOSI_PIN in config:
         mosi = await cg.gpio_pin_expression(config[CONF_MOSI_PIN])
         cg.add(var.set_mosi(mosi))
+    if config.get(CONF_USE_DMA, False):
+        cg.add_define("USE_SPI_DMA")
+        cg.add(var.set_use_dma(True))
 
 
 def spi_device_schema(cs_pin_required=True):
@@ -2,6 +2,12 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
+#include <algorithm>
+
+#ifdef USE_SPI_DMA
+#include <esp_heap_caps.h>
+#include <soc/soc_memory_layout.h>
+#endif
 
 namespace esphome {
 namespace spi {
@@ -9,6 +15,14 @@ namespace spi {
 static const char *const TAG = "spi";
 
 void ICACHE_RAM_ATTR HOT SPIComponent::disable() {
+#ifdef USE_SPI_DMA
+  this->dma_device_ = nullptr;
+  if (this->dma_busy_()) {
+    // Keep the chip selected until the queued writes are out, see collect_dma_writes_()
+    this->dma_release_pending_ = true;
+    return;
+  }
+#endif
   if (this->hw_spi_ != nullptr) {
     this->hw_spi_->endTransaction();
   }
@@ -57,6 +71,31 @@ void SPIComponent::setup() {
     use_hw_spi = false;
   }
 
+#ifdef USE_SPI_DMA
+  if (use_hw_spi && this->use_dma_) {
+    spi_bus_config_t config = {};
+    config.mosi_io_num = mosi_pin;
+    config.miso_io_num = miso_pin;
+    config.sclk_io_num = clk_pin;
+    config.quadwp_io_num = -1;
+    config.quadhd_io_num = -1;
+    config.max_transfer_sz = SPI_DMA_MAX_TRANSFER;
+    this->dma_host_ = spi_bus_num == 0 ? VSPI_HOST : HSPI_HOST;
+    // DMA channels are numbered from 1
+    esp_err_t err = spi_bus_initialize(this->dma_host_, &config, spi_bus_num + 1);
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Initializing the SPI bus for DMA failed: %d", err);
+      this->mark_failed();
+      return;
+    }
+    spi_bus_num++;
+    this->dma_host_ready_ = true;
+    // Only woken up by queued writes
+    this->disable_loop();
+    return;
+  }
+#endif
+
   if (use_hw_spi) {
     if (spi_bus_num == 0) {
       this->hw_spi_ = &SPI;
@@ -83,9 +122,174 @@ void SPIComponent::dump_config() {
   LOG_PIN("  MISO Pin: ", this->miso_);
   LOG_PIN("  MOSI Pin: ", this->mosi_);
   ESP_LOGCONFIG(TAG, "  Using HW SPI: %s", YESNO(this->hw_spi_ != nullptr));
+#ifdef USE_SPI_DMA
+  ESP_LOGCONFIG(TAG, "  Using DMA: %s", YESNO(this->dma_host_ready_));
+#endif
 }
 float SPIComponent::get_setup_priority() const { return setup_priority::BUS; }
 
+#ifdef USE_SPI_DMA
+void SPIComponent::loop() {
+  this->collect_dma_writes_(false);
+  if (!this->dma_busy_())
+    this->disable_loop();
+}
+
+spi_device_handle_t SPIComponent::dma_device_for_(uint8_t mode, uint32_t data_rate, bool lsb_first) {
+  for (auto &device : this->dma_devices_) {
+    if (device.mode == mode && device.data_rate == data_rate && device.lsb_first == lsb_first)
+      return device.handle;
+  }
+
+  spi_device_interface_config_t config = {};
+  config.mode = mode;
+  config.clock_speed_hz = data_rate;
+  // Chip selects are GPIOPins driven by enable()/disable()
+  config.spics_io_num = -1;
+  config.queue_size = SPI_DMA_QUEUE_SIZE;
+  if (lsb_first)
+    config.flags |= SPI_DEVICE_TXBIT_LSBFIRST | SPI_DEVICE_RXBIT_LSBFIRST;
+  // Write-only buses don't need full duplex, which limits the clock when routed through the GPIO matrix
+  if (this->miso_ == nullptr)
+    config.flags |= SPI_DEVICE_HALFDUPLEX;
+  spi_device_handle_t handle;
+  esp_err_t err = spi_bus_add_device(this->dma_host_, &config, &handle);
+  if (err != ESP_OK) {
+    // The driver supports three devices per bus; each used combination of mode and data rate is one
+    ESP_LOGE(TAG, "Adding an SPI DMA device (mode %u, %u Hz) failed: %d", mode, data_rate, err);
+    this->mark_failed();
+    return nullptr;
+  }
+  this->dma_devices_.push_back(DMADevice{mode, data_rate, lsb_first, handle});
+  return handle;
+}
+
+void SPIComponent::dma_transfer_(const uint8_t *tx, uint8_t *rx, size_t length) {
+  // Keep the order with writes queued earlier in this transaction
+  this->collect_dma_writes_(true);
+  while (length > 0) {
+    size_t chunk = std::min(length, SPI_DMA_MAX_TRANSFER);
+    spi_transaction_t transaction = {};
+    if (chunk <= sizeof(transaction.tx_data)) {
+      // Short transfers go through the transaction itself, which needs no DMA-capable buffer
+      transaction.flags = SPI_TRANS_USE_TXDATA;
+      if (tx != nullptr)
+        memcpy(transaction.tx_data, tx, chunk);
+      if (rx != nullptr)
+        transaction.flags |= SPI_TRANS_USE_RXDATA;
+    } else {
+      if (tx != nullptr) {
+        // Nothing is queued anymore, so the first bounce buffer is free
+        transaction.tx_buffer = this->dma_tx_buffer_(0, tx, &chunk);
+        if (transaction.tx_buffer == nullptr)
+          return;
+      }
+      transaction.rx_buffer = rx;
+    }
+    transaction.length = chunk * 8;
+    if (rx != nullptr)
+      transaction.rxlength = chunk * 8;
+    esp_err_t err = spi_device_transmit(this->dma_device_, &transaction);
+    if (err != ESP_OK) {
+      ESP_LOGW(TAG, "SPI DMA transfer failed: %d", err);
+      return;
+    }
+    if (rx != nullptr && (transaction.flags & SPI_TRANS_USE_RXDATA)) {
+      memcpy(rx, transaction.rx_data, chunk);
+    }
+
+    length -= chunk;
+    if (tx != nullptr)
+      tx += chunk;
+    if (rx != nullptr)
+      rx += chunk;
+  }
+}
+
+void SPIComponent::dma_write16_(const uint16_t *data, size_t length) {
+  uint8_t buffer[64];
+  while (length > 0) {
+    const size_t count = std::min(length, sizeof(buffer) / 2);
+    for (size_t i = 0; i < count; i++) {
+      buffer[i * 2] = data[i] >> 8;
+      buffer[i * 2 + 1] = data[i];
+    }
+    this->dma_transfer_(buffer, nullptr, count * 2);
+    data += count;
+    length -= count;
+  }
+}
+
+void SPIComponent::queue_dma_write_(const uint8_t *data, size_t length) {
+  if (length == 0)
+    return;
+  this->dma_write_device_ = this->dma_device_;
+  this->dma_writes_.push_back(DMAWrite{data, length});
+  this->feed_dma_writes_();
+  this->enable_loop();
+}
+
+void SPIComponent::feed_dma_writes_() {
+  while (this->dma_in_flight_ < SPI_DMA_QUEUE_SIZE && !this->dma_writes_.empty()) {
+    DMAWrite &write = this->dma_writes_.front();
+    size_t chunk = std::min(write.length, SPI_DMA_MAX_TRANSFER);
+    spi_transaction_t &transaction = this->dma_transactions_[this->dma_next_slot_];
+    transaction = {};
+    transaction.tx_buffer = this->dma_tx_buffer_(this->dma_next_slot_, write.data, &chunk);
+    if (transaction.tx_buffer == nullptr) {
+      this->dma_writes_.erase(this->dma_writes_.begin());
+      continue;
+    }
+    transaction.length = chunk * 8;
+    esp_err_t err = spi_device_queue_trans(this->dma_write_device_, &transaction, 0);
+    if (err != ESP_OK) {
+      // The driver queue is as long as ours, so this only happens on invalid arguments
+      ESP_LOGW(TAG, "Queueing an SPI DMA write failed: %d", err);
+      this->dma_writes_.erase(this->dma_writes_.begin());
+      continue;
+    }
+    this->dma_next_slot_ = (this->dma_next_slot_ + 1) % SPI_DMA_QUEUE_SIZE;
+    this->dma_in_flight_++;
+
+    write.data += chunk;
+    write.length -= chunk;
+    if (write.length == 0)
+      this->dma_writes_.erase(this->dma_writes_.begin());
+  }
+}
+
+const uint8_t *SPIComponent::dma_tx_buffer_(uint8_t slot, const uint8_t *data, size_t *chunk) {
+  if (esp_ptr_dma_capable(data))
+    return data;
+
+  // Framebuffers in PSRAM go out through a small internal buffer instead of the driver allocating one as large as
+  // the whole transfer
+  if (this->dma_bounce_[slot] == nullptr) {
+    this->dma_bounce_[slot] = static_cast<uint8_t *>(heap_caps_malloc(SPI_DMA_BOUNCE_SIZE, MALLOC_CAP_DMA));
+    if (this->dma_bounce_[slot] == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate an SPI DMA bounce buffer");
+      return nullptr;
+    }
+  }
+  *chunk = std::min(*chunk, SPI_DMA_BOUNCE_SIZE);
+  memcpy(this->dma_bounce_[slot], data, *chunk);
+  return this->dma_bounce_[slot];
+}
+
+void SPIComponent::collect_dma_writes_(bool block) {
+  spi_transaction_t *done;
+  while (this->dma_in_flight_ != 0 &&
+         spi_device_get_trans_result(this->dma_write_device_, &done, block ? portMAX_DELAY : 0) == ESP_OK) {
+    this->dma_in_flight_--;
+    this->feed_dma_writes_();
+  }
+  if (this->dma_release_pending_ && !this->dma_busy_()) {
+    this->dma_release_pending_ = false;
+    this->disable();
+  }
+}
+#endif
+
 void SPIComponent::debug_tx(uint8_t value) {
   ESP_LOGVV(TAG, "    TX 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", BYTE_TO_BINARY(value), value);
 }
@@ -3,6 +3,12 @@
 #include "esphome/core/component.h"
 #include "esphome/core/esphal.h"
 #include <SPI.h>
+#include <algorithm>
+#include <vector>
+
+#ifdef USE_SPI_DMA
+#include <driver/spi_master.h>
+#endif
 
 namespace esphome {
 namespace spi {
@@ -61,17 +67,39 @@ enum SPIDataRate : uint32_t {
   DATA_RATE_40MHZ = 40000000,
 };
 
+#ifdef USE_SPI_DMA
+/// The largest single DMA transaction, longer writes are split up.
+static const size_t SPI_DMA_MAX_TRANSFER = 4092 * 4;
+/// How many DMA transactions are handed to the driver at once.
+static const uint8_t SPI_DMA_QUEUE_SIZE = 2;
+/// Size of the internal buffers data the DMA can't read (PSRAM, flash) is copied through, one per queue slot.
+static const size_t SPI_DMA_BOUNCE_SIZE = 4092;
+#endif
+
 class SPIComponent : public Component {
  public:
   void set_clk(GPIOPin *clk) { clk_ = clk; }
   void set_miso(GPIOPin *miso) { miso_ = miso; }
   void set_mosi(GPIOPin *mosi) { mosi_ = mosi; }
+#ifdef USE_SPI_DMA
+  void set_use_dma(bool use_dma) { use_dma_ = use_dma; }
+#endif
 
   void setup() override;
+#ifdef USE_SPI_DMA
+  void loop() override;
+#endif
 
   void dump_config() override;
 
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE> uint8_t read_byte() {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      uint8_t data = 0x00;
+      this->dma_transfer_(&data, &data, 1);
+      return data;
+    }
+#endif
     if (this->hw_spi_ != nullptr) {
       return this->hw_spi_->transfer(0x00);
     }
@@ -80,6 +108,12 @@ class SPIComponent : public Component {
 
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   void read_array(uint8_t *data, size_t length) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->dma_transfer_(nullptr, data, length);
+      return;
+    }
+#endif
     if (this->hw_spi_ != nullptr) {
       this->hw_spi_->transfer(data, length);
       return;
@@ -91,6 +125,12 @@ class SPIComponent : public Component {
 
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   void write_byte(uint8_t data) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->dma_transfer_(&data, nullptr, 1);
+      return;
+    }
+#endif
     if (this->hw_spi_ != nullptr) {
       this->hw_spi_->write(data);
       return;
@@ -100,6 +140,12 @@ class SPIComponent : public Component {
 
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   void write_byte16(const uint16_t data) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->dma_write16_(&data, 1);
+      return;
+    }
+#endif
     if (this->hw_spi_ != nullptr) {
       this->hw_spi_->write16(data);
       return;
@@ -111,9 +157,25 @@ class SPIComponent : public Component {
 
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   void write_array16(const uint16_t *data, size_t length) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->dma_write16_(data, length);
+      return;
+    }
+#endif
     if (this->hw_spi_ != nullptr) {
-      for (size_t i = 0; i < length; i++) {
-        this->hw_spi_->write16(data[i]);
+      // Pack the words like write16() would and let writeBytes() fill the FIFO, instead of one transfer per word
+      uint8_t buffer[64];
+      while (length > 0) {
+        const size_t count = std::min(length, sizeof(buffer) / 2);
+        for (size_t i = 0; i < count; i++) {
+          const uint8_t high = data[i] >> 8, low = data[i];
+          buffer[i * 2] = BIT_ORDER == BIT_ORDER_MSB_FIRST ? high : low;
+          buffer[i * 2 + 1] = BIT_ORDER == BIT_ORDER_MSB_FIRST ? low : high;
+        }
+        this->hw_spi_->writeBytes(buffer, count * 2);
+        data += count;
+        length -= count;
       }
       return;
     }
@@ -124,6 +186,12 @@ class SPIComponent : public Component {
 
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   void write_array(const uint8_t *data, size_t length) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->dma_transfer_(data, nullptr, length);
+      return;
+    }
+#endif
     if (this->hw_spi_ != nullptr) {
       auto *data_c = const_cast<uint8_t *>(data);
       this->hw_spi_->writeBytes(data_c, length);
@@ -134,8 +202,39 @@ class SPIComponent : public Component {
     }
   }
 
+  /** Write an array without waiting for the transfer to finish, if the bus supports it.
+   *
+   * On an ESP32 bus with `use_dma: true` the data is queued for the spi_master DMA driver and this returns right
+   * away, on all other buses it behaves like write_array(). The data must stay valid and unchanged, and the caller
+   * must not touch other signals of the device (like a D/C pin), until wait_async() returns. disable() releases
+   * the chip select only once the queued transfers are done; any following access to the bus waits for them.
+   */
+  template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
+  void write_array_async(const uint8_t *data, size_t length) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->queue_dma_write_(data, length);
+      return;
+    }
+#endif
+    this->write_array<BIT_ORDER, CLOCK_POLARITY, CLOCK_PHASE>(data, length);
+  }
+
+  /// Block until all transfers queued with write_array_async() are done.
+  void wait_async() {
+#ifdef USE_SPI_DMA
+    this->collect_dma_writes_(true);
+#endif
+  }
+
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   uint8_t transfer_byte(uint8_t data) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->dma_transfer_(&data, this->miso_ != nullptr ? &data : nullptr, 1);
+      return this->miso_ != nullptr ? data : 0;
+    }
+#endif
     if (this->miso_ != nullptr) {
       if (this->hw_spi_ != nullptr) {
         return this->hw_spi_->transfer(data);
@@ -149,6 +248,12 @@ class SPIComponent : public Component {
 
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   void transfer_array(uint8_t *data, size_t length) {
+#ifdef USE_SPI_DMA
+    if (this->dma_device_ != nullptr) {
+      this->dma_transfer_(data, this->miso_ != nullptr ? data : nullptr, length);
+      return;
+    }
+#endif
     if (this->hw_spi_ != nullptr) {
       if (this->miso_ != nullptr) {
         this->hw_spi_->transfer(data, length);
@@ -173,10 +278,20 @@ class SPIComponent : public Component {
       SPIComponent::debug_enable(cs->get_pin());
     }
 
+#ifdef USE_SPI_DMA
+    // A chip select may still be held by queued DMA writes
+    this->wait_async();
+#endif
+
     if (this->hw_spi_ != nullptr) {
       uint8_t data_mode = (uint8_t(CLOCK_POLARITY) << 1) | uint8_t(CLOCK_PHASE);
       SPISettings settings(DATA_RATE, BIT_ORDER, data_mode);
       this->hw_spi_->beginTransaction(settings);
+#ifdef USE_SPI_DMA
+    } else if (this->dma_host_ready_) {
+      uint8_t data_mode = (uint8_t(CLOCK_POLARITY) << 1) | uint8_t(CLOCK_PHASE);
+      this->dma_device_ = this->dma_device_for_(data_mode, DATA_RATE, BIT_ORDER == BIT_ORDER_LSB_FIRST);
+#endif
     } else {
       this->clk_->digital_write(CLOCK_POLARITY);
       this->wait_cycle_ = uint32_t(F_CPU) / DATA_RATE / 2ULL;
@@ -202,6 +317,53 @@ class SPIComponent : public Component {
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE, bool READ, bool WRITE>
   uint8_t transfer_(uint8_t data);
 
+#ifdef USE_SPI_DMA
+  /// A spi_master device handle for one combination of SPI settings; the chip select is driven by us.
+  struct DMADevice {
+    uint8_t mode;
+    uint32_t data_rate;
+    bool lsb_first;
+    spi_device_handle_t handle;
+  };
+  struct DMAWrite {
+    const uint8_t *data;
+    size_t length;
+  };
+
+  spi_device_handle_t dma_device_for_(uint8_t mode, uint32_t data_rate, bool lsb_first);
+  /// Blocking full-duplex transfer, either buffer may be null.
+  void dma_transfer_(const uint8_t *tx, uint8_t *rx, size_t length);
+  void dma_write16_(const uint16_t *data, size_t length);
+  void queue_dma_write_(const uint8_t *data, size_t length);
+  /// Hand queued writes to the driver while it has room.
+  void feed_dma_writes_();
+  /// Collect finished DMA writes, and release the chip select once all are done.
+  void collect_dma_writes_(bool block);
+  bool dma_busy_() const { return this->dma_in_flight_ != 0 || !this->dma_writes_.empty(); }
+  /** The buffer to send the next chunk of data from with the given queue slot.
+   *
+   * Data outside of DMA-capable memory is copied into the slot's bounce buffer, shortening chunk to fit. Returns
+   * nullptr if that buffer can't be allocated.
+   */
+  const uint8_t *dma_tx_buffer_(uint8_t slot, const uint8_t *data, size_t *chunk);
+
+  bool use_dma_{false};
+  bool dma_host_ready_{false};
+  spi_host_device_t dma_host_;
+  std::vector<DMADevice> dma_devices_;
+  /// The device selected by enable(), nullptr outside of a transaction.
+  spi_device_handle_t dma_device_{nullptr};
+  /// The device the queued writes belong to.
+  spi_device_handle_t dma_write_device_{nullptr};
+  std::vector<DMAWrite> dma_writes_;
+  spi_transaction_t dma_transactions_[SPI_DMA_QUEUE_SIZE];
+  uint8_t *dma_bounce_[SPI_DMA_QUEUE_SIZE]{};
+  uint8_t dma_in_flight_{0};
+  uint8_t dma_next_slot_{0};
+  /// disable() was called while writes were still running.
+  bool dma_release_pending_{false};
+#endif
+
   GPIOPin *clk_;
   GPIOPin *miso_{nullptr};
   GPIOPin *mosi_{nullptr};
@@ -258,6 +420,13 @@ class SPIDevice {
     this->parent_->template write_array<BIT_ORDER, CLOCK_POLARITY, CLOCK_PHASE>(data, length);
   }
 
+  /// Write without waiting for the transfer to finish where the bus supports it, see SPIComponent::write_array_async().
+  void write_array_async(const uint8_t *data, size_t length) {
+    this->parent_->template write_array_async<BIT_ORDER, CLOCK_POLARITY, CLOCK_PHASE>(data, length);
+  }
+
+  void wait_async() { this->parent_->wait_async(); }
+
   template<size_t N> void write_array(const std::array<uint8_t, N> &data) { this->write_array(data.data(), N); }
 
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
@@ -90,35 +90,54 @@ void SSD1306::setup() {
   set_brightness(this->brightness_);
 
   this->fill(BLACK);  // clear display - ensures we do not see garbage at power-on
-  this->display();    // ...write buffer, which actually clears the display's memory
+  // ...write the whole buffer, which actually clears the display's memory
+  this->mark_dirty_(0, 0);
+  this->mark_dirty_(this->get_width_internal() - 1, this->get_height_internal() - 1);
+  this->display();
 
   this->turn_on();
 }
 void SSD1306::display() {
+  // Only the pages and columns that changed since the last flush are sent
+  if (!this->is_dirty_())
+    return;
+
+  const int width = this->get_width_internal();
+  const uint8_t first_column = this->dirty_x_low_;
+  const uint8_t last_column = this->dirty_x_high_;
+  const uint8_t first_page = this->dirty_y_low_ / 8;
+  const uint8_t last_page = this->dirty_y_high_ / 8;
+  const size_t columns = last_column - first_column + 1;
+
   if (this->is_sh1106_()) {
-    this->write_display_data();
+    // The SH1106 has no address window, each page is addressed on its own. Its RAM is 132 columns wide.
+    const uint8_t column = first_column + 2;
+    for (uint8_t page = first_page; page <= last_page; page++) {
+      this->command(0xB0 + page);           // row
+      this->command(column & 0x0F);         // lower column
+      this->command(0x10 | (column >> 4));  // higher column
+      this->write_display_data(this->buffer_ + page * width + first_column, columns);
+    }
+    this->clear_dirty_();
     return;
   }
 
+  const uint8_t column_offset = this->model_ == SSD1306_MODEL_64_48 ? 0x20 : 0;
   this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
-  switch (this->model_) {
-    case SSD1306_MODEL_64_48:
-      this->command(0x20);
-      this->command(0x20 + this->get_width_internal() - 1);
-      break;
-    default:
-      this->command(0);  // Page start address, 0
-      this->command(this->get_width_internal() - 1);
-      break;
-  }
-
+  this->command(column_offset + first_column);
+  this->command(column_offset + last_column);
   this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
-  // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
+  this->command(first_page);
+  this->command(last_page);
 
-  this->write_display_data();
+  // The display wraps to the next page at the end of the column window
+  if (columns == size_t(width)) {
+    this->write_display_data(this->buffer_ + first_page * width, (last_page - first_page + 1) * columns);
+  } else {
+    for (uint8_t page = first_page; page <= last_page; page++)
+      this->write_display_data(this->buffer_ + page * width + first_column, columns);
+  }
+  this->clear_dirty_();
 }
 bool SSD1306::is_sh1106_() const {
   return this->model_ == SH1106_MODEL_96_16 || this->model_ == SH1106_MODEL_128_32 ||
@@ -188,16 +207,27 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
 
   uint16_t pos = x + (y / 8) * this->get_width_internal();
   uint8_t subpos = y & 0x07;
+  const uint8_t previous = this->buffer_[pos];
   if (color.is_on()) {
     this->buffer_[pos] |= (1 << subpos);
   } else {
     this->buffer_[pos] &= ~(1 << subpos);
   }
+  if (this->buffer_[pos] != previous)
+    this->mark_dirty_(x, y);
 }
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
+  const uint32_t width = this->get_width_internal();
+  for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
+    if (this->buffer_[i] == fill)
+      continue;
     this->buffer_[i] = fill;
+    const uint32_t x = i % width;
+    const uint32_t y = (i / width) * 8;
+    this->mark_dirty_(x, y);
+    this->mark_dirty_(x, y + 7);
+  }
 }
 void SSD1306::init_reset_() {
   if (this->reset_pin_ != nullptr) {
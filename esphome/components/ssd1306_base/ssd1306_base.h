@@ -39,7 +39,8 @@ class SSD1306 : public PollingComponent, public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Send display data, the address window or page was set up by display().
+  virtual void write_display_data(const uint8_t *data, size_t length) = 0;
   void init_reset_();
 
   bool is_sh1106_() const;
@@ -32,12 +32,11 @@ void I2CSSD1327::dump_config() {
 }
 void I2CSSD1327::command(uint8_t value) { this->write_byte(0x00, value); }
 void HOT I2CSSD1327::write_display_data() {
-  for (uint32_t i = 0; i < this->get_buffer_length_();) {
-    uint8_t data[16];
-    for (uint8_t &j : data)
-      j = this->buffer_[i++];
-    this->write_bytes(0x40, data, sizeof(data));
-  }
+  // As many bytes per transmission as the Wire buffer holds, after the 0x40 data control byte
+  static const size_t MAX_CHUNK = i2c::I2C_MAX_WRITE_LENGTH - 1;
+  const size_t length = this->get_buffer_length_();
+  for (size_t i = 0; i < length; i += MAX_CHUNK)
+    this->write_bytes(0x40, this->buffer_ + i, std::min(length - i, MAX_CHUNK));
 }
 
 }  // namespace ssd1327_i2c
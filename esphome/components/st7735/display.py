@@ -58,6 +58,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_ROW_START): cv.int_,
             cv.Optional(CONF_EIGHT_BIT_COLOR, default=False): cv.boolean,
             cv.Optional(CONF_USE_BGR, default=False): cv.boolean,
+            cv.Optional(display.CONF_DOUBLE_BUFFER, default=False): cv.boolean,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -96,3 +97,4 @@ async def to_code(config):
 
     dc = await cg.gpio_pin_expression(config[CONF_DC_PIN])
     cg.add(var.set_dc_pin(dc))
+    cg.add(var.set_double_buffer(config[display.CONF_DOUBLE_BUFFER]))
@@ -287,7 +287,11 @@ void ST7735::setup() {
 }
 
 void ST7735::update() {
+  // The previous frame may still be on its way out of the buffer, unless there is a second one to render into
+  if (!this->is_double_buffered_())
+    this->wait_async();
   this->do_update_();
+  this->wait_async();
   this->write_display_data_();
 }
 
@@ -318,6 +322,33 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   }
 }
 
+void HOT ST7735::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const size_t stride = this->get_width_internal();
+  if (this->eightbitcolor_) {
+    const uint8_t color332 = display::ColorUtil::color_to_332(color);
+    for (int j = y; j < y + height; j++)
+      memset(this->buffer_ + j * stride + x, color332, width);
+    return;
+  }
+
+  const uint16_t color565 = display::ColorUtil::color_to_565(color);
+  const uint8_t high = (color565 >> 8) & 0xff;
+  const uint8_t low = color565 & 0xff;
+  if (high == low) {
+    // Black and white among others, the whole span is one byte
+    for (int j = y; j < y + height; j++)
+      memset(this->buffer_ + (j * stride + x) * 2, high, width * 2);
+    return;
+  }
+  for (int j = y; j < y + height; j++) {
+    uint8_t *pixel = this->buffer_ + (j * stride + x) * 2;
+    for (int i = 0; i < width; i++) {
+      *pixel++ = high;
+      *pixel++ = low;
+    }
+  }
+}
+
 void ST7735::init_reset_() {
   if (this->reset_pin_ != nullptr) {
     this->reset_pin_->setup();
@@ -453,7 +484,7 @@ void HOT ST7735::write_display_data_() {
       }
     }
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    this->write_array_async(this->buffer_, this->get_buffer_length());
   }
   this->disable();
 }
@@ -31,6 +31,7 @@ CONFIG_SCHEMA = (
             cv.Required(CONF_CS_PIN): pins.gpio_output_pin_schema,
             cv.Required(CONF_BACKLIGHT_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_BRIGHTNESS, default=1.0): cv.percentage,
+            cv.Optional(display.CONF_DOUBLE_BUFFER, default=False): cv.boolean,
         }
     )
     .extend(cv.polling_component_schema("5s"))
@@ -52,6 +53,8 @@ async def to_code(config):
     bl = await cg.gpio_pin_expression(config[CONF_BACKLIGHT_PIN])
     cg.add(var.set_backlight_pin(bl))
 
+    cg.add(var.set_double_buffer(config[display.CONF_DOUBLE_BUFFER]))
+
     if CONF_LAMBDA in config:
         lambda_ = await cg.process_lambda(
             config[CONF_LAMBDA], [(display.DisplayBufferRef, "it")], return_type=cg.void
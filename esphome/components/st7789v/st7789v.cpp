@@ -127,17 +127,25 @@ void ST7789V::dump_config() {
 float ST7789V::get_setup_priority() const { return setup_priority::PROCESSOR; }
 
 void ST7789V::update() {
+  // The previous frame may still be on its way out of the buffer, unless there is a second one to render into
+  if (!this->is_double_buffered_())
+    this->wait_async();
   this->do_update_();
+  this->wait_async();
   this->write_display_data();
 }
 
 void ST7789V::loop() {}
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = 52;   // _offsetx
-  uint16_t x2 = 186;  // _offsetx
-  uint16_t y1 = 40;   // _offsety
-  uint16_t y2 = 279;  // _offsety
+  if (!this->is_dirty_())
+    return;
+
+  // Only send the window that changed since the last update
+  uint16_t x1 = 52 + this->dirty_x_low_;   // _offsetx
+  uint16_t x2 = 52 + this->dirty_x_high_;  // _offsetx
+  uint16_t y1 = 40 + this->dirty_y_low_;   // _offsety
+  uint16_t y2 = 40 + this->dirty_y_high_;  // _offsety
 
   this->enable();
 
@@ -156,9 +164,19 @@ void ST7789V::write_display_data() {
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  const size_t stride = size_t(this->get_width_internal()) * 2;
+  const size_t row_length = size_t(this->dirty_x_high_ - this->dirty_x_low_ + 1) * 2;
+  const uint8_t *row = this->buffer_ + this->dirty_y_low_ * stride + this->dirty_x_low_ * 2;
+  if (row_length == stride) {
+    // Full rows are contiguous in the buffer
+    this->write_array_async(row, stride * (this->dirty_y_high_ - this->dirty_y_low_ + 1));
+  } else {
+    for (int y = this->dirty_y_low_; y <= this->dirty_y_high_; y++, row += stride)
+      this->write_array_async(row, row_length);
+  }
 
   this->disable();
+  this->clear_dirty_();
 }
 
 void ST7789V::init_reset_() {
@@ -266,8 +284,37 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   auto color565 = display::ColorUtil::color_to_565(color);
 
   uint16_t pos = (x + y * this->get_width_internal()) * 2;
-  this->buffer_[pos++] = (color565 >> 8) & 0xff;
-  this->buffer_[pos] = color565 & 0xff;
+  const uint8_t high = (color565 >> 8) & 0xff;
+  const uint8_t low = color565 & 0xff;
+  if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+    return;
+  this->buffer_[pos++] = high;
+  this->buffer_[pos] = low;
+  this->mark_dirty_(x, y);
+}
+
+void HOT ST7789V::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  auto color565 = display::ColorUtil::color_to_565(color);
+  const uint8_t high = (color565 >> 8) & 0xff;
+  const uint8_t low = color565 & 0xff;
+  for (int j = y; j < y + height; j++) {
+    uint8_t *pixel = this->buffer_ + (x + j * this->get_width_internal()) * 2;
+    int first = -1;
+    int last = -1;
+    for (int i = x; i < x + width; i++, pixel += 2) {
+      if (pixel[0] != high || pixel[1] != low) {
+        pixel[0] = high;
+        pixel[1] = low;
+        if (first < 0)
+          first = i;
+        last = i;
+      }
+    }
+    if (first >= 0) {
+      this->mark_dirty_(first, j);
+      this->mark_dirty_(last, j);
+    }
+  }
 }
 
 }  // namespace st7789v
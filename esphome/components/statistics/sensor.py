@@ -0,0 +1,68 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    CONF_SEND_EVERY,
+    CONF_SEND_FIRST_AT,
+    CONF_SENSOR,
+    CONF_WINDOW_SIZE,
+    ICON_EMPTY,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_EMPTY,
+)
+
+statistics_ns = cg.esphome_ns.namespace("statistics")
+StatisticsComponent = statistics_ns.class_("StatisticsComponent", cg.Component)
+
+CONF_MEAN = "mean"
+CONF_MIN = "min"
+CONF_MAX = "max"
+CONF_STDDEV = "stddev"
+
+TYPES = [CONF_MEAN, CONF_MIN, CONF_MAX, CONF_STDDEV]
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(StatisticsComponent),
+            cv.Required(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            cv.Optional(CONF_WINDOW_SIZE, default=15): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_EVERY, default=15): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
+            cv.Optional(CONF_MEAN): sensor.sensor_schema(
+                UNIT_EMPTY, ICON_EMPTY, 2, state_class_=STATE_CLASS_MEASUREMENT
+            ),
+            cv.Optional(CONF_MIN): sensor.sensor_schema(
+                UNIT_EMPTY, ICON_EMPTY, 2, state_class_=STATE_CLASS_MEASUREMENT
+            ),
+            cv.Optional(CONF_MAX): sensor.sensor_schema(
+                UNIT_EMPTY, ICON_EMPTY, 2, state_class_=STATE_CLASS_MEASUREMENT
+            ),
+            cv.Optional(CONF_STDDEV): sensor.sensor_schema(
+                UNIT_EMPTY, ICON_EMPTY, 2, state_class_=STATE_CLASS_MEASUREMENT
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.has_at_least_one_key(*TYPES),
+    sensor.validate_send_first_at,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(
+        config[CONF_ID],
+        config[CONF_WINDOW_SIZE],
+        config[CONF_SEND_EVERY],
+        config[CONF_SEND_FIRST_AT],
+    )
+    await cg.register_component(var, config)
+
+    sens = await cg.get_variable(config[CONF_SENSOR])
+    cg.add(var.set_source(sens))
+
+    for type_ in TYPES:
+        if type_ in config:
+            sens = await sensor.new_sensor(config[type_])
+            cg.add(getattr(var, f"set_{type_}_sensor")(sens))
@@ -0,0 +1,98 @@
+#include "statistics.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace statistics {
+
+static const char *const TAG = "statistics";
+
+StatisticsComponent::StatisticsComponent(size_t window_size, size_t send_every, size_t send_first_at)
+    : values_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
+
+void StatisticsComponent::setup() {
+  this->source_->add_on_state_callback([this](float value) { this->new_value_(value); });
+}
+void StatisticsComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Statistics:");
+  ESP_LOGCONFIG(TAG, "  Window Size: %u", (unsigned) this->values_.capacity());
+  ESP_LOGCONFIG(TAG, "  Send Every: %u", (unsigned) this->send_every_);
+  LOG_SENSOR("  ", "Mean", this->mean_sensor_);
+  LOG_SENSOR("  ", "Min", this->min_sensor_);
+  LOG_SENSOR("  ", "Max", this->max_sensor_);
+  LOG_SENSOR("  ", "Standard Deviation", this->stddev_sensor_);
+}
+
+void StatisticsComponent::add_(float value) {
+  size_t n = this->values_.size() + 1;
+  double delta = value - this->mean_;
+  this->mean_ += delta / n;
+  this->m2_ += delta * (value - this->mean_);
+}
+void StatisticsComponent::remove_(float value) {
+  size_t n = this->values_.size() - 1;
+  if (n == 0) {
+    this->mean_ = 0.0;
+    this->m2_ = 0.0;
+    return;
+  }
+  double delta = value - this->mean_;
+  this->mean_ -= delta / n;
+  this->m2_ -= delta * (value - this->mean_);
+  if (this->m2_ < 0.0)
+    this->m2_ = 0.0;
+}
+void StatisticsComponent::new_value_(float value) {
+  if (!isnan(value)) {
+    if (this->values_.full()) {
+      this->remove_(this->values_.front());
+      this->values_.pop_front();
+    }
+    this->add_(value);
+    this->values_.push_back(value);
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+    this->publish_();
+  }
+}
+void StatisticsComponent::publish_() {
+  size_t n = this->values_.size();
+  if (++this->updates_ >= 1000 && n > 0) {
+    // Recalculate to prevent floating point error accumulating
+    this->updates_ = 0;
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++)
+      sum += this->values_[i];
+    double mean = sum / n;
+    double m2 = 0.0;
+    for (size_t i = 0; i < n; i++)
+      m2 += (this->values_[i] - mean) * (this->values_[i] - mean);
+    this->mean_ = mean;
+    this->m2_ = m2;
+  }
+
+  if (this->mean_sensor_ != nullptr)
+    this->mean_sensor_->publish_state(n > 0 ? this->mean_ : NAN);
+  if (this->min_sensor_ != nullptr || this->max_sensor_ != nullptr) {
+    float min = NAN, max = NAN;
+    for (size_t i = 0; i < n; i++) {
+      float value = this->values_[i];
+      if (i == 0 || value < min)
+        min = value;
+      if (i == 0 || value > max)
+        max = value;
+    }
+    if (this->min_sensor_ != nullptr)
+      this->min_sensor_->publish_state(min);
+    if (this->max_sensor_ != nullptr)
+      this->max_sensor_->publish_state(max);
+  }
+  if (this->stddev_sensor_ != nullptr) {
+    // Sample standard deviation of the window
+    this->stddev_sensor_->publish_state(n > 1 ? sqrt(this->m2_ / (n - 1)) : (n == 1 ? 0.0f : NAN));
+  }
+}
+
+}  // namespace statistics
+}  // namespace esphome
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/sensor/sensor.h"
+
+namespace esphome {
+namespace statistics {
+
+/** Mean, min, max and standard deviation of the last <window_size> values of a sensor.
+ *
+ * All statistics share one ring buffer of the window. Mean and variance are updated with Welford's algorithm as
+ * values enter and leave the window, min and max are found when publishing, every <send_every> values.
+ */
+class StatisticsComponent : public Component {
+ public:
+  StatisticsComponent(size_t window_size, size_t send_every, size_t send_first_at);
+
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_source(sensor::Sensor *source) { this->source_ = source; }
+  void set_mean_sensor(sensor::Sensor *mean_sensor) { this->mean_sensor_ = mean_sensor; }
+  void set_min_sensor(sensor::Sensor *min_sensor) { this->min_sensor_ = min_sensor; }
+  void set_max_sensor(sensor::Sensor *max_sensor) { this->max_sensor_ = max_sensor; }
+  void set_stddev_sensor(sensor::Sensor *stddev_sensor) { this->stddev_sensor_ = stddev_sensor; }
+
+ protected:
+  void new_value_(float value);
+  void add_(float value);
+  void remove_(float value);
+  void publish_();
+
+  sensor::Sensor *source_{nullptr};
+  sensor::Sensor *mean_sensor_{nullptr};
+  sensor::Sensor *min_sensor_{nullptr};
+  sensor::Sensor *max_sensor_{nullptr};
+  sensor::Sensor *stddev_sensor_{nullptr};
+
+  RingBuffer<float> values_;
+  double mean_{0.0};
+  /// Sum of the squared differences from the mean.
+  double m2_{0.0};
+  size_t send_every_;
+  size_t send_at_;
+  uint32_t updates_{0};
+};
+
+}  // namespace statistics
+}  // namespace esphome
@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome import automation
+from esphome import automation, pins
 from esphome.const import (
     CONF_ACCELERATION,
     CONF_DECELERATION,
@@ -67,11 +67,38 @@ def validate_speed(value):
     return value
 
 
+CONF_STEP_TIMER = "step_timer"
+
+
+def validate_step_timer(*pin_keys):
+    """Check that step_timer is only used on the ESP32 and with internal pins.
+
+    The step timer writes the pins given by pin_keys from an ISR.
+    """
+
+    def validator(config):
+        if not config[CONF_STEP_TIMER]:
+            return config
+        if not CORE.is_esp32:
+            raise cv.Invalid(
+                f"{CONF_STEP_TIMER} is only available on the ESP32", [CONF_STEP_TIMER]
+            )
+        for key in pin_keys:
+            if any(platform in config[key] for platform in pins.PIN_SCHEMA_REGISTRY):
+                raise cv.Invalid(
+                    f"{CONF_STEP_TIMER} needs an internal GPIO pin for {key}", [key]
+                )
+        return config
+
+    return validator
+
+
 STEPPER_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_MAX_SPEED): validate_speed,
         cv.Optional(CONF_ACCELERATION, default="inf"): validate_acceleration,
         cv.Optional(CONF_DECELERATION, default="inf"): validate_acceleration,
+        cv.Optional(CONF_STEP_TIMER, default=False): cv.boolean,
     }
 )
 
@@ -83,6 +110,8 @@ async def setup_stepper_core_(stepper_var, config):
         cg.add(stepper_var.set_deceleration(config[CONF_DECELERATION]))
     if CONF_MAX_SPEED in config:
         cg.add(stepper_var.set_max_speed(config[CONF_MAX_SPEED]))
+    if config[CONF_STEP_TIMER]:
+        cg.add(stepper_var.set_step_timer(True))
 
 
 async def register_stepper(var, config):
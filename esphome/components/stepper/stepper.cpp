@@ -1,5 +1,10 @@
 #include "stepper.h"
 #include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <soc/timer_group_struct.h>
+#endif
 
 namespace esphome {
 namespace stepper {
@@ -46,5 +51,145 @@ int32_t Stepper::should_step_() {
   return 0;
 }
 
+#ifdef ARDUINO_ARCH_ESP32
+/// The timers count at 10 MHz (80 MHz APB clock / 8)
+static const uint16_t TIMER_DIVIDER = 8;
+static const float TICKS_PER_SECOND = 10e6f;
+/// Fastest step rate of a step timer (50 kHz), each step takes an ISR and a short busy wait for the pulse
+static const uint32_t MIN_STEP_INTERVAL = 200;
+/// Time from start() to the first step
+static const uint32_t START_DELAY = 20;
+
+static StepTimer *step_timers[4] = {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+template<uint8_t N> void ICACHE_RAM_ATTR HOT StepTimer::s_timer_intr() { step_timers[N]->on_timer_(); }
+
+bool StepTimer::setup() {
+  static void (*const ISRS[4])() = {&StepTimer::s_timer_intr<0>, &StepTimer::s_timer_intr<1>,
+                                    &StepTimer::s_timer_intr<2>, &StepTimer::s_timer_intr<3>};
+  // Timer 0 is left for the ac_dimmer
+  uint8_t num = 1;
+  while (num < 4 && step_timers[num] != nullptr)
+    num++;
+  if (num == 4) {
+    ESP_LOGE(TAG, "All hardware timers are in use, stepping from the loop");
+    return false;
+  }
+  step_timers[num] = this;
+  this->timer_num_ = num;
+  this->update_profile();
+
+  this->timer_ = timerBegin(num, TIMER_DIVIDER, true);
+  timerAttachInterrupt(this->timer_, ISRS[num], true);
+  // One-shot, the ISR sets the alarm of the next step
+  timerAlarmWrite(this->timer_, 0, false);
+  return true;
+}
+
+void StepTimer::update_profile() {
+  const float acceleration = this->parent_->acceleration_;
+  const float deceleration = this->parent_->deceleration_;
+  const float max_speed = this->parent_->max_speed_;
+  if (acceleration == this->acceleration_ && deceleration == this->deceleration_ && max_speed == this->max_speed_)
+    return;
+  this->acceleration_ = acceleration;
+  this->deceleration_ = deceleration;
+  this->max_speed_ = max_speed;
+
+  // c_0 = 0.676 * f * sqrt(2 / a), the factor corrects the error of the approximation in the first steps
+  const float first_interval = 0.676f * TICKS_PER_SECOND * sqrtf(2.0f / acceleration);
+  const float min_interval = TICKS_PER_SECOND / max_speed;
+  this->min_interval_ = std::max(static_cast<uint32_t>(min_interval), MIN_STEP_INTERVAL);
+  this->first_interval_ = std::max(static_cast<uint32_t>(std::min(first_interval, 4e9f)), this->min_interval_);
+  this->accel_to_decel_ = static_cast<uint32_t>(std::min(acceleration / deceleration, 65535.0f) * 65536.0f);
+  this->decel_to_accel_ = static_cast<uint32_t>(std::min(deceleration / acceleration, 65535.0f) * 65536.0f);
+}
+
+void StepTimer::start() {
+  if (this->timer_ == nullptr || this->running_)
+    return;
+  this->running_ = true;
+  this->next_alarm_ = timerRead(this->timer_) + START_DELAY;
+  timerAlarmWrite(this->timer_, this->next_alarm_, false);
+  timerAlarmEnable(this->timer_);
+}
+
+void ICACHE_RAM_ATTR HOT StepTimer::set_alarm_(uint64_t alarm) {
+  // The timerX functions are not callable from ISR (placed in flash storage), write the registers directly
+  auto &timer = (this->timer_num_ < 2 ? TIMERG0 : TIMERG1).hw_timer[this->timer_num_ % 2];
+  timer.update = 1;
+  const uint64_t now = (uint64_t(timer.cnt_high) << 32) | timer.cnt_low;
+  // An alarm in the past would never fire
+  if (int64_t(alarm - now) < int64_t(START_DELAY))
+    alarm = now + START_DELAY;
+  this->next_alarm_ = alarm;
+  timer.alarm_high = uint32_t(alarm >> 32);
+  timer.alarm_low = uint32_t(alarm);
+  timer.config.alarm_en = 1;
+}
+
+void ICACHE_RAM_ATTR HOT StepTimer::on_timer_() {
+  Stepper *stepper = this->parent_;
+  const int32_t remaining = stepper->target_position - stepper->current_position;
+  if (this->ramp_step_ == 0 || remaining == 0) {
+    // Standing still, or at the target which stops the motor right away like stepping from the loop does
+    this->ramp_step_ = 0;
+    if (remaining == 0) {
+      this->running_ = false;
+      return;
+    }
+    this->dir_ = remaining > 0 ? 1 : -1;
+    this->decelerating_ = false;
+    this->interval_ = this->first_interval_;
+    this->interval_rest_ = 0;
+  }
+
+  // Decelerate when the motor has to turn around or would otherwise overshoot the target
+  const int32_t steps_left = remaining * this->dir_;
+  uint32_t steps_to_stop = this->ramp_step_;
+  if (!this->decelerating_)
+    steps_to_stop = (uint64_t(this->ramp_step_) * this->accel_to_decel_) >> 16;
+  if (steps_left <= 0 || uint32_t(steps_left) <= steps_to_stop) {
+    if (!this->decelerating_) {
+      this->decelerating_ = true;
+      this->ramp_step_ = std::max(steps_to_stop, uint32_t(1));
+    }
+  } else if (this->decelerating_) {
+    this->decelerating_ = false;
+    this->ramp_step_ = (uint64_t(this->ramp_step_) * this->decel_to_accel_) >> 16;
+  }
+
+  this->step_(this->arg_, this->dir_);
+  stepper->current_position += this->dir_;
+
+  if (this->decelerating_) {
+    // c_(n-1) = c_n + 2 c_n / (4 n - 1), the inverse of the acceleration below
+    this->ramp_step_--;
+    if (this->ramp_step_ != 0) {
+      const uint32_t num = 2 * this->interval_ + this->interval_rest_;
+      const uint32_t den = 4 * this->ramp_step_ + 3;
+      this->interval_ += num / den;
+      this->interval_rest_ = num % den;
+    } else {
+      this->interval_ = this->first_interval_;
+    }
+  } else if (this->interval_ > this->min_interval_) {
+    // c_n = c_(n-1) - 2 c_(n-1) / (4 n + 1)
+    this->ramp_step_++;
+    const uint32_t num = 2 * this->interval_ + this->interval_rest_;
+    const uint32_t den = 4 * this->ramp_step_ + 1;
+    this->interval_ -= num / den;
+    this->interval_rest_ = num % den;
+    if (this->interval_ < this->min_interval_)
+      this->interval_ = this->min_interval_;
+  } else {
+    // Cruising, or the maximum speed was lowered
+    this->interval_ = this->min_interval_;
+  }
+
+  this->set_alarm_(this->next_alarm_ + this->interval_);
+}
+#endif
+
 }  // namespace stepper
 }  // namespace esphome
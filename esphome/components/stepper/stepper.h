@@ -2,8 +2,13 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/esphal.h"
 #include "esphome/components/stepper/stepper.h"
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp32-hal-timer.h>
+#endif
+
 namespace esphome {
 namespace stepper {
 
@@ -12,6 +17,10 @@ namespace stepper {
   ESP_LOGCONFIG(TAG, "  Deceleration: %.0f steps/s^2", this->deceleration_); \
   ESP_LOGCONFIG(TAG, "  Max Speed: %.0f steps/s", this->max_speed_);
 
+#ifdef ARDUINO_ARCH_ESP32
+class StepTimer;
+#endif
+
 class Stepper {
  public:
   void set_target(int32_t steps) { this->target_position = steps; }
@@ -26,6 +35,10 @@ class Stepper {
   int32_t target_position{0};
 
  protected:
+#ifdef ARDUINO_ARCH_ESP32
+  friend StepTimer;
+#endif
+
   void calculate_speed_(uint32_t now);
   int32_t should_step_();
 
@@ -37,13 +50,77 @@ class Stepper {
   uint32_t last_step_{0};
 };
 
+#ifdef ARDUINO_ARCH_ESP32
+/** Generates the steps of a Stepper in a hardware timer interrupt instead of the loop.
+ *
+ * The speed follows a trapezoidal profile, it grows with the acceleration up to the maximum speed and shrinks with
+ * the deceleration so that the motor stops at the target. When the target changes while moving, the motor first
+ * decelerates if it has to turn around. The interval to the next step is updated with integer arithmetic after each
+ * step (D. Austin, "Generate stepper-motor speed profiles in real time"), as the ESP32 can't use the FPU in an ISR.
+ * Only the constants of the ramp are computed with floats, in update_profile().
+ *
+ * Each step timer occupies one of the four hardware timers, the ac_dimmer uses timer 0.
+ */
+class StepTimer {
+ public:
+  /// `step` is called from the ISR for each step with the direction (1 or -1), so it must be in IRAM.
+  StepTimer(Stepper *parent, void (*step)(void *arg, int32_t dir), void *arg)
+      : parent_(parent), step_(step), arg_(arg) {}
+
+  /// Set up the hardware timer, returns false if all timers are in use.
+  bool setup();
+  /// Recompute the constants of the ramp if the maximum speed or the acceleration of the stepper changed.
+  void update_profile();
+  /// Start stepping towards the target of the stepper, if not running already. Call from the loop.
+  void start();
+  /// Whether the timer is still generating steps, false once the motor stands still at the target.
+  bool is_running() const { return this->running_; }
+  uint8_t get_timer_num() const { return this->timer_num_; }
+
+ protected:
+  void on_timer_();
+  template<uint8_t N> static void s_timer_intr();
+  /// Fire the timer interrupt at the absolute tick `alarm`.
+  void set_alarm_(uint64_t alarm);
+
+  Stepper *parent_;
+  void (*step_)(void *arg, int32_t dir);
+  void *arg_;
+  uint8_t timer_num_{0};
+  hw_timer_t *timer_{nullptr};
+
+  // The ramp, computed in update_profile()
+  float acceleration_{0.0f};
+  float deceleration_{0.0f};
+  float max_speed_{0.0f};
+  /// Interval of the first step from standstill in timer ticks.
+  uint32_t first_interval_{0};
+  /// Shortest interval, at the maximum speed.
+  uint32_t min_interval_{0};
+  /// acceleration / deceleration and the inverse in 16.16 fixed point, to convert ramp steps between the two.
+  uint32_t accel_to_decel_{1 << 16};
+  uint32_t decel_to_accel_{1 << 16};
+
+  // State of the ISR
+  volatile bool running_{false};
+  bool decelerating_{false};
+  int32_t dir_{0};
+  /// Number of steps into the acceleration ramp, or, when decelerating, the steps left until standstill.
+  uint32_t ramp_step_{0};
+  uint32_t interval_{0};
+  /// Remainder of the integer division in the interval update, carried over to keep the ramp accurate.
+  uint32_t interval_rest_{0};
+  uint64_t next_alarm_{0};
+};
+#endif
+
 template<typename... Ts> class SetTargetAction : public Action<Ts...> {
  public:
   explicit SetTargetAction(Stepper *parent) : parent_(parent) {}
 
   TEMPLATABLE_VALUE(int32_t, target)
 
-  void play(Ts... x) override { this->parent_->set_target(this->target_.value(x...)); }
+  void play(const Ts &... x) override { this->parent_->set_target(this->target_.value(x...)); }
 
  protected:
   Stepper *parent_;
@@ -55,7 +132,7 @@ template<typename... Ts> class ReportPositionAction : public Action<Ts...> {
 
   TEMPLATABLE_VALUE(int32_t, position)
 
-  void play(Ts... x) override { this->parent_->report_position(this->position_.value(x...)); }
+  void play(const Ts &... x) override { this->parent_->report_position(this->position_.value(x...)); }
 
  protected:
   Stepper *parent_;
@@ -67,7 +144,7 @@ template<typename... Ts> class SetSpeedAction : public Action<Ts...> {
 
   TEMPLATABLE_VALUE(float, speed);
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     float speed = this->speed_.value(x...);
     this->parent_->set_max_speed(speed);
     this->parent_->on_update_speed();
@@ -83,7 +160,7 @@ template<typename... Ts> class SetAccelerationAction : public Action<Ts...> {
 
   TEMPLATABLE_VALUE(float, acceleration);
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     float acceleration = this->acceleration_.value(x...);
     this->parent_->set_acceleration(acceleration);
   }
@@ -98,7 +175,7 @@ template<typename... Ts> class SetDecelerationAction : public Action<Ts...> {
 
   TEMPLATABLE_VALUE(float, deceleration);
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     float deceleration = this->deceleration_.value(x...);
     this->parent_->set_deceleration(deceleration);
   }
@@ -289,18 +289,15 @@ HorizontalCoordinate Sun::calc_coords_() {
   */
   return sun.true_coordinate(m);
 }
-optional<time::ESPTime> Sun::calc_event_(bool rising, double zenith) {
+optional<time::ESPTime> Sun::calc_event_(bool rising, double zenith, const time::ESPTime &after) {
   SunAtLocation sun{location_};
-  auto now = this->time_->utcnow();
-  if (!now.is_valid())
-    return {};
   // Calculate UT1 timestamp at 0h
-  auto today = now;
+  auto today = after;
   today.hour = today.minute = today.second = 0;
   today.recalc_timestamp_utc();
 
   auto it = sun.event(rising, today, zenith);
-  if (it.has_value() && it->timestamp < now.timestamp) {
+  if (it.has_value() && it->timestamp < after.timestamp) {
     // We're calculating *next* sunrise/sunset, but calculated event
     // is today, so try again tomorrow
     time_t new_timestamp = today.timestamp + 24 * 60 * 60;
@@ -310,10 +307,60 @@ optional<time::ESPTime> Sun::calc_event_(bool rising, double zenith) {
   return it;
 }
 
-optional<time::ESPTime> Sun::sunrise(double elevation) { return this->calc_event_(true, 90 - elevation); }
-optional<time::ESPTime> Sun::sunset(double elevation) { return this->calc_event_(false, 90 - elevation); }
+optional<time::ESPTime> Sun::sunrise(double elevation) {
+  auto now = this->time_->utcnow();
+  if (!now.is_valid())
+    return {};
+  return this->calc_event_(true, 90 - elevation, now);
+}
+optional<time::ESPTime> Sun::sunset(double elevation) {
+  auto now = this->time_->utcnow();
+  if (!now.is_valid())
+    return {};
+  return this->calc_event_(false, 90 - elevation, now);
+}
+optional<time::ESPTime> Sun::sunrise(double elevation, const time::ESPTime &after) {
+  return this->calc_event_(true, 90 - elevation, after);
+}
+optional<time::ESPTime> Sun::sunset(double elevation, const time::ESPTime &after) {
+  return this->calc_event_(false, 90 - elevation, after);
+}
 double Sun::elevation() { return this->calc_coords_().elevation; }
 double Sun::azimuth() { return this->calc_coords_().azimuth; }
 
+void SunTrigger::setup() {
+  this->parent_->get_time()->add_on_time_sync_callback([this]() { this->schedule_(); });
+  this->schedule_();
+}
+void SunTrigger::schedule_() {
+  auto now = this->parent_->get_time()->utcnow();
+  // Without a valid time the next time sync schedules the crossing
+  if (!now.is_valid())
+    return;
+
+  // The timeout may fire a bit before the clock reaches the crossing, don't find the same one again
+  auto after = now;
+  if (after.timestamp < this->last_event_ + 60)
+    after = time::ESPTime::from_epoch_utc(this->last_event_ + 60);
+  auto event = this->sunrise_ ? this->parent_->sunrise(this->elevation_, after)
+                              : this->parent_->sunset(this->elevation_, after);
+  if (!event.has_value()) {
+    // The sun doesn't cross the elevation today (polar day or night), try again after the next UTC midnight
+    uint32_t delay = 24 * 60 * 60 - now.timestamp % (24 * 60 * 60) + 60;
+    ESP_LOGD(TAG, "No %s today, checking again in %us", this->sunrise_ ? "sunrise" : "sunset", delay);
+    this->set_timeout("event", delay * 1000, [this]() { this->schedule_(); });
+    return;
+  }
+
+  time_t timestamp = event->timestamp;
+  uint32_t delay = timestamp > now.timestamp ? timestamp - now.timestamp : 0;
+  ESP_LOGD(TAG, "Next %s in %us", this->sunrise_ ? "sunrise" : "sunset", delay);
+  this->set_timeout("event", delay * 1000, [this, timestamp]() {
+    this->last_event_ = timestamp;
+    this->trigger();
+    this->schedule_();
+  });
+}
+
 }  // namespace sun
 }  // namespace esphome
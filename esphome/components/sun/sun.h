@@ -59,47 +59,42 @@ class Sun {
 
   optional<time::ESPTime> sunrise(double elevation);
   optional<time::ESPTime> sunset(double elevation);
+  /// The first sunrise at elevation at or after the time after, or nothing if there's none on that day or the next.
+  optional<time::ESPTime> sunrise(double elevation, const time::ESPTime &after);
+  /// The first sunset at elevation at or after the time after, or nothing if there's none on that day or the next.
+  optional<time::ESPTime> sunset(double elevation, const time::ESPTime &after);
 
   double elevation();
   double azimuth();
 
  protected:
   internal::HorizontalCoordinate calc_coords_();
-  optional<time::ESPTime> calc_event_(bool rising, double zenith);
+  optional<time::ESPTime> calc_event_(bool rising, double zenith, const time::ESPTime &after);
 
   time::RealTimeClock *time_;
   internal::GeoLocation location_;
 };
 
-class SunTrigger : public Trigger<>, public PollingComponent, public Parented<Sun> {
+/** Trigger for the time the sun crosses an elevation.
+ *
+ * The time of the next crossing is calculated ahead and a timeout is armed for it, it is calculated again after
+ * each crossing and time sync.
+ */
+class SunTrigger : public Trigger<>, public Component, public Parented<Sun> {
  public:
-  SunTrigger() : PollingComponent(60000) {}
-
   void set_sunrise(bool sunrise) { sunrise_ = sunrise; }
   void set_elevation(double elevation) { elevation_ = elevation; }
 
-  void update() override {
-    double current = this->parent_->elevation();
-    if (isnan(current))
-      return;
-
-    bool crossed;
-    if (this->sunrise_) {
-      crossed = this->last_elevation_ <= this->elevation_ && this->elevation_ < current;
-    } else {
-      crossed = this->last_elevation_ >= this->elevation_ && this->elevation_ > current;
-    }
-
-    if (crossed && !isnan(this->last_elevation_)) {
-      this->trigger();
-    }
-    this->last_elevation_ = current;
-  }
+  void setup() override;
 
  protected:
+  /// Arm the timeout for the next crossing, or to try again after midnight if there's none.
+  void schedule_();
+
   bool sunrise_;
-  double last_elevation_{NAN};
   double elevation_;
+  /// UTC timestamp of the last crossing the trigger fired for.
+  time_t last_event_{0};
 };
 
 template<typename... Ts> class SunCondition : public Condition<Ts...>, public Parented<Sun> {
@@ -107,7 +102,7 @@ template<typename... Ts> class SunCondition : public Condition<Ts...>, public Pa
   TEMPLATABLE_VALUE(double, elevation);
   void set_above(bool above) { above_ = above; }
 
-  bool check(Ts... x) override {
+  bool check(const Ts &... x) override {
     double elevation = this->elevation_.value(x...);
     double current = this->parent_->elevation();
     if (this->above_)
@@ -11,12 +11,12 @@ Switch::Switch(const std::string &name) : Nameable(name), state(false) {}
 Switch::Switch() : Switch("") {}
 
 std::string Switch::get_icon() {
-  if (this->icon_.has_value())
-    return *this->icon_;
+  if (this->icon_ != nullptr)
+    return this->icon_;
   return this->icon();
 }
 
-void Switch::set_icon(const std::string &icon) { this->icon_ = icon; }
+void Switch::set_icon(const char *icon) { this->icon_ = icon; }
 void Switch::turn_on() {
   ESP_LOGD(TAG, "'%s' Turning ON.", this->get_name().c_str());
   this->write_state(!this->inverted_);
@@ -47,9 +47,6 @@ void Switch::publish_state(bool state) {
 }
 bool Switch::assumed_state() { return false; }
 
-void Switch::add_on_state_callback(std::function<void(bool)> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
 void Switch::set_inverted(bool inverted) { this->inverted_ = inverted; }
 uint32_t Switch::hash_base() { return 3129890955UL; }
 bool Switch::is_inverted() const { return this->inverted_; }
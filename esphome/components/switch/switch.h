@@ -71,7 +71,7 @@ class Switch : public Nameable {
   void set_inverted(bool inverted);
 
   /// Set the icon for this switch. "" for no icon.
-  void set_icon(const std::string &icon);
+  void set_icon(const char *icon);
 
   /// Get the icon for this switch. Using icon() if not manually set
   std::string get_icon();
@@ -80,7 +80,9 @@ class Switch : public Nameable {
    *
    * @param callback The void(bool) callback.
    */
-  void add_on_state_callback(std::function<void(bool)> &&callback);
+  template<typename F> void add_on_state_callback(F &&callback) {
+    this->state_callback_.add(std::forward<F>(callback));
+  }
 
   optional<bool> get_initial_state();
 
@@ -114,7 +116,7 @@ class Switch : public Nameable {
 
   uint32_t hash_base() override;
 
-  optional<std::string> icon_{};  ///< The icon shown here. Not set means use default from switch. Empty means no icon.
+  const char *icon_{nullptr};  ///< The icon shown here. nullptr means use default from switch. Empty means no icon.
 
   CallbackManager<void(bool)> state_callback_{};
   bool inverted_{false};
@@ -28,6 +28,8 @@ void SX1509Component::setup() {
   delayMicroseconds(500);
   if (this->has_keypad_)
     this->setup_keypad_();
+  if (this->interrupt_pin_ != nullptr)
+    this->interrupt_pin_->setup();
 }
 
 void SX1509Component::dump_config() {
@@ -36,9 +38,14 @@ void SX1509Component::dump_config() {
     ESP_LOGE(TAG, "Setting up SX1509 failed!");
   }
   LOG_I2C_DEVICE(this);
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
 }
 
 void SX1509Component::loop() {
+  // NINT is cleared when RegData is read (autoclear in RegMisc is on by default)
+  if (this->interrupt_pin_ == nullptr || !this->interrupt_pin_->digital_read())
+    this->data_cache_valid_ = false;
+
   if (this->has_keypad_) {
     uint16_t key_data = this->read_key_data();
     for (auto *binary_sensor : this->keypad_binary_sensors_)
@@ -48,15 +55,17 @@ void SX1509Component::loop() {
 
 bool SX1509Component::digital_read(uint8_t pin) {
   if (this->ddr_mask_ & (1 << pin)) {
-    uint16_t temp_reg_data;
-    this->read_byte_16(REG_DATA_B, &temp_reg_data);
-    if (temp_reg_data & (1 << pin))
+    if (!this->data_cache_valid_ && this->read_byte_16(REG_DATA_B, &this->data_cache_))
+      this->data_cache_valid_ = true;
+    if (this->data_cache_ & (1 << pin))
       return true;
   }
   return false;
 }
 
 void SX1509Component::digital_write(uint8_t pin, bool bit_value) {
+  // Pull-ups and pull-downs change what the inputs read back
+  this->data_cache_valid_ = false;
   if ((~this->ddr_mask_) & (1 << pin)) {
     // If the pin is an output, write high/low
     uint16_t temp_reg_data = 0;
@@ -100,11 +109,29 @@ void SX1509Component::pin_mode(uint8_t pin, uint8_t mode) {
   if (mode == INPUT_PULLUP)
     digital_write(pin, HIGH);
 
+  if (this->interrupt_pin_ != nullptr && (this->ddr_mask_ & (1 << pin)))
+    this->setup_interrupt_(pin);
+  this->data_cache_valid_ = false;
+
   if (mode == SX1509_ANALOG_OUTPUT) {
     setup_led_driver_(pin);
   }
 }
 
+void SX1509Component::setup_interrupt_(uint8_t pin) {
+  uint16_t mask;
+  this->read_byte_16(REG_INTERRUPT_MASK_B, &mask);
+  mask &= ~(1 << pin);
+  this->write_byte_16(REG_INTERRUPT_MASK_B, mask);
+
+  // Two sense bits per pin, four pins per register starting with I/O[3:0] in RegSenseLowA, 0b11 is both edges
+  uint8_t sense_reg = REG_SENSE_LOW_A - pin / 4;
+  uint8_t sense;
+  this->read_byte(sense_reg, &sense);
+  sense |= 0b11 << ((pin % 4) * 2);
+  this->write_byte(sense_reg, sense);
+}
+
 void SX1509Component::setup_led_driver_(uint8_t pin) {
   uint16_t temp_word;
   uint8_t temp_byte;
@@ -57,6 +57,8 @@ class SX1509Component : public Component, public i2c::I2CDevice {
   void set_sleep_time(uint16_t sleep_time) { this->sleep_time_ = sleep_time; };
   void set_scan_time(uint8_t scan_time) { this->scan_time_ = scan_time; };
   void set_debounce_time(uint8_t debounce_time = 1) { this->debounce_time_ = debounce_time; };
+  /// Only read the inputs again after NINT (active low) connected to this pin signalled a change.
+  void set_interrupt_pin(GPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; };
   void register_keypad_binary_sensor(SX1509Processor *binary_sensor) {
     this->keypad_binary_sensors_.push_back(binary_sensor);
   };
@@ -74,6 +76,12 @@ class SX1509Component : public Component, public i2c::I2CDevice {
   uint8_t scan_time_ = 1;
   uint8_t debounce_time_ = 1;
   std::vector<SX1509Processor *> keypad_binary_sensors_;
+  GPIOPin *interrupt_pin_{nullptr};
+  /// RegData as read in this loop iteration, all input reads share one bus transaction
+  uint16_t data_cache_ = 0x00;
+  bool data_cache_valid_ = false;
+
+  void setup_interrupt_(uint8_t pin);
 
   void setup_keypad_();
   void set_debounce_config_(uint8_t config_value);
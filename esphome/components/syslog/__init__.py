@@ -0,0 +1,60 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import logger
+from esphome.const import (
+    CONF_FORMAT,
+    CONF_ID,
+    CONF_IP_ADDRESS,
+    CONF_LEVEL,
+    CONF_PORT,
+)
+
+DEPENDENCIES = ["logger", "network"]
+
+syslog_ns = cg.esphome_ns.namespace("syslog")
+SyslogComponent = syslog_ns.class_("SyslogComponent", cg.Component)
+SyslogFormat = syslog_ns.enum("SyslogFormat")
+
+CONF_FACILITY = "facility"
+CONF_FLUSH_INTERVAL = "flush_interval"
+CONF_MAX_DATAGRAM_SIZE = "max_datagram_size"
+CONF_RATE_LIMIT = "rate_limit"
+
+FORMATS = {
+    "RFC5424": SyslogFormat.SYSLOG_FORMAT_RFC5424,
+    "BINARY": SyslogFormat.SYSLOG_FORMAT_BINARY,
+}
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(SyslogComponent),
+        cv.Required(CONF_IP_ADDRESS): cv.ipv4,
+        cv.Optional(CONF_PORT, default=514): cv.port,
+        cv.Optional(CONF_LEVEL, default="DEBUG"): logger.is_log_level,
+        # local0
+        cv.Optional(CONF_FACILITY, default=16): cv.int_range(min=0, max=23),
+        cv.Optional(CONF_FORMAT, default="RFC5424"): cv.enum(FORMATS, upper=True),
+        cv.Optional(
+            CONF_FLUSH_INTERVAL, default="100ms"
+        ): cv.positive_time_period_milliseconds,
+        # Fits into one Ethernet frame, larger datagrams are fragmented
+        cv.Optional(CONF_MAX_DATAGRAM_SIZE, default=1024): cv.int_range(
+            min=128, max=1472
+        ),
+        cv.Optional(CONF_RATE_LIMIT, default=0): cv.int_range(min=0, max=65535),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add(var.set_address(*config[CONF_IP_ADDRESS].args))
+    cg.add(var.set_port(config[CONF_PORT]))
+    cg.add(var.set_level(logger.LOG_LEVELS[config[CONF_LEVEL]]))
+    cg.add(var.set_facility(config[CONF_FACILITY]))
+    cg.add(var.set_format(config[CONF_FORMAT]))
+    cg.add(var.set_flush_interval(config[CONF_FLUSH_INTERVAL]))
+    cg.add(var.set_max_datagram_size(config[CONF_MAX_DATAGRAM_SIZE]))
+    cg.add(var.set_rate_limit(config[CONF_RATE_LIMIT]))
@@ -0,0 +1,176 @@
+#include "syslog.h"
+#include "esphome/core/application.h"
+#include "esphome/core/log.h"
+#include "esphome/core/util.h"
+#include "esphome/components/logger/logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <WiFi.h>
+#endif
+
+#ifdef ARDUINO_ARCH_ESP8266
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+#endif
+
+namespace esphome {
+namespace syslog {
+
+static const char *const TAG = "syslog";
+
+/// RFC 5424 severity of each ESPHome log level, from NONE to VERY_VERBOSE.
+static const uint8_t SEVERITIES[] = {7, 3, 4, 6, 5, 7, 7, 7};
+/// RFC 5424 limits APP-NAME to 48 characters.
+static const size_t MAX_TAG_LENGTH = 48;
+static const uint8_t BINARY_FORMAT_VERSION = 1;
+
+/// The text of a formatted log line, without the "[D][tag:123]: " header of the logger.
+static const char *skip_header(const char *message) {
+  const char *end = strstr(message, "]: ");
+  return end == nullptr ? message : end + 3;
+}
+
+void SyslogComponent::setup() {
+  this->udp_.reset(new WiFiUDP());
+  this->buffer_.reserve(this->max_datagram_size_);
+  this->active_level_ = ESPHOME_LOG_LEVEL_NONE;
+  logger::global_logger->add_on_log_callback(
+      [this](int level, const char *tag, const char *message) { this->on_log_(level, tag, message); },
+      &this->active_level_);
+}
+
+void SyslogComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Syslog:");
+  ESP_LOGCONFIG(TAG, "  Address: %u.%u.%u.%u:%u", this->address_[0], this->address_[1], this->address_[2],
+                this->address_[3], this->port_);
+  ESP_LOGCONFIG(TAG, "  Format: %s", this->format_ == SYSLOG_FORMAT_BINARY ? "binary" : "RFC 5424");
+  ESP_LOGCONFIG(TAG, "  Facility: %u", this->facility_);
+  ESP_LOGCONFIG(TAG, "  Flush Interval: %ums", this->flush_interval_);
+  ESP_LOGCONFIG(TAG, "  Max Datagram Size: %u", this->max_datagram_size_);
+  if (this->rate_limit_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Rate Limit: %u lines/s", this->rate_limit_);
+    ESP_LOGCONFIG(TAG, "  Dropped Lines: %u", this->dropped_total_);
+  }
+}
+
+void SyslogComponent::loop() {
+  if (!network_is_connected()) {
+    this->active_level_ = ESPHOME_LOG_LEVEL_NONE;
+    this->buffer_.clear();
+    return;
+  }
+  this->active_level_ = this->level_;
+
+  if (!this->buffer_.empty() && millis() - this->first_line_time_ >= this->flush_interval_)
+    this->send_();
+}
+
+void SyslogComponent::on_log_(int level, const char *tag, const char *message) {
+  // Lines logged while a datagram is sent would end up in the buffer being sent
+  if (level > this->active_level_ || this->sending_)
+    return;
+
+  if (!this->check_rate_limit_()) {
+    this->dropped_++;
+    this->dropped_total_++;
+    return;
+  }
+  if (this->dropped_ != 0) {
+    char line[48];
+    int length = snprintf(line, sizeof(line), "%u lines dropped by the rate limit", this->dropped_);
+    this->dropped_ = 0;
+    this->add_line_(ESPHOME_LOG_LEVEL_WARN, TAG, line, length);
+  }
+
+  const char *text = skip_header(message);
+  this->add_line_(level, tag, text, strlen(text));
+  if (this->flush_interval_ == 0)
+    this->send_();
+}
+
+bool SyslogComponent::check_rate_limit_() {
+  if (this->rate_limit_ == 0)
+    return true;
+  const uint32_t now = millis();
+  if (now - this->rate_window_start_ >= 1000) {
+    this->rate_window_start_ = now;
+    this->rate_window_count_ = 0;
+  }
+  if (this->rate_window_count_ >= this->rate_limit_)
+    return false;
+  this->rate_window_count_++;
+  return true;
+}
+
+void SyslogComponent::add_line_(int level, const char *tag, const char *message, size_t length) {
+  const uint8_t severity = SEVERITIES[std::min(std::max(level, 0), 7)];
+  const size_t tag_length = std::min(strlen(tag), MAX_TAG_LENGTH);
+
+  char header[128];
+  size_t header_length;
+  if (this->format_ == SYSLOG_FORMAT_RFC5424) {
+    // <PRI>VERSION TIMESTAMP HOSTNAME APP-NAME PROCID MSGID STRUCTURED-DATA, the collector adds the timestamp
+    int written = snprintf(header, sizeof(header), "<%u>1 - %s %.*s - - - ", this->facility_ * 8u + severity,
+                           App.get_name().c_str(), int(tag_length), tag);
+    header_length = std::min<size_t>(std::max(written, 0), sizeof(header) - 1);
+  } else {
+    header[0] = severity;
+    header[1] = tag_length;
+    memcpy(header + 2, tag, tag_length);
+    // The message length follows once known
+    header_length = 2 + tag_length + 2;
+  }
+
+  // A newline between RFC 5424 messages, the version byte at the start of a binary datagram
+  size_t separator = this->format_ == SYSLOG_FORMAT_RFC5424 ? !this->buffer_.empty() : this->buffer_.empty();
+  if (this->buffer_.size() + separator + header_length + length > this->max_datagram_size_ && !this->buffer_.empty()) {
+    this->send_();
+    separator = this->format_ == SYSLOG_FORMAT_BINARY;
+  }
+  if (this->buffer_.size() + separator + header_length >= this->max_datagram_size_)
+    return;
+
+  if (this->buffer_.empty())
+    this->first_line_time_ = millis();
+  if (separator != 0)
+    this->buffer_.push_back(this->format_ == SYSLOG_FORMAT_RFC5424 ? '\n' : BINARY_FORMAT_VERSION);
+  this->buffer_.insert(this->buffer_.end(), header, header + header_length);
+  const size_t message_start = this->buffer_.size();
+
+  // Copy what fits of the message, without escape sequences such as the colors of the logger
+  for (size_t i = 0; i < length && this->buffer_.size() < this->max_datagram_size_; i++) {
+    if (message[i] == '\033') {
+      while (i + 1 < length && !isalpha(message[i + 1]))
+        i++;
+      i++;
+      continue;
+    }
+    this->buffer_.push_back(message[i]);
+  }
+
+  if (this->format_ == SYSLOG_FORMAT_BINARY) {
+    const size_t message_length = this->buffer_.size() - message_start;
+    this->buffer_[message_start - 2] = message_length & 0xFF;
+    this->buffer_[message_start - 1] = message_length >> 8;
+  }
+}
+
+void SyslogComponent::send_() {
+  if (this->buffer_.empty())
+    return;
+  this->sending_ = true;
+  IPAddress address(this->address_[0], this->address_[1], this->address_[2], this->address_[3]);
+  if (this->udp_->beginPacket(address, this->port_)) {
+    this->udp_->write(this->buffer_.data(), this->buffer_.size());
+    this->udp_->endPacket();
+  }
+  this->sending_ = false;
+  this->buffer_.clear();
+}
+
+}  // namespace syslog
+}  // namespace esphome
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+#include <memory>
+#include <vector>
+
+class UDP;
+
+namespace esphome {
+namespace syslog {
+
+enum SyslogFormat {
+  /// RFC 5424 syslog messages, one per line.
+  SYSLOG_FORMAT_RFC5424,
+  /** A version byte (1) followed by one record per line:
+   * [severity][tag length][tag][message length, 16 bit little endian][message].
+   */
+  SYSLOG_FORMAT_BINARY,
+};
+
+/** Sends the log over UDP to a syslog collector.
+ *
+ * Lines are collected into one datagram until it's full or the first line waited for the flush interval, so a burst
+ * of lines shares a datagram. In RFC 5424 format the messages of a datagram are separated by newlines, with a flush
+ * interval of 0 every message is sent in its own datagram as RFC 5426 expects.
+ *
+ * At most rate_limit lines per second are sent, the rest is dropped and the number of dropped lines is reported
+ * with the next line that's sent.
+ */
+class SyslogComponent : public Component {
+ public:
+  void set_address(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+    this->address_[0] = a;
+    this->address_[1] = b;
+    this->address_[2] = c;
+    this->address_[3] = d;
+  }
+  void set_port(uint16_t port) { this->port_ = port; }
+  /// Only send lines up to this log level.
+  void set_level(int level) { this->level_ = level; }
+  void set_facility(uint8_t facility) { this->facility_ = facility; }
+  void set_format(SyslogFormat format) { this->format_ = format; }
+  /// The longest time in ms a line waits for more lines to share its datagram.
+  void set_flush_interval(uint32_t flush_interval) { this->flush_interval_ = flush_interval; }
+  void set_max_datagram_size(uint16_t max_datagram_size) { this->max_datagram_size_ = max_datagram_size; }
+  /// At most this many lines per second are sent, 0 for no limit.
+  void set_rate_limit(uint16_t rate_limit) { this->rate_limit_ = rate_limit; }
+
+  void setup() override;
+  void dump_config() override;
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+ protected:
+  void on_log_(int level, const char *tag, const char *message);
+  /// Whether the rate limit allows another line now.
+  bool check_rate_limit_();
+  /// Add a line to the datagram, sending the datagram first if the line doesn't fit.
+  void add_line_(int level, const char *tag, const char *message, size_t length);
+  void send_();
+
+  uint8_t address_[4]{};
+  uint16_t port_{514};
+  int level_;
+  /// level_ while the network is connected and ESPHOME_LOG_LEVEL_NONE otherwise, the logger skips the callback.
+  int active_level_;
+  uint8_t facility_{16};
+  SyslogFormat format_{SYSLOG_FORMAT_RFC5424};
+  uint32_t flush_interval_{100};
+  uint16_t max_datagram_size_{1024};
+  uint16_t rate_limit_{0};
+  std::unique_ptr<UDP> udp_;
+  /// The datagram being collected.
+  std::vector<uint8_t> buffer_;
+  uint32_t first_line_time_{0};
+  uint32_t rate_window_start_{0};
+  uint16_t rate_window_count_{0};
+  uint32_t dropped_{0};
+  uint32_t dropped_total_{0};
+  bool sending_{false};
+};
+
+}  // namespace syslog
+}  // namespace esphome
@@ -13,8 +13,8 @@ void TCA9548AComponent::setup() {
     ESP_LOGI(TAG, "TCA9548A failed");
     return;
   }
-  // out of range to make sure on first set_channel a new one will be set
-  this->current_channelno_ = 8;
+  // make sure on first set_channel a new one will be set
+  this->invalidate_channel();
   ESP_LOGCONFIG(TAG, "Channels currently open: %d", status);
 }
 void TCA9548AComponent::dump_config() {
@@ -29,12 +29,10 @@ void TCA9548AComponent::dump_config() {
   }
 }
 
-void TCA9548AComponent::set_channel(uint8_t channelno) {
-  if (this->current_channelno_ != channelno) {
-    this->current_channelno_ = channelno;
-    uint8_t channelbyte = 1 << channelno;
-    this->write_byte(0x70, channelbyte);
-  }
+bool TCA9548AComponent::write_channel_(uint8_t channelno) {
+  // The control register is the only register, so the channel mask is written without a register address
+  uint8_t channelbyte = 1 << channelno;
+  return this->write_bytes_raw(&channelbyte, 1);
 }
 
 }  // namespace tca9548a
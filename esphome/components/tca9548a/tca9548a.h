@@ -12,11 +12,11 @@ class TCA9548AComponent : public Component, public i2c::I2CMultiplexer {
   void setup() override;
   void dump_config() override;
   void update();
-  void set_channel(uint8_t channelno) override;
 
  protected:
+  bool write_channel_(uint8_t channelno) override;
+
   bool scan_;
-  uint8_t current_channelno_;
 };
 }  // namespace tca9548a
 }  // namespace esphome
@@ -141,6 +141,8 @@ void Tcl112Climate::transmit_state() {
   transmit.perform();
 }
 
+remote_base::RemoteSignature Tcl112Climate::get_signature() { return {TCL112_HEADER_MARK, TCL112_HEADER_SPACE}; }
+
 bool Tcl112Climate::on_receive(remote_base::RemoteReceiveData data) {
   // Validate header
   if (!data.expect_item(TCL112_HEADER_MARK, TCL112_HEADER_SPACE)) {
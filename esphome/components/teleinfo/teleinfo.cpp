@@ -1,158 +1,156 @@
 #include "teleinfo.h"
 #include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
 
 namespace esphome {
 namespace teleinfo {
 
 static const char *const TAG = "teleinfo";
 
-/* Helpers */
-static int get_field(char *dest, char *buf_start, char *buf_end, int sep) {
-  char *field_end;
-  int len;
-
-  field_end = static_cast<char *>(memchr(buf_start, sep, buf_end - buf_start));
-  if (!field_end)
-    return 0;
-  len = field_end - buf_start;
-  strncpy(dest, buf_start, len);
-  dest[len] = '\0';
-
-  return len;
-}
 /* TeleInfo methods */
-bool TeleInfo::check_crc_(const char *grp, const char *grp_end) {
-  int grp_len = grp_end - grp;
-  uint8_t raw_crc = grp[grp_len - 1];
-  uint8_t crc_tmp = 0;
-  int i;
-
-  for (i = 0; i < grp_len - checksum_area_end_; i++)
-    crc_tmp += grp[i];
-
-  crc_tmp &= 0x3F;
-  crc_tmp += 0x20;
-  if (raw_crc != crc_tmp) {
-    ESP_LOGE(TAG, "bad crc: got %d except %d", raw_crc, crc_tmp);
-    return false;
-  }
-
-  return true;
-}
-bool TeleInfo::read_chars_until_(bool drop, uint8_t c) {
-  uint8_t received;
-  int j = 0;
-
-  while (available() > 0 && j < 128) {
-    j++;
-    received = read();
-    if (received == c)
-      return true;
-    if (drop)
-      continue;
-    /*
-     * Internal buffer is full, switch to OFF mode.
-     * Data will be retrieved on next update.
-     */
-    if (buf_index_ >= (MAX_BUF_SIZE - 1)) {
-      ESP_LOGW(TAG, "Internal buffer full");
-      state_ = OFF;
-      return false;
-    }
-    buf_[buf_index_++] = received;
-  }
-
-  return false;
-}
 void TeleInfo::setup() { state_ = OFF; }
 void TeleInfo::update() {
-  if (state_ == OFF) {
-    buf_index_ = 0;
+  if (state_ == OFF)
     state_ = ON;
-  }
 }
 void TeleInfo::loop() {
-  switch (state_) {
-    case OFF:
-      break;
-    case ON:
-      /* Dequeue chars until start frame (0x2) */
-      if (read_chars_until_(true, 0x2))
-        state_ = START_FRAME_RECEIVED;
-      break;
-    case START_FRAME_RECEIVED:
-      /* Dequeue chars until end frame (0x3) */
-      if (read_chars_until_(false, 0x3))
-        state_ = END_FRAME_RECEIVED;
-      break;
-    case END_FRAME_RECEIVED:
-      char *buf_finger;
-      char *grp_end;
-      char *buf_end;
-      int field_len;
-
-      buf_finger = buf_;
-      buf_end = buf_ + buf_index_;
-
-      /* Each frame is composed of multiple groups starting by 0xa(Line Feed) and ending by
-       * 0xd ('\r').
-       *
-       * Historical mode: each group contains tag, data and a CRC separated by 0x20 (Space)
-       * 0xa | Tag | 0x20 | Data | 0x20 | CRC | 0xd
-       *     ^^^^^^^^^^^^^^^^^^^^
-       * Checksum is computed on the above in historical mode.
-       *
-       * Standard mode: each group contains tag, data and a CRC separated by 0x9 (\t)
-       * 0xa | Tag | 0x9 | Data | 0x9 | CRC | 0xd
-       *     ^^^^^^^^^^^^^^^^^^^^^^^^^
-       * Checksum is computed on the above in standard mode.
-       */
-      while ((buf_finger = static_cast<char *>(memchr(buf_finger, (int) 0xa, buf_index_ - 1))) &&
-             ((buf_finger - buf_) < buf_index_)) {
-        /* Point to the first char of the group after 0xa */
-        buf_finger += 1;
-
-        /* Group len */
-        grp_end = static_cast<char *>(memchr(buf_finger, 0xd, buf_end - buf_finger));
-        if (!grp_end) {
-          ESP_LOGE(TAG, "No group found");
-          break;
-        }
+  const uint8_t *data;
+  size_t length;
+
+  while (state_ != OFF && (length = this->read_buffer(&data)) != 0) {
+    const uint8_t *end = data + length;
+    if (state_ == ON) {
+      /* Drop chars until start frame (0x2) */
+      data = static_cast<const uint8_t *>(memchr(data, 0x2, length));
+      if (data == nullptr)
+        continue;
+      data++;
+      state_ = START_FRAME_RECEIVED;
+      group_state_ = GROUP_WAIT;
+    }
+    for (; data < end; data++) {
+      /* End frame (0x3), the rest is dropped until the next update */
+      if (*data == 0x3) {
+        state_ = OFF;
+        break;
+      }
+      parse_byte_(*data);
+    }
+  }
+}
+void TeleInfo::parse_byte_(uint8_t c) {
+  /* Each frame is composed of multiple groups starting by 0xa(Line Feed) and ending by
+   * 0xd ('\r').
+   *
+   * Historical mode: each group contains tag, data and a CRC separated by 0x20 (Space)
+   * 0xa | Tag | 0x20 | Data | 0x20 | CRC | 0xd
+   *     ^^^^^^^^^^^^^^^^^^^^
+   * Checksum is computed on the above in historical mode.
+   *
+   * Standard mode: each group contains tag, data and a CRC separated by 0x9 (\t)
+   * 0xa | Tag | 0x9 | Data | 0x9 | CRC | 0xd
+   *     ^^^^^^^^^^^^^^^^^^^^^^^^^
+   * Checksum is computed on the above in standard mode.
+   *
+   * The group is parsed while it is received, the checksum is summed up on the way.
+   */
+  if (c == 0xa) {
+    group_state_ = GROUP_TAG;
+    field_len_ = 0;
+    tag_hash_ = 2166136261UL;
+    crc_sum_ = 0;
+    last_byte_ = 0;
+    second_to_last_byte_ = 0;
+    return;
+  }
+  if (group_state_ == GROUP_WAIT)
+    return;
+  if (c == 0xd) {
+    end_group_();
+    group_state_ = GROUP_WAIT;
+    return;
+  }
 
-        if (!check_crc_(buf_finger, grp_end))
-          continue;
+  crc_sum_ += c;
+  second_to_last_byte_ = last_byte_;
+  last_byte_ = c;
 
-        /* Get tag */
-        field_len = get_field(tag_, buf_finger, grp_end, separator_);
-        if (!field_len || field_len >= MAX_TAG_SIZE) {
+  switch (group_state_) {
+    case GROUP_TAG:
+      if (c == separator_) {
+        if (field_len_ == 0) {
           ESP_LOGE(TAG, "Invalid tag.");
+          group_state_ = GROUP_WAIT;
           break;
         }
-
-        /* Advance buf_finger to after the tag and the separator. */
-        buf_finger += field_len + 1;
-
-        /* Get value (after next separator) */
-        field_len = get_field(val_, buf_finger, grp_end, separator_);
-        if (!field_len || field_len >= MAX_VAL_SIZE) {
+        tag_[field_len_] = '\0';
+        field_len_ = 0;
+        group_state_ = GROUP_VALUE;
+      } else if (field_len_ >= MAX_TAG_SIZE - 1) {
+        ESP_LOGE(TAG, "Invalid tag.");
+        group_state_ = GROUP_WAIT;
+      } else {
+        tag_[field_len_++] = c;
+        /* FNV-1, like fnv1_hash() */
+        tag_hash_ *= 16777619UL;
+        tag_hash_ ^= c;
+      }
+      break;
+    case GROUP_VALUE:
+      if (c == separator_) {
+        if (field_len_ == 0) {
           ESP_LOGE(TAG, "Invalid Value");
+          group_state_ = GROUP_WAIT;
           break;
         }
-
-        /* Advance buf_finger to end of group */
-        buf_finger += field_len + 1 + 1 + 1;
-
-        publish_value_(std::string(tag_), std::string(val_));
+        val_[field_len_] = '\0';
+        group_state_ = GROUP_OTHER_FIELDS;
+      } else if (field_len_ >= MAX_VAL_SIZE - 1) {
+        ESP_LOGE(TAG, "Invalid Value");
+        group_state_ = GROUP_WAIT;
+      } else {
+        val_[field_len_++] = c;
       }
-      state_ = OFF;
+      break;
+    default:
       break;
   }
 }
-void TeleInfo::publish_value_(const std::string &tag, const std::string &val) {
-  for (auto element : teleinfo_listeners_) {
-    if (tag != element->tag)
+void TeleInfo::end_group_() {
+  if (group_state_ != GROUP_OTHER_FIELDS) {
+    ESP_LOGE(TAG, "No group found");
+    return;
+  }
+
+  /* The last char is the CRC, in historical mode the separator before it isn't summed up either */
+  uint8_t raw_crc = last_byte_;
+  uint8_t crc_tmp = crc_sum_ - last_byte_;
+  if (checksum_area_end_ == 2)
+    crc_tmp -= second_to_last_byte_;
+
+  crc_tmp &= 0x3F;
+  crc_tmp += 0x20;
+  if (raw_crc != crc_tmp) {
+    ESP_LOGE(TAG, "bad crc: got %d except %d", raw_crc, crc_tmp);
+    return;
+  }
+
+  publish_value_();
+}
+void TeleInfo::publish_value_() {
+  auto it = std::lower_bound(
+      teleinfo_listeners_.begin(), teleinfo_listeners_.end(), tag_hash_,
+      [](const TeleInfoListener *listener, uint32_t hash) { return listener->tag_hash < hash; });
+  /* The value is only copied into a string if a listener wants it */
+  std::string val;
+  for (; it != teleinfo_listeners_.end() && (*it)->tag_hash == tag_hash_; ++it) {
+    if ((*it)->tag != tag_)
       continue;
-    element->publish_val(val);
+    if (val.empty())
+      val = val_;
+    (*it)->publish_val(val);
   }
 }
 void TeleInfo::dump_config() {
@@ -173,7 +171,13 @@ TeleInfo::TeleInfo(bool historical_mode) {
     baud_rate_ = 9600;
   }
 }
-void TeleInfo::register_teleinfo_listener(TeleInfoListener *listener) { teleinfo_listeners_.push_back(listener); }
+void TeleInfo::register_teleinfo_listener(TeleInfoListener *listener) {
+  listener->tag_hash = fnv1_hash(listener->tag);
+  auto it = std::upper_bound(
+      teleinfo_listeners_.begin(), teleinfo_listeners_.end(), listener->tag_hash,
+      [](uint32_t hash, const TeleInfoListener *listener) { return hash < listener->tag_hash; });
+  teleinfo_listeners_.insert(it, listener);
+}
 
 }  // namespace teleinfo
 }  // namespace esphome
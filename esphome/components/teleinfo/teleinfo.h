@@ -5,17 +5,14 @@
 
 namespace esphome {
 namespace teleinfo {
-/*
- * 198 bytes should be enough to contain a full session in historical mode with
- * three phases. But go with 1024 just to be sure.
- */
 static const uint8_t MAX_TAG_SIZE = 64;
 static const uint16_t MAX_VAL_SIZE = 256;
-static const uint16_t MAX_BUF_SIZE = 1024;
 
 class TeleInfoListener {
  public:
   std::string tag;
+  /// FNV-1 hash of tag, set by TeleInfo::register_teleinfo_listener().
+  uint32_t tag_hash{0};
   virtual void publish_val(const std::string &val){};
 };
 class TeleInfo : public PollingComponent, public uart::UARTDevice {
@@ -26,25 +23,36 @@ class TeleInfo : public PollingComponent, public uart::UARTDevice {
   void setup() override;
   void update() override;
   void dump_config() override;
+  /// Sorted by tag_hash.
   std::vector<TeleInfoListener *> teleinfo_listeners_{};
 
  protected:
   uint32_t baud_rate_;
   int checksum_area_end_;
   int separator_;
-  char buf_[MAX_BUF_SIZE];
-  uint32_t buf_index_{0};
+  /// The tag and value of the group that is received, the other fields of the group aren't kept.
   char tag_[MAX_TAG_SIZE];
   char val_[MAX_VAL_SIZE];
   enum State {
     OFF,
     ON,
     START_FRAME_RECEIVED,
-    END_FRAME_RECEIVED,
   } state_{OFF};
-  bool read_chars_until_(bool drop, uint8_t c);
-  bool check_crc_(const char *grp, const char *grp_end);
-  void publish_value_(const std::string &tag, const std::string &val);
+  enum GroupState {
+    GROUP_WAIT,
+    GROUP_TAG,
+    GROUP_VALUE,
+    GROUP_OTHER_FIELDS,
+  } group_state_{GROUP_WAIT};
+  uint16_t field_len_{0};
+  uint32_t tag_hash_;
+  /// Sum of all bytes of the group so far, the last two bytes are kept to remove them from the checksum.
+  uint8_t crc_sum_;
+  uint8_t last_byte_;
+  uint8_t second_to_last_byte_;
+  void parse_byte_(uint8_t c);
+  void end_group_();
+  void publish_value_();
 };
 }  // namespace teleinfo
 }  // namespace esphome
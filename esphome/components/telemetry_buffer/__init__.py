@@ -0,0 +1,77 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor, time
+from esphome.components.http_request import HttpRequestComponent, validate_url
+from esphome.const import (
+    CONF_BUFFER_SIZE,
+    CONF_ID,
+    CONF_MQTT,
+    CONF_SENSORS,
+    CONF_TIME_ID,
+    CONF_TOPIC,
+    CONF_URL,
+)
+
+DEPENDENCIES = ["network", "sensor"]
+MULTI_CONF = True
+
+telemetry_buffer_ns = cg.esphome_ns.namespace("telemetry_buffer")
+TelemetryBuffer = telemetry_buffer_ns.class_("TelemetryBuffer", cg.PollingComponent)
+
+CONF_BATCH_SIZE = "batch_size"
+CONF_HTTP_REQUEST = "http_request"
+
+HTTP_REQUEST_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(HttpRequestComponent),
+        cv.Required(CONF_URL): validate_url,
+    }
+)
+
+MQTT_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_TOPIC): cv.publish_topic,
+        }
+    ),
+    cv.requires_component("mqtt"),
+)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(TelemetryBuffer),
+            cv.Required(CONF_SENSORS): cv.All(
+                cv.ensure_list(cv.use_id(sensor.Sensor)), cv.Length(min=1, max=255)
+            ),
+            cv.Optional(CONF_BUFFER_SIZE, default=256): cv.int_range(
+                min=1, max=65535
+            ),
+            cv.Optional(CONF_BATCH_SIZE, default=32): cv.int_range(min=1, max=1000),
+            cv.Optional(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
+            cv.Optional(CONF_HTTP_REQUEST): HTTP_REQUEST_SCHEMA,
+            cv.Optional(CONF_MQTT): MQTT_SCHEMA,
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    cv.has_exactly_one_key(CONF_HTTP_REQUEST, CONF_MQTT),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    for sensor_id in config[CONF_SENSORS]:
+        sens = await cg.get_variable(sensor_id)
+        cg.add(var.add_sensor(sens))
+    cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    cg.add(var.set_batch_size(config[CONF_BATCH_SIZE]))
+    if CONF_TIME_ID in config:
+        time_ = await cg.get_variable(config[CONF_TIME_ID])
+        cg.add(var.set_time(time_))
+    if CONF_HTTP_REQUEST in config:
+        conf = config[CONF_HTTP_REQUEST]
+        http_request = await cg.get_variable(conf[CONF_ID])
+        cg.add(var.set_http_request(http_request, conf[CONF_URL]))
+    if CONF_MQTT in config:
+        cg.add(var.set_mqtt_topic(config[CONF_MQTT][CONF_TOPIC]))
@@ -0,0 +1,137 @@
+#include "telemetry_buffer.h"
+#include "esphome/core/log.h"
+#include "esphome/core/util.h"
+#include <cmath>
+
+#ifdef USE_MQTT
+#include "esphome/components/mqtt/mqtt_client.h"
+#endif
+
+namespace esphome {
+namespace telemetry_buffer {
+
+static const char *const TAG = "telemetry_buffer";
+
+void TelemetryBuffer::setup() {
+  for (size_t i = 0; i < this->sensors_.size(); i++) {
+    uint8_t index = i;
+    this->sensors_[i]->add_on_state_callback([this, index](float value) { this->add_(index, value); });
+  }
+  this->disable_loop();
+}
+
+void TelemetryBuffer::update() {
+  this->upload_failed_ = false;
+  if (!this->records_.empty())
+    this->enable_loop();
+}
+
+void TelemetryBuffer::loop() {
+  size_t count = std::min<size_t>(this->records_.size(), this->batch_size_);
+  if (count == 0 || !network_is_connected()) {
+    this->disable_loop();
+    return;
+  }
+
+  if (!this->send_batch_(this->encode_batch_(count))) {
+    ESP_LOGW(TAG, "Uploading %u states failed, keeping them buffered", (unsigned) count);
+    this->status_set_warning();
+    this->upload_failed_ = true;
+    this->disable_loop();
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++)
+    this->records_.pop_front();
+  this->status_clear_warning();
+  ESP_LOGD(TAG, "Uploaded %u states, %u still buffered", (unsigned) count, (unsigned) this->records_.size());
+}
+
+void TelemetryBuffer::dump_config() {
+  ESP_LOGCONFIG(TAG, "Telemetry Buffer:");
+  ESP_LOGCONFIG(TAG, "  Buffer Size: %u states (%u bytes)", (unsigned) this->records_.capacity(),
+                (unsigned) (this->records_.capacity() * sizeof(TelemetryRecord)));
+  ESP_LOGCONFIG(TAG, "  Batch Size: %u", this->batch_size_);
+#ifdef USE_HTTP_REQUEST
+  if (this->http_request_ != nullptr)
+    ESP_LOGCONFIG(TAG, "  URL: %s", this->url_.c_str());
+#endif
+#ifdef USE_MQTT
+  if (!this->mqtt_topic_.empty())
+    ESP_LOGCONFIG(TAG, "  MQTT Topic: %s", this->mqtt_topic_.c_str());
+#endif
+  for (auto *sensor : this->sensors_)
+    ESP_LOGCONFIG(TAG, "  Sensor: '%s'", sensor->get_name().c_str());
+  LOG_UPDATE_INTERVAL(this);
+}
+
+void TelemetryBuffer::add_(uint8_t sensor, float value) {
+  if (!std::isfinite(value))
+    return;
+  if (this->records_.full())
+    this->dropped_count_++;
+  this->records_.push_back(TelemetryRecord{millis(), value, sensor});
+  if (!this->upload_failed_ && this->records_.size() >= this->batch_size_)
+    this->enable_loop();
+}
+
+std::string TelemetryBuffer::encode_batch_(size_t count) {
+  uint32_t now = millis();
+  time_t timestamp = 0;
+#ifdef USE_TIME
+  if (this->time_ != nullptr && this->time_->utcnow().is_valid())
+    timestamp = this->time_->timestamp_now();
+#endif
+
+  std::string payload;
+  payload.reserve(count * 48);
+  payload += '[';
+  char buffer[24];
+  for (size_t i = 0; i < count; i++) {
+    const TelemetryRecord &record = this->records_[i];
+    sensor::Sensor *sensor = this->sensors_[record.sensor];
+    if (i != 0)
+      payload += ',';
+    payload += R"({"sensor":")";
+    payload += sensor->get_object_id();
+    payload += R"(","value":)";
+    payload += value_accuracy_to_string(record.value, sensor->get_accuracy_decimals());
+    uint32_t age = now - record.time;
+    if (timestamp != 0) {
+      snprintf(buffer, sizeof(buffer), R"(,"time":%ld})", long(timestamp - age / 1000));
+    } else {
+      snprintf(buffer, sizeof(buffer), R"(,"age":%u})", age);
+    }
+    payload += buffer;
+  }
+  payload += ']';
+  return payload;
+}
+
+bool TelemetryBuffer::send_batch_(const std::string &payload) {
+#ifdef USE_HTTP_REQUEST
+  if (this->http_request_ != nullptr) {
+    this->http_request_->set_url(this->url_);
+    this->http_request_->set_method("POST");
+    this->http_request_->set_body(payload);
+    this->http_request_->set_headers({{"Content-Type", "application/json"}});
+    bool success = this->http_request_->send({});
+    this->http_request_->close();
+    // Don't leak the batch into the next http_request action, which only sets what it configures
+    this->http_request_->set_body("");
+    this->http_request_->set_headers({});
+    return success;
+  }
+#endif
+#ifdef USE_MQTT
+  if (!this->mqtt_topic_.empty()) {
+    if (!mqtt::global_mqtt_client->is_connected())
+      return false;
+    return mqtt::global_mqtt_client->publish(this->mqtt_topic_, payload);
+  }
+#endif
+  return false;
+}
+
+}  // namespace telemetry_buffer
+}  // namespace esphome
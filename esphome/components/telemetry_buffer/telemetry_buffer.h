@@ -0,0 +1,91 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/sensor/sensor.h"
+#include <string>
+#include <vector>
+
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif
+#ifdef USE_HTTP_REQUEST
+#include "esphome/components/http_request/http_request.h"
+#endif
+
+namespace esphome {
+namespace telemetry_buffer {
+
+/// One buffered sensor state.
+struct TelemetryRecord {
+  /// millis() when the state was published.
+  uint32_t time;
+  float value;
+  /// Index into the sensors of the buffer.
+  uint8_t sensor;
+};
+
+/** Buffers the states of some sensors and uploads them in batches, to an HTTP server or an MQTT topic.
+ *
+ * States are kept in a ring buffer in RAM while the network or the server is unreachable, when it is full the
+ * oldest states are dropped. Every update interval, and as soon as a batch is full, the buffered states are sent
+ * from loop(), one batch per iteration, as a JSON array of `{"sensor": <object id>, "value": <state>}` objects
+ * that also contain the unix `time` of the state if a time source is set and valid, or otherwise its `age` in ms.
+ * A batch is only removed from the buffer once it was sent successfully.
+ */
+class TelemetryBuffer : public PollingComponent {
+ public:
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
+
+  void add_sensor(sensor::Sensor *sensor) { this->sensors_.push_back(sensor); }
+  void set_buffer_size(size_t buffer_size) { this->records_.set_capacity(buffer_size); }
+  void set_batch_size(uint16_t batch_size) { this->batch_size_ = batch_size; }
+#ifdef USE_TIME
+  void set_time(time::RealTimeClock *time) { this->time_ = time; }
+#endif
+#ifdef USE_HTTP_REQUEST
+  void set_http_request(http_request::HttpRequestComponent *http_request, const std::string &url) {
+    this->http_request_ = http_request;
+    this->url_ = url;
+  }
+#endif
+#ifdef USE_MQTT
+  void set_mqtt_topic(const std::string &topic) { this->mqtt_topic_ = topic; }
+#endif
+
+  /// Number of states waiting to be uploaded.
+  size_t size() const { return this->records_.size(); }
+  /// Number of states that were dropped because the buffer was full.
+  uint32_t get_dropped_count() const { return this->dropped_count_; }
+
+ protected:
+  void add_(uint8_t sensor, float value);
+  /// Encode the oldest `count` buffered states.
+  std::string encode_batch_(size_t count);
+  bool send_batch_(const std::string &payload);
+
+  std::vector<sensor::Sensor *> sensors_;
+  RingBuffer<TelemetryRecord> records_;
+  uint16_t batch_size_{32};
+  uint32_t dropped_count_{0};
+  /// Set when an upload failed, the next attempt waits for the next update.
+  bool upload_failed_{false};
+#ifdef USE_TIME
+  time::RealTimeClock *time_{nullptr};
+#endif
+#ifdef USE_HTTP_REQUEST
+  http_request::HttpRequestComponent *http_request_{nullptr};
+  std::string url_;
+#endif
+#ifdef USE_MQTT
+  std::string mqtt_topic_;
+#endif
+};
+
+}  // namespace telemetry_buffer
+}  // namespace esphome
@@ -12,7 +12,7 @@ void TemplateTextSensor::update() {
 
   auto val = (*this->f_)();
   if (val.has_value()) {
-    this->publish_state(*val);
+    this->publish_state(std::move(*val));
   }
 }
 float TemplateTextSensor::get_setup_priority() const { return setup_priority::HARDWARE; }
@@ -12,7 +12,7 @@ namespace text_sensor {
 class TextSensorStateTrigger : public Trigger<std::string> {
  public:
   explicit TextSensorStateTrigger(TextSensor *parent) {
-    parent->add_on_state_callback([this](std::string value) { this->trigger(std::move(value)); });
+    parent->add_on_state_callback([this](const std::string &value) { this->trigger(value); });
   }
 };
 
@@ -22,7 +22,7 @@ template<typename... Ts> class TextSensorStateCondition : public Condition<Ts...
 
   TEMPLATABLE_VALUE(std::string, state)
 
-  bool check(Ts... x) override { return this->parent_->state == this->state_.value(x...); }
+  bool check(const Ts &... x) override { return this->parent_->state == this->state_.value(x...); }
 
  protected:
   TextSensor *parent_;
@@ -33,7 +33,7 @@ template<typename... Ts> class TextSensorPublishAction : public Action<Ts...> {
   TextSensorPublishAction(TextSensor *sensor) : sensor_(sensor) {}
   TEMPLATABLE_VALUE(std::string, state)
 
-  void play(Ts... x) override { this->sensor_->publish_state(this->state_.value(x...)); }
+  void play(const Ts &... x) override { this->sensor_->publish_state(this->state_.value(x...)); }
 
  protected:
   TextSensor *sensor_;
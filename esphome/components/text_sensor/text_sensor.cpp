@@ -9,19 +9,18 @@ static const char *const TAG = "text_sensor";
 TextSensor::TextSensor() : TextSensor("") {}
 TextSensor::TextSensor(const std::string &name) : Nameable(name) {}
 
-void TextSensor::publish_state(const std::string &state) {
-  this->state = state;
+void TextSensor::publish_state(std::string state) {
+  if (this->has_state_ && this->state == state)
+    return;
+  this->state = std::move(state);
   this->has_state_ = true;
-  ESP_LOGD(TAG, "'%s': Sending state '%s'", this->name_.c_str(), state.c_str());
-  this->callback_.call(state);
-}
-void TextSensor::set_icon(const std::string &icon) { this->icon_ = icon; }
-void TextSensor::add_on_state_callback(std::function<void(std::string)> callback) {
-  this->callback_.add(std::move(callback));
+  ESP_LOGD(TAG, "'%s': Sending state '%s'", this->name_.c_str(), this->state.c_str());
+  this->callback_.call(this->state);
 }
+void TextSensor::set_icon(const char *icon) { this->icon_ = icon; }
 std::string TextSensor::get_icon() {
-  if (this->icon_.has_value())
-    return *this->icon_;
+  if (this->icon_ != nullptr)
+    return this->icon_;
   return this->icon();
 }
 std::string TextSensor::icon() { return ""; }
@@ -22,11 +22,16 @@ class TextSensor : public Nameable {
   explicit TextSensor();
   explicit TextSensor(const std::string &name);
 
-  void publish_state(const std::string &state);
+  /** Publish a new state, pass a temporary or std::move() it to avoid a copy.
+   *
+   * Like for binary sensors, a state that equals the current one is not published again.
+   */
+  void publish_state(std::string state);
 
-  void set_icon(const std::string &icon);
+  void set_icon(const char *icon);
 
-  void add_on_state_callback(std::function<void(std::string)> callback);
+  /// Add a callback for new states, it is handed a reference to the state instead of a copy.
+  template<typename F> void add_on_state_callback(F &&callback) { this->callback_.add(std::forward<F>(callback)); }
 
   std::string state;
 
@@ -43,8 +48,8 @@ class TextSensor : public Nameable {
  protected:
   uint32_t hash_base() override;
 
-  CallbackManager<void(std::string)> callback_;
-  optional<std::string> icon_;
+  CallbackManager<void(const std::string &)> callback_;
+  const char *icon_{nullptr};  ///< nullptr means use icon(), empty means no icon
   bool has_state_{false};
 };
 
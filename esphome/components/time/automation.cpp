@@ -1,11 +1,18 @@
 #include "automation.h"
 #include "esphome/core/log.h"
+#include <sys/time.h>
 
 namespace esphome {
 namespace time {
 
 static const char *const TAG = "automation";
 
+static const char *const CHECK_TIMEOUT = "check";
+/// Longest time to sleep before looking at the clock again, also bounds the error of a drifting clock.
+static const uint32_t MAX_TIMEOUT = 60 * 60 * 1000;
+/// A step skips to the next second, minute, hour or day (in two steps), this covers about five years of days.
+static const uint32_t MAX_SEARCH_STEPS = 4000;
+
 void CronTrigger::add_second(uint8_t second) { this->seconds_[second] = true; }
 void CronTrigger::add_minute(uint8_t minute) { this->minutes_[minute] = true; }
 void CronTrigger::add_hour(uint8_t hour) { this->hours_[hour] = true; }
@@ -16,37 +23,65 @@ bool CronTrigger::matches(const ESPTime &time) {
   return time.is_valid() && this->seconds_[time.second] && this->minutes_[time.minute] && this->hours_[time.hour] &&
          this->days_of_month_[time.day_of_month] && this->months_[time.month] && this->days_of_week_[time.day_of_week];
 }
-void CronTrigger::loop() {
-  ESPTime time = this->rtc_->now();
-  if (!time.is_valid())
+void CronTrigger::setup() {
+  this->rtc_->add_on_time_sync_callback([this]() { this->check_(); });
+  this->check_();
+}
+void CronTrigger::check_() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  time_t now = tv.tv_sec;
+  if (!ESPTime::from_epoch_local(now).is_valid()) {
+    // The time sync callback usually gets there first
+    this->set_timeout(CHECK_TIMEOUT, 1000, [this]() { this->check_(); });
     return;
+  }
 
-  if (this->last_check_.has_value()) {
-    if (*this->last_check_ >= time) {
-      // already handled this one
-      return;
-    }
-
-    while (true) {
-      this->last_check_->increment_second();
-      if (*this->last_check_ >= time)
-        break;
-
-      if (this->matches(*this->last_check_))
-        this->trigger();
+  if (this->last_check_ == 0)
+    this->last_check_ = now - 1;
+  optional<time_t> next = this->next_match_(this->last_check_);
+  // A clock that was set back is not checked again until it passes the last check, so nothing fires twice
+  if (now > this->last_check_) {
+    while (next.has_value() && *next <= now) {
+      this->last_check_ = *next;
+      this->trigger();
+      next = this->next_match_(this->last_check_);
     }
+    this->last_check_ = now;
   }
 
-  this->last_check_ = time;
-  if (!time.fields_in_range()) {
-    ESP_LOGW(TAG, "Time is out of range!");
-    ESP_LOGD(TAG, "Second=%02u Minute=%02u Hour=%02u DayOfWeek=%u DayOfMonth=%u DayOfYear=%u Month=%u time=%ld",
-             time.second, time.minute, time.hour, time.day_of_week, time.day_of_month, time.day_of_year, time.month,
-             time.timestamp);
+  uint32_t delay = MAX_TIMEOUT;
+  if (!next.has_value()) {
+    ESP_LOGV(TAG, "No matching time in the next years");
+  } else if (*next - now <= MAX_TIMEOUT / 1000) {
+    // Aim for the start of the second, when woken up early this is simply checked again
+    delay = uint32_t(*next - now) * 1000 - tv.tv_usec / 1000;
   }
-
-  if (this->matches(time))
-    this->trigger();
+  this->set_timeout(CHECK_TIMEOUT, delay, [this]() { this->check_(); });
+}
+optional<time_t> CronTrigger::next_match_(time_t after) {
+  time_t candidate = after + 1;
+  for (uint32_t step = 0; step < MAX_SEARCH_STEPS; step++) {
+    ESPTime time = ESPTime::from_epoch_local(candidate);
+    uint32_t into_hour = time.minute * 60u + time.second;
+    if (!this->months_[time.month] || !this->days_of_month_[time.day_of_month] ||
+        !this->days_of_week_[time.day_of_week]) {
+      // Next day, via 23:00 so that days that are shorter or longer because of DST are not overshot
+      candidate += time.hour < 23 ? (23 - time.hour) * 3600 - into_hour : 3600 - into_hour;
+    } else if (!this->hours_[time.hour]) {
+      candidate += 3600 - into_hour;
+    } else if (!this->minutes_[time.minute]) {
+      candidate += 60 - time.second;
+    } else {
+      uint8_t second = time.second;
+      while (second < 60 && !this->seconds_[second])
+        second++;
+      if (second < 60)
+        return candidate + (second - time.second);
+      candidate += 60 - time.second;
+    }
+  }
+  return {};
 }
 CronTrigger::CronTrigger(RealTimeClock *rtc) : rtc_(rtc) {}
 void CronTrigger::add_seconds(const std::vector<uint8_t> &seconds) {
@@ -7,6 +7,11 @@
 namespace esphome {
 namespace time {
 
+/** Fires whenever the local time matches all of its seconds, minutes, hours, days and months.
+ *
+ * Instead of comparing every second against the pattern, the next matching time is searched once and a timeout is
+ * armed for it. Matches that were skipped because the clock jumped forward fire when the time is synchronized.
+ */
 class CronTrigger : public Trigger<>, public Component {
  public:
   explicit CronTrigger(RealTimeClock *rtc);
@@ -23,10 +28,15 @@ class CronTrigger : public Trigger<>, public Component {
   void add_day_of_week(uint8_t day_of_week);
   void add_days_of_week(const std::vector<uint8_t> &days_of_week);
   bool matches(const ESPTime &time);
-  void loop() override;
+  void setup() override;
   float get_setup_priority() const override;
 
  protected:
+  /// Fire all matches since the last check, then arm a timeout for the next one.
+  void check_();
+  /// The first matching timestamp after `after`, searching a few years ahead at most.
+  optional<time_t> next_match_(time_t after);
+
   std::bitset<61> seconds_;
   std::bitset<60> minutes_;
   std::bitset<24> hours_;
@@ -34,7 +44,8 @@ class CronTrigger : public Trigger<>, public Component {
   std::bitset<13> months_;
   std::bitset<8> days_of_week_;
   RealTimeClock *rtc_;
-  optional<ESPTime> last_check_;
+  /// The last second that was checked for matches, 0 before the time was first valid.
+  time_t last_check_{0};
 };
 
 class SyncTrigger : public Trigger<>, public Component {
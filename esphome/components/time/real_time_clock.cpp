@@ -11,12 +11,33 @@ namespace time {
 
 static const char *const TAG = "time";
 
+/// UTC offsets are multiples of 15 minutes and DST changes at full local hours, so the offset of the local time
+/// can only change at the start of a 15 minute window of UTC time.
+static const time_t OFFSET_WINDOW = 15 * 60;
+
 RealTimeClock::RealTimeClock() = default;
 void RealTimeClock::call_setup() {
   setenv("TZ", this->timezone_.c_str(), 1);
   tzset();
+  this->offset_window_ = -1;
   PollingComponent::call_setup();
 }
+ESPTime RealTimeClock::now() {
+  time_t epoch = this->timestamp_now();
+  time_t window = epoch - epoch % OFFSET_WINDOW;
+  if (window != this->offset_window_) {
+    // localtime() evaluates the time zone rules, only do that once per window
+    ESPTime local = ESPTime::from_epoch_local(window);
+    this->is_dst_ = local.is_dst;
+    local.recalc_timestamp_utc(false);
+    this->utc_offset_ = local.timestamp - window;
+    this->offset_window_ = window;
+  }
+  ESPTime res = ESPTime::from_epoch_utc(epoch + this->utc_offset_);
+  res.is_dst = this->is_dst_;
+  res.timestamp = epoch;
+  return res;
+}
 void RealTimeClock::synchronize_epoch_(uint32_t epoch) {
   struct timeval timev {
     .tv_sec = static_cast<time_t>(epoch), .tv_usec = 0,
@@ -42,7 +63,7 @@ void RealTimeClock::synchronize_epoch_(uint32_t epoch) {
   this->time_sync_callback_.call();
 }
 
-size_t ESPTime::strftime(char *buffer, size_t buffer_len, const char *format) {
+size_t ESPTime::strftime(char *buffer, size_t buffer_len, const char *format) const {
   struct tm c_tm = this->to_c_tm();
   return ::strftime(buffer, buffer_len, format, &c_tm);
 }
@@ -60,7 +81,7 @@ ESPTime ESPTime::from_c_tm(struct tm *c_tm, time_t c_time) {
   res.timestamp = c_time;
   return res;
 }
-struct tm ESPTime::to_c_tm() {
+struct tm ESPTime::to_c_tm() const {
   struct tm c_tm {};
   c_tm.tm_sec = this->second;
   c_tm.tm_min = this->minute;
@@ -73,11 +94,19 @@ struct tm ESPTime::to_c_tm() {
   c_tm.tm_isdst = this->is_dst;
   return c_tm;
 }
-std::string ESPTime::strftime(const std::string &format) {
-  std::string timestr;
-  timestr.resize(format.size() * 4);
+std::string ESPTime::strftime(const std::string &format) const {
+  if (format.empty())
+    return {};
   struct tm c_tm = this->to_c_tm();
-  size_t len = ::strftime(&timestr[0], timestr.size(), format.c_str(), &c_tm);
+  // Format on the stack first, so that the usual short result is allocated only once at the right size
+  char buffer[64];
+  size_t len = ::strftime(buffer, sizeof(buffer), format.c_str(), &c_tm);
+  if (len != 0)
+    return std::string(buffer, len);
+
+  std::string timestr;
+  timestr.resize(sizeof(buffer) * 2);
+  len = ::strftime(&timestr[0], timestr.size(), format.c_str(), &c_tm);
   while (len == 0) {
     timestr.resize(timestr.size() * 2);
     len = ::strftime(&timestr[0], timestr.size(), format.c_str(), &c_tm);
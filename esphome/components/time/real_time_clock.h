@@ -36,11 +36,13 @@ struct ESPTime {
   time_t timestamp;
 
   /** Convert this ESPTime struct to a null-terminated c string buffer as specified by the format argument.
-   * Up to buffer_len bytes are written.
+   * Up to buffer_len bytes are written. Nothing is allocated, prefer this for anything that is formatted often,
+   * like a clock on a display.
    *
+   * @return The length of the result without the terminator, 0 if it did not fit.
    * @see https://www.gnu.org/software/libc/manual/html_node/Formatting-Calendar-Time.html#index-strftime
    */
-  size_t strftime(char *buffer, size_t buffer_len, const char *format);
+  size_t strftime(char *buffer, size_t buffer_len, const char *format) const;
 
   /** Convert this ESPTime struct to a string as specified by the format argument.
    * @see https://www.gnu.org/software/libc/manual/html_node/Formatting-Calendar-Time.html#index-strftime
@@ -48,7 +50,7 @@ struct ESPTime {
    * @warning This method uses dynamically allocated strings which can cause heap fragmentation with some
    * microcontrollers.
    */
-  std::string strftime(const std::string &format);
+  std::string strftime(const std::string &format) const;
 
   /// Check if this ESPTime is valid (all fields in range and year is greater than 2018)
   bool is_valid() const { return this->year >= 2019 && this->fields_in_range(); }
@@ -86,7 +88,7 @@ struct ESPTime {
   void recalc_timestamp_utc(bool use_day_of_year = true);
 
   /// Convert this ESPTime instance back to a tm struct.
-  struct tm to_c_tm();
+  struct tm to_c_tm() const;
 
   /// Increment this clock instance by one second.
   void increment_second();
@@ -114,7 +116,7 @@ class RealTimeClock : public PollingComponent {
   std::string get_timezone() { return this->timezone_; }
 
   /// Get the time in the currently defined timezone.
-  ESPTime now() { return ESPTime::from_epoch_local(this->timestamp_now()); }
+  ESPTime now();
 
   /// Get the time without any time zone or DST corrections.
   ESPTime utcnow() { return ESPTime::from_epoch_utc(this->timestamp_now()); }
@@ -134,13 +136,18 @@ class RealTimeClock : public PollingComponent {
 
   std::string timezone_{};
 
+  /// Start of the UTC window the cached offset of the local time is valid for, -1 if none is cached.
+  time_t offset_window_{-1};
+  int32_t utc_offset_{0};
+  bool is_dst_{false};
+
   CallbackManager<void()> time_sync_callback_;
 };
 
 template<typename... Ts> class TimeHasTimeCondition : public Condition<Ts...> {
  public:
   TimeHasTimeCondition(RealTimeClock *parent) : parent_(parent) {}
-  bool check(Ts... x) override { return this->parent_->now().is_valid(); }
+  bool check(const Ts &... x) override { return this->parent_->now().is_valid(); }
 
  protected:
   RealTimeClock *parent_;
@@ -119,27 +119,29 @@ void TLC59208FOutput::dump_config() {
 }
 
 void TLC59208FOutput::loop() {
-  if (this->min_channel_ == 0xFF || !this->update_)
+  if (this->min_channel_ == 0xFF || this->update_channels_ == 0)
     return;
 
-  for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
-    uint8_t pwm = this->pwm_amounts_[channel];
-    ESP_LOGVV(TAG, "Channel %02u: pwm=%04u ", channel, pwm);
+  // The PWMx registers are consecutive, write the range of changed channels in one auto-increment (AI2) burst
+  uint8_t first = __builtin_ctz(this->update_channels_);
+  uint8_t last = 31 - __builtin_clz(this->update_channels_);
+  for (uint8_t channel = first; channel <= last; channel++)
+    ESP_LOGVV(TAG, "Channel %02u: pwm=%04u ", channel, this->pwm_amounts_[channel]);
 
-    uint8_t reg = TLC59208F_REG_PWM0 + channel;
-    if (!this->write_byte(reg, pwm)) {
-      this->status_set_warning();
-      return;
-    }
+  uint8_t reg = TLC59208F_REG_PWM0 + first;
+  if (!this->write_bytes(reg, &this->pwm_amounts_[first], last - first + 1)) {
+    this->status_set_warning();
+    return;
   }
 
   this->status_clear_warning();
-  this->update_ = false;
+  this->update_channels_ = 0;
 }
 
 TLC59208FChannel *TLC59208FOutput::create_channel(uint8_t channel) {
   this->min_channel_ = std::min(this->min_channel_, channel);
   this->max_channel_ = std::max(this->max_channel_, channel);
+  this->update_channels_ |= 1 << channel;
   auto *c = new TLC59208FChannel(this, channel);
   return c;
 }
@@ -49,7 +49,7 @@ class TLC59208FOutput : public Component, public i2c::I2CDevice {
 
   void set_channel_value_(uint8_t channel, uint8_t value) {
     if (this->pwm_amounts_[channel] != value)
-      this->update_ = true;
+      this->update_channels_ |= 1 << channel;
     this->pwm_amounts_[channel] = value;
   }
 
@@ -60,7 +60,8 @@ class TLC59208FOutput : public Component, public i2c::I2CDevice {
   uint8_t pwm_amounts_[256] = {
       0,
   };
-  bool update_{true};
+  /// Bit mask of the channels that changed since the last loop(), written together in the next one
+  uint8_t update_channels_{0};
 };
 
 }  // namespace tlc59208f
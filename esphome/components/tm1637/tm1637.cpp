@@ -162,26 +162,43 @@ void TM1637Display::stop_() {
 void TM1637Display::display() {
   ESP_LOGVV(TAG, "Display %02X%02X%02X%02X", buffer_[0], buffer_[1], buffer_[2], buffer_[3]);
 
-  // Write COMM1
-  this->start_();
-  this->send_byte_(TM1637_I2C_COMM1);
-  this->stop_();
+  // Only send the range of digits that changed since the last transmission, every bit takes 200us
+  uint8_t first = sizeof(this->buffer_);
+  uint8_t last = 0;
+  for (uint8_t i = 0; i < sizeof(this->buffer_); i++) {
+    if (!this->sent_valid_ || this->buffer_[i] != this->sent_buffer_[i]) {
+      first = std::min(first, i);
+      last = i;
+    }
+  }
 
-  // Write COMM2 + first digit address
-  this->start_();
-  this->send_byte_(TM1637_I2C_COMM2);
+  if (first < sizeof(this->buffer_)) {
+    // Write COMM1
+    this->start_();
+    this->send_byte_(TM1637_I2C_COMM1);
+    this->stop_();
 
-  // Write the data bytes
-  for (auto b : this->buffer_) {
-    this->send_byte_(b);
-  }
+    // Write COMM2 + first digit address
+    this->start_();
+    this->send_byte_(TM1637_I2C_COMM2 + first);
+
+    // Write the data bytes
+    for (uint8_t i = first; i <= last; i++) {
+      this->send_byte_(this->buffer_[i]);
+      this->sent_buffer_[i] = this->buffer_[i];
+    }
 
-  this->stop_();
+    this->stop_();
+  }
 
-  // Write COMM3 + brightness
-  this->start_();
-  this->send_byte_(TM1637_I2C_COMM3 + ((this->intensity_ & 0x7) | 0x08));
-  this->stop_();
+  if (!this->sent_valid_ || this->intensity_ != this->sent_intensity_) {
+    // Write COMM3 + brightness
+    this->start_();
+    this->send_byte_(TM1637_I2C_COMM3 + ((this->intensity_ & 0x7) | 0x08));
+    this->stop_();
+    this->sent_intensity_ = this->intensity_;
+  }
+  this->sent_valid_ = true;
 }
 bool TM1637Display::send_byte_(uint8_t b) {
   uint8_t data = b;
@@ -286,14 +303,16 @@ uint8_t TM1637Display::printf(const char *format, ...) {
 }
 
 #ifdef USE_TIME
-uint8_t TM1637Display::strftime(uint8_t pos, const char *format, time::ESPTime time) {
+uint8_t TM1637Display::strftime(uint8_t pos, const char *format, const time::ESPTime &time) {
   char buffer[64];
   size_t ret = time.strftime(buffer, sizeof(buffer), format);
   if (ret > 0)
     return this->print(pos, buffer);
   return 0;
 }
-uint8_t TM1637Display::strftime(const char *format, time::ESPTime time) { return this->strftime(0, format, time); }
+uint8_t TM1637Display::strftime(const char *format, const time::ESPTime &time) {
+  return this->strftime(0, format, time);
+}
 #endif
 
 }  // namespace tm1637
@@ -46,10 +46,10 @@ class TM1637Display : public PollingComponent {
 
 #ifdef USE_TIME
   /// Evaluate the strftime-format and print the result at the given position.
-  uint8_t strftime(uint8_t pos, const char *format, time::ESPTime time) __attribute__((format(strftime, 3, 0)));
+  uint8_t strftime(uint8_t pos, const char *format, const time::ESPTime &time) __attribute__((format(strftime, 3, 0)));
 
   /// Evaluate the strftime-format and print the result at position 0.
-  uint8_t strftime(const char *format, time::ESPTime time) __attribute__((format(strftime, 2, 0)));
+  uint8_t strftime(const char *format, const time::ESPTime &time) __attribute__((format(strftime, 2, 0)));
 #endif
 
  protected:
@@ -64,6 +64,10 @@ class TM1637Display : public PollingComponent {
   uint8_t intensity_;
   optional<tm1637_writer_t> writer_{};
   uint8_t buffer_[6] = {0};
+  /// The digits and intensity the display currently shows, to only send what changed
+  uint8_t sent_buffer_[6] = {0};
+  uint8_t sent_intensity_;
+  bool sent_valid_{false};
 };
 
 }  // namespace tm1637
@@ -43,7 +43,7 @@ template<typename... Ts> class SetLevelPercentAction : public Action<Ts...>, pub
  public:
   TEMPLATABLE_VALUE(uint8_t, level_percent)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto level_percent = this->level_percent_.value(x...);
     this->parent_->set_level_percent(level_percent);
   }
@@ -53,7 +53,7 @@ template<typename... Ts> class SetLevelAction : public Action<Ts...>, public Par
  public:
   TEMPLATABLE_VALUE(uint8_t, level)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto level = this->level_.value(x...);
     this->parent_->set_level(level);
   }
@@ -63,7 +63,7 @@ template<typename... Ts> class SetBrightnessAction : public Action<Ts...>, publi
  public:
   TEMPLATABLE_VALUE(uint8_t, brightness)
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     auto brightness = this->brightness_.value(x...);
     this->parent_->set_brightness(brightness);
   }
@@ -71,12 +71,12 @@ template<typename... Ts> class SetBrightnessAction : public Action<Ts...>, publi
 
 template<typename... Ts> class TurnOnAction : public Action<Ts...>, public Parented<TM1651Display> {
  public:
-  void play(Ts... x) override { this->parent_->turn_on(); }
+  void play(const Ts &... x) override { this->parent_->turn_on(); }
 };
 
 template<typename... Ts> class TurnOffAction : public Action<Ts...>, public Parented<TM1651Display> {
  public:
-  void play(Ts... x) override { this->parent_->turn_off(); }
+  void play(const Ts &... x) override { this->parent_->turn_off(); }
 };
 
 }  // namespace tm1651
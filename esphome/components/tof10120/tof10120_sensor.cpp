@@ -24,19 +24,24 @@ void TOF10120Sensor::dump_config() {
 void TOF10120Sensor::setup() {}
 
 void TOF10120Sensor::update() {
-  if (!this->write_bytes(TOF10120_DISTANCE_REGISTER, TOF10120_READ_DISTANCE_CMD, sizeof(TOF10120_READ_DISTANCE_CMD))) {
-    ESP_LOGE(TAG, "Communication with TOF10120 failed on write");
-    this->status_set_warning();
-    return;
-  }
-
-  uint8_t data[2];
-  if (!this->read_bytes(TOF10120_DISTANCE_REGISTER, data, 2, TOF10120_DEFAULT_DELAY)) {
-    ESP_LOGE(TAG, "Communication with TOF10120 failed on read");
-    this->status_set_warning();
-    return;
-  }
+  // Let the sensor measure without blocking the main loop
+  auto transaction = this->transaction();
+  transaction.write({TOF10120_DISTANCE_REGISTER, TOF10120_READ_DISTANCE_CMD[0]})
+      .write({TOF10120_DISTANCE_REGISTER})
+      .wait(TOF10120_DEFAULT_DELAY)
+      .read(2)
+      .then([this](bool success, const std::vector<uint8_t> &data) {
+        if (!success) {
+          ESP_LOGE(TAG, "Communication with TOF10120 failed");
+          this->status_set_warning();
+          return;
+        }
+        this->publish_distance_(data);
+      });
+  this->queue_transaction(std::move(transaction));
+}
 
+void TOF10120Sensor::publish_distance_(const std::vector<uint8_t> &data) {
   uint32_t distance_mm = (data[0] << 8) | data[1];
   ESP_LOGI(TAG, "Data read: %dmm", distance_mm);
 
@@ -14,6 +14,9 @@ class TOF10120Sensor : public sensor::Sensor, public PollingComponent, public i2
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
   void update() override;
+
+ protected:
+  void publish_distance_(const std::vector<uint8_t> &data);
 };
 }  // namespace tof10120
 }  // namespace esphome
@@ -126,6 +126,8 @@ void ToshibaClimate::transmit_state() {
   transmit.perform();
 }
 
+remote_base::RemoteSignature ToshibaClimate::get_signature() { return {TOSHIBA_HEADER_MARK, TOSHIBA_HEADER_SPACE}; }
+
 bool ToshibaClimate::on_receive(remote_base::RemoteReceiveData data) {
   uint8_t message[16] = {0};
   uint8_t message_length = 4;
@@ -15,6 +15,7 @@ class ToshibaClimate : public climate_ir::ClimateIR {
  protected:
   void transmit_state() override;
   bool on_receive(remote_base::RemoteReceiveData data) override;
+  remote_base::RemoteSignature get_signature() override;
 };
 
 } /* namespace toshiba */
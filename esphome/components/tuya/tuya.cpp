@@ -14,10 +14,11 @@ void Tuya::setup() {
 }
 
 void Tuya::loop() {
-  while (this->available()) {
-    uint8_t c;
-    this->read_byte(&c);
-    this->handle_char_(c);
+  const uint8_t *data;
+  size_t len;
+  while ((len = this->read_buffer(&data)) != 0) {
+    for (size_t i = 0; i < len; i++)
+      this->handle_char_(data[i]);
   }
   process_command_queue_();
 }
@@ -32,13 +33,13 @@ void Tuya::dump_config() {
   }
   for (auto &info : this->datapoints_) {
     if (info.type == TuyaDatapointType::RAW)
-      ESP_LOGCONFIG(TAG, "  Datapoint %u: raw (value: %s)", info.id, hexencode(info.value_raw).c_str());
+      ESP_LOGCONFIG(TAG, "  Datapoint %u: raw (value: %s)", info.id, hexencode(info.value_data, info.len).c_str());
     else if (info.type == TuyaDatapointType::BOOLEAN)
       ESP_LOGCONFIG(TAG, "  Datapoint %u: switch (value: %s)", info.id, ONOFF(info.value_bool));
     else if (info.type == TuyaDatapointType::INTEGER)
       ESP_LOGCONFIG(TAG, "  Datapoint %u: int value (value: %d)", info.id, info.value_int);
     else if (info.type == TuyaDatapointType::STRING)
-      ESP_LOGCONFIG(TAG, "  Datapoint %u: string value (value: %s)", info.id, info.value_string.c_str());
+      ESP_LOGCONFIG(TAG, "  Datapoint %u: string value (value: %s)", info.id, info.value_string().c_str());
     else if (info.type == TuyaDatapointType::ENUM)
       ESP_LOGCONFIG(TAG, "  Datapoint %u: enum (value: %d)", info.id, info.value_enum);
     else if (info.type == TuyaDatapointType::BITMASK)
@@ -117,6 +118,11 @@ void Tuya::handle_char_(uint8_t c) {
 }
 
 void Tuya::handle_command_(uint8_t command, uint8_t version, const uint8_t *buffer, size_t len) {
+  if (this->expected_response_.has_value() && static_cast<uint8_t>(*this->expected_response_) == command) {
+    this->expected_response_.reset();
+    this->response_received_ = true;
+  }
+
   switch ((TuyaCommandType) command) {
     case TuyaCommandType::HEARTBEAT:
       ESP_LOGV(TAG, "MCU Heartbeat (0x%02X)", buffer[0]);
@@ -239,8 +245,8 @@ void Tuya::handle_datapoint_(const uint8_t *buffer, size_t len) {
 
   switch (datapoint.type) {
     case TuyaDatapointType::RAW:
-      datapoint.value_raw = std::vector<uint8_t>(data, data + data_len);
-      ESP_LOGD(TAG, "Datapoint %u update to %s", datapoint.id, hexencode(datapoint.value_raw).c_str());
+      datapoint.value_data = this->store_datapoint_data_(datapoint.id, data, data_len);
+      ESP_LOGD(TAG, "Datapoint %u update to %s", datapoint.id, hexencode(data, data_len).c_str());
       break;
     case TuyaDatapointType::BOOLEAN:
       if (data_len != 1) {
@@ -259,8 +265,8 @@ void Tuya::handle_datapoint_(const uint8_t *buffer, size_t len) {
       ESP_LOGD(TAG, "Datapoint %u update to %d", datapoint.id, datapoint.value_int);
       break;
     case TuyaDatapointType::STRING:
-      datapoint.value_string = std::string(reinterpret_cast<const char *>(data), data_len);
-      ESP_LOGD(TAG, "Datapoint %u update to %s", datapoint.id, datapoint.value_string.c_str());
+      datapoint.value_data = this->store_datapoint_data_(datapoint.id, data, data_len);
+      ESP_LOGD(TAG, "Datapoint %u update to %s", datapoint.id, datapoint.value_string().c_str());
       break;
     case TuyaDatapointType::ENUM:
       if (data_len != 1) {
@@ -310,12 +316,40 @@ void Tuya::handle_datapoint_(const uint8_t *buffer, size_t len) {
       listener.on_datapoint(datapoint);
 }
 
+const uint8_t *Tuya::store_datapoint_data_(uint8_t datapoint_id, const uint8_t *data, size_t len) {
+  for (auto &stored : this->datapoint_data_) {
+    if (stored.id == datapoint_id) {
+      stored.data.assign(data, data + len);
+      return stored.data.data();
+    }
+  }
+  this->datapoint_data_.push_back(
+      TuyaDatapointData{.id = datapoint_id, .data = std::vector<uint8_t>(data, data + len)});
+  return this->datapoint_data_.back().data.data();
+}
+
 void Tuya::send_raw_command_(TuyaCommand command) {
   uint8_t len_hi = (uint8_t)(command.payload.size() >> 8);
   uint8_t len_lo = (uint8_t)(command.payload.size() & 0xFF);
   uint8_t version = 0;
 
   this->last_command_timestamp_ = millis();
+  this->response_received_ = false;
+  switch (command.cmd) {
+    case TuyaCommandType::HEARTBEAT:
+    case TuyaCommandType::PRODUCT_QUERY:
+    case TuyaCommandType::CONF_QUERY:
+    case TuyaCommandType::WIFI_STATE:
+      this->expected_response_ = command.cmd;
+      break;
+    case TuyaCommandType::DATAPOINT_DELIVER:
+    case TuyaCommandType::DATAPOINT_QUERY:
+      this->expected_response_ = TuyaCommandType::DATAPOINT_REPORT;
+      break;
+    default:
+      this->expected_response_.reset();
+      break;
+  }
 
   ESP_LOGV(TAG, "Sending Tuya: CMD=0x%02X VERSION=%u DATA=[%s] INIT_STATE=%u", static_cast<uint8_t>(command.cmd),
            version, hexencode(command.payload).c_str(), static_cast<uint8_t>(this->init_state_));
@@ -331,9 +365,12 @@ void Tuya::send_raw_command_(TuyaCommand command) {
 }
 
 void Tuya::process_command_queue_() {
+  if (this->command_queue_.empty() || !this->rx_message_.empty())
+    return;
+  // The protocol has no sequence numbers, so keep a single command outstanding. The next one goes out as soon as
+  // the MCU answered, or after COMMAND_DELAY for commands it does not answer (or when the answer got lost).
   uint32_t delay = millis() - this->last_command_timestamp_;
-  // Left check of delay since last command in case theres ever a command sent by calling send_raw_command_ directly
-  if (delay > COMMAND_DELAY && !this->command_queue_.empty() && this->rx_message_.empty()) {
+  if (this->response_received_ || delay > COMMAND_DELAY) {
     this->send_raw_command_(command_queue_.front());
     this->command_queue_.erase(command_queue_.begin());
   }
@@ -400,12 +437,13 @@ void Tuya::send_local_time_() {
 
 void Tuya::set_datapoint_value(uint8_t datapoint_id, uint32_t value) {
   ESP_LOGD(TAG, "Setting datapoint %u to %u", datapoint_id, value);
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGE(TAG, "Attempt to set unknown datapoint %u", datapoint_id);
     return;
   }
-  if (datapoint->value_uint == value) {
+  // A queued write for the datapoint is replaced, even if it goes back to the reported value
+  if (datapoint->value_uint == value && this->get_pending_datapoint_command_(datapoint_id) == nullptr) {
     ESP_LOGV(TAG, "Not sending unchanged value");
     return;
   }
@@ -429,11 +467,14 @@ void Tuya::set_datapoint_value(uint8_t datapoint_id, uint32_t value) {
 
 void Tuya::set_datapoint_value(uint8_t datapoint_id, const std::string &value) {
   ESP_LOGD(TAG, "Setting datapoint %u to %s", datapoint_id, value.c_str());
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGE(TAG, "Attempt to set unknown datapoint %u", datapoint_id);
+    return;
   }
-  if (datapoint->value_string == value) {
+  if (datapoint->value_data != nullptr && datapoint->len == value.size() &&
+      memcmp(datapoint->value_data, value.data(), value.size()) == 0 &&
+      this->get_pending_datapoint_command_(datapoint_id) == nullptr) {
     ESP_LOGV(TAG, "Not sending unchanged value");
     return;
   }
@@ -444,11 +485,19 @@ void Tuya::set_datapoint_value(uint8_t datapoint_id, const std::string &value) {
   this->send_datapoint_command_(datapoint->id, datapoint->type, data);
 }
 
-optional<TuyaDatapoint> Tuya::get_datapoint_(uint8_t datapoint_id) {
+TuyaDatapoint *Tuya::get_datapoint_(uint8_t datapoint_id) {
   for (auto &datapoint : this->datapoints_)
     if (datapoint.id == datapoint_id)
-      return datapoint;
-  return {};
+      return &datapoint;
+  return nullptr;
+}
+
+TuyaCommand *Tuya::get_pending_datapoint_command_(uint8_t datapoint_id) {
+  for (auto &command : this->command_queue_)
+    if (command.cmd == TuyaCommandType::DATAPOINT_DELIVER && !command.payload.empty() &&
+        command.payload[0] == datapoint_id)
+      return &command;
+  return nullptr;
 }
 
 void Tuya::send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, std::vector<uint8_t> data) {
@@ -459,10 +508,17 @@ void Tuya::send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datap
   buffer.push_back(data.size() >> 0);
   buffer.insert(buffer.end(), data.begin(), data.end());
 
+  // Only the latest value matters, so update a write that is still queued instead of sending both
+  TuyaCommand *pending = this->get_pending_datapoint_command_(datapoint_id);
+  if (pending != nullptr) {
+    ESP_LOGV(TAG, "Replacing queued write of datapoint %u", datapoint_id);
+    pending->payload = buffer;
+    return;
+  }
   this->send_command_(TuyaCommand{.cmd = TuyaCommandType::DATAPOINT_DELIVER, .payload = buffer});
 }
 
-void Tuya::register_listener(uint8_t datapoint_id, const std::function<void(TuyaDatapoint)> &func) {
+void Tuya::register_listener(uint8_t datapoint_id, const std::function<void(const TuyaDatapoint &)> &func) {
   auto listener = TuyaDatapointListener{
       .datapoint_id = datapoint_id,
       .on_datapoint = func,
@@ -20,6 +20,11 @@ enum class TuyaDatapointType : uint8_t {
   BITMASK = 0x05,  // 2 bytes
 };
 
+/** A datapoint as last reported by the MCU.
+ *
+ * This is kept small and trivially copyable, the bytes of RAW and STRING datapoints are stored in the Tuya
+ * component and `value_data` points to them. It stays valid until the datapoint is reported again.
+ */
 struct TuyaDatapoint {
   uint8_t id;
   TuyaDatapointType type;
@@ -31,13 +36,24 @@ struct TuyaDatapoint {
     uint8_t value_enum;
     uint32_t value_bitmask;
   };
-  std::string value_string;
-  std::vector<uint8_t> value_raw;
+  const uint8_t *value_data;
+
+  std::string value_string() const {
+    if (this->value_data == nullptr)
+      return "";
+    return std::string(reinterpret_cast<const char *>(this->value_data), this->len);
+  }
+};
+
+/// The bytes of a RAW or STRING datapoint.
+struct TuyaDatapointData {
+  uint8_t id;
+  std::vector<uint8_t> data;
 };
 
 struct TuyaDatapointListener {
   uint8_t datapoint_id;
-  std::function<void(TuyaDatapoint)> on_datapoint;
+  std::function<void(const TuyaDatapoint &)> on_datapoint;
 };
 
 enum class TuyaCommandType : uint8_t {
@@ -74,7 +90,7 @@ class Tuya : public Component, public uart::UARTDevice {
   void setup() override;
   void loop() override;
   void dump_config() override;
-  void register_listener(uint8_t datapoint_id, const std::function<void(TuyaDatapoint)> &func);
+  void register_listener(uint8_t datapoint_id, const std::function<void(const TuyaDatapoint &)> &func);
   void set_datapoint_value(uint8_t datapoint_id, uint32_t value);
   void set_datapoint_value(uint8_t datapoint_id, const std::string &value);
 #ifdef USE_TIME
@@ -87,7 +103,10 @@ class Tuya : public Component, public uart::UARTDevice {
  protected:
   void handle_char_(uint8_t c);
   void handle_datapoint_(const uint8_t *buffer, size_t len);
-  optional<TuyaDatapoint> get_datapoint_(uint8_t datapoint_id);
+  const uint8_t *store_datapoint_data_(uint8_t datapoint_id, const uint8_t *data, size_t len);
+  TuyaDatapoint *get_datapoint_(uint8_t datapoint_id);
+  /// The queued DATAPOINT_DELIVER command for the datapoint, if it was not sent yet.
+  TuyaCommand *get_pending_datapoint_command_(uint8_t datapoint_id);
   bool validate_message_();
 
   void handle_command_(uint8_t command, uint8_t version, const uint8_t *buffer, size_t len);
@@ -110,9 +129,13 @@ class Tuya : public Component, public uart::UARTDevice {
   std::string product_ = "";
   std::vector<TuyaDatapointListener> listeners_;
   std::vector<TuyaDatapoint> datapoints_;
+  std::vector<TuyaDatapointData> datapoint_data_;
   std::vector<uint8_t> rx_message_;
   std::vector<uint8_t> ignore_mcu_update_on_datapoints_{};
   std::vector<TuyaCommand> command_queue_;
+  /// The command the MCU still has to answer for the last sent command, the next one is sent once it did
+  optional<TuyaCommandType> expected_response_{};
+  bool response_received_{false};
   uint8_t wifi_status_ = -1;
 };
 
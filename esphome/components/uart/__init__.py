@@ -53,6 +53,7 @@ UART_PARITY_OPTIONS = {
 CONF_STOP_BITS = "stop_bits"
 CONF_DATA_BITS = "data_bits"
 CONF_PARITY = "parity"
+CONF_USE_IDF_DRIVER = "use_idf_driver"
 
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
@@ -70,6 +71,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_PARITY, default="NONE"): cv.enum(
                 UART_PARITY_OPTIONS, upper=True
             ),
+            cv.Optional(CONF_USE_IDF_DRIVER): cv.All(cv.only_on_esp32, cv.boolean),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.has_at_least_one_key(CONF_TX_PIN, CONF_RX_PIN),
@@ -93,6 +95,8 @@ async def to_code(config):
     cg.add(var.set_stop_bits(config[CONF_STOP_BITS]))
     cg.add(var.set_data_bits(config[CONF_DATA_BITS]))
     cg.add(var.set_parity(config[CONF_PARITY]))
+    if config.get(CONF_USE_IDF_DRIVER, False):
+        cg.add(var.set_use_idf_driver(True))
 
 
 # A schema to use for all UART devices, all UART integrations must extend this!
@@ -0,0 +1,160 @@
+#include "frame_parser.h"
+#include "uart.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace uart {
+
+static const char *const TAG = "uart.frame_parser";
+
+void FrameParser::set_header(const std::vector<uint8_t> &header, const std::vector<uint8_t> &mask) {
+  this->header_ = header;
+  this->header_mask_ = mask;
+  this->header_mask_.resize(header.size(), 0xFF);
+}
+
+void FrameParser::set_length_field(size_t offset, uint8_t size, bool big_endian, size_t adjust) {
+  this->length_offset_ = offset;
+  this->length_size_ = size;
+  this->length_big_endian_ = big_endian;
+  this->length_adjust_ = adjust;
+}
+
+size_t FrameParser::check_(const uint8_t *data, size_t length) const {
+  const size_t header_length = this->header_.size();
+  for (size_t i = 0; i < header_length && i < length; i++) {
+    if ((data[i] & this->header_mask_[i]) != (this->header_[i] & this->header_mask_[i]))
+      return 0;
+  }
+  if (length < header_length)
+    return header_length;
+
+  size_t frame_length = this->fixed_length_;
+  if (this->length_size_ != 0) {
+    const size_t field_end = this->length_offset_ + this->length_size_;
+    if (length < field_end)
+      return field_end;
+    const uint8_t *field = data + this->length_offset_;
+    size_t value = field[0];
+    if (this->length_size_ == 2)
+      value = this->length_big_endian_ ? encode_uint16(field[0], field[1]) : encode_uint16(field[1], field[0]);
+    frame_length = value + this->length_adjust_;
+    if (frame_length < field_end)
+      return 0;
+  }
+  if (frame_length > this->buffer_.size())
+    return 0;
+  if (length < frame_length)
+    return frame_length;
+
+  if (this->validator_ && !this->validator_(data, frame_length))
+    return 0;
+  return frame_length;
+}
+
+size_t FrameParser::find_start_(const uint8_t *data, size_t length) const {
+  if (this->header_.empty())
+    return 0;
+  if (this->header_mask_[0] == 0xFF) {
+    const void *start = memchr(data, this->header_[0], length);
+    return start == nullptr ? length : static_cast<const uint8_t *>(start) - data;
+  }
+  for (size_t i = 0; i < length; i++) {
+    if ((data[i] & this->header_mask_[0]) == (this->header_[0] & this->header_mask_[0]))
+      return i;
+  }
+  return length;
+}
+
+void FrameParser::resync_buffer_() {
+  const size_t start = 1 + this->find_start_(this->buffer_.data() + 1, this->length_ - 1);
+  this->skipped_ += start;
+  this->length_ -= start;
+  memmove(this->buffer_.data(), this->buffer_.data() + start, this->length_);
+}
+
+void FrameParser::feed(const uint8_t *data, size_t length) {
+  if (length == 0)
+    return;
+  const uint32_t now = millis();
+  if (this->length_ != 0 && now - this->last_receive_ >= this->timeout_) {
+    ESP_LOGV(TAG, "Dropping a partial frame of %u bytes after the timeout", unsigned(this->length_));
+    this->skipped_ += this->length_;
+    this->length_ = 0;
+  }
+  this->last_receive_ = now;
+
+  while (length != 0) {
+    if (this->length_ == 0) {
+      const size_t start = this->find_start_(data, length);
+      this->skipped_ += start;
+      data += start;
+      length -= start;
+      if (length == 0)
+        return;
+
+      const size_t result = this->check_(data, length);
+      if (result == 0) {
+        this->skipped_++;
+        data++;
+        length--;
+      } else if (result <= length) {
+        // The whole frame is in this block, no copy needed
+        if (this->on_frame_)
+          this->on_frame_(data, result);
+        data += result;
+        length -= result;
+      } else {
+        // Keep the start of the frame until the rest arrives
+        memcpy(this->buffer_.data(), data, length);
+        this->length_ = length;
+        return;
+      }
+      continue;
+    }
+
+    // Add only the bytes the buffered frame still needs to the buffer, the rest may start the next frame
+    size_t needed = this->check_(this->buffer_.data(), this->length_);
+    while (needed > this->length_ && length != 0) {
+      const size_t count = std::min(needed - this->length_, length);
+      memcpy(this->buffer_.data() + this->length_, data, count);
+      this->length_ += count;
+      data += count;
+      length -= count;
+      needed = this->check_(this->buffer_.data(), this->length_);
+    }
+    this->process_buffer_(needed);
+  }
+
+  // Bytes that remain buffered after an invalid frame may already contain a full frame
+  while (this->length_ != 0 && this->process_buffer_(this->check_(this->buffer_.data(), this->length_))) {
+  }
+}
+
+bool FrameParser::process_buffer_(size_t needed) {
+  if (needed == 0) {
+    this->resync_buffer_();
+    return true;
+  }
+  if (needed > this->length_)
+    return false;
+  if (this->on_frame_)
+    this->on_frame_(this->buffer_.data(), needed);
+  // Bytes after the frame are left from a resync
+  this->length_ -= needed;
+  memmove(this->buffer_.data(), this->buffer_.data() + needed, this->length_);
+  return true;
+}
+
+void FrameParser::read_from(UARTDevice *device) {
+  const uint8_t *data;
+  size_t length;
+  while ((length = device->read_buffer(&data)) != 0)
+    this->feed(data, length);
+}
+
+}  // namespace uart
+}  // namespace esphome
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace uart {
+
+class UARTDevice;
+
+/** Splits the received bytes of a UART device into frames, for devices that send frames with a header.
+ *
+ * A frame starts with a header, has a fixed length or a length field and is checked by a validator, usually its
+ * checksum. Bytes that can't start a valid frame are skipped up to the next header, so the parser resynchronizes
+ * after lost or corrupted bytes. A partial frame is dropped when nothing was received for the timeout.
+ *
+ * The parser is fed whole blocks from UARTDevice::read_buffer(). Frames that are complete in a block are passed to
+ * the frame callback straight from the buffer of the UART, only frames split over two blocks are copied.
+ */
+class FrameParser {
+ public:
+  /// Check a frame with its full length, for example its checksum and trailer.
+  using Validator = std::function<bool(const uint8_t *frame, size_t length)>;
+  /// Called with each valid frame. The bytes are only valid during the call.
+  using FrameCallback = std::function<void(const uint8_t *frame, size_t length)>;
+
+  FrameParser() { this->buffer_.resize(64); }
+
+  /// Set the bytes every frame starts with. Bits that are 0 in the optional mask can have any value.
+  void set_header(const std::vector<uint8_t> &header, const std::vector<uint8_t> &mask = {});
+  /// Frames have this length, including the header.
+  void set_fixed_length(size_t length) { this->fixed_length_ = length; }
+  /** Frames have a length field of `size` (1 or 2) bytes at `offset`.
+   *
+   * The length of the frame, including the header, is the value of the field plus `adjust`.
+   */
+  void set_length_field(size_t offset, uint8_t size, bool big_endian, size_t adjust);
+  /// Longer frames are invalid, this is also the size of the buffer for frames split over two reads.
+  void set_max_length(size_t max_length) { this->buffer_.resize(max_length); }
+  void set_validator(Validator &&validator) { this->validator_ = std::move(validator); }
+  void set_on_frame(FrameCallback &&callback) { this->on_frame_ = std::move(callback); }
+  /// Drop a partial frame when nothing was received for this time in ms.
+  void set_timeout(uint32_t timeout) { this->timeout_ = timeout; }
+
+  /// Parse the next received bytes.
+  void feed(const uint8_t *data, size_t length);
+  /// Parse all bytes the UART of `device` received so far.
+  void read_from(UARTDevice *device);
+  /// Drop a partial frame.
+  void reset() { this->length_ = 0; }
+
+  /// Number of bytes that were skipped because they didn't start a valid frame.
+  uint32_t get_skipped_count() const { return this->skipped_; }
+
+ protected:
+  /** Check a possible frame at the start of `data`.
+   *
+   * Returns 0 if it can't be a valid frame, the length of the frame if it is complete and valid, or otherwise how
+   * many bytes are needed to decide, which is more than `length`.
+   */
+  size_t check_(const uint8_t *data, size_t length) const;
+  /// Offset of the first byte that can start a frame, `length` if there is none.
+  size_t find_start_(const uint8_t *data, size_t length) const;
+  /// The buffered partial frame is invalid, keep what follows its first byte from the next possible start on.
+  void resync_buffer_();
+  /** Act on the result of check_() for the buffered bytes: resync, or pass a complete frame on.
+   *
+   * Returns false if the buffered frame is still incomplete.
+   */
+  bool process_buffer_(size_t needed);
+
+  std::vector<uint8_t> header_;
+  std::vector<uint8_t> header_mask_;
+  size_t fixed_length_{0};
+  size_t length_offset_{0};
+  uint8_t length_size_{0};
+  bool length_big_endian_{false};
+  size_t length_adjust_{0};
+  Validator validator_;
+  FrameCallback on_frame_;
+  uint32_t timeout_{500};
+  uint32_t last_receive_{0};
+  /// The partial frame that was split over reads, the first `length_` bytes are used.
+  std::vector<uint8_t> buffer_;
+  size_t length_{0};
+  uint32_t skipped_{0};
+};
+
+}  // namespace uart
+}  // namespace esphome
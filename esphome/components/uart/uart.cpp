@@ -30,6 +30,48 @@ int UARTComponent::peek() {
   return data;
 }
 
+void UARTComponent::loop() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->rx_overflow_) {
+    this->rx_overflow_ = false;
+    ESP_LOGW(TAG, "UART receive buffer overflowed, dropping all received data");
+    uart_flush_input(this->uart_num_);
+    this->has_peek_ = false;
+  }
+#endif
+  if (!this->has_receive_callback_) {
+    this->disable_loop();
+    return;
+  }
+  if (this->available() > 0) {
+    this->receive_callback_.call();
+    return;
+  }
+#ifdef ARDUINO_ARCH_ESP32
+  // rx_event_task() wakes us up again
+  if (this->event_queue_ != nullptr)
+    this->disable_loop();
+#endif
+}
+
+size_t UARTComponent::read_buffer(const uint8_t **data) {
+  if (this->rx_block_.empty())
+    this->rx_block_.resize(UART_READ_BLOCK_SIZE);
+  *data = this->rx_block_.data();
+  const size_t len = this->read_available_(this->rx_block_.data(), this->rx_block_.size());
+  for (size_t i = 0; i < len; i++) {
+    ESP_LOGVV(TAG, "    Read 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", BYTE_TO_BINARY(this->rx_block_[i]),
+              this->rx_block_[i]);
+  }
+  return len;
+}
+
+void UARTComponent::add_on_receive_callback(std::function<void()> &&callback) {
+  this->receive_callback_.add(std::move(callback));
+  this->has_receive_callback_ = true;
+  this->enable_loop();
+}
+
 void UARTComponent::check_logger_conflict_() {
 #ifdef USE_LOGGER
   if (this->hw_serial_ == nullptr || logger::global_logger->get_baud_rate() == 0) {
@@ -4,6 +4,11 @@
 #include <HardwareSerial.h>
 #include "esphome/core/esphal.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <driver/uart.h>
+#endif
 
 namespace esphome {
 namespace uart {
@@ -16,11 +21,15 @@ enum UARTParityOptions {
 
 const char *parity_to_str(UARTParityOptions parity);
 
+/// The most bytes UARTComponent::read_buffer() returns at once.
+static const size_t UART_READ_BLOCK_SIZE = 128;
+
 #ifdef ARDUINO_ARCH_ESP8266
 class ESP8266SoftwareSerial {
  public:
   void setup(int8_t tx_pin, int8_t rx_pin, uint32_t baud_rate, uint8_t stop_bits, uint32_t data_bits,
              UARTParityOptions parity, size_t rx_buffer_size);
+  void set_baud_rate(uint32_t baud_rate) { this->bit_time_ = F_CPU / baud_rate; }
 
   uint8_t read_byte();
   uint8_t peek_byte();
@@ -35,17 +44,37 @@ class ESP8266SoftwareSerial {
   GPIOPin *gpio_rx_pin_{nullptr};
 
  protected:
+  /// Only records the time and new level of each RX edge, decoding happens in process_edges_().
   static void gpio_intr(ESP8266SoftwareSerial *arg);
+  /// Decode the edges recorded so far into rx_buffer_.
+  void process_edges_();
+  void push_rx_byte_(uint8_t data);
 
   void wait_(uint32_t *wait, const uint32_t &start);
-  bool read_bit_(uint32_t *wait, const uint32_t &start);
   void write_bit_(bool bit, uint32_t *wait, const uint32_t &start);
 
   uint32_t bit_time_{0};
   uint8_t *rx_buffer_{nullptr};
   size_t rx_buffer_size_;
-  volatile size_t rx_in_pos_{0};
+  size_t rx_in_pos_{0};
   size_t rx_out_pos_{0};
+  /** Ring of RX edges, filled by gpio_intr() and emptied by process_edges_(); no lock needed.
+   *
+   * Each entry is the cycle count of the edge with the level after it in the lowest bit.
+   */
+  volatile uint32_t *edges_{nullptr};
+  size_t edges_size_;
+  volatile size_t edges_head_{0};
+  volatile size_t edges_tail_{0};
+  volatile bool edges_overflow_{false};
+  // Decoder state
+  bool rx_level_{true};
+  bool in_frame_{false};
+  uint8_t frame_bit_{0};
+  uint8_t frame_data_{0};
+  uint32_t frame_start_{0};
+  /// A falling edge before this is still part of the previous character.
+  uint32_t next_frame_{0};
   uint8_t stop_bits_;
   uint8_t data_bits_;
   UARTParityOptions parity_;
@@ -58,10 +87,13 @@ class UARTComponent : public Component, public Stream {
  public:
   void set_baud_rate(uint32_t baud_rate) { baud_rate_ = baud_rate; }
   uint32_t get_baud_rate() const { return baud_rate_; }
+  /// Switch a set up UART to another baud rate, for devices that negotiate a faster speed. Waits for pending writes.
+  void update_baud_rate(uint32_t baud_rate);
 
   uint32_t get_config();
 
   void setup() override;
+  void loop() override;
 
   void dump_config() override;
 
@@ -78,6 +110,20 @@ class UARTComponent : public Component, public Stream {
 
   bool read_array(uint8_t *data, size_t len);
 
+  /** Read all bytes received so far, up to UART_READ_BLOCK_SIZE, in one go instead of one read_byte() per byte.
+   *
+   * Sets *data to the bytes and returns how many there are, 0 if nothing was received. The bytes are owned by the
+   * UART and stay valid until the next call. Loop until it returns 0 to drain the receive buffer.
+   */
+  size_t read_buffer(const uint8_t **data);
+
+  /** Call `callback` from loop() while received bytes are waiting.
+   *
+   * A device can use this to disable its own loop() while there is nothing to parse. With the ESP-IDF driver the
+   * UART itself sleeps until the driver reports received data, instead of checking available() on every loop.
+   */
+  void add_on_receive_callback(std::function<void()> &&callback);
+
   int available() override;
 
   /// Block until all bytes have been written to the UART bus.
@@ -94,6 +140,7 @@ class UARTComponent : public Component, public Stream {
   void set_rx_buffer_size(size_t rx_buffer_size) { this->rx_buffer_size_ = rx_buffer_size; }
 #ifdef ARDUINO_ARCH_ESP32
   void set_invert(bool invert) { this->invert_ = invert; }
+  void set_use_idf_driver(bool use_idf_driver) { this->use_idf_driver_ = use_idf_driver; }
 #endif
   void set_stop_bits(uint8_t stop_bits) { this->stop_bits_ = stop_bits; }
   void set_data_bits(uint8_t data_bits) { this->data_bits_ = data_bits; }
@@ -102,6 +149,8 @@ class UARTComponent : public Component, public Stream {
  protected:
   void check_logger_conflict_();
   bool check_read_timeout_(size_t len = 1);
+  /// Read up to `len` of the bytes that are already received, return how many were read.
+  size_t read_available_(uint8_t *data, size_t len);
   friend class UARTDevice;
 
   HardwareSerial *hw_serial_{nullptr};
@@ -113,7 +162,23 @@ class UARTComponent : public Component, public Stream {
   size_t rx_buffer_size_;
 #ifdef ARDUINO_ARCH_ESP32
   bool invert_;
+  bool use_idf_driver_{false};
+
+  void setup_idf_driver_();
+  /// Waits for ESP-IDF driver events and wakes up loop(); runs as its own task.
+  static void rx_event_task(void *arg);
+
+  uart_port_t uart_num_;
+  QueueHandle_t event_queue_{nullptr};
+  /// Set by the event task when the driver dropped received bytes.
+  volatile bool rx_overflow_{false};
+  /// The ESP-IDF driver can't peek, so peek_byte() takes one byte out and keeps it here.
+  bool has_peek_{false};
+  uint8_t peek_;
 #endif
+  CallbackManager<void()> receive_callback_;
+  bool has_receive_callback_{false};
+  std::vector<uint8_t> rx_block_;
   uint32_t baud_rate_;
   uint8_t stop_bits_;
   uint8_t data_bits_;
@@ -153,6 +218,12 @@ class UARTDevice : public Stream {
     return res;
   }
 
+  size_t read_buffer(const uint8_t **data) { return this->parent_->read_buffer(data); }
+
+  void add_on_receive_callback(std::function<void()> &&callback) {
+    this->parent_->add_on_receive_callback(std::move(callback));
+  }
+
   int available() override { return this->parent_->available(); }
 
   void flush() override { return this->parent_->flush(); }
@@ -4,6 +4,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "esphome/core/defines.h"
+#include <algorithm>
 
 namespace esphome {
 namespace uart {
@@ -21,6 +22,11 @@ static const uint32_t UART_NB_STOP_BIT_1 = 1 << 4;
 static const uint32_t UART_NB_STOP_BIT_2 = 3 << 4;
 static const uint32_t UART_TICK_APB_CLOCK = 1 << 27;
 
+/// Events the ESP-IDF driver can queue before rx_event_task() gets to them.
+static const int UART_EVENT_QUEUE_SIZE = 20;
+/// Just above the loop task, rx_event_task() only sets flags.
+static const UBaseType_t UART_EVENT_TASK_PRIORITY = 2;
+
 uint32_t UARTComponent::get_config() {
   uint32_t config = 0;
 
@@ -70,6 +76,10 @@ uint32_t UARTComponent::get_config() {
 
 void UARTComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up UART...");
+  if (this->use_idf_driver_) {
+    this->setup_idf_driver_();
+    return;
+  }
   // Use Arduino HardwareSerial UARTs if all used pins match the ones
   // preconfigured by the platform. For example if RX disabled but TX pin
   // is 1 we still want to use Serial.
@@ -84,6 +94,67 @@ void UARTComponent::setup() {
   this->hw_serial_->setRxBufferSize(this->rx_buffer_size_);
 }
 
+void UARTComponent::setup_idf_driver_() {
+  // UART0 stays with Serial and the logger
+  if (next_uart_num >= UART_NUM_MAX) {
+    ESP_LOGE(TAG, "No UART left for the ESP-IDF driver!");
+    this->mark_failed();
+    return;
+  }
+  this->uart_num_ = static_cast<uart_port_t>(next_uart_num++);
+
+  uart_config_t config = {};
+  config.baud_rate = this->baud_rate_;
+  config.data_bits = static_cast<uart_word_length_t>(UART_DATA_5_BITS + (this->data_bits_ - 5));
+  // The ESP-IDF names, not the register bits above
+  if (this->parity_ == UART_CONFIG_PARITY_EVEN)
+    config.parity = ::UART_PARITY_EVEN;
+  else if (this->parity_ == UART_CONFIG_PARITY_ODD)
+    config.parity = ::UART_PARITY_ODD;
+  else
+    config.parity = UART_PARITY_DISABLE;
+  config.stop_bits = this->stop_bits_ == 1 ? UART_STOP_BITS_1 : UART_STOP_BITS_2;
+  config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+  uart_param_config(this->uart_num_, &config);
+
+  int tx = this->tx_pin_.has_value() ? *this->tx_pin_ : UART_PIN_NO_CHANGE;
+  int rx = this->rx_pin_.has_value() ? *this->rx_pin_ : UART_PIN_NO_CHANGE;
+  uart_set_pin(this->uart_num_, tx, rx, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+  if (this->invert_) {
+#if ESP_IDF_VERSION_MAJOR >= 4
+    uart_set_line_inverse(this->uart_num_, UART_SIGNAL_RXD_INV | UART_SIGNAL_TXD_INV);
+#else
+    uart_set_line_inverse(this->uart_num_, UART_INVERSE_RXD | UART_INVERSE_TXD);
+#endif
+  }
+
+  // The driver's receive buffer must be larger than the hardware FIFO. Without a transmit buffer writes block
+  // until the data is in the FIFO, like with HardwareSerial.
+  const int rx_buffer_size = std::max<int>(this->rx_buffer_size_, UART_FIFO_LEN * 2);
+  esp_err_t err =
+      uart_driver_install(this->uart_num_, rx_buffer_size, 0, UART_EVENT_QUEUE_SIZE, &this->event_queue_, 0);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Installing the ESP-IDF UART driver failed: %d", err);
+    this->event_queue_ = nullptr;
+    this->mark_failed();
+    return;
+  }
+  xTaskCreate(UARTComponent::rx_event_task, "uart_rx_events", 2048, this, UART_EVENT_TASK_PRIORITY, nullptr);
+}
+
+void UARTComponent::rx_event_task(void *arg) {
+  auto *uart = reinterpret_cast<UARTComponent *>(arg);
+  uart_event_t event;
+  while (true) {
+    if (xQueueReceive(uart->event_queue_, &event, portMAX_DELAY) != pdTRUE)
+      continue;
+    // UART_DATA comes when the FIFO fills up or the line goes idle for a few characters
+    if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL)
+      uart->rx_overflow_ = true;
+    uart->enable_loop_soon_any_context();
+  }
+}
+
 void UARTComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "UART Bus:");
   if (this->tx_pin_.has_value()) {
@@ -97,46 +168,98 @@ void UARTComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "  Data Bits: %u", this->data_bits_);
   ESP_LOGCONFIG(TAG, "  Parity: %s", parity_to_str(this->parity_));
   ESP_LOGCONFIG(TAG, "  Stop bits: %u", this->stop_bits_);
+  if (this->use_idf_driver_) {
+    ESP_LOGCONFIG(TAG, "  Using the ESP-IDF driver on UART%d", this->uart_num_);
+  }
   this->check_logger_conflict_();
 }
 
 void UARTComponent::write_byte(uint8_t data) {
-  this->hw_serial_->write(data);
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->write(data);
+  } else if (this->event_queue_ != nullptr) {
+    uart_write_bytes(this->uart_num_, reinterpret_cast<const char *>(&data), 1);
+  }
   ESP_LOGVV(TAG, "    Wrote 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", BYTE_TO_BINARY(data), data);
 }
 void UARTComponent::write_array(const uint8_t *data, size_t len) {
-  this->hw_serial_->write(data, len);
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->write(data, len);
+  } else if (this->event_queue_ != nullptr) {
+    uart_write_bytes(this->uart_num_, reinterpret_cast<const char *>(data), len);
+  }
   for (size_t i = 0; i < len; i++) {
     ESP_LOGVV(TAG, "    Wrote 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", BYTE_TO_BINARY(data[i]), data[i]);
   }
 }
 void UARTComponent::write_str(const char *str) {
-  this->hw_serial_->write(str);
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->write(str);
+  } else if (this->event_queue_ != nullptr) {
+    uart_write_bytes(this->uart_num_, str, strlen(str));
+  }
   ESP_LOGVV(TAG, "    Wrote \"%s\"", str);
 }
 bool UARTComponent::read_byte(uint8_t *data) {
   if (!this->check_read_timeout_())
     return false;
-  *data = this->hw_serial_->read();
+  if (this->hw_serial_ != nullptr) {
+    *data = this->hw_serial_->read();
+  } else if (this->has_peek_) {
+    *data = this->peek_;
+    this->has_peek_ = false;
+  } else {
+    uart_read_bytes(this->uart_num_, data, 1, 0);
+  }
   ESP_LOGVV(TAG, "    Read 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", BYTE_TO_BINARY(*data), *data);
   return true;
 }
 bool UARTComponent::peek_byte(uint8_t *data) {
   if (!this->check_read_timeout_())
     return false;
-  *data = this->hw_serial_->peek();
+  if (this->hw_serial_ != nullptr) {
+    *data = this->hw_serial_->peek();
+  } else {
+    if (!this->has_peek_) {
+      uart_read_bytes(this->uart_num_, &this->peek_, 1, 0);
+      this->has_peek_ = true;
+    }
+    *data = this->peek_;
+  }
   return true;
 }
 bool UARTComponent::read_array(uint8_t *data, size_t len) {
   if (!this->check_read_timeout_(len))
     return false;
-  this->hw_serial_->readBytes(data, len);
+  this->read_available_(data, len);
   for (size_t i = 0; i < len; i++) {
     ESP_LOGVV(TAG, "    Read 0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", BYTE_TO_BINARY(data[i]), data[i]);
   }
 
   return true;
 }
+size_t UARTComponent::read_available_(uint8_t *data, size_t len) {
+  const int available = this->available();
+  if (available <= 0)
+    return 0;
+  len = std::min(len, size_t(available));
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->readBytes(data, len);
+    return len;
+  }
+
+  size_t read = 0;
+  if (this->has_peek_) {
+    data[read++] = this->peek_;
+    this->has_peek_ = false;
+  }
+  if (read < len) {
+    int ret = uart_read_bytes(this->uart_num_, data + read, len - read, 0);
+    if (ret > 0)
+      read += ret;
+  }
+  return read;
+}
 bool UARTComponent::check_read_timeout_(size_t len) {
   if (this->available() >= len)
     return true;
@@ -151,10 +274,33 @@ bool UARTComponent::check_read_timeout_(size_t len) {
   }
   return true;
 }
-int UARTComponent::available() { return this->hw_serial_->available(); }
+int UARTComponent::available() {
+  if (this->hw_serial_ != nullptr)
+    return this->hw_serial_->available();
+  if (this->event_queue_ == nullptr)
+    return 0;
+  size_t buffered = 0;
+  uart_get_buffered_data_len(this->uart_num_, &buffered);
+  return int(buffered) + (this->has_peek_ ? 1 : 0);
+}
 void UARTComponent::flush() {
   ESP_LOGVV(TAG, "    Flushing...");
-  this->hw_serial_->flush();
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->flush();
+  } else if (this->event_queue_ != nullptr) {
+    uart_wait_tx_done(this->uart_num_, portMAX_DELAY);
+  }
+}
+
+void UARTComponent::update_baud_rate(uint32_t baud_rate) {
+  ESP_LOGD(TAG, "Changing baud rate to %u", baud_rate);
+  this->flush();
+  this->baud_rate_ = baud_rate;
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->updateBaudRate(baud_rate);
+  } else if (this->event_queue_ != nullptr) {
+    uart_set_baudrate(this->uart_num_, baud_rate);
+  }
 }
 
 }  // namespace uart
@@ -4,6 +4,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "esphome/core/defines.h"
+#include <algorithm>
 #
 namespace esphome {
 namespace uart {
@@ -157,6 +158,19 @@ bool UARTComponent::read_array(uint8_t *data, size_t len) {
 
   return true;
 }
+size_t UARTComponent::read_available_(uint8_t *data, size_t len) {
+  const int available = this->available();
+  if (available <= 0)
+    return 0;
+  len = std::min(len, size_t(available));
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->readBytes(data, len);
+  } else {
+    for (size_t i = 0; i < len; i++)
+      data[i] = this->sw_serial_->read_byte();
+  }
+  return len;
+}
 bool UARTComponent::check_read_timeout_(size_t len) {
   if (this->available() >= int(len))
     return true;
@@ -186,6 +200,17 @@ void UARTComponent::flush() {
     this->sw_serial_->flush();
   }
 }
+
+void UARTComponent::update_baud_rate(uint32_t baud_rate) {
+  ESP_LOGD(TAG, "Changing baud rate to %u", baud_rate);
+  this->flush();
+  this->baud_rate_ = baud_rate;
+  if (this->hw_serial_ != nullptr) {
+    this->hw_serial_->updateBaudRate(baud_rate);
+  } else {
+    this->sw_serial_->set_baud_rate(baud_rate);
+  }
+}
 void ESP8266SoftwareSerial::setup(int8_t tx_pin, int8_t rx_pin, uint32_t baud_rate, uint8_t stop_bits,
                                   uint32_t data_bits, UARTParityOptions parity, size_t rx_buffer_size) {
   this->bit_time_ = F_CPU / baud_rate;
@@ -206,33 +231,91 @@ void ESP8266SoftwareSerial::setup(int8_t tx_pin, int8_t rx_pin, uint32_t baud_ra
     this->gpio_rx_pin_ = &pin;
     this->rx_pin_ = pin.to_isr();
     this->rx_buffer_ = new uint8_t[this->rx_buffer_size_];
-    pin.attach_interrupt(ESP8266SoftwareSerial::gpio_intr, this, FALLING);
+    // A character has up to 10 edges, but most have far fewer
+    this->edges_size_ = this->rx_buffer_size_ * 2;
+    this->edges_ = new uint32_t[this->edges_size_];
+    this->next_frame_ = ESP.getCycleCount();
+    pin.attach_interrupt(ESP8266SoftwareSerial::gpio_intr, this, CHANGE);
   }
 }
 void ICACHE_RAM_ATTR ESP8266SoftwareSerial::gpio_intr(ESP8266SoftwareSerial *arg) {
-  uint32_t wait = arg->bit_time_ + arg->bit_time_ / 3 - 500;
-  const uint32_t start = ESP.getCycleCount();
-  uint8_t rec = 0;
-  // Manually unroll the loop
-  for (int i = 0; i < arg->data_bits_; i++)
-    rec |= arg->read_bit_(&wait, start) << i;
+  const uint32_t now = ESP.getCycleCount();
+  const bool level = arg->rx_pin_->digital_read();
+  const size_t head = arg->edges_head_;
+  const size_t next = (head + 1) % arg->edges_size_;
+  if (next == arg->edges_tail_) {
+    arg->edges_overflow_ = true;
+    return;
+  }
+  arg->edges_[head] = (now & ~1u) | level;
+  arg->edges_head_ = next;
+}
+void ESP8266SoftwareSerial::process_edges_() {
+  if (this->edges_ == nullptr)
+    return;
+  if (this->edges_overflow_) {
+    ESP_LOGW(TAG, "Software serial couldn't keep up, dropping received data");
+    this->edges_tail_ = this->edges_head_;
+    this->edges_overflow_ = false;
+    this->in_frame_ = false;
+    this->rx_level_ = this->rx_pin_->digital_read();
+  }
 
-  /* If parity is enabled, just read it and ignore it. */
-  /* TODO: Should we check parity? Or is it too slow for nothing added..*/
-  if (arg->parity_ == UART_CONFIG_PARITY_EVEN)
-    arg->read_bit_(&wait, start);
-  else if (arg->parity_ == UART_CONFIG_PARITY_ODD)
-    arg->read_bit_(&wait, start);
+  const uint32_t now = ESP.getCycleCount();
+  while (true) {
+    const bool has_edge = this->edges_tail_ != this->edges_head_;
+    const uint32_t edge = has_edge ? this->edges_[this->edges_tail_] : 0;
+    const uint32_t edge_time = edge & ~1u;
 
-  // Stop bit
-  arg->wait_(&wait, start);
-  if (arg->stop_bits_ == 2)
-    arg->wait_(&wait, start);
+    if (!this->in_frame_) {
+      if (!has_edge) {
+        // Keep the reference close to now, cycle counts wrap after a few seconds
+        if (int32_t(now - this->next_frame_) > 0)
+          this->next_frame_ = now;
+        return;
+      }
+      this->edges_tail_ = (this->edges_tail_ + 1) % this->edges_size_;
+      this->rx_level_ = edge & 1;
+      if (!this->rx_level_ && int32_t(edge_time - this->next_frame_) >= 0) {
+        // Start bit
+        this->in_frame_ = true;
+        this->frame_start_ = edge_time;
+        this->frame_bit_ = 0;
+        this->frame_data_ = 0;
+      }
+      continue;
+    }
+
+    // Sample each data bit in its middle, with the level at that time
+    const uint32_t sample = this->frame_start_ + this->bit_time_ * (this->frame_bit_ + 1) + this->bit_time_ / 2;
+    if (has_edge && int32_t(edge_time - sample) <= 0) {
+      this->edges_tail_ = (this->edges_tail_ + 1) % this->edges_size_;
+      this->rx_level_ = edge & 1;
+      continue;
+    }
+    // Without a later edge, wait until the bit is over so that no edge before the sample can still come in
+    if (!has_edge && int32_t(now - (sample + this->bit_time_ / 2)) < 0)
+      return;
 
-  arg->rx_buffer_[arg->rx_in_pos_] = rec;
-  arg->rx_in_pos_ = (arg->rx_in_pos_ + 1) % arg->rx_buffer_size_;
-  // Clear RX pin so that the interrupt doesn't re-trigger right away again.
-  arg->rx_pin_->clear_interrupt();
+    this->frame_data_ |= uint8_t(this->rx_level_) << this->frame_bit_;
+    if (++this->frame_bit_ < this->data_bits_)
+      continue;
+
+    this->push_rx_byte_(this->frame_data_);
+    this->in_frame_ = false;
+    // The parity bit isn't checked. The next start bit can come right after the (first) stop bit begins.
+    uint8_t bits = 1 + this->data_bits_;
+    if (this->parity_ != UART_CONFIG_PARITY_NONE)
+      bits++;
+    this->next_frame_ = this->frame_start_ + this->bit_time_ * bits + this->bit_time_ / 2;
+  }
+}
+void ESP8266SoftwareSerial::push_rx_byte_(uint8_t data) {
+  const size_t next = (this->rx_in_pos_ + 1) % this->rx_buffer_size_;
+  if (next == this->rx_out_pos_)
+    return;
+  this->rx_buffer_[this->rx_in_pos_] = data;
+  this->rx_in_pos_ = next;
 }
 void ICACHE_RAM_ATTR HOT ESP8266SoftwareSerial::write_byte(uint8_t data) {
   if (this->tx_pin_ == nullptr) {
@@ -273,15 +356,12 @@ void ICACHE_RAM_ATTR ESP8266SoftwareSerial::wait_(uint32_t *wait, const uint32_t
     ;
   *wait += this->bit_time_;
 }
-bool ICACHE_RAM_ATTR ESP8266SoftwareSerial::read_bit_(uint32_t *wait, const uint32_t &start) {
-  this->wait_(wait, start);
-  return this->rx_pin_->digital_read();
-}
 void ICACHE_RAM_ATTR ESP8266SoftwareSerial::write_bit_(bool bit, uint32_t *wait, const uint32_t &start) {
   this->tx_pin_->digital_write(bit);
   this->wait_(wait, start);
 }
 uint8_t ESP8266SoftwareSerial::read_byte() {
+  this->process_edges_();
   if (this->rx_in_pos_ == this->rx_out_pos_)
     return 0;
   uint8_t data = this->rx_buffer_[this->rx_out_pos_];
@@ -289,6 +369,7 @@ uint8_t ESP8266SoftwareSerial::read_byte() {
   return data;
 }
 uint8_t ESP8266SoftwareSerial::peek_byte() {
+  this->process_edges_();
   if (this->rx_in_pos_ == this->rx_out_pos_)
     return 0;
   return this->rx_buffer_[this->rx_out_pos_];
@@ -297,6 +378,7 @@ void ESP8266SoftwareSerial::flush() {
   // Flush is a NO-OP with software serial, all bytes are written immediately.
 }
 int ESP8266SoftwareSerial::available() {
+  this->process_edges_();
   int avail = int(this->rx_in_pos_) - int(this->rx_out_pos_);
   if (avail < 0)
     return avail + this->rx_buffer_size_;
@@ -23,19 +23,22 @@ STEP_MODES = {
 
 ULN2003 = uln2003_ns.class_("ULN2003", stepper.Stepper, cg.Component)
 
-CONFIG_SCHEMA = stepper.STEPPER_SCHEMA.extend(
-    {
-        cv.Required(CONF_ID): cv.declare_id(ULN2003),
-        cv.Required(CONF_PIN_A): pins.gpio_output_pin_schema,
-        cv.Required(CONF_PIN_B): pins.gpio_output_pin_schema,
-        cv.Required(CONF_PIN_C): pins.gpio_output_pin_schema,
-        cv.Required(CONF_PIN_D): pins.gpio_output_pin_schema,
-        cv.Optional(CONF_SLEEP_WHEN_DONE, default=False): cv.boolean,
-        cv.Optional(CONF_STEP_MODE, default="FULL_STEP"): cv.enum(
-            STEP_MODES, upper=True, space="_"
-        ),
-    }
-).extend(cv.COMPONENT_SCHEMA)
+CONFIG_SCHEMA = cv.All(
+    stepper.STEPPER_SCHEMA.extend(
+        {
+            cv.Required(CONF_ID): cv.declare_id(ULN2003),
+            cv.Required(CONF_PIN_A): pins.gpio_output_pin_schema,
+            cv.Required(CONF_PIN_B): pins.gpio_output_pin_schema,
+            cv.Required(CONF_PIN_C): pins.gpio_output_pin_schema,
+            cv.Required(CONF_PIN_D): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_SLEEP_WHEN_DONE, default=False): cv.boolean,
+            cv.Optional(CONF_STEP_MODE, default="FULL_STEP"): cv.enum(
+                STEP_MODES, upper=True, space="_"
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    stepper.validate_step_timer(CONF_PIN_A, CONF_PIN_B, CONF_PIN_C, CONF_PIN_D),
+)
 
 
 async def to_code(config):
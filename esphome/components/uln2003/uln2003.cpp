@@ -11,9 +11,36 @@ void ULN2003::setup() {
   this->pin_b_->setup();
   this->pin_c_->setup();
   this->pin_d_->setup();
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_step_timer_) {
+    this->isr_pins_[0] = this->pin_a_->to_isr();
+    this->isr_pins_[1] = this->pin_b_->to_isr();
+    this->isr_pins_[2] = this->pin_c_->to_isr();
+    this->isr_pins_[3] = this->pin_d_->to_isr();
+    this->use_step_timer_ = this->step_timer_.setup();
+  }
+#endif
   this->loop();
 }
 void ULN2003::loop() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_step_timer_) {
+    this->step_timer_.update_profile();
+    if (!this->has_reached_target()) {
+      this->step_timer_.start();
+    } else if (!this->step_timer_.is_running()) {
+      if (this->sleep_when_done_) {
+        this->pin_a_->digital_write(false);
+        this->pin_b_->digital_write(false);
+        this->pin_c_->digital_write(false);
+        this->pin_d_->digital_write(false);
+      } else {
+        this->write_step_(this->current_uln_pos_);
+      }
+    }
+    return;
+  }
+#endif
   int dir = this->should_step_();
   if (dir == 0 && this->has_reached_target()) {
     this->high_freq_.stop();
@@ -53,37 +80,47 @@ void ULN2003::dump_config() {
       break;
   }
   ESP_LOGCONFIG(TAG, "  Step Mode: %s", step_mode_s);
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->use_step_timer_)
+    ESP_LOGCONFIG(TAG, "  Step Timer: %u", this->step_timer_.get_timer_num());
+#endif
 }
-void ULN2003::write_step_(int32_t step) {
+uint8_t ICACHE_RAM_ATTR ULN2003::step_pattern_(int32_t step) const {
   int32_t n = this->step_mode_ == ULN2003_STEP_MODE_HALF_STEP ? 8 : 4;
   auto i = static_cast<uint32_t>((step % n + n) % n);
   uint8_t res = 0;
 
-  switch (this->step_mode_) {
-    case ULN2003_STEP_MODE_FULL_STEP: {
-      // AB, BC, CD, DA
-      res |= 1 << i;
-      res |= 1 << ((i + 1) % 4);
-      break;
-    }
-    case ULN2003_STEP_MODE_HALF_STEP: {
-      // A, AB, B, BC, C, CD, D, DA
-      res |= 1 << (i >> 1);
-      res |= 1 << (((i + 1) >> 1) & 0x3);
-      break;
-    }
-    case ULN2003_STEP_MODE_WAVE_DRIVE: {
-      // A, B, C, D
-      res |= 1 << i;
-      break;
-    }
+  // No switch, a jump table would be placed in flash which the step timer ISR can't read
+  if (this->step_mode_ == ULN2003_STEP_MODE_FULL_STEP) {
+    // AB, BC, CD, DA
+    res |= 1 << i;
+    res |= 1 << ((i + 1) % 4);
+  } else if (this->step_mode_ == ULN2003_STEP_MODE_HALF_STEP) {
+    // A, AB, B, BC, C, CD, D, DA
+    res |= 1 << (i >> 1);
+    res |= 1 << (((i + 1) >> 1) & 0x3);
+  } else {
+    // A, B, C, D
+    res |= 1 << i;
   }
-
+  return res;
+}
+void ULN2003::write_step_(int32_t step) {
+  const uint8_t res = this->step_pattern_(step);
   this->pin_a_->digital_write((res >> 0) & 1);
   this->pin_b_->digital_write((res >> 1) & 1);
   this->pin_c_->digital_write((res >> 2) & 1);
   this->pin_d_->digital_write((res >> 3) & 1);
 }
+#ifdef ARDUINO_ARCH_ESP32
+void ICACHE_RAM_ATTR HOT ULN2003::s_step(void *arg, int32_t dir) {
+  auto *uln = static_cast<ULN2003 *>(arg);
+  uln->current_uln_pos_ += dir;
+  const uint8_t res = uln->step_pattern_(uln->current_uln_pos_);
+  for (uint8_t i = 0; i < 4; i++)
+    uln->isr_pins_[i]->digital_write((res >> i) & 1);
+}
+#endif
 
 }  // namespace uln2003
 }  // namespace esphome
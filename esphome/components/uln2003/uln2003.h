@@ -26,9 +26,15 @@ class ULN2003 : public stepper::Stepper, public Component {
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
   void set_sleep_when_done(bool sleep_when_done) { this->sleep_when_done_ = sleep_when_done; }
   void set_step_mode(ULN2003StepMode step_mode) { this->step_mode_ = step_mode; }
+#ifdef ARDUINO_ARCH_ESP32
+  /// Generate the steps in a hardware timer interrupt, see stepper::StepTimer. The pins must be internal.
+  void set_step_timer(bool step_timer) { this->use_step_timer_ = step_timer; }
+#endif
 
  protected:
   void write_step_(int32_t step);
+  /// The pin states for the step, bit 0 is pin A.
+  uint8_t step_pattern_(int32_t step) const;
 
   bool sleep_when_done_{false};
   GPIOPin *pin_a_;
@@ -38,6 +44,13 @@ class ULN2003 : public stepper::Stepper, public Component {
   ULN2003StepMode step_mode_{ULN2003_STEP_MODE_FULL_STEP};
   HighFrequencyLoopRequester high_freq_;
   int32_t current_uln_pos_{0};
+#ifdef ARDUINO_ARCH_ESP32
+  static void s_step(void *arg, int32_t dir);
+
+  bool use_step_timer_{false};
+  stepper::StepTimer step_timer_{this, &ULN2003::s_step, this};
+  ISRInternalGPIOPin *isr_pins_[4];
+#endif
 };
 
 }  // namespace uln2003
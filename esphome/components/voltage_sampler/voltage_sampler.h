@@ -1,15 +1,65 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/esphal.h"
 
 namespace esphome {
 namespace voltage_sampler {
 
+/// Paces a burst of readings to a fixed rate by waiting on micros() between them.
+class SamplePacer {
+ public:
+  /// `rate` in Hz, 0 for no pacing at all.
+  explicit SamplePacer(uint32_t rate) : period_(rate == 0 ? 0 : 1000000UL / rate), next_(micros()) {}
+  /// Wait until the next reading is due.
+  void wait() {
+    if (this->period_ == 0)
+      return;
+    const int32_t remaining = int32_t(this->next_ - micros());
+    if (remaining > 0)
+      delayMicroseconds(remaining);
+    this->next_ += this->period_;
+  }
+
+ protected:
+  uint32_t period_;
+  uint32_t next_;
+};
+
 /// Abstract interface for components to request voltage (usually ADC readings)
 class VoltageSampler {
  public:
   /// Get a voltage reading, in V.
   virtual float sample() = 0;
+
+  /** Take `n` readings (in V) into `out`, `rate` per second or as fast as possible if `rate` is 0.
+   *
+   * This blocks for the whole burst, so keep `n / rate` short. Drivers override it to set up the hardware
+   * only once per burst. Returns the number of readings taken, which is less than `n` if one failed.
+   */
+  virtual size_t sample_many(float *out, size_t n, uint32_t rate) {
+    SamplePacer pacer(rate);
+    for (size_t i = 0; i < n; i++) {
+      pacer.wait();
+      out[i] = this->sample();
+      if (isnan(out[i]))
+        return i;
+    }
+    return n;
+  }
+
+  /** The rate in Hz at which continuous sampling takes samples, 0 if it's not supported.
+   *
+   * Continuous samplers fill a buffer in the background between start_continuous() and
+   * stop_continuous(), and consumers drain it in blocks with read_samples().
+   */
+  virtual uint32_t get_sample_rate() { return 0; }
+  /// Start filling the sample buffer at get_sample_rate().
+  virtual void start_continuous() {}
+  /// Stop continuous sampling, buffered samples are discarded.
+  virtual void stop_continuous() {}
+  /// Copy up to `max_count` buffered samples (in V) into `data` without blocking, returns how many were copied.
+  virtual size_t read_samples(float *data, size_t max_count) { return 0; }
 };
 
 }  // namespace voltage_sampler
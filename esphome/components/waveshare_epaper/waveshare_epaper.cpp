@@ -2,6 +2,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
+#include <algorithm>
 
 namespace esphome {
 namespace waveshare_epaper {
@@ -125,13 +126,27 @@ bool WaveshareEPaper::wait_until_idle_() {
 }
 void WaveshareEPaper::update() {
   this->do_update_();
+  // A refresh takes seconds and most of the energy, don't do it for the same picture
+  if (!this->is_dirty_()) {
+    ESP_LOGV(TAG, "Nothing changed, skipping the refresh");
+    return;
+  }
   this->display();
+  this->clear_dirty_();
 }
 void WaveshareEPaper::fill(Color color) {
   // flip logic
   const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
+  const uint32_t width = this->get_width_internal();
+  for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
+    if (this->buffer_[i] == fill)
+      continue;
     this->buffer_[i] = fill;
+    const uint32_t x = (i * 8u) % width;
+    const uint32_t y = (i * 8u) / width;
+    this->mark_dirty_(x, y);
+    this->mark_dirty_(x + 7, y);
+  }
 }
 void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || y >= this->get_height_internal() || x < 0 || y < 0)
@@ -139,11 +154,14 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color
 
   const uint32_t pos = (x + y * this->get_width_internal()) / 8u;
   const uint8_t subpos = x & 0x07;
+  const uint8_t previous = this->buffer_[pos];
   // flip logic
   if (!color.is_on())
     this->buffer_[pos] |= 0x80 >> subpos;
   else
     this->buffer_[pos] &= ~(0x80 >> subpos);
+  if (this->buffer_[pos] != previous)
+    this->mark_dirty_(x, y);
 }
 uint32_t WaveshareEPaper::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal() / 8u; }
 void WaveshareEPaper::start_command_() {
@@ -266,7 +284,20 @@ void HOT WaveshareEPaperTypeA::display() {
     this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
   }
 
-  // Set x & y regions we want to write to (full)
+  // Partial updates only need the bytes that changed in RAM, the rest of it still holds the last picture
+  const int width_bytes = this->get_width_internal() / 8;
+  int x_byte_low = 0;
+  int x_byte_high = width_bytes - 1;
+  int y_low = 0;
+  int y_high = this->get_height_internal() - 1;
+  if (!full_update && this->full_update_every_ >= 1) {
+    x_byte_low = this->dirty_x_low_ / 8;
+    x_byte_high = std::min(int(this->dirty_x_high_ / 8), width_bytes - 1);
+    y_low = this->dirty_y_low_;
+    y_high = this->dirty_y_high_;
+  }
+
+  // Set x & y regions we want to write to
   switch (this->model_) {
     case TTGO_EPAPER_2_13_IN_B1:
       // COMMAND SET RAM X ADDRESS START END POSITION
@@ -293,22 +324,22 @@ void HOT WaveshareEPaperTypeA::display() {
     default:
       // COMMAND SET RAM X ADDRESS START END POSITION
       this->command(0x44);
-      this->data(0x00);
-      this->data((this->get_width_internal() - 1) >> 3);
+      this->data(x_byte_low);
+      this->data(x_byte_high);
       // COMMAND SET RAM Y ADDRESS START END POSITION
       this->command(0x45);
-      this->data(0x00);
-      this->data(0x00);
-      this->data(this->get_height_internal() - 1);
-      this->data((this->get_height_internal() - 1) >> 8);
+      this->data(y_low);
+      this->data(y_low >> 8);
+      this->data(y_high);
+      this->data(y_high >> 8);
 
       // COMMAND SET RAM X ADDRESS COUNTER
       this->command(0x4E);
-      this->data(0x00);
+      this->data(x_byte_low);
       // COMMAND SET RAM Y ADDRESS COUNTER
       this->command(0x4F);
-      this->data(0x00);
-      this->data(0x00);
+      this->data(y_low);
+      this->data(y_low >> 8);
   }
 
   if (!this->wait_until_idle_()) {
@@ -331,7 +362,8 @@ void HOT WaveshareEPaperTypeA::display() {
       break;
     }
     default:
-      this->write_array(this->buffer_, this->get_buffer_length_());
+      for (int y = y_low; y <= y_high; y++)
+        this->write_array(this->buffer_ + y * width_bytes + x_byte_low, x_byte_high - x_byte_low + 1);
   }
   this->end_data_();
 
@@ -1,7 +1,10 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import web_server_base
-from esphome.components.web_server_base import CONF_WEB_SERVER_BASE_ID
+from esphome.components.web_server_base import (
+    CONF_WEB_SERVER_BASE_ID,
+    compressed_include,
+)
 from esphome.const import (
     CONF_CSS_INCLUDE,
     CONF_CSS_URL,
@@ -17,6 +20,13 @@ from esphome.core import coroutine_with_priority
 
 AUTO_LOAD = ["json", "web_server_base"]
 
+CONF_BATCH_EVENTS = "batch_events"
+CONF_MAX_CLIENTS = "max_clients"
+CONF_MAX_EVENT_SUBSCRIBERS = "max_event_subscribers"
+CONF_MIN_FREE_HEAP = "min_free_heap"
+CONF_CSS_INCLUDE_DATA_ID = "css_include_data_id"
+CONF_JS_INCLUDE_DATA_ID = "js_include_data_id"
+
 web_server_ns = cg.esphome_ns.namespace("web_server")
 WebServer = web_server_ns.class_("WebServer", cg.Component, cg.Controller)
 
@@ -32,12 +42,18 @@ CONFIG_SCHEMA = cv.Schema(
             CONF_JS_URL, default="https://esphome.io/_static/webserver-v1.min.js"
         ): cv.string,
         cv.Optional(CONF_JS_INCLUDE): cv.file_,
+        cv.Optional(CONF_BATCH_EVENTS, default=False): cv.boolean,
+        cv.Optional(CONF_MAX_CLIENTS): cv.int_range(min=1, max=16),
+        cv.Optional(CONF_MAX_EVENT_SUBSCRIBERS): cv.int_range(min=1, max=16),
+        cv.Optional(CONF_MIN_FREE_HEAP): cv.validate_bytes,
         cv.Optional(CONF_AUTH): cv.Schema(
             {
                 cv.Required(CONF_USERNAME): cv.string_strict,
                 cv.Required(CONF_PASSWORD): cv.string_strict,
             }
         ),
+        cv.GenerateID(CONF_CSS_INCLUDE_DATA_ID): cv.declare_id(cg.uint8),
+        cv.GenerateID(CONF_JS_INCLUDE_DATA_ID): cv.declare_id(cg.uint8),
         cv.GenerateID(CONF_WEB_SERVER_BASE_ID): cv.use_id(
             web_server_base.WebServerBase
         ),
@@ -56,14 +72,25 @@ async def to_code(config):
     cg.add_define("WEBSERVER_PORT", config[CONF_PORT])
     cg.add(var.set_css_url(config[CONF_CSS_URL]))
     cg.add(var.set_js_url(config[CONF_JS_URL]))
+    cg.add(var.set_batch_events(config[CONF_BATCH_EVENTS]))
+    if CONF_MAX_CLIENTS in config:
+        cg.add(paren.set_max_clients(config[CONF_MAX_CLIENTS]))
+    if CONF_MAX_EVENT_SUBSCRIBERS in config:
+        cg.add(paren.set_max_event_subscribers(config[CONF_MAX_EVENT_SUBSCRIBERS]))
+    if CONF_MIN_FREE_HEAP in config:
+        cg.add(paren.set_min_free_heap(config[CONF_MIN_FREE_HEAP]))
     if CONF_AUTH in config:
         cg.add(var.set_username(config[CONF_AUTH][CONF_USERNAME]))
         cg.add(var.set_password(config[CONF_AUTH][CONF_PASSWORD]))
     if CONF_CSS_INCLUDE in config:
         cg.add_define("WEBSERVER_CSS_INCLUDE")
-        with open(config[CONF_CSS_INCLUDE], "r") as myfile:
-            cg.add(var.set_css_include(myfile.read()))
+        arr, size = compressed_include(
+            config[CONF_CSS_INCLUDE_DATA_ID], config[CONF_CSS_INCLUDE]
+        )
+        cg.add(var.set_css_include(arr, size))
     if CONF_JS_INCLUDE in config:
         cg.add_define("WEBSERVER_JS_INCLUDE")
-        with open(config[CONF_JS_INCLUDE], "r") as myfile:
-            cg.add(var.set_js_include(myfile.read()))
+        arr, size = compressed_include(
+            config[CONF_JS_INCLUDE_DATA_ID], config[CONF_JS_INCLUDE]
+        )
+        cg.add(var.set_js_include(arr, size))
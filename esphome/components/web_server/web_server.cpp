@@ -6,7 +6,10 @@
 
 #include "StreamString.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
 
 #ifdef USE_LOGGER
 #include <esphome/components/logger/logger.h>
@@ -29,7 +32,7 @@ void write_row(AsyncResponseStream *stream, Nameable *obj, const std::string &kl
   stream->print("\" id=\"");
   stream->print(klass.c_str());
   stream->print("-");
-  stream->print(obj->get_object_id().c_str());
+  stream->print(obj->get_object_id());
   stream->print("\"><td>");
   stream->print(obj->get_name().c_str());
   stream->print("</td><td></td><td>");
@@ -38,93 +41,132 @@ void write_row(AsyncResponseStream *stream, Nameable *obj, const std::string &kl
   stream->print("</tr>");
 }
 
-UrlMatch match_url(const std::string &url, bool only_domain = false) {
-  UrlMatch match;
-  match.valid = false;
-  size_t domain_end = url.find('/', 1);
-  if (domain_end == std::string::npos)
+static bool equals(const char *part, size_t length, const char *str) {
+  return strncmp(part, str, length) == 0 && str[length] == '\0';
+}
+bool UrlMatch::domain_equals(const char *str) const { return equals(this->domain, this->domain_length, str); }
+bool UrlMatch::id_equals(const char *str) const { return equals(this->id, this->id_length, str); }
+bool UrlMatch::method_equals(const char *str) const { return equals(this->method, this->method_length, str); }
+
+UrlMatch match_url(const char *url, size_t length, bool only_domain = false) {
+  UrlMatch match{url, 0, url, 0, url, 0, false};
+  if (length < 1)
+    return match;
+  const char *end = url + length;
+  const char *domain_end = static_cast<const char *>(memchr(url + 1, '/', length - 1));
+  if (domain_end == nullptr)
     return match;
-  match.domain = url.substr(1, domain_end - 1);
+  match.domain = url + 1;
+  match.domain_length = domain_end - match.domain;
   if (only_domain) {
     match.valid = true;
     return match;
   }
-  if (url.length() == domain_end - 1)
+  if (domain_end + 1 == end)
     return match;
-  size_t id_begin = domain_end + 1;
-  size_t id_end = url.find('/', id_begin);
+  match.id = domain_end + 1;
+  const char *id_end = static_cast<const char *>(memchr(match.id, '/', end - match.id));
   match.valid = true;
-  if (id_end == std::string::npos) {
-    match.id = url.substr(id_begin, url.length() - id_begin);
+  if (id_end == nullptr) {
+    match.id_length = end - match.id;
     return match;
   }
-  match.id = url.substr(id_begin, id_end - id_begin);
-  size_t method_begin = id_end + 1;
-  match.method = url.substr(method_begin, url.length() - method_begin);
+  match.id_length = id_end - match.id;
+  match.method = id_end + 1;
+  match.method_length = end - match.method;
   return match;
 }
 
+template<typename T> void WebServer::build_index_(EntityIndex &index, const std::vector<T *> &entities) {
+  index.clear();
+  for (T *obj : entities) {
+    if (!obj->is_internal())
+      index.push_back(IndexEntry{obj->get_object_id_hash(), obj});
+  }
+  std::sort(index.begin(), index.end(),
+            [](const IndexEntry &a, const IndexEntry &b) { return a.object_id_hash < b.object_id_hash; });
+}
+Nameable *WebServer::find_entity_(const EntityIndex &index, const UrlMatch &match) {
+  const uint32_t hash = fnv1_hash(match.id, match.id_length);
+  auto it = std::lower_bound(index.begin(), index.end(), hash,
+                             [](const IndexEntry &entry, uint32_t hash) { return entry.object_id_hash < hash; });
+  // Object ids with the same hash are next to each other
+  for (; it != index.end() && it->object_id_hash == hash; it++) {
+    if (match.id_equals(it->obj->get_object_id()))
+      return it->obj;
+  }
+  return nullptr;
+}
+
 void WebServer::set_css_url(const char *css_url) { this->css_url_ = css_url; }
-void WebServer::set_css_include(const char *css_include) { this->css_include_ = css_include; }
+void WebServer::set_css_include(const uint8_t *css_include, size_t size) {
+  this->css_include_ = css_include;
+  this->css_include_size_ = size;
+}
 void WebServer::set_js_url(const char *js_url) { this->js_url_ = js_url; }
-void WebServer::set_js_include(const char *js_include) { this->js_include_ = js_include; }
+void WebServer::set_js_include(const uint8_t *js_include, size_t size) {
+  this->js_include_ = js_include;
+  this->js_include_size_ = size;
+}
 
 void WebServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up web server...");
   this->setup_controller();
   this->base_->init();
 
-  this->events_.onConnect([this](AsyncEventSourceClient *client) {
-    // Configure reconnect timeout
-    client->send("", "ping", millis(), 30000);
-
 #ifdef USE_SENSOR
-    for (auto *obj : App.get_sensors())
-      if (!obj->is_internal())
-        client->send(this->sensor_json(obj, obj->state).c_str(), "state");
+  build_index_(this->sensor_index_, App.get_sensors());
 #endif
-
 #ifdef USE_SWITCH
-    for (auto *obj : App.get_switches())
-      if (!obj->is_internal())
-        client->send(this->switch_json(obj, obj->state).c_str(), "state");
+  build_index_(this->switch_index_, App.get_switches());
 #endif
-
 #ifdef USE_BINARY_SENSOR
-    for (auto *obj : App.get_binary_sensors())
-      if (!obj->is_internal())
-        client->send(this->binary_sensor_json(obj, obj->state).c_str(), "state");
+  build_index_(this->binary_sensor_index_, App.get_binary_sensors());
 #endif
-
 #ifdef USE_FAN
-    for (auto *obj : App.get_fans())
-      if (!obj->is_internal())
-        client->send(this->fan_json(obj).c_str(), "state");
+  build_index_(this->fan_index_, App.get_fans());
 #endif
-
 #ifdef USE_LIGHT
-    for (auto *obj : App.get_lights())
-      if (!obj->is_internal())
-        client->send(this->light_json(obj).c_str(), "state");
+  build_index_(this->light_index_, App.get_lights());
 #endif
-
 #ifdef USE_TEXT_SENSOR
-    for (auto *obj : App.get_text_sensors())
-      if (!obj->is_internal())
-        client->send(this->text_sensor_json(obj, obj->state).c_str(), "state");
+  build_index_(this->text_sensor_index_, App.get_text_sensors());
 #endif
-
 #ifdef USE_COVER
-    for (auto *obj : App.get_covers())
-      if (!obj->is_internal())
-        client->send(this->cover_json(obj).c_str(), "state");
+  build_index_(this->cover_index_, App.get_covers());
 #endif
-
 #ifdef USE_NUMBER
-    for (auto *obj : App.get_numbers())
-      if (!obj->is_internal())
-        client->send(this->number_json(obj, obj->state).c_str(), "state");
+  build_index_(this->number_index_, App.get_numbers());
 #endif
+
+  char etag[12];
+  snprintf(etag, sizeof(etag), "\"%08x\"", fnv1_hash(App.get_compilation_time()));
+  this->etag_ = etag;
+
+  this->events_.onConnect([this](AsyncEventSourceClient *client) {
+    // Configure reconnect timeout
+    client->send("", "ping", millis(), 30000);
+
+    if (this->batch_events_) {
+      std::string states = "[";
+      std::string data;
+      for (size_t i = 0; this->entity_json_(i, data); i++) {
+        if (data.empty())
+          continue;
+        if (states.size() > 1)
+          states.push_back(',');
+        states += data;
+      }
+      states.push_back(']');
+      client->send(states.c_str(), "states");
+      return;
+    }
+
+    std::string data;
+    for (size_t i = 0; this->entity_json_(i, data); i++) {
+      if (!data.empty())
+        client->send(data.c_str(), "state");
+    }
   });
 
 #ifdef USE_LOGGER
@@ -132,7 +174,7 @@ void WebServer::setup() {
     logger::global_logger->add_on_log_callback(
         [this](int level, const char *tag, const char *message) { this->events_.send(message, "log", millis()); });
 #endif
-  this->base_->add_handler(&this->events_);
+  this->base_->add_event_source(&this->events_);
   this->base_->add_handler(this);
   this->base_->add_ota_handler();
 
@@ -146,9 +188,193 @@ void WebServer::dump_config() {
   }
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
+void WebServer::loop() {
+  if (this->pending_events_.empty())
+    return;
+
+  std::string states = "[";
+  for (auto &event : this->pending_events_) {
+    if (states.size() > 1)
+      states.push_back(',');
+    states += event.json;
+  }
+  states.push_back(']');
+  this->pending_events_.clear();
+  this->events_.send(states.c_str(), "states");
+}
+
+void WebServer::send_state_event_(const void *obj, std::string &&json) {
+  if (!this->batch_events_) {
+    this->events_.send(json.c_str(), "state");
+    return;
+  }
+  // An entity updated several times in one loop iteration is only sent with its latest state
+  for (auto &event : this->pending_events_) {
+    if (event.obj == obj) {
+      event.json = std::move(json);
+      return;
+    }
+  }
+  this->pending_events_.push_back(PendingEvent{obj, std::move(json)});
+}
+
+bool WebServer::entity_json_(size_t index, std::string &out) {
+  out.clear();
+#ifdef USE_SENSOR
+  if (index < App.get_sensors().size()) {
+    auto *obj = App.get_sensors()[index];
+    if (!obj->is_internal())
+      out = this->sensor_json(obj, obj->state);
+    return true;
+  }
+  index -= App.get_sensors().size();
+#endif
+
+#ifdef USE_SWITCH
+  if (index < App.get_switches().size()) {
+    auto *obj = App.get_switches()[index];
+    if (!obj->is_internal())
+      out = this->switch_json(obj, obj->state);
+    return true;
+  }
+  index -= App.get_switches().size();
+#endif
+
+#ifdef USE_BINARY_SENSOR
+  if (index < App.get_binary_sensors().size()) {
+    auto *obj = App.get_binary_sensors()[index];
+    if (!obj->is_internal())
+      out = this->binary_sensor_json(obj, obj->state);
+    return true;
+  }
+  index -= App.get_binary_sensors().size();
+#endif
+
+#ifdef USE_FAN
+  if (index < App.get_fans().size()) {
+    auto *obj = App.get_fans()[index];
+    if (!obj->is_internal())
+      out = this->fan_json(obj);
+    return true;
+  }
+  index -= App.get_fans().size();
+#endif
+
+#ifdef USE_LIGHT
+  if (index < App.get_lights().size()) {
+    auto *obj = App.get_lights()[index];
+    if (!obj->is_internal())
+      out = this->light_json(obj);
+    return true;
+  }
+  index -= App.get_lights().size();
+#endif
+
+#ifdef USE_TEXT_SENSOR
+  if (index < App.get_text_sensors().size()) {
+    auto *obj = App.get_text_sensors()[index];
+    if (!obj->is_internal())
+      out = this->text_sensor_json(obj, obj->state);
+    return true;
+  }
+  index -= App.get_text_sensors().size();
+#endif
+
+#ifdef USE_COVER
+  if (index < App.get_covers().size()) {
+    auto *obj = App.get_covers()[index];
+    if (!obj->is_internal())
+      out = this->cover_json(obj);
+    return true;
+  }
+  index -= App.get_covers().size();
+#endif
+
+#ifdef USE_NUMBER
+  if (index < App.get_numbers().size()) {
+    auto *obj = App.get_numbers()[index];
+    if (!obj->is_internal())
+      out = this->number_json(obj, obj->state);
+    return true;
+  }
+  index -= App.get_numbers().size();
+#endif
+
+  return false;
+}
+
+void WebServer::handle_states_request(AsyncWebServerRequest *request) {
+  // Entities are serialized one at a time while the response is sent, so the full array is never held in memory
+  struct Cursor {
+    size_t index{0};
+    std::string chunk{"["};
+    size_t offset{0};
+    bool first{true};
+    bool done{false};
+  };
+  auto cursor = std::make_shared<Cursor>();
+  AsyncWebServerResponse *response = request->beginChunkedResponse(
+      "application/json", [this, cursor](uint8_t *buffer, size_t max_len, size_t index) -> size_t {
+        size_t written = 0;
+        while (written < max_len) {
+          if (cursor->offset == cursor->chunk.size()) {
+            if (cursor->done)
+              break;
+            cursor->offset = 0;
+            cursor->chunk.clear();
+            std::string data;
+            while (this->entity_json_(cursor->index, data) && data.empty())
+              cursor->index++;
+            if (data.empty()) {
+              cursor->chunk = "]";
+              cursor->done = true;
+              continue;
+            }
+            if (!cursor->first)
+              cursor->chunk.push_back(',');
+            cursor->first = false;
+            cursor->chunk += data;
+            cursor->index++;
+            continue;
+          }
+          size_t len = std::min(max_len - written, cursor->chunk.size() - cursor->offset);
+          memcpy(buffer + written, cursor->chunk.data() + cursor->offset, len);
+          cursor->offset += len;
+          written += len;
+        }
+        return written;
+      });
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  request->send(response);
+}
+
+bool WebServer::handle_not_modified_(AsyncWebServerRequest *request) {
+  AsyncWebHeader *header = request->getHeader("If-None-Match");
+  if (header == nullptr || header->value() != this->etag_.c_str())
+    return false;
+  AsyncWebServerResponse *response = request->beginResponse(304);
+  this->add_cache_headers_(response);
+  request->send(response);
+  return true;
+}
+void WebServer::add_cache_headers_(AsyncWebServerResponse *response) {
+  response->addHeader("ETag", this->etag_.c_str());
+  // Revalidate every time, the content changes with an OTA update
+  response->addHeader("Cache-Control", "no-cache");
+}
+void WebServer::send_compressed_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data,
+                                 size_t size) {
+  AsyncWebServerResponse *response = request->beginResponse_P(200, content_type, data, size);
+  response->addHeader("Content-Encoding", "gzip");
+  this->add_cache_headers_(response);
+  request->send(response);
+}
 
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  if (this->handle_not_modified_(request))
+    return;
   AsyncResponseStream *stream = request->beginResponseStream("text/html");
+  this->add_cache_headers_(stream);
   std::string title = App.get_name() + " Web Server";
   stream->print(F("<!DOCTYPE html><html lang=\"en\"><head><meta charset=UTF-8><title>"));
   stream->print(title.c_str());
@@ -229,115 +455,119 @@ void WebServer::handle_index_request(AsyncWebServerRequest *request) {
 
 #ifdef WEBSERVER_CSS_INCLUDE
 void WebServer::handle_css_request(AsyncWebServerRequest *request) {
-  AsyncResponseStream *stream = request->beginResponseStream("text/css");
-  if (this->css_include_ != nullptr) {
-    stream->print(this->css_include_);
+  if (this->css_include_ == nullptr) {
+    request->send(404);
+    return;
   }
-
-  request->send(stream);
+  if (this->handle_not_modified_(request))
+    return;
+  this->send_compressed_(request, "text/css", this->css_include_, this->css_include_size_);
 }
 #endif
 
 #ifdef WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
-  AsyncResponseStream *stream = request->beginResponseStream("text/javascript");
-  if (this->js_include_ != nullptr) {
-    stream->print(this->js_include_);
+  if (this->js_include_ == nullptr) {
+    request->send(404);
+    return;
   }
-
-  request->send(stream);
+  if (this->handle_not_modified_(request))
+    return;
+  this->send_compressed_(request, "text/javascript", this->js_include_, this->js_include_size_);
 }
 #endif
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  this->events_.send(this->sensor_json(obj, state).c_str(), "state");
+  this->send_state_event_(obj, this->sensor_json(obj, state));
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->sensor_json(obj, obj->state);
-    request->send(200, "text/json", data.c_str());
+  auto *obj = static_cast<sensor::Sensor *>(find_entity_(this->sensor_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  std::string data = this->sensor_json(obj, obj->state);
+  request->send(200, "text/json", data.c_str());
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value) {
-  return json::build_json([obj, value](JsonObject &root) {
-    root["id"] = "sensor-" + obj->get_object_id();
-    std::string state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
-    if (!obj->get_unit_of_measurement().empty())
-      state += " " + obj->get_unit_of_measurement();
-    root["state"] = state;
-    root["value"] = value;
+  return json::write_json([obj, value](json::JsonWriter &root) {
+    root.add("id", std::string("sensor-") + obj->get_object_id());
+    char buf[VALUE_ACCURACY_MAX_LEN];
+    size_t len = value_accuracy_to_buf(buf, sizeof(buf), value, obj->get_accuracy_decimals());
+    const std::string &unit = obj->get_unit_of_measurement();
+    if (unit.empty()) {
+      root.add("state", buf);
+    } else {
+      std::string state;
+      state.reserve(len + 1 + unit.size());
+      state.append(buf, len);
+      state.push_back(' ');
+      state.append(unit);
+      root.add("state", state);
+    }
+    root.add("value", value);
   });
 }
 #endif
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  this->events_.send(this->text_sensor_json(obj, state).c_str(), "state");
+  this->send_state_event_(obj, this->text_sensor_json(obj, state));
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->text_sensor_json(obj, obj->state);
-    request->send(200, "text/json", data.c_str());
+  auto *obj = static_cast<text_sensor::TextSensor *>(find_entity_(this->text_sensor_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  std::string data = this->text_sensor_json(obj, obj->state);
+  request->send(200, "text/json", data.c_str());
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value) {
-  return json::build_json([obj, value](JsonObject &root) {
-    root["id"] = "text_sensor-" + obj->get_object_id();
-    root["state"] = value;
-    root["value"] = value;
+  return json::write_json([obj, value](json::JsonWriter &root) {
+    root.add("id", std::string("text_sensor-") + obj->get_object_id());
+    root.add("state", value);
+    root.add("value", value);
   });
 }
 #endif
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
-  this->events_.send(this->switch_json(obj, state).c_str(), "state");
+  this->send_state_event_(obj, this->switch_json(obj, state));
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value) {
-  return json::build_json([obj, value](JsonObject &root) {
-    root["id"] = "switch-" + obj->get_object_id();
-    root["state"] = value ? "ON" : "OFF";
-    root["value"] = value;
+  return json::write_json([obj, value](json::JsonWriter &root) {
+    root.add("id", std::string("switch-") + obj->get_object_id());
+    root.add("state", value ? "ON" : "OFF");
+    root.add("value", value);
   });
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->switch_json(obj, obj->state);
-      request->send(200, "text/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->defer([obj]() { obj->toggle(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      this->defer([obj]() { obj->turn_on(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->defer([obj]() { obj->turn_off(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  auto *obj = static_cast<switch_::Switch *>(find_entity_(this->switch_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  if (request->method() == HTTP_GET) {
+    std::string data = this->switch_json(obj, obj->state);
+    request->send(200, "text/json", data.c_str());
+  } else if (match.method_equals("toggle")) {
+    this->defer([obj]() { obj->toggle(); });
+    request->send(200);
+  } else if (match.method_equals("turn_on")) {
+    this->defer([obj]() { obj->turn_on(); });
+    request->send(200);
+  } else if (match.method_equals("turn_off")) {
+    this->defer([obj]() { obj->turn_off(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
@@ -345,26 +575,24 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
   if (obj->is_internal())
     return;
-  this->events_.send(this->binary_sensor_json(obj, state).c_str(), "state");
+  this->send_state_event_(obj, this->binary_sensor_json(obj, state));
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value) {
-  return json::build_json([obj, value](JsonObject &root) {
-    root["id"] = "binary_sensor-" + obj->get_object_id();
-    root["state"] = value ? "ON" : "OFF";
-    root["value"] = value;
+  return json::write_json([obj, value](json::JsonWriter &root) {
+    root.add("id", std::string("binary_sensor-") + obj->get_object_id());
+    root.add("state", value ? "ON" : "OFF");
+    root.add("value", value);
   });
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->binary_sensor_json(obj, obj->state);
-    request->send(200, "text/json", data.c_str());
+  auto *obj = static_cast<binary_sensor::BinarySensor *>(find_entity_(this->binary_sensor_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  std::string data = this->binary_sensor_json(obj, obj->state);
+  request->send(200, "text/json", data.c_str());
 }
 #endif
 
@@ -372,89 +600,86 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, con
 void WebServer::on_fan_update(fan::FanState *obj) {
   if (obj->is_internal())
     return;
-  this->events_.send(this->fan_json(obj).c_str(), "state");
+  this->send_state_event_(obj, this->fan_json(obj));
 }
 std::string WebServer::fan_json(fan::FanState *obj) {
-  return json::build_json([obj](JsonObject &root) {
-    root["id"] = "fan-" + obj->get_object_id();
-    root["state"] = obj->state ? "ON" : "OFF";
-    root["value"] = obj->state;
+  return json::write_json([obj](json::JsonWriter &root) {
+    root.add("id", std::string("fan-") + obj->get_object_id());
+    root.add("state", obj->state ? "ON" : "OFF");
+    root.add("value", obj->state);
     const auto traits = obj->get_traits();
     if (traits.supports_speed()) {
-      root["speed_level"] = obj->speed;
+      root.add("speed_level", obj->speed);
       switch (fan::speed_level_to_enum(obj->speed, traits.supported_speed_count())) {
         case fan::FAN_SPEED_LOW:
-          root["speed"] = "low";
+          root.add("speed", "low");
           break;
         case fan::FAN_SPEED_MEDIUM:
-          root["speed"] = "medium";
+          root.add("speed", "medium");
           break;
         case fan::FAN_SPEED_HIGH:
-          root["speed"] = "high";
+          root.add("speed", "high");
           break;
       }
     }
     if (obj->get_traits().supports_oscillation())
-      root["oscillation"] = obj->oscillating;
+      root.add("oscillation", obj->oscillating);
   });
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::FanState *obj : App.get_fans()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->fan_json(obj);
-      request->send(200, "text/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->defer([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("speed")) {
-        String speed = request->getParam("speed")->value();
-        call.set_speed(speed.c_str());
+  auto *obj = static_cast<fan::FanState *>(find_entity_(this->fan_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
+
+  if (request->method() == HTTP_GET) {
+    std::string data = this->fan_json(obj);
+    request->send(200, "text/json", data.c_str());
+  } else if (match.method_equals("toggle")) {
+    this->defer([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method_equals("turn_on")) {
+    auto call = obj->turn_on();
+    if (request->hasParam("speed")) {
+      String speed = request->getParam("speed")->value();
+      call.set_speed(speed.c_str());
+    }
+    if (request->hasParam("speed_level")) {
+      String speed_level = request->getParam("speed_level")->value();
+      auto val = parse_int(speed_level.c_str());
+      if (!val.has_value()) {
+        ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+        return;
       }
-      if (request->hasParam("speed_level")) {
-        String speed_level = request->getParam("speed_level")->value();
-        auto val = parse_int(speed_level.c_str());
-        if (!val.has_value()) {
-          ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+      call.set_speed(*val);
+    }
+    if (request->hasParam("oscillation")) {
+      String speed = request->getParam("oscillation")->value();
+      auto val = parse_on_off(speed.c_str());
+      switch (val) {
+        case PARSE_ON:
+          call.set_oscillating(true);
+          break;
+        case PARSE_OFF:
+          call.set_oscillating(false);
+          break;
+        case PARSE_TOGGLE:
+          call.set_oscillating(!obj->oscillating);
+          break;
+        case PARSE_NONE:
+          request->send(404);
           return;
-        }
-        call.set_speed(*val);
-      }
-      if (request->hasParam("oscillation")) {
-        String speed = request->getParam("oscillation")->value();
-        auto val = parse_on_off(speed.c_str());
-        switch (val) {
-          case PARSE_ON:
-            call.set_oscillating(true);
-            break;
-          case PARSE_OFF:
-            call.set_oscillating(false);
-            break;
-          case PARSE_TOGGLE:
-            call.set_oscillating(!obj->oscillating);
-            break;
-          case PARSE_NONE:
-            request->send(404);
-            return;
-        }
       }
-      this->defer([call]() { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->defer([obj]() { obj->turn_off().perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->defer([call]() { call.perform(); });
+    request->send(200);
+  } else if (match.method_equals("turn_off")) {
+    this->defer([obj]() { obj->turn_off().perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 #endif
 
@@ -462,72 +687,68 @@ void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatc
 void WebServer::on_light_update(light::LightState *obj) {
   if (obj->is_internal())
     return;
-  this->events_.send(this->light_json(obj).c_str(), "state");
+  this->send_state_event_(obj, this->light_json(obj));
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->light_json(obj);
-      request->send(200, "text/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->defer([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("brightness"))
-        call.set_brightness(request->getParam("brightness")->value().toFloat() / 255.0f);
-      if (request->hasParam("r"))
-        call.set_red(request->getParam("r")->value().toFloat() / 255.0f);
-      if (request->hasParam("g"))
-        call.set_green(request->getParam("g")->value().toFloat() / 255.0f);
-      if (request->hasParam("b"))
-        call.set_blue(request->getParam("b")->value().toFloat() / 255.0f);
-      if (request->hasParam("white_value"))
-        call.set_white(request->getParam("white_value")->value().toFloat() / 255.0f);
-      if (request->hasParam("color_temp"))
-        call.set_color_temperature(request->getParam("color_temp")->value().toFloat());
-
-      if (request->hasParam("flash")) {
-        float length_s = request->getParam("flash")->value().toFloat();
-        call.set_flash_length(static_cast<uint32_t>(length_s * 1000));
-      }
+  auto *obj = static_cast<light::LightState *>(find_entity_(this->light_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-      if (request->hasParam("transition")) {
-        float length_s = request->getParam("transition")->value().toFloat();
-        call.set_transition_length(static_cast<uint32_t>(length_s * 1000));
-      }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->light_json(obj);
+    request->send(200, "text/json", data.c_str());
+  } else if (match.method_equals("toggle")) {
+    this->defer([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method_equals("turn_on")) {
+    auto call = obj->turn_on();
+    if (request->hasParam("brightness"))
+      call.set_brightness(request->getParam("brightness")->value().toFloat() / 255.0f);
+    if (request->hasParam("r"))
+      call.set_red(request->getParam("r")->value().toFloat() / 255.0f);
+    if (request->hasParam("g"))
+      call.set_green(request->getParam("g")->value().toFloat() / 255.0f);
+    if (request->hasParam("b"))
+      call.set_blue(request->getParam("b")->value().toFloat() / 255.0f);
+    if (request->hasParam("white_value"))
+      call.set_white(request->getParam("white_value")->value().toFloat() / 255.0f);
+    if (request->hasParam("color_temp"))
+      call.set_color_temperature(request->getParam("color_temp")->value().toFloat());
+
+    if (request->hasParam("flash")) {
+      float length_s = request->getParam("flash")->value().toFloat();
+      call.set_flash_length(static_cast<uint32_t>(length_s * 1000));
+    }
 
-      if (request->hasParam("effect")) {
-        const char *effect = request->getParam("effect")->value().c_str();
-        call.set_effect(effect);
-      }
+    if (request->hasParam("transition")) {
+      float length_s = request->getParam("transition")->value().toFloat();
+      call.set_transition_length(static_cast<uint32_t>(length_s * 1000));
+    }
 
-      this->defer([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      auto call = obj->turn_off();
-      if (request->hasParam("transition")) {
-        auto length = (uint32_t) request->getParam("transition")->value().toFloat() * 1000;
-        call.set_transition_length(length);
-      }
-      this->defer([call]() mutable { call.perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
+    if (request->hasParam("effect")) {
+      const char *effect = request->getParam("effect")->value().c_str();
+      call.set_effect(effect);
     }
-    return;
+
+    this->defer([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method_equals("turn_off")) {
+    auto call = obj->turn_off();
+    if (request->hasParam("transition")) {
+      auto length = (uint32_t) request->getParam("transition")->value().toFloat() * 1000;
+      call.set_transition_length(length);
+    }
+    this->defer([call]() mutable { call.perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 std::string WebServer::light_json(light::LightState *obj) {
-  return json::build_json([obj](JsonObject &root) {
-    root["id"] = "light-" + obj->get_object_id();
-    root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
+  return json::write_json([obj](json::JsonWriter &root) {
+    root.add("id", std::string("light-") + obj->get_object_id());
     obj->dump_json(root);
   });
 }
@@ -537,95 +758,96 @@ std::string WebServer::light_json(light::LightState *obj) {
 void WebServer::on_cover_update(cover::Cover *obj) {
   if (obj->is_internal())
     return;
-  this->events_.send(this->cover_json(obj).c_str(), "state");
+  this->send_state_event_(obj, this->cover_json(obj));
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->cover_json(obj);
-      request->send(200, "text/json", data.c_str());
-      continue;
-    }
-
-    auto call = obj->make_call();
-    if (match.method == "open") {
-      call.set_command_open();
-    } else if (match.method == "close") {
-      call.set_command_close();
-    } else if (match.method == "stop") {
-      call.set_command_stop();
-    } else if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto *obj = static_cast<cover::Cover *>(find_entity_(this->cover_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
 
-    auto traits = obj->get_traits();
-    if ((request->hasParam("position") && !traits.get_supports_position()) ||
-        (request->hasParam("tilt") && !traits.get_supports_tilt())) {
-      request->send(409);
-      return;
-    }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->cover_json(obj);
+    request->send(200, "text/json", data.c_str());
+    return;
+  }
 
-    if (request->hasParam("position"))
-      call.set_position(request->getParam("position")->value().toFloat());
-    if (request->hasParam("tilt"))
-      call.set_tilt(request->getParam("tilt")->value().toFloat());
+  auto call = obj->make_call();
+  if (match.method_equals("open")) {
+    call.set_command_open();
+  } else if (match.method_equals("close")) {
+    call.set_command_close();
+  } else if (match.method_equals("stop")) {
+    call.set_command_stop();
+  } else if (!match.method_equals("set")) {
+    request->send(404);
+    return;
+  }
 
-    this->defer([call]() mutable { call.perform(); });
-    request->send(200);
+  auto traits = obj->get_traits();
+  if ((request->hasParam("position") && !traits.get_supports_position()) ||
+      (request->hasParam("tilt") && !traits.get_supports_tilt())) {
+    request->send(409);
     return;
   }
-  request->send(404);
+
+  if (request->hasParam("position"))
+    call.set_position(request->getParam("position")->value().toFloat());
+  if (request->hasParam("tilt"))
+    call.set_tilt(request->getParam("tilt")->value().toFloat());
+
+  this->defer([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::cover_json(cover::Cover *obj) {
-  return json::build_json([obj](JsonObject &root) {
-    root["id"] = "cover-" + obj->get_object_id();
-    root["state"] = obj->is_fully_closed() ? "CLOSED" : "OPEN";
-    root["value"] = obj->position;
-    root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
+  return json::write_json([obj](json::JsonWriter &root) {
+    root.add("id", std::string("cover-") + obj->get_object_id());
+    root.add("state", obj->is_fully_closed() ? "CLOSED" : "OPEN");
+    root.add("value", obj->position);
+    root.add("current_operation", cover::cover_operation_to_str(obj->current_operation));
 
     if (obj->get_traits().get_supports_tilt())
-      root["tilt"] = obj->tilt;
+      root.add("tilt", obj->tilt);
   });
 }
 #endif
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
-  this->events_.send(this->number_json(obj, state).c_str(), "state");
+  this->send_state_event_(obj, this->number_json(obj, state));
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->is_internal())
-      continue;
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->number_json(obj, obj->state);
-    request->send(200, "text/json", data.c_str());
+  auto *obj = static_cast<number::Number *>(find_entity_(this->number_index_, match));
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  std::string data = this->number_json(obj, obj->state);
+  request->send(200, "text/json", data.c_str());
 }
 std::string WebServer::number_json(number::Number *obj, float value) {
-  return json::build_json([obj, value](JsonObject &root) {
-    root["id"] = "number-" + obj->get_object_id();
+  return json::write_json([obj, value](json::JsonWriter &root) {
+    root.add("id", std::string("number-") + obj->get_object_id());
     char buffer[64];
     snprintf(buffer, sizeof(buffer), "%f", value);
-    root["state"] = buffer;
-    root["value"] = value;
+    root.add("state", buffer);
+    root.add("value", value);
   });
 }
 #endif
 
 bool WebServer::canHandle(AsyncWebServerRequest *request) {
+  // Needed for handle_not_modified_(), AsyncWebServer drops all other headers
+  request->addInterestingHeader("If-None-Match");
+
   if (request->url() == "/")
     return true;
 
+  if (request->url() == "/states")
+    return request->method() == HTTP_GET;
+
 #ifdef WEBSERVER_CSS_INCLUDE
   if (request->url() == "/0.css")
     return true;
@@ -636,52 +858,54 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
     return true;
 #endif
 
-  UrlMatch match = match_url(request->url().c_str(), true);
+  const String &url = request->url();
+  UrlMatch match = match_url(url.c_str(), url.length(), true);
   if (!match.valid)
     return false;
 #ifdef USE_SENSOR
-  if (request->method() == HTTP_GET && match.domain == "sensor")
+  if (request->method() == HTTP_GET && match.domain_equals("sensor"))
     return true;
 #endif
 
 #ifdef USE_SWITCH
-  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain == "switch")
+  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain_equals("switch"))
     return true;
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  if (request->method() == HTTP_GET && match.domain == "binary_sensor")
+  if (request->method() == HTTP_GET && match.domain_equals("binary_sensor"))
     return true;
 #endif
 
 #ifdef USE_FAN
-  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain == "fan")
+  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain_equals("fan"))
     return true;
 #endif
 
 #ifdef USE_LIGHT
-  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain == "light")
+  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain_equals("light"))
     return true;
 #endif
 
 #ifdef USE_TEXT_SENSOR
-  if (request->method() == HTTP_GET && match.domain == "text_sensor")
+  if (request->method() == HTTP_GET && match.domain_equals("text_sensor"))
     return true;
 #endif
 
 #ifdef USE_COVER
-  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain == "cover")
+  if ((request->method() == HTTP_POST || request->method() == HTTP_GET) && match.domain_equals("cover"))
     return true;
 #endif
 
 #ifdef USE_NUMBER
-  if (request->method() == HTTP_GET && match.domain == "number")
+  if (request->method() == HTTP_GET && match.domain_equals("number"))
     return true;
 #endif
 
   return false;
 }
 void WebServer::handleRequest(AsyncWebServerRequest *request) {
+  network_notify_activity();
   if (this->using_auth() && !request->authenticate(this->username_, this->password_)) {
     return request->requestAuthentication();
   }
@@ -691,6 +915,11 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
     return;
   }
 
+  if (request->url() == "/states") {
+    this->handle_states_request(request);
+    return;
+  }
+
 #ifdef WEBSERVER_CSS_INCLUDE
   if (request->url() == "/0.css") {
     this->handle_css_request(request);
@@ -705,58 +934,59 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 #endif
 
-  UrlMatch match = match_url(request->url().c_str());
+  const String &url = request->url();
+  UrlMatch match = match_url(url.c_str(), url.length());
 #ifdef USE_SENSOR
-  if (match.domain == "sensor") {
+  if (match.domain_equals("sensor")) {
     this->handle_sensor_request(request, match);
     return;
   }
 #endif
 
 #ifdef USE_SWITCH
-  if (match.domain == "switch") {
+  if (match.domain_equals("switch")) {
     this->handle_switch_request(request, match);
     return;
   }
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  if (match.domain == "binary_sensor") {
+  if (match.domain_equals("binary_sensor")) {
     this->handle_binary_sensor_request(request, match);
     return;
   }
 #endif
 
 #ifdef USE_FAN
-  if (match.domain == "fan") {
+  if (match.domain_equals("fan")) {
     this->handle_fan_request(request, match);
     return;
   }
 #endif
 
 #ifdef USE_LIGHT
-  if (match.domain == "light") {
+  if (match.domain_equals("light")) {
     this->handle_light_request(request, match);
     return;
   }
 #endif
 
 #ifdef USE_TEXT_SENSOR
-  if (match.domain == "text_sensor") {
+  if (match.domain_equals("text_sensor")) {
     this->handle_text_sensor_request(request, match);
     return;
   }
 #endif
 
 #ifdef USE_COVER
-  if (match.domain == "cover") {
+  if (match.domain_equals("cover")) {
     this->handle_cover_request(request, match);
     return;
   }
 #endif
 
 #ifdef USE_NUMBER
-  if (match.domain == "number") {
+  if (match.domain_equals("number")) {
     this->handle_number_request(request, match);
     return;
   }
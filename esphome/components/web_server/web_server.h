@@ -9,12 +9,23 @@
 namespace esphome {
 namespace web_server {
 
-/// Internal helper struct that is used to parse incoming URLs
+/** Internal helper struct that is used to parse incoming URLs.
+ *
+ * The parts point into the URL of the request without a terminating null, they are only valid while the request
+ * is handled.
+ */
 struct UrlMatch {
-  std::string domain;  ///< The domain of the component, for example "sensor"
-  std::string id;      ///< The id of the device that's being accessed, for example "living_room_fan"
-  std::string method;  ///< The method that's being called, for example "turn_on"
-  bool valid;          ///< Whether this match is valid
+  const char *domain;    ///< The domain of the component, for example "sensor"
+  size_t domain_length;  ///< The length of domain
+  const char *id;        ///< The id of the device that's being accessed, for example "living_room_fan"
+  size_t id_length;      ///< The length of id
+  const char *method;    ///< The method that's being called, for example "turn_on"
+  size_t method_length;  ///< The length of method
+  bool valid;            ///< Whether this match is valid
+
+  bool domain_equals(const char *str) const;
+  bool id_equals(const char *str) const;
+  bool method_equals(const char *str) const;
 };
 
 /** This class allows users to create a web server with their ESP nodes.
@@ -41,11 +52,12 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    */
   void set_css_url(const char *css_url);
 
-  /** Set local path to the script that's embedded in the index page. Defaults to
+  /** Set the gzip compressed stylesheet that's served under '/0.css'.
    *
-   * @param css_include Local path to web server script.
+   * @param css_include The compressed stylesheet in PROGMEM.
+   * @param size The compressed size in bytes.
    */
-  void set_css_include(const char *css_include);
+  void set_css_include(const uint8_t *css_include, size_t size);
 
   /** Set the URL to the script that's embedded in the index page. Defaults to
    * https://esphome.io/_static/webserver-v1.min.js
@@ -54,11 +66,20 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    */
   void set_js_url(const char *js_url);
 
-  /** Set local path to the script that's embedded in the index page. Defaults to
+  /** Set the gzip compressed script that's served under '/0.js'.
    *
-   * @param js_include Local path to web server script.
+   * @param js_include The compressed script in PROGMEM.
+   * @param size The compressed size in bytes.
    */
-  void set_js_include(const char *js_include);
+  void set_js_include(const uint8_t *js_include, size_t size);
+
+  /** Merge all state updates of one loop iteration into a single "states" event instead of sending one "state"
+   * event per update. The event data is a JSON array of the objects the "state" events contain, so the script
+   * of the page has to handle these events.
+   *
+   * @param batch_events Whether to batch state events.
+   */
+  void set_batch_events(bool batch_events) { this->batch_events_ = batch_events; }
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -67,12 +88,18 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
   void dump_config() override;
 
+  /// Send the state events batched in this loop iteration.
+  void loop() override;
+
   /// MQTT setup priority.
   float get_setup_priority() const override;
 
   /// Handle an index request under '/'.
   void handle_index_request(AsyncWebServerRequest *request);
 
+  /// Handle a request for a JSON array with the states of all entities under '/states'.
+  void handle_states_request(AsyncWebServerRequest *request);
+
 #ifdef WEBSERVER_CSS_INCLUDE
   /// Handle included css request under '/0.css'.
   void handle_css_request(AsyncWebServerRequest *request);
@@ -171,14 +198,74 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool isRequestHandlerTrivial() override;
 
  protected:
+  struct PendingEvent {
+    const void *obj;
+    std::string json;
+  };
+  struct IndexEntry {
+    uint32_t object_id_hash;
+    Nameable *obj;
+  };
+  /// The entities of one domain that aren't internal, sorted by the hash of their object id.
+  using EntityIndex = std::vector<IndexEntry>;
+
+  template<typename T> static void build_index_(EntityIndex &index, const std::vector<T *> &entities);
+  /// Look up the entity the URL of match refers to in index, nullptr if there is none.
+  static Nameable *find_entity_(const EntityIndex &index, const UrlMatch &match);
+
+  /** Write the state of the index-th entity, counting through all domains, as JSON to out.
+   *
+   * out is left empty for internal entities. Returns false if index is past the last entity.
+   */
+  bool entity_json_(size_t index, std::string &out);
+  /** Answer with 304 Not Modified if the client already has the page or asset of this firmware build.
+   *
+   * All of them only change with a new firmware, so they share one ETag derived from the compilation time.
+   */
+  bool handle_not_modified_(AsyncWebServerRequest *request);
+  void add_cache_headers_(AsyncWebServerResponse *response);
+  /// Send a gzip compressed asset from PROGMEM.
+  void send_compressed_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data, size_t size);
+  /// Send the state of obj as an event now, or queue it for loop() when batching.
+  void send_state_event_(const void *obj, std::string &&json);
+
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
   const char *username_{nullptr};
   const char *password_{nullptr};
   const char *css_url_{nullptr};
-  const char *css_include_{nullptr};
+  const uint8_t *css_include_{nullptr};
+  size_t css_include_size_{0};
   const char *js_url_{nullptr};
-  const char *js_include_{nullptr};
+  const uint8_t *js_include_{nullptr};
+  size_t js_include_size_{0};
+  std::string etag_;
+  bool batch_events_{false};
+  std::vector<PendingEvent> pending_events_;
+#ifdef USE_SENSOR
+  EntityIndex sensor_index_;
+#endif
+#ifdef USE_SWITCH
+  EntityIndex switch_index_;
+#endif
+#ifdef USE_BINARY_SENSOR
+  EntityIndex binary_sensor_index_;
+#endif
+#ifdef USE_FAN
+  EntityIndex fan_index_;
+#endif
+#ifdef USE_LIGHT
+  EntityIndex light_index_;
+#endif
+#ifdef USE_TEXT_SENSOR
+  EntityIndex text_sensor_index_;
+#endif
+#ifdef USE_COVER
+  EntityIndex cover_index_;
+#endif
+#ifdef USE_NUMBER
+  EntityIndex number_index_;
+#endif
 };
 
 }  // namespace web_server
@@ -1,7 +1,10 @@
+import gzip
+import io
+
 import esphome.config_validation as cv
 import esphome.codegen as cg
 from esphome.const import CONF_ID
-from esphome.core import coroutine_with_priority, CORE
+from esphome.core import HexInt, coroutine_with_priority, CORE
 
 CODEOWNERS = ["@OttoWinter"]
 DEPENDENCIES = ["network"]
@@ -18,6 +21,18 @@ CONFIG_SCHEMA = cv.Schema(
 )
 
 
+def compressed_include(id_, path):
+    """Gzip a file into a PROGMEM array, with a fixed timestamp so builds are reproducible."""
+    with open(path, "rb") as myfile:
+        data = myfile.read()
+    buffer = io.BytesIO()
+    with gzip.GzipFile(fileobj=buffer, mode="wb", compresslevel=9, mtime=0) as gz:
+        gz.write(data)
+    compressed = buffer.getvalue()
+    arr = cg.progmem_array(id_, [HexInt(x) for x in compressed])
+    return arr, len(compressed)
+
+
 @coroutine_with_priority(65.0)
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
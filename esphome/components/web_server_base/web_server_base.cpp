@@ -1,6 +1,7 @@
 #include "web_server_base.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include "esphome/core/util.h"
 #include <StreamString.h>
 
 #ifdef ARDUINO_ARCH_ESP32
@@ -24,6 +25,7 @@ void report_ota_error() {
 void OTARequestHandler::handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index,
                                      uint8_t *data, size_t len, bool final) {
   bool success;
+  network_notify_activity();
   if (index == 0) {
     ESP_LOGI(TAG, "OTA Update Start: %s", filename.c_str());
     this->ota_read_length_ = 0;
@@ -86,6 +88,35 @@ void OTARequestHandler::handleRequest(AsyncWebServerRequest *request) {
   request->send(response);
 }
 
+bool RequestLimiter::canHandle(AsyncWebServerRequest *request) {
+  WebServerBase *parent = this->parent_;
+  for (auto *source : parent->event_sources_) {
+    // The connection is taken over by the event source, its close doesn't reach the request
+    if (request->url() == source->url())
+      return source->count() >= parent->max_event_subscribers_;
+  }
+
+  if (parent->active_requests_ >= parent->max_clients_ || ESP.getFreeHeap() < parent->min_free_heap_)
+    return true;
+  if (parent->refused_requests_ != 0) {
+    ESP_LOGD(TAG, "Refused %u web requests", parent->refused_requests_);
+    parent->refused_requests_ = 0;
+  }
+  parent->active_requests_++;
+  request->onDisconnect([parent]() { parent->active_requests_--; });
+  return false;
+}
+void RequestLimiter::handleRequest(AsyncWebServerRequest *request) {
+  WebServerBase *parent = this->parent_;
+  // Only log the first refusal of a burst
+  if (parent->refused_requests_++ == 0)
+    ESP_LOGW(TAG, "Refusing web request, %u active, %u bytes free heap", parent->active_requests_, ESP.getFreeHeap());
+  AsyncWebServerResponse *response = request->beginResponse(503, "text/plain", "Busy");
+  response->addHeader("Retry-After", "1");
+  response->addHeader("Connection", "close");
+  request->send(response);
+}
+
 void WebServerBase::add_ota_handler() { this->add_handler(new OTARequestHandler(this)); }
 float WebServerBase::get_setup_priority() const {
   // Before WiFi (captive portal)
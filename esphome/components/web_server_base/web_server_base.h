@@ -7,6 +7,21 @@
 namespace esphome {
 namespace web_server_base {
 
+class WebServerBase;
+
+/** The first handler of the server, answers 503 Service Unavailable with Retry-After when a request would exceed
+ * the limits of WebServerBase, before any other handler allocates memory for it.
+ */
+class RequestLimiter : public AsyncWebHandler {
+ public:
+  RequestLimiter(WebServerBase *parent) : parent_(parent) {}
+  bool canHandle(AsyncWebServerRequest *request) override;
+  void handleRequest(AsyncWebServerRequest *request) override;
+
+ protected:
+  WebServerBase *parent_;
+};
+
 class WebServerBase : public Component {
  public:
   void init() {
@@ -17,6 +32,8 @@ class WebServerBase : public Component {
     this->server_ = new AsyncWebServer(this->port_);
     this->server_->begin();
 
+    this->server_->addHandler(&this->limiter_);
+
     for (auto *handler : this->handlers_)
       this->server_->addHandler(handler);
 
@@ -40,18 +57,46 @@ class WebServerBase : public Component {
       this->server_->addHandler(handler);
   }
 
+  /// Add an event source whose subscribers are limited by set_max_event_subscribers().
+  void add_event_source(AsyncEventSource *source) {
+    this->event_sources_.push_back(source);
+    this->add_handler(source);
+  }
+
   void add_ota_handler();
 
+  /** Set the maximum number of requests that are handled at the same time, not counting event subscribers.
+   *
+   * Each request holds its parser and response buffers until the connection closes, which are the largest part
+   * of the memory the server uses.
+   */
+  void set_max_clients(uint8_t max_clients) { this->max_clients_ = max_clients; }
+  /// Set the maximum number of clients subscribed to each event source.
+  void set_max_event_subscribers(uint8_t max_event_subscribers) {
+    this->max_event_subscribers_ = max_event_subscribers;
+  }
+  /// Refuse new requests while less than this many bytes of heap are free.
+  void set_min_free_heap(uint32_t min_free_heap) { this->min_free_heap_ = min_free_heap; }
+
   void set_port(uint16_t port) { port_ = port; }
   uint16_t get_port() const { return port_; }
 
  protected:
   friend class OTARequestHandler;
+  friend class RequestLimiter;
 
   int initialized_{0};
   uint16_t port_{80};
   AsyncWebServer *server_{nullptr};
   std::vector<AsyncWebHandler *> handlers_;
+  std::vector<AsyncEventSource *> event_sources_;
+  RequestLimiter limiter_{this};
+  uint8_t max_clients_{4};
+  uint8_t max_event_subscribers_{2};
+  uint32_t min_free_heap_{4096};
+  /// The requests that are handled at the moment, decremented when their connection closes.
+  uint8_t active_requests_{0};
+  uint32_t refused_requests_{0};
 };
 
 class OTARequestHandler : public AsyncWebHandler {
@@ -148,6 +148,10 @@ void WhirlpoolClimate::transmit_state() {
   transmit.perform();
 }
 
+remote_base::RemoteSignature WhirlpoolClimate::get_signature() {
+  return {WHIRLPOOL_HEADER_MARK, WHIRLPOOL_HEADER_SPACE};
+}
+
 bool WhirlpoolClimate::on_receive(remote_base::RemoteReceiveData data) {
   // Validate header
   if (!data.expect_item(WHIRLPOOL_HEADER_MARK, WHIRLPOOL_HEADER_SPACE)) {
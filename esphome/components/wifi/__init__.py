@@ -138,6 +138,14 @@ WIFI_NETWORK_STA = WIFI_NETWORK_BASE.extend(
 )
 
 
+BLE_COMPONENTS = [
+    "esp32_ble",
+    "esp32_ble_beacon",
+    "esp32_ble_server",
+    "esp32_ble_tracker",
+]
+
+
 def final_validate(config):
     has_sta = bool(config.get(CONF_NETWORKS, True))
     has_ap = CONF_AP in config
@@ -146,6 +154,14 @@ def final_validate(config):
         raise cv.Invalid(
             "Please specify at least an SSID or an Access Point to create."
         )
+    if CORE.is_esp32 and CONF_POWER_SAVE_IDLE_TIMEOUT in config:
+        # Leaving power save during traffic would break the BLE coexistence
+        for conflicting in BLE_COMPONENTS:
+            if conflicting in fv.full_config.get():
+                raise cv.Invalid(
+                    f"power_save_idle_timeout is incompatible with {conflicting}, "
+                    "WiFi has to stay in power save with BLE."
+                )
 
 
 def final_validate_power_esp32_ble(value):
@@ -160,12 +176,7 @@ def final_validate_power_esp32_ble(value):
         # Only frameworks 1.0.5+ impacted
         return
     full = fv.full_config.get()
-    for conflicting in [
-        "esp32_ble",
-        "esp32_ble_beacon",
-        "esp32_ble_server",
-        "esp32_ble_tracker",
-    ]:
+    for conflicting in BLE_COMPONENTS:
         if conflicting in full:
             raise cv.Invalid(
                 f"power_save_mode NONE is incompatible with {conflicting}. "
@@ -215,6 +226,19 @@ def _validate(config):
         if len(networks) != 1:
             raise cv.Invalid("Fast connect can only be used with one network!")
 
+    if config.get(CONF_PASSIVE_SCAN, False):
+        for network in config.get(CONF_NETWORKS, []):
+            if network.get(CONF_HIDDEN, False):
+                raise cv.Invalid(
+                    "Hidden networks don't send beacons and can't be found by a "
+                    "passive scan!"
+                )
+
+    if config.get(CONF_SCAN_ONLY_CONFIGURED, False) and not config.get(
+        CONF_NETWORKS
+    ):
+        raise cv.Invalid("At least one network required for scan_only_configured!")
+
     if CONF_USE_ADDRESS not in config:
         if CONF_MANUAL_IP in config:
             use_address = str(config[CONF_MANUAL_IP][CONF_STATIC_IP])
@@ -226,6 +250,10 @@ def _validate(config):
 
 
 CONF_OUTPUT_POWER = "output_power"
+CONF_SCAN_ONLY_CONFIGURED = "scan_only_configured"
+CONF_SCAN_MAX_RESULTS = "scan_max_results"
+CONF_PASSIVE_SCAN = "passive_scan"
+CONF_POWER_SAVE_IDLE_TIMEOUT = "power_save_idle_timeout"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -244,7 +272,13 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(
                 CONF_POWER_SAVE_MODE, esp8266="none", esp32="light"
             ): cv.enum(WIFI_POWER_SAVE_MODES, upper=True),
+            cv.Optional(
+                CONF_POWER_SAVE_IDLE_TIMEOUT
+            ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_FAST_CONNECT, default=False): cv.boolean,
+            cv.Optional(CONF_SCAN_ONLY_CONFIGURED, default=False): cv.boolean,
+            cv.Optional(CONF_SCAN_MAX_RESULTS): cv.int_range(min=1, max=255),
+            cv.Optional(CONF_PASSIVE_SCAN, default=False): cv.boolean,
             cv.Optional(CONF_USE_ADDRESS): cv.string_strict,
             cv.SplitDefault(CONF_OUTPUT_POWER, esp8266=20.0): cv.All(
                 cv.decibel, cv.float_range(min=10.0, max=20.5)
@@ -336,7 +370,15 @@ async def to_code(config):
 
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_power_save_mode(config[CONF_POWER_SAVE_MODE]))
+    if CONF_POWER_SAVE_IDLE_TIMEOUT in config:
+        cg.add(
+            var.set_power_save_idle_timeout(config[CONF_POWER_SAVE_IDLE_TIMEOUT])
+        )
     cg.add(var.set_fast_connect(config[CONF_FAST_CONNECT]))
+    cg.add(var.set_scan_only_configured(config[CONF_SCAN_ONLY_CONFIGURED]))
+    if CONF_SCAN_MAX_RESULTS in config:
+        cg.add(var.set_scan_max_results(config[CONF_SCAN_MAX_RESULTS]))
+    cg.add(var.set_passive_scan(config[CONF_PASSIVE_SCAN]))
     if CONF_OUTPUT_POWER in config:
         cg.add(var.set_output_power(config[CONF_OUTPUT_POWER]))
 
@@ -40,6 +40,8 @@ void WiFiComponent::setup() {
 
   uint32_t hash = fnv1_hash(App.get_compilation_time());
   this->pref_ = global_preferences.make_preference<wifi::SavedWifiSettings>(hash, true);
+  // RTC memory on the ESP8266, so it survives deep sleep without wearing out the flash
+  this->fast_connect_pref_ = global_preferences.make_preference<wifi::SavedWifiFastConnectSettings>(hash + 1, false);
 
   SavedWifiSettings save{};
   if (this->pref_.load(&save)) {
@@ -61,7 +63,9 @@ void WiFiComponent::setup() {
       ESP_LOGV(TAG, "Setting Power Save Option failed!");
     }
 
-    if (this->fast_connect_) {
+    if (this->load_fast_connect_settings_()) {
+      this->start_connecting(this->selected_ap_, false);
+    } else if (this->fast_connect_) {
       this->selected_ap_ = this->sta_[0];
       this->start_connecting(this->selected_ap_, false);
     } else {
@@ -124,6 +128,7 @@ void WiFiComponent::loop() {
         } else {
           this->status_clear_warning();
           this->last_connected_ = now;
+          this->update_power_save_();
         }
         break;
       }
@@ -375,6 +380,46 @@ void WiFiComponent::print_connect_params_() {
   ESP_LOGCONFIG(TAG, "  DNS2: %s", WiFi.dnsIP(1).toString().c_str());
 }
 
+bool WiFiComponent::load_fast_connect_settings_() {
+  SavedWifiFastConnectSettings save{};
+  if (!this->fast_connect_pref_.load(&save) || save.ap_index >= this->sta_.size())
+    return false;
+
+  bssid_t bssid;
+  std::copy(save.bssid, save.bssid + 6, bssid.begin());
+  this->selected_ap_ = this->sta_[save.ap_index];
+  this->selected_ap_.set_bssid(bssid);
+  this->selected_ap_.set_channel(save.channel);
+  this->saved_ap_attempt_ = true;
+  ESP_LOGD(TAG, "Connecting to saved access point " LOG_SECRET("%s") " on channel %u",
+           format_mac_addr(save.bssid).c_str(), save.channel);
+  return true;
+}
+
+void WiFiComponent::save_fast_connect_settings_() {
+  const uint8_t *bssid = WiFi.BSSID();
+  if (bssid == nullptr)
+    return;
+  SavedWifiFastConnectSettings save{};
+  save.ap_index = this->sta_.size();
+  for (size_t i = 0; i < this->sta_.size(); i++) {
+    if (this->sta_[i].get_ssid() == this->selected_ap_.get_ssid()) {
+      save.ap_index = i;
+      break;
+    }
+  }
+  if (save.ap_index >= this->sta_.size())
+    return;
+  memcpy(save.bssid, bssid, sizeof(save.bssid));
+  save.channel = WiFi.channel();
+
+  // Only write when the access point changed
+  SavedWifiFastConnectSettings previous{};
+  if (this->fast_connect_pref_.load(&previous) && memcmp(&previous, &save, sizeof(save)) == 0)
+    return;
+  this->fast_connect_pref_.save(&save);
+}
+
 void WiFiComponent::start_scanning() {
   this->action_started_ = millis();
   ESP_LOGD(TAG, "Starting scan...");
@@ -382,6 +427,48 @@ void WiFiComponent::start_scanning() {
   this->state_ = WIFI_COMPONENT_STATE_STA_SCANNING;
 }
 
+bool WiFiComponent::is_scan_restricted_() { return this->scan_only_configured_ && !this->is_captive_portal_active_(); }
+uint8_t WiFiComponent::get_scan_channel_() {
+  if (!this->is_scan_restricted_() || this->sta_.empty())
+    return 0;
+  const optional<uint8_t> &channel = this->sta_[0].get_channel();
+  for (auto &ap : this->sta_) {
+    if (!ap.get_channel().has_value() || *ap.get_channel() != *channel)
+      return 0;
+  }
+  return *channel;
+}
+const char *WiFiComponent::get_scan_ssid_() {
+  // Hidden networks are matched by their empty SSID in the results
+  if (!this->is_scan_restricted_() || this->sta_.size() != 1 || this->sta_[0].get_hidden() ||
+      this->sta_[0].get_ssid().empty())
+    return nullptr;
+  return this->sta_[0].get_ssid().c_str();
+}
+void WiFiComponent::add_scan_result_(const WiFiScanResult &result) {
+  if (this->is_scan_restricted_()) {
+    bool matches = false;
+    for (auto &ap : this->sta_) {
+      if (result.matches(ap)) {
+        matches = true;
+        break;
+      }
+    }
+    if (!matches)
+      return;
+  }
+  if (this->scan_max_results_ == 0 || this->scan_result_.size() < this->scan_max_results_) {
+    this->scan_result_.push_back(result);
+    return;
+  }
+  // Full, replace the weakest result if this one is stronger
+  auto weakest = std::min_element(
+      this->scan_result_.begin(), this->scan_result_.end(),
+      [](const WiFiScanResult &a, const WiFiScanResult &b) { return a.get_rssi() < b.get_rssi(); });
+  if (weakest->get_rssi() < result.get_rssi())
+    *weakest = result;
+}
+
 void WiFiComponent::check_scanning_finished() {
   if (!this->scan_done_) {
     if (millis() - this->action_started_ > 30000) {
@@ -391,6 +478,7 @@ void WiFiComponent::check_scanning_finished() {
     return;
   }
   this->scan_done_ = false;
+  this->scan_result_version_++;
 
   ESP_LOGD(TAG, "Found networks:");
   if (this->scan_result_.empty()) {
@@ -437,12 +525,12 @@ void WiFiComponent::check_scanning_finished() {
     print_signal_bars(res.get_rssi(), signal_bars);
 
     if (res.get_matches()) {
-      ESP_LOGI(TAG, "- '%s' %s" LOG_SECRET("(%s) ") "%s", res.get_ssid().c_str(),
+      ESP_LOGI(TAG, "- '%s' %s" LOG_SECRET("(%s) ") "%s", res.get_ssid(),
                res.get_is_hidden() ? "(HIDDEN) " : "", bssid_s, signal_bars);
       ESP_LOGD(TAG, "    Channel: %u", res.get_channel());
       ESP_LOGD(TAG, "    RSSI: %d dB", res.get_rssi());
     } else {
-      ESP_LOGD(TAG, "- " LOG_SECRET("'%s'") " " LOG_SECRET("(%s) ") "%s", res.get_ssid().c_str(), bssid_s, signal_bars);
+      ESP_LOGD(TAG, "- " LOG_SECRET("'%s'") " " LOG_SECRET("(%s) ") "%s", res.get_ssid(), bssid_s, signal_bars);
     }
   }
 
@@ -533,11 +621,14 @@ void WiFiComponent::check_connecting_finished() {
 #endif
     this->state_ = WIFI_COMPONENT_STATE_STA_CONNECTED;
     this->num_retried_ = 0;
+    this->saved_ap_attempt_ = false;
+    this->save_fast_connect_settings_();
     return;
   }
 
   uint32_t now = millis();
-  if (now - this->action_started_ > 30000) {
+  // Don't wait long for the saved access point, a scan will find another one
+  if (now - this->action_started_ > (this->saved_ap_attempt_ ? 10000 : 30000)) {
     ESP_LOGW(TAG, "Timeout while connecting to WiFi.");
     this->retry_connect();
     return;
@@ -578,6 +669,19 @@ void WiFiComponent::retry_connect() {
     this->set_sta_priority(bssid, priority - 1.0f);
   }
 
+  if (this->saved_ap_attempt_) {
+    ESP_LOGD(TAG, "Saved access point not reachable, scanning...");
+    this->saved_ap_attempt_ = false;
+    this->error_from_callback_ = false;
+    if (this->fast_connect_) {
+      this->selected_ap_ = this->sta_[0];
+      this->start_connecting(this->selected_ap_, false);
+    } else {
+      this->start_scanning();
+    }
+    return;
+  }
+
   delay(10);
   if (!this->is_captive_portal_active_() && !this->is_esp32_improv_active_() &&
       (this->num_retried_ > 5 || this->error_from_callback_)) {
@@ -613,6 +717,26 @@ bool WiFiComponent::is_connected() {
          !this->error_from_callback_;
 }
 void WiFiComponent::set_power_save_mode(WiFiPowerSaveMode power_save) { this->power_save_ = power_save; }
+void WiFiComponent::suspend_power_save() {
+  this->notify_activity();
+  this->update_power_save_();
+}
+void WiFiComponent::update_power_save_() {
+  if (this->power_save_idle_timeout_ == 0 || this->power_save_ == WIFI_POWER_SAVE_NONE)
+    return;
+  const uint32_t now = millis();
+  // Components that need a fast loop, like a stream, usually want a fast network as well
+  if (HighFrequencyLoopRequester::is_high_frequency())
+    this->last_activity_ = now;
+  const bool active = now - this->last_activity_ < this->power_save_idle_timeout_;
+  if (active == this->power_save_suspended_)
+    return;
+  this->power_save_suspended_ = active;
+  ESP_LOGV(TAG, active ? "Traffic, leaving power save" : "Idle, entering power save again");
+  if (!this->wifi_apply_power_save_()) {
+    ESP_LOGV(TAG, "Setting Power Save Option failed!");
+  }
+}
 
 std::string WiFiComponent::format_mac_addr(const uint8_t *mac) {
   char buf[20];
@@ -654,15 +778,14 @@ const optional<uint8_t> &WiFiAP::get_channel() const { return this->channel_; }
 const optional<ManualIP> &WiFiAP::get_manual_ip() const { return this->manual_ip_; }
 bool WiFiAP::get_hidden() const { return this->hidden_; }
 
-WiFiScanResult::WiFiScanResult(const bssid_t &bssid, std::string ssid, uint8_t channel, int8_t rssi, bool with_auth,
-                               bool is_hidden)
-    : bssid_(bssid),
-      ssid_(std::move(ssid)),
-      channel_(channel),
-      rssi_(rssi),
-      with_auth_(with_auth),
-      is_hidden_(is_hidden) {}
-bool WiFiScanResult::matches(const WiFiAP &config) {
+WiFiScanResult::WiFiScanResult(const bssid_t &bssid, const char *ssid, size_t ssid_length, uint8_t channel,
+                               int8_t rssi, bool with_auth, bool is_hidden)
+    : bssid_(bssid), channel_(channel), rssi_(rssi), matches_(false), with_auth_(with_auth), is_hidden_(is_hidden) {
+  ssid_length = std::min(ssid_length, sizeof(this->ssid_) - 1);
+  memcpy(this->ssid_, ssid, ssid_length);
+  this->ssid_[ssid_length] = '\0';
+}
+bool WiFiScanResult::matches(const WiFiAP &config) const {
   if (config.get_hidden()) {
     // User configured a hidden network, only match actually hidden networks
     // don't match SSID
@@ -702,7 +825,7 @@ bool WiFiScanResult::matches(const WiFiAP &config) {
 bool WiFiScanResult::get_matches() const { return this->matches_; }
 void WiFiScanResult::set_matches(bool matches) { this->matches_ = matches; }
 const bssid_t &WiFiScanResult::get_bssid() const { return this->bssid_; }
-const std::string &WiFiScanResult::get_ssid() const { return this->ssid_; }
+const char *WiFiScanResult::get_ssid() const { return this->ssid_; }
 uint8_t WiFiScanResult::get_channel() const { return this->channel_; }
 int8_t WiFiScanResult::get_rssi() const { return this->rssi_; }
 bool WiFiScanResult::get_with_auth() const { return this->with_auth_; }
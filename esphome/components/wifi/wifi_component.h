@@ -32,6 +32,14 @@ struct SavedWifiSettings {
   char password[65];
 } PACKED;  // NOLINT
 
+/// The access point of the last successful connection, to skip the scan on the next boot.
+struct SavedWifiFastConnectSettings {
+  uint8_t bssid[6];
+  uint8_t channel;
+  /// Index of the matching network in the configured networks.
+  uint8_t ap_index;
+} PACKED;  // NOLINT
+
 enum WiFiComponentState {
   /** Nothing has been initialized yet. Internal AP, if configured, is disabled at this point. */
   WIFI_COMPONENT_STATE_OFF = 0,
@@ -113,16 +121,18 @@ class WiFiAP {
   bool hidden_{false};
 };
 
+/// A network found by a scan. The SSID is stored inline, so a result needs no heap allocation of its own.
 class WiFiScanResult {
  public:
-  WiFiScanResult(const bssid_t &bssid, std::string ssid, uint8_t channel, int8_t rssi, bool with_auth, bool is_hidden);
+  WiFiScanResult(const bssid_t &bssid, const char *ssid, size_t ssid_length, uint8_t channel, int8_t rssi,
+                 bool with_auth, bool is_hidden);
 
-  bool matches(const WiFiAP &config);
+  bool matches(const WiFiAP &config) const;
 
   bool get_matches() const;
   void set_matches(bool matches);
   const bssid_t &get_bssid() const;
-  const std::string &get_ssid() const;
+  const char *get_ssid() const;
   uint8_t get_channel() const;
   int8_t get_rssi() const;
   bool get_with_auth() const;
@@ -131,14 +141,14 @@ class WiFiScanResult {
   void set_priority(float priority) { priority_ = priority; }
 
  protected:
-  bool matches_{false};
+  float priority_{0.0f};
   bssid_t bssid_;
-  std::string ssid_;
+  char ssid_[33];
   uint8_t channel_;
   int8_t rssi_;
-  bool with_auth_;
-  bool is_hidden_;
-  float priority_{0.0f};
+  bool matches_ : 1;
+  bool with_auth_ : 1;
+  bool is_hidden_ : 1;
 };
 
 struct WiFiSTAPriority {
@@ -176,6 +186,16 @@ class WiFiComponent : public Component {
   void start_connecting(const WiFiAP &ap, bool two);
   void set_fast_connect(bool fast_connect);
   void set_ap_timeout(uint32_t ap_timeout) { ap_timeout_ = ap_timeout; }
+  /** Only scan for the configured networks and only keep the results that match one.
+   *
+   * The scan is limited to the channel and SSID of the networks where they all share one. Not used while the
+   * captive portal is active, which lists all networks.
+   */
+  void set_scan_only_configured(bool scan_only_configured) { scan_only_configured_ = scan_only_configured; }
+  /// Keep at most this many scan results, the ones with the strongest signal. 0 keeps all.
+  void set_scan_max_results(uint8_t scan_max_results) { scan_max_results_ = scan_max_results; }
+  /// Listen for beacons instead of sending probe requests, this doesn't find hidden networks.
+  void set_passive_scan(bool passive_scan) { passive_scan_ = passive_scan; }
 
   void check_connecting_finished();
 
@@ -188,6 +208,15 @@ class WiFiComponent : public Component {
   bool is_connected();
 
   void set_power_save_mode(WiFiPowerSaveMode power_save);
+  /** Leave power save while there is traffic and enter it again after this time without any, in ms.
+   *
+   * 0 keeps the power save mode all the time.
+   */
+  void set_power_save_idle_timeout(uint32_t timeout) { power_save_idle_timeout_ = timeout; }
+  /// Report traffic that wants low latency, like API messages. Safe to call from callbacks of the network stack.
+  void notify_activity() { last_activity_ = millis(); }
+  /// Leave power save right away, for traffic handled without returning to the loop like an OTA upload.
+  void suspend_power_save();
   void set_output_power(float output_power) { output_power_ = output_power; }
 
   void save_wifi_sta(const std::string &ssid, const std::string &password);
@@ -211,6 +240,8 @@ class WiFiComponent : public Component {
   void set_use_address(const std::string &use_address);
 
   const std::vector<WiFiScanResult> &get_scan_result() const { return scan_result_; }
+  /// Incremented whenever a scan finished and get_scan_result() changed, so users can cache what they derive from it.
+  uint32_t get_scan_result_version() const { return scan_result_version_; }
 
   IPAddress wifi_soft_ap_ip();
 
@@ -242,11 +273,16 @@ class WiFiComponent : public Component {
   static std::string format_mac_addr(const uint8_t mac[6]);
   void setup_ap_config_();
   void print_connect_params_();
+  /// Select the access point of the last successful connection, returns false if none is saved.
+  bool load_fast_connect_settings_();
+  void save_fast_connect_settings_();
 
   bool wifi_mode_(optional<bool> sta, optional<bool> ap);
   bool wifi_sta_pre_setup_();
   bool wifi_apply_output_power_(float output_power);
   bool wifi_apply_power_save_();
+  /// Suspend or resume power save depending on the recent traffic, see set_power_save_idle_timeout().
+  void update_power_save_();
   bool wifi_sta_ip_config_(optional<ManualIP> manual_ip);
   IPAddress wifi_sta_ip_();
   bool wifi_apply_hostname_();
@@ -254,6 +290,13 @@ class WiFiComponent : public Component {
   void wifi_pre_setup_();
   wl_status_t wifi_sta_status_();
   bool wifi_scan_start_();
+  bool is_scan_restricted_();
+  /// The channel all configured networks are on, 0 to scan all channels.
+  uint8_t get_scan_channel_();
+  /// The SSID of the only configured network, nullptr to scan for all SSIDs.
+  const char *get_scan_ssid_();
+  /// Add a result from the platform scan, unless it is filtered out or weaker than all kept results.
+  void add_scan_result_(const WiFiScanResult &result);
   bool wifi_ap_ip_config_(optional<ManualIP> manual_ip);
   bool wifi_start_ap_(const WiFiAP &ap);
   bool wifi_disconnect_();
@@ -291,12 +334,24 @@ class WiFiComponent : public Component {
   uint32_t reboot_timeout_{};
   uint32_t ap_timeout_{};
   WiFiPowerSaveMode power_save_{WIFI_POWER_SAVE_NONE};
+  uint32_t power_save_idle_timeout_{0};
+  /// Written by notify_activity(), possibly from another task.
+  volatile uint32_t last_activity_{0};
+  /// Whether power save is left because of recent traffic.
+  bool power_save_suspended_{false};
   bool error_from_callback_{false};
   std::vector<WiFiScanResult> scan_result_;
+  uint32_t scan_result_version_{0};
   bool scan_done_{false};
+  bool scan_only_configured_{false};
+  uint8_t scan_max_results_{0};
+  bool passive_scan_{false};
   bool ap_setup_{false};
   optional<float> output_power_;
   ESPPreferenceObject pref_;
+  ESPPreferenceObject fast_connect_pref_;
+  /// Whether the current connection attempt uses the saved access point, a failure then falls back to a scan.
+  bool saved_ap_attempt_{false};
   bool has_saved_wifi_settings_{false};
 };
 
@@ -304,10 +359,10 @@ extern WiFiComponent *global_wifi_component;  // NOLINT(cppcoreguidelines-avoid-
 
 template<typename... Ts> class WiFiConnectedCondition : public Condition<Ts...> {
  public:
-  bool check(Ts... x) override;
+  bool check(const Ts &... x) override;
 };
 
-template<typename... Ts> bool WiFiConnectedCondition<Ts...>::check(Ts... x) {
+template<typename... Ts> bool WiFiConnectedCondition<Ts...>::check(const Ts &... x) {
   return global_wifi_component->is_connected();
 }
 
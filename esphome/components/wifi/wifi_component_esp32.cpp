@@ -70,7 +70,8 @@ bool WiFiComponent::wifi_sta_pre_setup_() {
 }
 bool WiFiComponent::wifi_apply_power_save_() {
   wifi_ps_type_t power_save;
-  switch (this->power_save_) {
+  // Traffic that wants low latency suspends power save, see update_power_save_()
+  switch (this->power_save_suspended_ ? WIFI_POWER_SAVE_NONE : this->power_save_) {
     case WIFI_POWER_SAVE_LIGHT:
       power_save = WIFI_PS_MIN_MODEM;
       break;
@@ -528,7 +529,11 @@ bool WiFiComponent::wifi_scan_start_() {
     return false;
 
   // need to use WiFi because of WiFiScanClass allocations :(
-  int16_t err = WiFi.scanNetworks(true, true, false, 200);
+#if ESP_IDF_VERSION_MAJOR >= 4
+  int16_t err = WiFi.scanNetworks(true, true, this->passive_scan_, 200, this->get_scan_channel_());
+#else
+  int16_t err = WiFi.scanNetworks(true, true, this->passive_scan_, 200);
+#endif
   if (err != WIFI_SCAN_RUNNING) {
     ESP_LOGV(TAG, "WiFi.scanNetworks failed! %d", err);
     return false;
@@ -543,7 +548,10 @@ void WiFiComponent::wifi_scan_done_callback_() {
   if (num < 0)
     return;
 
-  this->scan_result_.reserve(static_cast<unsigned int>(num));
+  size_t count = static_cast<unsigned int>(num);
+  if (this->scan_max_results_ != 0)
+    count = std::min<size_t>(count, this->scan_max_results_);
+  this->scan_result_.reserve(count);
   for (int i = 0; i < num; i++) {
     String ssid = WiFi.SSID(i);
     wifi_auth_mode_t authmode = WiFi.encryptionType(i);
@@ -551,9 +559,9 @@ void WiFiComponent::wifi_scan_done_callback_() {
     uint8_t *bssid = WiFi.BSSID(i);
     int32_t channel = WiFi.channel(i);
 
-    WiFiScanResult scan({bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]}, std::string(ssid.c_str()),
+    WiFiScanResult scan({bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]}, ssid.c_str(), ssid.length(),
                         channel, rssi, authmode != WIFI_AUTH_OPEN, ssid.length() == 0);
-    this->scan_result_.push_back(scan);
+    this->add_scan_result_(scan);
   }
   WiFi.scanDelete();
   this->scan_done_ = true;
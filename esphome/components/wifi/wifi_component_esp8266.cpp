@@ -81,7 +81,8 @@ bool WiFiComponent::wifi_mode_(optional<bool> sta, optional<bool> ap) {
 }
 bool WiFiComponent::wifi_apply_power_save_() {
   sleep_type_t power_save;
-  switch (this->power_save_) {
+  // Traffic that wants low latency suspends power save, see update_power_save_()
+  switch (this->power_save_suspended_ ? WIFI_POWER_SAVE_NONE : this->power_save_) {
     case WIFI_POWER_SAVE_LIGHT:
       power_save = LIGHT_SLEEP_T;
       break;
@@ -576,13 +577,16 @@ bool WiFiComponent::wifi_scan_start_() {
 
   struct scan_config config {};
   memset(&config, 0, sizeof(config));
-  config.ssid = nullptr;
+  config.ssid = reinterpret_cast<uint8 *>(const_cast<char *>(this->get_scan_ssid_()));
   config.bssid = nullptr;
-  config.channel = 0;
+  config.channel = this->get_scan_channel_();
   config.show_hidden = 1;
 #ifndef ARDUINO_ESP8266_RELEASE_2_3_0
   config.scan_type = WIFI_SCAN_TYPE_ACTIVE;
-  if (FIRST_SCAN) {
+  if (this->passive_scan_) {
+    config.scan_type = WIFI_SCAN_TYPE_PASSIVE;
+    config.scan_time.passive = 200;
+  } else if (FIRST_SCAN) {
     config.scan_time.active.min = 100;
     config.scan_time.active.max = 200;
   } else {
@@ -626,9 +630,9 @@ void WiFiComponent::wifi_scan_done_callback_(void *arg, STATUS status) {
   auto *head = reinterpret_cast<bss_info *>(arg);
   for (bss_info *it = head; it != nullptr; it = STAILQ_NEXT(it, next)) {
     WiFiScanResult res({it->bssid[0], it->bssid[1], it->bssid[2], it->bssid[3], it->bssid[4], it->bssid[5]},
-                       std::string(reinterpret_cast<char *>(it->ssid), it->ssid_len), it->channel, it->rssi,
+                       reinterpret_cast<char *>(it->ssid), it->ssid_len, it->channel, it->rssi,
                        it->authmode != AUTH_OPEN, it->is_hidden != 0);
-    this->scan_result_.push_back(res);
+    this->add_scan_result_(res);
   }
   this->scan_done_ = true;
 }
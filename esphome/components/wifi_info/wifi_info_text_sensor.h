@@ -28,17 +28,12 @@ class SSIDWiFiInfo : public Component, public text_sensor::TextSensor {
  public:
   void loop() override {
     String ssid = WiFi.SSID();
-    if (this->last_ssid_ != ssid.c_str()) {
-      this->last_ssid_ = std::string(ssid.c_str());
-      this->publish_state(this->last_ssid_);
-    }
+    if (!this->has_state() || this->state != ssid.c_str())
+      this->publish_state(ssid.c_str());
   }
   float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
   std::string unique_id() override { return get_mac_address() + "-wifiinfo-ssid"; }
   void dump_config() override;
-
- protected:
-  std::string last_ssid_;
 };
 
 class BSSIDWiFiInfo : public Component, public text_sensor::TextSensor {
@@ -38,11 +38,7 @@ void WLEDLightEffect::stop() {
   }
 }
 
-void WLEDLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(COLOR_BLACK);
-  }
-}
+void WLEDLightEffect::blank_all_leds_(light::AddressableLight &it) { it.all() = COLOR_BLACK; }
 
 void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
   // Init UDP lazily
@@ -55,18 +51,19 @@ void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_co
     }
   }
 
-  std::vector<uint8_t> payload;
   while (uint16_t packet_size = udp_->parsePacket()) {
-    payload.resize(packet_size);
+    payload_.resize(packet_size);
 
-    if (!udp_->read(&payload[0], payload.size())) {
+    if (!udp_->read(&payload_[0], payload_.size())) {
       continue;
     }
 
-    if (!this->parse_frame_(it, &payload[0], payload.size())) {
-      ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=0x%02X).", payload.size(), payload[0]);
+    if (!this->parse_frame_(it, &payload_[0], payload_.size())) {
+      ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=0x%02X).", payload_.size(), payload_[0]);
       continue;
     }
+    // Every packet is a complete frame
+    it.schedule_show();
   }
 
   // FIXME: Use roll-over safe arithmetic
@@ -171,19 +168,8 @@ bool WLEDLightEffect::parse_drgb_frame_(light::AddressableLight &it, const uint8
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 3) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
-
+  int count = std::min<int>(size / 3, it.size());
+  it.set_range_from_bytes(0, payload, count, 3, light::WHITE_FROM_RGB_OFF);
   return true;
 }
 
@@ -193,20 +179,8 @@ bool WLEDLightEffect::parse_drgbw_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 4;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 4) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-    uint8_t w = payload[3];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b, w));
-    }
-  }
-
+  int count = std::min<int>(size / 4, it.size());
+  it.set_range_from_bytes(0, payload, count, 4);
   return true;
 }
 
@@ -225,19 +199,9 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (; count > 0; count--, payload += 3, led++) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
-
+  int count = std::min<int>(size / 3, it.size() - led);
+  if (count > 0)
+    it.set_range_from_bytes(led, payload, count, 3, light::WHITE_FROM_RGB_OFF);
   return true;
 }
 
@@ -19,4 +19,7 @@ CONFIG_SCHEMA = cv.Schema(
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
-    await esp32_ble_tracker.register_ble_device(var, config)
+    # Only logs the devices that get through the filter for the other listeners,
+    # so it doesn't register an interest of its own
+    paren = await cg.get_variable(config[esp32_ble_tracker.CONF_ESP32_BLE_ID])
+    cg.add(paren.register_listener(var))
@@ -128,7 +128,26 @@ bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult
   return success;
 }
 
-optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data) {
+struct XiaomiFrameCount {
+  uint64_t address;
+  uint8_t frame_count;
+};
+
+/// The frame counter of the last packet per device, so a repeated advertisement is dropped before decryption.
+static uint8_t *last_frame_count(uint64_t address, bool *known) {
+  static std::vector<XiaomiFrameCount> frame_counts;
+  for (auto &it : frame_counts) {
+    if (it.address == address) {
+      *known = true;
+      return &it.frame_count;
+    }
+  }
+  *known = false;
+  frame_counts.push_back(XiaomiFrameCount{address, 0});
+  return &frame_counts.back().frame_count;
+}
+
+optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data, uint64_t address) {
   XiaomiParseResult result;
   if (!service_data.uuid.contains(0x95, 0xFE)) {
     ESP_LOGVV(TAG, "parse_xiaomi_header(): no service data UUID magic bytes.");
@@ -145,13 +164,14 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
     return {};
   }
 
-  static uint8_t last_frame_count = 0;
-  if (last_frame_count == raw[4]) {
-    ESP_LOGVV(TAG, "parse_xiaomi_header(): duplicate data packet received (%d).", static_cast<int>(last_frame_count));
+  bool known;
+  uint8_t *frame_count = last_frame_count(address, &known);
+  if (known && *frame_count == raw[4]) {
+    ESP_LOGVV(TAG, "parse_xiaomi_header(): duplicate data packet received (%d).", static_cast<int>(*frame_count));
     result.is_duplicate = true;
     return {};
   }
-  last_frame_count = raw[4];
+  *frame_count = raw[4];
   result.is_duplicate = false;
   result.raw_offset = result.has_capability ? 12 : 11;
 
@@ -211,6 +231,33 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
   return result;
 }
 
+struct XiaomiCCMContext {
+  uint8_t key[16];
+  mbedtls_ccm_context ctx;
+};
+
+/** The CCM context for a bindkey, created and keyed on first use.
+ *
+ * mbedtls runs AES on the ESP32 peripheral already (MBEDTLS_AES_ALT), what this saves is setting up and freeing a
+ * context and scheduling the key for every packet.
+ */
+static mbedtls_ccm_context *get_ccm_context(const uint8_t *bindkey) {
+  static std::vector<std::unique_ptr<XiaomiCCMContext>> contexts;
+  for (auto &it : contexts) {
+    if (memcmp(it->key, bindkey, sizeof(it->key)) == 0)
+      return &it->ctx;
+  }
+  auto entry = make_unique<XiaomiCCMContext>();
+  memcpy(entry->key, bindkey, sizeof(entry->key));
+  mbedtls_ccm_init(&entry->ctx);
+  if (mbedtls_ccm_setkey(&entry->ctx, MBEDTLS_CIPHER_ID_AES, entry->key, sizeof(entry->key) * 8) != 0) {
+    mbedtls_ccm_free(&entry->ctx);
+    return nullptr;
+  }
+  contexts.push_back(std::move(entry));
+  return &contexts.back()->ctx;
+}
+
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address) {
   if (!((raw.size() == 19) || ((raw.size() >= 22) && (raw.size() <= 24)))) {
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", raw.size());
@@ -250,17 +297,13 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
   memcpy(vector.iv + 6, v + 2, 3);               // sensor type (2) + packet id (1)
   memcpy(vector.iv + 9, v + raw.size() - 7, 3);  // payload counter
 
-  mbedtls_ccm_context ctx;
-  mbedtls_ccm_init(&ctx);
-
-  int ret = mbedtls_ccm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, vector.key, vector.keysize * 8);
-  if (ret) {
+  mbedtls_ccm_context *ctx = get_ccm_context(vector.key);
+  if (ctx == nullptr) {
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): mbedtls_ccm_setkey() failed.");
-    mbedtls_ccm_free(&ctx);
     return false;
   }
 
-  ret = mbedtls_ccm_auth_decrypt(&ctx, vector.datasize, vector.iv, vector.ivsize, vector.authdata, vector.authsize,
+  int ret = mbedtls_ccm_auth_decrypt(ctx, vector.datasize, vector.iv, vector.ivsize, vector.authdata, vector.authsize,
                                  vector.ciphertext, vector.plaintext, vector.tag, vector.tagsize);
   if (ret) {
     uint8_t mac_address[6] = {0};
@@ -277,7 +320,6 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
     ESP_LOGVV(TAG, "           Iv : %s", hexencode(vector.iv, vector.ivsize).c_str());
     ESP_LOGVV(TAG, "       Cipher : %s", hexencode(vector.ciphertext, vector.datasize).c_str());
     ESP_LOGVV(TAG, "          Tag : %s", hexencode(vector.tag, vector.tagsize).c_str());
-    mbedtls_ccm_free(&ctx);
     return false;
   }
 
@@ -295,7 +337,6 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
   ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", hexencode(raw.data() + cipher_pos, vector.datasize).c_str(),
             static_cast<int>(raw[4]));
 
-  mbedtls_ccm_free(&ctx);
   return true;
 }
 
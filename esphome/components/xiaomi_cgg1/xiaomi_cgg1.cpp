@@ -25,7 +25,7 @@ bool XiaomiCGG1::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
 
   bool success = false;
   for (auto &service_data : device.get_service_datas()) {
-    auto res = xiaomi_ble::parse_xiaomi_header(service_data);
+    auto res = xiaomi_ble::parse_xiaomi_header(service_data, device.address_uint64());
     if (!res.has_value()) {
       continue;
     }
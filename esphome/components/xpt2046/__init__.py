@@ -3,7 +3,13 @@ import esphome.config_validation as cv
 from esphome import automation
 from esphome import pins
 from esphome.components import spi
-from esphome.const import CONF_ID, CONF_ON_STATE, CONF_THRESHOLD, CONF_TRIGGER_ID
+from esphome.const import (
+    CONF_ID,
+    CONF_ON_STATE,
+    CONF_THRESHOLD,
+    CONF_TRIGGER_ID,
+    CONF_IRQ_PIN,
+)
 
 CODEOWNERS = ["@numo68"]
 AUTO_LOAD = ["binary_sensor"]
@@ -18,7 +24,6 @@ CONF_CALIBRATION_Y_MAX = "calibration_y_max"
 CONF_DIMENSION_X = "dimension_x"
 CONF_DIMENSION_Y = "dimension_y"
 CONF_SWAP_X_Y = "swap_x_y"
-CONF_IRQ_PIN = "irq_pin"
 
 xpt2046_ns = cg.esphome_ns.namespace("xpt2046")
 CONF_XPT2046_ID = "xpt2046_id"
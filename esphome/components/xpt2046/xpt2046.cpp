@@ -9,6 +9,11 @@ namespace xpt2046 {
 
 static const char *const TAG = "xpt2046";
 
+/// Number of samples for x and y, the median of them is used.
+static const uint8_t SAMPLES = 5;
+/// Z1, Z2 and one dummy measurement before the samples of each axis, the first one after switching is noisy.
+static const uint8_t CONVERSIONS = 2 + 2 * (1 + SAMPLES);
+
 void XPT2046Component::setup() {
   if (this->irq_pin_ != nullptr) {
     // The pin reports a touch with a falling edge. Unfortunately the pin goes also changes state
@@ -25,8 +30,10 @@ void XPT2046Component::loop() {
     // Force immediate update if a falling edge (= touched is seen) Ignore if still active
     // (that would mean that we missed the release because of a too long update interval)
     bool val = this->irq_pin_->digital_read();
-    if (!val && this->last_irq_ && !this->touched) {
+    if (!val && this->last_irq_ && !this->polling_) {
       ESP_LOGD(TAG, "Falling penirq edge, forcing update");
+      this->polling_ = true;
+      this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
       update();
     }
     this->last_irq_ = val;
@@ -34,7 +41,6 @@ void XPT2046Component::loop() {
 }
 
 void XPT2046Component::update() {
-  int16_t data[6];
   bool touch = false;
   uint32_t now = millis();
 
@@ -42,35 +48,23 @@ void XPT2046Component::update() {
 
   // In case the penirq pin is present only do the SPI transaction if it reports a touch (is low).
   // The touch has to be also confirmed with checking the pressure over threshold
-  if (this->irq_pin_ == nullptr || !this->irq_pin_->digital_read()) {
-    enable();
-
-    int16_t z1 = read_adc_(0xB1 /* Z1 */);
-    int16_t z2 = read_adc_(0xC1 /* Z2 */);
+  const bool pen_down = this->irq_pin_ == nullptr || !this->irq_pin_->digital_read();
+  if (pen_down) {
+    int16_t z1, z2;
+    int16_t x_samples[SAMPLES], y_samples[SAMPLES];
+    this->read_samples_(z1, z2, x_samples, y_samples);
 
     this->z_raw = z1 + 4095 - z2;
 
     touch = (this->z_raw >= this->threshold_);
     if (touch) {
-      read_adc_(0x91 /* Y */);  // dummy Y measure, 1st is always noisy
-      data[0] = read_adc_(0xD1 /* X */);
-      data[1] = read_adc_(0x91 /* Y */);  // make 3 x-y measurements
-      data[2] = read_adc_(0xD1 /* X */);
-      data[3] = read_adc_(0x91 /* Y */);
-      data[4] = read_adc_(0xD1 /* X */);
+      this->x_raw = median(x_samples, SAMPLES);
+      this->y_raw = median(y_samples, SAMPLES);
     }
-
-    data[5] = read_adc_(0x90 /* Y */);  // Last Y touch power down
-
-    disable();
   }
 
-  if (touch) {
-    this->x_raw = best_two_avg(data[0], data[2], data[4]);
-    this->y_raw = best_two_avg(data[1], data[3], data[5]);
-  } else {
+  if (!touch)
     this->x_raw = this->y_raw = 0;
-  }
 
   ESP_LOGV(TAG, "Update [x, y] = [%d, %d], z = %d%s", this->x_raw, this->y_raw, this->z_raw, (touch ? " touched" : ""));
 
@@ -117,6 +111,39 @@ void XPT2046Component::update() {
       for (auto *button : this->buttons_)
         button->release();
     }
+    if (!pen_down) {
+      // Wait for the next falling penirq edge in loop()
+      this->polling_ = false;
+      this->cancel_interval("update");
+    }
+  }
+}
+
+void XPT2046Component::read_samples_(int16_t &z1, int16_t &z2, int16_t *x, int16_t *y) {
+  // The control byte of the next conversion is sent with the low byte of the previous result, the last Y
+  // measurement powers the ADC down and enables the PENIRQ pin again.
+  uint8_t data[CONVERSIONS * 2 + 1] = {};
+  uint8_t i = 0;
+  data[2 * i++] = 0xB1 /* Z1 */;
+  data[2 * i++] = 0xC1 /* Z2 */;
+  for (uint8_t j = 0; j <= SAMPLES; j++)
+    data[2 * i++] = 0xD1 /* X */;
+  for (uint8_t j = 0; j <= SAMPLES; j++)
+    data[2 * i++] = 0x91 /* Y */;
+  data[2 * (i - 1)] = 0x90 /* Y, power down */;
+
+  enable();
+  this->transfer_array(data, sizeof(data));
+  disable();
+
+  auto result = [&data](uint8_t conversion) -> int16_t {
+    return ((data[2 * conversion + 1] << 8) | data[2 * conversion + 2]) >> 3;
+  };
+  z1 = result(0);
+  z2 = result(1);
+  for (uint8_t j = 0; j < SAMPLES; j++) {
+    x[j] = result(3 + j);
+    y[j] = result(4 + SAMPLES + j);
   }
 }
 
@@ -150,23 +177,9 @@ void XPT2046Component::dump_config() {
 
 float XPT2046Component::get_setup_priority() const { return setup_priority::DATA; }
 
-int16_t XPT2046Component::best_two_avg(int16_t x, int16_t y, int16_t z) {
-  int16_t da, db, dc;
-  int16_t reta = 0;
-
-  da = (x > y) ? x - y : y - x;
-  db = (x > z) ? x - z : z - x;
-  dc = (z > y) ? z - y : y - z;
-
-  if (da <= db && da <= dc) {
-    reta = (x + y) >> 1;
-  } else if (db <= da && db <= dc) {
-    reta = (x + z) >> 1;
-  } else {
-    reta = (y + z) >> 1;
-  }
-
-  return reta;
+int16_t XPT2046Component::median(int16_t *values, size_t count) {
+  std::nth_element(values, values + count / 2, values + count);
+  return values[count / 2];
 }
 
 int16_t XPT2046Component::normalize(int16_t val, int16_t min_val, int16_t max_val) {
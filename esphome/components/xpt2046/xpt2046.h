@@ -63,14 +63,16 @@ class XPT2046Component : public PollingComponent,
   /** Detect the touch if the irq pin is specified.
    *
    * If the touch is detected and the component does not already know about it
-   * the update() is called immediately. If the irq pin is not specified
-   * the loop() is a no-op.
+   * the update() is called immediately and the polling is started. It is stopped
+   * again when the touch is released, so the SPI bus is idle while the screen
+   * isn't touched. If the irq pin is not specified the loop() is a no-op.
    */
   void loop() override;
 
   /** Read and process the values from the hardware.
    *
-   * Read the raw x, y and touch pressure values from the chip, detect the touch,
+   * Read the raw x, y and touch pressure values from the chip in one SPI transaction,
+   * as medians of several samples for x and y, detect the touch,
    * and if touched, transform to the user x and y coordinates. If the state has
    * changed or if the value should be reported again due to the
    * report interval, run the action and inform the virtual buttons.
@@ -99,10 +101,12 @@ class XPT2046Component : public PollingComponent,
   /**@}*/
 
  protected:
-  static int16_t best_two_avg(int16_t x, int16_t y, int16_t z);
+  static int16_t median(int16_t *values, size_t count);
   static int16_t normalize(int16_t val, int16_t min_val, int16_t max_val);
 
   int16_t read_adc_(uint8_t ctrl);
+  /// Read the pressure values and the x and y samples, each conversion takes 16 clocks.
+  void read_samples_(int16_t &z1, int16_t &z2, int16_t *x, int16_t *y);
 
   int16_t threshold_;
   int16_t x_raw_min_, x_raw_max_, y_raw_min_, y_raw_max_;
@@ -115,6 +119,8 @@ class XPT2046Component : public PollingComponent,
 
   GPIOPin *irq_pin_{nullptr};
   bool last_irq_{true};
+  /// Whether update() runs every update interval, with the irq pin only while touched.
+  bool polling_{true};
 
   XPT2046OnStateTrigger *on_state_trigger_{new XPT2046OnStateTrigger()};
   std::vector<XPT2046Button *> buttons_{};
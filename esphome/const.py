@@ -284,11 +284,13 @@ CONF_INTERLOCK = "interlock"
 CONF_INTERNAL = "internal"
 CONF_INTERNAL_FILTER = "internal_filter"
 CONF_INTERRUPT = "interrupt"
+CONF_INTERRUPT_PIN = "interrupt_pin"
 CONF_INTERVAL = "interval"
 CONF_INVALID_COOLDOWN = "invalid_cooldown"
 CONF_INVERT = "invert"
 CONF_INVERTED = "inverted"
 CONF_IP_ADDRESS = "ip_address"
+CONF_IRQ_PIN = "irq_pin"
 CONF_JS_INCLUDE = "js_include"
 CONF_JS_URL = "js_url"
 CONF_JVC = "jvc"
@@ -550,6 +552,7 @@ CONF_SSL_FINGERPRINTS = "ssl_fingerprints"
 CONF_STATE = "state"
 CONF_STATE_CLASS = "state_class"
 CONF_STATE_TOPIC = "state_topic"
+CONF_STATIC_ALLOCATION = "static_allocation"
 CONF_STATIC_IP = "static_ip"
 CONF_STATUS = "status"
 CONF_STEP = "step"
@@ -628,6 +631,7 @@ CONF_VOLTAGE_DIVIDER = "voltage_divider"
 CONF_WAIT_TIME = "wait_time"
 CONF_WAIT_UNTIL = "wait_until"
 CONF_WAKEUP_PIN = "wakeup_pin"
+CONF_WAKEUP_THRESHOLD = "wakeup_threshold"
 CONF_WARM_WHITE = "warm_white"
 CONF_WARM_WHITE_COLOR_TEMPERATURE = "warm_white_color_temperature"
 CONF_WATCHDOG_THRESHOLD = "watchdog_threshold"
@@ -723,9 +727,11 @@ UNIT_METER = "m"
 UNIT_METER_PER_SECOND_SQUARED = "m/s²"
 UNIT_MICROGRAMS_PER_CUBIC_METER = "µg/m³"
 UNIT_MICROMETER = "µm"
+UNIT_MICROSECOND = "µs"
 UNIT_MICROSIEMENS_PER_CENTIMETER = "µS/cm"
 UNIT_MICROTESLA = "µT"
 UNIT_MILLIGRAMS_PER_CUBIC_METER = "mg/m³"
+UNIT_MILLISECOND = "ms"
 UNIT_MINUTE = "min"
 UNIT_OHM = "Ω"
 UNIT_PARTS_PER_BILLION = "ppb"
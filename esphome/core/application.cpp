@@ -2,15 +2,31 @@
 #include "esphome/core/log.h"
 #include "esphome/core/version.h"
 #include "esphome/core/esphal.h"
+#include <algorithm>
 
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#include <driver/uart.h>
+#include <rom/uart.h>
+#endif
+
+#if defined(USE_SETUP_TRACE) && defined(ARDUINO_ARCH_ESP32)
+#include <esp_attr.h>
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
 
+#ifdef USE_SETUP_TRACE
+static const uint32_t SETUP_TRACE_MAGIC = 0x5E7B7ACE;
+#endif
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -31,30 +47,41 @@ void Application::setup() {
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
   });
+  // Most components keep at most a couple of timers pending, size the item pool accordingly
+  this->scheduler.reserve_pool(this->components_.size() + 8);
+#ifdef USE_SETUP_TRACE
+  const uint32_t setup_start = micros();
+#endif
 
+  // Components that have been set up, but can't proceed yet (like WiFi while connecting)
+  std::vector<Component *> blocking;
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
+    if (component->get_actual_setup_priority() < this->setup_cutoff_) {
+      ESP_LOGI(TAG, "Skipping setup of %u components in this boot", unsigned(this->components_.size() - i));
+      this->components_.erase(this->components_.begin() + i, this->components_.end());
+      break;
+    }
 
+    if (!blocking.empty() && component->setup_depends_on_previous())
+      this->wait_for_components_(i, blocking);
+
+#ifdef USE_SETUP_TRACE
+    const uint32_t component_start = micros();
+    component->call();
+    component->setup_duration_us_ = micros() - component_start;
+#else
     component->call();
+#endif
     this->scheduler.process_to_add();
-    if (component->can_proceed())
-      continue;
-
-    std::stable_sort(this->components_.begin(), this->components_.begin() + i + 1,
-                     [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
-
-    do {
-      uint32_t new_app_state = STATUS_LED_WARNING;
-      this->scheduler.call();
-      for (uint32_t j = 0; j <= i; j++) {
-        this->components_[j]->call();
-        new_app_state |= this->components_[j]->get_component_state();
-        this->app_state_ |= new_app_state;
-      }
-      this->app_state_ = new_app_state;
-      yield();
-    } while (!component->can_proceed());
+    if (!component->can_proceed())
+      blocking.push_back(component);
   }
+  this->wait_for_components_(this->components_.size(), blocking);
+#ifdef USE_SETUP_TRACE
+  this->setup_total_us_ = micros() - setup_start;
+  this->store_setup_trace_();
+#endif
 
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
@@ -63,17 +90,84 @@ void Application::setup() {
   // Dummy function to link some symbols into the binary.
   force_link_symbols();
 }
+void Application::wait_for_components_(uint32_t set_up_count, std::vector<Component *> &blocking) {
+  if (blocking.empty())
+    return;
+
+  std::stable_sort(this->components_.begin(), this->components_.begin() + set_up_count,
+                   [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
+
+#ifdef USE_SETUP_TRACE
+  uint32_t last = micros();
+#endif
+  while (true) {
+#ifdef USE_SETUP_TRACE
+    const uint32_t now = micros();
+    this->setup_wait_us_ += now - last;
+    for (auto *component : blocking)
+      component->setup_wait_us_ += now - last;
+    last = now;
+#endif
+    blocking.erase(std::remove_if(blocking.begin(), blocking.end(), [](Component *c) { return c->can_proceed(); }),
+                   blocking.end());
+    if (blocking.empty())
+      return;
+
+    uint32_t new_app_state = STATUS_LED_WARNING;
+    this->process_deferred_calls_();
+    this->scheduler.call();
+    for (uint32_t j = 0; j < set_up_count; j++) {
+      this->components_[j]->call();
+      new_app_state |= this->components_[j]->get_component_state();
+      this->app_state_ |= new_app_state;
+    }
+    this->app_state_ = new_app_state;
+    yield();
+  }
+}
 void Application::loop() {
   uint32_t new_app_state = 0;
   const uint32_t start = millis();
+  this->loop_start_time_ = start;
 
+  if (this->has_pending_enable_loop_requests_)
+    this->enable_pending_loops_();
+  this->process_deferred_calls_();
+
+  this->timer_wheel.call();
   this->scheduler.call();
-  for (Component *component : this->looping_components_) {
+#ifdef ARDUINO_ARCH_ESP32
+  this->worker.process_done();
+#endif
+  this->in_loop_ = true;
+  const uint32_t loop_components_start = micros();
+  for (this->current_loop_index_ = 0; this->current_loop_index_ < this->looping_components_active_end_;
+       this->current_loop_index_++) {
+    Component *component = this->looping_components_[this->current_loop_index_];
+    if (this->loop_budget_us_ != 0) {
+      if (!component->loop_deferred_ && micros() - loop_components_start > this->loop_budget_us_ &&
+          !component->is_loop_latency_critical()) {
+        component->loop_deferred_ = true;
+        new_app_state |= component->get_component_state();
+        continue;
+      }
+      component->loop_deferred_ = false;
+    }
+#ifdef USE_RUNTIME_STATS
+    const uint32_t component_start = micros();
     component->call();
+    component->get_runtime_stats().record(micros() - component_start);
+#else
+    component->call();
+#endif
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
     this->feed_wdt();
   }
+  this->in_loop_ = false;
+  // Components with a disabled loop can still have a warning or error status set
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++)
+    new_app_state |= this->looping_components_[i]->get_component_state();
   this->app_state_ = new_app_state;
 
   const uint32_t end = millis();
@@ -92,11 +186,12 @@ void Application::loop() {
       delay_time = this->loop_interval_ - (now - this->last_loop_);
 
     uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
+    next_schedule = std::min(next_schedule, this->timer_wheel.next_expiry_in().value_or(delay_time));
     // next_schedule is max 0.5*delay_time
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    this->idle_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -105,6 +200,9 @@ void Application::loop() {
       ESP_LOGI(TAG, "ESPHome version " ESPHOME_VERSION " compiled on %s", this->compilation_time_.c_str());
 #ifdef ESPHOME_PROJECT_NAME
       ESP_LOGI(TAG, "Project " ESPHOME_PROJECT_NAME " version " ESPHOME_PROJECT_VERSION);
+#endif
+#ifdef USE_SETUP_TRACE
+      this->dump_setup_trace_();
 #endif
     }
 
@@ -113,6 +211,105 @@ void Application::loop() {
   }
 }
 
+bool ICACHE_RAM_ATTR Application::defer_from_isr(void (*callback)(void *), void *arg) {
+  return this->deferred_calls_.push(DeferredCall{callback, arg});
+}
+void Application::process_deferred_calls_() {
+  DeferredCall call;
+  while (this->deferred_calls_.pop(call))
+    call.callback(call.arg);
+}
+#ifdef USE_SETUP_TRACE
+#ifdef ARDUINO_ARCH_ESP32
+// RTC slow memory is retained during deep sleep, NVS would wear the flash on every wake-up
+RTC_DATA_ATTR static SetupTrace rtc_setup_trace;  // NOLINT
+#endif
+void Application::store_setup_trace_() {
+  SetupTrace trace{};
+  trace.magic = SETUP_TRACE_MAGIC;
+  trace.total_ms = this->setup_total_us_ / 1000;
+  trace.wait_ms = this->setup_wait_us_ / 1000;
+  const size_t slots = sizeof(trace.slowest) / sizeof(trace.slowest[0]);
+  for (auto *component : this->components_) {
+    const uint32_t ms = (component->get_setup_duration_us() + component->get_setup_wait_us()) / 1000;
+    // Keep the slots sorted by total time, insert this component if it is slower than the last one
+    size_t pos = slots;
+    while (pos > 0 && trace.slowest[pos - 1].setup_ms + trace.slowest[pos - 1].wait_ms < ms)
+      pos--;
+    if (pos == slots)
+      continue;
+    for (size_t i = slots - 1; i > pos; i--)
+      trace.slowest[i] = trace.slowest[i - 1];
+    trace.slowest[pos].source_hash = fnv1_hash(component->get_component_source());
+    trace.slowest[pos].setup_ms = component->get_setup_duration_us() / 1000;
+    trace.slowest[pos].wait_ms = component->get_setup_wait_us() / 1000;
+  }
+
+#ifdef ARDUINO_ARCH_ESP32
+  this->last_boot_trace_ = rtc_setup_trace;
+  this->has_last_boot_trace_ = this->last_boot_trace_.magic == SETUP_TRACE_MAGIC;
+  rtc_setup_trace = trace;
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+  // Created after all components so that their RTC offsets are not shifted
+  auto pref = global_preferences.make_preference<SetupTrace>(fnv1_hash("setup_trace"), false);
+  this->has_last_boot_trace_ = pref.load(&this->last_boot_trace_) && this->last_boot_trace_.magic == SETUP_TRACE_MAGIC;
+  pref.save(&trace);
+#endif
+}
+void Application::dump_setup_trace_() {
+  ESP_LOGCONFIG(TAG, "Setup took %u ms, %u ms of it waiting for components to proceed:", this->setup_total_us_ / 1000,
+                this->setup_wait_us_ / 1000);
+  for (auto *component : this->components_) {
+    const uint32_t setup_us = component->get_setup_duration_us();
+    const uint32_t wait_us = component->get_setup_wait_us();
+    if (setup_us < 1000 && wait_us == 0)
+      continue;
+    ESP_LOGCONFIG(TAG, "  %s: setup %u.%03u ms, waited for %u ms", component->get_component_source(), setup_us / 1000,
+                  setup_us % 1000, wait_us / 1000);
+  }
+
+  if (!this->has_last_boot_trace_)
+    return;
+  ESP_LOGCONFIG(TAG, "Previous boot: setup took %u ms, %u ms of it waiting", this->last_boot_trace_.total_ms,
+                this->last_boot_trace_.wait_ms);
+  for (auto &entry : this->last_boot_trace_.slowest) {
+    if (entry.source_hash == 0)
+      continue;
+    const char *source = "<unknown>";
+    for (auto *component : this->components_) {
+      if (fnv1_hash(component->get_component_source()) == entry.source_hash) {
+        source = component->get_component_source();
+        break;
+      }
+    }
+    ESP_LOGCONFIG(TAG, "  %s: setup %u ms, waited for %u ms", source, entry.setup_ms, entry.wait_ms);
+  }
+}
+#endif
+void Application::idle_(uint32_t delay_time) {
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->idle_light_sleep_ && delay_time >= this->idle_light_sleep_min_duration_) {
+    // Let the logger finish sending before the UART clock is stopped
+    uart_tx_wait_idle(CONFIG_CONSOLE_UART_NUM);
+    esp_sleep_enable_timer_wakeup(uint64_t(delay_time) * 1000ULL);
+    if (esp_light_sleep_start() == ESP_OK)
+      return;
+  }
+#endif
+  delay(delay_time);
+}
+#ifdef ARDUINO_ARCH_ESP32
+void Application::register_light_sleep_gpio_wakeup(uint8_t pin, bool level) {
+  gpio_wakeup_enable(gpio_num_t(pin), level ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+}
+void Application::register_light_sleep_uart_wakeup(int uart_num, int threshold) {
+  uart_set_wakeup_threshold(uart_port_t(uart_num), threshold);
+  esp_sleep_enable_uart_wakeup(uart_num);
+}
+#endif
+
 void ICACHE_RAM_ATTR HOT Application::feed_wdt() {
   static uint32_t LAST_FEED = 0;
   uint32_t now = millis();
@@ -135,6 +332,7 @@ void Application::reboot() {
   ESP_LOGI(TAG, "Forcing a reboot...");
   for (auto *comp : this->components_)
     comp->on_shutdown();
+  global_preferences.sync();
   ESP.restart();
   // restart() doesn't always end execution
   while (true) {
@@ -147,6 +345,7 @@ void Application::safe_reboot() {
     comp->on_safe_shutdown();
   for (auto *comp : this->components_)
     comp->on_shutdown();
+  global_preferences.sync();
   ESP.restart();
   // restart() doesn't always end execution
   while (true) {
@@ -159,6 +358,46 @@ void Application::calculate_looping_components_() {
     if (obj->has_overridden_loop())
       this->looping_components_.push_back(obj);
   }
+  // Components that disabled their loop during setup start out in the inactive part
+  auto active_end = std::stable_partition(
+      this->looping_components_.begin(), this->looping_components_.end(), [](const Component *c) {
+        return (c->get_component_state() & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE;
+      });
+  this->looping_components_active_end_ = active_end - this->looping_components_.begin();
+}
+void Application::disable_component_loop_(Component *component) {
+  for (size_t i = 0; i < this->looping_components_active_end_; i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    this->looping_components_active_end_--;
+    if (i != this->looping_components_active_end_) {
+      std::swap(this->looping_components_[i], this->looping_components_[this->looping_components_active_end_]);
+      // The not yet called component that was swapped into the current slot must still run in this iteration
+      if (this->in_loop_ && i == this->current_loop_index_)
+        this->current_loop_index_--;
+    }
+    return;
+  }
+}
+void Application::enable_component_loop_(Component *component) {
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    std::swap(this->looping_components_[i], this->looping_components_[this->looping_components_active_end_]);
+    this->looping_components_active_end_++;
+    return;
+  }
+}
+void Application::enable_pending_loops_() {
+  this->has_pending_enable_loop_requests_ = false;
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    Component *component = this->looping_components_[i];
+    if (!component->pending_enable_loop_)
+      continue;
+    component->pending_enable_loop_ = false;
+    // enable_loop() moves the component into the active part, which is before index i
+    component->enable_loop();
+  }
 }
 
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
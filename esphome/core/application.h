@@ -1,12 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include "esphome/core/defines.h"
 #include "esphome/core/preferences.h"
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/lock_free_queue.h"
 #include "esphome/core/scheduler.h"
+#include "esphome/core/timer_wheel.h"
+#include "esphome/core/worker.h"
 
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
@@ -38,6 +42,21 @@
 
 namespace esphome {
 
+#ifdef USE_SETUP_TRACE
+struct SetupTraceEntry {
+  uint32_t source_hash;
+  uint32_t setup_ms;
+  uint32_t wait_ms;
+};
+/// Summary of one boot, small enough to keep in RTC memory across deep sleep cycles.
+struct SetupTrace {
+  uint32_t magic;
+  uint32_t total_ms;
+  uint32_t wait_ms;
+  SetupTraceEntry slowest[4];
+};
+#endif
+
 class Application {
  public:
   void pre_setup(const std::string &name, const char *compilation_time, bool name_add_mac_suffix) {
@@ -99,6 +118,13 @@ class Application {
   /// Set up all the registered components. Call this at the end of your setup() function.
   void setup();
 
+  /** Skip the components below the given setup priority in this boot, they are neither set up nor looped.
+   *
+   * For wakes from deep sleep that only sample local sensors before sleeping again, see the fast_wake option of
+   * deep_sleep. Has to be called from setup() of a component above that priority.
+   */
+  void set_setup_cutoff(float priority) { this->setup_cutoff_ = priority; }
+
   /// Make a loop iteration. Call this in your loop() function.
   void loop();
 
@@ -124,6 +150,55 @@ class Application {
    */
   void set_loop_interval(uint32_t loop_interval) { this->loop_interval_ = loop_interval; }
 
+  /** Limit the time the loop() calls of the components take in one iteration of the main loop.
+   *
+   * Once the budget is spent, the remaining components are skipped in this iteration, except for latency
+   * critical ones (see Component::is_loop_latency_critical(), like WiFi and the API). A component that was skipped in
+   * an iteration is always called in the next one, so a loop is delayed by at most one iteration.
+   *
+   * @param budget_us The budget in microseconds, 0 (the default) calls all components in every iteration.
+   */
+  void set_loop_budget(uint32_t budget_us) { this->loop_budget_us_ = budget_us; }
+
+  /// The millis() at which the current loop() iteration started, the same for all components called in it.
+  uint32_t get_loop_start_time() const { return this->loop_start_time_; }
+
+#ifdef ARDUINO_ARCH_ESP32
+  /** Enter light sleep instead of delay() when the main loop has nothing to do for a while.
+   *
+   * The chip wakes up with a timer at the next scheduler deadline (or after the loop interval), and
+   * on any wakeup source registered with register_light_sleep_gpio_wakeup() or
+   * register_light_sleep_uart_wakeup(). Light sleep does not maintain WiFi or BLE connections.
+   *
+   * @param min_sleep_duration Idle gaps shorter than this (in ms) use delay(), as entering and leaving
+   *   light sleep has an overhead of its own.
+   */
+  void set_idle_light_sleep(uint32_t min_sleep_duration) {
+    this->idle_light_sleep_ = true;
+    this->idle_light_sleep_min_duration_ = min_sleep_duration;
+  }
+  bool is_idle_light_sleep_enabled() const { return this->idle_light_sleep_; }
+
+  /// Wake up from idle light sleep when the given GPIO is at the given level.
+  void register_light_sleep_gpio_wakeup(uint8_t pin, bool level);
+
+  /// Wake up from idle light sleep after `threshold` edges on the RX line of the given UART.
+  void register_light_sleep_uart_wakeup(int uart_num, int threshold = 3);
+#endif
+
+  /** Call `callback(arg)` from the main loop, at the start of its next iteration.
+   *
+   * Safe to call from interrupt handlers: this does not allocate, block or take locks. The queue has a fixed
+   * capacity, if it is full the call is dropped and false is returned, see get_deferred_overflow_count().
+   */
+  bool defer_from_isr(void (*callback)(void *), void *arg);
+
+  /// Like defer_from_isr(), for other FreeRTOS tasks (like the BLE or WiFi stack callbacks).
+  bool defer_from_task(void (*callback)(void *), void *arg) { return this->defer_from_isr(callback, arg); }
+
+  /// Number of calls to defer_from_isr()/defer_from_task() that were dropped because the queue was full.
+  uint32_t get_deferred_overflow_count() const { return this->deferred_calls_.get_overflow_count(); }
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
   void feed_wdt();
@@ -139,93 +214,73 @@ class Application {
     for (auto *comp : this->components_) {
       comp->on_shutdown();
     }
+    global_preferences.sync();
   }
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  const std::vector<Component *> &get_components() const { return this->components_; }
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->binary_sensors_, this->binary_sensors_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->switches_, this->switches_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->sensors_, this->sensors_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->text_sensors_, this->text_sensors_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::FanState *> &get_fans() { return this->fans_; }
   fan::FanState *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->fans_, this->fans_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->covers_, this->covers_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->lights_, this->lights_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->climates_, this->climates_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_NUMBER
   const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
   number::Number *get_number_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->numbers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return find_by_key_(this->numbers_, this->numbers_by_key_, key, include_internal);
   }
 #endif
 
   Scheduler scheduler;
+  TimerWheel timer_wheel;
+#ifdef ARDUINO_ARCH_ESP32
+  Worker worker;
+#endif
 
  protected:
   friend Component;
@@ -233,45 +288,112 @@ class Application {
   void register_component_(Component *comp);
 
   void calculate_looping_components_();
+  /// Keep looping the first set_up_count components until all blocking components can proceed.
+  void wait_for_components_(uint32_t set_up_count, std::vector<Component *> &blocking);
+  void idle_(uint32_t delay_time);
+  void disable_component_loop_(Component *component);
+  void enable_component_loop_(Component *component);
+  void enable_pending_loops_();
+  void process_deferred_calls_();
+
+  /** Find an entity by its object ID hash with a binary search in index.
+   *
+   * The index is a copy of entities sorted by key. It is (re)built the first time a lookup happens after
+   * an entity was registered, so registration itself stays a plain push_back.
+   */
+  template<typename T>
+  static T *find_by_key_(const std::vector<T *> &entities, std::vector<T *> &index, uint32_t key,
+                         bool include_internal) {
+    if (index.size() != entities.size()) {
+      index = entities;
+      std::stable_sort(index.begin(), index.end(),
+                       [](T *a, T *b) { return a->get_object_id_hash() < b->get_object_id_hash(); });
+    }
+    auto it = std::lower_bound(index.begin(), index.end(), key,
+                               [](T *obj, uint32_t k) { return obj->get_object_id_hash() < k; });
+    for (; it != index.end() && (*it)->get_object_id_hash() == key; ++it) {
+      if (include_internal || !(*it)->is_internal())
+        return *it;
+    }
+    return nullptr;
+  }
+#ifdef USE_SETUP_TRACE
+  /// Store the trace of this boot in RTC memory, after reading the one of the previous boot.
+  void store_setup_trace_();
+  void dump_setup_trace_();
+#endif
+
+  struct DeferredCall {
+    void (*callback)(void *);
+    void *arg;
+  };
 
   std::vector<Component *> components_{};
+  /// Components with an overridden loop(). The first looping_components_active_end_ entries are called.
   std::vector<Component *> looping_components_{};
+  size_t looping_components_active_end_{0};
+  size_t current_loop_index_{0};
+  bool in_loop_{false};
+  volatile bool has_pending_enable_loop_requests_{false};
+  LockFreeQueue<DeferredCall, 32> deferred_calls_;
+#ifdef USE_SETUP_TRACE
+  uint32_t setup_total_us_{0};
+  uint32_t setup_wait_us_{0};
+  SetupTrace last_boot_trace_{};
+  bool has_last_boot_trace_{false};
+#endif
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  std::vector<binary_sensor::BinarySensor *> binary_sensors_by_key_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  std::vector<switch_::Switch *> switches_by_key_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  std::vector<sensor::Sensor *> sensors_by_key_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  std::vector<text_sensor::TextSensor *> text_sensors_by_key_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::FanState *> fans_{};
+  std::vector<fan::FanState *> fans_by_key_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  std::vector<cover::Cover *> covers_by_key_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  std::vector<climate::Climate *> climates_by_key_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  std::vector<light::LightState *> lights_by_key_{};
 #endif
 #ifdef USE_NUMBER
   std::vector<number::Number *> numbers_{};
+  std::vector<number::Number *> numbers_by_key_{};
 #endif
 
   std::string name_;
   std::string compilation_time_;
   bool name_add_mac_suffix_;
   uint32_t last_loop_{0};
+  uint32_t loop_start_time_{0};
   uint32_t loop_interval_{16};
+  uint32_t loop_budget_us_{0};
   int dump_config_at_{-1};
+  float setup_cutoff_{-INFINITY};
   uint32_t app_state_{0};
+#ifdef ARDUINO_ARCH_ESP32
+  bool idle_light_sleep_{false};
+  uint32_t idle_light_sleep_min_duration_{0};
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
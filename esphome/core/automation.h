@@ -33,7 +33,7 @@ namespace esphome {
 template<typename... Ts> class Condition {
  public:
   /// Check whether this condition passes. This condition check must be instant, and not cause any delays.
-  virtual bool check(Ts... x) = 0;
+  virtual bool check(const Ts &... x) = 0;
 
   /// Call check with a tuple of values as parameter.
   bool check_tuple(const std::tuple<Ts...> &tuple) {
@@ -51,7 +51,7 @@ template<typename... Ts> class Automation;
 template<typename... Ts> class Trigger {
  public:
   /// Inform the parent automation that the event has triggered.
-  void trigger(Ts... x) {
+  void trigger(const Ts &... x) {
     if (this->automation_parent_ == nullptr)
       return;
     this->automation_parent_->trigger(x...);
@@ -79,7 +79,7 @@ template<typename... Ts> class ActionList;
 
 template<typename... Ts> class Action {
  public:
-  virtual void play_complex(Ts... x) {
+  virtual void play_complex(const Ts &... x) {
     this->num_running_++;
     this->play(x...);
     this->play_next_(x...);
@@ -106,8 +106,8 @@ template<typename... Ts> class Action {
  protected:
   friend ActionList<Ts...>;
 
-  virtual void play(Ts... x) = 0;
-  void play_next_(Ts... x) {
+  virtual void play(const Ts &... x) = 0;
+  void play_next_(const Ts &... x) {
     if (this->num_running_ > 0) {
       this->num_running_--;
       if (this->next_ != nullptr) {
@@ -157,7 +157,7 @@ template<typename... Ts> class ActionList {
       this->add_action(action);
     }
   }
-  void play(Ts... x) {
+  void play(const Ts &... x) {
     if (this->actions_begin_ != nullptr)
       this->actions_begin_->play_complex(x...);
   }
@@ -197,7 +197,7 @@ template<typename... Ts> class Automation {
 
   void stop() { this->actions_.stop(); }
 
-  void trigger(Ts... x) { this->actions_.play(x...); }
+  void trigger(const Ts &... x) { this->actions_.play(x...); }
 
   bool is_running() { return this->actions_.is_running(); }
 
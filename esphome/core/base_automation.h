@@ -8,7 +8,7 @@ namespace esphome {
 template<typename... Ts> class AndCondition : public Condition<Ts...> {
  public:
   explicit AndCondition(const std::vector<Condition<Ts...> *> &conditions) : conditions_(conditions) {}
-  bool check(Ts... x) override {
+  bool check(const Ts &... x) override {
     for (auto *condition : this->conditions_) {
       if (!condition->check(x...))
         return false;
@@ -24,7 +24,7 @@ template<typename... Ts> class AndCondition : public Condition<Ts...> {
 template<typename... Ts> class OrCondition : public Condition<Ts...> {
  public:
   explicit OrCondition(const std::vector<Condition<Ts...> *> &conditions) : conditions_(conditions) {}
-  bool check(Ts... x) override {
+  bool check(const Ts &... x) override {
     for (auto *condition : this->conditions_) {
       if (condition->check(x...))
         return true;
@@ -40,7 +40,7 @@ template<typename... Ts> class OrCondition : public Condition<Ts...> {
 template<typename... Ts> class NotCondition : public Condition<Ts...> {
  public:
   explicit NotCondition(Condition<Ts...> *condition) : condition_(condition) {}
-  bool check(Ts... x) override { return !this->condition_->check(x...); }
+  bool check(const Ts &... x) override { return !this->condition_->check(x...); }
 
  protected:
   Condition<Ts...> *condition_;
@@ -48,11 +48,11 @@ template<typename... Ts> class NotCondition : public Condition<Ts...> {
 
 template<typename... Ts> class LambdaCondition : public Condition<Ts...> {
  public:
-  explicit LambdaCondition(std::function<bool(Ts...)> &&f) : f_(std::move(f)) {}
-  bool check(Ts... x) override { return this->f_(x...); }
+  explicit LambdaCondition(std::function<bool(const Ts &...)> &&f) : f_(std::move(f)) {}
+  bool check(const Ts &... x) override { return this->f_(x...); }
 
  protected:
-  std::function<bool(Ts...)> f_;
+  std::function<bool(const Ts &...)> f_;
 };
 
 template<typename... Ts> class ForCondition : public Condition<Ts...>, public Component {
@@ -70,7 +70,7 @@ template<typename... Ts> class ForCondition : public Condition<Ts...>, public Co
     return cond;
   }
 
-  bool check(Ts... x) override {
+  bool check(const Ts &... x) override {
     if (!this->check_internal())
       return false;
     return millis() - this->last_inactive_ >= this->time_.value(x...);
@@ -108,14 +108,14 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
 
   TEMPLATABLE_VALUE(uint32_t, delay)
 
-  void play_complex(Ts... x) override {
+  void play_complex(const Ts &... x) override {
     auto f = std::bind(&DelayAction<Ts...>::play_next_, this, x...);
     this->num_running_++;
     this->set_timeout(this->delay_.value(x...), f);
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
-  void play(Ts... x) override { /* ignore - see play_complex */
+  void play(const Ts &... x) override { /* ignore - see play_complex */
   }
 
   void stop() override { this->cancel_timeout(""); }
@@ -123,12 +123,12 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
 
 template<typename... Ts> class LambdaAction : public Action<Ts...> {
  public:
-  explicit LambdaAction(std::function<void(Ts...)> &&f) : f_(std::move(f)) {}
+  explicit LambdaAction(std::function<void(const Ts &...)> &&f) : f_(std::move(f)) {}
 
-  void play(Ts... x) override { this->f_(x...); }
+  void play(const Ts &... x) override { this->f_(x...); }
 
  protected:
-  std::function<void(Ts...)> f_;
+  std::function<void(const Ts &...)> f_;
 };
 
 template<typename... Ts> class IfAction : public Action<Ts...> {
@@ -137,15 +137,15 @@ template<typename... Ts> class IfAction : public Action<Ts...> {
 
   void add_then(const std::vector<Action<Ts...> *> &actions) {
     this->then_.add_actions(actions);
-    this->then_.add_action(new LambdaAction<Ts...>([this](Ts... x) { this->play_next_(x...); }));
+    this->then_.add_action(new LambdaAction<Ts...>([this](const Ts &... x) { this->play_next_(x...); }));
   }
 
   void add_else(const std::vector<Action<Ts...> *> &actions) {
     this->else_.add_actions(actions);
-    this->else_.add_action(new LambdaAction<Ts...>([this](Ts... x) { this->play_next_(x...); }));
+    this->else_.add_action(new LambdaAction<Ts...>([this](const Ts &... x) { this->play_next_(x...); }));
   }
 
-  void play_complex(Ts... x) override {
+  void play_complex(const Ts &... x) override {
     this->num_running_++;
     bool res = this->condition_->check(x...);
     if (res) {
@@ -163,7 +163,7 @@ template<typename... Ts> class IfAction : public Action<Ts...> {
     }
   }
 
-  void play(Ts... x) override { /* ignore - see play_complex */
+  void play(const Ts &... x) override { /* ignore - see play_complex */
   }
 
   void stop() override {
@@ -183,7 +183,7 @@ template<typename... Ts> class WhileAction : public Action<Ts...> {
 
   void add_then(const std::vector<Action<Ts...> *> &actions) {
     this->then_.add_actions(actions);
-    this->then_.add_action(new LambdaAction<Ts...>([this](Ts... x) {
+    this->then_.add_action(new LambdaAction<Ts...>([this](const Ts &... x) {
       if (this->num_running_ > 0 && this->condition_->check_tuple(this->var_)) {
         // play again
         if (this->num_running_ > 0) {
@@ -196,7 +196,7 @@ template<typename... Ts> class WhileAction : public Action<Ts...> {
     }));
   }
 
-  void play_complex(Ts... x) override {
+  void play_complex(const Ts &... x) override {
     this->num_running_++;
     // Store loop parameters
     this->var_ = std::make_tuple(x...);
@@ -213,7 +213,7 @@ template<typename... Ts> class WhileAction : public Action<Ts...> {
     }
   }
 
-  void play(Ts... x) override { /* ignore - see play_complex */
+  void play(const Ts &... x) override { /* ignore - see play_complex */
   }
 
   void stop() override { this->then_.stop(); }
@@ -228,7 +228,7 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
  public:
   WaitUntilAction(Condition<Ts...> *condition) : condition_(condition) {}
 
-  void play_complex(Ts... x) override {
+  void play_complex(const Ts &... x) override {
     this->num_running_++;
     // Check if we can continue immediately.
     if (this->condition_->check(x...)) {
@@ -254,7 +254,7 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
 
   float get_setup_priority() const override { return setup_priority::DATA; }
 
-  void play(Ts... x) override { /* ignore - see play_complex */
+  void play(const Ts &... x) override { /* ignore - see play_complex */
   }
 
  protected:
@@ -266,7 +266,7 @@ template<typename... Ts> class UpdateComponentAction : public Action<Ts...> {
  public:
   UpdateComponentAction(PollingComponent *component) : component_(component) {}
 
-  void play(Ts... x) override {
+  void play(const Ts &... x) override {
     if (this->component_->is_failed())
       return;
     this->component_->update();
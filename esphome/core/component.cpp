@@ -4,6 +4,7 @@
 #include "esphome/core/esphal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <cstring>
 #include <utility>
 
 namespace esphome {
@@ -31,6 +32,7 @@ const uint32_t COMPONENT_STATE_CONSTRUCTION = 0x00;
 const uint32_t COMPONENT_STATE_SETUP = 0x01;
 const uint32_t COMPONENT_STATE_LOOP = 0x02;
 const uint32_t COMPONENT_STATE_FAILED = 0x03;
+const uint32_t COMPONENT_STATE_LOOP_DONE = 0x04;
 const uint32_t STATUS_LED_MASK = 0xFF00;
 const uint32_t STATUS_LED_OK = 0x0000;
 const uint32_t STATUS_LED_WARNING = 0x0100;
@@ -54,6 +56,14 @@ bool Component::cancel_interval(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_interval(this, name);
 }
 
+void Component::set_interval(const char *name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_interval(this, name, interval, std::move(f));
+}
+
+bool Component::cancel_interval(const char *name) {  // NOLINT
+  return App.scheduler.cancel_interval(this, name);
+}
+
 void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
   return App.scheduler.set_timeout(this, name, timeout, std::move(f));
 }
@@ -62,11 +72,22 @@ bool Component::cancel_timeout(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
 
+void Component::set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, timeout, std::move(f));
+}
+
+bool Component::cancel_timeout(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+
 void Component::call_loop() { this->loop(); }
 
 void Component::call_setup() { this->setup(); }
 uint32_t Component::get_component_state() const { return this->component_state_; }
 void Component::call() {
+#ifdef USE_ALLOC_STATS
+  AllocStatsScope alloc_scope(&this->alloc_stats_);
+#endif
   uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
   switch (state) {
     case COMPONENT_STATE_CONSTRUCTION:
@@ -88,6 +109,9 @@ void Component::call() {
     case COMPONENT_STATE_FAILED:
       // State failed: Do nothing
       break;
+    case COMPONENT_STATE_LOOP_DONE:
+      // State loop done: loop() disabled until enable_loop()
+      break;
     default:
       break;
   }
@@ -99,19 +123,52 @@ void Component::mark_failed() {
   this->status_set_error();
 }
 void Component::defer(std::function<void()> &&f) {  // NOLINT
-  App.scheduler.set_timeout(this, "", 0, std::move(f));
+  App.scheduler.set_timeout(this, static_cast<const char *>(nullptr), 0, std::move(f));
 }
 bool Component::cancel_defer(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
+bool Component::cancel_defer(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
 void Component::defer(const std::string &name, std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, 0, std::move(f));
 }
+void Component::defer(const char *name, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, 0, std::move(f));
+}
+#ifdef ARDUINO_ARCH_ESP32
+bool Component::defer_to_worker(std::function<void()> &&work, std::function<void()> &&done) {  // NOLINT
+  return App.worker.submit(this, std::move(work), std::move(done));
+}
+#endif
 void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {  // NOLINT
-  App.scheduler.set_timeout(this, "", timeout, std::move(f));
+  App.scheduler.set_timeout(this, static_cast<const char *>(nullptr), timeout, std::move(f));
 }
 void Component::set_interval(uint32_t interval, std::function<void()> &&f) {  // NOLINT
-  App.scheduler.set_interval(this, "", interval, std::move(f));
+  App.scheduler.set_interval(this, static_cast<const char *>(nullptr), interval, std::move(f));
+}
+void Component::disable_loop() {
+  uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
+  if (state == COMPONENT_STATE_FAILED || state == COMPONENT_STATE_LOOP_DONE)
+    return;
+  ESP_LOGVV(TAG, "%s loop disabled", this->get_component_source());
+  this->component_state_ &= ~COMPONENT_STATE_MASK;
+  this->component_state_ |= COMPONENT_STATE_LOOP_DONE;
+  App.disable_component_loop_(this);
+}
+void Component::enable_loop() {
+  if ((this->component_state_ & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE)
+    return;
+  ESP_LOGVV(TAG, "%s loop enabled", this->get_component_source());
+  this->component_state_ &= ~COMPONENT_STATE_MASK;
+  this->component_state_ |= COMPONENT_STATE_LOOP;
+  App.enable_component_loop_(this);
+}
+void ICACHE_RAM_ATTR Component::enable_loop_soon_any_context() {
+  // Only set flags here, this may run in an ISR
+  this->pending_enable_loop_ = true;
+  App.has_pending_enable_loop_requests_ = true;
 }
 bool Component::is_failed() { return (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_FAILED; }
 bool Component::can_proceed() { return true; }
@@ -131,10 +188,18 @@ void Component::status_momentary_warning(const std::string &name, uint32_t lengt
   this->status_set_warning();
   this->set_timeout(name, length, [this]() { this->status_clear_warning(); });
 }
+void Component::status_momentary_warning(const char *name, uint32_t length) {
+  this->status_set_warning();
+  this->set_timeout(name, length, [this]() { this->status_clear_warning(); });
+}
 void Component::status_momentary_error(const std::string &name, uint32_t length) {
   this->status_set_error();
   this->set_timeout(name, length, [this]() { this->status_clear_error(); });
 }
+void Component::status_momentary_error(const char *name, uint32_t length) {
+  this->status_set_error();
+  this->set_timeout(name, length, [this]() { this->status_clear_error(); });
+}
 void Component::dump_config() {}
 float Component::get_actual_setup_priority() const {
   if (isnan(this->setup_priority_override_))
@@ -157,6 +222,28 @@ bool Component::has_overridden_loop() const {
   return loop_overridden || call_loop_overridden;
 }
 
+const char *Component::get_component_source() const {
+  if (this->component_source_ == nullptr)
+    return "<unknown>";
+  return this->component_source_;
+}
+
+#ifdef USE_RUNTIME_STATS
+void HOT RuntimeStats::record(uint32_t duration_us) {
+  this->count++;
+  this->total_us += duration_us;
+  if (duration_us < this->min_us)
+    this->min_us = duration_us;
+  if (duration_us > this->max_us)
+    this->max_us = duration_us;
+}
+void RuntimeStats::reset() { *this = RuntimeStats(); }
+#endif
+
+#ifdef USE_ALLOC_STATS
+AllocStats *global_alloc_stats_target = nullptr;  // NOLINT
+#endif
+
 PollingComponent::PollingComponent(uint32_t update_interval) : Component(), update_interval_(update_interval) {}
 
 void PollingComponent::call_setup() {
@@ -173,18 +260,37 @@ void PollingComponent::set_update_interval(uint32_t update_interval) { this->upd
 const std::string &Nameable::get_name() const { return this->name_; }
 void Nameable::set_name(const std::string &name) {
   this->name_ = name;
-  this->calc_object_id_();
+  // a different name needs a different object id, compute it again when it is needed
+  this->object_id_ = nullptr;
+  this->object_id_buffer_.reset();
 }
-Nameable::Nameable(std::string name) : name_(std::move(name)) { this->calc_object_id_(); }
+Nameable::Nameable(std::string name) : name_(std::move(name)) {}
 
-const std::string &Nameable::get_object_id() { return this->object_id_; }
+void Nameable::set_object_id(const char *object_id, uint32_t object_id_hash) {
+  this->object_id_ = object_id;
+  this->object_id_hash_ = object_id_hash;
+  this->object_id_buffer_.reset();
+}
+const char *Nameable::get_object_id() {
+  if (this->object_id_ == nullptr)
+    this->calc_object_id_();
+  return this->object_id_;
+}
 bool Nameable::is_internal() const { return this->internal_; }
 void Nameable::set_internal(bool internal) { this->internal_ = internal; }
 void Nameable::calc_object_id_() {
-  this->object_id_ = sanitize_string_allowlist(to_lowercase_underscore(this->name_), HOSTNAME_CHARACTER_ALLOWLIST);
+  std::string object_id =
+      sanitize_string_allowlist(to_lowercase_underscore(this->name_), HOSTNAME_CHARACTER_ALLOWLIST);
+  this->object_id_buffer_.reset(new char[object_id.size() + 1]);
+  memcpy(this->object_id_buffer_.get(), object_id.c_str(), object_id.size() + 1);
+  this->object_id_ = this->object_id_buffer_.get();
   // FNV-1 hash
-  this->object_id_hash_ = fnv1_hash(this->object_id_);
+  this->object_id_hash_ = fnv1_hash(object_id);
+}
+uint32_t Nameable::get_object_id_hash() {
+  if (this->object_id_ == nullptr)
+    this->calc_object_id_();
+  return this->object_id_hash_;
 }
-uint32_t Nameable::get_object_id_hash() { return this->object_id_hash_; }
 
 }  // namespace esphome
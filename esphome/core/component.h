@@ -2,8 +2,10 @@
 
 #include <string>
 #include <functional>
+#include <memory>
 #include "Arduino.h"
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -50,11 +52,52 @@ extern const uint32_t COMPONENT_STATE_CONSTRUCTION;
 extern const uint32_t COMPONENT_STATE_SETUP;
 extern const uint32_t COMPONENT_STATE_LOOP;
 extern const uint32_t COMPONENT_STATE_FAILED;
+extern const uint32_t COMPONENT_STATE_LOOP_DONE;
 extern const uint32_t STATUS_LED_MASK;
 extern const uint32_t STATUS_LED_OK;
 extern const uint32_t STATUS_LED_WARNING;
 extern const uint32_t STATUS_LED_ERROR;
 
+#ifdef USE_RUNTIME_STATS
+/// Execution time statistics of a piece of code, recorded in microseconds.
+struct RuntimeStats {
+  void record(uint32_t duration_us);
+  void reset();
+  float get_average_us() const { return this->count == 0 ? 0.0f : this->total_us / float(this->count); }
+
+  uint32_t count{0};
+  uint32_t min_us{UINT32_MAX};
+  uint32_t max_us{0};
+  uint64_t total_us{0};
+};
+#endif
+
+#ifdef USE_ALLOC_STATS
+/// Heap operations counted while some code ran, see the alloc_stats option of the debug component.
+struct AllocStats {
+  void reset() { *this = AllocStats(); }
+
+  uint32_t allocs{0};
+  uint32_t frees{0};
+  uint32_t alloc_bytes{0};
+};
+
+/// Where heap operations are currently counted, nullptr outside of components.
+extern AllocStats *global_alloc_stats_target;  // NOLINT
+
+/// Attributes the heap operations to the given statistics while in scope.
+class AllocStatsScope {
+ public:
+  explicit AllocStatsScope(AllocStats *target) : previous_(global_alloc_stats_target) {
+    global_alloc_stats_target = target;
+  }
+  ~AllocStatsScope() { global_alloc_stats_target = this->previous_; }
+
+ protected:
+  AllocStats *previous_;
+};
+#endif
+
 class Component {
  public:
   /** Where the component's initialization should happen.
@@ -93,6 +136,12 @@ class Component {
    */
   virtual float get_loop_priority() const;
 
+  /** Whether loop() is called in every iteration even when the loop budget of the Application is spent.
+   *
+   * Defaults to components with a positive loop priority, see Application::set_loop_budget().
+   */
+  virtual bool is_loop_latency_critical() const { return this->get_loop_priority() > 0.0f; }
+
   void call();
 
   virtual void on_shutdown() {}
@@ -112,6 +161,15 @@ class Component {
 
   virtual bool can_proceed();
 
+  /** Whether setup() of this component has to wait until all components set up before it can proceed.
+   *
+   * Components are set up in order of their setup priority. By default, while a component can't proceed yet
+   * (for example WiFi while it is connecting), no later component is set up. A component that does not
+   * need anything the earlier components provide (like the network) can return false here to be set up
+   * right away; components after it that do depend on the earlier ones still wait.
+   */
+  virtual bool setup_depends_on_previous() const { return true; }
+
   bool status_has_warning();
 
   bool status_has_error();
@@ -125,12 +183,58 @@ class Component {
   void status_clear_error();
 
   void status_momentary_warning(const std::string &name, uint32_t length = 5000);
+  void status_momentary_warning(const char *name, uint32_t length = 5000);
 
   void status_momentary_error(const std::string &name, uint32_t length = 5000);
+  void status_momentary_error(const char *name, uint32_t length = 5000);
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() for this component until enable_loop() is called.
+   *
+   * This removes the component from the list of components the main loop iterates over,
+   * so components that have nothing to do for a while cost nothing in the main loop.
+   * Must be called from the main loop task, timeouts and intervals keep working.
+   */
+  void disable_loop();
+
+  /// Resume calling loop() after disable_loop(). Must be called from the main loop task.
+  void enable_loop();
+
+  /** Request loop() to be resumed from any context, like an ISR or another FreeRTOS task.
+   *
+   * The component is put back into the main loop at the start of the next main loop iteration.
+   */
+  void enable_loop_soon_any_context();
+
+  /** Set a human readable identifier for this component, used in diagnostic output.
+   *
+   * This is set by code generation and needs to point to a string that is never freed.
+   */
+  void set_component_source(const char *source) { this->component_source_ = source; }
+  /// Get the identifier set with set_component_source(), or "<unknown>".
+  const char *get_component_source() const;
+
+#ifdef USE_RUNTIME_STATS
+  /// Time spent in call(), recorded by Application::loop().
+  RuntimeStats &get_runtime_stats() { return this->runtime_stats_; }
+#endif
+
+#ifdef USE_ALLOC_STATS
+  /// Heap operations of setup(), loop() and the timers of this component.
+  AllocStats &get_alloc_stats() { return this->alloc_stats_; }
+#endif
+
+#ifdef USE_SETUP_TRACE
+  /// Time spent in setup() of this component during boot in microseconds, recorded by Application::setup().
+  uint32_t get_setup_duration_us() const { return this->setup_duration_us_; }
+  /// Time the setup of later components waited for this component to proceed in microseconds.
+  uint32_t get_setup_wait_us() const { return this->setup_wait_us_; }
+#endif
+
  protected:
+  friend class Application;
+
   virtual void call_loop();
   virtual void call_setup();
   /** Set an interval function with a unique name. Empty name means no cancelling possible.
@@ -150,6 +254,12 @@ class Component {
    */
   void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
 
+  /** Set an interval function with a constant name, avoiding a std::string construction on every call.
+   *
+   * String literals resolve to this overload, so `set_interval("update", ...)` never allocates for the name.
+   */
+  void set_interval(const char *name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+
   void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
 
   /** Cancel an interval function.
@@ -158,6 +268,7 @@ class Component {
    * @return Whether an interval functions was deleted.
    */
   bool cancel_interval(const std::string &name);  // NOLINT
+  bool cancel_interval(const char *name);         // NOLINT
 
   void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
@@ -177,12 +288,16 @@ class Component {
    */
   void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
+  /// Set a timeout function with a constant name, see set_interval(const char *, uint32_t, std::function).
+  void set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+
   /** Cancel a timeout function.
    *
    * @param name The identifier for this timeout function.
    * @return Whether a timeout functions was deleted.
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
+  bool cancel_timeout(const char *name);         // NOLINT
 
   /** Defer a callback to the next loop() call.
    *
@@ -192,15 +307,42 @@ class Component {
    * @param f The callback.
    */
   void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
+  void defer(const char *name, std::function<void()> &&f);         // NOLINT
 
   /// Defer a callback to the next loop() call.
   void defer(std::function<void()> &&f);  // NOLINT
 
+#ifdef ARDUINO_ARCH_ESP32
+  /** Run work on the worker task on the other core, then done in the main loop.
+   *
+   * See Worker for what work is allowed to do.
+   *
+   * @return Whether the job was queued.
+   */
+  bool defer_to_worker(std::function<void()> &&work, std::function<void()> &&done);  // NOLINT
+#endif
+
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
+  bool cancel_defer(const char *name);         // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
+  const char *component_source_{nullptr};
+  /// Set by enable_loop_soon_any_context(), picked up by Application::loop().
+  volatile bool pending_enable_loop_{false};
+  /// loop() was skipped in the last iteration because the loop budget was spent.
+  bool loop_deferred_{false};
+#ifdef USE_RUNTIME_STATS
+  RuntimeStats runtime_stats_;
+#endif
+#ifdef USE_ALLOC_STATS
+  AllocStats alloc_stats_;
+#endif
+#ifdef USE_SETUP_TRACE
+  uint32_t setup_duration_us_{0};
+  uint32_t setup_wait_us_{0};
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -249,8 +391,13 @@ class Nameable {
   explicit Nameable(std::string name);
   const std::string &get_name() const;
   void set_name(const std::string &name);
-  /// Get the sanitized name of this nameable as an ID. Caching it internally.
-  const std::string &get_object_id();
+  /** Set the object id and its hash, as computed from the name by codegen.
+   *
+   * The string is not copied and needs to outlive this object, codegen passes a string literal.
+   */
+  void set_object_id(const char *object_id, uint32_t object_id_hash);
+  /// Get the sanitized name of this nameable as an ID. Computed on first use if it was not set.
+  const char *get_object_id();
   uint32_t get_object_id_hash();
 
   bool is_internal() const;
@@ -262,8 +409,11 @@ class Nameable {
   void calc_object_id_();
 
   std::string name_;
-  std::string object_id_;
-  uint32_t object_id_hash_;
+  /// Either a constant from codegen or object_id_buffer_, nullptr until computed.
+  const char *object_id_{nullptr};
+  /// Holds the object id if it was computed at runtime from a name that was not known at build time.
+  std::unique_ptr<char[]> object_id_buffer_;
+  uint32_t object_id_hash_{0};
   bool internal_{false};
 };
 
@@ -22,6 +22,7 @@ from esphome.const import (
     CONF_PLATFORMIO_OPTIONS,
     CONF_PRIORITY,
     CONF_PROJECT,
+    CONF_STATIC_ALLOCATION,
     CONF_TRIGGER_ID,
     CONF_ESP8266_RESTORE_FROM_FLASH,
     ARDUINO_VERSION_ESP8266,
@@ -30,6 +31,7 @@ from esphome.const import (
     ESP_PLATFORMS,
 )
 from esphome.core import CORE, coroutine_with_priority
+import esphome.final_validate as fv
 from esphome.helpers import copy_file_if_changed, walk_files
 
 _LOGGER = logging.getLogger(__name__)
@@ -48,6 +50,20 @@ LoopTrigger = cg.esphome_ns.class_(
 VERSION_REGEX = re.compile(r"^[0-9]+\.[0-9]+\.[0-9]+(?:[ab]\d+)?$")
 
 CONF_NAME_ADD_MAC_SUFFIX = "name_add_mac_suffix"
+CONF_IDLE_LIGHT_SLEEP = "idle_light_sleep"
+CONF_FLASH_WRITE_INTERVAL = "flash_write_interval"
+CONF_RTC_PROMOTE_INTERVAL = "rtc_promote_interval"
+CONF_MIN_SLEEP_DURATION = "min_sleep_duration"
+CONF_LOOP_BUDGET = "loop_budget"
+
+# Components that keep a radio connection which light sleep does not maintain
+LIGHT_SLEEP_CONFLICTS = [
+    "wifi",
+    "ethernet",
+    "esp32_ble_tracker",
+    "esp32_ble_server",
+    "esp32_ble_beacon",
+]
 
 
 def validate_board(value):
@@ -173,6 +189,12 @@ CONFIG_SCHEMA = cv.Schema(
         cv.SplitDefault(CONF_ESP8266_RESTORE_FROM_FLASH, esp8266=False): cv.All(
             cv.only_on_esp8266, cv.boolean
         ),
+        cv.Optional(
+            CONF_FLASH_WRITE_INTERVAL, default="0s"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_RTC_PROMOTE_INTERVAL, default="5min"
+        ): cv.positive_time_period_milliseconds,
         cv.SplitDefault(CONF_BOARD_FLASH_MODE, esp8266="dout"): cv.one_of(
             *BUILD_FLASH_MODES, lower=True
         ),
@@ -195,6 +217,18 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
         cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
         cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+        cv.Optional(CONF_STATIC_ALLOCATION, default=False): cv.boolean,
+        cv.Optional(CONF_LOOP_BUDGET): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_IDLE_LIGHT_SLEEP): cv.All(
+            cv.only_on_esp32,
+            cv.Schema(
+                {
+                    cv.Optional(
+                        CONF_MIN_SLEEP_DURATION, default="5ms"
+                    ): cv.positive_time_period_milliseconds,
+                }
+            ),
+        ),
         cv.Optional(CONF_PROJECT): cv.Schema(
             {
                 cv.Required(CONF_NAME): cv.All(cv.string_strict, valid_project_name),
@@ -204,6 +238,22 @@ CONFIG_SCHEMA = cv.Schema(
     }
 )
 
+def _final_validate(config):
+    if CONF_IDLE_LIGHT_SLEEP not in config:
+        return config
+    full_conf = fv.full_config.get()
+    for domain in LIGHT_SLEEP_CONFLICTS:
+        if domain in full_conf:
+            _LOGGER.warning(
+                "idle_light_sleep does not keep the %s connection alive, the radio is "
+                "powered down whenever the device sleeps.",
+                domain,
+            )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
 PRELOAD_CONFIG_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_NAME): cv.valid_name,
@@ -325,6 +375,13 @@ async def to_code(config):
     if CORE.is_esp8266:
         CORE.add_job(_esp8266_add_lwip_type)
 
+    if CONF_LOOP_BUDGET in config:
+        cg.add(cg.App.set_loop_budget(config[CONF_LOOP_BUDGET]))
+
+    if CONF_IDLE_LIGHT_SLEEP in config:
+        conf = config[CONF_IDLE_LIGHT_SLEEP]
+        cg.add(cg.App.set_idle_light_sleep(conf[CONF_MIN_SLEEP_DURATION]))
+
     cg.add_build_flag("-fno-exceptions")
 
     # Libraries
@@ -340,6 +397,16 @@ async def to_code(config):
     cg.add_build_flag("-Wno-sign-compare")
     if config.get(CONF_ESP8266_RESTORE_FROM_FLASH, False):
         cg.add_define("USE_ESP8266_PREFERENCES_FLASH")
+    cg.add(
+        cg.esphome_ns.global_preferences.set_flash_write_interval(
+            config[CONF_FLASH_WRITE_INTERVAL]
+        )
+    )
+    cg.add(
+        cg.esphome_ns.global_preferences.set_tiered_promote_interval(
+            config[CONF_RTC_PROMOTE_INTERVAL]
+        )
+    )
 
     if config[CONF_INCLUDES]:
         CORE.add_job(add_includes, config[CONF_INCLUDES])
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+// Table-driven CRCs over a buffer, with the running value as optional argument so large or split buffers can be
+// processed in parts. The tables have 16 entries and handle a nibble per step, small enough to stay in RAM.
+
+/// CRC-8 of Sensirion sensors (polynomial 0x31, initial value 0xFF), sent after every 16 bit word.
+uint8_t crc8_sensirion(const uint8_t *data, size_t len, uint8_t crc = 0xFF);
+/// The Sensirion CRC-8 of a 16 bit word, most significant byte first as on the bus.
+inline uint8_t crc8_sensirion(uint16_t word) {
+  const uint8_t data[2] = {uint8_t(word >> 8), uint8_t(word)};
+  return crc8_sensirion(data, 2);
+}
+/// CRC-8 of Maxim/Dallas 1-Wire devices (reflected polynomial 0x8C, initial value 0).
+uint8_t crc8_maxim(const uint8_t *data, size_t len, uint8_t crc = 0);
+/// CRC-16 of Modbus RTU (reflected polynomial 0xA001, initial value 0xFFFF), sent least significant byte first.
+uint16_t crc16_modbus(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF);
+/// CRC-32 of zlib, Ethernet and PNG. Pass the previous result as crc to continue it.
+uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0);
+
+}  // namespace esphome
@@ -1,6 +1,10 @@
 #pragma once
 // This file is auto-generated! Do not edit!
 
+#ifdef USE_HOST
+// The host build in tests/host only compiles the core and some platform independent components
+#define USE_SENSOR
+#else
 #define USE_API
 #define USE_LOGGER
 #define USE_BINARY_SENSOR
@@ -14,13 +18,17 @@
 #define USE_LIGHT
 #define USE_CLIMATE
 #define USE_NUMBER
+#define USE_SENSOR_HISTORY
+#define USE_SPI
 #define USE_MQTT
+#define USE_HTTP_REQUEST
 #define USE_POWER_SUPPLY
 #define USE_HOMEASSISTANT_TIME
 #define USE_JSON
 #ifdef ARDUINO_ARCH_ESP32
 #define USE_ESP32_CAMERA
 #define USE_ESP32_BLE_SERVER
+#define USE_ESP32_BLE_TRACKER
 #define USE_IMPROV
 #endif
 #define USE_TIME
@@ -28,3 +36,4 @@
 #define USE_CAPTIVE_PORTAL
 #define ESPHOME_BOARD "dummy_board"
 #define USE_MDNS
+#endif
@@ -1,5 +1,7 @@
 #include "esphome/core/helpers.h"
+#include "esphome/core/crc.h"
 #include <cstdio>
+#include <cstring>
 #include <algorithm>
 
 #ifdef ARDUINO_ARCH_ESP8266
@@ -11,10 +13,20 @@
 #include "esphome/core/log.h"
 #include "esphome/core/esphal.h"
 
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_heap_caps.h>
+#include <soc/soc_memory_layout.h>
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "helpers";
 
+#ifdef USE_HOST
+/// The host has no MAC address of its own, use a fixed locally administered one.
+static const uint8_t HOST_MAC_ADDRESS[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+#endif
+
 std::string get_mac_address() {
   char tmp[20];
   uint8_t mac[6];
@@ -23,6 +35,9 @@ std::string get_mac_address() {
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
   WiFi.macAddress(mac);
+#endif
+#ifdef USE_HOST
+  memcpy(mac, HOST_MAC_ADDRESS, sizeof(mac));
 #endif
   sprintf(tmp, "%02x%02x%02x%02x%02x%02x", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
   return std::string(tmp);
@@ -36,6 +51,9 @@ std::string get_mac_address_pretty() {
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
   WiFi.macAddress(mac);
+#endif
+#ifdef USE_HOST
+  memcpy(mac, HOST_MAC_ADDRESS, sizeof(mac));
 #endif
   sprintf(tmp, "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
   return std::string(tmp);
@@ -59,7 +77,8 @@ static uint32_t fast_random_seed = 0;  // NOLINT(cppcoreguidelines-avoid-non-con
 
 void fast_random_set_seed(uint32_t seed) { fast_random_seed = seed; }
 uint32_t fast_random_32() {
-  fast_random_seed = (fast_random_seed * 2654435769ULL) + 40503ULL;
+  // 32 bit constants, the result is the same modulo 2^32 without a 64 bit multiplication
+  fast_random_seed = (fast_random_seed * 2654435769UL) + 40503UL;
   return fast_random_seed;
 }
 uint16_t fast_random_16() {
@@ -67,7 +86,7 @@ uint16_t fast_random_16() {
   return (rand32 & 0xFFFF) + (rand32 >> 16);
 }
 uint8_t fast_random_8() {
-  uint8_t rand32 = fast_random_32();
+  uint32_t rand32 = fast_random_32();
   return (rand32 & 0xFF) + ((rand32 >> 8) & 0xFF);
 }
 
@@ -104,12 +123,67 @@ std::string truncate_string(const std::string &s, size_t length) {
   return s;
 }
 
+size_t value_accuracy_to_buf(char *buf, size_t size, float value, int8_t accuracy_decimals) {
+  char tmp[VALUE_ACCURACY_MAX_LEN];
+  size_t len = 0;
+  // Above 2^24 a float has no fractional digits left to round, the double product keeps all digits of the value
+  double scaled = value * powf(10.0f, accuracy_decimals);
+  if (fabs(scaled) < 16777216.0) {
+    scaled = roundf(scaled);
+  } else {
+    scaled = round(double(value) * pow(10.0, accuracy_decimals));
+  }
+  if (!std::isfinite(value)) {
+    const char *text = std::isnan(value) ? "nan" : value < 0 ? "-inf" : "inf";
+    len = strlen(text);
+    memcpy(tmp, text, len);
+  } else if (fabs(scaled) >= 1e18) {
+    // Beyond the integer range, rare enough that the slow path does not matter
+    len = snprintf(tmp, sizeof(tmp), "%.*f", std::max(0, int(accuracy_decimals)), value);
+    len = std::min(len, sizeof(tmp) - 1);
+  } else {
+    uint64_t digits = uint64_t(fabs(scaled));
+    uint8_t decimals = 0;
+    if (accuracy_decimals >= 0) {
+      decimals = accuracy_decimals;
+    } else {
+      for (int8_t i = accuracy_decimals; i < 0 && digits < 1000000000000000000ULL; i++)
+        digits *= 10;
+    }
+    // Written backwards from the end of tmp, with at least one digit in front of the decimal point
+    char *end = tmp + sizeof(tmp);
+    char *pos = end;
+    uint8_t written = 0;
+    while (pos > tmp + 1 && (digits != 0 || written <= decimals)) {
+      if (decimals != 0 && written == decimals)
+        *--pos = '.';
+      // 32 bit division is done in hardware, 64 bit division is not
+      if (digits <= UINT32_MAX) {
+        uint32_t small = digits;
+        *--pos = char('0' + small % 10);
+        digits = small / 10;
+      } else {
+        *--pos = char('0' + digits % 10);
+        digits /= 10;
+      }
+      written++;
+    }
+    if (scaled < 0)
+      *--pos = '-';
+    len = end - pos;
+    memmove(tmp, pos, len);
+  }
+  if (size == 0)
+    return 0;
+  len = std::min(len, size - 1);
+  memcpy(buf, tmp, len);
+  buf[len] = '\0';
+  return len;
+}
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals) {
-  auto multiplier = float(powf(10.0f, accuracy_decimals));
-  float value_rounded = roundf(value * multiplier) / multiplier;
-  char tmp[32];  // should be enough, but we should maybe improve this at some point.
-  dtostrf(value_rounded, 0, uint8_t(std::max(0, int(accuracy_decimals))), tmp);
-  return std::string(tmp);
+  char buf[VALUE_ACCURACY_MAX_LEN];
+  size_t len = value_accuracy_to_buf(buf, sizeof(buf), value, accuracy_decimals);
+  return std::string(buf, len);
 }
 std::string uint64_to_string(uint64_t num) {
   char buffer[17];
@@ -156,21 +230,7 @@ ParseOnOffState parse_on_off(const char *str, const char *on, const char *off) {
 
 const char *const HOSTNAME_CHARACTER_ALLOWLIST = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_";
 
-uint8_t crc8(uint8_t *data, uint8_t len) {
-  uint8_t crc = 0;
-
-  while ((len--) != 0u) {
-    uint8_t inbyte = *data++;
-    for (uint8_t i = 8; i != 0u; i--) {
-      bool mix = (crc ^ inbyte) & 0x01;
-      crc >>= 1;
-      if (mix)
-        crc ^= 0x8C;
-      inbyte >>= 1;
-    }
-  }
-  return crc;
-}
+uint8_t crc8(uint8_t *data, uint8_t len) { return crc8_maxim(data, len); }
 
 void delay_microseconds_accurate(uint32_t usec) {
   if (usec == 0)
@@ -263,6 +323,22 @@ uint32_t fnv1_hash(const std::string &str) {
   }
   return hash;
 }
+uint32_t fnv1_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  for (; *str != '\0'; str++) {
+    hash *= 16777619UL;
+    hash ^= *str;
+  }
+  return hash;
+}
+uint32_t fnv1_hash(const char *str, size_t length) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < length; i++) {
+    hash *= 16777619UL;
+    hash ^= str[i];
+  }
+  return hash;
+}
 bool str_equals_case_insensitive(const std::string &a, const std::string &b) {
   return strcasecmp(a.c_str(), b.c_str()) == 0;
 }
@@ -340,4 +416,52 @@ ICACHE_RAM_ATTR InterruptLock::InterruptLock() { portDISABLE_INTERRUPTS(); }
 ICACHE_RAM_ATTR InterruptLock::~InterruptLock() { portENABLE_INTERRUPTS(); }
 #endif
 
+LargeBufferUsage *LargeBufferUsage::first_ = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void *large_buffer_allocate(size_t size, LargeBufferUsage *usage, LargeBufferPlacement placement) {
+  void *buffer = nullptr;
+#ifdef ARDUINO_ARCH_ESP32
+  const bool psram =
+      placement == LARGE_BUFFER_PSRAM || (placement == LARGE_BUFFER_AUTO && size >= LARGE_BUFFER_PSRAM_THRESHOLD);
+  if (psram && psramFound())
+    buffer = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (buffer == nullptr && placement == LARGE_BUFFER_DMA)
+    buffer = heap_caps_malloc(size, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+  else if (buffer == nullptr)
+    buffer = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+  buffer = malloc(size);  // NOLINT(cppcoreguidelines-no-malloc)
+#endif
+  if (buffer == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate %zu bytes for %s", size, usage != nullptr ? usage->name_ : "a buffer");
+    return nullptr;
+  }
+  if (usage != nullptr) {
+#ifdef ARDUINO_ARCH_ESP32
+    if (esp_ptr_external_ram(buffer)) {
+      usage->psram_ += size;
+      return buffer;
+    }
+#endif
+    usage->internal_ += size;
+  }
+  return buffer;
+}
+void large_buffer_free(void *buffer, size_t size, LargeBufferUsage *usage) {
+  if (buffer == nullptr)
+    return;
+  if (usage != nullptr) {
+#ifdef ARDUINO_ARCH_ESP32
+    if (esp_ptr_external_ram(buffer)) {
+      usage->psram_ -= size;
+    } else {
+      usage->internal_ -= size;
+    }
+#else
+    usage->internal_ -= size;
+#endif
+  }
+  free(buffer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
 }  // namespace esphome
@@ -4,6 +4,7 @@
 #include <functional>
 #include <vector>
 #include <memory>
+#include <new>
 #include <type_traits>
 
 #include "esphome/core/optional.h"
@@ -117,7 +118,18 @@ uint8_t fast_random_8();
 /// Applies gamma correction with the provided gamma to value.
 float gamma_correct(float value, float gamma);
 
-/// Create a string from a value and an accuracy in decimals.
+/// Buffer size that fits every result of value_accuracy_to_buf() with its null terminator.
+const size_t VALUE_ACCURACY_MAX_LEN = 32;
+
+/** Write `value` rounded to `accuracy_decimals` decimals into `buf`, returns the length without the terminator.
+ *
+ * Formats an integer scaled by the power of ten instead of going through the float printf of libc, which is slow
+ * on the ESP8266, and never allocates. A negative accuracy rounds to tens, hundreds and so on. The output is
+ * truncated to `size` - 1 characters and always null terminated if `size` is not 0.
+ */
+size_t value_accuracy_to_buf(char *buf, size_t size, float value, int8_t accuracy_decimals);
+
+/// Create a string from a value and an accuracy in decimals, see value_accuracy_to_buf().
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals);
 
 /// Convert a uint64_t to a hex string
@@ -173,7 +185,7 @@ class InterruptLock {
 #endif
 };
 
-/// Calculate a crc8 of data with the provided data length.
+/// Calculate the Maxim/Dallas crc8 of data with the provided data length, see crc8_maxim() in crc.h.
 uint8_t crc8(uint8_t *data, uint8_t len);
 
 enum ParseOnOffState {
@@ -201,23 +213,87 @@ template<typename T, enable_if_t<std::is_pointer<T *>::value, int> = 0> T &id(T
 
 template<typename... X> class CallbackManager;
 
+/// std::is_trivially_copyable, which isn't available in the libstdc++ of the ESP8266 toolchain.
+template<typename T>
+struct is_trivially_copyable  // NOLINT
+#if defined(__GNUC__) && __GNUC__ < 5 && !defined(__clang__)
+    : std::integral_constant<bool, __has_trivial_copy(T) && std::is_trivially_destructible<T>::value> {
+};
+#else
+    : std::is_trivially_copyable<T> {
+};
+#endif
+
 /** Simple helper class to allow having multiple subscribers to a signal.
+ *
+ * Every callback is stored as a function pointer plus two pointers of storage. Callables that fit in there and are
+ * trivially copyable, like lambdas capturing only `this` and another pointer, are kept inline without an
+ * allocation, bigger ones (for example a std::function) are moved to the heap.
  *
  * @tparam Ts The arguments for the callback, wrapped in void().
  */
 template<typename... Ts> class CallbackManager<void(Ts...)> {
  public:
+  CallbackManager() = default;
+  CallbackManager(const CallbackManager &) = delete;
+  CallbackManager &operator=(const CallbackManager &) = delete;
+  ~CallbackManager() {
+    while (this->heap_ != nullptr) {
+      HeapCallbackBase *next = this->heap_->next;
+      delete this->heap_;
+      this->heap_ = next;
+    }
+  }
+
   /// Add a callback to the internal callback list.
-  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  template<typename F> void add(F &&callback) {
+    Callback entry;
+    this->store_<typename std::decay<F>::type>(entry, std::forward<F>(callback));
+    this->callbacks_.push_back(entry);
+  }
 
   /// Call all callbacks in this manager.
   void call(Ts... args) {
     for (auto &cb : this->callbacks_)
-      cb(args...);
+      cb.invoke(cb.storage, args...);
   }
 
  protected:
-  std::vector<std::function<void(Ts...)>> callbacks_;
+  struct Callback {
+    void (*invoke)(void *storage, Ts... args);
+    alignas(void *) uint8_t storage[2 * sizeof(void *)];
+  };
+  /// Callables that don't fit inline, chained so that they can be freed again.
+  struct HeapCallbackBase {
+    virtual ~HeapCallbackBase() = default;
+    HeapCallbackBase *next{nullptr};
+  };
+  template<typename T> struct HeapCallback : HeapCallbackBase {
+    template<typename F> explicit HeapCallback(F &&callable) : callable(std::forward<F>(callable)) {}
+    T callable;
+  };
+
+  template<typename T>
+  using fits_inline = std::integral_constant<bool, sizeof(T) <= sizeof(Callback::storage) &&
+                                                       alignof(T) <= alignof(void *) &&
+                                                       is_trivially_copyable<T>::value>;
+
+  template<typename T, typename F, enable_if_t<fits_inline<T>::value, int> = 0> void store_(Callback &entry, F &&cb) {
+    new (entry.storage) T(std::forward<F>(cb));
+    entry.invoke = [](void *storage, Ts... args) { (*reinterpret_cast<T *>(storage))(args...); };
+  }
+  template<typename T, typename F, enable_if_t<!fits_inline<T>::value, int> = 0> void store_(Callback &entry, F &&cb) {
+    auto *heap = new HeapCallback<T>(std::forward<F>(cb));
+    heap->next = this->heap_;
+    this->heap_ = heap;
+    new (entry.storage) HeapCallback<T> *(heap);
+    entry.invoke = [](void *storage, Ts... args) {
+      (*reinterpret_cast<HeapCallback<T> **>(storage))->callable(args...);
+    };
+  }
+
+  std::vector<Callback> callbacks_;
+  HeapCallbackBase *heap_{nullptr};
 };
 
 // https://stackoverflow.com/a/37161919/8924614
@@ -243,7 +319,7 @@ template<typename T, typename... X> class TemplatableValue {
 
   bool has_value() { return this->type_ != EMPTY; }
 
-  T value(X... x) {
+  T value(const X &... x) {
     if (this->type_ == LAMBDA) {
       return this->f_(x...);
     }
@@ -251,20 +327,25 @@ template<typename T, typename... X> class TemplatableValue {
     return this->value_;
   }
 
-  optional<T> optional_value(X... x) {
+  optional<T> optional_value(const X &... x) {
     if (!this->has_value()) {
       return {};
     }
     return this->value(x...);
   }
 
-  T value_or(X... x, T default_value) {
+  T value_or(const X &... x, T default_value) {
     if (!this->has_value()) {
       return default_value;
     }
     return this->value(x...);
   }
 
+  /// Whether value() calls a lambda, otherwise it always returns get_static_value().
+  bool is_lambda() const { return this->type_ == LAMBDA; }
+  /// The value that isn't computed by a lambda, to read it without a copy.
+  const T &get_static_value() const { return this->value_; }
+
  protected:
   enum {
     EMPTY,
@@ -320,7 +401,67 @@ template<typename T> class Parented {
   T *parent_{nullptr};
 };
 
+/** Fixed capacity FIFO of values in a single contiguous allocation, made once when the capacity is set.
+ *
+ * Unlike std::deque, which allocates blocks of 512 bytes even for a handful of values, the storage is exactly
+ * capacity elements. Index 0 is the oldest element.
+ */
+template<typename T> class RingBuffer {
+ public:
+  RingBuffer() = default;
+  explicit RingBuffer(size_t capacity) { this->set_capacity(capacity); }
+
+  /// Set the capacity, this removes all elements.
+  void set_capacity(size_t capacity) {
+    this->data_.reset(capacity > 0 ? new T[capacity] : nullptr);  // NOLINT
+    this->capacity_ = capacity;
+    this->clear();
+  }
+  size_t capacity() const { return this->capacity_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->capacity_; }
+  void clear() {
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+
+  /// Append a value, if the buffer is full the oldest value is dropped.
+  void push_back(const T &value) {
+    if (this->full()) {
+      if (this->capacity_ == 0)
+        return;
+      this->pop_front();
+    }
+    this->size_++;
+    this->back() = value;
+  }
+  void pop_front() {
+    this->head_ = this->wrap_(this->head_ + 1);
+    this->size_--;
+  }
+  void pop_back() { this->size_--; }
+
+  T &operator[](size_t i) { return this->data_[this->wrap_(this->head_ + i)]; }
+  const T &operator[](size_t i) const { return this->data_[this->wrap_(this->head_ + i)]; }
+  T &front() { return (*this)[0]; }
+  const T &front() const { return (*this)[0]; }
+  T &back() { return (*this)[this->size_ - 1]; }
+  const T &back() const { return (*this)[this->size_ - 1]; }
+
+ protected:
+  size_t wrap_(size_t i) const { return i >= this->capacity_ ? i - this->capacity_ : i; }
+
+  std::unique_ptr<T[]> data_;
+  size_t capacity_{0};
+  size_t head_{0};
+  size_t size_{0};
+};
+
 uint32_t fnv1_hash(const std::string &str);
+uint32_t fnv1_hash(const char *str);
+/// The hash of the first length characters of str, the same as fnv1_hash(std::string(str, length)).
+uint32_t fnv1_hash(const char *str, size_t length);
 
 template<typename T> T *new_buffer(size_t length) {
   T *buffer;
@@ -337,4 +478,82 @@ template<typename T> T *new_buffer(size_t length) {
   return buffer;
 }
 
+/// Where large_buffer_allocate() places a buffer.
+enum LargeBufferPlacement : uint8_t {
+  /// PSRAM if the buffer has at least LARGE_BUFFER_PSRAM_THRESHOLD bytes and the ESP32 has PSRAM, internal otherwise.
+  LARGE_BUFFER_AUTO = 0,
+  /// PSRAM whenever possible, for buffers that would take internal RAM WiFi and TLS need.
+  LARGE_BUFFER_PSRAM,
+  LARGE_BUFFER_INTERNAL,
+  /// Internal RAM the DMA controllers can access, for buffers SPI, I2S or the camera transfer directly.
+  LARGE_BUFFER_DMA,
+};
+
+/// Smaller buffers stay in internal RAM with LARGE_BUFFER_AUTO, PSRAM is slower and allocates in larger blocks.
+static const size_t LARGE_BUFFER_PSRAM_THRESHOLD = 1024;
+
+/** The bytes one component has allocated with large_buffer_allocate(), in internal RAM and in PSRAM.
+ *
+ * Defined as a static object by the component, all of them form a list for the debug component to log.
+ */
+class LargeBufferUsage {
+ public:
+  explicit LargeBufferUsage(const char *name) : name_(name), next_(first_) { first_ = this; }
+
+  const char *get_name() const { return this->name_; }
+  size_t get_internal() const { return this->internal_; }
+  size_t get_psram() const { return this->psram_; }
+  const LargeBufferUsage *get_next() const { return this->next_; }
+  static const LargeBufferUsage *get_first() { return first_; }
+
+ protected:
+  friend void *large_buffer_allocate(size_t size, LargeBufferUsage *usage, LargeBufferPlacement placement);
+  friend void large_buffer_free(void *buffer, size_t size, LargeBufferUsage *usage);
+
+  const char *name_;
+  LargeBufferUsage *next_;
+  size_t internal_{0};
+  size_t psram_{0};
+  static LargeBufferUsage *first_;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+};
+
+/** Allocate a buffer of size bytes with malloc() semantics, placed in internal RAM or PSRAM as requested.
+ *
+ * If PSRAM is requested but missing or full, internal RAM is used. Returns nullptr if there's no memory left, the
+ * buffer must be freed with large_buffer_free() with the same size and usage.
+ */
+void *large_buffer_allocate(size_t size, LargeBufferUsage *usage, LargeBufferPlacement placement = LARGE_BUFFER_AUTO);
+void large_buffer_free(void *buffer, size_t size, LargeBufferUsage *usage);
+
+/** Allocator for standard containers that allocates through large_buffer_allocate().
+ *
+ * For example `std::vector<uint8_t, LargeBufferAllocator<uint8_t>> buffer_{LargeBufferAllocator<uint8_t>(&USAGE)};`
+ */
+template<typename T> class LargeBufferAllocator {
+ public:
+  using value_type = T;
+
+  explicit LargeBufferAllocator(LargeBufferUsage *usage, LargeBufferPlacement placement = LARGE_BUFFER_AUTO)
+      : usage_(usage), placement_(placement) {}
+  template<typename U>
+  LargeBufferAllocator(const LargeBufferAllocator<U> &other)  // NOLINT(google-explicit-constructor)
+      : usage_(other.usage_), placement_(other.placement_) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(large_buffer_allocate(n * sizeof(T), this->usage_, this->placement_));
+  }
+  void deallocate(T *p, size_t n) { large_buffer_free(p, n * sizeof(T), this->usage_); }
+
+  template<typename U> bool operator==(const LargeBufferAllocator<U> &other) const {
+    return this->usage_ == other.usage_ && this->placement_ == other.placement_;
+  }
+  template<typename U> bool operator!=(const LargeBufferAllocator<U> &other) const { return !(*this == other); }
+
+ protected:
+  template<typename U> friend class LargeBufferAllocator;
+
+  LargeBufferUsage *usage_;
+  LargeBufferPlacement placement_;
+};
+
 }  // namespace esphome
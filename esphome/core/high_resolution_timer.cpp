@@ -0,0 +1,188 @@
+#include "esphome/core/high_resolution_timer.h"
+#include "esphome/core/application.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+
+#ifdef ARDUINO_ARCH_ESP8266
+#include <core_esp8266_waveform.h>
+#endif
+
+namespace esphome {
+
+static const char *const TAG = "high_resolution_timer";
+
+HighResolutionTimer::~HighResolutionTimer() {
+  this->stop();
+#ifdef ARDUINO_ARCH_ESP32
+  if (this->handle_ != nullptr)
+    esp_timer_delete(this->handle_);
+#endif
+}
+
+void HighResolutionTimer::start_once(uint32_t delay_us) { this->start_(delay_us, 0); }
+void HighResolutionTimer::start_periodic(uint32_t period_us) { this->start_(period_us, period_us); }
+
+void ICACHE_RAM_ATTR HighResolutionTimer::expire_() {
+  if (this->isr_func_ != nullptr) {
+    this->isr_func_(this->isr_arg_);
+    return;
+  }
+  // Only the timer context sets pending_ and only the main loop clears it, so no read-modify-write is needed
+  if (this->pending_.load(std::memory_order_acquire) ||
+      !App.defer_from_isr(reinterpret_cast<void (*)(void *)>(&HighResolutionTimer::call_deferred_), this)) {
+    this->missed_.store(this->missed_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return;
+  }
+  this->pending_.store(true, std::memory_order_release);
+}
+
+void HighResolutionTimer::call_deferred_(HighResolutionTimer *timer) {
+  if (!timer->pending_.load(std::memory_order_acquire))
+    return;  // Stopped since
+  timer->pending_.store(false, std::memory_order_release);
+  if (timer->callback_)
+    timer->callback_();
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+void HighResolutionTimer::start_(uint32_t delay_us, uint32_t period_us) {
+  if (this->handle_ == nullptr) {
+    esp_timer_create_args_t args = {};
+    args.callback = &HighResolutionTimer::esp_timer_callback_;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "esphome";
+    esp_err_t err = esp_timer_create(&args, &this->handle_);
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "esp_timer_create failed: %d", err);
+      this->handle_ = nullptr;
+      return;
+    }
+  }
+  esp_timer_stop(this->handle_);
+  this->periodic_ = period_us != 0;
+  this->running_ = true;
+  esp_err_t err = this->periodic_ ? esp_timer_start_periodic(this->handle_, period_us)
+                                  : esp_timer_start_once(this->handle_, delay_us);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Starting the timer failed: %d", err);
+    this->running_ = false;
+  }
+}
+
+void HighResolutionTimer::stop() {
+  if (this->handle_ != nullptr)
+    esp_timer_stop(this->handle_);
+  this->running_ = false;
+  this->pending_.store(false, std::memory_order_release);
+}
+
+void HighResolutionTimer::esp_timer_callback_(void *arg) {
+  auto *timer = reinterpret_cast<HighResolutionTimer *>(arg);
+  if (!timer->periodic_)
+    timer->running_ = false;
+  timer->expire_();
+}
+#endif
+
+#ifdef USE_HOST
+// The host build has no timer to run them on, the benchmarks only need the code to link
+void HighResolutionTimer::start_(uint32_t delay_us, uint32_t period_us) {}
+void HighResolutionTimer::stop() {
+  this->running_ = false;
+  this->pending_.store(false, std::memory_order_release);
+}
+#endif
+
+#ifdef ARDUINO_ARCH_ESP8266
+/// Longest wait programmed into timer1 while no timer expires sooner, also when none is running.
+static const uint32_t MAX_TIMER1_WAIT_US = 10000;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+HighResolutionTimer *HighResolutionTimer::first_ = nullptr;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+bool HighResolutionTimer::timer1_attached_ = false;
+
+void HighResolutionTimer::start_(uint32_t delay_us, uint32_t period_us) {
+  InterruptLock lock;
+  this->unlink_();
+  this->deadline_ = micros() + delay_us;
+  this->period_ = period_us;
+  this->running_ = true;
+  this->link_();
+  if (!timer1_attached_) {
+    timer1_attached_ = true;
+    setTimer1Callback(&HighResolutionTimer::timer1_callback_);
+  }
+  if (first_ == this) {
+    // timer1 may be programmed for a later deadline, interrupt right away to reprogram it
+    timer1_write(microsecondsToClockCycles(1));
+  }
+}
+
+void HighResolutionTimer::stop() {
+  {
+    InterruptLock lock;
+    this->unlink_();
+    this->running_ = false;
+  }
+  this->pending_.store(false, std::memory_order_release);
+}
+
+void ICACHE_RAM_ATTR HighResolutionTimer::link_() {
+  HighResolutionTimer **it = &first_;
+  while (*it != nullptr && int32_t((*it)->deadline_ - this->deadline_) <= 0)
+    it = &(*it)->next_;
+  this->next_ = *it;
+  *it = this;
+}
+
+void ICACHE_RAM_ATTR HighResolutionTimer::unlink_() {
+  for (HighResolutionTimer **it = &first_; *it != nullptr; it = &(*it)->next_) {
+    if (*it == this) {
+      *it = this->next_;
+      this->next_ = nullptr;
+      return;
+    }
+  }
+}
+
+uint32_t ICACHE_RAM_ATTR HighResolutionTimer::timer1_callback_() {
+  uint32_t now = micros();
+  while (first_ != nullptr && int32_t(first_->deadline_ - now) <= 0) {
+    HighResolutionTimer *timer = first_;
+    first_ = timer->next_;
+    timer->next_ = nullptr;
+    if (timer->period_ != 0) {
+      timer->deadline_ += timer->period_;
+      // Skip the periods that were missed instead of firing for each of them
+      if (int32_t(timer->deadline_ - now) <= 0)
+        timer->deadline_ = now + timer->period_;
+      timer->link_();
+    } else {
+      timer->running_ = false;
+    }
+    timer->expire_();
+    now = micros();
+  }
+
+  if (first_ == nullptr) {
+    // Detaching from timer1 is not safe in its interrupt, let the main loop do it unless a timer is started before
+    if (timer1_attached_) {
+      timer1_attached_ = false;
+      App.defer_from_isr(&HighResolutionTimer::release_timer1_, nullptr);
+    }
+    return microsecondsToClockCycles(MAX_TIMER1_WAIT_US);
+  }
+  const uint32_t wait = std::min(std::max<uint32_t>(first_->deadline_ - now, 1), MAX_TIMER1_WAIT_US);
+  return microsecondsToClockCycles(wait);
+}
+
+void HighResolutionTimer::release_timer1_(void *arg) {
+  InterruptLock lock;
+  if (!timer1_attached_)
+    setTimer1Callback(nullptr);
+}
+#endif
+
+}  // namespace esphome
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include "esphome/core/helpers.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_timer.h>
+#endif
+
+namespace esphome {
+
+/** A microsecond timer for sampling and waveform code that needs finer or steadier timing than the Scheduler.
+ *
+ * It runs on esp_timer on the ESP32 and shares timer1 with the waveform generator of the Arduino core on the
+ * ESP8266 (through setTimer1Callback()), so it does not conflict with the esp8266_pwm output. Every
+ * expiration is dispatched one of two ways:
+ *
+ * - With set_isr_callback(), in the timer context: the esp_timer task on the ESP32 (above all other tasks, but
+ *   concurrent with the main loop on the other core) and the timer1 interrupt on the ESP8266. The function and
+ *   everything it calls must be ICACHE_RAM_ATTR and must not block, allocate or log.
+ * - With set_callback(), from the main loop at the start of its next iteration, like App.defer_from_isr(). Its
+ *   jitter is bounded by the loop, and expirations before it runs are merged into one call.
+ *
+ * The owner must outlive the timer, usually by embedding it as a member of a component.
+ */
+class HighResolutionTimer {
+ public:
+  HighResolutionTimer() = default;
+  HighResolutionTimer(const HighResolutionTimer &) = delete;
+  HighResolutionTimer &operator=(const HighResolutionTimer &) = delete;
+  ~HighResolutionTimer();
+
+  /// Call `callback` from the main loop after each expiration.
+  void set_callback(std::function<void()> &&callback) { this->callback_ = std::move(callback); }
+  /// Call `func(arg)` in the timer context on each expiration, see the class documentation for its restrictions.
+  template<typename T> void set_isr_callback(void (*func)(T *), T *arg) {
+    this->isr_func_ = reinterpret_cast<void (*)(void *)>(func);
+    this->isr_arg_ = arg;
+  }
+
+  /// (Re)start the timer to expire once in `delay_us` microseconds.
+  void start_once(uint32_t delay_us);
+  /// (Re)start the timer to expire every `period_us` microseconds, the first time one period from now.
+  void start_periodic(uint32_t period_us);
+  /// Stop the timer, a deferred callback of an expiration before is not called anymore.
+  void stop();
+  bool is_running() const { return this->running_; }
+
+  /// Number of expirations that were merged into the deferred callback of an earlier one because the loop was busy.
+  uint32_t get_missed_count() const { return this->missed_.load(std::memory_order_relaxed); }
+
+ protected:
+  void start_(uint32_t delay_us, uint32_t period_us);
+  /// Dispatch an expiration, in the timer context.
+  void expire_();
+  static void call_deferred_(HighResolutionTimer *timer);
+
+  std::function<void()> callback_;
+  void (*isr_func_)(void *){nullptr};
+  void *isr_arg_{nullptr};
+  volatile bool running_{false};
+  /// A deferred callback is queued in App and was not called yet.
+  std::atomic<bool> pending_{false};
+  std::atomic<uint32_t> missed_{0};
+
+#ifdef ARDUINO_ARCH_ESP32
+  static void esp_timer_callback_(void *arg);
+
+  esp_timer_handle_t handle_{nullptr};
+  bool periodic_{false};
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+  static uint32_t timer1_callback_();
+  static void release_timer1_(void *arg);
+  void link_();
+  void unlink_();
+
+  /// The running timers sorted by deadline, all of them share timer1.
+  static HighResolutionTimer *first_;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  static bool timer1_attached_;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  HighResolutionTimer *next_{nullptr};
+  uint32_t deadline_{0};
+  uint32_t period_{0};
+#endif
+};
+
+}  // namespace esphome
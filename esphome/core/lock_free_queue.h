@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+/** A fixed capacity multi-producer single-consumer queue that never blocks or allocates.
+ *
+ * Elements can be pushed from any context, including ISRs and other FreeRTOS tasks, and are popped
+ * from a single consumer, typically a loop() method. Each slot carries a sequence number that marks
+ * whether it is free or holds an element for the current lap, so producers only contend on the
+ * write position (Vyukov's bounded queue). When the queue is full, push() fails and the overflow
+ * counter is incremented instead of waiting for the consumer.
+ *
+ * The ESP8266 has no compare-and-swap instruction and a single core, so producers briefly disable
+ * interrupts there instead.
+ *
+ * @tparam T The element type, must be cheap to copy (for example a pointer).
+ * @tparam SIZE The capacity, must be a power of two.
+ */
+template<typename T, size_t SIZE> class LockFreeQueue {
+  static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "LockFreeQueue size must be a power of two");
+
+ public:
+  LockFreeQueue() {
+    for (size_t i = 0; i < SIZE; i++)
+      this->cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  /// Push an element, returns false (and counts an overflow) if the queue is full.
+  bool ICACHE_RAM_ATTR push(const T &element) {
+#ifdef ARDUINO_ARCH_ESP8266
+    InterruptLock lock;
+    uint32_t pos = this->write_pos_.load(std::memory_order_relaxed);
+    Cell *cell = &this->cells_[pos & (SIZE - 1)];
+    if (cell->sequence.load(std::memory_order_acquire) != pos) {
+      this->overflow_count_.store(this->overflow_count_.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
+      return false;
+    }
+    this->write_pos_.store(pos + 1, std::memory_order_relaxed);
+#else
+    uint32_t pos = this->write_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = &this->cells_[pos & (SIZE - 1)];
+      uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+      int32_t diff = int32_t(sequence - pos);
+      if (diff == 0) {
+        // Slot is free for this lap, try to claim it
+        if (this->write_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        // Slot still holds an element from the previous lap
+        this->overflow_count_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        // Another producer claimed this slot first
+        pos = this->write_pos_.load(std::memory_order_relaxed);
+      }
+    }
+#endif
+    cell->data = element;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Pop the oldest element into `element`, returns false if the queue is empty. Single consumer only.
+  bool pop(T &element) {
+    Cell *cell = &this->cells_[this->read_pos_ & (SIZE - 1)];
+    if (cell->sequence.load(std::memory_order_acquire) != this->read_pos_ + 1)
+      return false;
+    element = cell->data;
+    cell->sequence.store(this->read_pos_ + SIZE, std::memory_order_release);
+    this->read_pos_++;
+    return true;
+  }
+
+  /// Whether there is (probably) nothing to pop. Only meaningful in the consumer.
+  bool empty() const {
+    const Cell *cell = &this->cells_[this->read_pos_ & (SIZE - 1)];
+    return cell->sequence.load(std::memory_order_acquire) != this->read_pos_ + 1;
+  }
+
+  /// Number of elements that were dropped because the queue was full.
+  uint32_t get_overflow_count() const { return this->overflow_count_.load(std::memory_order_relaxed); }
+
+ protected:
+  struct Cell {
+    std::atomic<uint32_t> sequence;
+    T data;
+  };
+
+  Cell cells_[SIZE];
+  std::atomic<uint32_t> write_pos_{0};
+  uint32_t read_pos_{0};
+  std::atomic<uint32_t> overflow_count_{0};
+};
+
+}  // namespace esphome
@@ -11,6 +11,7 @@ extern "C" {
 #ifdef ARDUINO_ARCH_ESP32
 #include "nvs.h"
 #include "nvs_flash.h"
+#include <esp_attr.h>
 #endif
 
 namespace esphome {
@@ -33,6 +34,14 @@ bool ESPPreferenceObject::load_() {
     return false;
 
   bool valid = this->data_[this->length_words_] == this->calculate_crc_();
+  if (!valid && this->tiered_index_ >= 0) {
+    // RTC memory was lost, fall back to the last value promoted to flash
+    ESPPreferenceObject &flash = global_preferences.tiered_[this->tiered_index_].flash;
+    if (flash.load_()) {
+      memcpy(this->data_, flash.data_, (this->length_words_ + 1) * 4);
+      return true;
+    }
+  }
 
   ESP_LOGVV(TAG, "LOAD %u: valid=%s, 0=0x%08X 1=0x%08X (Type=%u, CRC=0x%08X)", this->offset_,  // NOLINT
             YESNO(valid), this->data_[0], this->data_[1], this->type_, this->calculate_crc_());
@@ -47,6 +56,8 @@ bool ESPPreferenceObject::save_() {
   this->data_[this->length_words_] = this->calculate_crc_();
   if (!this->save_internal_())
     return false;
+  if (this->tiered_index_ >= 0)
+    global_preferences.on_tiered_save_(this->tiered_index_);
   ESP_LOGVV(TAG, "SAVE %u: 0=0x%08X 1=0x%08X (Type=%u, CRC=0x%08X)", this->offset_,  // NOLINT
             this->data_[0], this->data_[1], this->type_, this->calculate_crc_());
   return true;
@@ -100,31 +111,76 @@ static const uint32_t get_esp8266_flash_sector() {
 }
 static const uint32_t get_esp8266_flash_address() { return get_esp8266_flash_sector() * SPI_FLASH_SEC_SIZE; }
 
+/* The preferences sector is used as a log of snapshots of flash_storage_ to spread the wear: each save writes
+ * the next slot and only when all slots are used the sector is erased. A slot is
+ *   [magic][sequence][crc][ESP8266_FLASH_STORAGE_SIZE words of data]
+ * and the magic is written last, so a save interrupted by a reset is never picked up.
+ */
+static const uint32_t ESP8266_FLASH_SLOT_MAGIC = 0xE5F10A5E;
+static const uint32_t ESP8266_FLASH_SLOT_HEADER_SIZE = 3;
+static const uint32_t ESP8266_FLASH_SLOT_SIZE = ESP8266_FLASH_SLOT_HEADER_SIZE + ESP8266_FLASH_STORAGE_SIZE;
+static const uint32_t ESP8266_FLASH_SLOT_COUNT = SPI_FLASH_SEC_SIZE / 4 / ESP8266_FLASH_SLOT_SIZE;
+
+static uint32_t esp8266_flash_slot_crc(uint32_t sequence, const uint32_t *data) {
+  uint32_t crc = sequence;
+  for (uint32_t i = 0; i < ESP8266_FLASH_STORAGE_SIZE; i++) {
+    crc ^= (data[i] * 2654435769UL) >> 1;
+    crc = (crc << 1) | (crc >> 31);
+  }
+  return crc;
+}
+
 void ESPPreferences::save_esp8266_flash_() {
   if (!esp8266_flash_dirty)
     return;
 
-  ESP_LOGVV(TAG, "Saving preferences to flash...");
-  SpiFlashOpResult erase_res, write_res = SPI_FLASH_RESULT_OK;
+  ESP_LOGVV(TAG, "Saving preferences to flash slot %u...", this->flash_next_slot_);
+  bool erase = this->flash_next_slot_ >= ESP8266_FLASH_SLOT_COUNT;
+  uint32_t slot = erase ? 0 : this->flash_next_slot_;
+  uint32_t address = get_esp8266_flash_address() + slot * ESP8266_FLASH_SLOT_SIZE * 4;
+  uint32_t header[ESP8266_FLASH_SLOT_HEADER_SIZE] = {
+      ESP8266_FLASH_SLOT_MAGIC,
+      this->flash_sequence_ + 1,
+      esp8266_flash_slot_crc(this->flash_sequence_ + 1, this->flash_storage_),
+  };
+
+  SpiFlashOpResult erase_res = SPI_FLASH_RESULT_OK, write_res = SPI_FLASH_RESULT_OK;
   {
     InterruptLock lock;
-    erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
+    if (erase)
+      erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
     if (erase_res == SPI_FLASH_RESULT_OK) {
-      write_res = spi_flash_write(get_esp8266_flash_address(), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
+      write_res = spi_flash_write(address + 4, &header[1], (ESP8266_FLASH_SLOT_HEADER_SIZE - 1) * 4);
+      if (write_res == SPI_FLASH_RESULT_OK)
+        write_res = spi_flash_write(address + ESP8266_FLASH_SLOT_HEADER_SIZE * 4, this->flash_storage_,
+                                    ESP8266_FLASH_STORAGE_SIZE * 4);
+      if (write_res == SPI_FLASH_RESULT_OK)
+        write_res = spi_flash_write(address, &header[0], 4);
     }
   }
   if (erase_res != SPI_FLASH_RESULT_OK) {
     ESP_LOGV(TAG, "Erase ESP8266 flash failed!");
     return;
   }
+  // The slot is used now even if writing failed, it isn't erased anymore
+  this->flash_next_slot_ = slot + 1;
   if (write_res != SPI_FLASH_RESULT_OK) {
     ESP_LOGV(TAG, "Write ESP8266 flash failed!");
     return;
   }
 
+  this->flash_sequence_++;
+  this->flash_write_count_++;
   esp8266_flash_dirty = false;
 }
 
+void ESPPreferences::sync() {
+  this->flash_write_pending_ = false;
+  this->last_flash_write_ = millis();
+  this->promote_tiered_();
+  this->save_esp8266_flash_();
+}
+
 bool ESPPreferenceObject::save_internal_() {
   if (this->in_flash_) {
     for (uint32_t i = 0; i <= this->length_words_; i++) {
@@ -137,7 +193,8 @@ bool ESPPreferenceObject::save_internal_() {
         esp8266_flash_dirty = true;
       *ptr = v;
     }
-    global_preferences.save_esp8266_flash_();
+    if (esp8266_flash_dirty)
+      global_preferences.request_sync_();
     return true;
   }
 
@@ -176,9 +233,43 @@ void ESPPreferences::begin() {
   this->flash_storage_ = new uint32_t[ESP8266_FLASH_STORAGE_SIZE];
   ESP_LOGVV(TAG, "Loading preferences from flash...");
 
+  // Find the valid slot with the highest sequence number, new saves go after the last slot that isn't erased
+  int32_t best_slot = -1;
+  this->flash_sequence_ = 0;
+  this->flash_next_slot_ = 0;
+  uint32_t header[ESP8266_FLASH_SLOT_HEADER_SIZE];
+  for (uint32_t slot = 0; slot < ESP8266_FLASH_SLOT_COUNT; slot++) {
+    uint32_t address = get_esp8266_flash_address() + slot * ESP8266_FLASH_SLOT_SIZE * 4;
+    {
+      InterruptLock lock;
+      spi_flash_read(address, header, sizeof(header));
+      spi_flash_read(address + sizeof(header), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
+    }
+    bool erased = header[0] == 0xFFFFFFFF && header[1] == 0xFFFFFFFF && header[2] == 0xFFFFFFFF;
+    for (uint32_t i = 0; erased && i < ESP8266_FLASH_STORAGE_SIZE; i++)
+      erased = this->flash_storage_[i] == 0xFFFFFFFF;
+    if (!erased)
+      this->flash_next_slot_ = slot + 1;
+
+    if (header[0] != ESP8266_FLASH_SLOT_MAGIC || header[2] != esp8266_flash_slot_crc(header[1], this->flash_storage_))
+      continue;
+    if (best_slot < 0 || header[1] > this->flash_sequence_) {
+      best_slot = slot;
+      this->flash_sequence_ = header[1];
+    }
+  }
+
+  // Without a valid slot the sector is read as one plain snapshot, which is how older versions stored it.
+  // Each preference has its own CRC, so the first save then starts over with a fresh sector.
+  uint32_t address = get_esp8266_flash_address();
+  if (best_slot >= 0) {
+    address += (best_slot * ESP8266_FLASH_SLOT_SIZE + ESP8266_FLASH_SLOT_HEADER_SIZE) * 4;
+  } else {
+    this->flash_next_slot_ = ESP8266_FLASH_SLOT_COUNT;
+  }
   {
     InterruptLock lock;
-    spi_flash_read(get_esp8266_flash_address(), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
+    spi_flash_read(address, this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
   }
 }
 
@@ -227,29 +318,48 @@ bool ESPPreferences::is_prevent_write() { return this->prevent_write_; }
 #endif
 
 #ifdef ARDUINO_ARCH_ESP32
+static const uint32_t ESP32_RTC_STORAGE_SIZE = 64;
+// Kept across deep sleep and software resets, the CRC of each preference catches garbage after a power cycle
+RTC_NOINIT_ATTR static uint32_t esp32_rtc_storage[ESP32_RTC_STORAGE_SIZE];  // NOLINT
+
 bool ESPPreferenceObject::save_internal_() {
+  if (this->in_rtc_) {
+    memcpy(&esp32_rtc_storage[this->offset_], this->data_, (this->length_words_ + 1) * 4);
+    return true;
+  }
   if (global_preferences.nvs_handle_ == 0)
     return false;
 
-  char key[32];
-  sprintf(key, "%u", this->offset_);
-  uint32_t len = (this->length_words_ + 1) * 4;
-  esp_err_t err = nvs_set_blob(global_preferences.nvs_handle_, key, this->data_, len);
-  if (err) {
-    ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
-    return false;
-  }
-  err = nvs_commit(global_preferences.nvs_handle_);
-  if (err) {
-    ESP_LOGV(TAG, "nvs_commit('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
-    return false;
+  uint32_t *end = this->data_ + this->length_words_ + 1;
+  bool found = false;
+  for (auto &save : global_preferences.pending_saves_) {
+    if (save.key == this->offset_) {
+      // Reuses the storage of the earlier save, the size only changes when the key is reused for another type
+      save.data.assign(this->data_, end);
+      found = true;
+      break;
+    }
   }
+  if (!found)
+    global_preferences.pending_saves_.push_back({this->offset_, std::vector<uint32_t>(this->data_, end)});
+  global_preferences.request_sync_();
   return true;
 }
 bool ESPPreferenceObject::load_internal_() {
+  if (this->in_rtc_) {
+    memcpy(this->data_, &esp32_rtc_storage[this->offset_], (this->length_words_ + 1) * 4);
+    return true;
+  }
   if (global_preferences.nvs_handle_ == 0)
     return false;
 
+  for (auto &save : global_preferences.pending_saves_) {
+    if (save.key == this->offset_ && save.data.size() == this->length_words_ + 1) {
+      std::copy(save.data.begin(), save.data.end(), this->data_);
+      return true;
+    }
+  }
+
   char key[32];
   sprintf(key, "%u", this->offset_);
   size_t len = (this->length_words_ + 1) * 4;
@@ -288,12 +398,128 @@ void ESPPreferences::begin() {
   }
 }
 
+void ESPPreferences::sync() {
+  this->flash_write_pending_ = false;
+  this->last_flash_write_ = millis();
+  this->promote_tiered_();
+  if (this->pending_saves_.empty())
+    return;
+
+  bool written = false;
+  std::vector<uint32_t> current;
+  // Saves that failed to be written stay pending for the next sync
+  size_t kept = 0;
+  for (size_t i = 0; i < this->pending_saves_.size(); i++) {
+    auto &save = this->pending_saves_[i];
+    char key[32];
+    sprintf(key, "%u", save.key);
+    size_t len = save.data.size() * 4;
+
+    // Skip blobs that didn't change, reading doesn't wear the flash
+    size_t actual_len;
+    if (nvs_get_blob(this->nvs_handle_, key, nullptr, &actual_len) == ESP_OK && actual_len == len) {
+      current.resize(save.data.size());
+      if (nvs_get_blob(this->nvs_handle_, key, current.data(), &actual_len) == ESP_OK && current == save.data)
+        continue;
+    }
+
+    esp_err_t err = nvs_set_blob(this->nvs_handle_, key, save.data.data(), len);
+    if (err) {
+      ESP_LOGW(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
+      if (kept != i)
+        this->pending_saves_[kept] = std::move(save);
+      kept++;
+      continue;
+    }
+    written = true;
+    this->flash_write_count_++;
+  }
+  this->pending_saves_.erase(this->pending_saves_.begin() + kept, this->pending_saves_.end());
+
+  if (!written)
+    return;
+  esp_err_t err = nvs_commit(this->nvs_handle_);
+  if (err) {
+    ESP_LOGV(TAG, "nvs_commit failed: %s", esp_err_to_name(err));
+  }
+}
+
 ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
   auto pref = ESPPreferenceObject(this->current_offset_, length, type);
   this->current_offset_++;
   return pref;
 }
 #endif
+ESPPreferenceObject ESPPreferences::make_tiered_preference(size_t length, uint32_t type) {
+#ifdef ARDUINO_ARCH_ESP8266
+  if (!DEFAULT_IN_FLASH)
+    return this->make_preference(length, type, false);
+  ESPPreferenceObject rtc = this->make_preference(length, type, false);
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+  ESPPreferenceObject rtc;
+  if (this->current_rtc_offset_ + length + 1 <= ESP32_RTC_STORAGE_SIZE) {
+    rtc = ESPPreferenceObject(this->current_rtc_offset_, length, type);
+    rtc.in_rtc_ = true;
+    this->current_rtc_offset_ += length + 1;
+  }
+#endif
+  ESPPreferenceObject flash = this->make_preference(length, type, true);
+  if (!rtc.is_initialized() || !flash.is_initialized())
+    return flash.is_initialized() ? flash : rtc;
+
+  // Copies share the data buffer, so the entry always sees the value last saved through the returned object
+  rtc.tiered_index_ = this->tiered_.size();
+  this->tiered_.push_back(TieredPreference{rtc, flash, false});
+  return rtc;
+}
+void ESPPreferences::on_tiered_save_(int16_t index) {
+  this->tiered_[index].dirty = true;
+  const uint32_t since_last = millis() - this->last_tiered_promote_;
+  if (since_last >= this->tiered_promote_interval_) {
+    this->promote_tiered_();
+    this->request_sync_();
+  } else if (!this->tiered_promote_pending_) {
+    // Promote once the interval has passed, even if nothing is saved after this
+    this->tiered_promote_pending_ = true;
+    App.scheduler.set_timeout(nullptr, "preferences_promote", this->tiered_promote_interval_ - since_last, [this]() {
+      this->tiered_promote_pending_ = false;
+      this->promote_tiered_();
+      this->request_sync_();
+    });
+  }
+}
+void ESPPreferences::promote_tiered_() {
+  if (this->tiered_promote_pending_) {
+    // Promoted early by sync()
+    App.scheduler.cancel_timeout(nullptr, "preferences_promote");
+    this->tiered_promote_pending_ = false;
+  }
+  this->last_tiered_promote_ = millis();
+  // Flash saves below would request another sync, the caller writes anyway
+  this->in_sync_ = true;
+  for (auto &tiered : this->tiered_) {
+    if (!tiered.dirty)
+      continue;
+    tiered.dirty = false;
+    memcpy(tiered.flash.data_, tiered.rtc.data_, tiered.rtc.length_words_ * 4);
+    tiered.flash.save_();
+  }
+  this->in_sync_ = false;
+}
+void ESPPreferences::request_sync_() {
+  if (this->in_sync_)
+    return;
+  const uint32_t since_last = millis() - this->last_flash_write_;
+  if (this->flash_write_interval_ == 0 || since_last >= this->flash_write_interval_) {
+    this->sync();
+  } else if (!this->flash_write_pending_) {
+    // Coalesce all saves until the interval has passed into one flash write
+    this->flash_write_pending_ = true;
+    App.scheduler.set_timeout(nullptr, "preferences_sync", this->flash_write_interval_ - since_last,
+                              [this]() { this->sync(); });
+  }
+}
 uint32_t ESPPreferenceObject::calculate_crc_() const {
   uint32_t crc = this->type_;
   for (size_t i = 0; i < this->length_words_; i++) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "esphome/core/esphal.h"
 #include "esphome/core/defines.h"
@@ -32,9 +33,14 @@ class ESPPreferenceObject {
   size_t length_words_;
   uint32_t type_;
   uint32_t *data_;
+  /// Index into ESPPreferences::tiered_ for preferences created with make_tiered_preference(), otherwise -1.
+  int16_t tiered_index_{-1};
 #ifdef ARDUINO_ARCH_ESP8266
   bool in_flash_{false};
 #endif
+#ifdef ARDUINO_ARCH_ESP32
+  bool in_rtc_{false};
+#endif
 };
 
 #ifdef ARDUINO_ARCH_ESP8266
@@ -49,6 +55,10 @@ static const bool DEFAULT_IN_FLASH = false;
 static const bool DEFAULT_IN_FLASH = true;
 #endif
 
+#ifdef USE_HOST
+static const bool DEFAULT_IN_FLASH = false;
+#endif
+
 class ESPPreferences {
  public:
   ESPPreferences();
@@ -56,6 +66,31 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash = DEFAULT_IN_FLASH);
   template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash = DEFAULT_IN_FLASH);
 
+  /** Create a preference for a value that changes often, like a counter or an accumulated energy total.
+   *
+   * Every save goes to RTC memory, which is kept across reboots and deep sleep. The value is only copied to
+   * flash once per tiered promote interval and on sync(), and it's loaded from flash when the RTC memory
+   * was lost in a power cycle. When preferences are kept in RTC memory only (ESP8266 without
+   * esp8266_restore_from_flash), this is an ordinary RTC preference.
+   */
+  ESPPreferenceObject make_tiered_preference(size_t length, uint32_t type);
+  template<typename T> ESPPreferenceObject make_tiered_preference(uint32_t type);
+  /// Set the minimum time between two copies of tiered preferences from RTC memory to flash, in milliseconds.
+  void set_tiered_promote_interval(uint32_t interval) { this->tiered_promote_interval_ = interval; }
+
+  /// Write pending preference changes to flash now, call this before rebooting or going to sleep.
+  void sync();
+
+  /** Set the minimum time between two writes of the preferences to flash.
+   *
+   * All saves within that time are combined into one write, 0 writes on every save.
+   *
+   * @param interval The interval in milliseconds.
+   */
+  void set_flash_write_interval(uint32_t interval) { this->flash_write_interval_ = interval; }
+  /// The number of flash writes (ESP8266 sector slots, ESP32 NVS blobs) since boot.
+  uint32_t get_flash_write_count() const { return this->flash_write_count_; }
+
 #ifdef ARDUINO_ARCH_ESP8266
   /** On the ESP8266, we can't override the first 128 bytes during OTA uploads
    * as the eboot parameters are stored there. Writing there during an OTA upload
@@ -71,15 +106,47 @@ class ESPPreferences {
  protected:
   friend ESPPreferenceObject;
 
+  /// Write now if the write interval has passed, otherwise schedule a sync() for when it has.
+  void request_sync_();
+  void on_tiered_save_(int16_t index);
+  /// Copy all changed tiered preferences from RTC memory to flash.
+  void promote_tiered_();
+
+  struct TieredPreference {
+    ESPPreferenceObject rtc;
+    ESPPreferenceObject flash;
+    bool dirty;
+  };
+  std::vector<TieredPreference> tiered_;
+  uint32_t tiered_promote_interval_{300000};
+  uint32_t last_tiered_promote_{0};
+  bool tiered_promote_pending_{false};
+  bool in_sync_{false};
+
   uint32_t current_offset_;
+  uint32_t flash_write_interval_{0};
+  uint32_t last_flash_write_{0};
+  bool flash_write_pending_{false};
+  uint32_t flash_write_count_{0};
 #ifdef ARDUINO_ARCH_ESP32
   uint32_t nvs_handle_;
+  uint32_t current_rtc_offset_{0};
+  struct PendingSave {
+    size_t key;
+    std::vector<uint32_t> data;
+  };
+  /// Saved preferences that have not been written to NVS yet.
+  std::vector<PendingSave> pending_saves_;
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
   void save_esp8266_flash_();
   bool prevent_write_{false};
   uint32_t *flash_storage_;
   uint32_t current_flash_offset_;
+  /// Sequence number of the newest snapshot in the flash sector.
+  uint32_t flash_sequence_{0};
+  /// The slot the next snapshot is written to, the sector is erased first when all slots are used.
+  uint32_t flash_next_slot_{0};
 #endif
 };
 
@@ -89,6 +156,10 @@ template<typename T> ESPPreferenceObject ESPPreferences::make_preference(uint32_
   return this->make_preference((sizeof(T) + 3) / 4, type, in_flash);
 }
 
+template<typename T> ESPPreferenceObject ESPPreferences::make_tiered_preference(uint32_t type) {
+  return this->make_tiered_preference((sizeof(T) + 3) / 4, type);
+}
+
 template<typename T> bool ESPPreferenceObject::save(T *src) {
   if (!this->is_initialized())
     return false;
@@ -2,6 +2,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include <algorithm>
+#include <cstring>
 
 namespace esphome {
 
@@ -15,19 +16,63 @@ static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> &&func) {
+  const uint32_t name_hash = hash_name_(name);
+#ifdef USE_RUNTIME_STATS
+  this->record_name_(component, name_hash, SchedulerItem::TIMEOUT, name.c_str(), true);
+#endif
+  this->set_timeout_(component, name_hash, timeout, std::move(func));
+}
+void HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout,
+                                std::function<void()> &&func) {
+  const uint32_t name_hash = hash_name_(name);
+#ifdef USE_RUNTIME_STATS
+  this->record_name_(component, name_hash, SchedulerItem::TIMEOUT, name, false);
+#endif
+  this->set_timeout_(component, name_hash, timeout, std::move(func));
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
+  return this->cancel_item_(component, hash_name_(name), SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const char *name) {
+  return this->cancel_item_(component, hash_name_(name), SchedulerItem::TIMEOUT);
+}
+void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
+                                 std::function<void()> &&func) {
+  const uint32_t name_hash = hash_name_(name);
+#ifdef USE_RUNTIME_STATS
+  this->record_name_(component, name_hash, SchedulerItem::INTERVAL, name.c_str(), true);
+#endif
+  this->set_interval_(component, name_hash, interval, std::move(func));
+}
+void HOT Scheduler::set_interval(Component *component, const char *name, uint32_t interval,
+                                 std::function<void()> &&func) {
+  const uint32_t name_hash = hash_name_(name);
+#ifdef USE_RUNTIME_STATS
+  this->record_name_(component, name_hash, SchedulerItem::INTERVAL, name, false);
+#endif
+  this->set_interval_(component, name_hash, interval, std::move(func));
+}
+bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_item_(component, hash_name_(name), SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval(Component *component, const char *name) {
+  return this->cancel_item_(component, hash_name_(name), SchedulerItem::INTERVAL);
+}
+void HOT Scheduler::set_timeout_(Component *component, uint32_t name_hash, uint32_t timeout,
+                                 std::function<void()> &&func) {
   const uint32_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_timeout(component, name);
+  if (name_hash != 0)
+    this->cancel_item_(component, name_hash, SchedulerItem::TIMEOUT);
 
   if (timeout == SCHEDULER_DONT_RUN)
     return;
 
-  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%u)", name.c_str(), timeout);
+  ESP_LOGVV(TAG, "set_timeout(name=0x%08X, timeout=%u)", name_hash, timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
-  item->name = name;
+  item->name_hash = name_hash;
   item->type = SchedulerItem::TIMEOUT;
   item->timeout = timeout;
   item->last_execution = now;
@@ -36,29 +81,23 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
   item->remove = false;
   this->push_(std::move(item));
 }
-bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
-}
-void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
-                                 std::function<void()> &&func) {
+void HOT Scheduler::set_interval_(Component *component, uint32_t name_hash, uint32_t interval,
+                                  std::function<void()> &&func) {
   const uint32_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
+  if (name_hash != 0)
+    this->cancel_item_(component, name_hash, SchedulerItem::INTERVAL);
 
   if (interval == SCHEDULER_DONT_RUN)
     return;
 
-  // only put offset in lower half
-  uint32_t offset = 0;
-  if (interval != 0)
-    offset = (random_uint32() % interval) / 2;
+  uint32_t offset = this->interval_offset_(component, interval, now);
 
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%u, offset=%u)", name.c_str(), interval, offset);
+  ESP_LOGVV(TAG, "set_interval(name=0x%08X, interval=%u, offset=%u)", name_hash, interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
-  item->name = name;
+  item->name_hash = name_hash;
   item->type = SchedulerItem::INTERVAL;
   item->interval = interval;
   item->last_execution = now - offset - interval;
@@ -69,8 +108,45 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
   item->remove = false;
   this->push_(std::move(item));
 }
-bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+void Scheduler::set_phase_group(Component *component, uint32_t group) {
+  this->phase_groups_.emplace_back(component, group);
+}
+uint32_t Scheduler::interval_offset_(Component *component, uint32_t interval, uint32_t now) {
+  if (interval == 0)
+    return 0;
+  IntervalPhase *phase = nullptr;
+  for (auto &p : this->interval_phases_) {
+    if (p.interval == interval) {
+      phase = &p;
+      break;
+    }
+  }
+  if (phase == nullptr) {
+    this->interval_phases_.push_back(IntervalPhase{interval, now, 0});
+    phase = &this->interval_phases_.back();
+  }
+  const std::pair<uint32_t, uint32_t> *group_slot = nullptr;
+  for (auto &group : this->phase_groups_) {
+    if (group.first != component)
+      continue;
+    for (auto &slot : phase->group_slots) {
+      if (slot.first == group.second)
+        group_slot = &slot;
+    }
+    if (group_slot == nullptr) {
+      phase->group_slots.emplace_back(group.second, this->next_phase_slot_(*phase));
+      group_slot = &phase->group_slots.back();
+    }
+    break;
+  }
+  const uint32_t slot = group_slot != nullptr ? group_slot->second : this->next_phase_slot_(*phase);
+  // the first call still happens right away, every following one lands on epoch + slot (mod interval)
+  return (now - phase->epoch - slot) % interval;
+}
+uint32_t Scheduler::next_phase_slot_(IntervalPhase &phase) {
+  // fractional part of count * golden ratio, scaled to the interval
+  const uint32_t frac = phase.count++ * 2654435769UL;
+  return (uint64_t(frac) * phase.interval) >> 32;
 }
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
   if (this->empty_())
@@ -96,7 +172,7 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
     while (!this->empty_()) {
       auto item = std::move(this->items_[0]);
       const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "  %s '%s' interval=%u last_execution=%u (%u) next=%u (%u)", type, item->name.c_str(),
+      ESP_LOGVV(TAG, "  %s 0x%08X interval=%u last_execution=%u (%u) next=%u (%u)", type, item->name_hash,
                 item->interval, item->last_execution, item->last_execution_major, item->next_execution(),
                 item->next_execution_major());
 
@@ -108,24 +184,17 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  auto to_remove_was = to_remove_;
-  auto items_was = items_.size();
-  // If we have too many items to remove
-  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
-    std::vector<std::unique_ptr<SchedulerItem>> valid_items;
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
-    }
-    this->items_ = std::move(valid_items);
-
-    // The following should not happen unless I'm missing something
-    if (to_remove_ != 0) {
-      ESP_LOGW(TAG, "to_remove_ was %u now: %u items where %zu now %zu. Please report this", to_remove_was, to_remove_,
-               items_was, items_.size());
-      to_remove_ = 0;
+  // Cancelled items stay in the heap until they reach its top. Drop them in place once there are many, or once the
+  // pool could not replace them, so that re-arming timers keeps taking its items from the pool.
+  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS || (to_remove_ != 0 && this->item_pool_.size() < to_remove_)) {
+    for (auto &item : this->items_) {
+      if (item->remove)
+        this->recycle_item_(std::move(item));
     }
+    this->items_.erase(std::remove(this->items_.begin(), this->items_.end(), nullptr), this->items_.end());
+    std::make_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+    // process_to_add() above moved all pending items into items_, so none of the cancelled ones is left
+    to_remove_ = 0;
   }
 
   while (!this->empty_()) {
@@ -142,20 +211,37 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
 
       // Don't run on failed components
       if (item->component != nullptr && item->component->is_failed()) {
+        this->release_index_(item.get());
         this->pop_raw_();
         continue;
       }
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
       const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "Running %s '%s' with interval=%u last_execution=%u (now=%u)", type, item->name.c_str(),
+      ESP_LOGVV(TAG, "Running %s 0x%08X with interval=%u last_execution=%u (now=%u)", type, item->name_hash,
                 item->interval, item->last_execution, now);
 #endif
 
+#ifdef USE_RUNTIME_STATS
+      Component *component = item->component;
+      const uint32_t name_hash = item->name_hash;
+      const SchedulerItem::Type type = item->type;
+      const uint32_t callback_start = micros();
+#endif
+
+#ifdef USE_ALLOC_STATS
+      AllocStatsScope alloc_scope(item->component != nullptr ? &item->component->get_alloc_stats() : nullptr);
+#endif
+
       // Warning: During f(), a lot of stuff can happen, including:
       //  - timeouts/intervals get added, potentially invalidating vector pointers
       //  - timeouts/intervals get cancelled
       item->f();
+
+#ifdef USE_RUNTIME_STATS
+      // Unnamed items share the (component, 0, type) entry, which is never used for cancelling
+      this->find_index_(component, name_hash, type, true)->stats.record(micros() - callback_start);
+#endif
     }
 
     {
@@ -169,6 +255,7 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
@@ -181,6 +268,9 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
             item->last_execution_major++;
         }
         this->push_(std::move(item));
+      } else {
+        this->release_index_(item.get());
+        this->recycle_item_(std::move(item));
       }
     }
   }
@@ -190,6 +280,8 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
 void HOT Scheduler::process_to_add() {
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      to_remove_--;
+      this->recycle_item_(std::move(it));
       continue;
     }
 
@@ -210,24 +302,114 @@ void HOT Scheduler::cleanup_() {
 }
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  // the caller may have moved the item out already, in which case this is a no-op
+  this->recycle_item_(std::move(this->items_.back()));
   this->items_.pop_back();
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) { this->to_add_.push_back(std::move(item)); }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
-  bool ret = false;
-  for (auto &it : this->items_)
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
-    }
-  for (auto &it : this->to_add_)
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
+void Scheduler::reserve_pool(size_t size) {
+  size += this->item_pool_extra_;
+  this->item_pool_capacity_ = size;
+  this->item_pool_.reserve(size);
+  this->items_.reserve(size);
+  this->to_add_.reserve(size);
+  while (this->item_pool_.size() < size)
+    this->item_pool_.push_back(make_unique<SchedulerItem>());
+}
+void Scheduler::add_pool_reservation(size_t count) {
+  const size_t size = this->item_pool_capacity_ - this->item_pool_extra_;
+  this->item_pool_extra_ += count;
+  this->reserve_pool(size);
+}
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::acquire_item_() {
+  if (this->item_pool_.empty())
+    return make_unique<SchedulerItem>();
+  auto item = std::move(this->item_pool_.back());
+  this->item_pool_.pop_back();
+  return item;
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  if (!item)
+    return;
+  // Release the captures now, not when the item is next reused
+  item->f = nullptr;
+  if (this->item_pool_.size() < this->item_pool_capacity_)
+    this->item_pool_.push_back(std::move(item));
+}
+void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
+  if (item->name_hash != 0)
+    this->find_index_(item->component, item->name_hash, item->type, true)->item = item.get();
+  this->to_add_.push_back(std::move(item));
+}
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t name_hash, Scheduler::SchedulerItem::Type type) {
+  if (name_hash == 0)
+    return false;
+  NameIndexEntry *entry = this->find_index_(component, name_hash, type, false);
+  if (entry == nullptr || entry->item == nullptr)
+    return false;
+
+  // Items in both items_ and to_add_ are counted, process_to_add() discounts the ones it drops.
+  entry->item->remove = true;
+  entry->item = nullptr;
+  to_remove_++;
+  return true;
+}
+Scheduler::NameIndexEntry *HOT Scheduler::find_index_(Component *component, uint32_t name_hash,
+                                                      Scheduler::SchedulerItem::Type type, bool create) {
+  NameIndexEntry key{component, name_hash, type, nullptr};
+  auto it = std::lower_bound(this->name_index_.begin(), this->name_index_.end(), key, NameIndexEntry::cmp);
+  if (it != this->name_index_.end() && !NameIndexEntry::cmp(key, *it))
+    return &*it;
+  if (!create)
+    return nullptr;
+  return &*this->name_index_.insert(it, key);
+}
+void HOT Scheduler::release_index_(SchedulerItem *item) {
+  if (item->name_hash == 0)
+    return;
+  NameIndexEntry *entry = this->find_index_(item->component, item->name_hash, item->type, false);
+  if (entry != nullptr && entry->item == item)
+    entry->item = nullptr;
+}
+#ifdef USE_RUNTIME_STATS
+void Scheduler::dump_runtime_stats() {
+  ESP_LOGI(TAG, "Timer callback runtime (since last report):");
+  for (auto &entry : this->name_index_) {
+    if (entry.stats.count == 0)
+      continue;
+    const char *source = entry.component == nullptr ? "<none>" : entry.component->get_component_source();
+    const char *type = entry.type == SchedulerItem::INTERVAL ? "interval" : "timeout";
+    if (entry.name != nullptr) {
+      ESP_LOGI(TAG, "  %s %s '%s': count=%u avg=%.2fms min=%.2fms max=%.2fms", source, type, entry.name,
+               entry.stats.count, entry.stats.get_average_us() / 1000.0f, entry.stats.min_us / 1000.0f,
+               entry.stats.max_us / 1000.0f);
+    } else {
+      ESP_LOGI(TAG, "  %s %s 0x%08X: count=%u avg=%.2fms min=%.2fms max=%.2fms", source, type, entry.name_hash,
+               entry.stats.count, entry.stats.get_average_us() / 1000.0f, entry.stats.min_us / 1000.0f,
+               entry.stats.max_us / 1000.0f);
     }
-
-  return ret;
+    entry.stats.reset();
+  }
+}
+void Scheduler::record_name_(Component *component, uint32_t name_hash, SchedulerItem::Type type, const char *name,
+                             bool copy) {
+  if (name_hash == 0)
+    return;
+  NameIndexEntry *entry = this->find_index_(component, name_hash, type, true);
+  if (entry->name != nullptr)
+    return;
+  // Index entries are never erased, so the copy lives as long as the scheduler
+  entry->name = copy ? strdup(name) : name;
+}
+#endif
+uint32_t Scheduler::hash_name_(const char *name) {
+  if (name == nullptr || *name == '\0')
+    return 0;
+  return fnv1_hash(name);
+}
+uint32_t Scheduler::hash_name_(const std::string &name) {
+  if (name.empty())
+    return 0;
+  return fnv1_hash(name);
 }
 uint32_t Scheduler::millis_() {
   const uint32_t now = millis();
@@ -268,4 +450,12 @@ bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
   return a_next_exec > b_next_exec;
 }
 
+bool HOT Scheduler::NameIndexEntry::cmp(const NameIndexEntry &a, const NameIndexEntry &b) {
+  if (a.component != b.component)
+    return a.component < b.component;
+  if (a.name_hash != b.name_hash)
+    return a.name_hash < b.name_hash;
+  return a.type < b.type;
+}
+
 }  // namespace esphome
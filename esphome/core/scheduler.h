@@ -11,9 +11,13 @@ class Component;
 class Scheduler {
  public:
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> &&func);
+  void set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> &&func);
   bool cancel_timeout(Component *component, const std::string &name);
+  bool cancel_timeout(Component *component, const char *name);
   void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> &&func);
+  void set_interval(Component *component, const char *name, uint32_t interval, std::function<void()> &&func);
   bool cancel_interval(Component *component, const std::string &name);
+  bool cancel_interval(Component *component, const char *name);
 
   optional<uint32_t> next_schedule_in();
 
@@ -21,10 +25,36 @@ class Scheduler {
 
   void process_to_add();
 
+  /** Preallocate scheduler items so that timeouts, intervals and defer() do not allocate in steady state.
+   *
+   * Finished items are kept on a free list of at most `size` entries and handed out again by later calls.
+   * Once more than `size` items are pending at the same time the scheduler falls back to the heap.
+   */
+  void reserve_pool(size_t size);
+  /** Reserve `count` more pool items on top of the size given to reserve_pool().
+   *
+   * For code that keeps more timers pending than the usual component, like the delays of parallel script runs.
+   * Can be called before or after reserve_pool().
+   */
+  void add_pool_reservation(size_t count);
+
+  /** Put the intervals of a component on the same phase as those of the other components in `group`.
+   *
+   * Intervals of the same length in one group then run back to back, for example all I2C devices behind
+   * one multiplexer channel, so the channel only has to be switched once per round. Call before setup.
+   */
+  void set_phase_group(Component *component, uint32_t group);
+
+#ifdef USE_RUNTIME_STATS
+  /// Log the callback execution time of each timer per component and reset the statistics.
+  void dump_runtime_stats();
+#endif
+
  protected:
   struct SchedulerItem {
     Component *component;
-    std::string name;
+    /// FNV-1 hash of the item name, 0 for unnamed (non-cancellable) items.
+    uint32_t name_hash;
     enum Type { TIMEOUT, INTERVAL } type;
     union {
       uint32_t interval;
@@ -47,11 +77,57 @@ class Scheduler {
     static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
   };
 
+  /** Index entry mapping a (component, name, type) key to the live item with that key.
+   *
+   * Entries are kept sorted by key so lookups are a binary search. An entry is not erased when its
+   * item finishes, only cleared, so re-arming the same named timer never reallocates the index.
+   */
+  struct NameIndexEntry {
+    Component *component;
+    uint32_t name_hash;
+    SchedulerItem::Type type;
+    SchedulerItem *item;
+#ifdef USE_RUNTIME_STATS
+    /// Name given to the first item with this key, for dump_runtime_stats().
+    const char *name;
+    RuntimeStats stats;
+#endif
+
+    static bool cmp(const NameIndexEntry &a, const NameIndexEntry &b);
+  };
+
+  /** Intervals of the same length share a phase grid, and each new one takes the next slot of a golden ratio
+   * sequence on it. This spreads them evenly over the period, no matter how many there are, instead of letting
+   * random offsets cluster.
+   */
+  struct IntervalPhase {
+    uint32_t interval;
+    uint32_t epoch;
+    uint32_t count;
+    /// Slot taken by each phase group, see set_phase_group().
+    std::vector<std::pair<uint32_t, uint32_t>> group_slots;
+  };
+
+  void set_timeout_(Component *component, uint32_t name_hash, uint32_t timeout, std::function<void()> &&func);
+  void set_interval_(Component *component, uint32_t name_hash, uint32_t interval, std::function<void()> &&func);
+  static uint32_t hash_name_(const char *name);
+  static uint32_t hash_name_(const std::string &name);
+  uint32_t interval_offset_(Component *component, uint32_t interval, uint32_t now);
+  uint32_t next_phase_slot_(IntervalPhase &phase);
+#ifdef USE_RUNTIME_STATS
+  /// Remember the name of a timer, names that are not constant are copied once per key.
+  void record_name_(Component *component, uint32_t name_hash, SchedulerItem::Type type, const char *name, bool copy);
+#endif
+
+  std::unique_ptr<SchedulerItem> acquire_item_();
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
   uint32_t millis_();
   void cleanup_();
   void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+  bool cancel_item_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  NameIndexEntry *find_index_(Component *component, uint32_t name_hash, SchedulerItem::Type type, bool create);
+  void release_index_(SchedulerItem *item);
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
@@ -59,6 +135,14 @@ class Scheduler {
 
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  std::vector<NameIndexEntry> name_index_;
+  std::vector<IntervalPhase> interval_phases_;
+  std::vector<std::pair<Component *, uint32_t>> phase_groups_;
+  /// Free list of finished items, see reserve_pool().
+  std::vector<std::unique_ptr<SchedulerItem>> item_pool_;
+  size_t item_pool_capacity_{8};
+  /// Items requested with add_pool_reservation().
+  size_t item_pool_extra_{0};
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
@@ -0,0 +1,98 @@
+#include "esphome/core/timer_wheel.h"
+#include "esphome/core/application.h"
+#include "esphome/core/esphal.h"
+#include <algorithm>
+
+namespace esphome {
+
+const uint32_t TimerWheel::SLOTS;
+
+void WheelTimer::start(uint32_t delay) {
+  this->stop();
+  App.timer_wheel.add_(this, delay);
+}
+void WheelTimer::stop() {
+  if (this->wheel_ != nullptr)
+    this->wheel_->remove_(this);
+}
+
+void TimerWheel::add_(WheelTimer *timer, uint32_t delay) {
+  const uint32_t now = millis();
+  // call() stops tracking time while nothing is running
+  if (this->running_ == 0)
+    this->next_tick_ = now;
+  uint32_t expires = now + delay;
+  // Slots before next_tick_ were already looked at in this lap
+  if (int32_t(expires - this->next_tick_) < 0)
+    expires = this->next_tick_;
+  timer->expires_ = expires;
+  timer->wheel_ = this;
+  WheelTimer *&head = this->slots_[expires & (SLOTS - 1)];
+  timer->prev_ = nullptr;
+  timer->next_ = head;
+  if (head != nullptr)
+    head->prev_ = timer;
+  head = timer;
+  this->running_++;
+}
+void TimerWheel::remove_(WheelTimer *timer) {
+  if (timer->prev_ != nullptr) {
+    timer->prev_->next_ = timer->next_;
+  } else {
+    this->slots_[timer->expires_ & (SLOTS - 1)] = timer->next_;
+  }
+  if (timer->next_ != nullptr)
+    timer->next_->prev_ = timer->prev_;
+  timer->prev_ = timer->next_ = nullptr;
+  timer->wheel_ = nullptr;
+  this->running_--;
+}
+
+void TimerWheel::call() {
+  const uint32_t now = millis();
+  const uint32_t first = this->next_tick_;
+  if (int32_t(now - first) < 0)
+    return;
+  if (this->running_ == 0)
+    return;
+  this->next_tick_ = now + 1;
+
+  // After a lap or more every slot may hold expired timers
+  const uint32_t ticks = std::min(now - first + 1, SLOTS);
+  for (uint32_t i = 0; i < ticks; i++) {
+    WheelTimer **head = &this->slots_[(first + i) & (SLOTS - 1)];
+    WheelTimer *timer = *head;
+    while (timer != nullptr) {
+      if (int32_t(timer->expires_ - now) > 0) {
+        timer = timer->next_;
+        continue;
+      }
+      this->remove_(timer);
+      timer->callback_();
+      // The callback may have started or stopped any timer, start over in this slot. Expired timers are gone
+      // and restarted ones expire after now, so this terminates.
+      timer = *head;
+    }
+  }
+}
+
+optional<uint32_t> TimerWheel::next_expiry_in() const {
+  if (this->running_ == 0)
+    return {};
+  const uint32_t now = millis();
+  const uint32_t from = this->next_tick_;
+  uint32_t best = UINT32_MAX;
+  for (uint32_t i = 0; i < SLOTS; i++) {
+    for (WheelTimer *timer = this->slots_[(from + i) & (SLOTS - 1)]; timer != nullptr; timer = timer->next_) {
+      const uint32_t in = timer->expires_ - from;
+      if (in < SLOTS)
+        // Slots are visited in order of their deadline within this lap
+        return int32_t(timer->expires_ - now) > 0 ? timer->expires_ - now : 0;
+      best = std::min(best, in);
+    }
+  }
+  // Only timers more than a lap away
+  return from + best - now;
+}
+
+}  // namespace esphome
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include "esphome/core/optional.h"
+
+namespace esphome {
+
+class TimerWheel;
+
+/** A one-shot timer for short delays that are rearmed often, like debounce filters.
+ *
+ * The callback is set once and the timer is linked into App.timer_wheel while it is running, so
+ * start() and stop() never allocate and are O(1). Restarting a running timer moves its deadline.
+ * The owner must outlive the timer's run, usually by embedding it as a member.
+ */
+class WheelTimer {
+ public:
+  WheelTimer() = default;
+  explicit WheelTimer(std::function<void()> &&callback) : callback_(std::move(callback)) {}
+  WheelTimer(const WheelTimer &) = delete;
+  WheelTimer &operator=(const WheelTimer &) = delete;
+  ~WheelTimer() { this->stop(); }
+
+  void set_callback(std::function<void()> &&callback) { this->callback_ = std::move(callback); }
+
+  /// (Re)start the timer to call the callback in `delay` milliseconds.
+  void start(uint32_t delay);
+  /// Stop the timer if it is running.
+  void stop();
+  bool is_running() const { return this->wheel_ != nullptr; }
+
+ protected:
+  friend TimerWheel;
+
+  std::function<void()> callback_;
+  TimerWheel *wheel_{nullptr};
+  WheelTimer *prev_{nullptr};
+  WheelTimer *next_{nullptr};
+  uint32_t expires_{0};
+};
+
+/** Hashed timer wheel with a 1 ms tick running the WheelTimers from the main loop.
+ *
+ * Timers are kept in one of SLOTS lists by their deadline, so each call() only has to look at the
+ * slots of the milliseconds that passed since the last one. Timers further away than one lap stay
+ * in their slot and are skipped until their lap comes.
+ */
+class TimerWheel {
+ public:
+  static const uint32_t SLOTS = 64;
+
+  /// Run all timers that expired, called from Application::loop().
+  void call();
+  /// Milliseconds until the next timer expires, if any is running.
+  optional<uint32_t> next_expiry_in() const;
+
+ protected:
+  friend WheelTimer;
+
+  void add_(WheelTimer *timer, uint32_t delay);
+  void remove_(WheelTimer *timer);
+
+  WheelTimer *slots_[SLOTS]{};
+  /// The next millisecond that call() has not looked at yet.
+  uint32_t next_tick_{0};
+  uint32_t running_{0};
+};
+
+}  // namespace esphome
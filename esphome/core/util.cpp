@@ -65,6 +65,13 @@ bool mqtt_is_connected() {
 
 bool remote_is_connected() { return api_is_connected() || mqtt_is_connected(); }
 
+void network_notify_activity() {
+#ifdef USE_WIFI
+  if (wifi::global_wifi_component != nullptr)
+    wifi::global_wifi_component->notify_activity();
+#endif
+}
+
 #if defined(ARDUINO_ARCH_ESP8266) && defined(USE_MDNS)
 static bool mdns_setup;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 #endif
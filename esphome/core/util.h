@@ -19,6 +19,9 @@ bool mqtt_is_connected();
 /// Return whether the node has any form of "remote" connection via the API or to an MQTT broker
 bool remote_is_connected();
 
+/// Report network traffic that wants low latency, the WiFi leaves power save for a while (see power_save_idle_timeout)
+void network_notify_activity();
+
 /// Manually set up the network stack (outside of the App.setup() loop, for example in OTA safe mode)
 #ifdef ARDUINO_ARCH_ESP8266
 void network_setup_mdns(IPAddress address, int interface);
@@ -0,0 +1,78 @@
+#include "esphome/core/worker.h"
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#include "esphome/core/component.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+
+static const char *const TAG = "worker";
+
+static const UBaseType_t WORKER_QUEUE_LENGTH = 16;
+static const uint32_t WORKER_STACK_SIZE = 8192;
+static const UBaseType_t WORKER_PRIORITY = 1;
+static const BaseType_t WORKER_CORE = 0;
+
+bool Worker::submit(Component *component, std::function<void()> &&work, std::function<void()> &&done) {
+  if (this->job_queue_ == nullptr && !this->start_())
+    return false;
+  // Every pending job fits into the done queue, so the worker never blocks handing a job back
+  if (this->pending_ >= WORKER_QUEUE_LENGTH) {
+    ESP_LOGW(TAG, "Job queue full, dropping job");
+    return false;
+  }
+
+  auto *job = new Job{component, std::move(work), std::move(done)};
+  if (xQueueSend(this->job_queue_, &job, 0) != pdTRUE) {
+    delete job;
+    return false;
+  }
+  this->pending_++;
+  return true;
+}
+void Worker::process_done() {
+  if (this->done_queue_ == nullptr)
+    return;
+
+  Job *job;
+  while (xQueueReceive(this->done_queue_, &job, 0) == pdTRUE) {
+    this->pending_--;
+    if (job->component == nullptr || !job->component->is_failed())
+      job->done();
+    delete job;
+  }
+}
+bool Worker::start_() {
+  this->job_queue_ = xQueueCreate(WORKER_QUEUE_LENGTH, sizeof(Job *));
+  this->done_queue_ = xQueueCreate(WORKER_QUEUE_LENGTH, sizeof(Job *));
+  if (this->job_queue_ == nullptr || this->done_queue_ == nullptr) {
+    ESP_LOGE(TAG, "Could not create worker queues");
+    return false;
+  }
+  BaseType_t res = xTaskCreatePinnedToCore(Worker::task_, "esphome_worker", WORKER_STACK_SIZE, this, WORKER_PRIORITY,
+                                           nullptr, WORKER_CORE);
+  if (res != pdPASS) {
+    ESP_LOGE(TAG, "Could not create worker task");
+    vQueueDelete(this->job_queue_);
+    vQueueDelete(this->done_queue_);
+    this->job_queue_ = nullptr;
+    this->done_queue_ = nullptr;
+    return false;
+  }
+  return true;
+}
+void Worker::task_(void *param) {
+  auto *worker = reinterpret_cast<Worker *>(param);
+  Job *job;
+  while (true) {
+    if (xQueueReceive(worker->job_queue_, &job, portMAX_DELAY) != pdTRUE)
+      continue;
+    job->work();
+    xQueueSend(worker->done_queue_, &job, portMAX_DELAY);
+  }
+}
+
+}  // namespace esphome
+
+#endif
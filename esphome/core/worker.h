@@ -0,0 +1,60 @@
+#pragma once
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#include <functional>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+namespace esphome {
+
+class Component;
+
+/** A FreeRTOS task on the PRO core that runs long jobs outside of the main loop.
+ *
+ * The Arduino loop task (and with it every component) runs on core 1, while core 0 mostly only
+ * handles the WiFi and BT stacks. Jobs submitted here run on a low priority task pinned to core 0,
+ * so that for example rendering a display page does not hold up API, OTA and WiFi handling.
+ *
+ * The work function runs on the worker task: it must only operate on data owned by the job and must
+ * not call into the scheduler, publish states or log excessively. Its done callback is then called
+ * from the main loop, where it is safe to hand the result to the rest of the system.
+ *
+ * The task is only created on the first submitted job.
+ */
+class Worker {
+ public:
+  /** Run work on the worker task, then done in the main loop.
+   *
+   * @param component The component submitting the job, done is not called if it has failed in the meantime.
+   * @param work The function to run on the worker task.
+   * @param done The function to call in the main loop after work has returned.
+   * @return Whether the job was queued, false if the queue is full or the task could not be started.
+   */
+  bool submit(Component *component, std::function<void()> &&work, std::function<void()> &&done);
+
+  /// Call the done callbacks of finished jobs, called by Application::loop().
+  void process_done();
+
+  /// Number of submitted jobs whose done callback has not been called yet.
+  uint32_t get_pending() const { return this->pending_; }
+
+ protected:
+  struct Job {
+    Component *component;
+    std::function<void()> work;
+    std::function<void()> done;
+  };
+
+  bool start_();
+  static void task_(void *param);
+
+  QueueHandle_t job_queue_{nullptr};
+  QueueHandle_t done_queue_{nullptr};
+  uint32_t pending_{0};
+};
+
+}  // namespace esphome
+
+#endif
@@ -22,6 +22,7 @@ from esphome.core import (  # noqa
     Define,
     EnumValue,
 )
+from esphome.const import CONF_ESPHOME, CONF_STATIC_ALLOCATION
 from esphome.helpers import cpp_string_escape, indent_all_but_first_and_last
 from esphome.util import OrderedDict
 
@@ -512,10 +513,23 @@ def Pvariable(id_: ID, rhs: SafeExpType, type_: "MockObj" = None) -> "MockObj":
     return obj
 
 
+STATIC_STORAGE_SUFFIX = "__pstorage"
+
+
+def _use_static_storage() -> bool:
+    if CORE.config is None:
+        return False
+    return CORE.config.get(CONF_ESPHOME, {}).get(CONF_STATIC_ALLOCATION, False)
+
+
 def new_Pvariable(id_: ID, *args: SafeExpType) -> Pvariable:
     """Declare a new pointer variable in the code generation by calling it's constructor
     with the given arguments.
 
+    With static_allocation enabled the object is constructed with placement new in
+    a static buffer, so that it ends up in .bss instead of the heap. It's still
+    constructed in setup(), in the same order as objects from the heap.
+
     :param id_: The ID used to declare the variable (also specifies the type).
     :param args: The values to pass to the constructor.
 
@@ -525,7 +539,16 @@ def new_Pvariable(id_: ID, *args: SafeExpType) -> Pvariable:
         id_ = id_.copy()
         id_.type = id_.type.template(args[0])
         args = args[1:]
-    rhs = id_.type.new(*args)
+    if _use_static_storage():
+        storage = f"{id_}{STATIC_STORAGE_SUFFIX}"
+        CORE.add_global(
+            RawStatement(
+                f"alignas({id_.type}) static uint8_t {storage}[sizeof({id_.type})];"
+            )
+        )
+        rhs = MockObj(f"new ({storage}) {id_.type}", "->")(*args)
+    else:
+        rhs = id_.type.new(*args)
     return Pvariable(id_, rhs)
 
 
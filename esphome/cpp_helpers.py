@@ -1,4 +1,5 @@
 from esphome.const import (
+    CONF_ID,
     CONF_INVERTED,
     CONF_MODE,
     CONF_NUMBER,
@@ -34,6 +35,20 @@ async def gpio_pin_expression(conf):
     return GPIOPin.new(number, RawExpression(mode), inverted)
 
 
+def _component_source(id_):
+    """Human readable identifier of a component for diagnostics (log messages, profiler)."""
+    if not isinstance(id_, ID):
+        return None
+    if id_.is_manual:
+        return id_.id
+    if id_.type is None:
+        return None
+    type_ = str(id_.type)
+    if type_.startswith("esphome::"):
+        type_ = type_[len("esphome::") :]
+    return type_
+
+
 async def register_component(var, config):
     """Register the given obj as a component.
 
@@ -50,6 +65,9 @@ async def register_component(var, config):
             "configuration.".format(id_)
         )
     CORE.component_ids.remove(id_)
+    source = _component_source(config.get(CONF_ID))
+    if source is not None:
+        add(var.set_component_source(source))
     if CONF_SETUP_PRIORITY in config:
         add(var.set_setup_priority(config[CONF_SETUP_PRIORITY]))
     if CONF_UPDATE_INTERVAL in config:
@@ -58,6 +76,37 @@ async def register_component(var, config):
     return var
 
 
+# Characters kept in object ids, same as HOSTNAME_CHARACTER_ALLOWLIST in helpers.cpp
+_OBJECT_ID_ALLOWLIST = frozenset(
+    b"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_"
+)
+
+
+def object_id_from_name(name):
+    """Compute the object id and its FNV-1 hash like Nameable::calc_object_id_() does."""
+    sanitized = bytes(
+        c
+        for c in name.encode().lower().replace(b" ", b"_")
+        if c in _OBJECT_ID_ALLOWLIST
+    )
+    hash_ = 2166136261
+    for c in sanitized:
+        hash_ = (hash_ * 16777619) & 0xFFFFFFFF
+        hash_ ^= c
+    return sanitized.decode(), hash_
+
+
+def setup_entity_name(var, name):
+    """Set the name of a Nameable, with the object id computed at build time.
+
+    The object id is passed as a string literal so it isn't computed and kept
+    on the heap at runtime.
+    """
+    add(var.set_name(name))
+    object_id, hash_ = object_id_from_name(name)
+    add(var.set_object_id(object_id, hash_))
+
+
 async def register_parented(var, value):
     if isinstance(value, ID):
         paren = await get_variable(value)
@@ -1,7 +1,11 @@
+import gzip
 import hashlib
+import io
 import logging
+import os
 import random
 import socket
+import struct
 import sys
 import time
 
@@ -17,6 +21,9 @@ RESPONSE_UPDATE_PREPARE_OK = 66
 RESPONSE_BIN_MD5_OK = 67
 RESPONSE_RECEIVE_OK = 68
 RESPONSE_UPDATE_END_OK = 69
+RESPONSE_SUPPORTS_COMPRESSION = 70
+RESPONSE_SUPPORTS_FEATURES = 71
+RESPONSE_RESUME_OK = 72
 
 RESPONSE_ERROR_MAGIC = 128
 RESPONSE_ERROR_UPDATE_PREPARE = 129
@@ -28,10 +35,28 @@ RESPONSE_ERROR_WRONG_CURRENT_FLASH_CONFIG = 134
 RESPONSE_ERROR_WRONG_NEW_FLASH_CONFIG = 135
 RESPONSE_ERROR_ESP8266_NOT_ENOUGH_SPACE = 136
 RESPONSE_ERROR_ESP32_NOT_ENOUGH_SPACE = 137
+RESPONSE_ERROR_INVALID_DELTA = 138
 RESPONSE_ERROR_UNKNOWN = 255
 
 OTA_VERSION_1_0 = 1
 
+FEATURE_SUPPORTS_COMPRESSION = 0x01
+FEATURE_SUPPORTS_RESUME = 0x02
+FEATURE_SUPPORTS_DELTA = 0x04
+
+UPLOAD_MODE_FULL = 0x00
+UPLOAD_MODE_DELTA = 0x01
+
+DELTA_COMMAND_LITERAL = 0x00
+DELTA_COMMAND_COPY = 0x01
+# Shortest run of the running firmware that is worth a copy command
+DELTA_MIN_MATCH = 64
+
+# Number of previously uploaded images kept around to diff against
+OTA_BASE_IMAGE_COUNT = 3
+# How often a dropped upload is resumed before giving up
+OTA_RESUME_ATTEMPTS = 5
+
 MAGIC_BYTES = [0x6C, 0x26, 0xF7, 0x5C, 0x45]
 
 _LOGGER = logging.getLogger(__name__)
@@ -68,6 +93,10 @@ class OTAError(EsphomeError):
     pass
 
 
+class OTAConnectionLost(OTAError):
+    """The connection dropped during the upload, but the ESP can resume it."""
+
+
 def recv_decode(sock, amount, decode=True):
     data = sock.recv(amount)
     if not decode:
@@ -149,6 +178,10 @@ def check_error(data, expect):
             "Error: The OTA partition on the ESP is too small. ESPHome needs to resize "
             "this partition, please flash over USB."
         )
+    if dat == RESPONSE_ERROR_INVALID_DELTA:
+        raise OTAError(
+            "Error: The ESP could not apply the delta update, please retry the upload."
+        )
     if dat == RESPONSE_ERROR_UNKNOWN:
         raise OTAError("Unknown error from ESP")
     if not isinstance(expect, (list, tuple)):
@@ -171,12 +204,88 @@ def send_check(sock, data, msg):
         raise OTAError(f"Error sending {msg}: {err}") from err
 
 
-def perform_ota(sock, password, file_handle, filename):
-    file_md5 = hashlib.md5(file_handle.read()).hexdigest()
-    file_size = file_handle.tell()
-    _LOGGER.info("Uploading %s (%s bytes)", filename, file_size)
-    file_handle.seek(0)
-    _LOGGER.debug("MD5 of binary is %s", file_md5)
+def _gzip_compress(contents):
+    # Fixed mtime so that a resumed upload compresses to the exact same image
+    out = io.BytesIO()
+    with gzip.GzipFile(fileobj=out, mode="wb", compresslevel=9, mtime=0) as gz:
+        gz.write(contents)
+    return out.getvalue()
+
+
+def _base_image_dir(filename):
+    return os.path.join(os.path.dirname(os.path.abspath(filename)), "ota-base")
+
+
+def load_base_image(filename, md5):
+    """Return a previously uploaded image with the given MD5, if it was kept."""
+    path = os.path.join(_base_image_dir(filename), f"{md5}.bin")
+    if not os.path.isfile(path):
+        return None
+    with open(path, "rb") as base_handle:
+        base = base_handle.read()
+    if hashlib.md5(base).hexdigest() != md5:
+        return None
+    return base
+
+
+def store_base_image(filename, contents):
+    """Keep an uploaded image so that the next upload can be sent as a delta."""
+    base_dir = _base_image_dir(filename)
+    try:
+        os.makedirs(base_dir, exist_ok=True)
+        md5 = hashlib.md5(contents).hexdigest()
+        with open(os.path.join(base_dir, f"{md5}.bin"), "wb") as base_handle:
+            base_handle.write(contents)
+        images = sorted(
+            (os.path.join(base_dir, name) for name in os.listdir(base_dir)),
+            key=os.path.getmtime,
+        )
+        for path in images[:-OTA_BASE_IMAGE_COUNT]:
+            os.remove(path)
+    except OSError as err:
+        _LOGGER.debug("Could not store image for delta updates: %s", err)
+
+
+def generate_delta(base, target, start=0):
+    """Encode target[start:] as literal and copy commands against base.
+
+    Copies may only start at word aligned offsets of base (the ESP8266 can
+    only read its flash in words), so only those are indexed.
+    """
+    index = {}
+    for offset in range(0, len(base) - DELTA_MIN_MATCH + 1, 4):
+        index.setdefault(base[offset : offset + DELTA_MIN_MATCH], offset)
+
+    delta = bytearray()
+
+    def add_literal(begin, end):
+        if end > begin:
+            delta.extend(struct.pack(">BII", DELTA_COMMAND_LITERAL, 0, end - begin))
+            delta.extend(target[begin:end])
+
+    literal_start = pos = start
+    while pos + DELTA_MIN_MATCH <= len(target):
+        source = index.get(target[pos : pos + DELTA_MIN_MATCH])
+        if source is None:
+            pos += 1
+            continue
+        length = DELTA_MIN_MATCH
+        while (
+            pos + length < len(target)
+            and source + length < len(base)
+            and target[pos + length] == base[source + length]
+        ):
+            length += 1
+        add_literal(literal_start, pos)
+        delta.extend(struct.pack(">BII", DELTA_COMMAND_COPY, source, length))
+        pos += length
+        literal_start = pos
+    add_literal(literal_start, len(target))
+    return bytes(delta)
+
+
+def perform_ota(sock, password, contents, filename):
+    _LOGGER.info("Uploading %s (%s bytes)", filename, len(contents))
 
     # Enable nodelay, we need it for phase 1
     sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
@@ -187,8 +296,27 @@ def perform_ota(sock, password, file_handle, filename):
         raise OTAError(f"Unsupported OTA version {version}")
 
     # Features
-    send_check(sock, 0x00, "features")
-    receive_exactly(sock, 1, "features", RESPONSE_HEADER_OK)
+    features = (
+        FEATURE_SUPPORTS_COMPRESSION | FEATURE_SUPPORTS_RESUME | FEATURE_SUPPORTS_DELTA
+    )
+    send_check(sock, features, "features")
+    (header,) = receive_exactly(
+        sock,
+        1,
+        "features",
+        [
+            RESPONSE_HEADER_OK,
+            RESPONSE_SUPPORTS_COMPRESSION,
+            RESPONSE_SUPPORTS_FEATURES,
+        ],
+    )
+    if header == RESPONSE_SUPPORTS_FEATURES:
+        (device_features,) = receive_exactly(sock, 1, "device features", [])
+        features &= device_features
+    elif header == RESPONSE_SUPPORTS_COMPRESSION:
+        features = FEATURE_SUPPORTS_COMPRESSION
+    else:
+        features = 0
 
     (auth,) = receive_exactly(
         sock, 1, "auth", [RESPONSE_REQUEST_AUTH, RESPONSE_AUTH_OK]
@@ -215,17 +343,57 @@ def perform_ota(sock, password, file_handle, filename):
         send_check(sock, result, "auth result")
         receive_exactly(sock, 1, "auth result", RESPONSE_AUTH_OK)
 
-    file_size_encoded = [
-        (file_size >> 24) & 0xFF,
-        (file_size >> 16) & 0xFF,
-        (file_size >> 8) & 0xFF,
-        (file_size >> 0) & 0xFF,
+    base = None
+    if features & FEATURE_SUPPORTS_DELTA:
+        running_md5 = receive_exactly(
+            sock, 32, "running firmware checksum", [], decode=False
+        ).decode()
+        _LOGGER.debug("MD5 of running firmware is %s", running_md5)
+        base = load_base_image(filename, running_md5)
+
+    # A delta only works on the plain image, the ESP copies runs of it from flash
+    if base is None and features & FEATURE_SUPPORTS_COMPRESSION:
+        upload_contents = _gzip_compress(contents)
+        _LOGGER.info("Compressed to %s bytes", len(upload_contents))
+    else:
+        upload_contents = contents
+    upload_size = len(upload_contents)
+    upload_md5 = hashlib.md5(upload_contents).hexdigest()
+    _LOGGER.debug("MD5 of upload is %s", upload_md5)
+
+    upload_size_encoded = [
+        (upload_size >> 24) & 0xFF,
+        (upload_size >> 16) & 0xFF,
+        (upload_size >> 8) & 0xFF,
+        (upload_size >> 0) & 0xFF,
     ]
-    send_check(sock, file_size_encoded, "binary size")
+    send_check(sock, upload_size_encoded, "binary size")
     receive_exactly(sock, 1, "binary size", RESPONSE_UPDATE_PREPARE_OK)
 
-    send_check(sock, file_md5, "file checksum")
-    receive_exactly(sock, 1, "file checksum", RESPONSE_BIN_MD5_OK)
+    send_check(sock, upload_md5, "file checksum")
+    (md5_result,) = receive_exactly(
+        sock, 1, "file checksum", [RESPONSE_BIN_MD5_OK, RESPONSE_RESUME_OK]
+    )
+    offset = 0
+    if md5_result == RESPONSE_RESUME_OK:
+        offset_encoded = receive_exactly(sock, 4, "resume offset", [], decode=False)
+        (offset,) = struct.unpack(">I", offset_encoded)
+        if offset > upload_size:
+            raise OTAError(f"Invalid resume offset {offset}")
+        _LOGGER.info("Resuming upload at %s of %s bytes", offset, upload_size)
+
+    data = upload_contents[offset:]
+    if features & FEATURE_SUPPORTS_DELTA:
+        mode = UPLOAD_MODE_FULL
+        if base is not None:
+            delta = generate_delta(base, upload_contents, offset)
+            if len(delta) < len(data):
+                _LOGGER.info(
+                    "Sending delta against running firmware (%s bytes)", len(delta)
+                )
+                mode = UPLOAD_MODE_DELTA
+                data = delta
+        send_check(sock, mode, "upload mode")
 
     # Disable nodelay for transfer
     sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 0)
@@ -235,21 +403,21 @@ def perform_ota(sock, password, file_handle, filename):
     # Set higher timeout during upload
     sock.settimeout(20.0)
 
-    offset = 0
+    sent = 0
     progress = ProgressBar()
-    while True:
-        chunk = file_handle.read(1024)
-        if not chunk:
-            break
-        offset += len(chunk)
+    while sent < len(data):
+        chunk = data[sent : sent + 1024]
+        sent += len(chunk)
 
         try:
             sock.sendall(chunk)
         except OSError as err:
             sys.stderr.write("\n")
+            if features & FEATURE_SUPPORTS_RESUME:
+                raise OTAConnectionLost(f"Error sending data: {err}") from err
             raise OTAError(f"Error sending data: {err}") from err
 
-        progress.update(offset / float(file_size))
+        progress.update(sent / float(len(data)))
     progress.done()
 
     # Enable nodelay for last checks
@@ -267,6 +435,18 @@ def perform_ota(sock, password, file_handle, filename):
     time.sleep(1)
 
 
+def connect_ota(ip, remote_port, remote_host):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    sock.settimeout(10.0)
+    try:
+        sock.connect((ip, remote_port))
+    except OSError as err:
+        sock.close()
+        _LOGGER.error("Connecting to %s:%s failed: %s", remote_host, remote_port, err)
+        return None
+    return sock
+
+
 def run_ota_impl_(remote_host, remote_port, password, filename):
     if is_ip_address(remote_host):
         _LOGGER.info("Connecting to %s", remote_host)
@@ -287,24 +467,43 @@ def run_ota_impl_(remote_host, remote_port, password, filename):
             raise OTAError(err) from err
         _LOGGER.info(" -> %s", ip)
 
-    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
-    sock.settimeout(10.0)
-    try:
-        sock.connect((ip, remote_port))
-    except OSError as err:
-        sock.close()
-        _LOGGER.error("Connecting to %s:%s failed: %s", remote_host, remote_port, err)
+    sock = connect_ota(ip, remote_port, remote_host)
+    if sock is None:
         return 1
 
     with open(filename, "rb") as file_handle:
+        contents = file_handle.read()
+
+    attempt = 0
+    while True:
         try:
-            perform_ota(sock, password, file_handle, filename)
+            perform_ota(sock, password, contents, filename)
+            break
+        except OTAConnectionLost as err:
+            attempt += 1
+            if attempt > OTA_RESUME_ATTEMPTS:
+                _LOGGER.error(str(err))
+                return 1
+            _LOGGER.warning("%s, reconnecting to resume the upload...", err)
         except OTAError as err:
             _LOGGER.error(str(err))
             return 1
         finally:
             sock.close()
 
+        # The ESP only notices the lost connection once its receive times out
+        time.sleep(5)
+        sock = None
+        while sock is None:
+            sock = connect_ota(ip, remote_port, remote_host)
+            if sock is None:
+                attempt += 1
+                if attempt > OTA_RESUME_ATTEMPTS:
+                    return 1
+                time.sleep(5)
+        sock.settimeout(20.0)
+
+    store_base_image(filename, contents)
     return 0
 
 
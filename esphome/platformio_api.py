@@ -106,6 +106,32 @@ def run_upload(config, verbose, port):
     )
 
 
+def report_static_storage(config):
+    """Log how much RAM the objects that codegen placed in static buffers take up."""
+    from esphome.cpp_generator import STATIC_STORAGE_SUFFIX
+
+    idedata = get_idedata(config)
+    if not idedata.nm_path or not idedata.firmware_elf_path:
+        _LOGGER.debug("report_static_storage no nm")
+        return
+    command = [idedata.nm_path, "--print-size", idedata.firmware_elf_path]
+    try:
+        symbols = subprocess.check_output(command).decode()
+    except Exception:  # pylint: disable=broad-except
+        _LOGGER.debug("Caught exception for command %s", command, exc_info=1)
+        return
+
+    count = 0
+    total = 0
+    for line in symbols.splitlines():
+        # address, size, type and name
+        parts = line.split()
+        if len(parts) == 4 and parts[3].endswith(STATIC_STORAGE_SUFFIX):
+            count += 1
+            total += int(parts[1], 16)
+    _LOGGER.info("Objects in static storage: %s, using %s bytes of RAM", count, total)
+
+
 def run_idedata(config):
     args = ["-t", "idedata"]
     stdout = run_platformio_cli_run(config, False, *args, capture_stdout=True)
@@ -294,3 +320,16 @@ class IDEData:
             return cc_path[:-7] + "addr2line.exe"
 
         return cc_path[:-3] + "addr2line"
+
+    @property
+    def nm_path(self):
+        cc_path = self.cc_path
+        if cc_path is None:
+            return None
+        # replace gcc at end with nm
+
+        # Windows
+        if cc_path.endswith(".exe"):
+            return cc_path[:-7] + "nm.exe"
+
+        return cc_path[:-3] + "nm"
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Load generator and benchmark for the native API of a running node.
+
+Connects a number of simulated clients that all subscribe to states and logs,
+toggles the switches and lights of the node in bursts from the first client and
+reports message rates, command-to-state latency and reconnect times.
+
+    script/api_benchmark.py 192.168.1.50 --clients 4 --bursts 20 --burst-size 5
+"""
+import argparse
+import os
+import sys
+import threading
+import time
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+
+# pylint: disable=wrong-import-position
+import esphome.api.api_pb2 as pb  # noqa: E402
+from esphome.api.client import APIClient, APIConnectionError  # noqa: E402
+
+COMMAND_TIMEOUT = 5.0
+
+
+def percentile(values, percent):
+    if not values:
+        return float("nan")
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(percent / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+class BenchmarkClient:
+    def __init__(self, index, args):
+        self.index = index
+        self.cli = APIClient(
+            args.address, args.port, args.password, args.encryption_key
+        )
+        self.log_level = args.log_level
+        self.lock = threading.Lock()
+        self.state_count = 0
+        self.log_count = 0
+        self.states = {}
+        self.state_listeners = []
+
+    def _on_state(self, msg):
+        with self.lock:
+            self.state_count += 1
+            self.states[msg.key] = msg
+            listeners = self.state_listeners[:]
+        for listener in listeners:
+            listener(msg)
+
+    def _on_log(self, _):
+        with self.lock:
+            self.log_count += 1
+
+    def connect(self):
+        """Connect, log in and subscribe.
+
+        Returns the time until the first state arrived.
+        """
+        first_state = threading.Event()
+
+        def on_first_state(_):
+            first_state.set()
+
+        with self.lock:
+            self.state_listeners.append(on_first_state)
+        start = time.monotonic()
+        self.cli.connect()
+        self.cli.login()
+        self.cli.subscribe_states(self._on_state)
+        if self.log_level is not None:
+            self.cli.subscribe_logs(self._on_log, log_level=self.log_level)
+        ok = first_state.wait(COMMAND_TIMEOUT)
+        elapsed = time.monotonic() - start
+        with self.lock:
+            self.state_listeners.remove(on_first_state)
+        if not ok:
+            raise APIConnectionError("No initial states received")
+        return elapsed
+
+    def counts(self):
+        with self.lock:
+            return self.state_count, self.log_count
+
+
+def find_targets(client):
+    """All switches and lights of the node as (kind, key, name)."""
+    targets = []
+    for entity in client.cli.list_entities():
+        if isinstance(entity, pb.ListEntitiesSwitchResponse):
+            targets.append(("switch", entity.key, entity.name))
+        elif isinstance(entity, pb.ListEntitiesLightResponse):
+            targets.append(("light", entity.key, entity.name))
+    return targets
+
+
+def make_command(kind, key, state):
+    if kind == "switch":
+        return pb.SwitchCommandRequest(key=key, state=state)
+    return pb.LightCommandRequest(key=key, has_state=True, state=state)
+
+
+def run_bursts(client, targets, args):
+    """Toggle targets and measure the time until the new state is reported back."""
+    latencies = []
+    timeouts = 0
+    pending = {}
+    pending_lock = threading.Lock()
+
+    def on_state(msg):
+        with pending_lock:
+            entry = pending.get(msg.key)
+            if entry is None or bool(msg.state) != entry[1]:
+                return
+            del pending[msg.key]
+            latencies.append(time.monotonic() - entry[0])
+            if not pending:
+                all_done.set()
+
+    with client.lock:
+        client.state_listeners.append(on_state)
+    try:
+        for _ in range(args.bursts):
+            all_done = threading.Event()
+            with pending_lock:
+                pending.clear()
+            for i in range(args.burst_size):
+                kind, key, _ = targets[i % len(targets)]
+                with client.lock:
+                    current = client.states.get(key)
+                new_state = not (current is not None and current.state)
+                with pending_lock:
+                    pending[key] = (time.monotonic(), new_state)
+                client.cli.send_command(make_command(kind, key, new_state))
+            if not all_done.wait(COMMAND_TIMEOUT):
+                with pending_lock:
+                    timeouts += len(pending)
+            time.sleep(args.burst_interval)
+    finally:
+        with client.lock:
+            client.state_listeners.remove(on_state)
+    return latencies, timeouts
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("address", help="IP address or hostname of the node")
+    parser.add_argument("--port", type=int, default=6053)
+    parser.add_argument("--password", default=None)
+    parser.add_argument(
+        "--encryption-key", default=None, help="The key of api: encryption:"
+    )
+    parser.add_argument("--clients", type=int, default=2, help="Simulated clients")
+    parser.add_argument("--bursts", type=int, default=10)
+    parser.add_argument("--burst-size", type=int, default=4, help="Commands per burst")
+    parser.add_argument(
+        "--burst-interval", type=float, default=0.5, help="Seconds between bursts"
+    )
+    parser.add_argument(
+        "--log-level",
+        type=int,
+        default=pb.DEBUG,
+        help="Log level to subscribe to (0 to not subscribe)",
+    )
+    parser.add_argument(
+        "--reconnects", type=int, default=3, help="Reconnects of the first client"
+    )
+    args = parser.parse_args()
+    if args.log_level == 0:
+        args.log_level = None
+
+    clients = [BenchmarkClient(i, args) for i in range(args.clients)]
+    for client in clients:
+        client.cli.start()
+
+    try:
+        connect_times = [client.connect() for client in clients]
+        print(
+            f"Connected {len(clients)} clients, initial state after "
+            f"p50={percentile(connect_times, 50) * 1000:.0f}ms "
+            f"max={max(connect_times) * 1000:.0f}ms"
+        )
+
+        targets = find_targets(clients[0])
+        latencies, timeouts = [], 0
+        start_counts = [client.counts() for client in clients]
+        start = time.monotonic()
+        if targets:
+            latencies, timeouts = run_bursts(clients[0], targets, args)
+        else:
+            print("No switches or lights found, only measuring message rates")
+            time.sleep(args.bursts * args.burst_interval)
+        duration = time.monotonic() - start
+
+        for client, (states_before, logs_before) in zip(clients, start_counts):
+            states, logs = client.counts()
+            state_rate = (states - states_before) / duration
+            log_rate = (logs - logs_before) / duration
+            print(
+                f"Client {client.index}: {state_rate:.1f} states/s, "
+                f"{log_rate:.1f} logs/s"
+            )
+        if latencies:
+            print(
+                f"Command to state latency over {len(latencies)} commands: "
+                f"p50={percentile(latencies, 50) * 1000:.1f}ms "
+                f"p99={percentile(latencies, 99) * 1000:.1f}ms "
+                f"max={max(latencies) * 1000:.1f}ms, {timeouts} timed out"
+            )
+
+        reconnect_times = []
+        for _ in range(args.reconnects):
+            clients[0].cli.disconnect()
+            reconnect_times.append(clients[0].connect())
+        if reconnect_times:
+            print(
+                f"Reconnect until initial state: "
+                f"p50={percentile(reconnect_times, 50) * 1000:.0f}ms "
+                f"max={max(reconnect_times) * 1000:.0f}ms"
+            )
+    except APIConnectionError as err:
+        print(f"Benchmark failed: {err}")
+        return 1
+    finally:
+        for client in clients:
+            client.cli.stop(True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -181,6 +181,16 @@ class TypeInfo:
 
     encode_func = None
 
+    @property
+    def size_func(self):
+        # ProtoSize::add_*_field() mirrors ProtoWriteBuffer::encode_*()
+        name, sep, template = self.encode_func.partition("<")
+        return name.replace("encode_", "add_", 1) + "_field" + sep + template
+
+    @property
+    def calculate_size_content(self):
+        return f"ProtoSize::{self.size_func}(total_size, {self.number}, this->{self.field_name});"
+
     @property
     def dump_content(self):
         o = f'out.append("  {self.name}: ");\n'
@@ -529,6 +539,13 @@ class RepeatedTypeInfo(TypeInfo):
         o += f"}}"
         return o
 
+    @property
+    def calculate_size_content(self):
+        o = f"for (auto {'' if self._ti_is_bool else '&'}it : this->{self.field_name}) {{\n"
+        o += f"  ProtoSize::{self._ti.size_func}(total_size, {self.number}, it, true);\n"
+        o += f"}}"
+        return o
+
     @property
     def dump_content(self):
         o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
@@ -567,6 +584,7 @@ def build_message_type(desc):
     decode_32bit = []
     decode_64bit = []
     encode = []
+    calculate_size = []
     dump = []
 
     for field in desc.field:
@@ -577,6 +595,7 @@ def build_message_type(desc):
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
         encode.append(ti.encode_content)
+        calculate_size.append(ti.calculate_size_content)
 
         if ti.decode_varint_content:
             decode_varint.append(ti.decode_varint_content)
@@ -643,13 +662,26 @@ def build_message_type(desc):
     prot = "void encode(ProtoWriteBuffer buffer) const override;"
     public_content.append(prot)
 
+    o = f"void {desc.name}::calculate_size(uint32_t &total_size) const {{"
+    if calculate_size:
+        if len(calculate_size) == 1 and len(calculate_size[0]) + len(o) + 3 < 120:
+            o += f" {calculate_size[0]} "
+        else:
+            o += "\n"
+            o += indent("\n".join(calculate_size)) + "\n"
+    o += "}\n"
+    cpp += o
+    prot = "void calculate_size(uint32_t &total_size) const override;"
+    public_content.append(prot)
+
     o = f"void {desc.name}::dump_to(std::string &out) const {{"
     if dump:
         if len(dump) == 1 and len(dump[0]) + len(o) + 3 < 120:
             o += f" {dump[0]} "
         else:
             o += "\n"
-            o += f"  char buffer[64];\n"
+            if any("buffer" in line for line in dump):
+                o += "  char buffer[64];\n"
             o += f'  out.append("{desc.name} {{\\n");\n'
             o += indent("\n".join(dump)) + "\n"
             o += f'  out.append("}}");\n'
@@ -0,0 +1,99 @@
+#pragma once
+
+// A small benchmark harness for the host build, modelled after Google Benchmark:
+//
+//   static void bm_something(benchmark::State &state) {
+//     while (state.keep_running())
+//       benchmark::do_not_optimize(something());
+//   }
+//   BENCHMARK(bm_something);
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/// Calls of operator new and bytes requested by them since the start of the program, see benchmark_main.cpp.
+struct AllocCounters {
+  uint64_t allocs;
+  uint64_t bytes;
+};
+extern AllocCounters global_alloc_counters;  // NOLINT
+
+class State {
+ public:
+  explicit State(uint64_t iterations) : remaining_(iterations), iterations_(iterations) {}
+
+  /// Returns true until the requested number of iterations ran, the loop around the measured code.
+  bool keep_running() {
+    if (this->remaining_ == this->iterations_)
+      this->resume_timing();
+    if (this->remaining_ == 0) {
+      this->pause_timing();
+      return false;
+    }
+    this->remaining_--;
+    return true;
+  }
+  /// Exclude setup work inside the loop from the measurement.
+  void pause_timing() {
+    this->elapsed_ += std::chrono::steady_clock::now() - this->start_;
+    this->allocs_ += global_alloc_counters.allocs - this->start_allocs_.allocs;
+    this->alloc_bytes_ += global_alloc_counters.bytes - this->start_allocs_.bytes;
+  }
+  void resume_timing() {
+    this->start_allocs_ = global_alloc_counters;
+    this->start_ = std::chrono::steady_clock::now();
+  }
+
+  uint64_t iterations() const { return this->iterations_; }
+  std::chrono::nanoseconds elapsed() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(this->elapsed_);
+  }
+  /// Heap allocations of the measured code, over all iterations.
+  uint64_t allocs() const { return this->allocs_; }
+  uint64_t alloc_bytes() const { return this->alloc_bytes_; }
+
+ protected:
+  uint64_t remaining_;
+  uint64_t iterations_;
+  std::chrono::steady_clock::time_point start_;
+  std::chrono::steady_clock::duration elapsed_{0};
+  AllocCounters start_allocs_{0, 0};
+  uint64_t allocs_{0};
+  uint64_t alloc_bytes_{0};
+};
+
+using Function = std::function<void(State &)>;
+
+struct Benchmark {
+  std::string name;
+  Function function;
+};
+
+/// All benchmarks registered with BENCHMARK() or register_benchmark().
+std::vector<Benchmark> &registry();
+
+/// Register a benchmark at runtime, for example one per case of a table.
+inline void register_benchmark(const std::string &name, Function function) {
+  registry().push_back(Benchmark{name, std::move(function)});
+}
+
+struct Registration {
+  Registration(const char *name, Function function) { register_benchmark(name, std::move(function)); }
+};
+
+/// Keep the compiler from optimizing away a value that is otherwise unused.
+template<typename T> inline void do_not_optimize(T const &value) { asm volatile("" : : "r,m"(value) : "memory"); }
+/// Keep the compiler from optimizing away writes to memory.
+inline void clobber_memory() { asm volatile("" : : : "memory"); }
+
+}  // namespace benchmark
+
+#define BENCHMARK_CONCAT_(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_(a, b)
+#define BENCHMARK(function) \
+  static ::benchmark::Registration BENCHMARK_CONCAT(benchmark_registration_, __LINE__)(#function, function)
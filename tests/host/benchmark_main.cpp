@@ -0,0 +1,75 @@
+#include "benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace benchmark {
+
+AllocCounters global_alloc_counters{0, 0};  // NOLINT
+
+std::vector<Benchmark> &registry() {
+  static std::vector<Benchmark> benchmarks;  // NOLINT
+  return benchmarks;
+}
+
+}  // namespace benchmark
+
+// Count the heap allocations of the C++ code, malloc() isn't used directly by the benchmarked code
+void *operator new(size_t size) {
+  benchmark::global_alloc_counters.allocs++;
+  benchmark::global_alloc_counters.bytes += size;
+  void *ptr = malloc(size ? size : 1);
+  if (ptr == nullptr)
+    abort();
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t size) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t size) noexcept { free(ptr); }
+
+static void print_usage(const char *program) {
+  printf("Usage: %s [--min-time=<seconds>] [filter]\n", program);
+  printf("Runs all benchmarks whose name contains the filter, each for at least min-time (default 0.5s).\n");
+}
+
+int main(int argc, char **argv) {
+  const char *filter = nullptr;
+  double min_time = 0.5;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--min-time=", 11) == 0) {
+      min_time = atof(argv[i] + 11);
+    } else if (argv[i][0] == '-') {
+      print_usage(argv[0]);
+      return 1;
+    } else {
+      filter = argv[i];
+    }
+  }
+
+  printf("%-48s %14s %12s %12s %12s\n", "Benchmark", "Time/iter(ns)", "Allocs/iter", "Bytes/iter", "Iterations");
+  for (auto &bm : benchmark::registry()) {
+    if (filter != nullptr && strstr(bm.name.c_str(), filter) == nullptr)
+      continue;
+
+    // Run with more and more iterations until a run takes long enough to measure reliably
+    uint64_t iterations = 1;
+    while (true) {
+      benchmark::State state(iterations);
+      bm.function(state);
+      double seconds = state.elapsed().count() / 1e9;
+      if (seconds >= min_time || iterations >= (1ULL << 40)) {
+        printf("%-48s %14.1f %12.1f %12.1f %12llu\n", bm.name.c_str(), state.elapsed().count() / double(iterations),
+               state.allocs() / double(iterations), state.alloc_bytes() / double(iterations),
+               static_cast<unsigned long long>(iterations));
+        break;
+      }
+      // Aim a bit above the minimum time, but at most grow tenfold
+      uint64_t next = seconds <= min_time / 10 ? iterations * 10 : uint64_t(iterations * min_time * 1.4 / seconds);
+      iterations = next > iterations ? next : iterations + 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,23 @@
+#include "../benchmark.h"
+#include "esphome/components/api/proto_benchmark.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace esphome;
+using namespace esphome::api;
+
+// One benchmark per case of ProtoBenchmark, the same cases the api_benchmark option of the debug component runs
+static bool register_api_benchmarks() {
+  std::shared_ptr<ProtoBenchmark> cases(new ProtoBenchmark());
+  for (size_t i = 0; i < cases->size(); i++) {
+    std::string name = std::string("bm_api_") + cases->get_name(i);
+    std::replace(name.begin(), name.end(), ' ', '_');
+    benchmark::register_benchmark(name, [cases, i](benchmark::State &state) {
+      while (state.keep_running())
+        cases->run(i);
+    });
+  }
+  return true;
+}
+static const bool API_BENCHMARKS_REGISTERED = register_api_benchmarks();  // NOLINT
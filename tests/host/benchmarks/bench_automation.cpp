@@ -0,0 +1,20 @@
+#include "../benchmark.h"
+#include "esphome/core/base_automation.h"
+
+using namespace esphome;
+
+// A text_sensor on_value style automation, the argument is passed through a chain of actions
+static void bm_automation_string_chain(benchmark::State &state) {
+  Trigger<std::string> trigger;
+  Automation<std::string> automation(&trigger);
+  size_t length = 0;
+  auto condition = new LambdaCondition<std::string>([](const std::string &x) { return !x.empty(); });
+  auto if_action = new IfAction<std::string>(condition);
+  if_action->add_then({new LambdaAction<std::string>([&length](const std::string &x) { length += x.size(); })});
+  automation.add_actions({if_action, new LambdaAction<std::string>([&length](const std::string &x) { length++; })});
+  const std::string value = "a text sensor state that does not fit the small string buffer";
+  while (state.keep_running())
+    trigger.trigger(value);
+  benchmark::do_not_optimize(length);
+}
+BENCHMARK(bm_automation_string_chain);
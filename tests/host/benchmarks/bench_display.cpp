@@ -0,0 +1,68 @@
+#include "../benchmark.h"
+#include "esphome/components/display/display_buffer.h"
+
+using namespace esphome;
+using namespace esphome::display;
+
+namespace {
+
+// A 1 bit per pixel buffer the size of a common SSD1306 display
+class MemoryDisplay : public DisplayBuffer {
+ public:
+  MemoryDisplay() { this->init_internal_(WIDTH * HEIGHT / 8); }
+
+ protected:
+  static const int WIDTH = 128;
+  static const int HEIGHT = 64;
+
+  void draw_absolute_pixel_internal(int x, int y, Color color) override {
+    if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT)
+      return;
+    uint16_t pos = x + (y / 8) * WIDTH;
+    uint8_t bit = 1 << (y % 8);
+    if (color.is_on())
+      this->buffer_[pos] |= bit;
+    else
+      this->buffer_[pos] &= ~bit;
+  }
+  int get_height_internal() override { return HEIGHT; }
+  int get_width_internal() override { return WIDTH; }
+};
+
+}  // namespace
+
+static void bm_display_fill(benchmark::State &state) {
+  MemoryDisplay display;
+  while (state.keep_running()) {
+    display.fill(COLOR_ON);
+    benchmark::clobber_memory();
+  }
+}
+BENCHMARK(bm_display_fill);
+
+static void bm_display_line(benchmark::State &state) {
+  MemoryDisplay display;
+  while (state.keep_running()) {
+    display.line(0, 0, 127, 63);
+    benchmark::clobber_memory();
+  }
+}
+BENCHMARK(bm_display_line);
+
+static void bm_display_filled_rectangle(benchmark::State &state) {
+  MemoryDisplay display;
+  while (state.keep_running()) {
+    display.filled_rectangle(10, 10, 100, 40);
+    benchmark::clobber_memory();
+  }
+}
+BENCHMARK(bm_display_filled_rectangle);
+
+static void bm_display_filled_circle(benchmark::State &state) {
+  MemoryDisplay display;
+  while (state.keep_running()) {
+    display.filled_circle(64, 32, 30);
+    benchmark::clobber_memory();
+  }
+}
+BENCHMARK(bm_display_filled_circle);
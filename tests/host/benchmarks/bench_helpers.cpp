@@ -0,0 +1,43 @@
+#include "../benchmark.h"
+#include "esphome/core/helpers.h"
+
+using namespace esphome;
+
+static void bm_fnv1_hash(benchmark::State &state) {
+  const char *name = "living_room_temperature";
+  while (state.keep_running())
+    benchmark::do_not_optimize(fnv1_hash(name));
+}
+BENCHMARK(bm_fnv1_hash);
+
+static void bm_value_accuracy_to_string(benchmark::State &state) {
+  float value = 21.3456f;
+  while (state.keep_running())
+    benchmark::do_not_optimize(value_accuracy_to_string(value, 2));
+}
+BENCHMARK(bm_value_accuracy_to_string);
+
+static void bm_sanitize_object_id(benchmark::State &state) {
+  const std::string name = "Living Room Temperature (Sensor #2)";
+  while (state.keep_running())
+    benchmark::do_not_optimize(sanitize_string_allowlist(to_lowercase_underscore(name), HOSTNAME_CHARACTER_ALLOWLIST));
+}
+BENCHMARK(bm_sanitize_object_id);
+
+static void bm_crc8(benchmark::State &state) {
+  uint8_t data[8] = {0x28, 0xFF, 0x4C, 0x3A, 0x91, 0x16, 0x04, 0x00};
+  while (state.keep_running())
+    benchmark::do_not_optimize(crc8(data, sizeof(data)));
+}
+BENCHMARK(bm_crc8);
+
+static void bm_callback_manager_call(benchmark::State &state) {
+  CallbackManager<void(float)> callbacks;
+  float sum = 0;
+  for (int i = 0; i < 5; i++)
+    callbacks.add([&sum](float value) { sum += value; });
+  while (state.keep_running())
+    callbacks.call(1.0f);
+  benchmark::do_not_optimize(sum);
+}
+BENCHMARK(bm_callback_manager_call);
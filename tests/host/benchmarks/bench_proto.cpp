@@ -0,0 +1,101 @@
+#include "../benchmark.h"
+#include "esphome/components/api/proto.h"
+
+using namespace esphome;
+using namespace esphome::api;
+
+namespace {
+
+// Shaped like a SensorStateResponse, without depending on the generated api_pb2.cpp
+class StateMessage : public ProtoMessage {
+ public:
+  void encode(ProtoWriteBuffer buffer) const override {
+    buffer.encode_fixed32(1, this->key);
+    buffer.encode_float(2, this->state);
+    buffer.encode_bool(3, this->missing_state);
+    buffer.encode_string(4, this->object_id);
+  }
+  void calculate_size(uint32_t &total_size) const override {
+    ProtoSize::add_fixed32_field(total_size, 1, this->key);
+    ProtoSize::add_float_field(total_size, 1, this->state);
+    ProtoSize::add_bool_field(total_size, 1, this->missing_state);
+    ProtoSize::add_string_field(total_size, 1, this->object_id);
+  }
+  void dump_to(std::string &out) const override {}
+
+  uint32_t key{0};
+  float state{0};
+  bool missing_state{false};
+  std::string object_id;
+
+ protected:
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override {
+    if (field_id != 3)
+      return false;
+    this->missing_state = value.as_bool();
+    return true;
+  }
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override {
+    if (field_id != 4)
+      return false;
+    this->object_id = value.as_string();
+    return true;
+  }
+  bool decode_32bit(uint32_t field_id, Proto32Bit value) override {
+    if (field_id == 1) {
+      this->key = value.as_fixed32();
+    } else if (field_id == 2) {
+      this->state = value.as_float();
+    } else {
+      return false;
+    }
+    return true;
+  }
+};
+
+StateMessage make_message() {
+  StateMessage msg;
+  msg.key = 0x12345678;
+  msg.state = 21.5f;
+  msg.object_id = "living_room_temperature";
+  return msg;
+}
+
+}  // namespace
+
+static void bm_proto_encode(benchmark::State &state) {
+  StateMessage msg = make_message();
+  std::vector<uint8_t> buffer;
+  buffer.reserve(64);
+  while (state.keep_running()) {
+    buffer.clear();
+    msg.encode(ProtoWriteBuffer(&buffer));
+    benchmark::clobber_memory();
+  }
+}
+BENCHMARK(bm_proto_encode);
+
+static void bm_proto_decode(benchmark::State &state) {
+  std::vector<uint8_t> buffer;
+  make_message().encode(ProtoWriteBuffer(&buffer));
+  StateMessage msg;
+  while (state.keep_running()) {
+    msg.decode(buffer.data(), buffer.size());
+    benchmark::do_not_optimize(msg.key);
+  }
+}
+BENCHMARK(bm_proto_decode);
+
+static void bm_proto_varint(benchmark::State &state) {
+  std::vector<uint8_t> buffer;
+  buffer.reserve(16);
+  uint32_t value = 1;
+  while (state.keep_running()) {
+    buffer.clear();
+    ProtoVarInt(value).encode(buffer);
+    uint32_t consumed;
+    benchmark::do_not_optimize(ProtoVarInt::parse(buffer.data(), buffer.size(), &consumed));
+    value = value * 3 + 1;
+  }
+}
+BENCHMARK(bm_proto_varint);
@@ -0,0 +1,50 @@
+#include "../benchmark.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+
+using namespace esphome;
+using namespace esphome::remote_base;
+
+namespace {
+
+// What a receiver hands to the protocols, marks positive and spaces negative
+std::vector<int16_t> to_raw(const RemoteTransmitData &data) {
+  std::vector<int16_t> raw;
+  for (int32_t value : data.get_data())
+    raw.push_back(int16_t(value));
+  return raw;
+}
+
+}  // namespace
+
+static void bm_remote_nec_encode(benchmark::State &state) {
+  NECProtocol protocol;
+  RemoteTransmitData data;
+  while (state.keep_running()) {
+    data.reset();
+    protocol.encode(&data, NECData{0x1234, 0x78E1});
+    benchmark::clobber_memory();
+  }
+}
+BENCHMARK(bm_remote_nec_encode);
+
+static void bm_remote_nec_decode(benchmark::State &state) {
+  NECProtocol protocol;
+  RemoteTransmitData data;
+  protocol.encode(&data, NECData{0x1234, 0x78E1});
+  std::vector<int16_t> raw = to_raw(data);
+  while (state.keep_running())
+    benchmark::do_not_optimize(protocol.decode(RemoteReceiveData(raw.data(), raw.size(), 25)));
+}
+BENCHMARK(bm_remote_nec_decode);
+
+// A frame of another protocol is tried against NEC first on a receiver with several dumpers
+static void bm_remote_nec_decode_mismatch(benchmark::State &state) {
+  NECProtocol protocol;
+  RemoteTransmitData data;
+  SamsungProtocol().encode(&data, SamsungData{0xE0E040BF, 32});
+  std::vector<int16_t> raw = to_raw(data);
+  while (state.keep_running())
+    benchmark::do_not_optimize(protocol.decode(RemoteReceiveData(raw.data(), raw.size(), 25)));
+}
+BENCHMARK(bm_remote_nec_decode_mismatch);
@@ -0,0 +1,62 @@
+#include "../benchmark.h"
+#include "esphome/core/component.h"
+#include "esphome/core/scheduler.h"
+
+using namespace esphome;
+
+namespace {
+
+class DummyComponent : public Component {};
+
+}  // namespace
+
+// Re-arm a named timeout every loop, like a debounce that is retriggered before it fires
+static void bm_scheduler_set_cancel_timeout(benchmark::State &state) {
+  Scheduler scheduler;
+  scheduler.reserve_pool(8);
+  DummyComponent component;
+  while (state.keep_running()) {
+    scheduler.set_timeout(&component, "debounce", 1000, []() {});
+    scheduler.call();
+  }
+}
+BENCHMARK(bm_scheduler_set_cancel_timeout);
+
+// Several components re-arming their debounce timeouts in the same loop, with the pool size of a device
+static void bm_scheduler_rearm_many(benchmark::State &state) {
+  std::vector<DummyComponent> components(4);
+  Scheduler scheduler;
+  scheduler.reserve_pool(components.size() + 8);
+  while (state.keep_running()) {
+    for (auto &component : components)
+      scheduler.set_timeout(&component, "debounce", 1000, []() {});
+    scheduler.call();
+  }
+}
+BENCHMARK(bm_scheduler_rearm_many);
+
+// The cost of Scheduler::call() when intervals of many components are pending but none is due
+static void bm_scheduler_call_idle(benchmark::State &state) {
+  Scheduler scheduler;
+  std::vector<DummyComponent> components(64);
+  for (auto &component : components)
+    scheduler.set_interval(&component, "update", 60000, []() {});
+  scheduler.process_to_add();
+  while (state.keep_running())
+    scheduler.call();
+}
+BENCHMARK(bm_scheduler_call_idle);
+
+// defer() from a component, run on the next call()
+static void bm_scheduler_defer(benchmark::State &state) {
+  Scheduler scheduler;
+  scheduler.reserve_pool(8);
+  DummyComponent component;
+  uint32_t count = 0;
+  while (state.keep_running()) {
+    scheduler.set_timeout(&component, static_cast<const char *>(nullptr), 0, [&count]() { count++; });
+    scheduler.call();
+  }
+  benchmark::do_not_optimize(count);
+}
+BENCHMARK(bm_scheduler_defer);
@@ -0,0 +1,43 @@
+#include "../benchmark.h"
+#include "esphome/components/sensor/filter.h"
+#include "esphome/components/sensor/sensor.h"
+
+using namespace esphome;
+using namespace esphome::sensor;
+
+// Publish through a filter chain and measure the whole publish_state(), including the state callback
+static void run_sensor(benchmark::State &state, const std::vector<Filter *> &filters) {
+  Sensor sensor;
+  sensor.set_filters(filters);
+  float sum = 0;
+  sensor.add_on_state_callback([&sum](float value) { sum += value; });
+  float value = 0;
+  while (state.keep_running()) {
+    sensor.publish_state(value);
+    value += 0.25f;
+  }
+  benchmark::do_not_optimize(sum);
+}
+
+static void bm_sensor_publish_unfiltered(benchmark::State &state) { run_sensor(state, {}); }
+BENCHMARK(bm_sensor_publish_unfiltered);
+
+static void bm_sensor_publish_offset_multiply(benchmark::State &state) {
+  run_sensor(state, {new OffsetFilter(1.5f), new MultiplyFilter(0.9f)});
+}
+BENCHMARK(bm_sensor_publish_offset_multiply);
+
+static void bm_sensor_publish_sliding_window_average(benchmark::State &state) {
+  run_sensor(state, {new SlidingWindowMovingAverageFilter(15, 1, 1)});
+}
+BENCHMARK(bm_sensor_publish_sliding_window_average);
+
+static void bm_sensor_publish_exponential_average(benchmark::State &state) {
+  run_sensor(state, {new ExponentialMovingAverageFilter(0.1f, 1)});
+}
+BENCHMARK(bm_sensor_publish_exponential_average);
+
+static void bm_sensor_publish_median(benchmark::State &state) {
+  run_sensor(state, {new MedianFilter(15, 1, 1)});
+}
+BENCHMARK(bm_sensor_publish_median);
@@ -0,0 +1,69 @@
+// Implementation of the Arduino functions declared in tests/host/include/Arduino.h, and of the parts of
+// esphome/core/esphal.cpp and esphome/core/preferences.cpp that the host build needs instead of those files.
+
+#include "Arduino.h"
+#include "esphome/core/esphal.h"
+#include "esphome/core/preferences.h"
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+static const auto BOOT_TIME = std::chrono::steady_clock::now();  // NOLINT
+
+uint32_t millis() {
+  auto elapsed = std::chrono::steady_clock::now() - BOOT_TIME;
+  return uint32_t(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+}
+uint32_t micros() {
+  auto elapsed = std::chrono::steady_clock::now() - BOOT_TIME;
+  return uint32_t(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+
+// There are no pins on the host, reads of a pin return what was last written to it
+static uint8_t pin_levels[256] = {};  // NOLINT
+void pinMode(uint8_t pin, uint8_t mode) {}  // NOLINT
+void digitalWrite(uint8_t pin, uint8_t value) { pin_levels[pin] = value; }  // NOLINT
+int digitalRead(uint8_t pin) { return pin_levels[pin]; }  // NOLINT
+
+uint32_t os_random() {
+  static std::mt19937 generator(std::random_device{}());  // NOLINT
+  return generator();
+}
+
+char *dtostrf(double number, signed char width, unsigned char prec, char *s) {
+  sprintf(s, "%*.*f", width, prec, number);
+  return s;
+}
+
+void EspClass::restart() { exit(0); }
+EspClass ESP;  // NOLINT
+
+namespace esphome {
+
+void force_link_symbols() {}
+
+// Preferences aren't stored on the host, every load fails like on a freshly flashed device.
+ESPPreferenceObject::ESPPreferenceObject() : offset_(0), length_words_(0), type_(0), data_(nullptr) {}
+ESPPreferenceObject::ESPPreferenceObject(size_t offset, size_t length, uint32_t type)
+    : offset_(offset), length_words_(length), type_(type), data_(new uint32_t[length + 1]) {}
+bool ESPPreferenceObject::is_initialized() const { return this->data_ != nullptr; }
+bool ESPPreferenceObject::save_() { return false; }
+bool ESPPreferenceObject::load_() { return false; }
+
+ESPPreferences::ESPPreferences() : current_offset_(0) {}
+void ESPPreferences::begin() {}
+ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
+  return ESPPreferenceObject(this->current_offset_, length, type);
+}
+ESPPreferenceObject ESPPreferences::make_tiered_preference(size_t length, uint32_t type) {
+  return this->make_preference(length, type);
+}
+void ESPPreferences::sync() {}
+
+ESPPreferences global_preferences;  // NOLINT
+
+}  // namespace esphome
@@ -0,0 +1,54 @@
+#pragma once
+
+// Minimal replacement of the Arduino core for the host build, see tests/host/README.md.
+// Only what esphome/core and the components compiled for the host need is provided.
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <math.h>
+#include <string>
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define ICACHE_RODATA_ATTR
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+
+static const uint8_t INPUT = 0x01;
+static const uint8_t OUTPUT = 0x02;
+static const uint8_t INPUT_PULLUP = 0x04;
+static const uint8_t OUTPUT_OPEN_DRAIN = 0x12;
+static const uint8_t HIGH = 0x1;
+static const uint8_t LOW = 0x0;
+static const uint8_t RISING = 0x01;
+static const uint8_t FALLING = 0x02;
+static const uint8_t CHANGE = 0x03;
+
+typedef uint8_t byte;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);  // NOLINT
+void digitalWrite(uint8_t pin, uint8_t value);  // NOLINT
+int digitalRead(uint8_t pin);  // NOLINT
+
+extern "C" uint32_t os_random();
+char *dtostrf(double number, signed char width, unsigned char prec, char *s);
+
+class EspClass {
+ public:
+  void restart();
+  void wdtFeed() {}
+  uint32_t getFreeHeap() { return 0; }
+};
+extern EspClass ESP;
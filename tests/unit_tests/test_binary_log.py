@@ -0,0 +1,81 @@
+import struct
+
+import pytest
+
+from esphome.api import binary_log
+
+
+def _elf(sections):
+    """A little endian 32 bit ELF file with the given (address, data) sections."""
+    header_size = 0x34
+    data = b""
+    offsets = []
+    for _, content in sections:
+        offsets.append(header_size + len(data))
+        data += content
+    shoff = header_size + len(data)
+    header = b"\x7fELF\x01\x01\x01" + bytes(9)
+    # e_type .. e_shentsize, then e_shnum and e_shstrndx
+    header += struct.pack("<HHIIIIIHHHH", 2, 94, 1, 0, 0, shoff, 0, 52, 0, 0, 40)
+    header += struct.pack("<HH", len(sections) + 1, 0)
+    section_headers = bytes(40)
+    for (address, content), offset in zip(sections, offsets):
+        flags = binary_log.SHF_ALLOC
+        section_headers += struct.pack(
+            "<IIIIIIIIII", 0, 1, flags, address, offset, len(content), 0, 0, 1, 0
+        )
+    return header + data + section_headers
+
+
+@pytest.mark.parametrize(
+    "fmt, args, expected",
+    (
+        ("plain text %%", b"", "plain text %"),
+        (
+            "'%s': Sending state %.5f %s with %d decimals of accuracy",
+            b"Temp\0" + struct.pack("<d", 21.5) + b"C\0" + struct.pack("<i", 1),
+            "'Temp': Sending state 21.50000 C with 1 decimals of accuracy",
+        ),
+        (
+            "%u bytes at 0x%08X, %c",
+            struct.pack("<IIi", 123, 0xDEADBEEF, ord("k")),
+            "123 bytes at 0xDEADBEEF, k",
+        ),
+        ("%lld %02hhx %hd", struct.pack("<qIi", -5, 0x1FF, -3), "-5 ff -3"),
+        ("%*d|%-*s|", struct.pack("<iii", 6, 12, 4) + b"ab\0", "    12|ab  |"),
+        # The node stops encoding at unknown conversions and at the end of the buffer
+        ("%S stops %d", b"", "%S stops %d"),
+        ("%s at the end %d", b"a too", "a too at the end %d"),
+    ),
+)
+def test_format_message(fmt, args, expected):
+    assert binary_log.format_message(fmt, args) == expected
+
+
+def test_parse_binary_log_message():
+    raw = b"\x08\x05" + b"\x15" + struct.pack("<I", 0x3F400010)
+    raw += b"\x1d" + struct.pack("<I", 0x3F400020) + b"\x20\x2a" + b"\x2a\x02\x01\x00"
+
+    assert binary_log.parse_binary_log_message(raw) == (
+        5,
+        0x3F400010,
+        0x3F400020,
+        42,
+        b"\x01\x00",
+    )
+
+
+def test_format_log_line(tmp_path):
+    path = tmp_path / "firmware.elf"
+    path.write_bytes(_elf([(0x3F400000, b"sensor\0Got %d\n\0Oct 14 2026, 09:17:25\0")]))
+    strings = binary_log.FirmwareStrings(str(path))
+
+    assert strings.contains(b"Oct 14 2026, 09:17:25")
+    assert strings.get_string(0x3F400000) == "sensor"
+    assert strings.get_string(0x40000000) is None
+    assert (
+        binary_log.format_log_line(
+            strings, 5, 0x3F400000, 0x3F400007, 7, struct.pack("<i", 3)
+        )
+        == "\033[0;36m[D][sensor:007]: Got 3\033[0m"
+    )
@@ -0,0 +1,43 @@
+import base64
+
+import pytest
+
+from esphome.api import frame_cipher
+
+pytest.importorskip("cryptography")
+
+PSK = bytes(range(32))
+CLIENT_NONCE = bytes(range(0x10, 0x20))
+SERVER_NONCE = bytes(range(0x20, 0x30))
+
+# Frames of a node with these nonces: PingResponse and then a message 29 with "abc"
+NODE_FRAMES = (
+    "0100128ff317d94bbb9d9e5b9aae4b9962b9c12dc7",
+    "010015ac7018bee298132a3065e26b085b8ff8513d30df4e",
+)
+
+
+def test_decode_key():
+    assert frame_cipher.decode_key(base64.b64encode(PSK).decode()) == PSK
+    with pytest.raises(ValueError):
+        frame_cipher.decode_key(base64.b64encode(PSK[:16]).decode())
+
+
+def test_decrypt_node_frames():
+    cipher = frame_cipher.FrameCipher(PSK, CLIENT_NONCE, SERVER_NONCE)
+    frames = [bytes.fromhex(frame) for frame in NODE_FRAMES]
+
+    assert cipher.decrypt(frames[0][:3], frames[0][3:]) == (8, b"")
+    assert cipher.decrypt(frames[1][:3], frames[1][3:]) == (29, b"abc")
+    # Replayed frames have the wrong counter
+    with pytest.raises(ValueError):
+        cipher.decrypt(frames[0][:3], frames[0][3:])
+
+
+def test_encrypt():
+    cipher = frame_cipher.FrameCipher(PSK, CLIENT_NONCE, SERVER_NONCE)
+
+    frame = cipher.encrypt(7, b"")
+    assert frame[:3] == frame_cipher.frame_header(2 + frame_cipher.TAG_SIZE)
+    # The second frame uses the next counter
+    assert cipher.encrypt(7, b"")[3:] != frame[3:]